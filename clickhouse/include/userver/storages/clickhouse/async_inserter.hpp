@@ -0,0 +1,257 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/async_inserter.hpp
+/// @brief @copybrief storages::clickhouse::AsyncInserter
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/io/impl/validate.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// Settings of storages::clickhouse::AsyncInserter
+struct AsyncInserterSettings final {
+  /// Buffered rows are flushed as soon as there are this many of them
+  std::size_t max_rows{100'000};
+
+  /// Buffered rows are flushed at least once in this interval
+  std::chrono::milliseconds flush_interval{std::chrono::seconds{1}};
+
+  /// Max amount of flushes executed concurrently, inserting rows waits for
+  /// a flush to finish when there are more
+  std::size_t max_in_flight{2};
+
+  /// Command control for the flushes
+  OptionalCommandControl command_control{};
+};
+
+namespace impl {
+
+struct AsyncInserterStatistics final {
+  using Counter = USERVER_NAMESPACE::utils::statistics::RelaxedCounter<
+      std::uint64_t>;
+
+  Counter rows_inserted{};
+  Counter rows_failed{};
+  Counter flushes{};
+  Counter flush_errors{};
+  Counter backpressure_waits{};
+};
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const AsyncInserterStatistics& stats);
+
+class AsyncInserterBase {
+ public:
+  AsyncInserterBase(const AsyncInserterBase&) = delete;
+  AsyncInserterBase& operator=(const AsyncInserterBase&) = delete;
+
+  /// Write inserter statistics
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ protected:
+  AsyncInserterBase(std::shared_ptr<Cluster> cluster, std::string table_name,
+                    std::vector<std::string> column_names,
+                    AsyncInserterSettings settings);
+  ~AsyncInserterBase();
+
+  const std::string& GetTableName() const { return table_name_; }
+  const std::vector<std::string_view>& GetColumnNames() const {
+    return column_name_views_;
+  }
+  std::size_t GetMaxRows() const { return settings_.max_rows; }
+
+  // Waits for a free flush slot and sends the request in background
+  void StartFlush(InsertionRequest&& request, std::size_t rows_count);
+
+  // Waits for all the flushes in progress
+  void WaitForFlushes();
+
+  void StartPeriodicFlushes();
+  void StopPeriodicFlushes();
+
+ private:
+  // Called periodically to flush whatever is buffered
+  virtual void FlushBuffered() = 0;
+
+  std::shared_ptr<Cluster> cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_name_views_;
+  const AsyncInserterSettings settings_;
+
+  AsyncInserterStatistics stats_;
+
+  engine::Mutex flushes_mutex_;
+  std::deque<engine::TaskWithResult<void>> flushes_;
+
+  USERVER_NAMESPACE::utils::PeriodicTask periodic_flush_;
+};
+
+template <typename MappedType>
+struct ColumnsBuffer;
+
+template <typename... ColumnTypes>
+struct ColumnsBuffer<std::tuple<ColumnTypes...>> final {
+  using type = std::tuple<typename ColumnTypes::container_type...>;
+};
+
+}  // namespace impl
+
+// clang-format off
+/// @brief Buffers rows in columnar form and inserts them into a table in
+/// large batches in background.
+///
+/// ClickHouse strongly prefers rare large inserts to frequent small ones.
+/// AsyncInserter accumulates the rows and flushes them either when
+/// `max_rows` rows are buffered or every `flush_interval`. Inserting waits
+/// for a flush to finish if there are already `max_in_flight` of them, which
+/// limits the memory held by the pending batches.
+///
+/// `Row` is expected to be a clickhouse-mapped type as for Cluster::InsertRows,
+/// though the rows are moved into the columns at once and no second copy is
+/// made on flush. Compression of the inserts is controlled by the
+/// `compression` option of components::ClickHouse.
+///
+/// Failed flushes are logged and accounted in the statistics, the rows of
+/// such flushes are lost. The destructor flushes the remaining rows and waits
+/// for all the flushes.
+///
+/// Thread-safe.
+///
+/// ## Usage example:
+///
+/// @snippet storages/tests/async_inserter_chtest.cpp  Sample AsyncInserter usage
+// clang-format on
+template <typename Row>
+class AsyncInserter final : public impl::AsyncInserterBase {
+ public:
+  AsyncInserter(std::shared_ptr<Cluster> cluster, std::string table_name,
+                std::vector<std::string> column_names,
+                AsyncInserterSettings settings = {});
+  ~AsyncInserter();
+
+  /// @brief Adds the row to the buffer, flushes the buffer if it is full
+  void Insert(Row row);
+
+  /// @brief Flushes the buffered rows and waits for all the flushes
+  void Flush();
+
+ private:
+  using MappedType = typename io::CppToClickhouse<Row>::mapped_type;
+  using Columns = typename impl::ColumnsBuffer<MappedType>::type;
+
+  // Moves the row fields into the columns
+  class RowAppender final {
+   public:
+    explicit RowAppender(Columns& columns) : columns_{columns} {}
+
+    template <typename Field, size_t Index>
+    void operator()(Field& field, std::integral_constant<size_t, Index>) {
+      std::get<Index>(columns_).push_back(std::move(field));
+    }
+
+   private:
+    Columns& columns_;
+  };
+
+  void FlushBuffered() override;
+
+  void DoFlush(Columns&& columns, std::size_t rows_count);
+
+  engine::Mutex buffer_mutex_;
+  Columns columns_;
+  std::size_t rows_count_{0};
+};
+
+template <typename Row>
+AsyncInserter<Row>::AsyncInserter(std::shared_ptr<Cluster> cluster,
+                                  std::string table_name,
+                                  std::vector<std::string> column_names,
+                                  AsyncInserterSettings settings)
+    : impl::AsyncInserterBase{std::move(cluster), std::move(table_name),
+                              std::move(column_names), settings} {
+  io::impl::ValidateRowsMapping<Row>();
+  io::impl::ValidateColumnsCount<Row>(GetColumnNames().size());
+
+  StartPeriodicFlushes();
+}
+
+template <typename Row>
+AsyncInserter<Row>::~AsyncInserter() {
+  StopPeriodicFlushes();
+  FlushBuffered();
+  WaitForFlushes();
+}
+
+template <typename Row>
+void AsyncInserter<Row>::Insert(Row row) {
+  Columns full_columns;
+  std::size_t full_rows_count = 0;
+  {
+    std::lock_guard lock{buffer_mutex_};
+    boost::pfr::for_each_field(row, RowAppender{columns_});
+    if (++rows_count_ < GetMaxRows()) return;
+
+    full_columns = std::exchange(columns_, Columns{});
+    full_rows_count = std::exchange(rows_count_, 0);
+  }
+
+  DoFlush(std::move(full_columns), full_rows_count);
+}
+
+template <typename Row>
+void AsyncInserter<Row>::Flush() {
+  FlushBuffered();
+  WaitForFlushes();
+}
+
+template <typename Row>
+void AsyncInserter<Row>::FlushBuffered() {
+  Columns columns;
+  std::size_t rows_count = 0;
+  {
+    std::lock_guard lock{buffer_mutex_};
+    columns = std::exchange(columns_, Columns{});
+    rows_count = std::exchange(rows_count_, 0);
+  }
+  if (rows_count == 0) return;
+
+  DoFlush(std::move(columns), rows_count);
+}
+
+template <typename Row>
+void AsyncInserter<Row>::DoFlush(Columns&& columns, std::size_t rows_count) {
+  StartFlush(impl::InsertionRequest::CreateFromColumns<MappedType>(
+                 GetTableName(), GetColumnNames(), columns),
+             rows_count);
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -26,7 +26,8 @@ class ExecutionResult;
 
 namespace impl {
 struct ClickhouseSettings;
-}
+class AsyncInserterBase;
+}  // namespace impl
 
 /// @ingroup userver_clients
 ///
@@ -60,6 +61,30 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at every host of the cluster in parallel
+  /// with args as query parameters.
+  ///
+  /// Suits reading the local tables of a sharded cluster, where every host
+  /// holds its own part of the data. The results are in the order of the
+  /// endpoints, merging them is left to the caller. Command control is applied
+  /// to every host separately. Throws if the statement fails at any host.
+  template <typename... Args>
+  std::vector<ExecutionResult> ExecuteOnAll(OptionalCommandControl,
+                                            const Query& query,
+                                            const Args&... args) const;
+
+  /// @brief Execute a statement at some host of the cluster and query one
+  /// more host every `hedging_settings.delay` until there is a response,
+  /// with args as query parameters.
+  ///
+  /// Suits reading from replicas: the first successful response is returned
+  /// and the rest of the attempts are cancelled. A failed attempt starts the
+  /// next one at once. Throws the last error if all the attempts fail.
+  template <typename... Args>
+  ExecutionResult ExecuteHedged(OptionalCommandControl,
+                                const HedgingSettings& hedging_settings,
+                                const Query& query, const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -126,11 +151,20 @@ class Cluster final {
   };
 
  private:
+  friend class impl::AsyncInserterBase;
+
   void DoInsert(OptionalCommandControl,
                 const impl::InsertionRequest& request) const;
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  std::vector<ExecutionResult> DoExecuteOnAll(OptionalCommandControl,
+                                              const Query& query) const;
+
+  ExecutionResult DoExecuteHedged(OptionalCommandControl,
+                                  const HedgingSettings& hedging_settings,
+                                  const Query& query) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +223,23 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+std::vector<ExecutionResult> Cluster::ExecuteOnAll(
+    OptionalCommandControl optional_cc, const Query& query,
+    const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  return DoExecuteOnAll(optional_cc, formatted_query);
+}
+
+template <typename... Args>
+ExecutionResult Cluster::ExecuteHedged(OptionalCommandControl optional_cc,
+                                       const HedgingSettings& hedging_settings,
+                                       const Query& query,
+                                       const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  return DoExecuteHedged(optional_cc, hedging_settings, formatted_query);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -9,7 +9,9 @@
 #include <boost/pfr/core.hpp>
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+#include <userver/storages/clickhouse/io/columns/base_column.hpp>
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <userver/storages/clickhouse/io/result_mapper.hpp>
 
@@ -57,6 +59,19 @@ class ExecutionResult final {
   template <typename Container>
   Container AsContainer() &&;
 
+  /// Returns the values of a fixed-width column (numeric ones) without any
+  /// copying or conversion. The data is valid while `*this` is alive.
+  ///
+  /// `ColumnType` is expected to be one of the io::columns types providing
+  /// `GetData()`, the column at `column_index` should be of that type.
+  ///
+  /// @snippet storages/tests/execute_chtest.cpp  Sample ExecutionResult GetColumnData
+  template <typename ColumnType>
+  auto GetColumnData(size_t column_index) const&;
+
+  template <typename ColumnType>
+  auto GetColumnData(size_t column_index) && = delete;
+
  private:
   impl::BlockWrapperPtr block_;
 };
@@ -100,6 +115,17 @@ Container ExecutionResult::AsContainer() && {
   return result;
 }
 
+template <typename ColumnType>
+auto ExecutionResult::GetColumnData(size_t column_index) const& {
+  static_assert(io::columns::kHasRawData<ColumnType>,
+                "Only fixed-width columns can be accessed without copying");
+  UASSERT(block_);
+  UINVARIANT(column_index < GetColumnsCount(), "Column index out of range");
+
+  return ColumnType{io::columns::GetWrappedColumn(*block_, column_index)}
+      .GetData();
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <userver/utils/assert.hpp>
@@ -35,6 +37,13 @@ class InsertionRequest final {
       const std::string& table_name,
       const std::vector<std::string_view>& column_names, const Container& data);
 
+  // Columns is a tuple of already built `container_type`s of MappedType
+  template <typename MappedType, typename Columns>
+  static InsertionRequest CreateFromColumns(
+      const std::string& table_name,
+      const std::vector<std::string_view>& column_names,
+      const Columns& columns);
+
   const std::string& GetTableName() const;
 
   const impl::BlockWrapper& GetBlock() const;
@@ -91,6 +100,14 @@ class InsertionRequest final {
     const Container& data_;
   };
 
+  template <typename Mapper, typename Columns, size_t... Indices>
+  static void MapColumns(Mapper& mapper, const Columns& columns,
+                         std::index_sequence<Indices...>) {
+    (mapper(std::get<Indices>(columns),
+            std::integral_constant<size_t, Indices>{}),
+     ...);
+  }
+
   const std::string& table_name_;
   const std::vector<std::string_view>& column_names_;
 
@@ -135,6 +152,24 @@ InsertionRequest InsertionRequest::CreateFromRows(
   return request;
 }
 
+template <typename MappedType, typename Columns>
+InsertionRequest InsertionRequest::CreateFromColumns(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const Columns& columns) {
+  constexpr auto kColumnsCount = std::tuple_size_v<Columns>;
+  static_assert(std::tuple_size_v<MappedType> == kColumnsCount);
+  UINVARIANT(column_names.size() == kColumnsCount,
+             "Columns count mismatch for insertion");
+
+  InsertionRequest request{table_name, column_names};
+  auto mapper = InsertionRequest::ColumnsMapper<MappedType>{
+      *request.block_, request.column_names_};
+
+  MapColumns(mapper, columns, std::make_index_sequence<kColumnsCount>{});
+  return request;
+}
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
@@ -3,6 +3,9 @@
 /// @file userver/storages/clickhouse/io/columns/base_column.hpp
 /// @brief @copybrief storages::clickhouse::io::columns::ClickhouseColumn
 
+#include <type_traits>
+#include <utility>
+
 #include <userver/storages/clickhouse/io/columns/column_iterator.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 
@@ -22,6 +25,11 @@ namespace storages::clickhouse::io::columns {
 /// - `static ColumnRef Serialize(const container_type&)` - constructs a column from C++ container,
 /// - `cpp_type ColumnIterator<YourColumnType>::DataHolder::Get()`
 ///
+/// Fixed-width columns may also implement
+/// `utils::impl::Span<const cpp_type> GetData() const` - returns the values of
+/// the column without copying, which allows the mapping to skip the per-row
+/// conversion.
+///
 /// see implementation of any of the existing columns for better understanding.
 // clang-format on
 template <typename ColumnType>
@@ -37,10 +45,22 @@ class ClickhouseColumn {
 
   size_t Size() const { return GetColumnSize(column_); }
 
+ protected:
+  const ColumnRef& GetColumnRef() const { return column_; }
+
  private:
   ColumnRef column_;
 };
 
+/// Whether the column provides its values without copying via `GetData()`
+template <typename ColumnType, typename = void>
+inline constexpr bool kHasRawData = false;
+
+template <typename ColumnType>
+inline constexpr bool kHasRawData<
+    ColumnType,
+    std::void_t<decltype(std::declval<const ColumnType&>().GetData())>> = true;
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
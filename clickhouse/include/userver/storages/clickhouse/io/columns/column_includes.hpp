@@ -8,6 +8,8 @@
 #include <string_view>
 #include <vector>
 
+#include <userver/utils/impl/span.hpp>
+
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/io/columns/base_column.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
@@ -18,6 +18,10 @@ class UInt64Column final : public ClickhouseColumn<UInt64Column> {
 
   UInt64Column(ColumnRef column);
 
+  /// Returns the column values without copying, the data is valid while
+  /// the underlying block is alive
+  utils::impl::Span<const cpp_type> GetData() const;
+
   static ColumnRef Serialize(const container_type& from);
 };
 
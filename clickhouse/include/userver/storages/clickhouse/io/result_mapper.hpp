@@ -10,6 +10,7 @@
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/impl/iterators_helper.hpp>
+#include <userver/storages/clickhouse/io/columns/base_column.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 #include <userver/storages/clickhouse/io/io_fwd.hpp>
 
@@ -31,8 +32,14 @@ class ColumnsMapper final {
     static_assert(std::is_same_v<Field, typename ColumnType::container_type>);
 
     auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
-    field.reserve(column.Size());
-    for (auto& it : column) field.push_back(std::move(it));
+    if constexpr (io::columns::kHasRawData<ColumnType>) {
+      // fixed-width values are copied at once, without per-row conversion
+      const auto data = column.GetData();
+      field.assign(data.begin(), data.end());
+    } else {
+      field.reserve(column.Size());
+      for (auto& it : column) field.push_back(std::move(it));
+    }
   }
 
  private:
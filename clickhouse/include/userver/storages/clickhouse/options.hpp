@@ -4,6 +4,7 @@
 /// @brief Options
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,6 +36,15 @@ struct CommandControl final {
 /// @brief storages::clickhouse::CommandControl that may not be set.
 using OptionalCommandControl = std::optional<CommandControl>;
 
+/// Settings of storages::clickhouse::Cluster::ExecuteHedged
+struct HedgingSettings final {
+  /// The next host is queried if there is no response in this interval
+  std::chrono::milliseconds delay{std::chrono::milliseconds{50}};
+
+  /// Max amount of hosts queried for a single statement
+  std::size_t max_attempts{2};
+};
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
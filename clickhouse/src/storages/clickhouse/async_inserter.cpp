@@ -0,0 +1,106 @@
+#include <userver/storages/clickhouse/async_inserter.hpp>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+namespace {
+
+std::vector<std::string_view> MakeViews(const std::vector<std::string>& names) {
+  return {names.begin(), names.end()};
+}
+
+}  // namespace
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const AsyncInserterStatistics& stats) {
+  writer["rows_inserted"] = stats.rows_inserted;
+  writer["rows_failed"] = stats.rows_failed;
+  writer["flushes"] = stats.flushes;
+  writer["flush_errors"] = stats.flush_errors;
+  writer["backpressure_waits"] = stats.backpressure_waits;
+}
+
+AsyncInserterBase::AsyncInserterBase(std::shared_ptr<Cluster> cluster,
+                                     std::string table_name,
+                                     std::vector<std::string> column_names,
+                                     AsyncInserterSettings settings)
+    : cluster_{std::move(cluster)},
+      table_name_{std::move(table_name)},
+      column_names_{std::move(column_names)},
+      column_name_views_{MakeViews(column_names_)},
+      settings_{std::move(settings)} {
+  UINVARIANT(cluster_, "AsyncInserter requires a cluster");
+  UINVARIANT(settings_.max_rows > 0, "max_rows should be positive");
+  UINVARIANT(settings_.max_in_flight > 0, "max_in_flight should be positive");
+}
+
+AsyncInserterBase::~AsyncInserterBase() = default;
+
+void AsyncInserterBase::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer.ValueWithLabels(stats_, {{"clickhouse_table", table_name_}});
+}
+
+void AsyncInserterBase::StartFlush(InsertionRequest&& request,
+                                   std::size_t rows_count) {
+  std::lock_guard lock{flushes_mutex_};
+
+  while (!flushes_.empty() && flushes_.front().IsFinished()) {
+    flushes_.pop_front();
+  }
+  if (flushes_.size() >= settings_.max_in_flight) {
+    ++stats_.backpressure_waits;
+    // waiting under the lock holds off all the other writers as well
+    while (flushes_.size() >= settings_.max_in_flight) {
+      flushes_.front().Wait();
+      // we are cancelled, don't drop the batch anyway
+      if (!flushes_.front().IsFinished()) break;
+      flushes_.pop_front();
+    }
+  }
+
+  flushes_.push_back(USERVER_NAMESPACE::utils::Async(
+      "clickhouse_async_insert",
+      [this, request = std::move(request), rows_count] {
+        try {
+          cluster_->DoInsert(settings_.command_control, request);
+          stats_.rows_inserted += rows_count;
+          ++stats_.flushes;
+        } catch (const std::exception& ex) {
+          LOG_ERROR() << "Failed to insert " << rows_count << " rows into '"
+                      << table_name_ << "': " << ex;
+          stats_.rows_failed += rows_count;
+          ++stats_.flush_errors;
+        }
+      }));
+}
+
+void AsyncInserterBase::WaitForFlushes() {
+  // the flushes hold the rows that are not in the table yet
+  const engine::TaskCancellationBlocker block_cancel;
+
+  std::lock_guard lock{flushes_mutex_};
+  for (auto& flush : flushes_) {
+    flush.Wait();
+  }
+  flushes_.clear();
+}
+
+void AsyncInserterBase::StartPeriodicFlushes() {
+  periodic_flush_.Start("clickhouse_async_inserter_flush",
+                        settings_.flush_interval, [this] { FlushBuffered(); });
+}
+
+void AsyncInserterBase::StopPeriodicFlushes() { periodic_flush_.Stop(); }
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,16 @@
 #include <userver/storages/clickhouse/cluster.hpp>
 
+#include <algorithm>
+#include <exception>
+
 #include <userver/components/component_config.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/formats/common/merge.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 
@@ -55,6 +62,91 @@ ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc,
   return GetPool().Execute(optional_cc, query);
 }
 
+std::vector<ExecutionResult> Cluster::DoExecuteOnAll(
+    OptionalCommandControl optional_cc, const Query& query) const {
+  std::vector<engine::TaskWithResult<ExecutionResult>> tasks;
+  tasks.reserve(pools_.size());
+  for (const auto& pool : pools_) {
+    tasks.push_back(USERVER_NAMESPACE::utils::Async(
+        "clickhouse_execute_on_all", [&pool, optional_cc, &query] {
+          return pool.Execute(optional_cc, query);
+        }));
+  }
+
+  std::vector<ExecutionResult> results;
+  results.reserve(tasks.size());
+  for (auto& task : tasks) {
+    // the rest of the tasks are cancelled on exception
+    results.push_back(task.Get());
+  }
+  return results;
+}
+
+ExecutionResult Cluster::DoExecuteHedged(
+    OptionalCommandControl optional_cc, const HedgingSettings& hedging_settings,
+    const Query& query) const {
+  // Every attempt goes to its own host, starting from the round-robin one
+  const auto pools_count = pools_.size();
+  const auto max_attempts = std::max<std::size_t>(
+      std::min(hedging_settings.max_attempts, pools_count), 1);
+  const auto first_pool_ind = WrappingIncrement(current_pool_ind_, pools_count);
+  std::vector<const impl::Pool*> candidates;
+  candidates.reserve(max_attempts);
+  for (size_t i = 0; i < pools_count && candidates.size() < max_attempts;
+       ++i) {
+    const auto& pool = pools_[(first_pool_ind + i) % pools_count];
+    if (pool.IsAvailable()) candidates.push_back(&pool);
+  }
+  if (candidates.empty()) {
+    throw NoAvailablePoolError{"No available pools in cluster."};
+  }
+
+  std::vector<engine::TaskWithResult<ExecutionResult>> attempts;
+  attempts.reserve(candidates.size());
+  std::size_t next_candidate = 0;
+  const auto start_attempt = [&] {
+    const auto* pool = candidates[next_candidate++];
+    attempts.push_back(USERVER_NAMESPACE::utils::Async(
+        "clickhouse_execute_hedged", [pool, optional_cc, &query] {
+          return pool->Execute(optional_cc, query);
+        }));
+  };
+
+  std::exception_ptr last_error;
+  start_attempt();
+  while (!attempts.empty()) {
+    const bool can_hedge = next_candidate < candidates.size();
+    const auto finished =
+        can_hedge ? engine::WaitAnyFor(hedging_settings.delay, attempts)
+                  : engine::WaitAny(attempts);
+    if (!finished) {
+      if (!can_hedge || engine::current_task::ShouldCancel()) {
+        throw engine::WaitInterruptedException(
+            engine::current_task::CancellationReason());
+      }
+      start_attempt();
+      continue;
+    }
+
+    try {
+      auto result = attempts[*finished].Get();
+      // don't wait for the slower attempts one by one
+      for (auto& attempt : attempts) {
+        if (attempt.IsValid()) attempt.RequestCancel();
+      }
+      return result;
+    } catch (const std::exception&) {
+      last_error = std::current_exception();
+    }
+
+    attempts.erase(attempts.begin() + *finished);
+    if (next_candidate < candidates.size()) start_attempt();
+  }
+
+  UASSERT(last_error);
+  std::rethrow_exception(last_error);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc,
                        const impl::InsertionRequest& request) const {
   GetPool().Insert(optional_cc, request);
@@ -19,6 +19,12 @@ Float32Column::cpp_type ColumnIterator<Float32Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const Float32Column::cpp_type> Float32Column::GetData()
+    const {
+  return impl::NumericColumn<Float32Column>::GetData<NativeType>(
+      GetColumnRef());
+}
+
 ColumnRef Float32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Float32Column>::Serialize(from);
 }
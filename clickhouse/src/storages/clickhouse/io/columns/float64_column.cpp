@@ -19,6 +19,12 @@ Float64Column::cpp_type ColumnIterator<Float64Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const Float64Column::cpp_type> Float64Column::GetData()
+    const {
+  return impl::NumericColumn<Float64Column>::GetData<NativeType>(
+      GetColumnRef());
+}
+
 ColumnRef Float64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Float64Column>::Serialize(from);
 }
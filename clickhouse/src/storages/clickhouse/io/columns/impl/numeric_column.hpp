@@ -23,6 +23,16 @@ struct NumericColumn final {
     return std::make_shared<
         clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>>(from);
   }
+
+  template <typename NativeColumnType>
+  static utils::impl::Span<const value_type> GetData(
+      const clickhouse::impl::clickhouse_cpp::ColumnRef& column) {
+    UASSERT(column->As<NativeColumnType>() != nullptr);
+    // clickhouse-cpp provides no const accessor for the whole buffer
+    const auto& data =
+        static_cast<NativeColumnType*>(column.get())->GetWritableData();
+    return {data.data(), data.data() + data.size()};
+  }
 };
 
 }  // namespace storages::clickhouse::io::columns::impl
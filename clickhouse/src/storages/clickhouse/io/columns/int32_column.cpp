@@ -18,6 +18,10 @@ Int32Column::cpp_type ColumnIterator<Int32Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const Int32Column::cpp_type> Int32Column::GetData() const {
+  return impl::NumericColumn<Int32Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef Int32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int32Column>::Serialize(from);
 }
@@ -18,6 +18,10 @@ Int64Column::cpp_type ColumnIterator<Int64Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const Int64Column::cpp_type> Int64Column::GetData() const {
+  return impl::NumericColumn<Int64Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef Int64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int64Column>::Serialize(from);
 }
@@ -18,6 +18,10 @@ Int8Column::cpp_type ColumnIterator<Int8Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const Int8Column::cpp_type> Int8Column::GetData() const {
+  return impl::NumericColumn<Int8Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef Int8Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int8Column>::Serialize(from);
 }
@@ -19,6 +19,10 @@ UInt16Column::cpp_type ColumnIterator<UInt16Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const UInt16Column::cpp_type> UInt16Column::GetData() const {
+  return impl::NumericColumn<UInt16Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef UInt16Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt16Column>::Serialize(from);
 }
@@ -19,6 +19,10 @@ UInt32Column::cpp_type ColumnIterator<UInt32Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const UInt32Column::cpp_type> UInt32Column::GetData() const {
+  return impl::NumericColumn<UInt32Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef UInt32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt32Column>::Serialize(from);
 }
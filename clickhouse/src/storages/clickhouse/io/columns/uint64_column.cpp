@@ -19,6 +19,10 @@ UInt64Column::cpp_type ColumnIterator<UInt64Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const UInt64Column::cpp_type> UInt64Column::GetData() const {
+  return impl::NumericColumn<UInt64Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef UInt64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt64Column>::Serialize(from);
 }
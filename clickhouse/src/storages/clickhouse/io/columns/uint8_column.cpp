@@ -18,6 +18,10 @@ UInt8Column::cpp_type ColumnIterator<UInt8Column>::DataHolder::Get() const {
   return impl::NativeGetAt<NativeType>(column_, ind_);
 }
 
+utils::impl::Span<const UInt8Column::cpp_type> UInt8Column::GetData() const {
+  return impl::NumericColumn<UInt8Column>::GetData<NativeType>(GetColumnRef());
+}
+
 ColumnRef UInt8Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt8Column>::Serialize(from);
 }
@@ -0,0 +1,128 @@
+#include <userver/utest/utest.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/async_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/io/columns/common_columns.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EventRow final {
+  uint64_t id;
+  std::string value;
+
+  bool operator==(const EventRow& other) const {
+    return id == other.id && value == other.value;
+  }
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<EventRow> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+namespace clickhouse = storages::clickhouse;
+
+// Flushes are executed on arbitrary connections of the pool, so temporary
+// tables don't fit here
+class EventsTable final {
+ public:
+  EventsTable(ClusterWrapper& cluster, std::string name)
+      : cluster_{cluster}, name_{std::move(name)} {
+    cluster_->Execute(fmt::format("DROP TABLE IF EXISTS {}", name_));
+    cluster_->Execute(
+        fmt::format("CREATE TABLE {} (id UInt64, value String) ENGINE = Memory",
+                    name_));
+  }
+
+  ~EventsTable() {
+    cluster_->Execute(fmt::format("DROP TABLE IF EXISTS {}", name_));
+  }
+
+  const std::string& GetName() const { return name_; }
+
+  std::vector<EventRow> Select() {
+    return cluster_
+        ->Execute(fmt::format("SELECT id, value FROM {} ORDER BY id", name_))
+        .AsContainer<std::vector<EventRow>>();
+  }
+
+ private:
+  ClusterWrapper& cluster_;
+  const std::string name_;
+};
+
+// ClusterWrapper owns the cluster, the inserter just refers to it
+std::shared_ptr<clickhouse::Cluster> NonOwning(ClusterWrapper& cluster) {
+  return {std::shared_ptr<clickhouse::Cluster>{}, &*cluster};
+}
+
+}  // namespace
+
+UTEST(AsyncInserter, FlushesBySize) {
+  ClusterWrapper cluster{};
+  EventsTable table{cluster, "async_inserter_by_size"};
+
+  std::vector<EventRow> rows;
+  {
+    /// [Sample AsyncInserter usage]
+    clickhouse::AsyncInserterSettings settings;
+    settings.max_rows = 3;
+    settings.flush_interval = std::chrono::hours{1};
+
+    clickhouse::AsyncInserter<EventRow> inserter{
+        NonOwning(cluster), table.GetName(), {"id", "value"}, settings};
+    for (uint64_t i = 0; i < 10; ++i) {
+      rows.push_back({i, fmt::format("value {}", i)});
+      inserter.Insert(rows.back());
+    }
+    inserter.Flush();
+    /// [Sample AsyncInserter usage]
+
+    EXPECT_EQ(table.Select(), rows);
+
+    inserter.Insert({10, "last"});
+    rows.push_back({10, "last"});
+  }
+
+  // the destructor flushes the rest
+  EXPECT_EQ(table.Select(), rows);
+}
+
+UTEST(AsyncInserter, FlushesByTime) {
+  ClusterWrapper cluster{};
+  EventsTable table{cluster, "async_inserter_by_time"};
+
+  clickhouse::AsyncInserterSettings settings;
+  settings.max_rows = 1000;
+  settings.flush_interval = std::chrono::milliseconds{50};
+
+  clickhouse::AsyncInserter<EventRow> inserter{
+      NonOwning(cluster), table.GetName(), {"id", "value"}, settings};
+  inserter.Insert({1, "first"});
+  inserter.Insert({2, "second"});
+
+  std::vector<EventRow> selected;
+  for (int i = 0; i < 100 && selected.size() < 2; ++i) {
+    engine::SleepFor(std::chrono::milliseconds{50});
+    selected = table.Select();
+  }
+  EXPECT_EQ(selected, (std::vector<EventRow>{{1, "first"}, {2, "second"}}));
+}
+
+USERVER_NAMESPACE_END
@@ -75,6 +75,29 @@ UTEST(Execute, MappingWorks) {
   EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, ColumnDataWorks) {
+  ClusterWrapper cluster{};
+
+  /// [Sample ExecutionResult GetColumnData]
+  namespace columns = storages::clickhouse::io::columns;
+
+  const auto result = cluster->Execute(common_query);
+  const auto numbers = result.GetColumnData<columns::UInt64Column>(0);
+  /// [Sample ExecutionResult GetColumnData]
+
+  ASSERT_EQ(numbers.size(), 10000);
+  EXPECT_EQ(numbers[5001], 5001);
+
+  uint64_t sum = 0;
+  for (const auto number : numbers) {
+    sum += number;
+  }
+  EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+
+  UEXPECT_THROW(result.GetColumnData<columns::UInt32Column>(0),
+                std::runtime_error);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
@@ -0,0 +1,74 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/io/columns/uint64_column.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace clickhouse = storages::clickhouse;
+namespace columns = clickhouse::io::columns;
+
+const clickhouse::Query kNumbersQuery{
+    "SELECT c.number FROM numbers(0, 100) c WHERE c.number < {}"};
+
+// Two endpoints of the same server play the role of the shards (replicas)
+ClusterWrapper MakeTwoHostsCluster() {
+  return ClusterWrapper{/*use_compression=*/false,
+                        {{"localhost", GetClickhousePort()},
+                         {"localhost", GetClickhousePort()}}};
+}
+
+}  // namespace
+
+UTEST(ExecuteOnAll, Basic) {
+  auto cluster = MakeTwoHostsCluster();
+
+  const auto results =
+      cluster->ExecuteOnAll(clickhouse::OptionalCommandControl{},
+                            kNumbersQuery, uint64_t{10});
+  ASSERT_EQ(results.size(), 2);
+  for (const auto& result : results) {
+    const auto numbers = result.GetColumnData<columns::UInt64Column>(0);
+    ASSERT_EQ(numbers.size(), 10);
+    EXPECT_EQ(numbers[9], 9);
+  }
+}
+
+UTEST(ExecuteOnAll, ThrowsOnError) {
+  auto cluster = MakeTwoHostsCluster();
+
+  UEXPECT_THROW(cluster->ExecuteOnAll(clickhouse::OptionalCommandControl{},
+                                      "SELECT * FROM nonexistent_table"),
+                std::exception);
+}
+
+UTEST(ExecuteHedged, Basic) {
+  auto cluster = MakeTwoHostsCluster();
+
+  clickhouse::HedgingSettings hedging_settings;
+  hedging_settings.delay = std::chrono::milliseconds{1};
+
+  for (size_t i = 0; i < 10; ++i) {
+    const auto result = cluster->ExecuteHedged(
+        clickhouse::OptionalCommandControl{}, hedging_settings, kNumbersQuery,
+        uint64_t{20});
+    EXPECT_EQ(result.GetColumnData<columns::UInt64Column>(0).size(), 20);
+  }
+}
+
+UTEST(ExecuteHedged, ThrowsWhenAllAttemptsFail) {
+  auto cluster = MakeTwoHostsCluster();
+
+  UEXPECT_THROW(cluster->ExecuteHedged(clickhouse::OptionalCommandControl{},
+                                       clickhouse::HedgingSettings{},
+                                       "SELECT * FROM nonexistent_table"),
+                std::exception);
+}
+
+USERVER_NAMESPACE_END
@@ -92,7 +92,7 @@ class Baggage {
   Baggage(const Baggage&) noexcept;
   Baggage(Baggage&&) noexcept;
 
-  std::string ToString() const;
+  const std::string& ToString() const;
 
   /// @return vector of entries
   const std::vector<BaggageEntry>& GetEntries() const;
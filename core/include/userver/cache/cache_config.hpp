@@ -68,6 +68,7 @@ struct Config final {
   std::optional<bool> force_periodic_update;
   bool config_updates_enabled;
   bool has_pre_assign_check;
+  bool jemalloc_arena;
   std::optional<std::string> task_processor_name;
   std::chrono::milliseconds cleanup_interval;
   bool is_strong_period;
@@ -75,6 +76,7 @@ struct Config final {
 
   FirstUpdateMode first_update_mode;
   FirstUpdateType first_update_type;
+  bool load_dump_in_background;
 
   std::chrono::milliseconds update_interval;
   std::chrono::milliseconds update_jitter;
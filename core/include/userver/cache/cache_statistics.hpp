@@ -44,6 +44,14 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
 
 enum class UpdateState { kNotFinished, kSuccess, kFailure };
 
+struct UpdateStagesDurations final {
+  std::chrono::milliseconds fetch{};
+  std::chrono::milliseconds parse{};
+  /// Time from Finish*() till the end of `Update`, e.g. for the `Set` call
+  std::chrono::milliseconds publish{};
+  std::chrono::milliseconds total{};
+};
+
 }  // namespace impl
 
 /// @brief Allows a specific cache to fill cache statistics during an `Update`
@@ -59,6 +67,9 @@ class UpdateStatisticsScope final {
   ~UpdateStatisticsScope();
 
   impl::UpdateState GetState(utils::InternalTag) const;
+
+  // For internal use only, to be called right after `Update` returns
+  impl::UpdateStagesDurations GetStagesDurations(utils::InternalTag) const;
   /// @endcond
 
   /// @brief Mark that the `Update` has finished with changes
@@ -83,6 +94,16 @@ class UpdateStatisticsScope final {
   /// @param add the number of non-valid items newly received
   void IncreaseDocumentsParseFailures(std::size_t add);
 
+  /// @brief Accounts the time spent fetching the data from the data source,
+  /// reported in the components startup report for the first update
+  /// @note This method can be called multiple times per `Update`
+  void AddFetchTime(std::chrono::steady_clock::duration duration);
+
+  /// @brief Accounts the time spent parsing the fetched data, reported in
+  /// the components startup report for the first update
+  /// @note This method can be called multiple times per `Update`
+  void AddParseTime(std::chrono::steady_clock::duration duration);
+
  private:
   void DoFinish(impl::UpdateState new_state);
 
@@ -90,6 +111,9 @@ class UpdateStatisticsScope final {
   impl::UpdateStatistics& update_stats_;
   impl::UpdateState state_{impl::UpdateState::kNotFinished};
   const std::chrono::steady_clock::time_point update_start_time_;
+  std::chrono::steady_clock::time_point update_finish_time_{};
+  std::chrono::steady_clock::duration fetch_time_{};
+  std::chrono::steady_clock::duration parse_time_{};
 };
 
 }  // namespace cache
@@ -4,6 +4,7 @@
 /// @brief @copybrief cache::CacheUpdateTrait
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/cache/cache_statistics.hpp>
@@ -13,6 +14,7 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/rcu/fwd.hpp>
 #include <userver/utils/flags.hpp>
+#include <userver/utils/internal_tag_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -43,6 +45,12 @@ class CacheUpdateTrait {
   /// @return name of the component
   const std::string& Name() const;
 
+  /// @cond
+  // For internal use only
+  std::optional<impl::UpdateStagesDurations> GetFirstUpdateStagesDurations(
+      utils::InternalTag) const;
+  /// @endcond
+
  protected:
   /// @cond
   // For internal use only
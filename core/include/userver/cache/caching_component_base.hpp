@@ -69,6 +69,7 @@ namespace components {
 /// testsuite-force-periodic-update | override testsuite-periodic-update-enabled in TestsuiteSupport component config | --
 /// failed-updates-before-expiration | the number of consecutive failed updates for data expiration | --
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
+/// jemalloc-arena | whether to allocate the cache updates and the dump loads from a dedicated jemalloc arena, which memory is reported as `cache.memory` metrics; makes the context switches of the update tasks slower | false
 ///
 /// ### Update types
 ///  * `full-and-incremental`: both `update-interval` and `full-update-interval`
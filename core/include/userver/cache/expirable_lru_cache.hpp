@@ -5,18 +5,27 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <optional>
+#include <type_traits>
+#include <unordered_map>
 
+#include <userver/cache/impl/tiny_lfu.hpp>
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
+#include <userver/cache/nway_clock_cache.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
 #include <userver/concurrent/mutex_set.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/impl/cached_time.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -56,8 +65,15 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader,
 /// Example usage:
 ///
 /// @snippet cache/expirable_lru_cache_test.cpp Sample ExpirableLruCache
+///
+/// With CachePolicy::kClock the values are stored in cache::NWayClockCache,
+/// and the cache hits do not take any mutex. With CachePolicy::kTinyLfu the
+/// new keys are admitted only if they are requested more frequently than the
+/// keys they would evict, rejected keys are counted in the
+/// "admission-rejects" metric.
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
-          typename Equal = std::equal_to<Key>>
+          typename Equal = std::equal_to<Key>,
+          CachePolicy Policy = CachePolicy::kLru>
 class ExpirableLruCache final {
  public:
   using UpdateValueFunc = std::function<Value(const Key&)>;
@@ -86,10 +102,28 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  /**
+   * Sets the time after the expiration during which the expired value is
+   * still returned by GetOptional() and Get(), while it is updated in
+   * background. 0 disables the stale values.
+   */
+  void SetStaleWhileRevalidate(
+      std::chrono::milliseconds stale_while_revalidate);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
    * stored in cache if "read_mode" is kUseCache.
+   *
+   * Concurrent misses of the same key are coalesced: update_func(key) is
+   * called once in a separate task and all the callers wait for its result.
+   *
+   * @warning update_func is copied into that task, which keeps running after
+   * the caller that has started it is cancelled, while there are other
+   * callers waiting for the value. So update_func must own the data it uses:
+   * capture by value or by a shared pointer, not by reference to the locals
+   * of the caller. The engine::TaskLocalVariable of the caller are not
+   * available in update_func.
    */
   Value Get(const Key& key, const UpdateValueFunc& update_func,
             ReadMode read_mode = ReadMode::kUseCache);
@@ -155,77 +189,110 @@ class ExpirableLruCache final {
   bool ShouldUpdate(std::chrono::steady_clock::time_point update_time,
                     std::chrono::steady_clock::time_point now) const;
 
-  cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
+  bool CanReturnStale(std::chrono::steady_clock::time_point update_time,
+                      std::chrono::steady_clock::time_point now) const;
+
+  using Fetch = std::shared_ptr<engine::SharedTaskWithResult<Value>>;
+
+  Fetch StartOrJoinFetch(const Key& key, const UpdateValueFunc& update_func,
+                         ReadMode read_mode);
+  void FinishFetch(const Key& key, const Fetch& fetch) noexcept;
+
+  using StoredValue = impl::ExpirableValue<Value>;
+  using Storage = std::conditional_t<
+      Policy == CachePolicy::kClock,
+      cache::NWayClockCache<Key, StoredValue, Hash, Equal>,
+      std::conditional_t<
+          Policy == CachePolicy::kTinyLfu,
+          cache::NWayLRU<Key, StoredValue, Hash, Equal,
+                         impl::TinyLfuBase<Key, StoredValue, Hash, Equal>>,
+          cache::NWayLRU<Key, StoredValue, Hash, Equal>>>;
+
+  void PutToStorage(const Key& key, StoredValue&& value);
+
+  Storage lru_;
   std::atomic<std::chrono::milliseconds> max_lifetime_{
       std::chrono::milliseconds(0)};
   std::atomic<BackgroundUpdateMode> background_update_mode_{
       BackgroundUpdateMode::kDisabled};
+  std::atomic<std::chrono::milliseconds> stale_while_revalidate_{
+      std::chrono::milliseconds(0)};
   impl::ExpirableLruCacheStatistics stats_;
   concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
+  concurrent::Variable<std::unordered_map<Key, Fetch, Hash, Equal>> in_flight_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::ExpirableLruCache(
     size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
     : lru_(ways, way_size, hash, equal),
-      mutex_set_{ways, way_size, hash, equal} {}
+      mutex_set_{ways, way_size, hash, equal},
+      in_flight_(0, hash, equal) {}
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::~ExpirableLruCache() {
   wait_token_storage_.WaitForAllTokens();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::SetWaySize(
+    size_t way_size) {
   lru_.UpdateWaySize(way_size);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
 std::chrono::milliseconds
-ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::GetMaxLifetime()
+    const noexcept {
   return max_lifetime_.load();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::SetMaxLifetime(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::SetMaxLifetime(
     std::chrono::milliseconds max_lifetime) {
   max_lifetime_ = max_lifetime;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::SetBackgroundUpdate(
     BackgroundUpdateMode background_update) {
   background_update_mode_ = background_update;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal,
+                       Policy>::SetStaleWhileRevalidate(
+    std::chrono::milliseconds stale_while_revalidate) {
+  stale_while_revalidate_ = stale_while_revalidate;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+Value ExpirableLruCache<Key, Value, Hash, Equal, Policy>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
-  auto now = utils::datetime::SteadyNow();
   auto opt_old_value = GetOptional(key, update_func);
   if (opt_old_value) {
     return std::move(*opt_old_value);
   }
 
-  auto mutex = mutex_set_.GetMutexForKey(key);
-  std::lock_guard lock(mutex);
-  // Test one more time - concurrent ExpirableLruCache::Get()
-  // might have put the value
-  auto old_value = lru_.Get(key);
-  if (old_value && !IsExpired(old_value->update_time, now)) {
-    return std::move(old_value->value);
-  }
-
-  auto value = update_func(key);
-  if (read_mode == ReadMode::kUseCache) {
-    lru_.Put(key, {value, now});
-  }
-  return value;
+  const auto fetch = StartOrJoinFetch(key, update_func, read_mode);
+  utils::FastScopeGuard finish_guard(
+      [this, &key, &fetch]() noexcept { FinishFetch(key, fetch); });
+  return fetch->Get();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+std::optional<Value>
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::GetOptional(
     const Key& key, const UpdateValueFunc& update_func) {
   auto now = utils::datetime::SteadyNow();
   auto old_value = lru_.Get(key);
@@ -241,6 +308,11 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
       return std::move(old_value->value);
     } else {
       impl::CacheStale(stats_);
+
+      if (CanReturnStale(old_value->update_time, now)) {
+        UpdateInBackground(key, update_func);
+        return std::move(old_value->value);
+      }
     }
   }
   impl::CacheMiss(stats_);
@@ -248,9 +320,10 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
   return std::nullopt;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
 std::optional<Value>
-ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirable(
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::GetOptionalUnexpirable(
     const Key& key) {
   auto old_value = lru_.Get(key);
 
@@ -263,9 +336,11 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirable(
   return std::nullopt;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
 std::optional<Value>
-ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirableWithUpdate(
+ExpirableLruCache<Key, Value, Hash, Equal,
+                  Policy>::GetOptionalUnexpirableWithUpdate(
     const Key& key, const UpdateValueFunc& update_func) {
   auto now = utils::datetime::SteadyNow();
   auto old_value = lru_.Get(key);
@@ -284,9 +359,10 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirableWithUpdate(
   return std::nullopt;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
 std::optional<Value>
-ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalNoUpdate(
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::GetOptionalNoUpdate(
     const Key& key) {
   auto now = utils::datetime::SteadyNow();
   auto old_value = lru_.Get(key);
@@ -305,42 +381,50 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalNoUpdate(
   return std::nullopt;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
-                                                     const Value& value) {
-  lru_.Put(key, {value, utils::datetime::SteadyNow()});
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::Put(
+    const Key& key, const Value& value) {
+  PutToStorage(key, {value, utils::datetime::SteadyNow()});
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
-                                                     Value&& value) {
-  lru_.Put(key, {std::move(value), utils::datetime::SteadyNow()});
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::Put(
+    const Key& key, Value&& value) {
+  PutToStorage(key, {std::move(value), utils::datetime::SteadyNow()});
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
 const impl::ExpirableLruCacheStatistics&
-ExpirableLruCache<Key, Value, Hash, Equal>::GetStatistics() const {
+ExpirableLruCache<Key, Value, Hash, Equal, Policy>::GetStatistics() const {
   return stats_;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+size_t ExpirableLruCache<Key, Value, Hash, Equal, Policy>::GetSizeApproximate()
+    const {
   return lru_.GetSize();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::Invalidate() {
   lru_.Invalidate();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::InvalidateByKey(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::InvalidateByKey(
     const Key& key) {
   lru_.InvalidateByKey(key);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::UpdateInBackground(
     const Key& key, UpdateValueFunc update_func) {
   stats_.total.background_updates++;
   stats_.recent.GetCurrentCounter().background_updates++;
@@ -357,20 +441,33 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(
 
     auto now = utils::datetime::SteadyNow();
     auto value = update_func(key);
-    lru_.Put(key, {value, now});
+    PutToStorage(key, {value, now});
   }).Detach();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-bool ExpirableLruCache<Key, Value, Hash, Equal>::IsExpired(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::PutToStorage(
+    const Key& key, StoredValue&& value) {
+  if constexpr (Policy == CachePolicy::kTinyLfu) {
+    if (!lru_.Put(key, std::move(value))) impl::CacheAdmissionReject(stats_);
+  } else {
+    lru_.Put(key, std::move(value));
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+bool ExpirableLruCache<Key, Value, Hash, Equal, Policy>::IsExpired(
     std::chrono::steady_clock::time_point update_time,
     std::chrono::steady_clock::time_point now) const {
   auto max_lifetime = max_lifetime_.load();
   return max_lifetime.count() != 0 && update_time + max_lifetime < now;
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+bool ExpirableLruCache<Key, Value, Hash, Equal, Policy>::ShouldUpdate(
     std::chrono::steady_clock::time_point update_time,
     std::chrono::steady_clock::time_point now) const {
   auto max_lifetime = max_lifetime_.load();
@@ -378,11 +475,76 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
          max_lifetime.count() != 0 && update_time + max_lifetime / 2 < now;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+bool ExpirableLruCache<Key, Value, Hash, Equal, Policy>::CanReturnStale(
+    std::chrono::steady_clock::time_point update_time,
+    std::chrono::steady_clock::time_point now) const {
+  auto max_lifetime = max_lifetime_.load();
+  auto stale_while_revalidate = stale_while_revalidate_.load();
+  return max_lifetime.count() != 0 && stale_while_revalidate.count() != 0 &&
+         update_time + max_lifetime + stale_while_revalidate >= now;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+auto ExpirableLruCache<Key, Value, Hash, Equal, Policy>::StartOrJoinFetch(
+    const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode)
+    -> Fetch {
+  auto in_flight = in_flight_.Lock();
+  auto& fetch = (*in_flight)[key];
+  if (fetch) {
+    impl::CacheCoalesced(stats_);
+    return fetch;
+  }
+
+  // The fetch runs in a separate task, so that the cancellation of the first
+  // caller does not fail the others. Critical, because the callers are
+  // already waiting for it.
+  fetch = std::make_shared<engine::SharedTaskWithResult<Value>>(
+      utils::SharedCriticalAsync(
+          "lru-cache-fetch",
+          [this, token = wait_token_storage_.GetToken(), key, update_func,
+           read_mode] {
+            auto now = utils::datetime::SteadyNow();
+            // Test one more time - a fetch that has just finished might have
+            // put the value
+            auto old_value = lru_.Get(key);
+            if (old_value && !IsExpired(old_value->update_time, now)) {
+              return std::move(old_value->value);
+            }
+
+            auto value = update_func(key);
+            if (read_mode == ReadMode::kUseCache) {
+              PutToStorage(key, {value, now});
+            }
+            return value;
+          }));
+  return fetch;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::FinishFetch(
+    const Key& key, const Fetch& fetch) noexcept {
+  Fetch finished;
+  {
+    auto in_flight = in_flight_.Lock();
+    const auto it = in_flight->find(key);
+    if (it == in_flight->end() || it->second != fetch) return;
+    finished = std::move(it->second);
+    in_flight->erase(it);
+  }
+  // If the fetch is not finished yet and all its waiters are cancelled, the
+  // task is cancelled here, outside of the lock.
+}
+
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
-          typename Equal = std::equal_to<Key>>
+          typename Equal = std::equal_to<Key>,
+          CachePolicy Policy = CachePolicy::kLru>
 class LruCacheWrapper final {
  public:
-  using Cache = ExpirableLruCache<Key, Value, Hash, Equal>;
+  using Cache = ExpirableLruCache<Key, Value, Hash, Equal, Policy>;
   using ReadMode = typename Cache::ReadMode;
 
   LruCacheWrapper(std::shared_ptr<Cache> cache,
@@ -414,28 +576,34 @@ class LruCacheWrapper final {
   typename Cache::UpdateValueFunc update_func_;
 };
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::Write(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::Write(
     dump::Writer& writer) const {
   utils::impl::UpdateGlobalTime();
   lru_.Write(writer);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::Read(dump::Reader& reader) {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::Read(
+    dump::Reader& reader) {
   utils::impl::UpdateGlobalTime();
   lru_.Read(reader);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void ExpirableLruCache<Key, Value, Hash, Equal>::SetDumper(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void ExpirableLruCache<Key, Value, Hash, Equal, Policy>::SetDumper(
     std::shared_ptr<dump::Dumper> dumper) {
   lru_.SetDumper(std::move(dumper));
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void DumpMetric(utils::statistics::Writer& writer,
-                const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void DumpMetric(
+    utils::statistics::Writer& writer,
+    const ExpirableLruCache<Key, Value, Hash, Equal, Policy>& cache) {
   writer["current-documents-count"] = cache.GetSizeApproximate();
   writer = cache.GetStatistics();
 }
@@ -61,8 +61,16 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// size | max amount of items to store in cache | --
 /// ways | number of ways for associative cache | --
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// stale-while-revalidate | how long after the TTL to serve the expired entries while updating them in background | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
+/// The eviction policy is chosen by the Policy template parameter, see
+/// cache::CachePolicy. Use CachePolicy::kTinyLfu if the cache is exposed to
+/// scans that should not evict the hot keys.
+///
+/// Concurrent misses of the same key are coalesced into one DoGetByKey call,
+/// the coalesced requests are counted in the "coalesced-requests" metric.
+///
 /// ## Example usage:
 ///
 /// @snippet cache/lru_cache_component_base_test.hpp  Sample lru cache component
@@ -75,13 +83,14 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 
 // clang-format on
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
-          typename Equal = std::equal_to<Key>>
+          typename Equal = std::equal_to<Key>,
+          CachePolicy Policy = CachePolicy::kLru>
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class LruCacheComponent : public components::LoggableComponentBase,
                           private dump::DumpableEntity {
  public:
-  using Cache = ExpirableLruCache<Key, Value, Hash, Equal>;
-  using CacheWrapper = LruCacheWrapper<Key, Value, Hash, Equal>;
+  using Cache = ExpirableLruCache<Key, Value, Hash, Equal, Policy>;
+  using CacheWrapper = LruCacheWrapper<Key, Value, Hash, Equal, Policy>;
 
   LruCacheComponent(const components::ComponentConfig&,
                     const components::ComponentContext&);
@@ -123,8 +132,9 @@ class LruCacheComponent : public components::LoggableComponentBase,
   std::optional<testsuite::ComponentInvalidatorHolder> invalidator_holder_;
 };
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+LruCacheComponent<Key, Value, Hash, Equal, Policy>::LruCacheComponent(
     const components::ComponentConfig& config,
     const components::ComponentContext& context)
     : LoggableComponentBase(config, context),
@@ -149,8 +159,7 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
     config_subscription_ =
         impl::FindDynamicConfigSource(context).UpdateAndListen(
-            this, "cache." + name_,
-            &LruCacheComponent<Key, Value, Hash, Equal>::OnConfigUpdate);
+            this, "cache." + name_, &LruCacheComponent::OnConfigUpdate);
   } else {
     LOG_INFO() << "Dynamic LRU cache config is disabled, cache=" << name_;
   }
@@ -161,11 +170,12 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
   invalidator_holder_.emplace(
       impl::FindComponentControl(context), *this,
-      &LruCacheComponent<Key, Value, Hash, Equal>::DropCache);
+      &LruCacheComponent<Key, Value, Hash, Equal, Policy>::DropCache);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-LruCacheComponent<Key, Value, Hash, Equal>::~LruCacheComponent() {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+LruCacheComponent<Key, Value, Hash, Equal, Policy>::~LruCacheComponent() {
   invalidator_holder_.reset();
   statistics_holder_.Unregister();
   config_subscription_.Unsubscribe();
@@ -175,24 +185,29 @@ LruCacheComponent<Key, Value, Hash, Equal>::~LruCacheComponent() {
   }
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-typename LruCacheComponent<Key, Value, Hash, Equal>::CacheWrapper
-LruCacheComponent<Key, Value, Hash, Equal>::GetCache() {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+typename LruCacheComponent<Key, Value, Hash, Equal, Policy>::CacheWrapper
+LruCacheComponent<Key, Value, Hash, Equal, Policy>::GetCache() {
   return CacheWrapper(cache_, [this](const Key& key) { return GetByKey(key); });
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void LruCacheComponent<Key, Value, Hash, Equal>::DropCache() {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void LruCacheComponent<Key, Value, Hash, Equal, Policy>::DropCache() {
   cache_->Invalidate();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-Value LruCacheComponent<Key, Value, Hash, Equal>::GetByKey(const Key& key) {
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+Value LruCacheComponent<Key, Value, Hash, Equal, Policy>::GetByKey(
+    const Key& key) {
   return DoGetByKey(key);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void LruCacheComponent<Key, Value, Hash, Equal>::OnConfigUpdate(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void LruCacheComponent<Key, Value, Hash, Equal, Policy>::OnConfigUpdate(
     const dynamic_config::Snapshot& cfg) {
   const auto config = GetLruConfig(cfg, name_);
   if (config) {
@@ -204,22 +219,26 @@ void LruCacheComponent<Key, Value, Hash, Equal>::OnConfigUpdate(
   }
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void LruCacheComponent<Key, Value, Hash, Equal, Policy>::UpdateConfig(
     const LruCacheConfig& config) {
   cache_->SetWaySize(config.GetWaySize(static_config_.ways));
   cache_->SetMaxLifetime(config.lifetime);
   cache_->SetBackgroundUpdate(config.background_update);
+  cache_->SetStaleWhileRevalidate(config.stale_while_revalidate);
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
 yaml_config::Schema
-LruCacheComponent<Key, Value, Hash, Equal>::GetStaticConfigSchema() {
+LruCacheComponent<Key, Value, Hash, Equal, Policy>::GetStaticConfigSchema() {
   return impl::GetLruCacheComponentBaseSchema();
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void LruCacheComponent<Key, Value, Hash, Equal>::GetAndWrite(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void LruCacheComponent<Key, Value, Hash, Equal, Policy>::GetAndWrite(
     dump::Writer& writer) const {
   if constexpr (kCacheIsDumpable) {
     cache_->Write(writer);
@@ -228,8 +247,9 @@ void LruCacheComponent<Key, Value, Hash, Equal>::GetAndWrite(
   }
 }
 
-template <typename Key, typename Value, typename Hash, typename Equal>
-void LruCacheComponent<Key, Value, Hash, Equal>::ReadAndSet(
+template <typename Key, typename Value, typename Hash, typename Equal,
+          CachePolicy Policy>
+void LruCacheComponent<Key, Value, Hash, Equal, Policy>::ReadAndSet(
     dump::Reader& reader) {
   if constexpr (kCacheIsDumpable) {
     cache_->Read(reader);
@@ -19,6 +19,13 @@ enum class BackgroundUpdateMode {
   kDisabled,
 };
 
+/// Eviction policy of cache::ExpirableLruCache
+enum class CachePolicy {
+  kLru,      ///< Exact LRU, cache::NWayLRU
+  kClock,    ///< Approximate LRU without locks on hits, cache::NWayClockCache
+  kTinyLfu,  ///< W-TinyLFU: LRU with the frequency-based admission
+};
+
 struct LruCacheConfig final {
   explicit LruCacheConfig(const yaml_config::YamlConfig& config);
   explicit LruCacheConfig(const components::ComponentConfig& config);
@@ -30,6 +37,7 @@ struct LruCacheConfig final {
   std::size_t size;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  std::chrono::milliseconds stale_while_revalidate;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value,
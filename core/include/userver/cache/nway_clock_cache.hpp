@@ -0,0 +1,356 @@
+#pragma once
+
+/// @file userver/cache/nway_clock_cache.hpp
+/// @brief @copybrief cache::NWayClockCache
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/cache/persistent_hash_map.hpp>
+#include <userver/dump/dumper.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Concurrent cache with the CLOCK eviction policy, a drop-in
+/// replacement of cache::NWayLRU for the read-mostly workloads.
+///
+/// Each way publishes its elements as a cache::PersistentHashMap through an
+/// rcu::Variable with the rcu::ReclamationType::kEpoch reclamation. A cache
+/// hit neither takes the mutex of the way nor moves the element in a list:
+/// it only sets the "referenced" bit of the element, if it is not set yet.
+/// The CLOCK hand clears the bits and evicts the first element that was not
+/// referenced since the previous pass. Put, erase and eviction take the mutex
+/// of the way, and the modification of the way copies only O(log(way_size))
+/// nodes of the map.
+///
+/// The eviction order approximates LRU, see cache::NWayLRU for the exact one.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class NWayClockCache final {
+ public:
+  NWayClockCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
+                 const Equal& equal = Equal());
+
+  void Put(const T& key, U value);
+
+  template <typename Validator>
+  std::optional<U> Get(const T& key, Validator validator);
+
+  std::optional<U> Get(const T& key) {
+    return Get(key, [](const U&) { return true; });
+  }
+
+  U GetOr(const T& key, const U& default_value);
+
+  void Invalidate();
+
+  void InvalidateByKey(const T& key);
+
+  /// Iterates over all items. May be slow for big caches.
+  template <typename Function>
+  void VisitAll(Function func) const;
+
+  size_t GetSize() const;
+
+  void UpdateWaySize(size_t way_size);
+
+  void Write(dump::Writer& writer) const;
+  void Read(dump::Reader& reader);
+
+  /// The dump::Dumper will be notified of any cache updates. This method is not
+  /// thread-safe.
+  void SetDumper(std::shared_ptr<dump::Dumper> dumper);
+
+ private:
+  struct Entry final {
+    Entry(const T& key, U&& value) : key(key), value(std::move(value)) {}
+
+    const T key;
+    const U value;
+    // set by the readers, cleared by the CLOCK hand
+    mutable std::atomic<bool> referenced{false};
+    // position in Way::clock, guarded by Way::mutex
+    std::size_t clock_index{0};
+  };
+
+  using EntryPtr = std::shared_ptr<Entry>;
+  using Map = PersistentHashMap<T, EntryPtr, Hash, Equal>;
+
+  struct Way final {
+    Way(const Hash& hash, const Equal& equal)
+        : map(rcu::DestructionType::kSync, hash, equal) {}
+
+    rcu::Variable<Map, rcu::EpochRcuTraits<Map>> map;
+
+    engine::Mutex mutex;
+    // fields below are guarded by the mutex
+    std::vector<EntryPtr> clock;
+    std::size_t hand{0};
+    std::size_t max_size{1};
+  };
+
+  Way& GetWay(const T& key);
+
+  // Functions below must be called with the way mutex locked
+  static void EvictOne(Way& way, Map& map);
+  static void RemoveFromClock(Way& way, const Entry& entry);
+  static void Erase(Way& way, const T& key, const Entry* expected);
+
+  void NotifyDumper();
+
+  std::vector<std::unique_ptr<Way>> ways_;
+  Hash hash_fn_;
+  std::shared_ptr<dump::Dumper> dumper_{nullptr};
+};
+
+template <typename T, typename U, typename Hash, typename Eq>
+NWayClockCache<T, U, Hash, Eq>::NWayClockCache(size_t ways, size_t way_size,
+                                               const Hash& hash,
+                                               const Eq& equal)
+    : hash_fn_(hash) {
+  if (ways == 0) throw std::logic_error("Ways must be positive");
+
+  ways_.reserve(ways);
+  for (size_t i = 0; i < ways; ++i) {
+    ways_.push_back(std::make_unique<Way>(hash, equal));
+  }
+  UpdateWaySize(way_size);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::Put(const T& key, U value) {
+  auto& way = GetWay(key);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    auto entry = std::make_shared<Entry>(key, std::move(value));
+
+    auto txn = way.map.StartWrite();
+    if (const auto* old_entry = txn->FindOrNullptr(key)) {
+      // an update counts as a use of the key
+      entry->referenced.store(true, std::memory_order_relaxed);
+      entry->clock_index = (*old_entry)->clock_index;
+      way.clock[entry->clock_index] = entry;
+    } else {
+      if (way.clock.size() >= way.max_size) EvictOne(way, *txn);
+      entry->clock_index = way.clock.size();
+      way.clock.push_back(entry);
+    }
+    txn->insert_or_assign(key, std::move(entry));
+    txn.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Validator>
+std::optional<U> NWayClockCache<T, U, Hash, Eq>::Get(const T& key,
+                                                     Validator validator) {
+  auto& way = GetWay(key);
+  const Entry* expired = nullptr;
+  {
+    const auto snapshot = way.map.Read();
+    const auto* entry_ptr = snapshot->FindOrNullptr(key);
+    if (!entry_ptr) return std::nullopt;
+
+    // The entry is kept alive by the snapshot, so there is no need to copy the
+    // shared_ptr. Checking the bit first keeps the cache line of a hot entry
+    // shared between the readers.
+    const Entry& entry = **entry_ptr;
+    if (!entry.referenced.load(std::memory_order_relaxed)) {
+      entry.referenced.store(true, std::memory_order_relaxed);
+    }
+
+    if (validator(entry.value)) return entry.value;
+    expired = &entry;
+  }
+
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    Erase(way, key, expired);
+  }
+  return std::nullopt;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+U NWayClockCache<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
+  auto value = Get(key);
+  if (value) return std::move(*value);
+  return default_value;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::Invalidate() {
+  for (auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+    auto txn = way->map.StartWrite();
+    txn->clear();
+    txn.Commit();
+    way->clock.clear();
+    way->hand = 0;
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
+  auto& way = GetWay(key);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    Erase(way, key, nullptr);
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+void NWayClockCache<T, U, Hash, Eq>::VisitAll(Function func) const {
+  for (const auto& way : ways_) {
+    const auto snapshot = way->map.Read();
+    for (const auto& [key, entry] : *snapshot) func(key, entry->value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayClockCache<T, U, Hash, Eq>::GetSize() const {
+  size_t size{0};
+  for (const auto& way : ways_) {
+    const auto snapshot = way->map.Read();
+    size += snapshot->size();
+  }
+  return size;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
+  // LruMap does not support zero size either
+  if (way_size == 0) way_size = 1;
+
+  for (auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+    way->max_size = way_size;
+    if (way->clock.size() <= way_size) continue;
+
+    auto txn = way->map.StartWrite();
+    while (way->clock.size() > way_size) EvictOne(*way, *txn);
+    txn.Commit();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+auto NWayClockCache<T, U, Hash, Eq>::GetWay(const T& key) -> Way& {
+  // The maps of the ways use the same hash, so the hash is mixed to avoid
+  // the correlation between the way index and the positions in the map
+  const auto hash =
+      static_cast<std::uint64_t>(hash_fn_(key)) * 0x9E3779B97F4A7C15ULL;
+  return *ways_[(hash >> 32) % ways_.size()];
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::EvictOne(Way& way, Map& map) {
+  UASSERT(!way.clock.empty());
+  while (true) {
+    if (way.hand >= way.clock.size()) way.hand = 0;
+    const Entry& entry = *way.clock[way.hand];
+    if (entry.referenced.load(std::memory_order_relaxed)) {
+      // second chance
+      entry.referenced.store(false, std::memory_order_relaxed);
+      ++way.hand;
+      continue;
+    }
+
+    map.erase(entry.key);
+    // the hand now points to the element moved in place of the evicted one
+    RemoveFromClock(way, entry);
+    return;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::RemoveFromClock(Way& way,
+                                                     const Entry& entry) {
+  const auto index = entry.clock_index;
+  UASSERT(way.clock[index].get() == &entry);
+  if (index + 1 != way.clock.size()) {
+    way.clock[index] = std::move(way.clock.back());
+    way.clock[index]->clock_index = index;
+  }
+  // may destroy the entry if the map does not reference it anymore
+  way.clock.pop_back();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::Erase(Way& way, const T& key,
+                                           const Entry* expected) {
+  auto txn = way.map.StartWrite();
+  const auto* entry_ptr = txn->FindOrNullptr(key);
+  if (!entry_ptr) return;
+
+  // Do not erase the value put by a concurrent Put
+  const EntryPtr entry = *entry_ptr;
+  if (expected && entry.get() != expected) return;
+
+  txn->erase(key);
+  RemoveFromClock(way, *entry);
+  txn.Commit();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
+  writer.Write(ways_.size());
+
+  for (const auto& way : ways_) {
+    const auto snapshot = way->map.Read();
+
+    writer.Write(snapshot->size());
+    for (const auto& [key, entry] : *snapshot) {
+      writer.Write(key);
+      writer.Write(entry->value);
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::Read(dump::Reader& reader) {
+  Invalidate();
+
+  const auto ways = reader.Read<std::size_t>();
+  for (std::size_t i = 0; i < ways; ++i) {
+    const auto elements_in_way = reader.Read<std::size_t>();
+    for (std::size_t j = 0; j < elements_in_way; ++j) {
+      auto key = reader.Read<T>();
+      auto value = reader.Read<U>();
+      Put(std::move(key), std::move(value));
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::NotifyDumper() {
+  if (dumper_ != nullptr) {
+    dumper_->OnUpdateCompleted();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::SetDumper(
+    std::shared_ptr<dump::Dumper> dumper) {
+  dumper_ = std::move(dumper);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
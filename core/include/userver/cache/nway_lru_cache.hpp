@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 #include <userver/cache/lru_map.hpp>
@@ -13,15 +14,34 @@ USERVER_NAMESPACE_BEGIN
 
 namespace cache {
 
+namespace impl {
+
+template <typename Map, typename = void>
+inline constexpr bool kHasAdmissionPolicy = false;
+
+template <typename Map>
+inline constexpr bool kHasAdmissionPolicy<
+    Map,
+    std::void_t<decltype(std::declval<const Map&>().GetAdmissionRejects())>> =
+    true;
+
+}  // namespace impl
+
 /// @ingroup userver_containers
+///
+/// Map is the container of a way, cache::LruMap by default. See
+/// cache::ExpirableLruCache and cache::CachePolicy for the other options.
 template <typename T, typename U, typename Hash = std::hash<T>,
-          typename Equal = std::equal_to<T>>
+          typename Equal = std::equal_to<T>,
+          typename Map = LruMap<T, U, Hash, Equal>>
 class NWayLRU final {
  public:
   NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(),
           const Equal& equal = Equal());
 
-  void Put(const T& key, U value);
+  /// @returns false if the admission policy of the way rejected an element
+  /// to make room for the new one, true otherwise
+  bool Put(const T& key, U value);
 
   template <typename Validator>
   std::optional<U> Get(const T& key, Validator validator);
@@ -59,7 +79,7 @@ class NWayLRU final {
     Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
 
     mutable engine::Mutex mutex;
-    LruMap<T, U, Hash, Equal> cache;
+    Map cache;
   };
 
   Way& GetWay(const T& key);
@@ -71,9 +91,9 @@ class NWayLRU final {
   std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
-template <typename T, typename U, typename Hash, typename Eq>
-NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
-                                 const Eq& equal)
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+NWayLRU<T, U, Hash, Eq, Map>::NWayLRU(size_t ways, size_t way_size,
+                                      const Hash& hash, const Eq& equal)
     : caches_(), hash_fn_(hash) {
   caches_.reserve(ways);
   for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
@@ -82,20 +102,28 @@ NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
   for (auto& way : caches_) way.cache.SetMaxSize(way_size);
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+bool NWayLRU<T, U, Hash, Eq, Map>::Put(const T& key, U value) {
   auto& way = GetWay(key);
+  bool admitted = true;
   {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Put(key, std::move(value));
+    if constexpr (impl::kHasAdmissionPolicy<Map>) {
+      const auto rejects_before = way.cache.GetAdmissionRejects();
+      way.cache.Put(key, std::move(value));
+      admitted = (way.cache.GetAdmissionRejects() == rejects_before);
+    } else {
+      way.cache.Put(key, std::move(value));
+    }
   }
   NotifyDumper();
+  return admitted;
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
 template <typename Validator>
-std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
-                                              Validator validator) {
+std::optional<U> NWayLRU<T, U, Hash, Eq, Map>::Get(const T& key,
+                                                   Validator validator) {
   auto& way = GetWay(key);
   std::unique_lock<engine::Mutex> lock(way.mutex);
   auto* value = way.cache.Get(key);
@@ -108,8 +136,8 @@ std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
   return std::nullopt;
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+void NWayLRU<T, U, Hash, Eq, Map>::InvalidateByKey(const T& key) {
   auto& way = GetWay(key);
   {
     std::unique_lock<engine::Mutex> lock(way.mutex);
@@ -118,15 +146,17 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
   NotifyDumper();
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+U NWayLRU<T, U, Hash, Eq, Map>::GetOr(const T& key, const U& default_value) {
   auto& way = GetWay(key);
   std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  auto* value = way.cache.Get(key);
+  if (value) return *value;
+  return default_value;
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-void NWayLRU<T, U, Hash, Eq>::Invalidate() {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+void NWayLRU<T, U, Hash, Eq, Map>::Invalidate() {
   for (auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
     way.cache.Clear();
@@ -134,17 +164,17 @@ void NWayLRU<T, U, Hash, Eq>::Invalidate() {
   NotifyDumper();
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
 template <typename Function>
-void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
+void NWayLRU<T, U, Hash, Eq, Map>::VisitAll(Function func) const {
   for (const auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
     way.cache.VisitAll(func);
   }
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+size_t NWayLRU<T, U, Hash, Eq, Map>::GetSize() const {
   size_t size{0};
   for (const auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
@@ -153,23 +183,23 @@ size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   return size;
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+void NWayLRU<T, U, Hash, Eq, Map>::UpdateWaySize(size_t way_size) {
   for (auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
     way.cache.SetMaxSize(way_size);
   }
 }
 
-template <typename T, typename U, typename Hash, typename Eq>
-typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(
-    const T& key) {
+template <typename T, typename U, typename Hash, typename Eq, typename Map>
+auto NWayLRU<T, U, Hash, Eq, Map>::GetWay(const T& key) -> Way& {
   auto n = hash_fn_(key) % caches_.size();
   return caches_[n];
 }
 
-template <typename T, typename U, typename Hash, typename Equal>
-void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
+template <typename T, typename U, typename Hash, typename Equal,
+          typename Map>
+void NWayLRU<T, U, Hash, Equal, Map>::Write(dump::Writer& writer) const {
   writer.Write(caches_.size());
 
   for (const Way& way : caches_) {
@@ -184,8 +214,9 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
   }
 }
 
-template <typename T, typename U, typename Hash, typename Equal>
-void NWayLRU<T, U, Hash, Equal>::Read(dump::Reader& reader) {
+template <typename T, typename U, typename Hash, typename Equal,
+          typename Map>
+void NWayLRU<T, U, Hash, Equal, Map>::Read(dump::Reader& reader) {
   Invalidate();
 
   const auto ways = reader.Read<std::size_t>();
@@ -199,15 +230,17 @@ void NWayLRU<T, U, Hash, Equal>::Read(dump::Reader& reader) {
   }
 }
 
-template <typename T, typename U, typename Hash, typename Equal>
-void NWayLRU<T, U, Hash, Equal>::NotifyDumper() {
+template <typename T, typename U, typename Hash, typename Equal,
+          typename Map>
+void NWayLRU<T, U, Hash, Equal, Map>::NotifyDumper() {
   if (dumper_ != nullptr) {
     dumper_->OnUpdateCompleted();
   }
 }
 
-template <typename T, typename U, typename Hash, typename Equal>
-void NWayLRU<T, U, Hash, Equal>::SetDumper(
+template <typename T, typename U, typename Hash, typename Equal,
+          typename Map>
+void NWayLRU<T, U, Hash, Equal, Map>::SetDumper(
     std::shared_ptr<dump::Dumper> dumper) {
   dumper_ = std::move(dumper);
 }
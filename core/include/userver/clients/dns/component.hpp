@@ -33,6 +33,8 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-prefetch-interval | interval of the background updates of the network cache entries that are in use and are about to expire, 0 disables the updates | 0s
+/// cache-prefetch-min-hits | min number of the cache hits since the previous background update for an entry to be updated | 1
 ///
 /// ## Static configuration example:
 ///
@@ -39,6 +39,14 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// Interval of the background updates of the hot network cache entries
+  /// that are about to expire, zero disables the updates
+  std::chrono::milliseconds cache_prefetch_interval{0};
+
+  /// Min number of the cache hits since the previous background update for an
+  /// entry to be updated
+  size_t cache_prefetch_min_hits{1};
 };
 
 }  // namespace clients::dns
@@ -3,6 +3,10 @@
 /// @file userver/clients/dns/resolver.hpp
 /// @brief @copybrief clients::dns::Resolver
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <userver/clients/dns/common.hpp>
 #include <userver/clients/dns/config.hpp>
 #include <userver/clients/dns/exception.hpp>
@@ -34,6 +38,15 @@ class Resolver {
     utils::statistics::RelaxedCounter<size_t> network_failure{0};
   };
 
+  /// Statistics of a network results cache entry
+  struct NetworkCacheEntryStats {
+    std::string name;
+    /// Number of the cache hits since the name was cached
+    std::uint64_t hits{0};
+    /// Whether the entry is a cached resolution failure
+    bool is_failure{false};
+  };
+
   Resolver(engine::TaskProcessor& fs_task_processor,
            const ResolverConfig& config);
   Resolver(const Resolver&) = delete;
@@ -47,6 +60,10 @@ class Resolver {
   ///  - Cached network resolution results
   ///  - Network name servers
   ///
+  /// With ResolverConfig::cache_prefetch_interval, the cached results that
+  /// are in use are updated in background before they expire, so that the
+  /// requests do not wait for the network name servers.
+  ///
   /// @throws clients::dns::NotResolvedException if none of the sources provide
   /// a result within the specified deadline.
   AddrVector Resolve(const std::string& name, engine::Deadline deadline);
@@ -54,6 +71,9 @@ class Resolver {
   /// Returns lookup source counters.
   const LookupSourceCounters& GetLookupSourceCounters() const;
 
+  /// Returns the statistics of the network results cache entries.
+  std::vector<NetworkCacheEntryStats> GetNetworkCacheStats() const;
+
   /// Forces the reload of lookup table file. Waits until the reload is done.
   void ReloadHosts();
 
@@ -65,7 +85,7 @@ class Resolver {
 
  private:
   class Impl;
-  constexpr static size_t kSize = 1728;
+  constexpr static size_t kSize = 2352;
   constexpr static size_t kAlignment = 16;
   utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
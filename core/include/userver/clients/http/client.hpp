@@ -7,7 +7,10 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -90,6 +93,11 @@ class Client final {
   // For internal use only.
   void SetMaxHostConnections(size_t max_host_connections);
 
+  // Opens the connections to the `urls` from each of the IO threads and waits
+  // for them up to the `timeout`. For internal use only.
+  void PrewarmConnections(const std::vector<std::string>& urls,
+                          std::chrono::milliseconds timeout);
+
   // For internal use only.
   PoolStatistics GetPoolStatistics() const;
 
@@ -133,6 +141,10 @@ class Client final {
  private:
   void ReinitEasy();
 
+  Request CreateRequestOnMulti(size_t multi_index);
+  Request CreateRequest(std::shared_ptr<impl::EasyWrapper>&& wrapper,
+                        size_t multi_index);
+
   InstanceStatistics GetMultiStatistics(size_t n) const;
 
   size_t FindMultiIndex(const curl::multi*) const;
@@ -145,10 +157,14 @@ class Client final {
   void PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept;
 
   std::shared_ptr<curl::easy> TryDequeueIdle() noexcept;
+  std::shared_ptr<curl::easy> TryDequeueIdle(size_t multi_index) noexcept;
+
+  size_t GetWorkerThreadMultiIndex() const noexcept;
 
   std::atomic<std::size_t> pending_tasks_{0};
 
   const impl::DeadlinePropagationConfig deadline_propagation_config_;
+  const bool wait_for_multiplexing_;
 
   std::shared_ptr<DestinationStatistics> destination_statistics_;
   std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
@@ -162,6 +178,8 @@ class Client final {
   using IdleQueue =
       moodycamel::ConcurrentQueue<IdleQueueValue, IdleQueueTraits>;
   utils::FastPimpl<IdleQueue, kIdleQueueSize, kIdleQueueAlignment> idle_queue_;
+  // With the worker thread affinity, the idle easy handles of each multi
+  std::vector<std::unique_ptr<IdleQueue>> multi_idle_queues_;
 
   engine::TaskProcessor& fs_task_processor_;
   std::optional<std::string> user_agent_;
@@ -180,6 +198,9 @@ class Client final {
   utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
   const server::http::HeadersPropagator* headers_propagator_{nullptr};
   impl::PluginPipeline plugin_pipeline_;
+
+  // Joins the identical requests that are marked with Request::coalesce()
+  std::unique_ptr<RequestsCoalescer> requests_coalescer_;
 };
 
 }  // namespace clients::http
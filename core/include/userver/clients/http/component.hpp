@@ -38,6 +38,7 @@ namespace components {
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
+/// worker-thread-affinity | whether the requests created on a task processor thread always go to the same IO thread, to reuse its connections and easy handles | false
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
@@ -47,6 +48,18 @@ namespace components {
 /// testsuite-allowed-url-prefixes | if set, checks that all URLs start with any of the passed prefixes, asserts if not. Set for testing purposes only. | ''
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header | true
+/// http2.multiplexing | whether to send the concurrent requests to a host as the streams of a single HTTP/2 connection | false
+/// http2.max-streams-per-connection | max number of concurrent streams of an HTTP/2 connection | 100
+/// http2.max-host-connections | max number of connections to a host for all the IO threads together, split evenly among them | unlimited
+/// http2.wait-for-multiplexing | with the multiplexing, whether a request waits for a connection to a host that is being opened instead of opening a new one | true
+/// http2.prewarm-urls | URLs to send HEAD requests to from each of the IO threads at the start, to open the connections in advance | -
+/// http2.prewarm-timeout | timeout of the prewarm requests | 1s
+/// concurrency-limit.enabled | whether to limit the concurrent requests to each destination, the limit adapts to the latencies and errors of the destination; the requests over the limit fail with clients::http::ConcurrencyLimitException | false
+/// concurrency-limit.initial-limit | initial limit for a destination | 100
+/// concurrency-limit.min-limit | min limit for a destination | 1
+/// concurrency-limit.max-limit | max limit for a destination | 1000
+/// concurrency-limit.latency-tolerance | the limit is decreased if a latency is this many times greater than the usual latency of the destination | 2.0
+/// concurrency-limit.queue-timeout | how long a request waits for the number of the concurrent requests to go below the limit before it fails | 0ms
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name.
 ///
 /// ## Static configuration example:
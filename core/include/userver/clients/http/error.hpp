@@ -53,6 +53,14 @@ class CancelException : public BaseException {
   ~CancelException() override = default;
 };
 
+/// Thrown if the concurrency limit of the destination is reached, see the
+/// `concurrency-limit` static option of components::HttpClient
+class ConcurrencyLimitException : public BaseException {
+ public:
+  using BaseException::BaseException;
+  ~ConcurrencyLimitException() override = default;
+};
+
 class SSLException : public BaseCodeException {
  public:
   using BaseCodeException::BaseCodeException;
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/clients/http/hedging.hpp
+/// @brief @copybrief clients::http::HedgedRequests
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Client;
+
+/// Settings of clients::http::HedgedRequests
+struct HedgingSettings final {
+  /// Delay after which the duplicate request is sent if there is still no
+  /// response to the first one
+  std::chrono::milliseconds delay{50};
+
+  /// If set, the delay is this percentile (e.g. 95) of the recent timings of
+  /// the `destination`, and `delay` is used until there are any timings
+  std::optional<double> delay_percentile;
+
+  /// Destination whose timings are used for the `delay_percentile`, see
+  /// clients::http::Request::SetDestinationMetricName()
+  std::string destination;
+
+  /// Max number of the duplicate requests per the request, limits the extra
+  /// load on the destination when all of its responses are slow
+  double max_hedged_ratio{0.1};
+};
+
+/// @brief Performs the requests to a destination with hedging: if there is no
+/// response after a delay, a duplicate request is sent and the first
+/// response of them is used, the other request is cancelled.
+///
+/// The duplicate requests are limited by the budget of
+/// HedgingSettings::max_hedged_ratio of all the requests, so that an
+/// incident on the destination does not double the load on it.
+///
+/// The object should be shared by all the requests to the destination, its
+/// methods are thread safe.
+///
+/// @warning Only the idempotent requests may be hedged.
+class HedgedRequests final {
+ public:
+  using RequestFactory = std::function<Request(Client&)>;
+
+  HedgedRequests(Client& client, HedgingSettings settings);
+
+  /// @brief Performs a request made by the `request_factory`, and its
+  /// duplicate if needed.
+  ///
+  /// The `request_factory` is called once for the request and once more for
+  /// the duplicate, the requests must be the same. If the first completed
+  /// request fails, the response of the other one is awaited.
+  std::shared_ptr<Response> Perform(const RequestFactory& request_factory);
+
+  /// @returns the number of the duplicate requests sent
+  std::uint64_t GetHedgedCount() const noexcept { return hedged_count_; }
+
+ private:
+  std::chrono::milliseconds GetDelay();
+  void AccountRequest() noexcept;
+  bool TryAcquireBudget() noexcept;
+
+  Client& client_;
+  const HedgingSettings settings_;
+
+  // In the thousandths of a request
+  std::atomic<std::int64_t> budget_{0};
+  std::atomic<std::uint64_t> hedged_count_{0};
+
+  std::atomic<std::chrono::milliseconds::rep> percentile_delay_ms_{-1};
+  std::atomic<std::chrono::steady_clock::rep> next_percentile_update_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
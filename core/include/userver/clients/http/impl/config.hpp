@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -23,12 +25,35 @@ struct DeadlinePropagationConfig {
   bool update_header{true};
 };
 
+struct Http2Settings final {
+  bool multiplexing{false};
+  std::size_t max_streams_per_connection{100};
+  // For all the IO threads together
+  std::optional<std::size_t> max_host_connections;
+  bool wait_for_multiplexing{true};
+  std::vector<std::string> prewarm_urls;
+  std::chrono::milliseconds prewarm_timeout{1000};
+};
+
+struct ConcurrencyLimitSettings final {
+  bool enabled{false};
+  std::size_t initial_limit{100};
+  std::size_t min_limit{1};
+  std::size_t max_limit{1000};
+  // The limit is decreased if a latency exceeds the baseline this many times
+  double latency_tolerance{2.0};
+  std::chrono::milliseconds queue_timeout{0};
+};
+
 // Static config
 struct ClientSettings final {
   std::string thread_name_prefix{};
   size_t io_threads{8};
   bool defer_events{false};
+  bool worker_thread_affinity{false};
   DeadlinePropagationConfig deadline_propagation{};
+  Http2Settings http2{};
+  ConcurrencyLimitSettings concurrency_limit{};
   const tracing::TracingManagerBase* tracing_manager{nullptr};
   const server::http::HeadersPropagator* headers_propagator{nullptr};
 };
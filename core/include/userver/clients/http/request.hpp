@@ -3,6 +3,7 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <chrono>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -31,6 +32,7 @@ class HeadersPropagator;
 namespace clients::http {
 
 class RequestState;
+class RequestsCoalescer;
 class StreamedResponse;
 class ConnectTo;
 class Form;
@@ -227,6 +229,19 @@ class Request final {
   Request& retry(short retries = 3, bool on_fails = true) &;
   Request retry(short retries = 3, bool on_fails = true) &&;
 
+  /// Join the request with the identical concurrent ones into a single
+  /// upstream request and share the response among all of them. Only the GET
+  /// and HEAD requests without a body are joined; the requests are identical
+  /// if they have the same method, URL and headers.
+  ///
+  /// A successful response is also kept for `cache_ttl` to answer the
+  /// identical requests that come right after it.
+  ///
+  /// Cancellation of a joined request does not cancel the shared upstream
+  /// request, which is performed with the settings of the first request.
+  Request& coalesce(std::chrono::milliseconds cache_ttl = {}) &;
+  Request coalesce(std::chrono::milliseconds cache_ttl = {}) &&;
+
   /// Set unix domain socket as connection endpoint and provide path to it
   /// When enabled, request will connect to the Unix domain socket instead
   /// of establishing a TCP connection to a host.
@@ -265,6 +280,8 @@ class Request final {
 
   void SetAllowedUrlsExtra(const std::vector<std::string>& urls) &;
 
+  void SetRequestsCoalescer(RequestsCoalescer* coalescer) &;
+
   // Set deadline propagation settings. For internal use only.
   void SetDeadlinePropagationConfig(
       const impl::DeadlinePropagationConfig& deadline_propagation_config) &;
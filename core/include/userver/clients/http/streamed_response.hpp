@@ -20,10 +20,17 @@ class RequestState;
 /// Call Request::async_perform_stream_body()
 /// to get one.  You can use it for fast proxying backend response body
 /// to a remote Application.
+///
+/// The body parts are moved out of the queue, so proxying them with
+/// server::http::ResponseBodyStream::PushBodyChunk(std::move(chunk), ...)
+/// does not copy them. While the queue is full, the transfer is paused: the
+/// max size of the queue bounds the buffered part of the body, and it should
+/// be at least CURL_MAX_WRITE_SIZE (16 KiB).
 class StreamedResponse final {
  public:
   StreamedResponse(StreamedResponse&&) = default;
   StreamedResponse(const StreamedResponse&) = delete;
+  ~StreamedResponse();
 
   StreamedResponse& operator=(StreamedResponse&&) = default;
   StreamedResponse& operator=(const StreamedResponse&) = delete;
@@ -184,6 +184,8 @@ class ComponentContext final {
 
   void CancelComponentsLoad();
 
+  const std::string& GetStartupReport() const;
+
   [[noreturn]] void ThrowNonRegisteredComponent(std::string_view name,
                                                 std::string_view type) const;
   [[noreturn]] void ThrowComponentTypeMismatch(
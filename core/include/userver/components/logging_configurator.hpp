@@ -8,6 +8,7 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -28,6 +29,10 @@ namespace components {
 ///
 /// ## Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
+///
+/// The counts of the logs dropped by the `sampling` of
+/// @ref USERVER_LOG_DYNAMIC_DEBUG are reported in the
+/// `logger.sampling.suppressed` metric labeled with the log location.
 /// * @ref USERVER_NO_LOG_SPANS
 ///
 /// ## Static options:
@@ -59,6 +64,7 @@ class LoggingConfigurator final : public impl::ComponentBase {
 
   concurrent::AsyncEventSubscriberScope config_subscription_;
   rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+  utils::statistics::Entry statistics_holder_;
 };
 
 /// }@
@@ -33,7 +33,18 @@ class Manager;
 /// coro_pool.initial_size | amount of coroutines to preallocate on startup | -
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | -
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
+/// coro_pool.stack_usage_sample_every | if not 0, paint the coroutine stacks with a canary pattern and sample the stack high-water mark on every Nth return of a coroutine to the pool; reported per task processor as `coro-stack-usage-kb` percentiles. Painting makes the whole stacks resident in memory | 0
+/// coro_pool.huge_pages | advise the kernel to back the coroutine stacks with transparent huge pages, only the stacks that span whole huge pages may get them | false
+/// coro_pool.stack_release_idle_watermark | if not 0, the stacks of the coroutines returned to the pool that already has at least this many idle coroutines are released to the OS except for the top `stack_release_keep_size` bytes; reported as `coro-pool.released-stacks`. Is ignored if `stack_usage_sample_every` is set | 0
+/// coro_pool.stack_release_keep_size | size of the top part of a released coroutine stack that stays resident, bytes; holds the frames of the idle coroutine, so may not be less than 8 * 1024 | 16 * 1024
+/// coro_pool.stack_release_advice | 'free' (MADV_FREE, the pages are reclaimed under memory pressure) or 'dontneed' (MADV_DONTNEED, the pages are reclaimed at once) | free
+/// coro_pool.small_stacks | optional pool (`initial_size`, `max_size`, `stack_size`) for the task processors with 'small' stack-size-class | -
+/// coro_pool.large_stacks | optional pool (`initial_size`, `max_size`, `stack_size`) for the task processors with 'large' stack-size-class | -
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | -
+/// event_thread_pool.defer_events | whether to defer timer events to a per-thread periodic timer or notify ev-loop right away | false
+/// event_thread_pool.backend | kernel interface used by the ev-loops to wait for I/O readiness: 'auto', 'epoll', 'io_uring' (batched submission, libev 4.31+ and Linux 5.4+) or 'linux-aio'; falls back to 'auto' if unavailable | auto
+/// event_thread_pool.timer_wheel | whether to keep the long task timers (sleeps, deadlines) in a per-thread hierarchical timer wheel with 1ms ticks instead of the libev timers heap; rearming becomes O(1), timers fire up to 1ms late | false
+/// event_thread_pool.load_balancing | whether to assign the new sockets and timers to the less loaded (by `ev-threads.cpu-load-percent`) of the next ev-thread in the round-robin order and a random one, instead of pure round-robin | false
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
@@ -47,6 +58,11 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 10000
+/// adaptive-spinning | whether to adapt the number of spin-wait iterations (up to spinning-iterations) to the recent spin hit rate | false
+/// task-queue | task queue implementation. 'global' uses a single queue shared by all the worker threads. 'work-stealing' gives each worker thread its own queue and lets idle workers steal from the others, it does not honor engine::Task::Priority. | global
+/// stack-size-class | stack size class of the task processor coroutines: 'small', 'default' or 'large'. Falls back to the default coroutine pool if components_manager.coro_pool has no pool for the class | default
+/// numa-nodes | list of NUMA nodes to distribute the worker threads among; each worker thread is pinned to the CPUs of its node, and with 'work-stealing' task queue idle workers steal from the workers of their own node first | [] (no pinning)
+/// blocking-watchdog-threshold | if not 0, a watchdog thread logs the stacktrace of the worker threads, that run a task for longer than this duration without a context switch, e.g. because of a blocking syscall. The stacktrace is taken with SIGURG | 0 (disabled)
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -23,9 +23,11 @@ void TryValidateStaticConfig(const components::ComponentConfig& static_config,
                              ValidationMode validation_condition) {
   if (components::kHasValidate<Component> ||
       validation_condition == ValidationMode::kAll) {
-    yaml_config::Schema schema = Component::GetStaticConfigSchema();
+    // The schema is parsed once per component type
+    static const yaml_config::Schema kSchema =
+        Component::GetStaticConfigSchema();
 
-    yaml_config::impl::Validate(static_config, schema);
+    yaml_config::impl::Validate(static_config, kSchema);
   }
 }
 
@@ -3,6 +3,8 @@
 /// @file userver/components/tcp_acceptor_base.hpp
 /// @brief @copybrief components::TcpAcceptorBase
 
+#include <memory>
+
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -16,6 +18,10 @@ struct ListenerConfig;
 
 namespace components {
 
+namespace impl {
+class IdleSockets;
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_base_classes userver_components
@@ -25,6 +31,12 @@ namespace components {
 /// Each accepted socket is processed in a new coroutine by ProcessSocket of
 /// the derived class.
 ///
+/// With `park_idle_sockets` enabled, accepted sockets are not given a
+/// coroutine until they become readable. ProcessSocket may return an idle
+/// socket back via ParkSocket() and finish, so that mostly idle connections
+/// hold no coroutine and no stack. ProcessSocket is called again in a new
+/// coroutine when the socket becomes readable or is closed by peer.
+///
 /// ## Static options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
@@ -34,6 +46,7 @@ namespace components {
 /// backlog | max count of new connections pending acceptance | 1024
 /// no_delay | whether to set the `TCP_NODELAY` option on incoming sockets | true
 /// sockets_task_processor | task processor to process accepted sockets | value of `task_processor`
+/// park_idle_sockets | whether to wait for the accepted and parked sockets to become readable without a coroutine (Linux only) | false
 ///
 /// @see @ref md_en_userver_tutorial_tcp_service
 
@@ -52,12 +65,21 @@ class TcpAcceptorBase : public LoggableComponentBase {
   /// each new socket.
   virtual void ProcessSocket(engine::io::Socket&& sock) = 0;
 
+  /// @brief Gives the idle socket back to the acceptor, ProcessSocket is
+  /// called with it in a new coroutine as soon as it becomes readable.
+  ///
+  /// Without `park_idle_sockets`, or if the socket could not be parked, the
+  /// socket is waited for in a new coroutine.
+  void ParkSocket(engine::io::Socket&& sock);
+
  private:
   TcpAcceptorBase(const ComponentConfig& config,
                   const ComponentContext& context,
                   const server::net::ListenerConfig& acceptor_config);
 
   void KeepAccepting();
+  void KeepWaitingForParkedSockets();
+  void StartProcessing(engine::io::Socket&& sock);
 
   void OnAllComponentsLoaded() final;
   void OnAllComponentsAreStopping() final;
@@ -66,8 +88,10 @@ class TcpAcceptorBase : public LoggableComponentBase {
   engine::TaskProcessor& acceptor_task_processor_;
   engine::TaskProcessor& sockets_task_processor_;
   concurrent::BackgroundTaskStorageCore tasks_;
+  std::unique_ptr<impl::IdleSockets> idle_sockets_;
   engine::io::Socket listen_sock_;
   engine::Task acceptor_;
+  engine::Task parked_sockets_waiter_;
 };
 
 }  // namespace components
@@ -26,6 +26,24 @@ namespace components {
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | -
 /// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// sampling-rate | probability for a new trace to be sampled | 1.0
+/// tail-sampling-slow-threshold | not sampled traces whose local root span lasts longer are still logged | 0 (disabled)
+/// tail-sampling-keep-errors | not sampled traces with the 'error' tag are still logged | false
+///
+/// ## Sampling
+///
+/// The head-based sampling decision is made once per trace by its first span
+/// in the service and is inherited by all the child spans. The decision is
+/// taken from the `X-YaSampled` header of the incoming request if it is
+/// present and is sent to the downstream services by
+/// tracing::DefaultTracingManager.
+///
+/// The not sampled spans store no tags except for the link and are not
+/// logged, which makes them cheap. With any of the `tail-sampling-*` options
+/// the not sampled spans are kept in memory until the local root span of the
+/// trace finishes, and the whole trace is logged if the root span turned out
+/// to be slow or any of the spans has the tracing::kErrorFlag tag. At most
+/// 1000 spans are kept per trace.
 ///
 /// ## Static configuration example:
 ///
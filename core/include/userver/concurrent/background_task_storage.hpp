@@ -3,12 +3,18 @@
 /// @file userver/concurrent/background_task_storage.hpp
 /// @brief @copybrief concurrent::BackgroundTaskStorage
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -43,6 +49,64 @@ class BackgroundTaskStorageCore final {
   std::optional<engine::impl::DetachedTasksSyncBlock> sync_block_;
 };
 
+/// What a bounded concurrent::BackgroundTaskStorage does with a new task when
+/// the limit of the tasks in flight is reached
+enum class BackgroundTaskOverflowPolicy {
+  /// The new task is not started
+  kReject,
+  /// Cancellation of the oldest task in flight is requested and the new task
+  /// is started at once. The dropped task holds no slot anymore, but runs
+  /// until it notices the cancellation, so for a while more than
+  /// BackgroundTaskStorageLimits::max_tasks tasks may be running.
+  kDropOldest,
+};
+
+/// Limits of a bounded concurrent::BackgroundTaskStorage
+struct BackgroundTaskStorageLimits final {
+  /// Max count of the tasks in flight, not counting the dropped ones that are
+  /// yet to notice their cancellation
+  std::size_t max_tasks{1000};
+
+  BackgroundTaskOverflowPolicy overflow_policy{
+      BackgroundTaskOverflowPolicy::kReject};
+};
+
+namespace impl {
+
+class BackgroundTaskLimiter;
+
+// A unit of the limit, that is held by the payload of a task
+class BackgroundTaskSlot final {
+ public:
+  BackgroundTaskSlot() noexcept = default;
+  BackgroundTaskSlot(BackgroundTaskLimiter& limiter, std::uint64_t id) noexcept;
+
+  BackgroundTaskSlot(BackgroundTaskSlot&&) noexcept;
+  BackgroundTaskSlot& operator=(BackgroundTaskSlot&&) = delete;
+  ~BackgroundTaskSlot();
+
+  explicit operator bool() const noexcept { return limiter_ != nullptr; }
+  std::uint64_t GetId() const noexcept { return id_; }
+
+ private:
+  BackgroundTaskLimiter* limiter_{nullptr};
+  std::uint64_t id_{0};
+  std::chrono::steady_clock::time_point start_;
+};
+
+template <typename Function>
+struct BackgroundTaskWithSlot final {
+  BackgroundTaskSlot slot;
+  Function function;
+
+  template <typename... Args>
+  decltype(auto) operator()(Args&&... args) {
+    return std::invoke(function, std::forward<Args>(args)...);
+  }
+};
+
+}  // namespace impl
+
 /// @ingroup userver_concurrency userver_containers
 ///
 /// A storage that allows one to start detached tasks; cancels and waits for
@@ -53,6 +117,13 @@ class BackgroundTaskStorageCore final {
 /// limited lifetime. You must guarantee that the resources are available while
 /// the BackgroundTaskStorage is alive.
 ///
+/// A bounded BTS keeps no more than BackgroundTaskStorageLimits::max_tasks
+/// tasks in flight, so the fire-and-forget work does not pile up under
+/// overload. With BackgroundTaskOverflowPolicy::kDropOldest the dropped tasks
+/// that have not finished yet run beyond the limit. Pass a separate
+/// low-priority engine::TaskProcessor to keep such work away from the request
+/// handling.
+///
 /// ## Usage synopsis
 /// @snippet concurrent/background_task_storage_test.cpp  Sample
 class BackgroundTaskStorage final {
@@ -64,6 +135,13 @@ class BackgroundTaskStorage final {
   /// Creates a BTS that launches tasks in the specified engine::TaskProcessor.
   explicit BackgroundTaskStorage(engine::TaskProcessor& task_processor);
 
+  /// Creates a bounded BTS that launches tasks in the specified
+  /// engine::TaskProcessor.
+  BackgroundTaskStorage(engine::TaskProcessor& task_processor,
+                        const BackgroundTaskStorageLimits& limits);
+
+  ~BackgroundTaskStorage();
+
   BackgroundTaskStorage(const BackgroundTaskStorage&) = delete;
   BackgroundTaskStorage& operator=(const BackgroundTaskStorage&) = delete;
 
@@ -77,27 +155,55 @@ class BackgroundTaskStorage final {
   /// The task is started as non-Critical, it may be cancelled due to
   /// `TaskProcessor` overload. engine::TaskInheritedVariable instances are not
   /// inherited from the caller. See utils::AsyncBackground for details.
-  template <typename... Args>
-  void AsyncDetach(std::string name, Args&&... args) {
-    core_.Detach(utils::AsyncBackground(std::move(name), task_processor_,
-                                        std::forward<Args>(args)...));
+  ///
+  /// @returns `false` if the bounded BTS is full and rejects the task
+  template <typename Function, typename... Args>
+  bool AsyncDetach(std::string name, Function&& f, Args&&... args) {
+    return AsyncDetach(task_processor_, std::move(name),
+                       std::forward<Function>(f), std::forward<Args>(args)...);
   }
 
   /// @deprecated Pass engine::TaskProcessor to BTS constructor instead.
-  template <typename... Args>
-  void AsyncDetach(engine::TaskProcessor& task_processor, std::string name,
-                   Args&&... args) {
-    core_.Detach(utils::AsyncBackground(std::move(name), task_processor,
-                                        std::forward<Args>(args)...));
+  template <typename Function, typename... Args>
+  bool AsyncDetach(engine::TaskProcessor& task_processor, std::string name,
+                   Function&& f, Args&&... args) {
+    if (!limiter_) {
+      core_.Detach(utils::AsyncBackground(std::move(name), task_processor,
+                                          std::forward<Function>(f),
+                                          std::forward<Args>(args)...));
+      return true;
+    }
+
+    auto slot = TryAcquireSlot();
+    if (!slot) return false;
+    const auto id = slot.GetId();
+    auto task = utils::AsyncBackground(
+        std::move(name), task_processor,
+        impl::BackgroundTaskWithSlot<std::decay_t<Function>>{
+            std::move(slot), std::forward<Function>(f)},
+        std::forward<Args>(args)...);
+    DetachWithSlot(id, std::move(task));
+    return true;
   }
 
   /// @deprecated Use AsyncDetach or BackgroundTaskStorageCore instead.
+  /// @note The task is not counted in the limit of a bounded BTS
   void Detach(engine::Task&& task) { core_.Detach(std::move(task)); }
 
   /// Approximate number of currently active tasks
   std::int64_t ActiveTasksApprox() const noexcept;
 
+  /// Writes the count of the active tasks, and for a bounded BTS the counts
+  /// of the started, rejected and dropped tasks and the timings of the tasks
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const BackgroundTaskStorage& bts);
+
  private:
+  impl::BackgroundTaskSlot TryAcquireSlot();
+  // Lets the limiter cancel the task to make room for the newer ones
+  void DetachWithSlot(std::uint64_t id, engine::Task&& task);
+
+  std::unique_ptr<impl::BackgroundTaskLimiter> limiter_;
   BackgroundTaskStorageCore core_;
   engine::TaskProcessor& task_processor_;
 };
@@ -0,0 +1,389 @@
+#pragma once
+
+/// @file userver/concurrent/pipeline.hpp
+/// @brief @copybrief concurrent::Pipeline
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// Settings of a concurrent::Pipeline stage
+struct PipelineStageSettings final {
+  /// Name of the stage tasks spans and of the `stage` metrics label
+  std::string name;
+
+  /// Count of the tasks that process the elements of the stage concurrently
+  std::size_t parallelism{1};
+
+  /// Max count of the elements waiting for the stage, the previous stage
+  /// waits once the queue is full
+  std::size_t queue_size{64};
+
+  /// Max count of the elements passed to the batched stage at once, the
+  /// available elements are taken without waiting for a full batch
+  std::size_t max_batch_size{1};
+};
+
+template <typename Input>
+class Pipeline;
+
+template <typename Input, typename Output>
+class PipelineBuilder;
+
+namespace impl {
+
+template <typename T>
+using PipelineQueue = NonFifoMpmcQueue<T>;
+
+// The output of the final stage, that has no next queue
+struct PipelineNoOutput final {};
+
+struct PipelineStageStatistics final {
+  PipelineStageStatistics(std::string name,
+                          std::function<std::size_t()> get_queue_size);
+
+  void Account(std::size_t items, std::chrono::steady_clock::duration time);
+
+  const std::string name;
+  const std::function<std::size_t()> get_queue_size;
+
+  utils::statistics::ShardedRateCounter items;
+  utils::statistics::ShardedRateCounter batches;
+  utils::statistics::RateCounter errors;
+  // Processing times of the batches in microseconds, up to a minute
+  utils::statistics::HdrHistogram<60'000'000> timings_us;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const PipelineStageStatistics& stats);
+
+// The tasks, statistics and the first error of the stages
+class PipelineState final {
+ public:
+  explicit PipelineState(engine::TaskProcessor& task_processor);
+
+  PipelineState(PipelineState&&) = delete;
+  PipelineState& operator=(PipelineState&&) = delete;
+  // Cancels and waits for all the tasks
+  ~PipelineState();
+
+  // The stages are added from the last to the first one
+  PipelineStageStatistics& AddStage(
+      std::string name, std::function<std::size_t()> get_queue_size);
+
+  template <typename Func>
+  void StartTask(const std::string& name, Func&& func) {
+    tasks_.push_back(utils::Async(task_processor_, name,
+                                  std::forward<Func>(func)));
+  }
+
+  bool IsStopped() const noexcept {
+    return stopped_.load(std::memory_order_relaxed);
+  }
+
+  // Stores the first error and cancels all the stages. Is called only after
+  // all the tasks are started, as the stages get the elements only after the
+  // Pipeline is built.
+  void Fail(std::exception_ptr error) noexcept;
+
+  // Waits for all the tasks to finish, rethrows the first error
+  void Wait();
+
+  const std::deque<PipelineStageStatistics>& GetStages() const noexcept {
+    return stages_;
+  }
+
+ private:
+  engine::TaskProcessor& task_processor_;
+  std::atomic<bool> stopped_{false};
+  std::atomic<bool> failed_{false};
+  std::exception_ptr error_;
+  std::deque<PipelineStageStatistics> stages_;
+  std::vector<engine::TaskWithResult<void>> tasks_;
+};
+
+// Pops the batches of `In`, has them processed into the `Out` results by
+// `process(batch, results)` and pushes the results to the next stage
+template <typename In, typename Out, typename Process>
+void RunPipelineStage(
+    PipelineState& state, PipelineStageStatistics& stats,
+    const typename PipelineQueue<In>::MultiConsumer& consumer,
+    const std::optional<typename PipelineQueue<Out>::MultiProducer>& producer,
+    std::size_t max_batch_size, Process& process) {
+  std::vector<In> batch;
+  std::vector<Out> results;
+  while (!state.IsStopped()) {
+    const auto batch_size = consumer.PopMany(batch, max_batch_size);
+    if (batch_size == 0) return;
+
+    const auto start = std::chrono::steady_clock::now();
+    try {
+      process(batch, results);
+    } catch (const std::exception&) {
+      ++stats.errors;
+      state.Fail(std::current_exception());
+      return;
+    }
+    stats.Account(batch_size, std::chrono::steady_clock::now() - start);
+    batch.clear();
+
+    for (auto& result : results) {
+      // The next stages are stopped
+      if (!producer->Push(std::move(result))) return;
+    }
+    results.clear();
+  }
+}
+
+template <typename In, typename Out, typename Process>
+std::shared_ptr<PipelineQueue<In>> StartPipelineStage(
+    PipelineState& state, const PipelineStageSettings& settings,
+    std::shared_ptr<PipelineQueue<Out>> next_queue, Process process) {
+  auto queue = PipelineQueue<In>::Create(std::max<std::size_t>(
+      settings.queue_size, 1));
+  auto& stats = state.AddStage(
+      settings.name, [queue] { return queue->GetSizeApproximate(); });
+
+  const auto max_batch_size = std::max<std::size_t>(settings.max_batch_size, 1);
+  const auto parallelism = std::max<std::size_t>(settings.parallelism, 1);
+  for (std::size_t i = 0; i < parallelism; ++i) {
+    // The consumers and producers are created before the tasks start, so
+    // the queues never look dead to the neighbour stages prematurely
+    std::optional<typename PipelineQueue<Out>::MultiProducer> producer;
+    if (next_queue) producer.emplace(next_queue->GetMultiProducer());
+
+    state.StartTask(settings.name,
+                    [&state, &stats, consumer = queue->GetMultiConsumer(),
+                     producer = std::move(producer), max_batch_size,
+                     process]() mutable {
+                      RunPipelineStage<In, Out>(state, stats, consumer,
+                                                producer, max_batch_size,
+                                                process);
+                    });
+  }
+  return queue;
+}
+
+void DumpPipelineMetric(utils::statistics::Writer& writer,
+                        const PipelineState& state);
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief A chain of the stages that process a stream of elements
+/// concurrently, built by concurrent::PipelineBuilder
+///
+/// Each stage has a bounded queue of the incoming elements and
+/// PipelineStageSettings::parallelism tasks that process them, so the stages
+/// process different elements concurrently and a slow stage slows down the
+/// previous ones instead of accumulating the elements. The elements are not
+/// ordered between the stage tasks.
+///
+/// An exception in a stage stops the whole pipeline: all the stages are
+/// cancelled, the unprocessed elements are dropped and Finish() rethrows the
+/// exception. The destructor cancels the stages too.
+///
+/// The metrics of the stages are written with the `stage` label: counts of
+/// `items`, `batches` and `errors`, the `queue-size` and the histogram of
+/// the batch processing `timings-us`.
+///
+/// ## Example usage:
+///
+/// @snippet concurrent/pipeline_test.cpp  Sample concurrent::Pipeline usage
+template <typename Input>
+class Pipeline final {
+ public:
+  Pipeline(Pipeline&&) noexcept = default;
+  Pipeline& operator=(Pipeline&&) noexcept = default;
+
+  /// @brief Pushes the element to the first stage, waits while its queue is
+  /// full
+  /// @returns whether the push succeeded before the deadline, the pipeline is
+  /// stopped by an error and the first stage queue is never full otherwise
+  /// @warning Must not be called concurrently with Finish() or after it
+  [[nodiscard]] bool Push(Input&& value, engine::Deadline deadline = {}) {
+    UASSERT(producer_);
+    return producer_->Push(std::move(value), deadline);
+  }
+
+  /// @brief Marks the end of the input and waits for all the pushed elements
+  /// to pass all the stages
+  /// @throws the first exception thrown by the stages
+  /// @throws engine::WaitInterruptedException if the current task is
+  /// cancelled, the stages are cancelled by the destructor
+  void Finish() {
+    producer_.reset();
+    state_->Wait();
+  }
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const Pipeline& pipeline) {
+    impl::DumpPipelineMetric(writer, *pipeline.state_);
+  }
+
+ private:
+  template <typename, typename>
+  friend class PipelineBuilder;
+
+  Pipeline(std::unique_ptr<impl::PipelineState> state,
+           std::shared_ptr<impl::PipelineQueue<Input>> queue)
+      : state_(std::move(state)), producer_(queue->GetMultiProducer()) {}
+
+  std::unique_ptr<impl::PipelineState> state_;
+  std::optional<typename impl::PipelineQueue<Input>::MultiProducer> producer_;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Builds the concurrent::Pipeline from the stages, the `Output` of
+/// the previous stage is the input of the next one
+///
+/// Each of the PipelineStageSettings::parallelism tasks of a stage calls its
+/// own copy of the stage function, the copies are called concurrently. The
+/// stage tasks are started on the task processor passed to the constructor
+/// by Finally() or FinallyBatched().
+///
+/// @see concurrent::Pipeline
+template <typename Input, typename Output = Input>
+class PipelineBuilder final {
+  using StartStages =
+      std::function<std::shared_ptr<impl::PipelineQueue<Input>>(
+          impl::PipelineState&, std::shared_ptr<impl::PipelineQueue<Output>>)>;
+
+ public:
+  /// Starts building the pipeline that takes `Input` elements
+  explicit PipelineBuilder(engine::TaskProcessor& task_processor)
+      : task_processor_(task_processor),
+        start_stages_([](impl::PipelineState&,
+                         std::shared_ptr<impl::PipelineQueue<Output>> queue) {
+          return queue;
+        }) {
+    static_assert(std::is_same_v<Input, Output>,
+                  "The pipeline should be started with PipelineBuilder<T>");
+  }
+
+  /// Adds the stage that transforms each element with `func(Output&&)`
+  template <typename Func>
+  auto Then(PipelineStageSettings settings, Func func) && {
+    using Next = std::invoke_result_t<Func&, Output&&>;
+    return std::move(*this).template AddStage<Next>(
+        std::move(settings),
+        [func = std::move(func)](std::vector<Output>& batch,
+                                 std::vector<Next>& results) mutable {
+          for (auto& value : batch) results.push_back(func(std::move(value)));
+        });
+  }
+
+  /// @brief Adds the stage that transforms the batches of up to
+  /// PipelineStageSettings::max_batch_size elements with
+  /// `func(std::vector<Output>&&) -> std::vector<Next>`
+  ///
+  /// The stage may return any count of the elements, e.g. filter them out.
+  template <typename Func>
+  auto ThenBatched(PipelineStageSettings settings, Func func) && {
+    using Next =
+        typename std::invoke_result_t<Func&, std::vector<Output>&&>::value_type;
+    return std::move(*this).template AddStage<Next>(
+        std::move(settings),
+        [func = std::move(func)](std::vector<Output>& batch,
+                                 std::vector<Next>& results) mutable {
+          results = func(std::move(batch));
+        });
+  }
+
+  /// Adds the final stage that consumes each element with `func(Output&&)`
+  /// and starts the pipeline
+  template <typename Func>
+  Pipeline<Input> Finally(PipelineStageSettings settings, Func func) && {
+    return std::move(*this).Start(
+        settings, [func = std::move(func)](
+                      std::vector<Output>& batch,
+                      std::vector<impl::PipelineNoOutput>&) mutable {
+          for (auto& value : batch) func(std::move(value));
+        });
+  }
+
+  /// Adds the final stage that consumes the batches of up to
+  /// PipelineStageSettings::max_batch_size elements with
+  /// `func(std::vector<Output>&&)` and starts the pipeline
+  template <typename Func>
+  Pipeline<Input> FinallyBatched(PipelineStageSettings settings,
+                                 Func func) && {
+    return std::move(*this).Start(
+        settings, [func = std::move(func)](
+                      std::vector<Output>& batch,
+                      std::vector<impl::PipelineNoOutput>&) mutable {
+          func(std::move(batch));
+        });
+  }
+
+ private:
+  template <typename, typename>
+  friend class PipelineBuilder;
+
+  PipelineBuilder(engine::TaskProcessor& task_processor,
+                  StartStages start_stages)
+      : task_processor_(task_processor),
+        start_stages_(std::move(start_stages)) {}
+
+  template <typename Next, typename Process>
+  PipelineBuilder<Input, Next> AddStage(PipelineStageSettings settings,
+                                        Process process) && {
+    static_assert(!std::is_void_v<Next>,
+                  "Use Finally() for the stages without results");
+    return {task_processor_,
+            [start_previous = std::move(start_stages_),
+             settings = std::move(settings), process = std::move(process)](
+                impl::PipelineState& state,
+                std::shared_ptr<impl::PipelineQueue<Next>> next_queue) {
+              return start_previous(
+                  state, impl::StartPipelineStage<Output>(
+                             state, settings, std::move(next_queue), process));
+            }};
+  }
+
+  template <typename Process>
+  Pipeline<Input> Start(const PipelineStageSettings& settings,
+                        Process process) && {
+    auto state = std::make_unique<impl::PipelineState>(task_processor_);
+    using NoOutputQueue = impl::PipelineQueue<impl::PipelineNoOutput>;
+    auto queue = start_stages_(
+        *state, impl::StartPipelineStage<Output>(
+                    *state, settings, std::shared_ptr<NoOutputQueue>{},
+                    std::move(process)));
+    return Pipeline<Input>{std::move(state), std::move(queue)};
+  }
+
+  engine::TaskProcessor& task_processor_;
+  StartStages start_stages_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
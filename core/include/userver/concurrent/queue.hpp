@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -233,6 +236,29 @@ class GenericQueue final
     return consumer_side_.PopNoblock(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    if (values.empty()) return true;
+    return producer_side_.PushMany(token, std::move(values), deadline);
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (max_count == 0) return 0;
+    return consumer_side_.PopMany(token, values, max_count, deadline);
+  }
+
+  static std::size_t GetBatchSize(const std::vector<T>& values) {
+    std::size_t batch_size = 0;
+    for (const auto& value : values) {
+      batch_size += QueuePolicy::GetElementSize(value);
+    }
+    return batch_size;
+  }
+
   void PrepareProducer() {
     std::size_t old_producers_count{};
     utils::AtomicUpdate(producers_count_, [&](auto old_value) {
@@ -304,6 +330,28 @@ class GenericQueue final
     consumer_side_.OnElementPushed();
   }
 
+  // The capacity for the whole batch must be reserved by the caller
+  template <typename Token>
+  void DoPushMany(Token& token, std::vector<T>&& values) {
+    const std::size_t count = values.size();
+    const auto first = std::make_move_iterator(values.begin());
+
+    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, first, count);
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(first, count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_, first, count);
+    }
+    values.clear();
+
+    consumer_side_.OnElementsPushed(count);
+  }
+
   template <typename Token>
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     bool success{};
@@ -328,6 +376,39 @@ class GenericQueue final
     return false;
   }
 
+  // Appends up to `max_count` elements to `values`, releases their capacity
+  // at once
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const std::size_t old_size = values.size();
+    const auto out = std::back_inserter(values);
+    std::size_t count{};
+
+    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(token, out, max_count);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(out, max_count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk_from_producer(single_producer_token_, out,
+                                                    max_count);
+    }
+
+    if (count != 0) {
+      std::size_t released_capacity = 0;
+      for (std::size_t i = old_size; i < values.size(); ++i) {
+        released_capacity += QueuePolicy::GetElementSize(values[i]);
+      }
+      producer_side_.OnElementPopped(released_capacity);
+    }
+
+    return count;
+  }
+
   moodycamel::ConcurrentQueue<T> queue_{1};
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
@@ -368,6 +449,20 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return DoPush(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    const std::size_t batch_size = GetBatchSize(values);
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    while (!DoPushMany(token, std::move(values), batch_size)) {
+      if (queue_.NoMoreConsumers() ||
+          !non_full_event_.WaitForEventUntil(deadline)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -406,6 +501,20 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>&& values,
+                                std::size_t batch_size) {
+    if (queue_.NoMoreConsumers() ||
+        used_capacity_.load() + batch_size > total_capacity_.load()) {
+      return false;
+    }
+
+    used_capacity_.fetch_add(batch_size);
+    queue_.DoPushMany(token, std::move(values));
+    non_full_event_.Reset();
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -438,6 +547,24 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    const std::size_t batch_size = GetBatchSize(values);
+    UASSERT(batch_size > 0);
+    if (!remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                         batch_size)) {
+      return false;
+    }
+    if (queue_.NoMoreConsumers()) {
+      remaining_capacity_.unlock_shared_count(batch_size);
+      return false;
+    }
+
+    queue_.DoPushMany(token, std::move(values));
+    return true;
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -508,11 +635,31 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    std::size_t count{};
+    while ((count = DoPopMany(token, values, max_count)) == 0) {
+      if (queue_.NoMoreProducers() ||
+          !nonempty_event_.WaitForEventUntil(deadline)) {
+        // Same TOCTOU as in Pop
+        return DoPopMany(token, values, max_count);
+      }
+    }
+    return count;
+  }
+
   void OnElementPushed() {
     ++element_count_;
     nonempty_event_.Send();
   }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
+    nonempty_event_.Send();
+  }
+
   void StopBlockingOnPop() { nonempty_event_.Send(); }
 
   void ResumeBlockingOnPop() {}
@@ -530,6 +677,17 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const std::size_t count = queue_.DoPopMany(token, values, max_count);
+    if (count != 0) {
+      element_count_ -= count;
+      nonempty_event_.Reset();
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -561,8 +719,28 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
+  // Waits for a single element only, the rest of the batch is taken if it is
+  // already in the queue
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (!element_count_.try_lock_shared_until(deadline)) return 0;
+
+    std::size_t reserved = 1;
+    const std::size_t extra = std::min(max_count - 1, GetElementCount());
+    if (extra != 0 && element_count_.try_lock_shared_count(extra)) {
+      reserved += extra;
+    }
+    return DoPopMany(token, values, reserved);
+  }
+
   void OnElementPushed() { element_count_.unlock_shared(); }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
+
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
                                                kSemaphoreUnlockValue);
@@ -598,6 +776,23 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  // Pops exactly `reserved` elements unless the producers are dead
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t reserved) {
+    std::size_t count = 0;
+    while (true) {
+      count += queue_.DoPopMany(token, values, reserved - count);
+      if (count == reserved) {
+        return count;
+      }
+      if (queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(reserved - count);
+        return count;
+      }
+    }
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 
@@ -63,6 +65,21 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push all the elements of `values` into queue at once: the capacity is
+  /// reserved for the whole batch and the consumers are woken up once. May
+  /// wait asynchronously until the queue has enough room for the batch.
+  /// Leaves the `values` unmodified if the operation does not succeed, clears
+  /// them otherwise.
+  /// @returns whether push succeeded before the deadline and before the task
+  /// was canceled.
+  /// @warning The batch should fit into the max size of the queue, otherwise
+  /// it can never be pushed.
+  [[nodiscard]] bool PushMany(std::vector<ValueType>&& values,
+                              engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushMany(token_, std::move(values), deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -124,6 +141,18 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_count` elements from queue and append them to `values`,
+  /// the capacity of all the popped elements is released at once. May wait
+  /// asynchronously for the first element if the queue is empty, but the
+  /// producer is alive; never waits for the rest of the batch.
+  /// @returns the count of popped elements, `0` if nothing was popped before
+  /// the deadline or the producer is no longer alive.
+  [[nodiscard]] std::size_t PopMany(std::vector<ValueType>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline = {}) const {
+    return queue_->PopMany(token_, values, max_count, deadline);
+  }
+
   /// Const access to source queue.
   [[nodiscard]] std::shared_ptr<const QueueType> Queue() const {
     return {queue_};
@@ -0,0 +1,292 @@
+#pragma once
+
+/// @file userver/concurrent/striped_map.hpp
+/// @brief @copybrief concurrent::StripedMap
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+namespace impl {
+
+template <typename Mutex>
+using HasLockShared = decltype(std::declval<Mutex&>().lock_shared());
+
+// std::shared_lock for shared mutexes, std::unique_lock for the other ones
+template <typename Mutex>
+using ReadLock = std::conditional_t<meta::kIsDetected<HasLockShared, Mutex>,
+                                    std::shared_lock<Mutex>,
+                                    std::unique_lock<Mutex>>;
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+struct MapStripe final {
+  MapStripe(std::size_t stripe_size, const Hash& hash, const Equal& equal)
+      : map(stripe_size, hash, equal) {}
+
+  mutable Mutex mutex;
+  std::unordered_map<Key, Value, Hash, Equal> map;
+};
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief A hash map that is split into stripes, each stripe is an
+/// `std::unordered_map` protected with its own mutex.
+///
+/// The operations on keys from different stripes do not contend with each
+/// other, so the map scales with the number of writers much better than a
+/// single `concurrent::Variable<std::unordered_map>`. The default
+/// engine::SharedMutex allows concurrent readers within a stripe, for the
+/// write-heavy workloads (e.g. counters) engine::Mutex may be faster.
+///
+/// The values are never exposed outside of the critical section: they are
+/// either copied out, or a callback is invoked under the lock.
+///
+/// @warning The callbacks are invoked with the stripe locked, they must not
+/// access the same StripedMap, otherwise a deadlock is possible.
+///
+/// @note Can be used only from coroutines.
+///
+/// Example:
+/// @snippet src/concurrent/striped_map_test.cpp  Sample striped map usage
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>,
+          typename Mutex = engine::SharedMutex>
+class StripedMap final : Hash {
+ public:
+  static constexpr std::size_t kDefaultStripes = 37;
+
+  /// @param stripes the number of independently locked parts, should be
+  /// a few times larger than the number of concurrent writers
+  /// @param stripe_size the initial bucket count of each stripe
+  explicit StripedMap(std::size_t stripes = kDefaultStripes,
+                      std::size_t stripe_size = 0, const Hash& hash = Hash{},
+                      const Equal& equal = Equal{});
+
+  /// @returns a copy of the value, or `std::nullopt` if there's no such key
+  std::optional<Value> Get(const Key& key) const;
+
+  bool Contains(const Key& key) const;
+
+  /// @brief Inserts the value if there's no such key
+  /// @returns `true` if the value was inserted
+  bool Insert(Key key, Value value);
+
+  /// @brief Inserts the value or assigns it to the existing one
+  /// @returns `true` if the value was inserted
+  bool InsertOrAssign(Key key, Value value);
+
+  /// @brief Calls `func(Value&)` with the stripe locked, default-constructs
+  /// the value first if there's no such key
+  /// @returns whatever `func` returns
+  template <typename Func>
+  decltype(auto) Update(const Key& key, Func&& func);
+
+  /// @brief Calls `func(Value&)` with the stripe locked if there's such key
+  /// @returns `true` if the key was found
+  template <typename Func>
+  bool UpdateIfExists(const Key& key, Func&& func);
+
+  /// @returns `true` if the key was erased
+  bool Erase(const Key& key);
+
+  /// @brief Erases the elements for which `predicate(const Key&, Value&)`
+  /// returns `true`, locking the stripes one by one
+  /// @returns the count of erased elements
+  template <typename Predicate>
+  std::size_t EraseIf(Predicate predicate);
+
+  /// @brief Calls `func(const Key&, const Value&)` for each element, locking
+  /// the stripes one by one
+  /// @note The result is not a consistent snapshot of the whole map
+  template <typename Func>
+  void VisitAll(Func&& func) const;
+
+  /// @returns the count of the elements, locking the stripes one by one
+  std::size_t Size() const;
+
+  void Clear();
+
+ private:
+  using Stripe = impl::MapStripe<Key, Value, Hash, Equal, Mutex>;
+  using ReadLock = impl::ReadLock<Mutex>;
+  using WriteLock = std::unique_lock<Mutex>;
+
+  Stripe& GetStripe(const Key& key);
+  const Stripe& GetStripe(const Key& key) const;
+
+  utils::FixedArray<Stripe> stripes_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+StripedMap<Key, Value, Hash, Equal, Mutex>::StripedMap(std::size_t stripes,
+                                                       std::size_t stripe_size,
+                                                       const Hash& hash,
+                                                       const Equal& equal)
+    : Hash(hash), stripes_(stripes, stripe_size, hash, equal) {
+  UINVARIANT(stripes > 0, "StripedMap requires at least one stripe");
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+std::optional<Value> StripedMap<Key, Value, Hash, Equal, Mutex>::Get(
+    const Key& key) const {
+  const auto& stripe = GetStripe(key);
+  const ReadLock lock(stripe.mutex);
+  const auto it = stripe.map.find(key);
+  if (it == stripe.map.end()) return std::nullopt;
+  return it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+bool StripedMap<Key, Value, Hash, Equal, Mutex>::Contains(
+    const Key& key) const {
+  const auto& stripe = GetStripe(key);
+  const ReadLock lock(stripe.mutex);
+  return stripe.map.count(key) != 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+bool StripedMap<Key, Value, Hash, Equal, Mutex>::Insert(Key key, Value value) {
+  auto& stripe = GetStripe(key);
+  const WriteLock lock(stripe.mutex);
+  return stripe.map.try_emplace(std::move(key), std::move(value)).second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+bool StripedMap<Key, Value, Hash, Equal, Mutex>::InsertOrAssign(Key key,
+                                                                Value value) {
+  auto& stripe = GetStripe(key);
+  const WriteLock lock(stripe.mutex);
+  return stripe.map.insert_or_assign(std::move(key), std::move(value)).second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+template <typename Func>
+decltype(auto) StripedMap<Key, Value, Hash, Equal, Mutex>::Update(
+    const Key& key, Func&& func) {
+  auto& stripe = GetStripe(key);
+  const WriteLock lock(stripe.mutex);
+  return std::forward<Func>(func)(stripe.map[key]);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+template <typename Func>
+bool StripedMap<Key, Value, Hash, Equal, Mutex>::UpdateIfExists(const Key& key,
+                                                                Func&& func) {
+  auto& stripe = GetStripe(key);
+  const WriteLock lock(stripe.mutex);
+  const auto it = stripe.map.find(key);
+  if (it == stripe.map.end()) return false;
+  std::forward<Func>(func)(it->second);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+bool StripedMap<Key, Value, Hash, Equal, Mutex>::Erase(const Key& key) {
+  auto& stripe = GetStripe(key);
+  WriteLock lock(stripe.mutex);
+  auto node = stripe.map.extract(key);
+  lock.unlock();
+
+  // The value is destroyed outside of the critical section
+  return !node.empty();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+template <typename Predicate>
+std::size_t StripedMap<Key, Value, Hash, Equal, Mutex>::EraseIf(
+    Predicate predicate) {
+  std::size_t erased = 0;
+  for (auto& stripe : stripes_) {
+    const WriteLock lock(stripe.mutex);
+    for (auto it = stripe.map.begin(); it != stripe.map.end();) {
+      if (predicate(std::as_const(it->first), it->second)) {
+        it = stripe.map.erase(it);
+        ++erased;
+      } else {
+        ++it;
+      }
+    }
+  }
+  return erased;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+template <typename Func>
+void StripedMap<Key, Value, Hash, Equal, Mutex>::VisitAll(Func&& func) const {
+  for (const auto& stripe : stripes_) {
+    const ReadLock lock(stripe.mutex);
+    for (const auto& [key, value] : stripe.map) {
+      func(key, value);
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+std::size_t StripedMap<Key, Value, Hash, Equal, Mutex>::Size() const {
+  std::size_t size = 0;
+  for (const auto& stripe : stripes_) {
+    const ReadLock lock(stripe.mutex);
+    size += stripe.map.size();
+  }
+  return size;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+void StripedMap<Key, Value, Hash, Equal, Mutex>::Clear() {
+  for (auto& stripe : stripes_) {
+    std::unordered_map<Key, Value, Hash, Equal> old_map(
+        0, stripe.map.hash_function(), stripe.map.key_eq());
+    {
+      const WriteLock lock(stripe.mutex);
+      old_map.swap(stripe.map);
+    }
+    // old_map is destroyed outside of the critical section
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+auto StripedMap<Key, Value, Hash, Equal, Mutex>::GetStripe(const Key& key)
+    -> Stripe& {
+  return stripes_[Hash::operator()(key) % stripes_.size()];
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal,
+          typename Mutex>
+auto StripedMap<Key, Value, Hash, Equal, Mutex>::GetStripe(
+    const Key& key) const -> const Stripe& {
+  return stripes_[Hash::operator()(key) % stripes_.size()];
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
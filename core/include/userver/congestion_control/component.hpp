@@ -29,6 +29,14 @@ namespace congestion_control {
 /// min-cpu | force fake-mode if the current cpu number is less than the specified value | 1
 /// only-rtc | if set to true and hostinfo::IsInRtc() returns false then forces the fake-mode | true
 /// status-code | HTTP status code for ratelimited responses | 429
+/// tenants.client-header | header identifying the client of a request | X-YaService-Name
+/// tenants.default-weight | share of the requests of the other clients and handlers | 1
+/// tenants.items | list of tenants with `name`, `clients`, `handlers`, `weight` and `low-priority` options | -
+///
+/// With `tenants` set, the RPS limit is split between the tenants by their
+/// weights. A request belongs to the tenant listing its client header value,
+/// or its handler component name. Tenants use the unused shares of the others,
+/// except for the `low-priority` ones, so they are throttled first.
 ///
 /// ## Static configuration example:
 ///
@@ -59,7 +67,7 @@ class Component final : public components::LoggableComponentBase {
   void ExtendWriter(utils::statistics::Writer& writer);
 
   struct Impl;
-  utils::FastPimpl<Impl, 560, 8> pimpl_;
+  utils::FastPimpl<Impl, 1568, 8> pimpl_;
 };
 
 }  // namespace congestion_control
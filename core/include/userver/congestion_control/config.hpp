@@ -4,9 +4,12 @@
 /// @brief Congestion Control config structures
 
 #include <cstddef>
+#include <string>
+#include <vector>
 
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
+#include <userver/yaml_config/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -32,6 +35,40 @@ struct Policy {
 
 Policy Parse(const formats::json::Value& policy, formats::parse::To<Policy>);
 
+/// A group of clients and handlers sharing a part of the RPS limit
+struct Tenant {
+  std::string name;
+
+  /// Values of the client identity header belonging to the tenant
+  std::vector<std::string> clients;
+
+  /// Names of the handler components belonging to the tenant
+  std::vector<std::string> handlers;
+
+  /// Share of the RPS limit relative to the other tenants
+  double weight{1};
+
+  /// Low priority tenants can not use the unused shares of the other tenants,
+  /// so they are throttled first
+  bool is_low_priority{false};
+};
+
+/// Splitting of the RPS limit between the tenants
+struct TenantsConfig {
+  /// Header identifying the client of a request
+  std::string client_header{"X-YaService-Name"};
+
+  /// Weight of the requests not matching any of the tenants
+  double default_weight{1};
+
+  std::vector<Tenant> tenants;
+};
+
+Tenant Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tenant>);
+
+TenantsConfig Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TenantsConfig>);
+
 namespace impl {
 
 struct RpsCcConfig {
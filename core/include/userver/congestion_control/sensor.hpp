@@ -16,6 +16,9 @@ class Sensor {
     std::uint64_t current_load{0};
     std::uint64_t overload_events_count{0};
     std::uint64_t no_overload_events_count{0};
+    /// 99th percentile of the task queue wait time since the previous fetch,
+    /// an early signal of the CPU saturation. Zero if not measured.
+    std::chrono::microseconds queue_wait_p99{0};
     std::chrono::steady_clock::time_point tp;
 
     double GetLoadPercent() const;
@@ -4,7 +4,9 @@
 /// @brief @copybrief dist_lock::DistLockStrategyBase
 
 #include <chrono>
+#include <cstdint>
 #include <exception>
+#include <optional>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,6 +16,15 @@ namespace dist_lock {
 /// Indicates that lock cannot be acquired because it's busy.
 class LockIsAcquiredByAnotherHostException : public std::exception {};
 
+/// @brief Fencing token of a distributed lock
+///
+/// The token of every successful acquisition or prolongation of the lock is
+/// greater than the tokens of all the previous ones, including those made by
+/// other hosts. Pass it along with the writes to a storage protected by the
+/// lock, so that the storage could reject the writes of a previous lock
+/// holder, who may still be running after losing the lock.
+using FencingToken = std::int64_t;
+
 /// @ingroup userver_base_classes userver_concurrency
 ///
 /// @brief Interface for distributed lock strategies
@@ -35,6 +46,17 @@ class DistLockStrategyBase {
   virtual void Acquire(std::chrono::milliseconds lock_ttl,
                        const std::string& locker_id) = 0;
 
+  /// Acquires the distributed lock and returns its fencing token.
+  ///
+  /// Default implementation calls Acquire() and returns std::nullopt, meaning
+  /// that the strategy does not support fencing tokens.
+  /// @throws same as Acquire()
+  virtual std::optional<FencingToken> AcquireWithFencingToken(
+      std::chrono::milliseconds lock_ttl, const std::string& locker_id) {
+    Acquire(lock_ttl, locker_id);
+    return std::nullopt;
+  }
+
   /// Releases the lock.
   ///
   /// @param locker_id Globally unique ID of the locking entity, must be the
@@ -75,6 +75,11 @@ class DistLockedWorker final {
   /// may be less than the real duration.
   std::optional<std::chrono::steady_clock::duration> GetLockedDuration() const;
 
+  /// Returns the fencing token of the last prolongation of the lock, if the
+  /// lock is held and the strategy supports fencing tokens. Call it from the
+  /// worker func right before the write that the lock protects.
+  std::optional<FencingToken> GetFencingToken() const;
+
   /// Returns lock acquisition statistics.
   const Statistics& GetStatistics() const;
 
@@ -32,6 +32,7 @@ class Decimal;
 
 namespace formats::json {
 class Value;
+class CompactValue;
 }  // namespace formats::json
 
 namespace dump {
@@ -227,6 +228,13 @@ void Write(Writer& writer, const formats::json::Value& value);
 /// @brief formats::json::Value deserialization support
 formats::json::Value Read(Reader& reader, To<formats::json::Value>);
 
+/// @brief formats::json::CompactValue serialization support
+void Write(Writer& writer, const formats::json::CompactValue& value);
+
+/// @brief formats::json::CompactValue deserialization support
+formats::json::CompactValue Read(Reader& reader,
+                                 To<formats::json::CompactValue>);
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
@@ -2,7 +2,8 @@
 
 /// @file userver/dump/common_containers.hpp
 /// @brief Dump support for C++ Standard Library and Boost containers,
-/// `std::optional`, utils::StrongTypedef, `std::{unique,shared}_ptr`
+/// `std::optional`, utils::StrongTypedef, `std::{unique,shared}_ptr`,
+/// utils::BlockedBloomFilter
 ///
 /// @note There are no traits in `CachingComponentBase`. If `T`
 /// is writable/readable, we have to generate the code for dumps
@@ -12,10 +13,12 @@
 /// @ingroup userver_dump_read_write
 
 #include <cstddef>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <string_view>
 #include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
@@ -24,6 +27,7 @@
 #include <variant>
 #include <vector>
 
+#include <userver/utils/fixed_array.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/strong_typedef.hpp>
@@ -32,6 +36,7 @@
 #include <userver/dump/meta.hpp>
 #include <userver/dump/meta_containers.hpp>
 #include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
 
 /// @cond
 namespace boost {
@@ -59,6 +64,11 @@ using multi_index::multi_index_container;
 
 USERVER_NAMESPACE_BEGIN
 
+namespace utils {
+template <typename T, typename Hash>
+class BlockedBloomFilter;
+}  // namespace utils
+
 namespace dump {
 
 namespace impl {
@@ -290,6 +300,34 @@ Read(Reader& reader, To<boost::multi_index_container<T, Index, Alloc>>) {
   return container;
 }
 
+/// @brief utils::BlockedBloomFilter serialization support
+/// @warning The dump is only valid for the same hash function
+template <typename T, typename Hash>
+void Write(Writer& writer, const utils::BlockedBloomFilter<T, Hash>& filter) {
+  const auto& blocks = filter.GetBlocks();
+  writer.Write(blocks.size());
+  // TODO: endianness
+  WriteStringViewUnsafe(
+      writer, std::string_view{reinterpret_cast<const char*>(blocks.data()),
+                               blocks.size() * sizeof(blocks[0])});
+}
+
+/// @brief utils::BlockedBloomFilter deserialization support
+template <typename T, typename Hash>
+utils::BlockedBloomFilter<T, Hash> Read(
+    Reader& reader, To<utils::BlockedBloomFilter<T, Hash>>) {
+  using Filter = utils::BlockedBloomFilter<T, Hash>;
+  using Block = typename Filter::Block;
+
+  const auto size = reader.Read<std::size_t>();
+  if (size == 0) throw Error("A BlockedBloomFilter must have blocks");
+
+  utils::FixedArray<Block> blocks(size);
+  const auto bytes = ReadStringViewUnsafe(reader, size * sizeof(Block));
+  std::memcpy(blocks.data(), bytes.data(), bytes.size());
+  return Filter::FromBlocks(std::move(blocks));
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
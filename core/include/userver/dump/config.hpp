@@ -45,6 +45,9 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool use_mmap;
+  bool dump_is_compressed;
+  uint64_t compression_tasks;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
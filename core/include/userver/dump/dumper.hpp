@@ -85,8 +85,12 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `mmap` | `boolean` | Whether to read the dumps with dump::MmapFileReader, not supported for the encrypted dumps | `false`
+/// `compressed` | `boolean` | Whether to compress the dump by chunks with zlib, see dump::CompressedWriter. Not supported for the encrypted dumps and `mmap` | `false`
+/// `compression-tasks` | `integer` | Number of tasks that compress or decompress the chunks of a compressed dump concurrently with the serialization | `2`
 /// `first-update-mode` | `string` | specifies whether required or best-effort first update will be used | skip
 /// `first-update-type` | `string` | specifies whether incremental and/or full first update will be used | full
+/// `load-in-background` | `boolean` | Whether to load the dump and perform the first update in background, while the service is already started. Not supported for `first-update-mode: required` | `false`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -168,7 +172,7 @@ class Dumper final {
          const components::ComponentContext& context, DumpableEntity& dumpable);
 
   class Impl;
-  utils::FastPimpl<Impl, 1056, 16> impl_;
+  utils::FastPimpl<Impl, 1072, 16> impl_;
 };
 
 }  // namespace dump
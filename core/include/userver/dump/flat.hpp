@@ -0,0 +1,118 @@
+#pragma once
+
+/// @file userver/dump/flat.hpp
+/// @brief Dumping support for flat types, that are dumped as raw memory
+///
+/// @ingroup userver_dump_read_write
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+template <typename T>
+struct IsDumpedFlat {};
+
+namespace impl {
+
+// Only the non-specialized IsDumpedFlat struct is defined,
+// the specializations are declared without a definition
+template <typename T>
+using IsNotDumpedFlat = decltype(sizeof(IsDumpedFlat<T>));
+
+template <typename T>
+constexpr bool IsDumpableFlat() {
+  if constexpr (!meta::kIsDetected<IsNotDumpedFlat, T>) {
+    static_assert(std::is_trivially_copyable_v<T> &&
+                      std::is_default_constructible_v<T>,
+                  "A type that was marked as flat with dump::IsDumpedFlat "
+                  "must be trivially copyable and default constructible");
+    return true;
+  } else {
+    return false;
+  }
+}
+
+// Limits the buffer of the readers that copy the data, e.g. dump::FileReader
+inline constexpr std::size_t kFlatReadChunkSize = 1 << 20;
+
+}  // namespace impl
+
+/// @brief Flat types dumping support
+///
+/// The objects are dumped as raw memory, and an `std::vector` of flat objects
+/// is dumped as a single block of memory. Loading such a vector performs no
+/// per-element parsing, and together with dump::MmapFileReader it is a plain
+/// copy from the page cache.
+///
+/// To enable dumps and loads for a trivially copyable type, add in the global
+/// namespace:
+///
+/// @code
+/// template <>
+/// struct dump::IsDumpedFlat<MyStruct>;
+/// @endcode
+///
+/// @warning The dumps of flat types depend on the memory layout of the type and
+/// the endianness of the platform. Don't forget to increment format-version if
+/// the layout changes, and don't mark the types with pointers as flat.
+template <typename T>
+std::enable_if_t<impl::IsDumpableFlat<T>()> Write(Writer& writer,
+                                                  const T& value) {
+  impl::WriteTrivial(writer, value);
+}
+
+/// @brief Flat types deserialization from dump support
+template <typename T>
+std::enable_if_t<impl::IsDumpableFlat<T>(), T> Read(Reader& reader, To<T>) {
+  return impl::ReadTrivial<T>(reader);
+}
+
+/// @brief `std::vector` of flat types serialization support
+template <typename T, typename Allocator>
+std::enable_if_t<impl::IsDumpableFlat<T>()> Write(
+    Writer& writer, const std::vector<T, Allocator>& value) {
+  writer.Write(value.size());
+  WriteStringViewUnsafe(
+      writer, std::string_view{reinterpret_cast<const char*>(value.data()),
+                               value.size() * sizeof(T)});
+}
+
+/// @brief `std::vector` of flat types deserialization support
+template <typename T, typename Allocator>
+std::enable_if_t<impl::IsDumpableFlat<T>(), std::vector<T, Allocator>> Read(
+    Reader& reader, To<std::vector<T, Allocator>>) {
+  const auto size = reader.Read<std::size_t>();
+  if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+    throw Error(fmt::format("Too many flat elements in the dump: size={}",
+                            size));
+  }
+
+  std::vector<T, Allocator> result(size);
+  auto* const data = reinterpret_cast<char*>(result.data());
+  const auto bytes = size * sizeof(T);
+  for (std::size_t offset = 0; offset < bytes;) {
+    const auto chunk = ReadStringViewUnsafe(
+        reader, std::min(impl::kFlatReadChunkSize, bytes - offset));
+    chunk.copy(data + offset, chunk.size());
+    offset += chunk.size();
+  }
+  return result;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
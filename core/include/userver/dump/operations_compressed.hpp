@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A handle to a compressed dump file. File operations block the
+/// thread.
+///
+/// The data is split into chunks, each chunk is compressed with zlib and
+/// stored with its checksum. Up to `tasks_count` chunks are compressed
+/// concurrently in separate tasks, while the caller serializes the next ones.
+class CompressedWriter final : public Writer {
+ public:
+  /// @brief Creates a new dump file and opens it
+  /// @throws `Error` on a filesystem error
+  CompressedWriter(std::string path, boost::filesystem::perms perms,
+                   tracing::ScopeTime& scope, std::size_t tasks_count);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief A handle to a compressed dump file. File operations block the
+/// thread.
+///
+/// Up to `tasks_count` chunks are read ahead and decompressed concurrently in
+/// separate tasks, while the caller deserializes the previous ones.
+class CompressedReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file
+  /// @throws `Error` on a filesystem error
+  CompressedReader(std::string path, std::size_t tasks_count);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  CompressedOperationsFactory(boost::filesystem::perms perms,
+                              std::size_t tasks_count);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+  const std::size_t tasks_count_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
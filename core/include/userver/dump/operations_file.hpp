@@ -54,7 +54,9 @@ class FileReader final : public Reader {
 
 class FileOperationsFactory final : public OperationsFactory {
  public:
-  explicit FileOperationsFactory(boost::filesystem::perms perms);
+  /// @param use_mmap whether to read the dumps with dump::MmapFileReader
+  explicit FileOperationsFactory(boost::filesystem::perms perms,
+                                 bool use_mmap = false);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +65,7 @@ class FileOperationsFactory final : public OperationsFactory {
 
  private:
   const boost::filesystem::perms perms_;
+  const bool use_mmap_;
 };
 
 }  // namespace dump
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A handle to a dump file, that is mapped into memory
+///
+/// Unlike dump::FileReader, the data is not copied into an intermediate
+/// buffer, `ReadRaw` returns the views into the mapping. The returned views
+/// stay valid until the reader is destroyed. The pages of the file are loaded
+/// lazily by the OS on the first access, the mapping is advised for the
+/// sequential access.
+class MmapFileReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file and maps it into memory
+  /// @throws `Error` on a filesystem error
+  explicit MmapFileReader(std::string path);
+
+  MmapFileReader(MmapFileReader&&) = delete;
+  MmapFileReader& operator=(MmapFileReader&&) = delete;
+  ~MmapFileReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string path_;
+  const char* data_{nullptr};
+  std::size_t size_{0};
+  std::size_t position_{0};
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -3,9 +3,12 @@
 #include <any>
 #include <cstddef>
 #include <exception>
+#include <memory>
+#include <string>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_set>
 #include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
@@ -33,12 +36,17 @@ T ParseByConstructor(const DocsMap& docs_map) {
 
 using ConfigId = std::size_t;
 
-ConfigId Register(Factory factory);
+ConfigId Register(Factory factory, std::type_index key_type);
 
 // Automatically registers all used config types at startup and assigns them
 // sequential ids
 template <typename Key>
-inline const ConfigId kConfigId = Register(&FactoryFor<Key>);
+inline const ConfigId kConfigId = Register(&FactoryFor<Key>, typeid(Key));
+
+enum class ParseMode {
+  kEager,  ///< all the configs are parsed when the snapshot is built
+  kLazy,   ///< each config is parsed on the first access to it
+};
 
 class SnapshotData final {
  public:
@@ -51,6 +59,12 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  /// Parses only the configs that read any of `changed_names`, the rest of
+  /// the parsed configs are shared with the `previous` snapshot
+  SnapshotData(const DocsMap& docs_map, const SnapshotData& previous,
+               const std::unordered_set<std::string>& changed_names,
+               ParseMode mode = ParseMode::kEager);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -67,9 +81,16 @@ class SnapshotData final {
   bool IsEmpty() const noexcept;
 
  private:
+  struct LazyDocs;
+  struct ParsedConfig;
+
+  static void ParseConfig(ConfigId id, const DocsMap& docs_map,
+                          ParsedConfig& config);
+  static void ParseLazily(ConfigId id, ParsedConfig& config);
+
   const std::any& Get(impl::ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  std::vector<std::shared_ptr<ParsedConfig>> user_configs_;
 };
 
 class StorageData;
@@ -223,10 +223,21 @@ class Source final {
     UASSERT(!current.GetData().IsEmpty());
     UASSERT(!previous.GetData().IsEmpty());
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+    const bool is_equal = (true && ... && IsEqual(previous, current, keys));
     return !is_equal;
   }
 
+  // Unchanged configs are shared between the snapshots, no need to compare
+  // their contents
+  template <typename Key>
+  static bool IsEqual(const Snapshot& previous, const Snapshot& current,
+                      Key key) {
+    const auto& previous_value = previous[key];
+    const auto& current_value = current[key];
+    return &previous_value == &current_value ||
+           previous_value == current_value;
+  }
+
   concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
       concurrent::FunctionId id, std::string_view name,
       SnapshotEventSource::Function&& func);
@@ -29,11 +29,18 @@ namespace components {
 /// ---- | ----------- | -------------
 /// fs-cache-path | path to the file to read and dump a config cache; set to empty string to disable reading and dumping configs to FS | -
 /// fs-task-processor | name of the task processor to run the blocking file write operations | -
+/// lazy-parsing | parse each config on the first access to it instead of parsing all the configs on each update | false
 ///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp  Sample dynamic config component config
 ///
+/// With `lazy-parsing` enabled the configs that are never read are not
+/// parsed at all, at the cost of reporting invalid config values on the
+/// first access to them rather than on the update. The count and the time
+/// of parsing per config key are then reported in `dynamic-config.parse`
+/// metrics.
+///
 /// ## Usage example:
 /// @snippet components/component_sample_test.cpp  Sample user component runtime config source
 
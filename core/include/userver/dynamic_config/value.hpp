@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -31,6 +32,10 @@ class DocsMap final {
   std::string AsJsonString() const;
   bool AreContentsEqual(const DocsMap& other) const;
 
+  /* Returns names of configs that differ from the ones in 'other' or that
+   * are present in only one of the maps */
+  std::unordered_set<std::string> GetChangedNames(const DocsMap& other) const;
+
   /// @cond
   // For internal use only
   // Set of configs expected to be used is automatically updated when
@@ -40,11 +45,30 @@ class DocsMap final {
 
   const utils::impl::TransparentSet<std::string>& GetConfigsExpectedToBeUsed(
       utils::InternalTag) const;
+
+  // For internal use only
+  // Names passed to 'Get' and 'Has' are appended to 'names' until the
+  // recording is stopped by passing nullptr.
+  void SetRequestedNamesRecorder(std::vector<std::string>* names,
+                                 utils::InternalTag) const;
   /// @endcond
 
  private:
+  // Copies of the map do not record into the same vector
+  class NamesRecorder final {
+   public:
+    NamesRecorder() = default;
+    NamesRecorder(const NamesRecorder&) noexcept {}
+    NamesRecorder& operator=(const NamesRecorder&) noexcept { return *this; }
+
+    std::vector<std::string>* names{nullptr};
+  };
+
+  void RecordRequestedName(std::string_view name) const;
+
   utils::impl::TransparentMap<std::string, formats::json::Value> docs_;
   mutable utils::impl::TransparentSet<std::string> configs_to_be_used_;
+  mutable NamesRecorder requested_names_;
 };
 
 template <typename T>
@@ -20,17 +20,30 @@ template <template <typename> typename TaskType, typename Function,
           typename... Args>
 [[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
                                       Task::Importance importance,
-                                      Deadline deadline, Function&& f,
+                                      Deadline deadline,
+                                      Task::Priority priority, Function&& f,
                                       Args&&... args) {
   using ResultType =
       typename utils::impl::WrappedCallImplType<Function, Args...>::ResultType;
   constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
 
   return TaskType<ResultType>{
-      MakeTask({task_processor, importance, kWaitMode, deadline},
+      MakeTask({task_processor, importance, kWaitMode, deadline, priority},
                std::forward<Function>(f), std::forward<Args>(args)...)};
 }
 
+template <template <typename> typename TaskType, typename Function,
+          typename... Args>
+[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
+                                      Task::Importance importance,
+                                      Deadline deadline, Function&& f,
+                                      Args&&... args) {
+  return MakeTaskWithResult<TaskType>(task_processor, importance, deadline,
+                                      Task::Priority::kNormal,
+                                      std::forward<Function>(f),
+                                      std::forward<Args>(args)...);
+}
+
 }  // namespace impl
 
 /// Runs an asynchronous function call using specified task processor
@@ -72,6 +85,18 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// Runs an asynchronous function call with the specified priority using
+/// specified task processor
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               Task::Priority priority, Function&& f,
+                               Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kNormal, {}, priority,
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// Runs an asynchronous function call using task processor of the caller
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(Function&& f, Args&&... args) {
@@ -0,0 +1,99 @@
+#pragma once
+
+/// @file userver/engine/flat_combiner.hpp
+/// @brief @copybrief engine::FlatCombiner
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include <userver/utils/result_store.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Executes the critical sections submitted by concurrent tasks one at
+/// a time, an engine::Mutex replacement for short heavily contended sections
+///
+/// A task that finds no one executing becomes the combiner and runs its own
+/// critical section along with all the sections submitted by other tasks in
+/// the meantime. The other tasks just wait for their section to complete. The
+/// protected data stays in the cache of the combiner's CPU and there is no
+/// lock handover between the tasks, which makes it scale much better than a
+/// mutex for counters, small maps and metric aggregations.
+///
+/// Critical sections are executed in the combiner's task, so they must be
+/// short, must not wait on engine primitives, must not rely on the
+/// task-local state of the submitter and must not call Execute of the same
+/// FlatCombiner. Under a constant load the combiner may keep executing the
+/// sections of others for a long time.
+///
+/// ## Example usage:
+///
+/// @snippet engine/flat_combiner_test.cpp  Sample engine::FlatCombiner usage
+///
+/// @see @ref md_en_userver_synchronization
+class FlatCombiner final {
+ public:
+  FlatCombiner();
+  ~FlatCombiner();
+
+  FlatCombiner(const FlatCombiner&) = delete;
+  FlatCombiner(FlatCombiner&&) = delete;
+  FlatCombiner& operator=(const FlatCombiner&) = delete;
+  FlatCombiner& operator=(FlatCombiner&&) = delete;
+
+  /// @brief Executes `func` exclusively with other sections of this combiner,
+  /// possibly in another task
+  /// @returns the result of `func`, rethrows the exception thrown by it
+  /// @note Waits non-cancellably for the section to complete
+  template <typename Func>
+  std::invoke_result_t<Func&> Execute(Func&& func);
+
+ private:
+  using Callback = void (*)(void* data) noexcept;
+
+  struct Impl;
+
+  void DoExecute(Callback callback, void* data) noexcept;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+template <typename Func>
+std::invoke_result_t<Func&> FlatCombiner::Execute(Func&& func) {
+  using Result = std::invoke_result_t<Func&>;
+  static_assert(!std::is_reference_v<Result>,
+                "References to the protected data must not leave the section");
+
+  struct Section final {
+    Func& func;
+    utils::ResultStore<Result> result;
+  };
+
+  Section section{func, {}};
+  DoExecute(
+      [](void* data) noexcept {
+        auto& section = *static_cast<Section*>(data);
+        try {
+          if constexpr (std::is_void_v<Result>) {
+            std::invoke(section.func);
+            section.result.SetValue();
+          } else {
+            section.result.SetValue(std::invoke(section.func));
+          }
+        } catch (...) {
+          section.result.SetException(std::current_exception());
+        }
+      },
+      &section);
+  return section.result.Retrieve();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -24,6 +24,7 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  Task::Priority priority{Task::Priority::kNormal};
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
@@ -37,9 +38,12 @@ void DeleteFusedTaskContext(std::byte* storage) noexcept;
 
 // The allocations for TaskContext and WrappedCall are manually fused. The
 // layout is as follows:
-// 1. TaskContext, guaranteed to be at the beginning of the allocation
+// 1. TaskContext, guaranteed to be at the beginning of the storage returned
+//    by AllocateFusedTaskContext
 // 2. WrappedCall
 //
+// The allocations of the dead tasks are recycled through thread-local caches.
+//
 // The whole allocation, as well as the lifetimes of the objects inside, are
 // managed by boost::intrusive_ptr<TaskContext> through intrusive_ptr_add_ref
 // and intrusive_ptr_release hooks.
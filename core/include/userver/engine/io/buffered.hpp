@@ -4,7 +4,10 @@
 /// @brief Buffered I/O wrappers
 
 #include <functional>
+#include <initializer_list>
+#include <memory>
 #include <string>
+#include <string_view>
 
 #include <userver/compiler/select.hpp>
 #include <userver/engine/deadline.hpp>
@@ -83,6 +86,90 @@ class BufferedReader final {
   utils::FastPimpl<impl::Buffer, kBufferSize, kBufferAlignment, true> buffer_;
 };
 
+/// @brief Wrapper for buffered output.
+///
+/// Small writes are coalesced in the buffer and are sent to the sink in one
+/// call when the buffer is full or on Flush(). Writes that do not fit into
+/// the buffer are sent directly after the buffered data. Data is not flushed
+/// on destruction.
+class BufferedWriter final {
+ public:
+  /// Creates a buffered writer with default buffer size.
+  explicit BufferedWriter(WritableBasePtr sink);
+
+  /// Creates a buffered writer with specified buffer size.
+  BufferedWriter(WritableBasePtr sink, size_t buffer_size);
+
+  ~BufferedWriter();
+
+  BufferedWriter(BufferedWriter&&) noexcept;
+  BufferedWriter& operator=(BufferedWriter&&) noexcept;
+
+  /// @brief Writes the data to the buffer, sends the buffer if it is full.
+  /// @throws IoException if the stream was closed by peer
+  void Write(const void* buf, size_t len, Deadline deadline = {});
+
+  /// @overload
+  void Write(std::string_view data, Deadline deadline = {});
+
+  /// @brief Writes all the spans in order, as if by a Write() for each.
+  void WriteAll(std::initializer_list<IoData> list, Deadline deadline = {});
+
+  /// @brief Sends the buffered data to the sink.
+  /// @note On timeout the data that was sent is removed from the buffer and
+  /// Flush() may be retried.
+  void Flush(Deadline deadline = {});
+
+  /// Number of bytes waiting for Flush().
+  size_t BufferedBytes() const { return buffer_.size(); }
+
+ private:
+  void Send(const void* buf, size_t len, Deadline deadline);
+
+  WritableBasePtr sink_;
+  size_t buffer_size_;
+  std::string buffer_;
+};
+
+/// @brief Full-duplex buffered stream over a Socket, TlsWrapper or any other
+/// RwBase.
+///
+/// Reader and writer are independent, one task may read while another writes
+/// if the underlying stream permits that. Written data is not flushed before
+/// reads, a request/response protocol should call Flush() explicitly.
+class BufferedStream final {
+ public:
+  /// Creates a buffered stream with default buffer sizes.
+  explicit BufferedStream(std::shared_ptr<RwBase> stream);
+
+  /// Creates a buffered stream with specified buffer sizes.
+  BufferedStream(std::shared_ptr<RwBase> stream, size_t read_buffer_size,
+                 size_t write_buffer_size);
+
+  /// Whether the underlying stream is valid.
+  bool IsValid() const { return reader_.IsValid(); }
+
+  BufferedReader& GetReader() { return reader_; }
+  BufferedWriter& GetWriter() { return writer_; }
+
+  /// @copydoc BufferedWriter::Write
+  void Write(std::string_view data, Deadline deadline = {}) {
+    writer_.Write(data, deadline);
+  }
+
+  /// @copydoc BufferedWriter::WriteAll
+  void WriteAll(std::initializer_list<IoData> list, Deadline deadline = {}) {
+    writer_.WriteAll(list, deadline);
+  }
+
+  /// @copydoc BufferedWriter::Flush
+  void Flush(Deadline deadline = {}) { writer_.Flush(deadline); }
+
+ private:
+  BufferedReader reader_;
+  BufferedWriter writer_;
+};
+
 }  // namespace engine::io
 
 USERVER_NAMESPACE_END
@@ -15,6 +15,12 @@ namespace engine::io {
 /// File descriptor of an invalid pipe end.
 static constexpr int kInvalidFd = -1;
 
+/// IoData for vector send
+struct IoData final {
+  const void* data;
+  size_t len;
+};
+
 /// @ingroup userver_base_classes
 ///
 /// Interface for readable streams
@@ -64,6 +70,7 @@ class RwBase : public ReadableBase, public WritableBase {
 };
 
 using ReadableBasePtr = std::shared_ptr<ReadableBase>;
+using WritableBasePtr = std::shared_ptr<WritableBase>;
 
 }  // namespace engine::io
 
@@ -28,12 +28,6 @@ enum class SocketType {
   kUdp = kDgram,
 };
 
-/// IoData for vector send
-struct IoData final {
-  const void* data;
-  size_t len;
-};
-
 /// @brief Socket representation.
 ///
 /// It is not thread-safe to concurrently read from socket. It is not
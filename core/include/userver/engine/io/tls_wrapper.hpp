@@ -3,7 +3,10 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/crypto/certificate.hpp>
@@ -12,11 +15,77 @@
 #include <userver/engine/io/common.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// Whether to offload TLS record processing into the kernel
+enum class KernelTls {
+  /// All the records are encrypted and decrypted by OpenSSL
+  kDisabled,
+
+  /// The records are encrypted by the kernel once the handshake is done
+  /// (Linux kTLS via OpenSSL 3 `SSL_OP_ENABLE_KTLS`), so that sending
+  /// becomes plain socket writes. Falls back to OpenSSL if either the kernel
+  /// or OpenSSL lacks the support or the cipher is not supported.
+  ///
+  /// @warning The kernel keeps encrypting the sent data after
+  /// TlsWrapper::StopTls, so the socket can't be used for plain data.
+  kSend,
+};
+
+/// @brief Session ticket keys shared by TLS servers, so that the clients
+/// could resume their sessions instead of doing a full handshake.
+///
+/// Each TlsWrapper server has its own SSL context, thus the session cache of
+/// OpenSSL never hits. Tickets encrypted with the shared keys are accepted by
+/// any server using the same TlsSessionTicketKeys, both for TLS 1.2 and 1.3.
+///
+/// The keys should be rotated periodically, e.g. from a secdist update
+/// subscription. Tickets issued with the previous key are still accepted
+/// and reissued with the current one, so a rotation does not force full
+/// handshakes.
+///
+/// Thread safe. Must outlive the servers using it.
+class TlsSessionTicketKeys final {
+ public:
+  /// Size of a key: 16 bytes of name, 32 bytes of HMAC secret and 32 bytes
+  /// of AES-256 key
+  static constexpr std::size_t kKeySize = 80;
+
+  /// Starts with a random key
+  TlsSessionTicketKeys();
+  ~TlsSessionTicketKeys();
+
+  TlsSessionTicketKeys(const TlsSessionTicketKeys&) = delete;
+  TlsSessionTicketKeys& operator=(const TlsSessionTicketKeys&) = delete;
+
+  /// @brief Makes `key` the one to issue the new tickets with, the current
+  /// key becomes the previous one.
+  /// @throws TlsException if `key` is not kKeySize bytes long
+  void Rotate(std::string_view key);
+
+  /// @brief Rotates to a random key
+  void RotateRandom();
+
+ private:
+  friend class TlsWrapper;
+
+  class Impl;
+  constexpr static size_t kSize = 192;
+  constexpr static size_t kAlignment = 8;
+  utils::FastPimpl<Impl, kSize, kAlignment> impl_;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const TlsSessionTicketKeys& keys);
+};
+
+/// Writes the counts of the full and resumed handshakes
+void DumpMetric(utils::statistics::Writer& writer,
+                const TlsSessionTicketKeys& keys);
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe.
@@ -28,13 +97,16 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// Starts a TLS client on an opened socket
   static TlsWrapper StartTlsClient(Socket&& socket,
                                    const std::string& server_name,
-                                   Deadline deadline);
+                                   Deadline deadline,
+                                   KernelTls kernel_tls = KernelTls::kDisabled);
 
   /// Starts a TLS server on an opened socket
   static TlsWrapper StartTlsServer(
       Socket&& socket, const crypto::Certificate& cert,
       const crypto::PrivateKey& key, Deadline deadline,
-      const std::vector<crypto::Certificate>& cert_authorities = {});
+      const std::vector<crypto::Certificate>& cert_authorities = {},
+      KernelTls kernel_tls = KernelTls::kDisabled,
+      TlsSessionTicketKeys* session_ticket_keys = nullptr);
 
   ~TlsWrapper() override;
 
@@ -47,6 +119,9 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// Whether the socket is valid.
   bool IsValid() const override;
 
+  /// Whether the sent records are encrypted by the kernel.
+  bool IsKernelTlsSendEnabled() const;
+
   /// Suspends current task until the socket has data available.
   [[nodiscard]] bool WaitReadable(Deadline) override;
 
@@ -0,0 +1,124 @@
+#pragma once
+
+/// @file userver/engine/read_mostly_shared_mutex.hpp
+/// @brief @copybrief engine::ReadMostlySharedMutex
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::SharedMutex replacement for the data that is read on each
+/// request and rarely modified
+///
+/// Readers increment a counter in their thread's own cache line and check the
+/// writer flag, so they do not contend with each other. A writer sets the flag
+/// and waits for the sum of the counters to become zero, yielding and then
+/// sleeping with an increasing pause up to 1ms. New readers wait for the writer
+/// to finish, so writers don't starve.
+///
+/// The lock is much more expensive for writers than engine::SharedMutex is,
+/// and the mutex occupies `utils::statistics::impl::kThreadShardCount + 1`
+/// cache lines.
+///
+/// ## Example usage:
+///
+/// @snippet engine/read_mostly_shared_mutex_test.cpp  Sample engine::ReadMostlySharedMutex usage
+///
+/// @see @ref md_en_userver_synchronization
+class ReadMostlySharedMutex final {
+ public:
+  ReadMostlySharedMutex();
+  ~ReadMostlySharedMutex();
+
+  ReadMostlySharedMutex(const ReadMostlySharedMutex&) = delete;
+  ReadMostlySharedMutex(ReadMostlySharedMutex&&) = delete;
+  ReadMostlySharedMutex& operator=(const ReadMostlySharedMutex&) = delete;
+  ReadMostlySharedMutex& operator=(ReadMostlySharedMutex&&) = delete;
+
+  void lock();
+  void unlock();
+
+  bool try_lock();
+
+  template <typename Rep, typename Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  template <typename Clock, typename Duration>
+  bool try_lock_until(const std::chrono::time_point<Clock, Duration>&);
+
+  bool try_lock_until(Deadline deadline);
+
+  void lock_shared();
+  void unlock_shared() noexcept;
+  bool try_lock_shared();
+
+  template <typename Rep, typename Period>
+  bool try_lock_shared_for(const std::chrono::duration<Rep, Period>&);
+
+  template <typename Clock, typename Duration>
+  bool try_lock_shared_until(const std::chrono::time_point<Clock, Duration>&);
+
+  bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  // A reader may unlock on another thread, so a counter of a shard may become
+  // negative, but the sum of the counters is the count of the readers
+  struct alignas(utils::statistics::impl::kThreadShardAlignment) Readers final {
+    std::atomic<std::int64_t> count{0};
+  };
+
+  std::atomic<std::int64_t>& GetLocalReaders() noexcept;
+  std::int64_t GetReadersCount() const noexcept;
+
+  bool WaitForNoReaders(Deadline deadline);
+  bool WaitForNoWriter(Deadline deadline);
+  void ReleaseWriter();
+
+  std::array<Readers, utils::statistics::impl::kThreadShardCount> readers_;
+
+  alignas(utils::statistics::impl::kThreadShardAlignment)
+      std::atomic<bool> has_writer_{false};
+  Mutex writers_mutex_;
+  Mutex no_writer_mutex_;
+  ConditionVariable no_writer_cv_;
+};
+
+template <typename Rep, typename Period>
+bool ReadMostlySharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool ReadMostlySharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool ReadMostlySharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool ReadMostlySharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,8 @@ struct TaskProcessorPoolsConfig final {
   std::string ev_thread_name = "ev";
   bool ev_default_loop_disabled = false;
   bool defer_events = true;
+  bool timer_wheel = false;
+  bool load_balancing = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
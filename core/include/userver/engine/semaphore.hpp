@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <shared_mutex>  // for std locks
 #include <stdexcept>
 
@@ -120,6 +121,8 @@ class CancellableSemaphore final {
   impl::FastPimplWaitList lock_waiters_;
   std::atomic<Counter> acquired_locks_;
   std::atomic<Counter> capacity_;
+  // Incremented by the releases that wake up the waiters
+  std::atomic<std::uint64_t> wakeup_epoch_{0};
 };
 
 /// @ingroup userver_concurrency
@@ -8,9 +8,11 @@
 #include <unordered_map>
 #include <vector>
 
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/environment_variables.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/flags.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,9 +24,38 @@ class ThreadControl;
 
 namespace subprocess {
 
+/// Standard streams of a child process, that may be connected to pipes
+enum class PipedStream {
+  kNone = 0,
+  kStdin = 1 << 0,
+  kStdout = 1 << 1,
+  kStderr = 1 << 2,
+};
+
+/// A child process and the parent ends of the pipes connected to its standard
+/// streams, see ProcessStarter::ExecWithPipes()
+struct PipedChildProcess final {
+  ChildProcess process;
+
+  /// Writes to stdin of the child, close it to send EOF
+  std::optional<io::PipeWriter> stdin_writer;
+
+  /// Reads stdout of the child
+  std::optional<io::PipeReader> stdout_reader;
+
+  /// Reads stderr of the child
+  std::optional<io::PipeReader> stderr_reader;
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
+///
+/// The subprocess is started with posix_spawn(), that does not copy the page
+/// tables of the parent process, so the start time does not depend on the
+/// memory usage of the service.
+///
+/// @throws std::system_error if the command can not be started
 class ProcessStarter {
  public:
   explicit ProcessStarter(TaskProcessor& task_processor);
@@ -46,6 +77,17 @@ class ProcessStarter {
       const std::optional<std::string>& stdout_file = std::nullopt,
       const std::optional<std::string>& stderr_file = std::nullopt);
 
+  /// @brief Connects the `streams` of the child to pipes, that can be read
+  /// and written by the current task while the child is running.
+  /// `env` redefines all environment variables.
+  ///
+  /// @warning Read the output of the child until EOF before waiting for the
+  /// child to terminate, otherwise it gets stuck on a full pipe.
+  PipedChildProcess ExecWithPipes(const std::string& command,
+                                  const std::vector<std::string>& args,
+                                  const EnvironmentVariables& env,
+                                  utils::Flags<PipedStream> streams);
+
   /// Exec subprocess using current environment.
   ChildProcess Exec(
       const std::string& command, const std::vector<std::string>& args,
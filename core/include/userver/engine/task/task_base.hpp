@@ -48,6 +48,28 @@ class [[nodiscard]] TaskBase {
     kCritical,
   };
 
+  /// @brief Task priority within its TaskProcessor
+  ///
+  /// Tasks of higher priorities are taken from the task queue first, but
+  /// each priority is guaranteed a share of the dequeues, so lower priority
+  /// tasks are delayed and not starved under overload. Priorities are only
+  /// honored by the `global` task queue, other queues treat all the tasks the
+  /// same.
+  ///
+  /// Unlike Importance, the priority does not affect the cancellation of the
+  /// task on TaskProcessor overload.
+  enum class Priority {
+    /// Tasks that must keep running under overload, e.g. health checks
+    kHigh,
+
+    /// Normal task
+    kNormal,
+
+    /// Tasks that may wait, e.g. data prefetching. The queue wait time of
+    /// background tasks is not used for TaskProcessor overload detection.
+    kBackground,
+  };
+
   /// Task state
   enum class State {
     kInvalid,    ///< Unusable
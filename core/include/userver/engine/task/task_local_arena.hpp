@@ -0,0 +1,86 @@
+#pragma once
+
+/// @file userver/engine/task/task_local_arena.hpp
+/// @brief @copybrief engine::TaskLocalArena
+
+#include <cstddef>
+#include <memory_resource>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskCounter;
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief A monotonic std::pmr::memory_resource, that frees all its memory
+/// at once on destruction
+///
+/// The allocations bump a pointer in the chunks of the arena and the
+/// deallocations do nothing, which makes the arena ideal for the temporary
+/// containers that die with the task. The chunks are recycled between the
+/// arenas through a global free list, so the arena of a typical task does not
+/// call malloc at all. Large allocations are served by `operator new` and are
+/// freed with the arena too.
+///
+/// TaskLocalArena::GetCurrent() returns the arena of the current task, that
+/// is destroyed when the task finishes. The arena must not be used by other
+/// tasks, unless they finish before the current one, and the memory must not
+/// outlive the task. The bytes used by the task arenas are reported in the
+/// task processor statistics.
+///
+/// ## Example usage:
+///
+/// @snippet engine/task/task_local_arena_test.cpp  Sample engine::TaskLocalArena usage
+class TaskLocalArena final : public std::pmr::memory_resource {
+ public:
+  /// @brief Returns the arena of the current task, creates it on the first
+  /// call in the task
+  /// @note The task-local variables that are initialized before the first
+  /// call must not use the arena, they outlive it.
+  static TaskLocalArena& GetCurrent();
+
+  /// Creates a standalone arena, prefer GetCurrent()
+  TaskLocalArena() noexcept;
+
+  TaskLocalArena(const TaskLocalArena&) = delete;
+  TaskLocalArena& operator=(const TaskLocalArena&) = delete;
+  ~TaskLocalArena() override;
+
+  /// Sum of the sizes of all the allocations from the arena
+  std::size_t GetUsedBytes() const noexcept { return used_bytes_; }
+
+  /// Memory held by the arena, including the chunks overhead
+  std::size_t GetReservedBytes() const noexcept { return reserved_bytes_; }
+
+ private:
+  struct ChunkHeader;
+  struct LargeHeader;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  void* TryBump(std::size_t bytes, std::size_t alignment) noexcept;
+  void* AllocateLarge(std::size_t bytes, std::size_t alignment);
+
+  std::byte* current_{nullptr};
+  std::byte* end_{nullptr};
+  ChunkHeader* chunks_{nullptr};
+  LargeHeader* large_allocations_{nullptr};
+  std::size_t used_bytes_{0};
+  std::size_t reserved_bytes_{0};
+  impl::TaskCounter* task_counter_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -15,6 +15,9 @@ namespace fs {
 ///
 /// @brief Class client for storing files in memory
 /// Usually retrieved from `components::FsCache`
+///
+/// The periodic update traverses the directory and rereads only the new files
+/// and the files with the changed size or modification time.
 class FsCacheClient final {
  public:
   /// @brief Fills the cache and starts periodic update
@@ -30,7 +33,7 @@ class FsCacheClient final {
   /// on FS
   FileInfoWithDataConstPtr TryGetFile(std::string_view path) const;
 
-  /// @brief Concurrency-safe cache update
+  /// @brief Concurrency-safe incremental cache update
   void UpdateCache();
 
  private:
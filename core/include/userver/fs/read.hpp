@@ -3,6 +3,7 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <ctime>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -20,6 +21,9 @@ struct FileInfoWithData {
   std::string data;
   std::string extension;
   size_t size;
+  /// Modification time of the file when it was read, 0 if the file could have
+  /// been modified after the read without a change of this time
+  std::time_t last_write_time{0};
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -43,6 +47,20 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp, const std::string& path,
     utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden});
 
+/// @brief Returns files from recursively traversed directory, rereads only the
+/// files that are new or were modified since they were read into `previous`
+/// @param async_tp TaskProcessor to traverse the directory and read the files
+/// @param path to directory to traverse recursively
+/// @param flags settings read files
+/// @param previous result of the previous traversal of the same directory
+/// @returns map with relative to `path` filepaths and file info, the unchanged
+/// files share the data with `previous`
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    utils::Flags<SettingsReadFile> flags, const FileInfoWithDataMap& previous);
+
 /// @brief Reads file contents asynchronously
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
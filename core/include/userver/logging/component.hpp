@@ -45,12 +45,13 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `raw` or `binary` (see tools/log_decoder) | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
+/// batched-writes | if exists, the records are written to the file in large batches, see the options below | {}
 ///
 /// ### Logs output
 /// You can specify logger output, in `file_path` option:
@@ -66,6 +67,16 @@ namespace components {
 /// host | testsuite hostname, e.g. localhost | -
 /// port | testsuite port | -
 ///
+/// ### batched-writes options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// buffer_size | size of the buffer to collect the records in, records that do not fit are written together with the buffer | 1048576
+/// direct_io | write the file with O_DIRECT bypassing the page cache, the file must not be written by anyone else | false
+/// fdatasync_on_flush | call fdatasync on each flush of the logger | false
+///
+/// The write statistics of such loggers are reported in the `write` metrics
+/// of the `logger` statistics.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp Sample logging component config
@@ -4,8 +4,11 @@
 /// @brief Implementation of hazard pointer
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <list>
+#include <type_traits>
 #include <unordered_set>
 
 #include <userver/engine/async.hpp>
@@ -62,42 +65,140 @@ struct CachedData {
   uint64_t variable_epoch{0};
 };
 
+// Thread-local cache of hazard pointers is direct-mapped by the variable
+// address, so that a thread that reads several variables of the same type
+// (e.g. shards of rcu::ShardedRcuMap) does not thrash a single cache entry.
+inline constexpr std::size_t kHazardPointerCacheSize = 16;
+
+inline std::size_t GetHazardPointerCacheSlot(const void* variable) noexcept {
+  // Index of the cache line, so that the adjacent variables (e.g. elements of
+  // an array) get different slots
+  return (reinterpret_cast<std::uintptr_t>(variable) >> 6) %
+         kHazardPointerCacheSize;
+}
+
 template <typename T, typename RcuTraits>
-thread_local CachedData<T, RcuTraits> cache;
+thread_local CachedData<T, RcuTraits> cache[kHazardPointerCacheSize];
 
 uint64_t GetNextEpoch() noexcept;
 
 }  // namespace impl
 
+/// @brief Can be set as `RcuTraits::kReclamation` to select how the
+/// rcu::Variable detects that an old value is not used by readers anymore.
+enum class ReclamationType {
+  /// Every rcu::ReadablePtr is a hazard pointer of its rcu::Variable. A reader
+  /// reserves a hazard pointer record of the variable with a CAS, old values
+  /// are reclaimed as soon as no rcu::ReadablePtr references them.
+  kHazardPointers,
+
+  /// Readers pin a per-thread epoch record instead of a per-variable hazard
+  /// pointer, so rcu::Variable::Read() performs no writes to the memory shared
+  /// with other threads. Old values are reclaimed once all the readers that
+  /// started before their replacement finish.
+  /// @warning A single long-living rcu::ReadablePtr of any rcu::Variable with
+  /// this policy delays reclamation of old values of all such variables. Use
+  /// only for variables that are read often by short-living readers.
+  kEpoch,
+};
+
+namespace impl {
+
+template <typename RcuTraits, typename = void>
+inline constexpr ReclamationType kReclamationType =
+    ReclamationType::kHazardPointers;
+
+template <typename RcuTraits>
+inline constexpr ReclamationType kReclamationType<
+    RcuTraits, std::void_t<decltype(RcuTraits::kReclamation)>> =
+    RcuTraits::kReclamation;
+
+template <typename RcuTraits>
+inline constexpr bool kUseEpochReclamation =
+    kReclamationType<RcuTraits> == ReclamationType::kEpoch;
+
+// Per-thread record of the epoch-based reclamation. Records are never freed,
+// the record of an exited thread is reused by a new one.
+struct alignas(64) EpochRecord final {
+  // Global epoch observed by the first of the current readers of the record
+  std::atomic<std::uint64_t> epoch{0};
+  // Count of alive ReadablePtr that pinned the record. A ReadablePtr may be
+  // released from another thread if its coroutine has migrated.
+  std::atomic<std::uint64_t> readers{0};
+  std::atomic<bool> is_owned{false};
+  EpochRecord* next{nullptr};
+
+  // Must be called by the owning thread only, so that the epoch does not
+  // change while the record is used. A writer that sees the new epoch must
+  // also see that the previous readers of the record are done.
+  void Pin() noexcept {
+    if (readers.load(std::memory_order_relaxed) == 0) {
+      epoch.store(global_epoch.load(), std::memory_order_release);
+    }
+    readers.fetch_add(1);
+  }
+
+  // Marks this record as no longer used by a ReadablePtr
+  void Release() noexcept { readers.fetch_sub(1, std::memory_order_release); }
+
+  static inline std::atomic<std::uint64_t> global_epoch{1};
+};
+
+inline thread_local EpochRecord* this_thread_epoch_record{nullptr};
+
+EpochRecord& AcquireThisThreadEpochRecord();
+
+inline EpochRecord& PinThisThreadEpochRecord() {
+  auto* record = this_thread_epoch_record;
+  if (!record) record = &AcquireThisThreadEpochRecord();
+  record->Pin();
+  return *record;
+}
+
+// Returns the epoch of the values that are retired now
+inline std::uint64_t AdvanceGlobalEpoch() noexcept {
+  return EpochRecord::global_epoch.fetch_add(1);
+}
+
+// Values retired at epochs less than the result are not used by readers
+std::uint64_t GetMinPinnedEpoch() noexcept;
+
+}  // namespace impl
+
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `kReclamation` (optional) is a rcu::ReclamationType, hazard pointers are
+/// used by default
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
 };
 
+/// Rcu traits that select the rcu::ReclamationType::kEpoch reclamation
+template <typename T>
+struct EpochRcuTraits {
+  using MutexType = engine::Mutex;
+  static constexpr ReclamationType kReclamation = ReclamationType::kEpoch;
+};
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
 /// changed during ReadablePtr lifetime, it will not affect value referenced by
 /// ReadablePtr.
+///
+/// With rcu::ReclamationType::kEpoch a copy of ReadablePtr references the same
+/// value, otherwise it references the current value of the Variable.
 template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
- public:
-  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr)
-      : hp_record_(&ptr.MakeHazardPointer()) {
-    // This cycle guarantees that at the end of it both t_ptr_ and
-    // hp_record_->ptr will both be set to
-    // 1. something meaningful
-    // 2. and that this meaningful value was not removed between assigning to
-    //    t_ptr_ and storing  it in a hazard pointer
-    do {
-      t_ptr_ = ptr.GetCurrent();
+  using RecordType =
+      std::conditional_t<impl::kUseEpochReclamation<RcuTraits>,
+                         impl::EpochRecord,
+                         impl::HazardPointerRecord<T, RcuTraits>>;
 
-      hp_record_->ptr.store(t_ptr_);
-    } while (t_ptr_ != ptr.GetCurrent());
-  }
+ public:
+  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) { Init(ptr); }
 
   ReadablePtr(ReadablePtr<T, RcuTraits>&& other) noexcept
       : t_ptr_(other.t_ptr_), hp_record_(other.hp_record_) {
@@ -147,8 +248,16 @@ class [[nodiscard]] ReadablePtr final {
     return *this;
   }
 
-  ReadablePtr(const ReadablePtr<T, RcuTraits>& other)
-      : ReadablePtr(other.hp_record_->owner) {}
+  ReadablePtr(const ReadablePtr<T, RcuTraits>& other) {
+    if constexpr (impl::kUseEpochReclamation<RcuTraits>) {
+      // The record is pinned by `other`, so its epoch stays the same
+      hp_record_ = other.hp_record_;
+      hp_record_->readers.fetch_add(1);
+      t_ptr_ = other.t_ptr_;
+    } else {
+      Init(other.hp_record_->owner);
+    }
+  }
 
   ReadablePtr& operator=(const ReadablePtr<T, RcuTraits>& other) {
     if (this != &other) *this = ReadablePtr<T, RcuTraits>{other};
@@ -175,6 +284,27 @@ class [[nodiscard]] ReadablePtr final {
   const T& operator*() && { return *GetOnRvalue(); }
 
  private:
+  void Init(const Variable<T, RcuTraits>& ptr) {
+    if constexpr (impl::kUseEpochReclamation<RcuTraits>) {
+      // The pinned epoch is published before the value is loaded, so that
+      // writers either see the pin or have already replaced the value
+      hp_record_ = &impl::PinThisThreadEpochRecord();
+      t_ptr_ = ptr.GetCurrent();
+    } else {
+      hp_record_ = &ptr.MakeHazardPointer();
+      // This cycle guarantees that at the end of it both t_ptr_ and
+      // hp_record_->ptr will both be set to
+      // 1. something meaningful
+      // 2. and that this meaningful value was not removed between assigning
+      //    to t_ptr_ and storing  it in a hazard pointer
+      do {
+        t_ptr_ = ptr.GetCurrent();
+
+        hp_record_->ptr.store(t_ptr_);
+      } while (t_ptr_ != ptr.GetCurrent());
+    }
+  }
+
   const T* GetOnRvalue() {
     static_assert(!sizeof(T),
                   "Don't use temporary ReadablePtr, store it to a variable");
@@ -189,7 +319,8 @@ class [[nodiscard]] ReadablePtr final {
   // Invariant is this: if t_ptr_ is not nullptr, then hp_record_ is also
   // not nullptr and points to hazard pointer containing same T*.
   // Thus, if t_ptr_ is nullptr, then hp_record_ is undefined.
-  impl::HazardPointerRecord<T, RcuTraits>* hp_record_;
+  // With the epoch reclamation it is the pinned epoch record instead.
+  RecordType* hp_record_;
 };
 
 /// Smart pointer for rcu::Variable<T> for changing RCU value. It stores a
@@ -402,14 +533,19 @@ class Variable final {
       return;
     }
 
-    ScanRetiredList(CollectHazardPtrs(lock));
+    if constexpr (impl::kUseEpochReclamation<RcuTraits>) {
+      ScanRetiredList(impl::GetMinPinnedEpoch());
+    } else {
+      ScanRetiredList(CollectHazardPtrs(lock));
+    }
   }
 
  private:
   T* GetCurrent() const { return current_.load(); }
 
   impl::HazardPointerRecord<T, RcuTraits>* MakeHazardPointerCached() const {
-    auto& cache = impl::cache<T, RcuTraits>;
+    auto& cache = impl::cache<T, RcuTraits>[impl::GetHazardPointerCacheSlot(
+        this)];
     auto* hp = cache.hp;
     T* ptr = nullptr;
     if (hp && cache.variable == this && cache.variable_epoch == epoch_) {
@@ -447,7 +583,8 @@ class Variable final {
       // all buckets are full, create a new one
       if (!hp) hp = MakeHazardPointerSlow();
 
-      auto& cache = impl::cache<T, RcuTraits>;
+      auto& cache =
+          impl::cache<T, RcuTraits>[impl::GetHazardPointerCacheSlot(this)];
       cache.hp = hp;
       cache.variable = this;
       cache.variable_epoch = epoch_;
@@ -469,12 +606,20 @@ class Variable final {
 
   void Retire(std::unique_ptr<T> old_ptr, std::unique_lock<MutexType>& lock) {
     LOG_TRACE() << "Retiring ptr=" << old_ptr.get();
+    if constexpr (impl::kUseEpochReclamation<RcuTraits>) {
+      // Readers that pin the next epoch will not see old_ptr
+      const auto retire_epoch = impl::AdvanceGlobalEpoch();
+      retire_list_head_.push_back({std::move(old_ptr), retire_epoch});
+      ScanRetiredList(impl::GetMinPinnedEpoch());
+      return;
+    }
+
     auto hazard_ptrs = CollectHazardPtrs(lock);
 
     if (hazard_ptrs.count(old_ptr.get()) > 0) {
       // old_ptr is being used now, we may not delete it, delay deletion
       LOG_TRACE() << "Not retire, still used ptr=" << old_ptr.get();
-      retire_list_head_.push_back(std::move(old_ptr));
+      retire_list_head_.push_back({std::move(old_ptr), 0});
     } else {
       LOG_TRACE() << "Retire, not used ptr=" << old_ptr.get();
       DeleteAsync(std::move(old_ptr));
@@ -489,14 +634,24 @@ class Variable final {
     for (auto rit = retire_list_head_.begin();
          rit != retire_list_head_.end();) {
       auto current = rit++;
-      if (hazard_ptrs.count(current->get()) == 0) {
+      if (hazard_ptrs.count(current->ptr.get()) == 0) {
         // *current is not used by anyone, may delete it
-        DeleteAsync(std::move(*current));
+        DeleteAsync(std::move(current->ptr));
         retire_list_head_.erase(current);
       }
     }
   }
 
+  // Epoch reclamation: destroy the objects retired before all the readers
+  // that are still active have started
+  void ScanRetiredList(std::uint64_t min_pinned_epoch) {
+    while (!retire_list_head_.empty() &&
+           retire_list_head_.front().epoch < min_pinned_epoch) {
+      DeleteAsync(std::move(retire_list_head_.front().ptr));
+      retire_list_head_.pop_front();
+    }
+  }
+
   // Returns all T*, that have hazard ptr pointing at them. Occasionally nullptr
   // might be in result as well.
   std::unordered_set<T*> CollectHazardPtrs(std::unique_lock<MutexType>&) {
@@ -534,7 +689,12 @@ class Variable final {
   MutexType mutex_;  // for current_ changes and retire_list_head_ access
   // may be read without mutex_ locked, but must be changed with held mutex_
   std::atomic<T*> current_;
-  std::list<std::unique_ptr<T>> retire_list_head_;
+  struct RetiredPtr {
+    std::unique_ptr<T> ptr;
+    // used only with the epoch reclamation
+    std::uint64_t epoch;
+  };
+  std::list<RetiredPtr> retire_list_head_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 
   friend class ReadablePtr<T, RcuTraits>;
@@ -0,0 +1,344 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @brief Pointer to a value of rcu::ShardedRcuMap that does not own the
+/// value.
+///
+/// Holds a hazard pointer to the snapshot of the shard the value was found in,
+/// so obtaining and destroying it does not touch the reference counter of the
+/// value. The value is not freed while the pointer is alive, even if it is
+/// erased from the map.
+///
+/// @warning Do not keep the pointer for a long time: it prevents the whole
+/// snapshot of the shard from being freed. Use rcu::ShardedRcuMap::Get to
+/// obtain a shared ownership of the value.
+template <typename RawMap, typename RcuTraits, typename BorrowedValue>
+class [[nodiscard]] ShardedRcuMapBorrowedPtr final {
+ public:
+  /// Creates an empty pointer
+  ShardedRcuMapBorrowedPtr() = default;
+
+  explicit operator bool() const noexcept { return value_ != nullptr; }
+
+  BorrowedValue* Get() const& noexcept { return value_; }
+  BorrowedValue* Get() && { return GetOnRvalue(); }
+
+  BorrowedValue* operator->() const& {
+    UASSERT(value_);
+    return value_;
+  }
+  BorrowedValue* operator->() && { return GetOnRvalue(); }
+
+  BorrowedValue& operator*() const& {
+    UASSERT(value_);
+    return *value_;
+  }
+  BorrowedValue& operator*() && { return *GetOnRvalue(); }
+
+  /// @cond
+  /// For internal use only
+  ShardedRcuMapBorrowedPtr(ReadablePtr<RawMap, RcuTraits>&& snapshot,
+                           BorrowedValue* value)
+      : snapshot_(std::move(snapshot)), value_(value) {
+    UASSERT(value_);
+  }
+  /// @endcond
+
+ private:
+  BorrowedValue* GetOnRvalue() {
+    static_assert(!sizeof(BorrowedValue),
+                  "Don't use temporary ShardedRcuMapBorrowedPtr, store it to "
+                  "a variable");
+    std::abort();
+  }
+
+  std::optional<ReadablePtr<RawMap, RcuTraits>> snapshot_;
+  BorrowedValue* value_{nullptr};
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure allowing RCU keyset updates, that splits the keys
+/// into a number of independent rcu::Variable shards.
+///
+/// Compared to rcu::RcuMap:
+/// - a keyset change copies only a single shard, not the whole map;
+/// - Borrow() provides access to a value without touching its reference
+///   counter, so readers of the same hot key do not contend on a shared cache
+///   line.
+///
+/// Same as with rcu::RcuMap, only keyset changes are thread-safe.
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_rcu_map_test.cpp  Sample rcu::ShardedRcuMap usage
+///
+/// @see @ref md_en_userver_synchronization
+template <typename Key, typename Value,
+          typename RcuMapTraits = DefaultRcuMapTraits<Key, Value>>
+class ShardedRcuMap final {
+  using RcuTraits = typename impl::RcuTraitsFromRcuMapTraits<RcuMapTraits>;
+
+ public:
+  static_assert(!std::is_reference_v<Key>);
+  static_assert(!std::is_reference_v<Value>);
+  static_assert(!std::is_const_v<Key>);
+
+  using Hash = typename RcuMapTraits::Hash;
+  using KeyEqual = typename RcuMapTraits::KeyEqual;
+  using ValuePtr = std::shared_ptr<Value>;
+  using ConstValuePtr = std::shared_ptr<const Value>;
+  using RawMap = std::unordered_map<Key, ValuePtr, Hash, KeyEqual>;
+  using Snapshot = std::unordered_map<Key, ConstValuePtr, Hash, KeyEqual>;
+  using BorrowedPtr = ShardedRcuMapBorrowedPtr<RawMap, RcuTraits, Value>;
+  using ConstBorrowedPtr =
+      ShardedRcuMapBorrowedPtr<RawMap, RcuTraits, const Value>;
+  using InsertReturnType =
+      typename RcuMap<Key, Value, RcuMapTraits>::InsertReturnType;
+
+  static constexpr std::size_t kDefaultShardsCount = 8;
+
+  explicit ShardedRcuMap(std::size_t shards_count = kDefaultShardsCount);
+
+  ShardedRcuMap(const ShardedRcuMap&) = delete;
+  ShardedRcuMap(ShardedRcuMap&&) = delete;
+  ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+  ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+  std::size_t GetShardsCount() const noexcept { return shards_count_; }
+
+  /// Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const;
+
+  /// @brief Returns a non-owning readonly pointer to the value by its key or
+  /// an empty pointer, see rcu::ShardedRcuMapBorrowedPtr
+  ConstBorrowedPtr Borrow(const Key&) const;
+
+  /// @brief Returns a non-owning modifiable pointer to the value by its key or
+  /// an empty pointer, see rcu::ShardedRcuMapBorrowedPtr
+  BorrowedPtr Borrow(const Key&);
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  ConstValuePtr Get(const Key&) const;
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  ValuePtr Get(const Key&);
+
+  /// @brief Inserts a new element into the container if there is no element
+  /// with the key in the container.
+  /// @note Copies the shard of the key if the key doesn't exist.
+  InsertReturnType Insert(const Key& key, ValuePtr value);
+
+  /// @brief If a key equivalent to `key` already exists in the container, does
+  /// nothing. Otherwise, inserts a value constructed as
+  /// `std::make_shared<Value>(std::forward<Args>(args)...)`.
+  /// @note Copies the shard of the key if the key doesn't exist.
+  template <typename... Args>
+  InsertReturnType TryEmplace(const Key& key, Args&&... args);
+
+  /// @brief If a key equivalent to `key` already exists in the container,
+  /// replaces the associated value. Otherwise, inserts a new pair into the map.
+  /// @note Copies the shard of the key.
+  void InsertOrAssign(const Key& key, ValuePtr value);
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  /// @note Copies the shard of the key if the key exists.
+  bool Erase(const Key&);
+
+  /// Resets the map to an empty state
+  void Clear();
+
+  /// @brief Returns a readonly copy of the map
+  /// @note The shards are copied one by one, so the result is not guaranteed
+  /// to be a consistent snapshot of the whole map.
+  Snapshot GetSnapshot() const;
+
+ private:
+  // Protects the readers of a shard from the false sharing with the writers of
+  // the adjacent ones
+  struct alignas(64) Shard final {
+    Variable<RawMap, RcuTraits> map;
+  };
+
+  const Shard& GetShard(const Key& key) const;
+  Shard& GetShard(const Key& key);
+
+  template <typename BorrowedValue>
+  ShardedRcuMapBorrowedPtr<RawMap, RcuTraits, BorrowedValue> DoBorrow(
+      const Key& key) const;
+
+  const std::size_t shards_count_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+template <typename K, typename V, typename RcuMapTraits>
+ShardedRcuMap<K, V, RcuMapTraits>::ShardedRcuMap(std::size_t shards_count)
+    : shards_count_(shards_count),
+      shards_(std::make_unique<Shard[]>(shards_count)) {
+  UINVARIANT(shards_count_ > 0, "ShardedRcuMap requires at least one shard");
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t ShardedRcuMap<K, V, RcuMapTraits>::SizeApprox() const {
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < shards_count_; ++i) {
+    auto ptr = shards_[i].map.Read();
+    result += ptr->size();
+  }
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Borrow(const K& key) const
+    -> ConstBorrowedPtr {
+  return DoBorrow<const V>(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Borrow(const K& key) -> BorrowedPtr {
+  return DoBorrow<V>(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) const
+    -> ConstValuePtr {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return const_cast<ShardedRcuMap<K, V, RcuMapTraits>*>(this)->Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) -> ValuePtr {
+  auto snapshot = GetShard(key).map.Read();
+  auto it = snapshot->find(key);
+  if (it == snapshot->end()) return {};
+  return it->second;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::Insert(const K& key, ValuePtr value)
+    -> InsertReturnType {
+  InsertReturnType result{Get(key), false};
+  if (result.value) return result;
+
+  auto txn = GetShard(key).map.StartWrite();
+  auto insertion_result = txn->emplace(key, std::move(value));
+  result = {insertion_result.first->second, insertion_result.second};
+  if (result.inserted) txn.Commit();
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+auto ShardedRcuMap<K, V, RcuMapTraits>::TryEmplace(const K& key,
+                                                   Args&&... args)
+    -> InsertReturnType {
+  InsertReturnType result{Get(key), false};
+  if (!result.value) {
+    auto txn = GetShard(key).map.StartWrite();
+    auto insertion_result = txn->try_emplace(key, nullptr);
+    if (insertion_result.second) {
+      result.value = insertion_result.first->second =
+          std::make_shared<V>(std::forward<Args>(args)...);
+      txn.Commit();
+      result.inserted = true;
+    } else {
+      result.value = insertion_result.first->second;
+    }
+  }
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::InsertOrAssign(const K& key,
+                                                       ValuePtr value) {
+  auto txn = GetShard(key).map.StartWrite();
+  txn->insert_or_assign(key, std::move(value));
+  txn.Commit();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+bool ShardedRcuMap<K, V, RcuMapTraits>::Erase(const K& key) {
+  auto& shard = GetShard(key);
+  {
+    auto snapshot = shard.map.Read();
+    if (snapshot->find(key) == snapshot->end()) return false;
+  }
+
+  auto txn = shard.map.StartWrite();
+  if (txn->erase(key)) {
+    txn.Commit();
+    return true;
+  }
+  return false;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Clear() {
+  for (std::size_t i = 0; i < shards_count_; ++i) {
+    shards_[i].map.Assign({});
+  }
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetSnapshot() const -> Snapshot {
+  Snapshot result;
+  for (std::size_t i = 0; i < shards_count_; ++i) {
+    auto ptr = shards_[i].map.Read();
+    result.insert(ptr->begin(), ptr->end());
+  }
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetShard(const K& key) const
+    -> const Shard& {
+  // The maps of the shards use the same hash, so the hash is mixed to avoid
+  // the correlation between the shard index and the bucket index
+  const auto hash =
+      static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+  return shards_[(hash >> 32) % shards_count_];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetShard(const K& key) -> Shard& {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return const_cast<Shard&>(std::as_const(*this).GetShard(key));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename BorrowedValue>
+auto ShardedRcuMap<K, V, RcuMapTraits>::DoBorrow(const K& key) const
+    -> ShardedRcuMapBorrowedPtr<RawMap, RcuTraits, BorrowedValue> {
+  auto snapshot = GetShard(key).map.Read();
+  const auto it = snapshot->find(key);
+  if (it == snapshot->end() || !it->second) return {};
+
+  BorrowedValue* value = it->second.get();
+  return {std::move(snapshot), value};
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -68,9 +68,13 @@ namespace components {
 /// handler-defaults.parse_args_from_body | optional field to parse request according to x-www-form-urlencoded rules and make parameters accessible as query parameters | false
 /// handler-defaults.set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
-/// connection.requests_queue_size_threshold | drop requests from handlers that allow trottling if there's more pending requests than allowed by this value | 100
+/// connection.requests_queue_size_threshold | drop requests from handlers that allow trottling if there's more pending requests than allowed by this value; also the max count of pipelined requests of a connection that are handled concurrently, their responses are sent in the order of the requests | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
-/// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// connection.http2_enabled | accept HTTP/2 connections with prior knowledge (h2c) along with the HTTP/1.x ones | false
+/// connection.http2_max_concurrent_streams | max count of concurrent streams of a single HTTP/2 connection | 100
+/// connection.request_parser | HTTP/1.x request parser, 'http-parser' for the http_parser library or 'simd' for the parser that scans the request head with SSE2/AVX2/NEON | http-parser
+/// shards | how many SO_REUSEPORT sockets with their own accept tasks to open for the port, the kernel balances new connections between them; do not set if not sure what it is doing | <count of the event threads of the task processor>
+/// incoming_cpu_affinity | set SO_INCOMING_CPU of the socket with index `i` to CPU `i % <CPU count>`, so the connections processed by that CPU in the kernel go to that socket | false
 ///
 /// @see @ref md_en_userver_http_server
 
@@ -0,0 +1,92 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that samples the CPU usage of the running service.
+///
+/// During the request the threads, that consume CPU, are interrupted with
+/// SIGPROF and their stacks are sampled. The response contains the stacks in
+/// the collapsed format, that is accepted by the flamegraph.pl and speedscope:
+///
+/// `<task processor>;<span>;<outermost frame>;...;<innermost frame> <count>`
+///
+/// The samples are attributed to the task processor of the running task and
+/// to the innermost tracing::Span of the task, if the span was started after
+/// the beginning of the profiling. The common frames of the coroutine
+/// machinery are cut off.
+///
+/// The profiler uses the process-wide ITIMER_PROF timer, so it should not be
+/// used along with other profilers that rely on it. Only one profiling session
+/// could run at a time.
+///
+/// The handler writes the overhead of the profiler into the `cpu-profiler`
+/// metrics: the count of the sessions, of the taken and dropped samples and
+/// the total time spent in the signal handler.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the
+/// following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-samples | the samples above this limit are dropped, each sample takes about 450 bytes of memory during the session | 20000
+///
+/// ## Static configuration example:
+///
+/// @code{.yaml}
+/// handler-cpu-profiler:
+///     path: /service/cpu-profiler
+///     method: GET
+///     task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Schema
+/// Set the optional URL arguments:
+/// * `seconds` - the duration of the profiling, 10 by default, 60 at most
+/// * `frequency` - samples per second of the consumed CPU time,
+///   100 by default, 1000 at most
+///
+/// Responds with `409 Conflict` if another profiling session is running.
+
+// clang-format on
+
+class CpuProfiler final : public HttpHandlerBase {
+ public:
+  CpuProfiler(const components::ComponentConfig&,
+              const components::ComponentContext&);
+
+  ~CpuProfiler() override;
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::CpuProfiler
+  static constexpr std::string_view kName = "handler-cpu-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest&,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::size_t max_samples_;
+  utils::statistics::Entry profiler_statistics_holder_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
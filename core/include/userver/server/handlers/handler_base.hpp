@@ -37,7 +37,19 @@ namespace server::handlers {
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
 /// decompress_request | allow decompression of the requests | true
+/// response-body-stream-buffer-size | max size in bytes of the streamed response body that is buffered while the client receives it, server::http::ResponseBodyStream::PushBodyChunk() waits for the buffer to free up | unlimited
+/// request-body-stream | pass the request to the handler as soon as its headers are received, the handler reads the body via server::http::HttpRequest::GetBodyStream() while it is received; the body is not decompressed and the args and form data are not parsed from it | false
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
+/// compression | gzip compression of the responses for the clients that send `Accept-Encoding: gzip`; responses that already have a `Content-Encoding` are sent as is | <disabled>
+/// compression.min-size | buffered responses with smaller bodies are sent uncompressed, streamed responses are always compressed | 1024
+/// compression.level | compression level from 1 (fastest) to 9 (best) | 6
+/// compression.content-types | content types of the responses to compress, any content type if empty | []
+/// response-cache | cache of the serialized responses to the GET requests with the 200 status and without cookies, see server::handlers::HttpHandlerBase::InvalidateResponseCache() | <disabled>
+/// response-cache.ttl | for how long a cached response is served | 1s
+/// response-cache.size | max count of the cached responses | 1000
+/// response-cache.ways | count of the independently locked parts of the cache | 16
+/// response-cache.args | request args that select the response, other args are ignored | []
+/// response-cache.headers | request headers that select the response, other headers are ignored | []
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
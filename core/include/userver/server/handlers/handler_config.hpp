@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <variant>
@@ -25,6 +26,51 @@ enum class UrlTrailingSlashOption {
   kDefault = kBoth,
 };
 
+/// Options of the response compression, see the `compression` static option
+/// of server::handlers::HttpHandlerBase
+struct ResponseCompressionConfig {
+  /// Buffered responses with smaller bodies are sent as is
+  size_t min_size{1024};
+  /// gzip compression level from 1 (fastest) to 9 (best)
+  int level{6};
+  /// Content types to compress, any content type if empty
+  std::vector<std::string> content_types;
+};
+
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<ResponseCompressionConfig>);
+
+/// Options of the response cache, see the `response-cache` static option
+/// of server::handlers::HttpHandlerBase
+struct ResponseCacheConfig {
+  /// For how long a cached response is served
+  std::chrono::milliseconds ttl{1000};
+  /// Max count of the cached responses
+  size_t size{1000};
+  /// Count of the independently locked parts of the cache
+  size_t ways{16};
+  /// Request args that select the response, other args are ignored
+  std::vector<std::string> args;
+  /// Request headers that select the response, other headers are ignored
+  std::vector<std::string> headers;
+};
+
+ResponseCacheConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<ResponseCacheConfig>);
+
+/// Options of the queue time admission, see the `queue-time-limit` static
+/// option of server::handlers::HttpHandlerBase
+struct QueueTimeLimitConfig {
+  /// Acceptable queue time of the requests under sustained overload
+  std::chrono::milliseconds target{5};
+  /// Requests queued for longer are rejected even without an overload, the
+  /// overload is detected over such intervals
+  std::chrono::milliseconds interval{100};
+};
+
+QueueTimeLimitConfig Parse(const yaml_config::YamlConfig& value,
+                           formats::parse::To<QueueTimeLimitConfig>);
+
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
@@ -39,9 +85,15 @@ struct HandlerConfig {
   bool decompress_request{true};
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  std::optional<size_t> response_body_stream_buffer_size;
+  bool request_body_stream{false};
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
+  std::optional<bool> cancel_by_deadline;
+  std::optional<ResponseCompressionConfig> response_compression;
+  std::optional<ResponseCacheConfig> response_cache;
+  std::optional<QueueTimeLimitConfig> queue_time_limit;
 };
 
 HandlerConfig ParseHandlerConfigsWithDefaults(
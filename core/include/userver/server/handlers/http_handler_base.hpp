@@ -3,10 +3,12 @@
 /// @file userver/server/handlers/http_handler_base.hpp
 /// @brief @copybrief server::handlers::HttpHandlerBase
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/utils/statistics/entry.hpp>
@@ -35,6 +37,8 @@ class HttpHandlerStatistics;
 class HttpRequestStatistics;
 class HttpHandlerMethodStatistics;
 class HttpHandlerStatisticsScope;
+class ResponseCache;
+class QueueTimeLimiter;
 
 // clang-format off
 
@@ -51,6 +55,27 @@ class HttpHandlerStatisticsScope;
 /// ---- | ----------- | -------------
 /// log-level | overrides log level for this handle | <no override>
 ///
+/// ## Response cache:
+/// With the `response-cache` static option the responses to the GET requests
+/// are cached, and their bodies are sent without copying. Call
+/// InvalidateResponseCacheOn() in the constructor of the handler to drop the
+/// responses on the updates of the data they are rendered from.
+///
+/// ## Queue time limit:
+/// With the `queue-time-limit` static option the requests that waited for
+/// too long since their receipt are answered with 429 without running the
+/// handler. Only the requests queued for longer than `interval` are rejected
+/// normally; once the queue time stays above `target` for a whole interval,
+/// the requests queued for longer than `target` are rejected too.
+///
+/// ## Deadline propagation:
+/// The timeout received in the `X-YaTaxi-Client-TimeoutMs` header becomes the
+/// task-inherited deadline of the request, which is applied to the
+/// clients::http, postgres and redis requests made from the handler. Requests
+/// that arrive with an already expired deadline are answered with 504. Set the
+/// `cancel_by_deadline` static option to cancel the handler task when the
+/// deadline expires regardless of the dynamic config.
+///
 /// ## Example usage:
 ///
 /// @snippet samples/hello_service/hello_service.cpp Hello service sample - component
@@ -103,6 +128,8 @@ class HttpHandlerBase : public HandlerBase {
   /// The core method for HTTP request handling.
   /// `request` arg contains HTTP headers, full body, etc.
   /// The method should return response body.
+  /// To send a shared body without copying it, set it with
+  /// request.GetHttpResponse().SetSharedData() and return an empty string.
   /// @note It is used only if IsStreamed() returned `false`.
   virtual std::string HandleRequestThrow(
       const http::HttpRequest& request, request::RequestContext& context) const;
@@ -159,6 +186,16 @@ class HttpHandlerBase : public HandlerBase {
 
   virtual std::string GetMetaType(const http::HttpRequest&) const;
 
+  /// Drops the responses cached due to the `response-cache` static option,
+  /// e.g. when the data they were rendered from changes
+  void InvalidateResponseCache() const;
+
+  /// Calls InvalidateResponseCache() on each event of the `source`, e.g. of
+  /// components::CachingComponentBase::GetEventChannel() that holds the data of
+  /// the responses. Subscribe in the constructor of the handler.
+  template <typename... Args>
+  void InvalidateResponseCacheOn(concurrent::AsyncEventSource<Args...>& source);
+
  private:
   void HandleRequestStream(const http::HttpRequest& http_request,
                            request::RequestContext& context) const;
@@ -199,8 +236,22 @@ class HttpHandlerBase : public HandlerBase {
   bool set_response_server_hostname_;
   mutable utils::TokenBucket rate_limit_;
   bool is_body_streamed_;
+
+  std::unique_ptr<ResponseCache> response_cache_;
+  std::vector<concurrent::AsyncEventSubscriberScope>
+      response_cache_subscriptions_;
+
+  std::unique_ptr<QueueTimeLimiter> queue_time_limiter_;
 };
 
+template <typename... Args>
+void HttpHandlerBase::InvalidateResponseCacheOn(
+    concurrent::AsyncEventSource<Args...>& source) {
+  response_cache_subscriptions_.push_back(
+      source.AddListener(concurrent::FunctionId(this), HandlerName(),
+                         [this](Args...) { InvalidateResponseCache(); }));
+}
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,183 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_flatbuf_view_base.hpp
+/// @brief @copybrief server::handlers::HttpHandlerFlatbufViewBase
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include <flatbuffers/flatbuffers.h>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/handlers/http_handler_flatbuf_base.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/utils/log.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Base for handlers that accept requests with body in Flatbuffer
+/// format and respond with body in Flatbuffer format without the object API.
+///
+/// Unlike server::handlers::HttpHandlerFlatbufBase the request is not
+/// unpacked: the handler gets a verified table that points into the request
+/// body. The response is built by the handler right in the
+/// flatbuffers::FlatBufferBuilder, which is preallocated for the size of the
+/// previous responses.
+///
+/// ## Example usage:
+///
+/// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - view component
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerFlatbufViewBase : public HttpHandlerBase {
+  static_assert(std::is_base_of<flatbuffers::Table, InputType>::value,
+                "Input type should be auto-generated FlatBuffers table type");
+  static_assert(std::is_base_of<flatbuffers::Table, ReturnType>::value,
+                "Return type should be auto-generated FlatBuffers table type");
+
+ public:
+  HttpHandlerFlatbufViewBase(
+      const components::ComponentConfig& config,
+      const components::ComponentContext& component_context);
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext& context) const final;
+
+  /// @brief Builds the response in the `builder` and returns its root table.
+  ///
+  /// The `input` points into the request body and is valid until the end of
+  /// the request handling.
+  virtual flatbuffers::Offset<ReturnType> HandleRequestFlatbufThrow(
+      const http::HttpRequest& request, const InputType& input,
+      flatbuffers::FlatBufferBuilder& builder,
+      request::RequestContext& context) const = 0;
+
+  /// @returns A pointer to input data if it was verified successfully or
+  /// nullptr otherwise.
+  const InputType* GetInputData(const request::RequestContext& context) const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override it if you need a custom request body logging.
+  std::string GetRequestBodyForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& request_body) const override;
+
+  /// Override it if you need a custom response data logging.
+  std::string GetResponseDataForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& response_data) const override;
+
+  void ParseRequestData(const http::HttpRequest& request,
+                        request::RequestContext& context) const final;
+
+ private:
+  // The default initial size of flatbuffers::FlatBufferBuilder
+  static constexpr std::size_t kDefaultResponseSizeHint = 1024;
+
+  void UpdateResponseSizeHint(std::size_t response_size) const;
+
+  mutable std::atomic<std::size_t> response_size_hint_{
+      kDefaultResponseSizeHint};
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HttpHandlerFlatbufViewBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context) {}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto* input =
+      context.GetData<const InputType*>(impl::kFlatbufRequestDataName);
+
+  // The builder reallocates each time it runs out of space, so it starts
+  // with the size of the previous responses
+  flatbuffers::FlatBufferBuilder builder{
+      response_size_hint_.load(std::memory_order_relaxed)};
+  builder.Finish(HandleRequestFlatbufThrow(request, *input, builder, context));
+  UpdateResponseSizeHint(builder.GetSize());
+
+  return {reinterpret_cast<const char*>(builder.GetBufferPointer()),
+          builder.GetSize()};
+}
+
+template <typename InputType, typename ReturnType>
+const InputType*
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetInputData(
+    const request::RequestContext& context) const {
+  const auto* input =
+      context.GetDataOptional<const InputType*>(impl::kFlatbufRequestDataName);
+  return input ? *input : nullptr;
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetRequestBodyForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& request_body) const {
+  size_t limit = GetConfig().request_body_size_log_limit;
+  return utils::log::ToLimitedHex(request_body, limit);
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetResponseDataForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& response_data) const {
+  size_t limit = GetConfig().response_data_size_log_limit;
+  return utils::log::ToLimitedHex(response_data, limit);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto& body = request.RequestBody();
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()),
+                                 body.size());
+  if (!verifier.VerifyBuffer<InputType>(nullptr)) {
+    throw ClientError(
+        InternalMessage{"Invalid FlatBuffers format in request body"});
+  }
+
+  context.SetData<const InputType*>(
+      impl::kFlatbufRequestDataName,
+      flatbuffers::GetRoot<InputType>(body.data()));
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::UpdateResponseSizeHint(
+    std::size_t response_size) const {
+  // The builder needs some space for the alignment, and the hint slowly
+  // forgets the large responses to not overallocate for all the requests
+  const auto wanted = response_size + response_size / 8;
+  const auto hint = response_size_hint_.load(std::memory_order_relaxed);
+  const auto new_hint = wanted >= hint ? wanted : hint - (hint - wanted) / 8;
+  response_size_hint_.store(new_hint, std::memory_order_relaxed);
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("HTTP handler flatbuf view base config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -19,6 +19,10 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// The files are sent right from the memory of fs::FsCacheClient, without
+/// copying them. Requests with a single byte range in the `Range` header get
+/// HTTP 206 with the requested part of the file.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
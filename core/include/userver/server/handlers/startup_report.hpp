@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file userver/server/handlers/startup_report.hpp
+/// @brief @copybrief server::handlers::StartupReport
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+class Manager;
+}  // namespace components
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the components startup report.
+///
+/// The report is built once all the components are constructed. The same
+/// report is written to `components_manager.startup_report_path` if the
+/// option is set.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @code{.yaml}
+/// handler-startup-report:
+///     path: /service/startup-report
+///     method: GET
+///     task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Schema
+/// The times are in milliseconds since the start of the components load.
+/// `constructor_ms` does not count the time spent waiting for the
+/// dependencies, `cache_first_update` is present for caches only:
+/// @code{.json}
+/// {
+///   "total_ms": 1520,
+///   "critical_path": ["handler-hello", "cache-users"],
+///   "components": {
+///     "cache-users": {
+///       "start_ms": 10, "finish_ms": 1400, "constructor_ms": 1390,
+///       "dependencies_wait_ms": 0, "dependencies": ["postgres-db"],
+///       "cache_first_update": {"fetch_ms": 900, "parse_ms": 450, "publish_ms": 20, "total_ms": 1380}
+///     }
+///   }
+/// }
+/// @endcode
+
+// clang-format on
+class StartupReport final : public HttpHandlerBase {
+ public:
+  StartupReport(const components::ComponentConfig& config,
+                const components::ComponentContext& component_context);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::StartupReport
+  static constexpr std::string_view kName = "handler-startup-report";
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const components::Manager& manager_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool
+    components::kHasValidate<server::handlers::StartupReport> = true;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file userver/server/handlers/task_cpu_usage.hpp
+/// @brief @copybrief server::handlers::TaskCpuUsage
+
+#include <userver/server/handlers/http_handler_json_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the spans that consumed the most CPU time.
+///
+/// The component enables the accounting of the CPU time of the tasks. The
+/// thread CPU time is measured at each context switch of a task and at each
+/// change of the innermost tracing::Span of the task, the time is charged to
+/// the name of the innermost span. The time outside of any span is charged to
+/// `[no span]`. At most 1000 distinct span names are tracked, the rest are
+/// charged to `[other]`.
+///
+/// The accounting costs a couple of `clock_gettime(CLOCK_THREAD_CPUTIME_ID)`
+/// calls per context switch, so it is disabled unless the component is in
+/// the static config.
+///
+/// The CPU time and the count of the finished spans are also written into the
+/// `task-cpu-usage` metrics with the `span_name` label.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @code{.yaml}
+/// handler-task-cpu-usage:
+///     path: /service/task-cpu-usage
+///     method: GET
+///     task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Schema
+/// Provide an optional query parameter `limit` to get at most `limit` spans,
+/// 20 by default. The response is a JSON array sorted by the CPU time:
+/// @code{.json}
+/// [{"span_name": "http/handler-hello", "cpu-time-us": 1200, "spans": 10, "cpu-time-per-span-us": 120}]
+/// @endcode
+
+// clang-format on
+class TaskCpuUsage final : public HttpHandlerJsonBase {
+ public:
+  TaskCpuUsage(const components::ComponentConfig& config,
+               const components::ComponentContext& component_context);
+
+  ~TaskCpuUsage() override;
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::TaskCpuUsage
+  static constexpr std::string_view kName = "handler-task-cpu-usage";
+
+  formats::json::Value HandleRequestJsonThrow(
+      const http::HttpRequest& request,
+      const formats::json::Value& request_json,
+      request::RequestContext& context) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  utils::statistics::Entry cpu_usage_statistics_holder_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::TaskCpuUsage> =
+    true;
+
+USERVER_NAMESPACE_END
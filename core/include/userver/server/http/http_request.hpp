@@ -22,6 +22,7 @@ USERVER_NAMESPACE_BEGIN
 namespace server::http {
 
 class HttpRequestImpl;
+class RequestBodyStream;
 
 /// @brief HTTP Request data
 class HttpRequest final {
@@ -172,9 +173,18 @@ class HttpRequest final {
   /// @return List of cookies names.
   CookiesMapKeys GetCookieNames() const;
 
-  /// @return HTTP body.
+  /// @return HTTP body, empty if the body is streamed.
   const std::string& RequestBody() const;
 
+  /// @return true if the body is read through GetBodyStream() instead of
+  /// RequestBody(), see the `request-body-stream` static option of the
+  /// handler.
+  bool IsBodyStreamed() const;
+
+  /// @return The body that is received while the handler reads it.
+  /// @warning Must be called only if IsBodyStreamed() is true.
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
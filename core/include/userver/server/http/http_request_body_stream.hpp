@@ -0,0 +1,53 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Body of an HTTP request that is read by the handler as it arrives.
+///
+/// Available for the handlers with the `request-body-stream` static option,
+/// see server::http::HttpRequest::GetBodyStream(). Only a few chunks of the
+/// body are buffered: while the handler does not read them, the server does
+/// not read the rest of the request from the connection. The rest of the
+/// body that the handler has not read is dropped once the response is sent.
+class RequestBodyStream final {
+ public:
+  /// @cond
+  using Queue = concurrent::SpscQueue<std::string>;
+
+  explicit RequestBodyStream(Queue::Consumer&& queue_consumer);
+  /// @endcond
+
+  RequestBodyStream(RequestBodyStream&&) noexcept;
+  ~RequestBodyStream();
+
+  /// @brief Reads the next body part into `output`, any previous data in
+  /// `output` is dropped.
+  ///
+  /// @returns false if the whole body is read, or if the `deadline` has
+  /// expired or the task was cancelled before the next part arrived.
+  /// @throws server::handlers::RequestParseError if the body is incomplete,
+  /// e.g. it is malformed or it exceeds the `max_request_size`.
+  /// @note The parts are not necessarily the HTTP chunks of the request.
+  bool ReadChunk(std::string& output, engine::Deadline deadline);
+
+  /// @returns true if ReadChunk() has read the whole body
+  bool IsBodyRead() const noexcept { return is_body_read_; }
+
+ private:
+  Queue::Consumer queue_consumer_;
+  bool is_body_read_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
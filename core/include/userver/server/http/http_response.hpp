@@ -5,7 +5,9 @@
 
 #include <chrono>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/single_consumer_event.hpp>
@@ -30,6 +32,7 @@ void OutputHeader(std::string& header, std::string_view key,
 }
 
 class HttpRequestImpl;
+class Http2Stream;
 
 /// @brief HTTP Response data
 class HttpResponse final : public request::ResponseBase {
@@ -119,6 +122,19 @@ class HttpResponse final : public request::ResponseBase {
   /// @cond
   // TODO: server internals. remove from public interface
   void SendResponse(engine::io::Socket& socket) override;
+
+  // For internal use only. Builds the headers in `header_buffer` to reuse its
+  // memory, the body is sent along with the headers without copying it.
+  void SendResponse(engine::io::Socket& socket, std::string& header_buffer);
+
+  // For internal use only. Sends the response into an HTTP/2 stream.
+  void SendResponse(Http2Stream& stream);
+
+  // For internal use only. Sends the non-streamed responses of pipelined
+  // requests with a single vectored write, in the order of `responses`.
+  static void SendResponses(engine::io::Socket& socket,
+                            std::string& header_buffer,
+                            const std::vector<HttpResponse*>& responses);
   /// @endcond
 
   void SetStatusServiceUnavailable() override {
@@ -132,12 +148,20 @@ class HttpResponse final : public request::ResponseBase {
 
   using Queue = concurrent::StringStreamQueue;
 
-  void SetStreamBody();
+  // The producer waits while the consumer has `max_buffered_size` bytes
+  void SetStreamBody(std::size_t max_buffered_size = Queue::kUnbounded);
   bool IsBodyStreamed() const override;
   // Can be called only once
   Queue::Producer GetBodyProducer();
 
  private:
+  // Appends the status line and the headers common for all the bodies
+  void OutputHeaders(std::string& header);
+
+  // Finishes the headers of a non-streamed response, returns the body to send
+  // after them
+  std::string_view OutputNotStreamedHeadersEnd(std::string& header);
+
   // Returns total size of the response
   std::size_t SetBodyStreamed(engine::io::Socket& socket, std::string& header);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -7,24 +8,33 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace compression::gzip {
+class StreamCompressor;
+}  // namespace compression::gzip
+
 namespace server::handlers {
 class HttpHandlerBase;
-}
+struct ResponseCompressionConfig;
+}  // namespace server::handlers
 
 namespace server::http {
 
 class ResponseBodyStream final {
  public:
-  ResponseBodyStream(ResponseBodyStream&&) = default;
+  ResponseBodyStream(ResponseBodyStream&&);
+  ~ResponseBodyStream();
 
   // Send a chunk of response data. It may NOT generate
-  // exactly one HTTP chunk per call to PushBodyChunk().
+  // exactly one HTTP chunk per call to PushBodyChunk(). Waits while the
+  // `response-body-stream-buffer-size` of the handler is buffered.
   void PushBodyChunk(std::string&& chunk, engine::Deadline deadline);
 
   void SetHeader(const std::string&, const std::string&);
 
   void SetHeader(std::string_view, const std::string&);
 
+  /// Sends the headers. If the handler has the `compression` static option
+  /// and the client accepts gzip, the chunks pushed afterwards are compressed.
   void SetEndOfHeaders();
 
   void SetStatusCode(int status_code);
@@ -38,7 +48,17 @@ class ResponseBodyStream final {
       server::http::HttpResponse::Queue::Producer&& queue_producer,
       server::http::HttpResponse& http_response);
 
+  // Compress the body if the response turns out to be compressible
+  void EnableCompression(const handlers::ResponseCompressionConfig& config);
+
+  // Push the tail of the compressed body, if any
+  void Finish(engine::Deadline deadline);
+
+  bool Push(std::string&& chunk, engine::Deadline deadline);
+
   bool headers_ended_{false};
+  const handlers::ResponseCompressionConfig* compression_config_{nullptr};
+  std::unique_ptr<compression::gzip::StreamCompressor> compressor_;
   HttpResponse::Queue::Producer queue_producer_;
   server::http::HttpResponse& http_response_;
 };
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -48,7 +49,17 @@ class ResponseBase {
   virtual ~ResponseBase() noexcept;
 
   void SetData(std::string data);
-  const std::string& GetData() const { return data_; }
+
+  /// @brief Sets the body that is shared with other responses, e.g. a cached
+  /// serialized response. The body is sent without copying it.
+  ///
+  /// SetData() overrides the shared body.
+  void SetSharedData(std::shared_ptr<const std::string> data);
+  bool HasSharedData() const noexcept { return shared_data_ != nullptr; }
+
+  const std::string& GetData() const {
+    return shared_data_ ? *shared_data_ : data_;
+  }
 
   virtual bool IsBodyStreamed() const = 0;
   virtual bool WaitForHeadersEnd() = 0;
@@ -101,6 +112,7 @@ class ResponseBase {
   ResponseDataAccounter& accounter_;
   std::optional<Guard> guard_;
   std::string data_;
+  std::shared_ptr<const std::string> shared_data_;
   std::chrono::steady_clock::time_point create_time_;
   std::chrono::steady_clock::time_point ready_time_;
   std::chrono::steady_clock::time_point sent_time_;
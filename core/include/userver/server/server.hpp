@@ -10,6 +10,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace congestion_control {
+struct TenantsConfig;
+}  // namespace congestion_control
+
 namespace server {
 
 namespace net {
@@ -57,6 +61,10 @@ class Server final {
 
   void SetRpsRatelimitStatusCode(http::HttpStatus status_code);
 
+  /// Splits the RPS limit between the tenants, must be called before Start()
+  void SetRpsRatelimitTenants(
+      USERVER_NAMESPACE::congestion_control::TenantsConfig config);
+
  private:
   std::unique_ptr<ServerImpl> pimpl;
 };
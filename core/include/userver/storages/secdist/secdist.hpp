@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -20,6 +21,7 @@
 #include <userver/rcu/rcu.hpp>
 #include <userver/storages/secdist/provider.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +37,13 @@ class SecdistModule final {
  public:
   static const T& Get(const SecdistConfig& config);
   static std::any Factory(const formats::json::Value& data) { return T(data); }
+  static bool IsEqual(const std::any& lhs, const std::any& rhs) {
+    if constexpr (meta::kIsEqualityComparable<T>) {
+      return std::any_cast<const T&>(lhs) == std::any_cast<const T&>(rhs);
+    } else {
+      return false;
+    }
+  }
 
  private:
   static std::size_t index_;
@@ -85,10 +94,14 @@ class SecdistConfig final {
   SecdistConfig();
   explicit SecdistConfig(const Settings& settings);
 
+  /// Parses the secdist modules from `doc`. The modules that have
+  /// `operator==` and are equal to the ones of `previous` are shared with it.
+  SecdistConfig(const formats::json::Value& doc, const SecdistConfig& previous);
+
   template <typename T>
   static std::size_t Register(
       std::function<std::any(const formats::json::Value&)>&& factory) {
-    return Register(std::move(factory));
+    return Register(std::move(factory), &detail::SecdistModule<T>::IsEqual);
   }
 
   template <typename T>
@@ -97,16 +110,18 @@ class SecdistConfig final {
   }
 
  private:
-  void Init(const formats::json::Value& doc);
+  void Init(const formats::json::Value& doc, const SecdistConfig* previous);
 
   static std::size_t Register(
-      std::function<std::any(const formats::json::Value&)>&& factory);
+      std::function<std::any(const formats::json::Value&)>&& factory,
+      bool (*is_equal)(const std::any&, const std::any&));
   const std::any& Get(const std::type_index& type, std::size_t index) const;
 
   template <typename T>
   friend class detail::SecdistModule;
 
-  std::vector<std::any> configs_;
+  // Shared between the configs to not copy the unchanged modules
+  std::vector<std::shared_ptr<const std::any>> configs_;
 };
 
 /// @ingroup userver_clients
@@ -134,6 +149,15 @@ class Secdist final {
       Class* obj, std::string_view name,
       void (Class::*func)(const storages::secdist::SecdistConfig& secdist));
 
+  /// Subscribes to the updates of a single secdist module `T` using a member
+  /// function. Also immediately invokes the function with the current `T`.
+  /// Later the function is invoked only if `T` has changed, which requires
+  /// `T::operator==`. Without it, the function is invoked on each secdist
+  /// change.
+  template <typename Class, typename T>
+  concurrent::AsyncEventSubscriberScope UpdateAndListen(
+      Class* obj, std::string_view name, void (Class::*func)(const T& value));
+
   bool IsPeriodicUpdateEnabled() const;
 
  private:
@@ -144,7 +168,7 @@ class Secdist final {
       EventSource::Function&& func);
 
   class Impl;
-  utils::FastPimpl<Impl, 1136, 16> impl_;
+  utils::FastPimpl<Impl, 1216, 16> impl_;
 };
 
 template <typename Class>
@@ -156,6 +180,21 @@ concurrent::AsyncEventSubscriberScope Secdist::UpdateAndListen(
       [obj, func](const SecdistConfig& config) { (obj->*func)(config); });
 }
 
+template <typename Class, typename T>
+concurrent::AsyncEventSubscriberScope Secdist::UpdateAndListen(
+    Class* obj, std::string_view name, void (Class::*func)(const T& value)) {
+  // Holds the previously delivered module, so its address is not reused
+  auto previous = std::make_shared<std::optional<SecdistConfig>>();
+  return DoUpdateAndListen(
+      concurrent::FunctionId(obj), name,
+      [obj, func, previous](const SecdistConfig& config) {
+        const auto& value = config.Get<T>();
+        if (*previous && &(*previous)->Get<T>() == &value) return;
+        *previous = config;
+        (obj->*func)(value);
+      });
+}
+
 namespace detail {
 
 template <typename T>
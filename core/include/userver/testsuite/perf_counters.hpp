@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/testsuite/perf_counters.hpp
+/// @brief @copybrief testsuite::PerfCountersControl
+
+#include <cstdint>
+#include <string_view>
+
+#include <userver/formats/json_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace testsuite {
+
+/// @brief Adds `value` to the performance counter `name`, e.g. to the count
+/// of the database queries.
+///
+/// Does nothing unless the counters are enabled by the testsuite, so it is
+/// cheap enough to be called from the drivers in production.
+void AccountPerfCounter(std::string_view name,
+                        std::uint64_t value = 1) noexcept;
+
+/// @brief Performance counters control interface for testsuite
+///
+/// The counters are process-wide and are accounted since the last Reset(),
+/// so that a functional test can assert on the work done by the requests
+/// that it has made, e.g. on the count of the database queries of a handler.
+///
+/// All methods are coro-safe.
+/// The counters are disabled by default.
+/// Only 1 PerfCountersControl instance may exist globally at a time.
+class PerfCountersControl final {
+ public:
+  PerfCountersControl();
+  ~PerfCountersControl();
+
+  /// @brief Starts accounting the counters
+  void Enable();
+
+  /// @brief Zeroes all the counters
+  void Reset();
+
+  /// @returns An object with the nonzero counters
+  formats::json::Value GetCounters() const;
+};
+
+}  // namespace testsuite
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include <userver/testsuite/dump_control.hpp>
 #include <userver/testsuite/grpc_control.hpp>
 #include <userver/testsuite/http_allowed_urls_extra.hpp>
+#include <userver/testsuite/perf_counters.hpp>
 #include <userver/testsuite/periodic_task_control.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/testsuite/redis_control.hpp>
@@ -69,6 +70,7 @@ class TestsuiteSupport final : public components::impl::ComponentBase {
   testsuite::TestsuiteTasks& GetTestsuiteTasks();
   testsuite::HttpAllowedUrlsExtra& GetHttpAllowedUrlsExtra();
   testsuite::GrpcControl& GetGrpcControl();
+  testsuite::PerfCountersControl& GetPerfCountersControl();
 
   static yaml_config::Schema GetStaticConfigSchema();
 
@@ -85,6 +87,7 @@ class TestsuiteSupport final : public components::impl::ComponentBase {
   std::unique_ptr<testsuite::TestsuiteTasks> testsuite_tasks_;
   testsuite::HttpAllowedUrlsExtra http_allowed_urls_extra_;
   testsuite::GrpcControl grpc_control_;
+  testsuite::PerfCountersControl perf_counters_control_;
 };
 
 template <>
@@ -0,0 +1,84 @@
+#pragma once
+
+/// @file userver/tracing/otlp_exporter_component.hpp
+/// @brief @copybrief tracing::OtlpExporterComponent
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace otlp {
+class Exporter;
+}  // namespace otlp
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that sends the finished tracing::Span to an OpenTelemetry
+/// collector over OTLP/HTTP in the protobuf encoding.
+///
+/// The spans are put into a bounded in-memory queue and are sent in batches
+/// from a background task, the spans that do not fit into the queue are
+/// dropped. With `log-spans: false` the spans are not written into the default
+/// logger, which saves on formatting and on parsing them downstream.
+///
+/// The spans of the requests to the collector are neither exported nor logged.
+///
+/// The component reports the `tracing.otlp.exported`, `tracing.otlp.dropped`,
+/// `tracing.otlp.batches`, `tracing.otlp.send_errors` and
+/// `tracing.otlp.sent_bytes` metrics.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URL of the OTLP/HTTP traces receiver, for example `http://localhost:4318/v1/traces` | -
+/// http-client | name of the components::HttpClient to send the spans with | http-client
+/// task_processor | task processor for the background sending task | the task processor of the component
+/// max-queue-size | max count of the spans waiting to be sent | 65536
+/// max-batch-size | max count of the spans in a single request | 512
+/// export-interval | utils::StringToDuration suitable duration string, max time a span waits in the queue | 1s
+/// timeout | utils::StringToDuration suitable duration string, timeout of a request to the collector | 1s
+/// compression | `gzip` or `none` | gzip
+/// log-spans | whether to also write the spans into the default logger | true
+///
+/// ## Config example:
+///
+/// @code
+/// tracing-otlp-exporter:
+///     endpoint: http://localhost:4318/v1/traces
+///     max-batch-size: 1024
+///     log-spans: false
+/// @endcode
+
+// clang-format on
+class OtlpExporterComponent final : public components::LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of tracing::OtlpExporterComponent
+  static constexpr std::string_view kName = "tracing-otlp-exporter";
+
+  OtlpExporterComponent(const components::ComponentConfig& config,
+                        const components::ComponentContext& context);
+
+  ~OtlpExporterComponent() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<otlp::Exporter> exporter_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace tracing
+
+template <>
+inline constexpr bool components::kHasValidate<tracing::OtlpExporterComponent> =
+    true;
+
+USERVER_NAMESPACE_END
@@ -174,6 +174,13 @@ class Span final {
   /// global log levels to the default logger.
   bool ShouldLogDefault() const noexcept;
 
+  /// @returns true if the trace of this span was chosen by the head-based
+  /// sampling, see the sampling options of components::Tracer.
+  ///
+  /// The not sampled spans do not store tags (except for the link) and are
+  /// not logged, unless the tail-based sampling keeps the whole trace.
+  bool IsSampled() const noexcept;
+
   /// Detach the Span from current engine::Task so it is not
   /// returned by CurrentSpan() any more.
   void DetachFromCoroStack();
@@ -25,6 +25,9 @@ class SpanBuilder final {
   void SetParentSpanId(std::string parent_span_id);
   void SetParentLink(std::string parent_link);
   void AddTagFrozen(std::string key, logging::LogExtra::Value value);
+  /// Overrides the head-based sampling decision, e.g. with the one of the
+  /// upstream service. Does nothing if the span has a local parent.
+  void SetSampled(bool sampled);
   Span Build() &&;
 
  private:
@@ -41,7 +41,7 @@ struct SpanWrapCall {
 
   struct Impl;
 
-  static constexpr std::size_t kImplSize = 4256;
+  static constexpr std::size_t kImplSize = 4288;
   static constexpr std::size_t kImplAlign = 8;
   utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
@@ -157,6 +157,34 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task with the specified priority, task execution
+/// may be cancelled before the function starts execution in case of
+/// TaskProcessor overload.
+///
+/// Higher priority tasks are dequeued first by the task processor, see
+/// engine::Task::Priority.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param tasks_processor Task processor to run on
+/// @param name Name of the task to show in logs
+/// @param priority Priority of the task within the task processor
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
+                         std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return engine::AsyncNoSpan(
+      task_processor, priority, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task with deadline, task execution may be cancelled
@@ -276,6 +304,32 @@ template <typename Function, typename... Args>
                       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task with the specified priority on current task
+/// processor, task execution may be cancelled before the function starts
+/// execution in case of engine::TaskProcessor overload.
+///
+/// Higher priority tasks are dequeued first by the task processor, see
+/// engine::Task::Priority.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param name Name of the task to show in logs
+/// @param priority Priority of the task within the task processor
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return utils::Async(engine::current_task::GetTaskProcessor(), std::move(name),
+                      priority, std::forward<Function>(f),
+                      std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task on current task processor, task execution
@@ -0,0 +1,255 @@
+#pragma once
+
+/// @file userver/utils/parallel.hpp
+/// @brief Parallel algorithms over random access ranges: utils::ParallelFor,
+/// utils::ParallelTransform, utils::ParallelReduce and utils::ParallelSort
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// Settings of the utils::Parallel* algorithms
+struct ParallelSettings final {
+  /// Task processor for the helper tasks, the current one if not set
+  engine::TaskProcessor* task_processor{nullptr};
+
+  /// Maximum number of the concurrently processed parts including the
+  /// caller's one, the number of the task processor threads if 0
+  std::size_t max_parts{0};
+
+  /// Minimal number of elements processed at once, increase it for cheap
+  /// per-element operations
+  std::size_t min_chunk_size{1};
+
+  /// Once reached, engine::WaitInterruptedException is thrown, the elements
+  /// may be partially processed
+  engine::Deadline deadline{};
+
+  /// Name of the helper tasks spans
+  std::string task_name{"parallel"};
+};
+
+namespace impl {
+
+// Splits [0, size) into the chunks processed by the concurrent parts
+class ParallelChunks final {
+ public:
+  ParallelChunks(const ParallelSettings& settings, std::size_t size,
+                 std::size_t chunks_per_part);
+
+  std::size_t GetPartsCount() const noexcept { return parts_; }
+  std::size_t GetCount() const noexcept { return count_; }
+
+  std::size_t Begin(std::size_t chunk) const noexcept {
+    return chunk * chunk_size_;
+  }
+
+  std::size_t End(std::size_t chunk) const noexcept {
+    return std::min(Begin(chunk) + chunk_size_, size_);
+  }
+
+ private:
+  std::size_t size_;
+  std::size_t parts_;
+  std::size_t chunk_size_;
+  std::size_t count_;
+};
+
+engine::TaskProcessor& GetParallelTaskProcessor(
+    const ParallelSettings& settings);
+
+// Throws engine::WaitInterruptedException on the deadline or cancellation
+void CheckParallelInterrupted(engine::Deadline deadline);
+
+void WaitParallelParts(std::vector<engine::TaskWithResult<void>>& tasks,
+                       engine::Deadline deadline);
+
+// Calls `func(index)` for each index in [0, count) from `parts` concurrent
+// workers, one of which is the caller. The workers take the indexes one by
+// one, so the faster ones process more of them.
+template <typename Func>
+void RunParallel(const ParallelSettings& settings, std::size_t parts,
+                 std::size_t count, const Func& func) {
+  if (count == 0) return;
+  parts = std::min(parts, count);
+
+  std::atomic<std::size_t> next_index{0};
+  const auto work = [&] {
+    try {
+      while (true) {
+        const auto index = next_index.fetch_add(1, std::memory_order_relaxed);
+        if (index >= count) return;
+        CheckParallelInterrupted(settings.deadline);
+        func(index);
+      }
+    } catch (const std::exception&) {
+      // Don't let the other workers start new indexes
+      next_index.store(count, std::memory_order_relaxed);
+      throw;
+    }
+  };
+
+  if (parts == 1) {
+    work();
+    return;
+  }
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(parts - 1);
+  auto& task_processor = GetParallelTaskProcessor(settings);
+  for (std::size_t i = 0; i + 1 < parts; ++i) {
+    tasks.push_back(utils::Async(task_processor, settings.task_name, work));
+  }
+
+  // The tasks are cancelled and awaited by their destructors on exceptions
+  work();
+  WaitParallelParts(tasks, settings.deadline);
+}
+
+// Several chunks per part balance the uneven work between the parts
+inline constexpr std::size_t kChunksPerPart = 4;
+
+// The sorted chunks are merged pairwise, so there is no point in more chunks
+inline constexpr std::size_t kSortChunksPerPart = 1;
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func(element)` for each element of [first, last) from
+/// several tasks, the caller processes the elements too
+///
+/// The range is split into chunks of at least `settings.min_chunk_size`
+/// elements and the chunks are distributed between the parts dynamically.
+/// The first exception thrown by `func` is rethrown, the remaining chunks
+/// are not processed.
+///
+/// ## Example usage:
+///
+/// @snippet utils/parallel_test.cpp  Sample utils::ParallelFor usage
+template <typename RandomIt, typename Func>
+void ParallelFor(RandomIt first, RandomIt last, const Func& func,
+                 const ParallelSettings& settings = {}) {
+  const impl::ParallelChunks chunks{settings,
+                                    static_cast<std::size_t>(last - first),
+                                    impl::kChunksPerPart};
+  impl::RunParallel(settings, chunks.GetPartsCount(), chunks.GetCount(),
+                    [&](std::size_t chunk) {
+                      const auto end = first + chunks.End(chunk);
+                      for (auto it = first + chunks.Begin(chunk); it != end;
+                           ++it) {
+                        func(*it);
+                      }
+                    });
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Writes `func(element)` of each element of [first, last) to the
+/// range starting at `d_first` from several tasks, like std::transform
+/// @returns the iterator past the last written element
+/// @see utils::ParallelFor
+template <typename RandomIt, typename OutputRandomIt, typename Func>
+OutputRandomIt ParallelTransform(RandomIt first, RandomIt last,
+                                 OutputRandomIt d_first, const Func& func,
+                                 const ParallelSettings& settings = {}) {
+  const auto size = static_cast<std::size_t>(last - first);
+  const impl::ParallelChunks chunks{settings, size, impl::kChunksPerPart};
+  impl::RunParallel(settings, chunks.GetPartsCount(), chunks.GetCount(),
+                    [&](std::size_t chunk) {
+                      std::transform(first + chunks.Begin(chunk),
+                                     first + chunks.End(chunk),
+                                     d_first + chunks.Begin(chunk), func);
+                    });
+  return d_first + size;
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Folds [first, last) with `reduce` starting with `init` from several
+/// tasks
+///
+/// The chunks are folded in parallel and the results of the chunks are folded
+/// in the order of the range, so `reduce` must be associative, but does not
+/// have to be commutative.
+/// @see utils::ParallelFor
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T ParallelReduce(RandomIt first, RandomIt last, T init,
+                 const BinaryOp& reduce = {},
+                 const ParallelSettings& settings = {}) {
+  const impl::ParallelChunks chunks{settings,
+                                    static_cast<std::size_t>(last - first),
+                                    impl::kChunksPerPart};
+  std::vector<std::optional<T>> results(chunks.GetCount());
+  impl::RunParallel(settings, chunks.GetPartsCount(), chunks.GetCount(),
+                    [&](std::size_t chunk) {
+                      auto it = first + chunks.Begin(chunk);
+                      const auto end = first + chunks.End(chunk);
+                      T result = *it;
+                      for (++it; it != end; ++it) {
+                        result = reduce(std::move(result), *it);
+                      }
+                      results[chunk].emplace(std::move(result));
+                    });
+
+  for (auto& result : results) {
+    init = reduce(std::move(init), std::move(*result));
+  }
+  return init;
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Sorts [first, last) with `comp` from several tasks, the sort is not
+/// stable
+///
+/// Each part sorts its chunk, then the neighbour sorted chunks are merged in
+/// parallel pairwise, the merges allocate like std::inplace_merge.
+/// @see utils::ParallelFor
+template <typename RandomIt, typename Compare = std::less<>>
+void ParallelSort(RandomIt first, RandomIt last, const Compare& comp = {},
+                  const ParallelSettings& settings = {}) {
+  const impl::ParallelChunks chunks{settings,
+                                    static_cast<std::size_t>(last - first),
+                                    impl::kSortChunksPerPart};
+  impl::RunParallel(settings, chunks.GetPartsCount(), chunks.GetCount(),
+                    [&](std::size_t chunk) {
+                      std::sort(first + chunks.Begin(chunk),
+                                first + chunks.End(chunk), comp);
+                    });
+
+  for (std::size_t width = 1; width < chunks.GetCount(); width *= 2) {
+    const auto merges = (chunks.GetCount() - width + 2 * width - 1) /
+                        (2 * width);
+    impl::RunParallel(
+        settings, chunks.GetPartsCount(), merges, [&](std::size_t merge) {
+          const auto left = merge * 2 * width;
+          const auto right = left + width;
+          const auto last_chunk =
+              std::min(right + width, chunks.GetCount()) - 1;
+          std::inplace_merge(first + chunks.Begin(left),
+                             first + chunks.Begin(right),
+                             first + chunks.End(last_chunk), comp);
+        });
+  }
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
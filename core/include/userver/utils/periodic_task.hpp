@@ -17,6 +17,8 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/flags.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,6 +36,17 @@ namespace utils {
 ///
 /// TaskProcessor to execute the callback and many other options are specified
 /// in PeriodicTask::Settings.
+///
+/// If PeriodicTask::Settings::coalescing_granularity is set, the wake ups are
+/// moved to the multiples of the granularity on the steady clock, so the timers
+/// of many periodic tasks with such setting fire together and the process
+/// wakes up less frequently.
+///
+/// The count of steps, errors and the total execution time of the steps are
+/// not registered in statistics automatically, the owner of the task should
+/// write them with `writer = periodic_task` from its own statistics writer.
+/// The CPU time of the steps is accounted to the span with the task name if
+/// CPU usage accounting of the tasks is enabled.
 class PeriodicTask final {
  public:
   enum class Flags {
@@ -101,6 +114,15 @@ class PeriodicTask final {
     /// @brief Used instead of `period` in case of exception, if set.
     std::optional<std::chrono::milliseconds> exception_period;
 
+    /// @brief If non-zero, the next step is started at a multiple of the
+    /// granularity on the steady clock. With kChaotic the step starts at a
+    /// random multiple within `period +/- distribution` if there is one,
+    /// otherwise at the first multiple after it, so the step is delayed by
+    /// less than the granularity.
+    ///
+    /// Periodic tasks that share the granularity are woken up together.
+    std::chrono::milliseconds coalescing_granularity{0};
+
     /// @brief Flags that control the behavior of PeriodicTask.
     utils::Flags<Flags> flags{};
 
@@ -192,6 +214,11 @@ class PeriodicTask final {
   /// Get current settings. Note that they might become stale very quickly.
   Settings GetCurrentSettings() const;
 
+  /// @cond
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const PeriodicTask& task);
+  /// @endcond
+
  private:
   enum class SuspendState { kRunning, kSuspended };
 
@@ -207,6 +234,10 @@ class PeriodicTask final {
 
   std::chrono::milliseconds MutatePeriod(std::chrono::milliseconds period);
 
+  std::chrono::steady_clock::time_point GetNextStepTime(
+      std::chrono::steady_clock::time_point start,
+      std::chrono::milliseconds period);
+
   rcu::Variable<std::string> name_;
   Callback callback_;
   engine::TaskWithResult<void> task_;
@@ -219,6 +250,10 @@ class PeriodicTask final {
   std::atomic<SuspendState> suspend_state_;
 
   std::optional<testsuite::PeriodicTaskRegistrationHolder> registration_holder_;
+
+  utils::statistics::RateCounter steps_;
+  utils::statistics::RateCounter errors_;
+  utils::statistics::RateCounter execution_time_ms_;
 };
 
 }  // namespace utils
@@ -0,0 +1,94 @@
+#pragma once
+
+/// @file userver/utils/sharded_token_bucket.hpp
+/// @brief @copybrief utils::ShardedTokenBucket
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_concurrency
+///
+/// @brief utils::TokenBucket with per-thread caches of tokens, for the
+/// ratelimiters that are hit by every request from all the threads
+///
+/// @details Each thread obtains the tokens from the shared bucket in batches
+/// and spends them from its own cache-line sized shard, so the shared bucket
+/// and the clock are touched once per batch. When the shared bucket is empty,
+/// the tokens cached by the other threads are taken.
+///
+/// The cached tokens are not counted by the shared bucket refills, so a burst
+/// may exceed `max_size` by up to a quarter of it.
+class ShardedTokenBucket final {
+ public:
+  using Duration = TokenBucket::Duration;
+  using RefillPolicy = TokenBucket::RefillPolicy;
+
+  /// Create an initially always empty token bucket
+  ShardedTokenBucket() noexcept;
+
+  /// Create a token bucket with max_size tokens and a specified refill policy
+  ShardedTokenBucket(std::size_t max_size, RefillPolicy policy);
+
+  /// Create an initially unbounded token bucket (largest size, instant refill)
+  static ShardedTokenBucket MakeUnbounded() noexcept;
+
+  ShardedTokenBucket(const ShardedTokenBucket&) = delete;
+  ShardedTokenBucket& operator=(const ShardedTokenBucket&) = delete;
+
+  bool IsUnbounded() const;
+
+  /// Get current token limit (might be inaccurate as the result is stale)
+  std::size_t GetMaxSizeApprox() const;
+
+  /// Get rate (tokens per second)
+  double GetRatePs() const;
+
+  /// Get current token count including the cached ones (might be inaccurate
+  /// as the result is stale)
+  std::size_t GetTokensApprox();
+
+  /// Set max token count, drops the cached tokens
+  void SetMaxSize(std::size_t max_size);
+
+  /// Set refill policy for the bucket, drops the cached tokens
+  void SetRefillPolicy(RefillPolicy policy);
+
+  /// Set refill policy to "instant refill", see
+  /// utils::TokenBucket::SetInstantRefillPolicy
+  void SetInstantRefillPolicy();
+
+  /// @returns true if token was successfully obtained
+  [[nodiscard]] bool Obtain();
+
+  /// @brief Waits for a token, sleeping until the next refill between the
+  /// attempts instead of spinning
+  /// @returns true if token was obtained, false on deadline or cancellation
+  [[nodiscard]] bool WaitToken(engine::Deadline deadline);
+
+ private:
+  struct alignas(statistics::impl::kThreadShardAlignment) Shard final {
+    std::atomic<std::size_t> tokens{0};
+  };
+
+  explicit ShardedTokenBucket(TokenBucket&& bucket) noexcept;
+
+  void UpdateBatchSize();
+  void DropCachedTokens() noexcept;
+
+  TokenBucket bucket_;
+  std::atomic<std::size_t> batch_size_{1};
+  std::array<Shard, statistics::impl::kThreadShardCount> shards_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
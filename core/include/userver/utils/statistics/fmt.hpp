@@ -6,6 +6,7 @@
 /// - utils::statistics::LabelView
 /// - utils::statistics::Label
 /// - utils::statistics::LabelsSpan
+/// - utils::statistics::HistogramView
 /// - utils::statistics::MetricValue
 
 #include <variant>
@@ -14,6 +15,7 @@
 
 #include <userver/utils/fmt_compat.hpp>
 #include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
 #include <userver/utils/statistics/labels.hpp>
 #include <userver/utils/statistics/metric_value.hpp>
 #include <userver/utils/statistics/rate.hpp>
@@ -69,6 +71,23 @@ class fmt::formatter<USERVER_NAMESPACE::utils::statistics::Rate> {
       rate_format_;
 };
 
+template <>
+struct fmt::formatter<USERVER_NAMESPACE::utils::statistics::HistogramView> {
+  constexpr static auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  template <typename FormatContext>
+  auto format(USERVER_NAMESPACE::utils::statistics::HistogramView value,
+              FormatContext& ctx) USERVER_FMT_CONST {
+    auto out = ctx.out();
+    *out++ = '[';
+    for (std::size_t i = 0; i < value.GetBucketCount(); ++i) {
+      out = fmt::format_to(out, "{}:{},", value.GetUpperBoundAt(i),
+                           value.GetValueAt(i));
+    }
+    return fmt::format_to(out, "inf:{}]", value.GetValueAtInf());
+  }
+};
+
 template <>
 class fmt::formatter<USERVER_NAMESPACE::utils::statistics::MetricValue> {
  public:
@@ -87,7 +106,10 @@ class fmt::formatter<USERVER_NAMESPACE::utils::statistics::MetricValue> {
         [&](USERVER_NAMESPACE::utils::statistics::Rate x) {
           return rate_format_.format(x.value, ctx);
         },
-        [&](double x) { return float_format_.format(x, ctx); }});
+        [&](double x) { return float_format_.format(x, ctx); },
+        [&](USERVER_NAMESPACE::utils::statistics::HistogramView x) {
+          return fmt::format_to(ctx.out(), "{}", x);
+        }});
   }
 
  private:
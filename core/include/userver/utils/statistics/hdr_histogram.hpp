@@ -0,0 +1,246 @@
+#pragma once
+
+/// @file userver/utils/statistics/hdr_histogram.hpp
+/// @brief @copybrief utils::statistics::HdrHistogram
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/statistics/histogram_view.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+template <std::size_t PrecisionBits>
+constexpr std::size_t GetHdrBucketIndex(std::uint64_t value) noexcept {
+  constexpr std::uint64_t kSubBucketCount = std::uint64_t{1} << PrecisionBits;
+  if (value < kSubBucketCount) return value;
+  const std::size_t msb = 63 - __builtin_clzll(value);
+  const auto shift = msb - PrecisionBits;
+  return ((shift + 1) << PrecisionBits) + ((value >> shift) - kSubBucketCount);
+}
+
+template <std::size_t PrecisionBits>
+constexpr std::uint64_t GetHdrUpperBoundAt(std::size_t index) noexcept {
+  constexpr std::uint64_t kSubBucketCount = std::uint64_t{1} << PrecisionBits;
+  if (index < kSubBucketCount) return index;
+  const auto shift = (index >> PrecisionBits) - 1;
+  const auto mantissa = kSubBucketCount + (index & (kSubBucketCount - 1));
+  return ((mantissa + 1) << shift) - 1;
+}
+
+}  // namespace impl
+
+/// @brief A lock-free histogram with log-linear buckets, that has a bounded
+/// relative error for all the values.
+///
+/// Values below `2^PrecisionBits` are counted precisely, then each power of 2
+/// is split into `2^PrecisionBits` equal buckets. For the default
+/// `PrecisionBits = 3` the relative error of a bucket bound is at most 12.5%.
+/// The values above `MaxValue` are counted in the `+Inf` bucket.
+///
+/// Account() does a couple of relaxed atomic increments in the shard of the
+/// current thread, so the histogram scales with the count of writers. The
+/// shards are merged on read.
+///
+/// The histogram is written as a utils::statistics::HistogramView, that is
+/// exported as a native histogram: `_bucket` series in Prometheus, `HIST_RATE`
+/// in Solomon.
+///
+/// The histogram could be used in utils::statistics::RecentPeriod.
+///
+/// @code
+/// utils::statistics::HdrHistogram<60'000> timings_ms;
+///
+/// void Account(std::chrono::milliseconds ms) {
+///   timings_ms.Account(ms.count());
+/// }
+///
+/// void DumpMetric(utils::statistics::Writer& writer) {
+///   writer["timings"] = timings_ms;
+/// }
+/// @endcode
+///
+/// @tparam MaxValue the largest value that is counted in the buckets
+/// @tparam PrecisionBits the count of the significant bits of the buckets
+template <std::uint64_t MaxValue, std::size_t PrecisionBits = 3>
+class HdrHistogram final {
+  static_assert(MaxValue > 0, "MaxValue must be positive");
+  static_assert(PrecisionBits >= 1 && PrecisionBits <= 10,
+                "PrecisionBits must be in [1, 10]");
+
+ public:
+  /// @returns the index of the bucket that counts the value, values above
+  /// MaxValue may have indexes not less than kBucketCount
+  static constexpr std::size_t GetBucketIndex(std::uint64_t value) noexcept {
+    return impl::GetHdrBucketIndex<PrecisionBits>(value);
+  }
+
+  /// @returns the largest value that is counted in the bucket
+  static constexpr std::uint64_t GetUpperBoundAt(std::size_t index) noexcept {
+    return impl::GetHdrUpperBoundAt<PrecisionBits>(index);
+  }
+
+  /// The count of the buckets, not counting the `+Inf` bucket
+  static constexpr std::size_t kBucketCount =
+      impl::GetHdrBucketIndex<PrecisionBits>(MaxValue) + 1;
+
+  /// @cond
+  // Counts of all the buckets, the last one is the `+Inf` bucket
+  using Counts = std::array<std::uint64_t, kBucketCount + 1>;
+  /// @endcond
+
+  HdrHistogram() noexcept { Reset(); }
+
+  HdrHistogram(const HdrHistogram& other) noexcept { *this = other; }
+
+  HdrHistogram& operator=(const HdrHistogram& rhs) noexcept {
+    if (this == &rhs) return *this;
+    Reset();
+    Add(rhs);
+    return *this;
+  }
+
+  /// @brief Account for @p count occurrences of the @p value
+  void Account(std::uint64_t value, std::uint64_t count = 1) noexcept {
+    const auto index = GetBucketIndex(value);
+    auto& shard = shards_[impl::GetThreadShardIndex()];
+    shard.counts[index < kBucketCount ? index : kBucketCount].fetch_add(
+        count, std::memory_order_relaxed);
+    shard.sum.fetch_add(value * count, std::memory_order_relaxed);
+  }
+
+  /// @brief Get X percentile - the upper bound of the first bucket, such that
+  /// the total number of elements in the buckets up to it is no less than X
+  /// percent. Returns `GetUpperBoundAt(kBucketCount - 1)` if the percentile
+  /// falls into the `+Inf` bucket, and 0 for an empty histogram.
+  /// @param percent - value in [0..100] - requested percentile
+  std::uint64_t GetPercentile(double percent) const noexcept {
+    return GetPercentileOf(LoadCounts(), percent);
+  }
+
+  /// @cond
+  // GetPercentile() of the counts, e.g. of a difference of two LoadCounts()
+  static std::uint64_t GetPercentileOf(const Counts& counts,
+                                       double percent) noexcept {
+    std::uint64_t total = 0;
+    for (const auto count : counts) total += count;
+    if (total == 0) return 0;
+
+    const auto want_sum = static_cast<double>(total) * percent;
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+      sum += counts[i];
+      if (counts[i] != 0 && static_cast<double>(sum) * 100 >= want_sum) {
+        return GetUpperBoundAt(i);
+      }
+    }
+    return GetUpperBoundAt(kBucketCount - 1);
+  }
+  /// @endcond
+
+  /// @brief Total number of elements
+  std::uint64_t Count() const noexcept {
+    std::uint64_t total = 0;
+    for (const auto& shard : shards_) {
+      for (const auto& count : shard.counts) {
+        total += count.load(std::memory_order_relaxed);
+      }
+    }
+    return total;
+  }
+
+  /// @brief The sum of all the accounted values
+  std::uint64_t Sum() const noexcept {
+    std::uint64_t sum = 0;
+    for (const auto& shard : shards_) {
+      sum += shard.sum.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+  template <class Duration = std::chrono::seconds>
+  void Add(const HdrHistogram& other,
+           [[maybe_unused]] Duration this_epoch_duration = Duration(),
+           [[maybe_unused]] Duration before_this_epoch_duration = Duration()) {
+    const auto counts = other.LoadCounts();
+    auto& shard = shards_[impl::GetThreadShardIndex()];
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+      if (counts[i] != 0) {
+        shard.counts[i].fetch_add(counts[i], std::memory_order_relaxed);
+      }
+    }
+    shard.sum.fetch_add(other.Sum(), std::memory_order_relaxed);
+  }
+
+  void Reset() noexcept {
+    for (auto& shard : shards_) {
+      for (auto& count : shard.counts) {
+        count.store(0, std::memory_order_relaxed);
+      }
+      shard.sum.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /// @cond
+  // Merged counts of all the shards
+  Counts LoadCounts() const noexcept {
+    Counts result{};
+    for (const auto& shard : shards_) {
+      for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] += shard.counts[i].load(std::memory_order_relaxed);
+      }
+    }
+    return result;
+  }
+  /// @endcond
+
+ private:
+  struct alignas(impl::kThreadShardAlignment) Shard final {
+    std::array<std::atomic<std::uint64_t>, kBucketCount + 1> counts;
+    std::atomic<std::uint64_t> sum;
+  };
+
+  std::array<Shard, impl::kThreadShardCount> shards_;
+};
+
+/// @cond
+namespace impl {
+
+template <typename Histogram>
+constexpr auto MakeHdrHistogramBounds() noexcept {
+  std::array<double, Histogram::kBucketCount> result{};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = static_cast<double>(Histogram::GetUpperBoundAt(i));
+  }
+  return result;
+}
+
+template <typename Histogram>
+inline constexpr auto kHdrHistogramBounds = MakeHdrHistogramBounds<Histogram>();
+
+}  // namespace impl
+/// @endcond
+
+template <std::uint64_t MaxValue, std::size_t PrecisionBits>
+void DumpMetric(Writer& writer,
+                const HdrHistogram<MaxValue, PrecisionBits>& histogram) {
+  using Histogram = HdrHistogram<MaxValue, PrecisionBits>;
+  const auto counts = histogram.LoadCounts();
+  writer = HistogramView{impl::kHdrHistogramBounds<Histogram>.data(),
+                         counts.data(), Histogram::kBucketCount,
+                         counts[Histogram::kBucketCount],
+                         static_cast<double>(histogram.Sum())};
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
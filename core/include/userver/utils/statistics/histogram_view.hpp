@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/utils/statistics/histogram_view.hpp
+/// @brief @copybrief utils::statistics::HistogramView
+
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief The non-owning read-only view of the histogram buckets, that is
+/// written into utils::statistics::Writer and is received by the metrics
+/// formats in utils::statistics::MetricValue.
+///
+/// Bucket `i` counts the values in `(GetUpperBoundAt(i - 1),
+/// GetUpperBoundAt(i)]`, the values above the last bound are counted in the
+/// `+Inf` bucket. The counts are not cumulative.
+///
+/// The view is only valid while the metric is being written, copy the data if
+/// it is required afterwards.
+///
+/// @see utils::statistics::HdrHistogram
+class HistogramView final {
+ public:
+  /// @cond
+  HistogramView(const double* upper_bounds, const std::uint64_t* counts,
+                std::size_t bucket_count, std::uint64_t inf_count,
+                double sum) noexcept
+      : upper_bounds_(upper_bounds),
+        counts_(counts),
+        bucket_count_(bucket_count),
+        inf_count_(inf_count),
+        sum_(sum) {}
+  /// @endcond
+
+  /// @returns the number of buckets, not counting the `+Inf` bucket
+  std::size_t GetBucketCount() const noexcept { return bucket_count_; }
+
+  /// @returns the inclusive upper bound of the bucket
+  double GetUpperBoundAt(std::size_t index) const;
+
+  /// @returns the number of values in the bucket
+  std::uint64_t GetValueAt(std::size_t index) const;
+
+  /// @returns the number of values above the last upper bound
+  std::uint64_t GetValueAtInf() const noexcept { return inf_count_; }
+
+  /// @returns the number of values in all the buckets
+  std::uint64_t GetTotalCount() const noexcept;
+
+  /// @returns the sum of all the accounted values
+  double GetSum() const noexcept { return sum_; }
+
+ private:
+  const double* upper_bounds_;
+  const std::uint64_t* counts_;
+  std::size_t bucket_count_;
+  std::uint64_t inf_count_;
+  double sum_;
+};
+
+/// Compares the bounds and the counts of the histograms
+bool operator==(HistogramView lhs, HistogramView rhs) noexcept;
+
+bool operator!=(HistogramView lhs, HistogramView rhs) noexcept;
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
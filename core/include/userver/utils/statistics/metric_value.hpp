@@ -6,17 +6,18 @@
 #include <cstdint>
 #include <variant>
 
+#include <userver/utils/statistics/histogram_view.hpp>
 #include <userver/utils/statistics/rate.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::statistics {
 
-/// @brief The value of a metric. Only integer and floating-point metrics are
-/// allowed.
+/// @brief The value of a metric. Only integer, floating-point, Rate and
+/// histogram metrics are allowed.
 class MetricValue final {
  public:
-  using RawType = std::variant<std::int64_t, double, Rate>;
+  using RawType = std::variant<std::int64_t, double, Rate, HistogramView>;
 
   MetricValue(const MetricValue&) = default;
   MetricValue& operator=(const MetricValue&) = default;
@@ -44,7 +45,17 @@ class MetricValue final {
   /// @brief Returns whether metric is Rate metric
   bool IsRate() const noexcept { return std::holds_alternative<Rate>(value_); }
 
-  /// @brief Calls @p visitor with either a `std::int64_t` or a `double` value.
+  /// @brief Retrieve the value of a histogram metric.
+  /// @throws std::exception on type mismatch.
+  HistogramView AsHistogram() const { return std::get<HistogramView>(value_); }
+
+  /// @brief Returns whether metric is a histogram metric
+  bool IsHistogram() const noexcept {
+    return std::holds_alternative<HistogramView>(value_);
+  }
+
+  /// @brief Calls @p visitor with either a `std::int64_t`, a `double`, a
+  /// `Rate` or a `HistogramView` value.
   /// @returns Whatever @p visitor returns.
   template <typename VisitorFunc>
   decltype(auto) Visit(VisitorFunc visitor) const {
@@ -16,6 +16,9 @@ namespace utils::statistics {
 ///
 /// This class is represented as Rate metric when serializing to statistics.
 /// Otherwise it is the same class as RelaxedCounter
+///
+/// @see utils::statistics::ShardedRateCounter for the counters that are updated
+/// from many threads at once
 class RateCounter final {
  public:
   using ValueType = Rate;
@@ -12,6 +12,9 @@ USERVER_NAMESPACE_BEGIN
 namespace utils::statistics {
 
 /// @brief Atomic counter of type T with relaxed memory ordering
+///
+/// @see utils::statistics::ShardedCounter for the counters that are updated
+/// from many threads at once
 template <class T>
 class RelaxedCounter final {
  public:
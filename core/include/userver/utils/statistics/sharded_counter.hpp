@@ -0,0 +1,167 @@
+#pragma once
+
+/// @file userver/utils/statistics/sharded_counter.hpp
+/// @brief @copybrief utils::statistics::ShardedCounter
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+inline constexpr std::size_t kThreadShardCount = 8;
+
+// The size of a cache line on all the supported platforms
+inline constexpr std::size_t kThreadShardAlignment = 64;
+
+// Each thread sticks to its own shard, the shards are assigned round-robin
+std::size_t GetThreadShardIndex() noexcept;
+
+}  // namespace impl
+
+/// @brief Atomic counter of type T with relaxed memory ordering, that is split
+/// into cache-line sized shards to avoid the contention of the writers.
+///
+/// Each thread increments its own shard, the shards are summed on Load(). Use
+/// it instead of utils::statistics::RelaxedCounter for the counters that are
+/// updated on each request from all the threads. The counter occupies
+/// `impl::kThreadShardCount` cache lines.
+///
+/// Store() is not atomic with respect to the concurrent increments.
+template <class T>
+class ShardedCounter final {
+  static_assert(std::is_integral_v<T>, "Only integral counters are supported");
+
+ public:
+  using ValueType = T;
+
+  ShardedCounter() noexcept { Store(T{}); }
+  ShardedCounter(T desired) noexcept { Store(desired); }
+
+  ShardedCounter(const ShardedCounter& other) noexcept { Store(other.Load()); }
+
+  ShardedCounter& operator=(const ShardedCounter& other) noexcept {
+    if (this == &other) return *this;
+
+    Store(other.Load());
+    return *this;
+  }
+
+  ShardedCounter& operator=(T desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  void Store(T desired) noexcept {
+    for (auto& shard : shards_) shard.value.store(T{}, kOrder);
+    shards_[0].value.store(desired, kOrder);
+  }
+
+  T Load() const noexcept {
+    T result{};
+    for (const auto& shard : shards_) result += shard.value.load(kOrder);
+    return result;
+  }
+
+  operator T() const noexcept { return Load(); }
+
+  ShardedCounter& operator++() noexcept { return *this += 1; }
+
+  void operator++(int) noexcept { *this += 1; }
+
+  ShardedCounter& operator--() noexcept { return *this -= 1; }
+
+  void operator--(int) noexcept { *this -= 1; }
+
+  ShardedCounter& operator+=(T arg) noexcept {
+    GetLocalShard().fetch_add(arg, kOrder);
+    return *this;
+  }
+
+  ShardedCounter& operator-=(T arg) noexcept {
+    GetLocalShard().fetch_sub(arg, kOrder);
+    return *this;
+  }
+
+ private:
+  static_assert(std::atomic<T>::is_always_lock_free);
+
+  static constexpr auto kOrder = std::memory_order_relaxed;
+
+  struct alignas(impl::kThreadShardAlignment) Shard final {
+    std::atomic<T> value;
+  };
+
+  std::atomic<T>& GetLocalShard() noexcept {
+    return shards_[impl::GetThreadShardIndex()].value;
+  }
+
+  std::array<Shard, impl::kThreadShardCount> shards_;
+};
+
+template <typename T>
+void DumpMetric(Writer& writer, const ShardedCounter<T>& value) {
+  writer = value.Load();
+}
+
+template <typename T>
+void ResetMetric(ShardedCounter<T>& value) {
+  value.Store(T{});
+}
+
+/// @brief Sharded counter of type Rate with relaxed memory ordering
+///
+/// This class is represented as Rate metric when serializing to statistics.
+/// Otherwise it is the same class as utils::statistics::ShardedCounter, use it
+/// instead of utils::statistics::RateCounter for the contended counters.
+class ShardedRateCounter final {
+ public:
+  using ValueType = Rate;
+
+  ShardedRateCounter() noexcept = default;
+  explicit ShardedRateCounter(Rate desired) noexcept : val_(desired.value) {}
+  explicit ShardedRateCounter(Rate::ValueType desired) noexcept
+      : val_(desired) {}
+
+  void Store(Rate desired) noexcept { val_.Store(desired.value); }
+
+  Rate Load() const noexcept { return Rate{val_.Load()}; }
+
+  void Add(Rate arg) noexcept { val_ += arg.value; }
+
+  ShardedRateCounter& operator=(Rate desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  ShardedRateCounter& operator++() noexcept {
+    ++val_;
+    return *this;
+  }
+
+  void operator++(int) noexcept { ++val_; }
+
+  ShardedRateCounter& operator+=(Rate arg) noexcept {
+    Add(arg);
+    return *this;
+  }
+
+ private:
+  ShardedCounter<Rate::ValueType> val_;
+};
+
+void DumpMetric(Writer& writer, const ShardedRateCounter& value);
+
+void ResetMetric(ShardedRateCounter& value);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
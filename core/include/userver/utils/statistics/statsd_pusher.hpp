@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file userver/utils/statistics/statsd_pusher.hpp
+/// @brief @copybrief components::StatsdPusher
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <userver/components/component_fwd.hpp>
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically pushes the metrics from
+/// components::StatisticsStorage to a StatsD agent over UDP.
+///
+/// The metrics are sent in the StatsD format with DogStatsD tags for the
+/// labels. Rate metrics are sent as counters with the increase since the
+/// previous push (delta temporality), other metrics are sent as gauges.
+/// Histograms are not sent. The lines are packed into datagrams of at most
+/// `max-datagram-size` bytes, and the datagrams are sent in batches with
+/// `sendmmsg` on Linux.
+///
+/// The metrics are also pushed once when the service is stopping, so the
+/// short-lived processes do not lose the last period.
+///
+/// The host is resolved with clients::dns::Component on each push.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// host | host of the StatsD agent | localhost
+/// port | UDP port of the StatsD agent | 8125
+/// period | period of the metrics push | 10s
+/// max-datagram-size | max size of a UDP datagram | 1432
+/// prefix | push only the metrics with the path that starts with the prefix | -
+/// labels | labels to add to each metric | {}
+
+// clang-format on
+
+class StatsdPusher final : public LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::StatsdPusher
+  static constexpr std::string_view kName = "statsd-pusher";
+
+  StatsdPusher(const ComponentConfig&, const ComponentContext&);
+  ~StatsdPusher() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  void OnAllComponentsAreStopping() override;
+
+  void WriteStatistics(utils::statistics::Writer& writer);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<StatsdPusher> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -21,7 +21,9 @@ void Merge(Schema& destination, Schema&& source);
 template <typename ParentComponent>
 Schema MergeSchemas(const std::string& yaml_string) {
   auto schema = impl::SchemaFromString(yaml_string);
-  impl::Merge(schema, ParentComponent::GetStaticConfigSchema());
+  // Many components share the parents, copying is cheaper than parsing
+  static const Schema kParentSchema = ParentComponent::GetStaticConfigSchema();
+  impl::Merge(schema, Schema{kParentSchema});
   return schema;
 }
 
@@ -34,6 +34,15 @@ class SchemaPtr final {
  public:
   explicit SchemaPtr(Schema&& schema);
 
+  /// Makes a deep copy of the schema
+  SchemaPtr(const SchemaPtr& other);
+  SchemaPtr& operator=(const SchemaPtr& other);
+
+  SchemaPtr(SchemaPtr&&) noexcept = default;
+  SchemaPtr& operator=(SchemaPtr&&) noexcept = default;
+
+  ~SchemaPtr();
+
   const Schema& operator*() const { return *schema_; }
   Schema& operator*() { return *schema_; }
 
@@ -91,7 +91,7 @@ const BaggageEntryProperty& BaggageEntry::GetProperty(
   throw BaggageException("Entry doesn't contain selected property");
 }
 
-std::string Baggage::ToString() const {
+const std::string& Baggage::ToString() const {
   if (is_valid_header_) {
     return header_value_;
   }
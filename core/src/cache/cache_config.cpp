@@ -34,6 +34,7 @@ constexpr std::string_view kExceptionInterval = "exception-interval";
 constexpr std::string_view kCleanupInterval = "additional-cleanup-interval";
 constexpr std::string_view kIsStrongPeriod = "is-strong-period";
 constexpr std::string_view kHasPreAssignCheck = "has-pre-assign-check";
+constexpr std::string_view kJemallocArena = "jemalloc-arena";
 
 constexpr std::string_view kFirstUpdateFailOk = "first-update-fail-ok";
 constexpr std::string_view kUpdateTypes = "update-types";
@@ -43,6 +44,7 @@ constexpr std::string_view kConfigSettings = "config-settings";
 
 constexpr std::string_view kFirstUpdateMode = "first-update-mode";
 constexpr std::string_view kFirstUpdateType = "first-update-type";
+constexpr std::string_view kLoadInBackground = "load-in-background";
 
 constexpr auto kDefaultCleanupInterval = std::chrono::seconds{10};
 
@@ -134,6 +136,7 @@ Config::Config(const yaml_config::YamlConfig& config,
           config[kForcePeriodicUpdates].As<std::optional<bool>>()),
       config_updates_enabled(config[kConfigSettings].As<bool>(true)),
       has_pre_assign_check(config[kHasPreAssignCheck].As<bool>(false)),
+      jemalloc_arena(config[kJemallocArena].As<bool>(false)),
       task_processor_name(
           config[kTaskProcessor].As<std::optional<std::string>>()),
       cleanup_interval(config[kCleanupInterval].As<std::chrono::milliseconds>(
@@ -147,6 +150,8 @@ Config::Config(const yaml_config::YamlConfig& config,
       first_update_type(
           config[dump::kDump][kFirstUpdateType].As<FirstUpdateType>(
               FirstUpdateType::kFull)),
+      load_dump_in_background(
+          config[dump::kDump][kLoadInBackground].As<bool>(false)),
       update_interval(config[kUpdateInterval].As<std::chrono::milliseconds>(0)),
       update_jitter(config[kUpdateJitter].As<std::chrono::milliseconds>(
           GetDefaultJitter(update_interval))),
@@ -204,6 +209,14 @@ Config::Config(const yaml_config::YamlConfig& config,
           dump::kMaxDumpAge, dump::kMaxDumpAge));
     }
 
+    if (load_dump_in_background &&
+        first_update_mode == FirstUpdateMode::kRequired) {
+      throw ConfigError(fmt::format(
+          "'{}' can't be set together with '{}: required' for cache at '{}', "
+          "because the cache contents are not available right after start",
+          kLoadInBackground, kFirstUpdateMode, config.GetPath()));
+    }
+
     if (first_update_mode == FirstUpdateMode::kSkip) {
       if (config[dump::kDump].HasMember(kFirstUpdateType)) {
         LOG_WARNING() << fmt::format(
@@ -16,6 +16,11 @@ constexpr const char* kStatisticsNameAny = "any";
 constexpr const char* kStatisticsNameCurrentDocumentsCount =
     "current-documents-count";
 
+template <typename Duration>
+std::chrono::milliseconds ToMilliseconds(Duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+}
+
 template <typename Clock, typename Duration>
 std::int64_t TimeStampToMillisecondsFromNow(
     std::chrono::time_point<Clock, Duration> time) {
@@ -110,6 +115,21 @@ impl::UpdateState UpdateStatisticsScope::GetState(utils::InternalTag) const {
   return state_;
 }
 
+impl::UpdateStagesDurations UpdateStatisticsScope::GetStagesDurations(
+    utils::InternalTag) const {
+  const auto now = std::chrono::steady_clock::now();
+  const auto finish_time = state_ == impl::UpdateState::kNotFinished
+                               ? now
+                               : update_finish_time_;
+
+  impl::UpdateStagesDurations durations;
+  durations.fetch = ToMilliseconds(fetch_time_);
+  durations.parse = ToMilliseconds(parse_time_);
+  durations.publish = ToMilliseconds(now - finish_time);
+  durations.total = ToMilliseconds(now - update_start_time_);
+  return durations;
+}
+
 void UpdateStatisticsScope::Finish(std::size_t total_documents_count) {
   stats_.documents_current_count = total_documents_count;
   DoFinish(impl::UpdateState::kSuccess);
@@ -133,6 +153,16 @@ void UpdateStatisticsScope::IncreaseDocumentsParseFailures(std::size_t add) {
   update_stats_.documents_parse_failures += add;
 }
 
+void UpdateStatisticsScope::AddFetchTime(
+    std::chrono::steady_clock::duration duration) {
+  fetch_time_ += duration;
+}
+
+void UpdateStatisticsScope::AddParseTime(
+    std::chrono::steady_clock::duration duration) {
+  parse_time_ += duration;
+}
+
 void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   UASSERT(new_state != impl::UpdateState::kNotFinished);
   // TODO Some production caches call Finish multiple times. We should fix those
@@ -140,6 +170,7 @@ void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   if (state_ != impl::UpdateState::kNotFinished) return;
 
   const auto update_stop_time = std::chrono::steady_clock::now();
+  update_finish_time_ = update_stop_time;
   if (new_state == impl::UpdateState::kSuccess) {
     update_stats_.last_successful_update_start_time = update_start_time_;
   }
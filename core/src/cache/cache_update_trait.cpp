@@ -5,6 +5,7 @@
 #include <cache/cache_dependencies.hpp>
 #include <cache/cache_update_trait_impl.hpp>
 #include <userver/dump/helpers.hpp>
+#include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,6 +30,11 @@ void CacheUpdateTrait::InvalidateAsync(UpdateType update_type) {
 
 const std::string& CacheUpdateTrait::Name() const { return impl_->Name(); }
 
+std::optional<impl::UpdateStagesDurations>
+CacheUpdateTrait::GetFirstUpdateStagesDurations(utils::InternalTag) const {
+  return impl_->GetFirstUpdateStagesDurations();
+}
+
 AllowedUpdateTypes CacheUpdateTrait::GetAllowedUpdateTypes() const {
   return impl_->GetAllowedUpdateTypes();
 }
@@ -21,6 +21,7 @@
 #include <userver/dump/factory.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 #include <utils/internal_tag.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -100,6 +101,16 @@ CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies,
       periodic_task_flags_{utils::PeriodicTask::Flags::kChaotic,
                            utils::PeriodicTask::Flags::kCritical},
       dumpable_(customized_trait_) {
+  if (static_config_.jemalloc_arena) {
+    unsigned arena = 0;
+    if (const auto ec = utils::jemalloc::CreateArena(arena)) {
+      LOG_WARNING() << "Failed to create a jemalloc arena for cache '" << name_
+                    << "': " << ec.message();
+    } else {
+      memory_arena_ = arena;
+    }
+  }
+
   if (dependencies.dump_config) {
     dumper_.emplace(*dependencies.dump_config,
                     CheckNotNull(std::move(dependencies.dump_rw_factory)),
@@ -111,7 +122,14 @@ CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies,
 
   statistics_holder_ = dependencies.statistics_storage.RegisterWriter(
       "cache", [this](utils::statistics::Writer& writer) {
-        writer.ValueWithLabels(statistics_, {"cache_name", Name()});
+        const utils::statistics::LabelView label{"cache_name", Name()};
+        writer.ValueWithLabels(statistics_, label);
+
+        utils::jemalloc::ArenaStats arena_stats;
+        if (memory_arena_ &&
+            !utils::jemalloc::GetArenaStats(*memory_arena_, arena_stats)) {
+          writer["memory"].ValueWithLabels(arena_stats, label);
+        }
       });
 
   if (dependencies.config.config_updates_enabled) {
@@ -157,83 +175,102 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
   cache_invalidator_holder_.emplace(cache_control_, customized_trait_);
 
   try {
-    const auto config = GetConfig();
-
-    const auto dump_time = dumper_ ? dumper_->ReadDump() : std::nullopt;
-    if (dump_time) {
-      last_update_ = *dump_time;
-      dump_first_update_type_ =
-          config->first_update_type == FirstUpdateType::kFull
-              ? UpdateType::kFull
-              : UpdateType::kIncremental;
+    if (static_config_.load_dump_in_background && dumper_ &&
+        periodic_update_enabled_) {
+      // The service starts without waiting for the cache contents, until
+      // then the cache stays empty
+      background_start_task_ = utils::CriticalAsync(
+          task_processor_, "background-start/" + name_, [this, flags] {
+            try {
+              DoStartPeriodicUpdates(flags, /*in_background=*/true);
+            } catch (const std::exception& ex) {
+              LOG_ERROR() << "Failed to start updates of cache " << name_
+                          << " in background. Reason: " << ex;
+            }
+          });
+    } else {
+      DoStartPeriodicUpdates(flags, /*in_background=*/false);
     }
+  } catch (...) {
+    is_running_ = false;  // update_task_ is not started, don't check it in dtr
+    throw;
+  }
+}
 
-    if ((last_update_ == std::chrono::system_clock::time_point{} ||
-         config->first_update_mode != FirstUpdateMode::kSkip) &&
-        (!(flags & CacheUpdateTrait::Flag::kNoFirstUpdate) ||
-         !periodic_update_enabled_)) {
-      // ignore kNoFirstUpdate if !periodic_update_enabled_
-      // because some components require caches to be updated at least once
-
-      // `InvalidateAsync` called up to this point should not result in an
-      // extra update
-      first_update_invalidation_ = FirstUpdateInvalidation::kNo;
-
-      // Force first update, do it synchronously
-      const tracing::Span span("first-update/" + name_);
-      try {
-        DoPeriodicUpdate();
-      } catch (const std::exception& e) {
-        if (dump_time &&
-            config->first_update_mode != FirstUpdateMode::kRequired) {
-          LOG_ERROR() << "Failed to update cache " << name_
-                      << " after loading a cache dump, going on with the "
-                         "contents loaded from the dump";
-        } else if (static_config_.allow_first_update_failure) {
-          LOG_ERROR() << "Failed to update cache " << name_
-                      << " for the first time, leaving it empty";
-        } else {
-          LOG_ERROR() << "Failed to update cache " << name_
-                      << " for the first time";
-          throw;
-        }
+void CacheUpdateTrait::Impl::DoStartPeriodicUpdates(
+    utils::Flags<CacheUpdateTrait::Flag> flags, bool in_background) {
+  const auto config = GetConfig();
+
+  const auto dump_time = dumper_ ? dumper_->ReadDump() : std::nullopt;
+  if (dump_time) {
+    last_update_ = *dump_time;
+    dump_first_update_type_ =
+        config->first_update_type == FirstUpdateType::kFull
+            ? UpdateType::kFull
+            : UpdateType::kIncremental;
+  }
+
+  if ((last_update_ == std::chrono::system_clock::time_point{} ||
+       config->first_update_mode != FirstUpdateMode::kSkip) &&
+      (!(flags & CacheUpdateTrait::Flag::kNoFirstUpdate) ||
+       !periodic_update_enabled_)) {
+    // ignore kNoFirstUpdate if !periodic_update_enabled_
+    // because some components require caches to be updated at least once
+
+    // `InvalidateAsync` called up to this point should not result in an
+    // extra update
+    first_update_invalidation_ = FirstUpdateInvalidation::kNo;
+
+    // Force first update, do it synchronously
+    const tracing::Span span("first-update/" + name_);
+    try {
+      DoPeriodicUpdate();
+    } catch (const std::exception& e) {
+      if (dump_time &&
+          config->first_update_mode != FirstUpdateMode::kRequired) {
+        LOG_ERROR() << "Failed to update cache " << name_
+                    << " after loading a cache dump, going on with the "
+                       "contents loaded from the dump";
+      } else if (static_config_.allow_first_update_failure || in_background) {
+        LOG_ERROR() << "Failed to update cache " << name_
+                    << " for the first time, leaving it empty";
+      } else {
+        LOG_ERROR() << "Failed to update cache " << name_
+                    << " for the first time";
+        throw;
       }
     }
+  }
 
-    if (dump_time && config->first_update_type ==
-                         FirstUpdateType::kIncrementalThenAsyncFull) {
-      dump_first_update_type_ = UpdateType::kFull;
-      periodic_task_flags_ |= utils::PeriodicTask::Flags::kNow;
-    }
+  if (dump_time && config->first_update_type ==
+                       FirstUpdateType::kIncrementalThenAsyncFull) {
+    dump_first_update_type_ = UpdateType::kFull;
+    periodic_task_flags_ |= utils::PeriodicTask::Flags::kNow;
+  }
 
-    if (config->is_strong_period) {
-      periodic_task_flags_ |= utils::PeriodicTask::Flags::kStrong;
-    }
+  if (config->is_strong_period) {
+    periodic_task_flags_ |= utils::PeriodicTask::Flags::kStrong;
+  }
 
-    if (periodic_update_enabled_) {
-      const auto first_update_invalidation =
-          first_update_invalidation_.exchange(
-              FirstUpdateInvalidation::kFinished);
-      if (first_update_invalidation == FirstUpdateInvalidation::kYes) {
-        update_task_.ForceStepAsync();
-      }
+  if (periodic_update_enabled_) {
+    const auto first_update_invalidation =
+        first_update_invalidation_.exchange(FirstUpdateInvalidation::kFinished);
+    if (first_update_invalidation == FirstUpdateInvalidation::kYes) {
+      update_task_.ForceStepAsync();
+    }
 
-      update_task_.Start(update_task_name_, GetPeriodicTaskSettings(*config),
-                         [this] { DoPeriodicUpdate(); });
+    update_task_.Start(update_task_name_, GetPeriodicTaskSettings(*config),
+                       [this] { DoPeriodicUpdate(); });
 
-      utils::PeriodicTask::Settings cleanup_settings(config->cleanup_interval);
-      cleanup_settings.span_level = logging::Level::kNone;
-      cleanup_settings.task_processor = &task_processor_;
+    utils::PeriodicTask::Settings cleanup_settings(config->cleanup_interval);
+    cleanup_settings.span_level = logging::Level::kNone;
+    cleanup_settings.task_processor = &task_processor_;
 
-      cleanup_task_.Start("rcu-cleanup-task/" + name_, cleanup_settings,
-                          [this] {
-                            config_.Cleanup();
-                            customized_trait_.Cleanup();
-                          });
-    }
-  } catch (...) {
-    is_running_ = false;  // update_task_ is not started, don't check it in dtr
-    throw;
+    cleanup_task_.Start("rcu-cleanup-task/" + name_, cleanup_settings,
+                        [this] {
+                          config_.Cleanup();
+                          customized_trait_.Cleanup();
+                        });
   }
 }
 
@@ -242,6 +279,10 @@ void CacheUpdateTrait::Impl::StopPeriodicUpdates() {
     return;
   }
 
+  if (background_start_task_.IsValid()) {
+    background_start_task_.SyncCancel();
+  }
+
   cache_invalidator_holder_.reset();
   config_subscription_.Unsubscribe();
   statistics_holder_.Unregister();
@@ -359,6 +400,12 @@ engine::TaskProcessor& CacheUpdateTrait::Impl::GetCacheTaskProcessor() const {
   return task_processor_;
 }
 
+std::optional<impl::UpdateStagesDurations>
+CacheUpdateTrait::Impl::GetFirstUpdateStagesDurations() const {
+  const auto first_update_stages = first_update_stages_.Lock();
+  return *first_update_stages;
+}
+
 void CacheUpdateTrait::Impl::DoUpdate(UpdateType update_type) {
   const auto steady_now = utils::datetime::SteadyNow();
   const auto now =
@@ -369,10 +416,17 @@ void CacheUpdateTrait::Impl::DoUpdate(UpdateType update_type) {
                                       std::string{update_type_str});
 
   UpdateStatisticsScope stats(statistics_, update_type);
+  const utils::jemalloc::ArenaScope arena_scope{memory_arena_};
   LOG_INFO() << "Updating cache update_type=" << update_type_str
              << " name=" << name_;
 
   customized_trait_.Update(update_type, last_update_, now, stats);
+  {
+    auto first_update_stages = first_update_stages_.Lock();
+    if (!*first_update_stages) {
+      *first_update_stages = stats.GetStagesDurations(utils::InternalTag{});
+    }
+  }
 
   switch (stats.GetState(utils::InternalTag{})) {
     case impl::UpdateState::kNotFinished:
@@ -429,6 +483,7 @@ void CacheUpdateTrait::Impl::DumpableEntityProxy::GetAndWrite(
 
 void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndSet(
     dump::Reader& reader) {
+  const utils::jemalloc::ArenaScope arena_scope{cache_.impl_->memory_arena_};
   cache_.ReadAndSet(reader);
 }
 
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -10,8 +11,10 @@
 
 #include <userver/components/component_fwd.hpp>
 #include <userver/concurrent/async_event_channel.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/periodic_task.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -59,6 +62,9 @@ class CacheUpdateTrait::Impl final {
 
   engine::TaskProcessor& GetCacheTaskProcessor() const;
 
+  std::optional<impl::UpdateStagesDurations> GetFirstUpdateStagesDurations()
+      const;
+
  private:
   class DumpableEntityProxy final : public dump::DumpableEntity {
    public:
@@ -76,6 +82,10 @@ class CacheUpdateTrait::Impl final {
 
   UpdateType NextUpdateType(const Config& config);
 
+  // Reads the dump, performs the first update and starts the periodic tasks
+  void DoStartPeriodicUpdates(utils::Flags<CacheUpdateTrait::Flag> flags,
+                              bool in_background);
+
   void DoPeriodicUpdate();
 
   void OnPeriodicUpdateFailure();
@@ -119,9 +129,19 @@ class CacheUpdateTrait::Impl final {
   std::optional<UpdateType> dump_first_update_type_;
   std::atomic<bool> force_full_update_{false};
 
+  // The first update may run in background with `first-update-mode: skip`
+  concurrent::Variable<std::optional<impl::UpdateStagesDurations>,
+                       std::mutex>
+      first_update_stages_;
+
+  // Is created only with the `jemalloc-arena` option
+  std::optional<unsigned> memory_arena_;
   utils::statistics::Entry statistics_holder_;
   concurrent::AsyncEventSubscriberScope config_subscription_;
   std::optional<testsuite::CacheInvalidatorHolder> cache_invalidator_holder_;
+
+  // Touches the members above, so it goes last
+  engine::TaskWithResult<void> background_start_task_;
 };
 
 }  // namespace cache
@@ -485,6 +485,62 @@ INSTANTIATE_UTEST_SUITE_P(FreshDataRequired, CacheUpdateTraitDumpedFailure,
 
 namespace {
 
+class CacheUpdateTraitDumpedInBackground : public CacheUpdateTraitDumped {
+ public:
+  CacheUpdateTraitDumpedInBackground()
+      : CacheUpdateTraitDumped(
+            testsuite::CacheControl::PeriodicUpdatesMode::kEnabled) {
+    formats::yaml::ValueBuilder builder(Config().Yaml());
+    builder[std::string{dump::kDump}]["load-in-background"] = true;
+    Config() = {builder.ExtractValue(), formats::yaml::Value{}};
+  }
+};
+
+class CacheUpdateTraitDumpedInBackgroundRequired
+    : public CacheUpdateTraitDumpedInBackground {};
+
+}  // namespace
+
+UTEST_P(CacheUpdateTraitDumpedInBackground, Test) {
+  DumpedCache cache{Config(), GetEnvironment(), GetDataSource()};
+  // The constructor does not wait for the dump and the first update
+  EXPECT_EQ(cache.Get(), 0) << ParamsString();
+  EXPECT_EQ(cache.GetUpdatesLog(), std::vector<UpdateType>{});
+
+  // There will be no data race because only one thread is using
+  while (cache.GetUpdatesLog().empty()) {
+    engine::Yield();
+  }
+  EXPECT_EQ(cache.GetUpdatesLog(), std::vector{UpdateType::kFull});
+  EXPECT_EQ(cache.Get(), 20) << ParamsString();
+}
+
+// 1. The constructor returns with the cache still empty
+// 2. Loads data from dump in background
+// 3. Performs a full update in background
+INSTANTIATE_UTEST_SUITE_P(BestEffort, CacheUpdateTraitDumpedInBackground,
+                          Combine(Values(AllowedUpdateTypes::kOnlyFull),
+                                  Values(FirstUpdateMode::kBestEffort),
+                                  Values(FirstUpdateType::kFull),
+                                  Values(DumpAvailable{true}),
+                                  Values(DataSourceAvailable{true})));
+
+UTEST_P(CacheUpdateTraitDumpedInBackgroundRequired, Test) {
+  UEXPECT_THROW((DumpedCache{Config(), GetEnvironment(), GetDataSource()}),
+                cache::ConfigError);
+}
+
+// The contents are not available right after start, so
+// first-update-mode: required is not allowed
+INSTANTIATE_UTEST_SUITE_P(Required, CacheUpdateTraitDumpedInBackgroundRequired,
+                          Combine(Values(AllowedUpdateTypes::kOnlyFull),
+                                  Values(FirstUpdateMode::kRequired),
+                                  Values(FirstUpdateType::kFull),
+                                  Values(DumpAvailable{true}),
+                                  Values(DataSourceAvailable{true})));
+
+namespace {
+
 yaml_config::YamlConfig MakeDefaultDumpedCacheConfig() {
   return MakeDumpedCacheConfig({AllowedUpdateTypes::kOnlyIncremental,
                                 FirstUpdateMode::kSkip,
@@ -61,6 +61,10 @@ properties:
         type: boolean
         description: enables the check before changing the value in the cache, by default it is the check that the new value is not empty
         defaultDescription: false
+    jemalloc-arena:
+        type: boolean
+        description: whether to allocate the cache updates and the dump loads from a dedicated jemalloc arena, which memory is reported in the cache metrics
+        defaultDescription: false
     testsuite-force-periodic-update:
         type: boolean
         description: override testsuite-periodic-update-enabled in TestsuiteSupport component config
@@ -77,6 +81,10 @@ properties:
                 type: string
                 description: specifies whether incremental and/or full first update will be used
                 defaultDescription: full
+            load-in-background:
+                type: boolean
+                description: whether to load the dump and perform the first update in background, while the service is already started
+                defaultDescription: false
 )");
 }
 
@@ -1,10 +1,13 @@
 #include <string>
+#include <vector>
 
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/dump/operations_mock.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/mock_now.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,7 +19,8 @@ using SimpleCacheValue = int;
 using SimpleCache = cache::ExpirableLruCache<SimpleCacheKey, SimpleCacheValue>;
 using SimpleWrapper = cache::LruCacheWrapper<SimpleCacheKey, SimpleCacheValue>;
 
-void WriteAndReadFromDump(SimpleCache& cache) {
+template <typename Cache>
+void WriteAndReadFromDump(Cache& cache) {
   const auto cache_size_before = cache.GetSizeApproximate();
   dump::MockWriter writer;
   cache.Write(writer);
@@ -330,6 +334,101 @@ UTEST(ExpirableLruCache, BackgroundUpdate) {
   EXPECT_EQ(2, cache.Get(key, UpdateNever()));
 }
 
+UTEST_MT(ExpirableLruCache, CoalescedMisses, 4) {
+  constexpr std::size_t kRequestsCount = 100;
+  auto counter = std::make_shared<Counter>();
+  auto cache = CreateSimpleCache();
+  engine::SingleConsumerEvent fetch_allowed;
+
+  const auto update = [&counter, &fetch_allowed](const SimpleCacheKey&) {
+    ++*counter;
+    EXPECT_TRUE(fetch_allowed.WaitForEvent());
+    return 1;
+  };
+
+  std::vector<engine::TaskWithResult<SimpleCacheValue>> tasks;
+  for (std::size_t i = 0; i < kRequestsCount; ++i) {
+    tasks.push_back(utils::Async("getter", [&cache, &update] {
+      return cache.Get("my-key", update);
+    }));
+  }
+  while (cache.GetStatistics().total.coalesced < kRequestsCount - 1) {
+    engine::Yield();
+  }
+  fetch_allowed.Send();
+
+  for (auto& task : tasks) EXPECT_EQ(1, task.Get());
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(1, cache.Get("my-key", UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, CoalescedMissFirstCallerCancelled) {
+  auto counter = std::make_shared<Counter>();
+  auto cache = CreateSimpleCache();
+  auto fetch_allowed = std::make_shared<engine::SingleConsumerEvent>();
+
+  // Owns its data, as the fetch outlives the cancelled first caller
+  const auto update = [counter, fetch_allowed](const SimpleCacheKey&) {
+    ++*counter;
+    EXPECT_TRUE(fetch_allowed->WaitForEvent());
+    return 1;
+  };
+
+  auto first = utils::Async("first", [&cache, update] {
+    return cache.Get("my-key", update);
+  });
+  while (*counter != Counter::One()) engine::Yield();
+
+  auto second = utils::Async("second", [&cache, update] {
+    return cache.Get("my-key", update);
+  });
+  while (cache.GetStatistics().total.coalesced < 1) engine::Yield();
+
+  first.SyncCancel();
+  fetch_allowed->Send();
+
+  EXPECT_EQ(1, second.Get());
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(1, cache.Get("my-key", UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, CoalescedMissException) {
+  auto cache = CreateSimpleCache();
+  const auto throwing_update = [](const SimpleCacheKey&) -> SimpleCacheValue {
+    throw std::runtime_error("fetch failed");
+  };
+  UEXPECT_THROW(cache.Get("my-key", throwing_update), std::runtime_error);
+
+  // a failed fetch is not reused
+  auto counter = std::make_shared<Counter>();
+  EXPECT_EQ(1, cache.Get("my-key", UpdateValue(counter, 1)));
+  EXPECT_EQ(Counter::One(), *counter);
+}
+
+UTEST(ExpirableLruCache, StaleWhileRevalidate) {
+  auto counter = std::make_shared<Counter>();
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(2));
+  cache.SetStaleWhileRevalidate(std::chrono::seconds(2));
+  SimpleCacheKey key = "my-key";
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  cache.Put(key, 1);
+
+  // the stale value is returned and updated in background
+  utils::datetime::MockSleep(std::chrono::seconds(3));
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+  EngineYield();
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+
+  // too old values are not returned
+  utils::datetime::MockSleep(std::chrono::seconds(5));
+  counter->Flush();
+  EXPECT_EQ(3, cache.Get(key, UpdateValue(counter, 3)));
+  EXPECT_EQ(Counter::One(), *counter);
+}
+
 UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
   using Key = std::string;
@@ -357,6 +456,56 @@ UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
 }
 
+UTEST(ExpirableLruCache, ClockPolicy) {
+  using ClockCache =
+      cache::ExpirableLruCache<SimpleCacheKey, SimpleCacheValue,
+                               std::hash<SimpleCacheKey>,
+                               std::equal_to<SimpleCacheKey>,
+                               cache::CachePolicy::kClock>;
+  auto counter = std::make_shared<Counter>();
+
+  ClockCache cache(/*ways*/ 1, /*way_size*/ 2);
+  cache.SetMaxLifetime(std::chrono::seconds(2));
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  EXPECT_EQ(1, cache.Get("first-key", UpdateValue(counter, 1)));
+  EXPECT_EQ(2, cache.Get("second-key", UpdateValue(counter, 2)));
+  EXPECT_EQ(2, cache.GetSizeApproximate());
+  WriteAndReadFromDump(cache);
+
+  // "first-key" gets the second chance
+  EXPECT_EQ(1, cache.Get("first-key", UpdateNever()));
+  cache.Put("third-key", 3);
+  EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("second-key"));
+  EXPECT_EQ(1, cache.GetOptionalNoUpdate("first-key"));
+
+  utils::datetime::MockSleep(std::chrono::seconds(3));
+  EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("first-key"));
+  EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("third-key"));
+}
+
+UTEST(ExpirableLruCache, TinyLfuPolicy) {
+  using TinyLfuCache =
+      cache::ExpirableLruCache<int, int, std::hash<int>, std::equal_to<int>,
+                               cache::CachePolicy::kTinyLfu>;
+  constexpr int kHotKeysCount = 50;
+
+  TinyLfuCache cache(/*ways*/ 1, /*way_size*/ 100);
+  for (int i = 0; i < 5; ++i) {
+    for (int key = 0; key < kHotKeysCount; ++key) {
+      cache.Get(key, [](int key) { return key; });
+    }
+  }
+
+  // a scan does not evict the hot keys
+  for (int key = kHotKeysCount; key < 1000; ++key) cache.Put(key, key);
+  for (int key = 0; key < kHotKeysCount; ++key) {
+    EXPECT_EQ(key, cache.GetOptionalNoUpdate(key));
+  }
+  EXPECT_GT(cache.GetStatistics().total.admission_rejects.load(), 0);
+  WriteAndReadFromDump(cache);
+}
+
 UTEST(LruCacheWrapper, HitWrapper) {
   auto counter = std::make_shared<Counter>();
 
@@ -65,6 +65,10 @@ properties:
         type: string
         description: TTL for cache entries (0 is unlimited)
         defaultDescription: 0
+    stale-while-revalidate:
+        type: string
+        description: how long to serve the expired entries while updating them
+        defaultDescription: 0
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
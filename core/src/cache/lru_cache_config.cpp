@@ -18,6 +18,9 @@ constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kStaleWhileRevalidate = "stale-while-revalidate";
+constexpr std::string_view kStaleWhileRevalidateMs =
+    "stale-while-revalidate-ms";
 
 }  // namespace
 
@@ -28,7 +31,9 @@ LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      stale_while_revalidate(
+          config[kStaleWhileRevalidate].As<std::chrono::milliseconds>(0)) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -40,7 +45,9 @@ LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      stale_while_revalidate(ParseMs(value[kStaleWhileRevalidateMs],
+                                     std::chrono::milliseconds::zero())) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -13,13 +13,17 @@ ExpirableLruCacheStatisticsBase::ExpirableLruCacheStatisticsBase(
     : hits(other.hits.load()),
       misses(other.misses.load()),
       stale(other.stale.load()),
-      background_updates(other.background_updates.load()) {}
+      background_updates(other.background_updates.load()),
+      admission_rejects(other.admission_rejects.load()),
+      coalesced(other.coalesced.load()) {}
 
 void ExpirableLruCacheStatisticsBase::Reset() {
   hits = 0;
   misses = 0;
   stale = 0;
   background_updates = 0;
+  admission_rejects = 0;
+  coalesced = 0;
 }
 
 ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
@@ -28,6 +32,8 @@ ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
   misses += other.misses.load();
   stale += other.stale.load();
   background_updates += other.background_updates.load();
+  admission_rejects += other.admission_rejects.load();
+  coalesced += other.coalesced.load();
   return *this;
 }
 
@@ -49,12 +55,26 @@ void CacheStale(ExpirableLruCacheStatistics& stats) {
   LOG_TRACE() << "stale cache";
 }
 
+void CacheAdmissionReject(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.admission_rejects;
+  ++stats.recent.GetCurrentCounter().admission_rejects;
+  LOG_TRACE() << "cache admission reject";
+}
+
+void CacheCoalesced(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.coalesced;
+  ++stats.recent.GetCurrentCounter().coalesced;
+  LOG_TRACE() << "cache miss coalesced with an in-flight fetch";
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCacheStatistics& stats) {
   writer["hits"] = stats.total.hits.load();
   writer["misses"] = stats.total.misses.load();
   writer["stale"] = stats.total.stale.load();
   writer["background-updates"] = stats.total.background_updates.load();
+  writer["admission-rejects"] = stats.total.admission_rejects.load();
+  writer["coalesced-requests"] = stats.total.coalesced.load();
 
   auto s1min = stats.recent.GetStatsForPeriod();
   double s1min_hits = s1min.hits.load();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <userver/cache/nway_clock_cache.hpp>
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::size_t kWaySize = 256;
+constexpr std::uint64_t kHotKeysCount = 2048;
+// every kMissPeriod-th read is a miss, that gives a ~98% hit rate
+constexpr std::uint64_t kMissPeriod = 50;
+
+template <typename Cache>
+void GetOrPut(Cache& cache, std::uint64_t i) {
+  const auto key =
+      (i % kMissPeriod == 0) ? kHotKeysCount + i : i % kHotKeysCount;
+  auto value = cache.Get(key);
+  if (!value) {
+    cache.Put(key, key);
+  } else {
+    benchmark::DoNotOptimize(*value);
+  }
+}
+
+template <typename Cache>
+void RunReaders(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+
+  engine::RunStandalone(readers_count, [&] {
+    Cache cache(kWays, kWaySize);
+    for (std::uint64_t i = 0; i < kHotKeysCount; ++i) cache.Put(i, i);
+
+    std::atomic<bool> run{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count - 1);
+
+    for (std::size_t i = 0; i < readers_count - 1; i++) {
+      tasks.push_back(utils::Async("reader", [&, seed = i * 7919] {
+        std::uint64_t key = seed;
+        while (run) GetOrPut(cache, key++);
+      }));
+    }
+
+    {
+      std::uint64_t key = 0;
+      for (auto _ : state) GetOrPut(cache, key++);
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+}  // namespace
+
+void nway_lru_get_contention(benchmark::State& state) {
+  RunReaders<cache::NWayLRU<std::uint64_t, std::uint64_t>>(state);
+}
+BENCHMARK(nway_lru_get_contention)->RangeMultiplier(2)->Range(1, 32);
+
+void nway_clock_get_contention(benchmark::State& state) {
+  RunReaders<cache::NWayClockCache<std::uint64_t, std::uint64_t>>(state);
+}
+BENCHMARK(nway_clock_get_contention)->RangeMultiplier(2)->Range(1, 32);
+
+USERVER_NAMESPACE_END
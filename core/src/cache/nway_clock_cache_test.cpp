@@ -0,0 +1,149 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/cache/nway_clock_cache.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using Cache = cache::NWayClockCache<int, int>;
+
+UTEST(NWayClockCache, Ctr) {
+  UEXPECT_NO_THROW(Cache(1, 10));
+  UEXPECT_NO_THROW(Cache(10, 10));
+  UEXPECT_THROW(Cache(0, 10), std::logic_error);
+}
+
+UTEST(NWayClockCache, Set) {
+  Cache cache(1, 1);
+  EXPECT_EQ(0, cache.GetSize());
+
+  cache.Put(1, 1);
+  EXPECT_EQ(1, cache.GetSize());
+
+  cache.Put(2, 2);
+
+  EXPECT_EQ(2, cache.Get(2));
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_FALSE(cache.Get(1).has_value());
+
+  cache.Put(2, 3);
+  EXPECT_EQ(3, cache.Get(2));
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+UTEST(NWayClockCache, GetExpired) {
+  Cache cache(1, 2);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(2, cache.GetSize());
+
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(1, cache.GetSize());
+
+  EXPECT_FALSE(cache.Get(2, [](int) { return false; }).has_value());
+  EXPECT_EQ(0, cache.GetSize());
+
+  EXPECT_FALSE(cache.Get(1).has_value());
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayClockCache, SetMultipleWays) {
+  Cache cache(2, 1);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(2, cache.Get(2));
+  EXPECT_EQ(1, cache.Get(1));
+}
+
+UTEST(NWayClockCache, SecondChance) {
+  Cache cache(1, 3);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+
+  // 1 and 3 are referenced, 2 is the first one without the second chance
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(3, cache.Get(3));
+  cache.Put(4, 4);
+
+  EXPECT_EQ(3, cache.GetSize());
+  EXPECT_FALSE(cache.Get(2).has_value());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(3, cache.Get(3));
+  EXPECT_EQ(4, cache.Get(4));
+}
+
+UTEST(NWayClockCache, InvalidateByKey) {
+  Cache cache(1, 3);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+
+  cache.InvalidateByKey(1);
+  cache.InvalidateByKey(42);
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_FALSE(cache.Get(1).has_value());
+  EXPECT_EQ(2, cache.Get(2));
+  EXPECT_EQ(3, cache.Get(3));
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+  EXPECT_FALSE(cache.Get(2).has_value());
+}
+
+UTEST(NWayClockCache, UpdateWaySize) {
+  Cache cache(1, 10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i);
+  EXPECT_EQ(10, cache.GetSize());
+
+  cache.UpdateWaySize(3);
+  EXPECT_EQ(3, cache.GetSize());
+
+  int visited = 0;
+  cache.VisitAll([&visited](int key, int value) {
+    EXPECT_EQ(key, value);
+    ++visited;
+  });
+  EXPECT_EQ(3, visited);
+
+  cache.UpdateWaySize(0);
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+UTEST_MT(NWayClockCache, ConcurrentGetAndPut, 4) {
+  constexpr int kKeysCount = 100;
+  Cache cache(4, kKeysCount / 8);
+
+  std::atomic<bool> stop_flag{false};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(utils::Async("reader", [&cache, &stop_flag] {
+      while (!stop_flag) {
+        for (int key = 0; key < kKeysCount; ++key) {
+          const auto value = cache.Get(key);
+          if (value) ASSERT_EQ(*value % kKeysCount, key);
+        }
+      }
+    }));
+  }
+
+  for (int value = 0; value < kKeysCount * 20; ++value) {
+    cache.Put(value % kKeysCount, value);
+    if (value % 3 == 0) cache.InvalidateByKey((value / 3) % kKeysCount);
+    engine::Yield();
+  }
+  stop_flag = true;
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_LE(cache.GetSize(), 4 * (kKeysCount / 8));
+}
+
+USERVER_NAMESPACE_END
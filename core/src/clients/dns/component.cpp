@@ -42,6 +42,12 @@ ResolverConfig ParseResolverConfig(
   config.cache_failure_ttl =
       component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_prefetch_interval =
+      component_config["cache-prefetch-interval"]
+          .As<std::chrono::milliseconds>(config.cache_prefetch_interval);
+  config.cache_prefetch_min_hits =
+      component_config["cache-prefetch-min-hits"].As<size_t>(
+          config.cache_prefetch_min_hits);
   return config;
 }
 
@@ -122,6 +128,15 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-prefetch-interval:
+        type: string
+        description: interval of the background updates of the network cache entries that are in use and are about to expire, 0 disables the updates
+        defaultDescription: 0s
+    cache-prefetch-min-hits:
+        type: integer
+        description: min number of the cache hits since the previous background update for an entry to be updated
+        defaultDescription: 1
+        minimum: 1
 )");
 }
 
@@ -2,9 +2,12 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <atomic>
 #include <cctype>
 #include <chrono>
+#include <memory>
 #include <string_view>
+#include <utility>
 
 #include <clients/dns/file_resolver.hpp>
 #include <clients/dns/helpers.hpp>
@@ -18,6 +21,7 @@
 #include <userver/utils/from_string.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 #include <userver/utils/mock_now.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -146,6 +150,7 @@ class Resolver::Impl {
   ~Impl();
 
   const LookupSourceCounters& GetLookupSourceCounters() const;
+  std::vector<NetworkCacheEntryStats> GetNetworkCacheStats() const;
 
   void ReloadHosts();
   void FlushNetworkCache();
@@ -162,17 +167,28 @@ class Resolver::Impl {
                                const std::string& name,
                                engine::Deadline deadline);
 
+  // Returns false if the record is already updating
   template <typename Mutex>
-  void StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
+  bool StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
                             const std::string& name);
 
  private:
+  // Shared by the copies of an entry and kept on its updates
+  struct NetCacheHits {
+    std::atomic<std::uint64_t> total{0};
+    std::atomic<std::uint64_t> since_prefetch{0};
+  };
+
   struct NetCacheEntry {
     AddrVector addrs;
     std::chrono::steady_clock::time_point expiration;
     bool is_failure{false};
+    std::shared_ptr<NetCacheHits> hits;
   };
 
+  std::shared_ptr<NetCacheHits> GetNetCacheHits(const std::string& name);
+  void PrefetchNetCache();
+
   template <typename Mutex>
   void MoveQueryToBackground(std::unique_lock<Mutex>& lock, Mutex&& mutex,
                              engine::Future<NetResolver::Response>&& future,
@@ -190,9 +206,12 @@ class Resolver::Impl {
   const std::chrono::milliseconds net_cache_update_margin_;
   const std::chrono::milliseconds net_cache_max_reply_ttl_;
   const std::chrono::milliseconds net_cache_failure_ttl_;
+  const std::chrono::milliseconds net_cache_prefetch_interval_;
+  const std::uint64_t net_cache_prefetch_min_hits_;
   cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
   concurrent::MutexSet<std::string> net_cache_update_mutexes_;
   utils::impl::WaitTokenStorage wait_token_storage_;
+  utils::PeriodicTask prefetch_task_;
 };
 
 Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
@@ -204,16 +223,36 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
       net_cache_update_margin_{config.network_timeout},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_prefetch_interval_{config.cache_prefetch_interval},
+      net_cache_prefetch_min_hits_{config.cache_prefetch_min_hits},
       net_cache_{config.cache_ways, config.cache_size_per_way},
-      net_cache_update_mutexes_(config.cache_ways) {}
+      net_cache_update_mutexes_(config.cache_ways) {
+  if (net_cache_prefetch_interval_.count() > 0) {
+    prefetch_task_.Start("dns_cache_prefetch", net_cache_prefetch_interval_,
+                         [this] { PrefetchNetCache(); });
+  }
+}
 
-Resolver::Impl::~Impl() { wait_token_storage_.WaitForAllTokens(); }
+Resolver::Impl::~Impl() {
+  prefetch_task_.Stop();
+  wait_token_storage_.WaitForAllTokens();
+}
 
 const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
     const {
   return source_counters_;
 }
 
+std::vector<Resolver::NetworkCacheEntryStats>
+Resolver::Impl::GetNetworkCacheStats() const {
+  std::vector<NetworkCacheEntryStats> result;
+  net_cache_.VisitAll([&result](const std::string& name,
+                                const NetCacheEntry& entry) {
+    result.push_back({name, entry.hits->total.load(), entry.is_failure});
+  });
+  return result;
+}
+
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
 void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
@@ -238,6 +277,9 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
   const auto cached = net_cache_.Get(name);
   if (!cached) return result;
 
+  ++cached->hits->total;
+  ++cached->hits->since_prefetch;
+
   if (cached->is_failure) {
     if (cached->expiration >= now) {
       ++source_counters_.cached_failure;
@@ -297,18 +339,50 @@ AddrVector Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
 }
 
 template <typename Mutex>
-void Resolver::Impl::StartBackgroundQuery(std::unique_lock<Mutex>& lock,
+bool Resolver::Impl::StartBackgroundQuery(std::unique_lock<Mutex>& lock,
                                           Mutex&& mutex,
                                           const std::string& name) {
   UASSERT(lock.mutex() == &mutex);
   if (!lock && !lock.try_lock()) {
     LOG_TRACE() << "Record for '" << name << "' is already updating, skipping";
-    return;
+    return false;
   }
   LOG_TRACE() << "Updating record for '" << name << "' in background";
   auto future = net_resolver_.Resolve(name);
   MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future),
                         name, FailureMode::kIgnore);
+  return true;
+}
+
+std::shared_ptr<Resolver::Impl::NetCacheHits> Resolver::Impl::GetNetCacheHits(
+    const std::string& name) {
+  auto cached = net_cache_.Get(name);
+  if (cached) return std::move(cached->hits);
+  return std::make_shared<NetCacheHits>();
+}
+
+void Resolver::Impl::PrefetchNetCache() {
+  // The entries that would need an update before the next prefetch
+  const auto update_before = utils::datetime::MockSteadyNow() +
+                             net_cache_prefetch_interval_ +
+                             net_cache_update_margin_;
+
+  std::vector<std::pair<std::string, std::shared_ptr<NetCacheHits>>> hot;
+  net_cache_.VisitAll([&](const std::string& name, const NetCacheEntry& entry) {
+    if (!entry.is_failure && entry.expiration < update_before &&
+        entry.hits->since_prefetch >= net_cache_prefetch_min_hits_) {
+      hot.emplace_back(name, entry.hits);
+    }
+  });
+
+  for (const auto& [name, hits] : hot) {
+    const auto hits_to_account = hits->since_prefetch.load();
+    auto mutex = GetUpdateMutex(name);
+    std::unique_lock lock{mutex, std::defer_lock};
+    if (StartBackgroundQuery(lock, std::move(mutex), name)) {
+      hits->since_prefetch -= hits_to_account;
+    }
+  }
 }
 
 template <typename Mutex>
@@ -351,7 +425,8 @@ void Resolver::Impl::FinishNetUpdate(
       net_cache_.Put(name, NetCacheEntry{{},
                                          utils::datetime::MockSteadyNow() +
                                              net_cache_failure_ttl_,
-                                         true});
+                                         true,
+                                         GetNetCacheHits(name)});
     }
     ++source_counters_.network_failure;
     throw;
@@ -366,7 +441,8 @@ void Resolver::Impl::FinishNetUpdate(
     LOG_TRACE() << "Updating cache for '" << name << '\'';
     net_cache_.Put(
         name, NetCacheEntry{std::move(response.addrs),
-                            utils::datetime::MockSteadyNow() + effective_ttl});
+                            utils::datetime::MockSteadyNow() + effective_ttl,
+                            false, GetNetCacheHits(name)});
   } else {
     LOG_TRACE() << "Skipping cache update for '" << name << '\'';
   }
@@ -447,6 +523,11 @@ const Resolver::LookupSourceCounters& Resolver::GetLookupSourceCounters()
   return impl_->GetLookupSourceCounters();
 }
 
+std::vector<Resolver::NetworkCacheEntryStats> Resolver::GetNetworkCacheStats()
+    const {
+  return impl_->GetNetworkCacheStats();
+}
+
 void Resolver::ReloadHosts() { impl_->ReloadHosts(); }
 
 void Resolver::FlushNetworkCache() { impl_->FlushNetworkCache(); }
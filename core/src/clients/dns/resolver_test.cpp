@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <string_view>
 #include <vector>
 
@@ -58,7 +59,8 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
   using ServerMock = utest::DnsServerMock;
 
-  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way,
+                 std::chrono::milliseconds cache_prefetch_interval = {})
       : hosts_file{[] {
           auto file = fs::blocking::TempFile::Create();
           fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -87,6 +89,7 @@ struct MockedResolver {
               config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl},
               config.cache_ways = 1;
               config.cache_size_per_way = cache_size_per_way;
+              config.cache_prefetch_interval = cache_prefetch_interval;
               config.network_custom_servers = {server_mock.GetServerAddress()};
               return config;
             }()} {}
@@ -426,6 +429,55 @@ UTEST(Resolver, CacheFailures) {
   EXPECT_EQ(counters.network_failure, 2);
 }
 
+UTEST(Resolver, CacheHitsStats) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 2};
+
+  for (const auto* name : {"first", "first", "first", "second"}) {
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve(name, test_deadline),
+                        (Expected{kNetV6String, kNetV4String}));
+  }
+
+  auto stats = resolver->GetNetworkCacheStats();
+  std::sort(stats.begin(), stats.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.name < rhs.name;
+  });
+  ASSERT_EQ(stats.size(), 2);
+  EXPECT_EQ(stats[0].name, "first");
+  EXPECT_EQ(stats[0].hits, 2);
+  EXPECT_FALSE(stats[0].is_failure);
+  EXPECT_EQ(stats[1].name, "second");
+  EXPECT_EQ(stats[1].hits, 0);
+}
+
+UTEST(Resolver, CachePrefetch) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  constexpr std::chrono::milliseconds kPrefetchInterval{10};
+
+  MockedResolver resolver{1000, 2, kPrefetchInterval};
+
+  // Not used after the first resolution, so it is not prefetched
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("cold", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("hot", test_deadline),
+                        (Expected{kNetV6String, kNetV4String}));
+  }
+
+  // The update on the hit (the network timeout is the update margin in the
+  // test) and the prefetch of the "hot"
+  const auto& counters = resolver->GetLookupSourceCounters();
+  while (counters.network < 4 && !test_deadline.IsReached()) {
+    engine::SleepFor(kPrefetchInterval);
+  }
+  engine::SleepFor(kPrefetchInterval * 5);
+  EXPECT_EQ(counters.network, 4);
+  EXPECT_EQ(counters.network_failure, 0);
+}
+
 UTEST(Resolver, FileDoesNotCache) {
   const auto test_deadline =
       engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
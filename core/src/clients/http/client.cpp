@@ -15,6 +15,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/requests_coalescer.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/openssl.hpp>
@@ -51,6 +52,8 @@ Client::Client(impl::ClientSettings settings,
                engine::TaskProcessor& fs_task_processor,
                impl::PluginPipeline&& plugin_pipeline)
     : deadline_propagation_config_(settings.deadline_propagation),
+      wait_for_multiplexing_(settings.http2.multiplexing &&
+                             settings.http2.wait_for_multiplexing),
       destination_statistics_(std::make_shared<DestinationStatistics>()),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
@@ -58,7 +61,11 @@ Client::Client(impl::ClientSettings settings,
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
       tracing_manager_(GetTracingManager(settings)),
       headers_propagator_(settings.headers_propagator),
-      plugin_pipeline_(std::move(plugin_pipeline)) {
+      plugin_pipeline_(std::move(plugin_pipeline)),
+      requests_coalescer_(std::make_unique<RequestsCoalescer>()) {
+  destination_statistics_->SetConcurrencyLimitSettings(
+      settings.concurrency_limit);
+
   const auto io_threads = settings.io_threads;
   const auto& thread_name_prefix = settings.thread_name_prefix;
 
@@ -91,10 +98,33 @@ Client::Client(impl::ClientSettings settings,
       [this] { ReinitEasy(); });
 
   SetConfig({});
+
+  if (settings.worker_thread_affinity) {
+    multi_idle_queues_.reserve(multis_.size());
+    for (size_t i = 0; i < multis_.size(); ++i) {
+      multi_idle_queues_.push_back(std::make_unique<IdleQueue>());
+    }
+  }
+
+  const auto& http2 = settings.http2;
+  if (http2.multiplexing) {
+    for (auto& multi : multis_) {
+      multi->SetMultiplexingEnabled(true);
+      multi->SetMaxConcurrentStreams(
+          ClampToLong(http2.max_streams_per_connection));
+    }
+  }
+  if (http2.max_host_connections) {
+    // Each IO thread has its own connections, the budget is split among them
+    SetMaxHostConnections(
+        (*http2.max_host_connections + multis_.size() - 1) / multis_.size());
+  }
 }
 
 Client::~Client() {
   easy_reinit_task_.Stop();
+  // Cancels the coalesced requests in flight
+  requests_coalescer_.reset();
 
   // We have to destroy *this only when all the requests are finished, because
   // otherwise `multis_` and `thread_pool_` are destroyed and pending requests
@@ -112,44 +142,63 @@ Client::~Client() {
 
   while (TryDequeueIdle())
     ;
+  multi_idle_queues_.clear();
 
   multis_.clear();
   thread_pool_.reset();
 }
 
 Request Client::CreateRequest() {
-  auto request = [this] {
-    auto easy = TryDequeueIdle();
-    if (easy) {
-      auto idx = FindMultiIndex(easy->GetMulti());
-      auto wrapper =
-          std::make_shared<impl::EasyWrapper>(std::move(easy), *this);
-      return Request{std::move(wrapper), statistics_[idx].CreateRequestStats(),
-                     destination_statistics_, resolver_, plugin_pipeline_};
-    } else {
-      auto i = utils::RandRange(multis_.size());
-      auto& multi = multis_[i];
-
-      try {
-        auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                         return std::make_shared<impl::EasyWrapper>(
-                             easy_.Get()->GetBoundBlocking(*multi), *this);
-                       }).Get();
-        return Request{std::move(wrapper), statistics_[i].CreateRequestStats(),
-                       destination_statistics_, resolver_, plugin_pipeline_};
-      } catch (engine::WaitInterruptedException&) {
-        throw clients::http::CancelException();
-      } catch (engine::TaskCancelledException&) {
-        throw clients::http::CancelException();
-      }
-    }
-  }();
+  if (!multi_idle_queues_.empty()) {
+    const auto idx = GetWorkerThreadMultiIndex();
+    auto easy = TryDequeueIdle(idx);
+    if (!easy) return CreateRequestOnMulti(idx);
+    auto wrapper = std::make_shared<impl::EasyWrapper>(std::move(easy), *this);
+    return CreateRequest(std::move(wrapper), idx);
+  }
+
+  auto easy = TryDequeueIdle();
+  if (easy) {
+    auto idx = FindMultiIndex(easy->GetMulti());
+    auto wrapper = std::make_shared<impl::EasyWrapper>(std::move(easy), *this);
+    return CreateRequest(std::move(wrapper), idx);
+  }
+  return CreateRequestOnMulti(utils::RandRange(multis_.size()));
+}
+
+Request Client::CreateRequestOnMulti(size_t multi_index) {
+  auto& multi = multis_[multi_index];
+
+  std::shared_ptr<impl::EasyWrapper> wrapper;
+  try {
+    wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
+                return std::make_shared<impl::EasyWrapper>(
+                    easy_.Get()->GetBoundBlocking(*multi), *this);
+              }).Get();
+  } catch (engine::WaitInterruptedException&) {
+    throw clients::http::CancelException();
+  } catch (engine::TaskCancelledException&) {
+    throw clients::http::CancelException();
+  }
+  return CreateRequest(std::move(wrapper), multi_index);
+}
+
+Request Client::CreateRequest(std::shared_ptr<impl::EasyWrapper>&& wrapper,
+                              size_t multi_index) {
+  // Otherwise cURL opens a new connection for each of the concurrent requests
+  // until the first one negotiates HTTP/2
+  if (wait_for_multiplexing_) wrapper->Easy().set_pipewait(true);
+
+  Request request{std::move(wrapper),
+                  statistics_[multi_index].CreateRequestStats(),
+                  destination_statistics_, resolver_, plugin_pipeline_};
 
   if (testsuite_config_) {
     request.SetTestsuiteConfig(testsuite_config_);
   }
   auto urls = allowed_urls_extra_.Read();
   request.SetAllowedUrlsExtra(*urls);
+  request.SetRequestsCoalescer(requests_coalescer_.get());
 
   request.SetTracingManager(*tracing_manager_.GetBase());
   request.SetHeadersPropagator(headers_propagator_);
@@ -181,6 +230,31 @@ void Client::SetMaxHostConnections(size_t max_host_connections) {
   }
 }
 
+void Client::PrewarmConnections(const std::vector<std::string>& urls,
+                                std::chrono::milliseconds timeout) {
+  std::vector<std::pair<std::string_view, ResponseFuture>> futures;
+  futures.reserve(urls.size() * multis_.size());
+  for (size_t i = 0; i < multis_.size(); ++i) {
+    for (const auto& url : urls) {
+      futures.emplace_back(url, CreateRequestOnMulti(i)
+                                    .head(url)
+                                    .timeout(timeout)
+                                    .retry(1)
+                                    .async_perform());
+    }
+  }
+
+  for (auto& [url, future] : futures) {
+    try {
+      // Any response means the connection is open
+      future.Get();
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to prewarm the connection to " << url << ": "
+                    << ex;
+    }
+  }
+}
+
 std::string Client::GetProxy() const { return proxy_.ReadCopy(); }
 
 void Client::SetDnsResolver(clients::dns::Resolver* resolver) {
@@ -237,7 +311,12 @@ const DestinationStatistics& Client::GetDestinationStatistics() const {
 void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   try {
     easy->reset();
-    idle_queue_->enqueue(std::move(easy));
+    if (multi_idle_queues_.empty()) {
+      idle_queue_->enqueue(std::move(easy));
+    } else {
+      const auto idx = FindMultiIndex(easy->GetMulti());
+      multi_idle_queues_[idx]->enqueue(std::move(easy));
+    }
   } catch (const std::exception& e) {
     LOG_ERROR() << e;
   }
@@ -253,6 +332,23 @@ std::shared_ptr<curl::easy> Client::TryDequeueIdle() noexcept {
   return result;
 }
 
+std::shared_ptr<curl::easy> Client::TryDequeueIdle(
+    size_t multi_index) noexcept {
+  std::shared_ptr<curl::easy> result;
+  if (!multi_idle_queues_[multi_index]->try_dequeue(result)) {
+    return {};
+  }
+  return result;
+}
+
+size_t Client::GetWorkerThreadMultiIndex() const noexcept {
+  // Numbering the threads spreads them evenly over the multis, unlike the
+  // hashes of the thread ids
+  static std::atomic<size_t> next_thread_number{0};
+  thread_local const size_t thread_number = next_thread_number++;
+  return thread_number % multis_.size();
+}
+
 void Client::SetTestsuiteConfig(const TestsuiteConfig& config) {
   LOG_INFO() << "http client: configured for testsuite";
   testsuite_config_ = std::make_shared<const TestsuiteConfig>(config);
@@ -1,5 +1,7 @@
 #include <userver/clients/http/client.hpp>
 
+#include <atomic>
+#include <cstring>
 #include <set>
 
 #include <fmt/format.h>
@@ -7,6 +9,7 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
@@ -248,6 +251,24 @@ HttpResponse sleep_callback_1s(const HttpRequest& request) {
   return sleep_callback_base(request, std::chrono::seconds(1));
 }
 
+struct SlowCountingCallback {
+  std::shared_ptr<std::atomic<std::size_t>> requests =
+      std::make_shared<std::atomic<std::size_t>>(0);
+
+  HttpResponse operator()(const HttpRequest& request) const {
+    LOG_INFO() << "HTTP Server receive: " << request;
+    ++*requests;
+
+    // Lets the concurrent requests of the test meet each other
+    engine::InterruptibleSleepFor(std::chrono::milliseconds{100});
+
+    return {fmt::format("HTTP/1.1 200 OK\r\nConnection: close\r\n"
+                        "Content-Length: {}\r\n\r\n{}",
+                        std::strlen(kTestData), kTestData),
+            HttpResponse::kWriteAndClose};
+  }
+};
+
 HttpResponse huge_data_callback(const HttpRequest& request) {
   LOG_INFO() << "HTTP Server receive: " << request;
 
@@ -1522,6 +1543,65 @@ UTEST(HttpClient, TestConnectTo) {
   }
 }
 
+UTEST(HttpClient, StreamedResponseBackpressure) {
+  // CURL_MAX_WRITE_SIZE, the max size of a chunk of the body
+  constexpr std::size_t kQueueSize = 16 * 1024;
+
+  const utest::SimpleServer http_server{&huge_data_callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  auto queue = concurrent::StringStreamQueue::Create(kQueueSize);
+  auto stream_response = http_client_ptr->CreateRequest()
+                             .get(http_server.GetBaseUrl())
+                             .retry(1)
+                             .timeout(kTimeout)
+                             .async_perform_stream_body(queue);
+  EXPECT_EQ(stream_response.StatusCode(), clients::http::Status::OK);
+
+  // The transfer is paused while the queue is full, instead of buffering
+  const auto deadline = engine::Deadline::FromDuration(kTimeout);
+  std::string body_part;
+  std::string body;
+  while (stream_response.ReadChunk(body_part, deadline)) {
+    EXPECT_LE(queue->GetSizeApproximate(), kQueueSize);
+    body += body_part;
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  EXPECT_EQ(body, std::string(100000, '@'));
+}
+
+UTEST(HttpClient, WorkerThreadAffinity) {
+  constexpr std::size_t kIoThreads = 4;
+  constexpr std::size_t kRequests = 10;
+
+  const utest::SimpleServer http_server{EchoCallback{}};
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = kIoThreads;
+  settings.worker_thread_affinity = true;
+  clients::http::Client http_client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    const auto res = http_client.CreateRequest()
+                         .post(http_server.GetBaseUrl(), kTestData)
+                         .retry(1)
+                         .timeout(kTimeout)
+                         .perform();
+    EXPECT_EQ(res->body(), kTestData);
+  }
+
+  // All the requests of the single threaded test go to the same multi
+  const auto stats = http_client.GetPoolStatistics();
+  ASSERT_EQ(stats.multi.size(), kIoThreads);
+  std::set<std::uint64_t> ok_counts;
+  for (const auto& multi_stats : stats.multi) {
+    ok_counts.insert(multi_stats.error_count[static_cast<std::size_t>(
+        clients::http::Statistics::ErrorGroup::kOk)]);
+  }
+  EXPECT_EQ(ok_counts, (std::set<std::uint64_t>{0, kRequests}));
+}
+
 UTEST(HttpClient, CheckSchema) {
   auto http_client_ptr = utest::CreateHttpClient();
   UEXPECT_NO_THROW(http_client_ptr->CreateRequest().url("http://localhost"));
@@ -1538,4 +1618,71 @@ UTEST(HttpClient, CheckSchema) {
                 clients::http::BadArgumentException);
 }
 
+UTEST(HttpClient, CoalesceConcurrentRequests) {
+  SlowCountingCallback callback;
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  const auto make_request = [&](std::string_view header_value) {
+    return http_client_ptr->CreateRequest()
+        .get(http_server.GetBaseUrl())
+        .headers({{kTestHeader, header_value}})
+        .retry(1)
+        .timeout(kTimeout)
+        .coalesce();
+  };
+
+  std::vector<clients::http::ResponseFuture> futures;
+  for (unsigned i = 0; i < kFewRepetitions; ++i) {
+    futures.push_back(make_request("value").async_perform());
+  }
+  // The headers are a part of the request identity
+  auto other = make_request("other").async_perform();
+
+  for (auto& future : futures) {
+    const auto response = future.Get();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body(), kTestData);
+  }
+  EXPECT_EQ(other.Get()->body(), kTestData);
+  EXPECT_EQ(*callback.requests, 2);
+
+  // Without the cache the finished request is not reused
+  EXPECT_EQ(make_request("value").perform()->body(), kTestData);
+  EXPECT_EQ(*callback.requests, 3);
+
+  // The requests with a body are never coalesced
+  EXPECT_EQ(make_request("value").data(kTestData).perform()->status_code(),
+            clients::http::Status::OK);
+  EXPECT_EQ(*callback.requests, 4);
+}
+
+UTEST(HttpClient, CoalesceCacheTtl) {
+  SlowCountingCallback callback;
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  for (unsigned i = 0; i < kFewRepetitions; ++i) {
+    const auto response = http_client_ptr->CreateRequest()
+                              .get(http_server.GetBaseUrl())
+                              .retry(1)
+                              .timeout(kTimeout)
+                              .coalesce(utest::kMaxTestWaitTime)
+                              .perform();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body(), kTestData);
+  }
+  EXPECT_EQ(*callback.requests, 1);
+
+  // The requests without coalescing do not use the cache
+  EXPECT_EQ(http_client_ptr->CreateRequest()
+                .get(http_server.GetBaseUrl())
+                .retry(1)
+                .timeout(kTimeout)
+                .perform()
+                ->body(),
+            kTestData);
+  EXPECT_EQ(*callback.requests, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -98,6 +98,12 @@ HttpClient::HttpClient(const ComponentConfig& component_config,
       component_config["bootstrap-http-proxy"].As<std::string>({});
   http_client_.SetConfig(bootstrap_config);
 
+  const auto http2 =
+      component_config.As<clients::http::impl::ClientSettings>().http2;
+  if (!http2.prewarm_urls.empty()) {
+    http_client_.PrewarmConnections(http2.prewarm_urls, http2.prewarm_timeout);
+  }
+
   auto& config_component = context.FindComponent<components::DynamicConfig>();
   subscriber_scope_ =
       components::DynamicConfig::NoblockSubscriber{config_component}
@@ -170,6 +176,10 @@ properties:
         type: boolean
         description: whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care
         defaultDescription: false
+    worker-thread-affinity:
+        type: boolean
+        description: whether the requests created on a task processor thread always go to the same IO thread, to reuse its connections and easy handles
+        defaultDescription: false
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
@@ -213,6 +223,71 @@ properties:
             Note: timeout is always updated from the task-inherited deadline
             when present.
         defaultDescription: true
+    http2:
+        type: object
+        description: HTTP/2 connections settings
+        additionalProperties: false
+        properties:
+            multiplexing:
+                type: boolean
+                description: whether to send the concurrent requests to a host as the streams of a single HTTP/2 connection
+                defaultDescription: false
+            max-streams-per-connection:
+                type: integer
+                description: max number of concurrent streams of an HTTP/2 connection
+                defaultDescription: 100
+                minimum: 1
+            max-host-connections:
+                type: integer
+                description: max number of connections to a host for all the IO threads together, split evenly among them
+                defaultDescription: unlimited
+                minimum: 1
+            wait-for-multiplexing:
+                type: boolean
+                description: with the multiplexing, whether a request waits for a connection to a host that is being opened instead of opening a new one
+                defaultDescription: true
+            prewarm-urls:
+                type: array
+                description: URLs to send HEAD requests to from each of the IO threads at the start, to open the connections in advance
+                items:
+                    type: string
+                    description: URL
+            prewarm-timeout:
+                type: string
+                description: timeout of the prewarm requests
+                defaultDescription: 1s
+    concurrency-limit:
+        type: object
+        description: adaptive limit of the concurrent requests to each destination
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: whether to limit the concurrent requests to each destination
+                defaultDescription: false
+            initial-limit:
+                type: integer
+                description: initial limit for a destination
+                defaultDescription: 100
+                minimum: 1
+            min-limit:
+                type: integer
+                description: min limit for a destination
+                defaultDescription: 1
+                minimum: 1
+            max-limit:
+                type: integer
+                description: max limit for a destination
+                defaultDescription: 1000
+                minimum: 1
+            latency-tolerance:
+                type: number
+                description: the limit is decreased if a latency is this many times greater than the usual latency of the destination
+                defaultDescription: 2.0
+            queue-timeout:
+                type: string
+                description: how long a request waits for the number of the concurrent requests to go below the limit before it fails
+                defaultDescription: 0ms
     plugins:
         type: array
         description: HTTP client plugin names
@@ -0,0 +1,89 @@
+#include <clients/http/concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr double kDecreaseFactor = 0.9;
+// The baseline follows the long-term changes of the latency only
+constexpr double kBaselineSmoothing = 0.01;
+
+std::size_t ToCapacity(double limit) {
+  return static_cast<std::size_t>(std::lround(limit));
+}
+
+}  // namespace
+
+ConcurrencyLimiter::ConcurrencyLimiter(
+    const impl::ConcurrencyLimitSettings& settings)
+    : settings_(settings),
+      semaphore_(settings.initial_limit),
+      limit_(settings.initial_limit) {}
+
+bool ConcurrencyLimiter::TryAcquire() {
+  const bool is_acquired = semaphore_.try_lock_shared_until(
+      engine::Deadline::FromDuration(settings_.queue_timeout));
+  if (!is_acquired) ++rejected_;
+  return is_acquired;
+}
+
+void ConcurrencyLimiter::Release(std::chrono::steady_clock::duration latency,
+                                 bool is_overload) noexcept {
+  const auto now = utils::datetime::SteadyNow();
+  const auto latency_ms =
+      std::chrono::duration<double, std::milli>(latency).count();
+
+  {
+    const std::lock_guard lock{mutex_};
+    const bool is_congested =
+        is_overload ||
+        (baseline_latency_ms_ > 0 &&
+         latency_ms > baseline_latency_ms_ * settings_.latency_tolerance);
+
+    if (!is_congested) {
+      // By one per `limit_` responses, i.e. per a window of the requests
+      limit_ = std::min(limit_ + 1 / limit_,
+                        static_cast<double>(settings_.max_limit));
+    } else if (now >= next_decrease_) {
+      limit_ = std::max(limit_ * kDecreaseFactor,
+                        static_cast<double>(settings_.min_limit));
+      // The requests sent before the decrease should not decrease it again
+      next_decrease_ = now + latency;
+    }
+
+    if (!is_overload) {
+      baseline_latency_ms_ =
+          baseline_latency_ms_ > 0
+              ? baseline_latency_ms_ +
+                    (latency_ms - baseline_latency_ms_) * kBaselineSmoothing
+              : latency_ms;
+    }
+
+    const auto capacity = ToCapacity(limit_);
+    if (capacity != semaphore_.GetCapacity()) semaphore_.SetCapacity(capacity);
+  }
+
+  semaphore_.unlock_shared();
+}
+
+void ConcurrencyLimiter::Release() noexcept { semaphore_.unlock_shared(); }
+
+std::size_t ConcurrencyLimiter::GetLimit() const noexcept {
+  return semaphore_.GetCapacity();
+}
+
+std::size_t ConcurrencyLimiter::GetCurrentLoad() const {
+  return semaphore_.UsedApprox();
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include <userver/clients/http/impl/config.hpp>
+#include <userver/engine/semaphore.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+// Limits the number of the concurrent requests to a destination.
+//
+// The limit adapts to the destination in the AIMD way: it grows by one per a
+// window of the responses while their latency stays close to the long-term
+// baseline, and is cut once per a round trip on a latency spike, a timeout or
+// an overload response.
+class ConcurrencyLimiter final {
+ public:
+  explicit ConcurrencyLimiter(const impl::ConcurrencyLimitSettings& settings);
+
+  // Waits for a free unit of the limit for up to the queue timeout
+  [[nodiscard]] bool TryAcquire();
+
+  // Frees the unit and adjusts the limit by the result of the request.
+  // May be called from any thread.
+  void Release(std::chrono::steady_clock::duration latency,
+               bool is_overload) noexcept;
+
+  // Frees the unit without adjusting the limit, e.g. for a cancelled request
+  void Release() noexcept;
+
+  std::size_t GetLimit() const noexcept;
+  std::size_t GetCurrentLoad() const;
+  std::uint64_t GetRejectedCount() const noexcept { return rejected_; }
+
+ private:
+  const impl::ConcurrencyLimitSettings settings_;
+  engine::CancellableSemaphore semaphore_;
+  std::atomic<std::uint64_t> rejected_{0};
+
+  std::mutex mutex_;
+  double limit_;
+  double baseline_latency_ms_{0};
+  std::chrono::steady_clock::time_point next_decrease_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
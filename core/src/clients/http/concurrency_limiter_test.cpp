@@ -0,0 +1,116 @@
+#include <clients/http/concurrency_limiter.hpp>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::ConcurrencyLimiter;
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::chrono::milliseconds kLatency{10};
+constexpr auto kTimeout = utest::kMaxTestWaitTime;
+
+clients::http::impl::ConcurrencyLimitSettings MakeSettings(
+    std::size_t initial_limit) {
+  clients::http::impl::ConcurrencyLimitSettings settings;
+  settings.enabled = true;
+  settings.initial_limit = initial_limit;
+  settings.min_limit = 1;
+  settings.max_limit = 10;
+  return settings;
+}
+
+HttpResponse SlowCallback(const HttpRequest&) {
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{100});
+  return {"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n",
+          HttpResponse::kWriteAndClose};
+}
+
+}  // namespace
+
+UTEST(HttpClientConcurrencyLimiter, RejectsOverLimit) {
+  ConcurrencyLimiter limiter{MakeSettings(2)};
+
+  EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_FALSE(limiter.TryAcquire());
+  EXPECT_EQ(limiter.GetCurrentLoad(), 2);
+  EXPECT_EQ(limiter.GetRejectedCount(), 1);
+
+  limiter.Release();
+  EXPECT_TRUE(limiter.TryAcquire());
+  limiter.Release();
+  limiter.Release();
+  EXPECT_EQ(limiter.GetCurrentLoad(), 0);
+  EXPECT_EQ(limiter.GetLimit(), 2);
+}
+
+UTEST(HttpClientConcurrencyLimiter, IncreasesWhileLatencyIsStable) {
+  ConcurrencyLimiter limiter{MakeSettings(2)};
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(limiter.TryAcquire());
+    limiter.Release(kLatency, false);
+  }
+  EXPECT_EQ(limiter.GetLimit(), 10);
+}
+
+UTEST(HttpClientConcurrencyLimiter, DecreasesOnOverload) {
+  ConcurrencyLimiter limiter{MakeSettings(10)};
+
+  ASSERT_TRUE(limiter.TryAcquire());
+  limiter.Release(kLatency, true);
+  EXPECT_EQ(limiter.GetLimit(), 9);
+
+  // The responses to the requests sent before the decrease are ignored
+  ASSERT_TRUE(limiter.TryAcquire());
+  limiter.Release(kLatency, true);
+  EXPECT_EQ(limiter.GetLimit(), 9);
+}
+
+UTEST(HttpClientConcurrencyLimiter, DecreasesOnLatencySpike) {
+  ConcurrencyLimiter limiter{MakeSettings(10)};
+
+  ASSERT_TRUE(limiter.TryAcquire());
+  limiter.Release(kLatency, false);
+  EXPECT_EQ(limiter.GetLimit(), 10);
+
+  ASSERT_TRUE(limiter.TryAcquire());
+  limiter.Release(kLatency * 10, false);
+  EXPECT_EQ(limiter.GetLimit(), 9);
+}
+
+UTEST(HttpClientConcurrencyLimiter, Client) {
+  const utest::SimpleServer http_server{&SlowCallback};
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 1;
+  settings.concurrency_limit = MakeSettings(1);
+  clients::http::Client http_client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  const auto make_request = [&] {
+    return http_client.CreateRequest()
+        .get(http_server.GetBaseUrl())
+        .SetDestinationMetricName("slow")
+        .retry(1)
+        .timeout(kTimeout);
+  };
+
+  auto first = make_request().async_perform();
+  UEXPECT_THROW(make_request().perform(),
+                clients::http::ConcurrencyLimitException);
+  EXPECT_TRUE(first.Get()->IsOk());
+
+  // The unit of the limit is freed on the response
+  EXPECT_TRUE(make_request().perform()->IsOk());
+}
+
+USERVER_NAMESPACE_END
@@ -79,6 +79,30 @@ void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
   max_auto_destinations_ = max_auto_destinations;
 }
 
+std::optional<std::chrono::milliseconds>
+DestinationStatistics::GetTimingsPercentile(const std::string& destination,
+                                            double percent) const {
+  const auto stats = rcu_map_.Get(destination);
+  if (!stats) return std::nullopt;
+  return stats->GetTimingsPercentile(percent);
+}
+
+void DestinationStatistics::SetConcurrencyLimitSettings(
+    const impl::ConcurrencyLimitSettings& settings) {
+  concurrency_limit_settings_ = settings;
+}
+
+std::shared_ptr<ConcurrencyLimiter>
+DestinationStatistics::GetConcurrencyLimiter(const std::string& destination) {
+  if (!concurrency_limit_settings_.enabled) return {};
+
+  auto limiter = concurrency_limiters_.Get(destination);
+  if (limiter) return limiter;
+  return concurrency_limiters_
+      .TryEmplace(destination, concurrency_limit_settings_)
+      .value;
+}
+
 DestinationStatistics::DestinationsMap::ConstIterator
 DestinationStatistics::begin() const {
   return rcu_map_.begin();
@@ -96,6 +120,15 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer.ValueWithLabels(FullInstanceStatisticsView{instance_stat},
                            {"http_destination", url});
   }
+
+  for (const auto& [url, limiter] : stats.GetConcurrencyLimiters()) {
+    const utils::statistics::LabelView label{"http_destination", url};
+    writer["concurrency-limit"].ValueWithLabels(limiter->GetLimit(), label);
+    writer["concurrency-current"].ValueWithLabels(limiter->GetCurrentLoad(),
+                                                  label);
+    writer["concurrency-rejected"].ValueWithLabels(limiter->GetRejectedCount(),
+                                                   label);
+  }
 }
 
 }  // namespace clients::http
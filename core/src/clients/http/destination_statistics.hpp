@@ -1,11 +1,15 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
 
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
+#include <clients/http/concurrency_limiter.hpp>
 #include <clients/http/statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,7 +29,25 @@ class DestinationStatistics final {
 
   void SetAutoMaxSize(size_t max_auto_destinations);
 
+  // Returns the percentile of the recent timings of the destination, if any
+  std::optional<std::chrono::milliseconds> GetTimingsPercentile(
+      const std::string& destination, double percent) const;
+
+  // Must be called before any of the requests
+  void SetConcurrencyLimitSettings(
+      const impl::ConcurrencyLimitSettings& settings);
+
+  // Returns nullptr if the concurrency limit is disabled. Should be called
+  // only for the destinations that have statistics, to bound their number.
+  std::shared_ptr<ConcurrencyLimiter> GetConcurrencyLimiter(
+      const std::string& destination);
+
   using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
+  using ConcurrencyLimitersMap = rcu::RcuMap<std::string, ConcurrencyLimiter>;
+
+  const ConcurrencyLimitersMap& GetConcurrencyLimiters() const {
+    return concurrency_limiters_;
+  }
 
   DestinationsMap::ConstIterator begin() const;
   DestinationsMap::ConstIterator end() const;
@@ -40,6 +62,9 @@ class DestinationStatistics final {
   rcu::RcuMap<std::string, Statistics> rcu_map_;
   size_t max_auto_destinations_{0};
   std::atomic<size_t> current_auto_destinations_{0};
+
+  impl::ConcurrencyLimitSettings concurrency_limit_settings_;
+  ConcurrencyLimitersMap concurrency_limiters_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -0,0 +1,110 @@
+#include <userver/clients/http/hedging.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <clients/http/destination_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::int64_t kBudgetPerRequest = 1000;
+// Allows a short burst of the duplicate requests
+constexpr std::int64_t kMaxBudget = 10 * kBudgetPerRequest;
+
+constexpr std::chrono::seconds kPercentileUpdatePeriod{1};
+
+}  // namespace
+
+HedgedRequests::HedgedRequests(Client& client, HedgingSettings settings)
+    : client_(client), settings_(std::move(settings)) {
+  if (settings_.max_hedged_ratio < 0 || settings_.max_hedged_ratio > 1) {
+    throw std::invalid_argument(
+        "HedgingSettings::max_hedged_ratio should be in [0, 1]");
+  }
+  if (settings_.delay_percentile && settings_.destination.empty()) {
+    throw std::invalid_argument(
+        "HedgingSettings::destination is required for the delay_percentile");
+  }
+}
+
+std::shared_ptr<Response> HedgedRequests::Perform(
+    const RequestFactory& request_factory) {
+  AccountRequest();
+
+  auto first = request_factory(client_).async_perform();
+  if (engine::WaitAnyFor(GetDelay(), first) ||
+      engine::current_task::ShouldCancel() || !TryAcquireBudget()) {
+    return first.Get();
+  }
+
+  ++hedged_count_;
+  auto second = request_factory(client_).async_perform();
+  const auto completed = engine::WaitAny(first, second);
+  // Throws on the task cancellation
+  if (!completed) return first.Get();
+
+  // The other request is cancelled by the ResponseFuture destructor
+  auto& winner = (*completed == 0 ? first : second);
+  auto& other = (*completed == 0 ? second : first);
+  try {
+    return winner.Get();
+  } catch (const std::exception&) {
+    if (engine::current_task::ShouldCancel()) throw;
+    return other.Get();
+  }
+}
+
+std::chrono::milliseconds HedgedRequests::GetDelay() {
+  if (!settings_.delay_percentile) return settings_.delay;
+
+  const auto now = utils::datetime::SteadyNow().time_since_epoch().count();
+  auto next_update = next_percentile_update_.load();
+  if (now >= next_update &&
+      next_percentile_update_.compare_exchange_strong(
+          next_update,
+          now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    kPercentileUpdatePeriod)
+                    .count())) {
+    const auto percentile =
+        client_.GetDestinationStatistics().GetTimingsPercentile(
+            settings_.destination, *settings_.delay_percentile);
+    percentile_delay_ms_ = percentile ? percentile->count() : -1;
+  }
+
+  const auto delay_ms = percentile_delay_ms_.load();
+  if (delay_ms < 0) return settings_.delay;
+  return std::chrono::milliseconds{delay_ms};
+}
+
+void HedgedRequests::AccountRequest() noexcept {
+  const auto income = static_cast<std::int64_t>(settings_.max_hedged_ratio *
+                                                kBudgetPerRequest);
+  auto budget = budget_.load();
+  while (budget < kMaxBudget) {
+    const auto new_budget = std::min(budget + income, kMaxBudget);
+    if (budget_.compare_exchange_weak(budget, new_budget)) return;
+  }
+}
+
+bool HedgedRequests::TryAcquireBudget() noexcept {
+  auto budget = budget_.load();
+  while (budget >= kBudgetPerRequest) {
+    if (budget_.compare_exchange_weak(budget, budget - kBudgetPerRequest)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
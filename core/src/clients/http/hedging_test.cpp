@@ -0,0 +1,116 @@
+#include <userver/clients/http/hedging.hpp>
+
+#include <atomic>
+#include <string>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr auto kTimeout = utest::kMaxTestWaitTime;
+
+// Responds with the number of the request, the `slow_request` is delayed
+class NumberingCallback final {
+ public:
+  NumberingCallback(int slow_request, std::chrono::milliseconds slow_delay)
+      : slow_request_(slow_request), slow_delay_(slow_delay) {}
+
+  HttpResponse operator()(const HttpRequest&) {
+    const auto number = ++*requests_;
+    if (number == slow_request_) engine::InterruptibleSleepFor(slow_delay_);
+
+    const auto body = std::to_string(number);
+    return {"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " +
+                std::to_string(body.size()) + "\r\n\r\n" + body,
+            HttpResponse::kWriteAndClose};
+  }
+
+  int GetRequests() const { return *requests_; }
+
+ private:
+  const int slow_request_;
+  const std::chrono::milliseconds slow_delay_;
+  std::shared_ptr<std::atomic<int>> requests_ =
+      std::make_shared<std::atomic<int>>(0);
+};
+
+clients::http::HedgedRequests::RequestFactory MakeFactory(
+    const utest::SimpleServer& server) {
+  return [url = server.GetBaseUrl()](clients::http::Client& client) {
+    return client.CreateRequest().get(url).retry(1).timeout(kTimeout);
+  };
+}
+
+}  // namespace
+
+UTEST(HttpClientHedging, SlowResponse) {
+  const NumberingCallback callback{1, kTimeout};
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::HedgingSettings settings;
+  settings.delay = std::chrono::milliseconds{10};
+  settings.max_hedged_ratio = 1;
+  clients::http::HedgedRequests hedged{*http_client_ptr, settings};
+
+  const auto response = hedged.Perform(MakeFactory(http_server));
+  EXPECT_EQ(response->body(), "2");
+  EXPECT_EQ(hedged.GetHedgedCount(), 1);
+  EXPECT_EQ(callback.GetRequests(), 2);
+}
+
+UTEST(HttpClientHedging, FastResponse) {
+  const NumberingCallback callback{0, {}};
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::HedgingSettings settings;
+  settings.delay = kTimeout;
+  settings.max_hedged_ratio = 1;
+  clients::http::HedgedRequests hedged{*http_client_ptr, settings};
+
+  EXPECT_EQ(hedged.Perform(MakeFactory(http_server))->body(), "1");
+  EXPECT_EQ(hedged.Perform(MakeFactory(http_server))->body(), "2");
+  EXPECT_EQ(hedged.GetHedgedCount(), 0);
+}
+
+UTEST(HttpClientHedging, Budget) {
+  const NumberingCallback callback{1, std::chrono::milliseconds{100}};
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::HedgingSettings settings;
+  settings.delay = std::chrono::milliseconds{10};
+  // A duplicate per 2 requests, the first request does not earn one
+  settings.max_hedged_ratio = 0.5;
+  clients::http::HedgedRequests hedged{*http_client_ptr, settings};
+
+  EXPECT_EQ(hedged.Perform(MakeFactory(http_server))->body(), "1");
+  EXPECT_EQ(hedged.GetHedgedCount(), 0);
+  EXPECT_EQ(callback.GetRequests(), 1);
+}
+
+UTEST(HttpClientHedging, InvalidSettings) {
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::HedgingSettings settings;
+  settings.max_hedged_ratio = 2;
+  UEXPECT_THROW(clients::http::HedgedRequests(*http_client_ptr, settings),
+                std::invalid_argument);
+
+  settings.max_hedged_ratio = 0.1;
+  settings.delay_percentile = 95;
+  UEXPECT_THROW(clients::http::HedgedRequests(*http_client_ptr, settings),
+                std::invalid_argument);
+}
+
+USERVER_NAMESPACE_END
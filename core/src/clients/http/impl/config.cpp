@@ -1,5 +1,6 @@
 #include <userver/clients/http/impl/config.hpp>
 
+#include <stdexcept>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
@@ -37,6 +38,63 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(
   return result;
 }
 
+Http2Settings ParseHttp2Settings(const yaml_config::YamlConfig& value) {
+  Http2Settings result;
+  result.multiplexing = value["multiplexing"].As<bool>(result.multiplexing);
+  result.max_streams_per_connection =
+      value["max-streams-per-connection"].As<std::size_t>(
+          result.max_streams_per_connection);
+  result.max_host_connections =
+      value["max-host-connections"].As<std::optional<std::size_t>>();
+  result.wait_for_multiplexing =
+      value["wait-for-multiplexing"].As<bool>(result.wait_for_multiplexing);
+  result.prewarm_urls =
+      value["prewarm-urls"].As<std::vector<std::string>>(result.prewarm_urls);
+  result.prewarm_timeout =
+      value["prewarm-timeout"].As<std::chrono::milliseconds>(
+          result.prewarm_timeout);
+
+  if (result.max_streams_per_connection == 0) {
+    throw std::runtime_error(
+        "http2.max-streams-per-connection should be greater than 0");
+  }
+  if (result.max_host_connections == 0) {
+    throw std::runtime_error(
+        "http2.max-host-connections should be greater than 0");
+  }
+  return result;
+}
+
+ConcurrencyLimitSettings ParseConcurrencyLimitSettings(
+    const yaml_config::YamlConfig& value) {
+  ConcurrencyLimitSettings result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.initial_limit =
+      value["initial-limit"].As<std::size_t>(result.initial_limit);
+  result.min_limit = value["min-limit"].As<std::size_t>(result.min_limit);
+  result.max_limit = value["max-limit"].As<std::size_t>(result.max_limit);
+  result.latency_tolerance =
+      value["latency-tolerance"].As<double>(result.latency_tolerance);
+  result.queue_timeout = value["queue-timeout"].As<std::chrono::milliseconds>(
+      result.queue_timeout);
+
+  if (result.min_limit == 0) {
+    throw std::runtime_error(
+        "concurrency-limit.min-limit should be greater than 0");
+  }
+  if (result.min_limit > result.max_limit ||
+      result.initial_limit < result.min_limit ||
+      result.initial_limit > result.max_limit) {
+    throw std::runtime_error(
+        "concurrency-limit.initial-limit should be in [min-limit, max-limit]");
+  }
+  if (result.latency_tolerance <= 1) {
+    throw std::runtime_error(
+        "concurrency-limit.latency-tolerance should be greater than 1");
+  }
+  return result;
+}
+
 }  // namespace
 
 ClientSettings Parse(const yaml_config::YamlConfig& value,
@@ -46,7 +104,12 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
       value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
+  result.worker_thread_affinity = value["worker-thread-affinity"].As<bool>(
+      result.worker_thread_affinity);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.http2 = ParseHttp2Settings(value["http2"]);
+  result.concurrency_limit =
+      ParseConcurrencyLimitSettings(value["concurrency-limit"]);
   return result;
 }
 
@@ -24,6 +24,7 @@
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/request_state.hpp>
+#include <clients/http/requests_coalescer.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
@@ -221,10 +222,20 @@ Request::Request(std::shared_ptr<impl::EasyWrapper>&& wrapper,
 }
 
 ResponseFuture Request::async_perform(utils::impl::SourceLocation location) {
-  return {pimpl_->async_perform(location),
-          std::chrono::milliseconds(
-              complete_timeout(pimpl_->timeout(), pimpl_->retries())),
-          pimpl_};
+  const std::chrono::milliseconds total_timeout{
+      complete_timeout(pimpl_->timeout(), pimpl_->retries())};
+
+  if (auto key = pimpl_->GetCoalescingKey()) {
+    auto future = pimpl_->GetRequestsCoalescer()->Perform(
+        std::move(*key), pimpl_->GetCoalescingCacheTtl(),
+        [this, location]() -> RequestsCoalescer::Upstream {
+          return {pimpl_->async_perform(location), pimpl_};
+        });
+    // The upstream request is shared, so it is not cancelled with the future
+    return {std::move(future), total_timeout, nullptr};
+  }
+
+  return {pimpl_->async_perform(location), total_timeout, pimpl_};
 }
 
 StreamedResponse Request::async_perform_stream_body(
@@ -336,6 +347,14 @@ Request Request::retry(short retries, bool on_fails) && {
   return std::move(this->retry(retries, on_fails));
 }
 
+Request& Request::coalesce(std::chrono::milliseconds cache_ttl) & {
+  pimpl_->coalesce(cache_ttl);
+  return *this;
+}
+Request Request::coalesce(std::chrono::milliseconds cache_ttl) && {
+  return std::move(this->coalesce(cache_ttl));
+}
+
 Request& Request::unix_socket_path(const std::string& path) & {
   pimpl_->unix_socket_path(path);
   return *this;
@@ -456,6 +475,7 @@ Request Request::cookies(
 }
 
 Request& Request::method(HttpMethod method) & {
+  pimpl_->set_method(method);
   switch (method) {
     case HttpMethod::kDelete:
     case HttpMethod::kOptions:
@@ -592,6 +612,10 @@ void Request::SetAllowedUrlsExtra(const std::vector<std::string>& urls) & {
   pimpl_->SetAllowedUrlsExtra(urls);
 }
 
+void Request::SetRequestsCoalescer(RequestsCoalescer* coalescer) & {
+  pimpl_->SetRequestsCoalescer(coalescer);
+}
+
 void Request::SetDeadlinePropagationConfig(
     const impl::DeadlinePropagationConfig& deadline_propagation_config) & {
   pimpl_->SetDeadlinePropagationConfig(deadline_propagation_config);
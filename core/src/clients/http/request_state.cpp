@@ -14,6 +14,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 
 #include <curl-ev/error_code.hpp>
+#include <engine/ev/thread_control.hpp>
 #include <userver/baggage/baggage.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
@@ -43,6 +44,10 @@ constexpr auto kEBBaseTime = std::chrono::milliseconds{25};
 /// Least http code that we treat as bad for exponential backoff algorithm
 constexpr long kLeastBadHttpCodeForEB = 500;
 
+bool HasCapacity(const concurrent::StringStreamQueue& queue, std::size_t size) {
+  return queue.GetSizeApproximate() + size <= queue.GetSoftMaxSize();
+}
+
 constexpr Status kFakeHttpErrorCode{599};
 
 const std::string kTracingClientName = "external";
@@ -185,6 +190,8 @@ RequestState::RequestState(
 }
 
 RequestState::~RequestState() {
+  ReleaseConcurrencyLimit();
+
   std::error_code ec;
   easy().set_error_buffer(nullptr, ec);
   UASSERT(!ec);
@@ -291,6 +298,12 @@ void RequestState::proxy_auth_type(curl::easy::proxyauth_t value) {
   easy().set_proxy_auth(value);
 }
 
+void RequestState::coalesce(std::chrono::milliseconds cache_ttl) {
+  UASSERT(cache_ttl >= std::chrono::milliseconds::zero());
+  is_coalescing_enabled_ = true;
+  coalescing_cache_ttl_ = cache_ttl;
+}
+
 void RequestState::Cancel() {
   // We can not call `retry_.timer.reset();` here because of data race
   is_cancelled_ = true;
@@ -303,6 +316,7 @@ void RequestState::SetDestinationMetricNameAuto(std::string destination) {
 
 void RequestState::SetDestinationMetricName(const std::string& destination) {
   dest_req_stats_ = dest_stats_->GetStatisticsForDestination(destination);
+  concurrency_limiter_ = dest_stats_->GetConcurrencyLimiter(destination);
 }
 
 void RequestState::SetTestsuiteConfig(
@@ -314,6 +328,26 @@ void RequestState::SetAllowedUrlsExtra(const std::vector<std::string>& urls) {
   allowed_urls_extra_ = urls;
 }
 
+void RequestState::SetRequestsCoalescer(RequestsCoalescer* coalescer) {
+  coalescer_ = coalescer;
+}
+
+std::optional<std::string> RequestState::GetCoalescingKey() const {
+  if (!is_coalescing_enabled_ || !coalescer_ || !method_) return std::nullopt;
+  // Only the requests without side effects may share a response
+  if (*method_ != HttpMethod::kGet && *method_ != HttpMethod::kHead) {
+    return std::nullopt;
+  }
+  if (easy().has_post_data()) return std::nullopt;
+
+  std::string key{ToStringView(*method_)};
+  key += ' ';
+  key += easy().get_original_url();
+  key += '\n';
+  easy().AppendHeaders(key);
+  return key;
+}
+
 void RequestState::DisableReplyDecoding() {
   easy().set_accept_encoding(nullptr);
 }
@@ -391,9 +425,18 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   holder->plugin_pipeline_.HookOnCompleted(*holder, *holder->response());
 
   holder->AccountResponse(err);
+  holder->ReleaseConcurrencyLimit(err, status_code);
   const auto sockets = easy.get_num_connects();
   holder->WithRequestStats(
       [sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+  // 0 if no connection was made, e.g. the request failed to resolve the host
+  const auto http_version = easy.get_http_version();
+  if (http_version != 0) {
+    const bool is_http2 = http_version >= curl::easy::http_version_2_0;
+    holder->WithRequestStats([sockets, is_http2](RequestStats& stats) {
+      stats.AccountConnection(sockets != 0, is_http2);
+    });
+  }
 
   span.AddTag(tracing::kAttempts, holder->retry_.current);
   span.AddTag(tracing::kMaxAttempts, holder->retry_.retries);
@@ -581,6 +624,13 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(
   ApplyTestsuiteConfig();
   StartStats();
 
+  if (auto exc = AcquireConcurrencyLimit()) {
+    span.AddTag(tracing::kErrorFlag, true);
+    span_storage_.reset();
+    std::get<FullBufferedData>(data_).promise_.set_exception(std::move(exc));
+    return future;
+  }
+
   perform_request([holder = shared_from_this()](std::error_code err) mutable {
     RequestState::on_retry(std::move(holder), err);
   });
@@ -590,6 +640,9 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(
 
 void RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue,
                                         utils::impl::SourceLocation location) {
+  // Otherwise a chunk of cURL may never fit into the queue
+  UINVARIANT(queue->GetSoftMaxSize() >= CURL_MAX_WRITE_SIZE,
+             "The stream queue is too small for the chunks of the body");
   data_.emplace<StreamData>(queue->GetProducer());
 
   StartNewSpan(location);
@@ -613,6 +666,15 @@ void RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue,
   ApplyTestsuiteConfig();
   StartStats();
 
+  if (auto exc = AcquireConcurrencyLimit()) {
+    span.AddTag(tracing::kErrorFlag, true);
+    span_storage_.reset();
+    auto& stream_data = std::get<StreamData>(data_);
+    stream_data.headers_promise_set = true;
+    stream_data.headers_promise.set_exception(std::move(exc));
+    return;
+  }
+
   perform_request([holder = shared_from_this()](std::error_code err) mutable {
     RequestState::on_completed(std::move(holder), err);
   });
@@ -629,6 +691,7 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
   UpdateTimeoutFromDeadline();
   SetEasyTimeout(effective_timeout_);
   if (effective_timeout_ <= std::chrono::milliseconds{0}) {
+    ReleaseConcurrencyLimit();
     auto exc = PrepareDeadlineAlreadyPassedException();
 
     std::visit(
@@ -740,6 +803,46 @@ void RequestState::AccountResponse(std::error_code err) {
   });
 }
 
+std::exception_ptr RequestState::AcquireConcurrencyLimit() {
+  // A reused request might have left its unit if it was not sent
+  ReleaseConcurrencyLimit();
+  if (!concurrency_limiter_) return {};
+
+  if (!concurrency_limiter_->TryAcquire()) {
+    return std::make_exception_ptr(ConcurrencyLimitException(
+        fmt::format("Concurrency limit {} of the destination is reached, "
+                    "url: {}",
+                    concurrency_limiter_->GetLimit(), GetLoggedOriginalUrl()),
+        easy().get_local_stats()));
+  }
+  concurrency_acquired_at_ = std::chrono::steady_clock::now();
+  return {};
+}
+
+void RequestState::ReleaseConcurrencyLimit(std::error_code err,
+                                           Status status_code) {
+  if (!concurrency_acquired_at_) return;
+  const auto latency =
+      std::chrono::steady_clock::now() - *concurrency_acquired_at_;
+  concurrency_acquired_at_.reset();
+
+  if (is_cancelled_) {
+    // Says nothing about the destination
+    concurrency_limiter_->Release();
+    return;
+  }
+  const bool is_overload = err || status_code == Status::TooManyRequests ||
+                           status_code == Status::ServiceUnavailable ||
+                           status_code == Status::GatewayTimeout;
+  concurrency_limiter_->Release(latency, is_overload);
+}
+
+void RequestState::ReleaseConcurrencyLimit() noexcept {
+  if (!concurrency_acquired_at_) return;
+  concurrency_acquired_at_.reset();
+  concurrency_limiter_->Release();
+}
+
 std::exception_ptr RequestState::PrepareException(std::error_code err) {
   if (timeout_updated_by_deadline_ && IsTimeout(err)) {
     WithRequestStats(
@@ -785,28 +888,42 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb,
                      actual_size)
               << tracing::impl::LogSpanAsLast{rs.span_storage_->Get()};
 
-  std::string buffer(ptr, actual_size);
   auto& queue_producer = stream_data->queue_producer;
+  const auto queue = queue_producer.Queue();
 
   if (!stream_data->headers_promise_set.exchange(true)) {
     stream_data->headers_promise.set_value();
     LOG_DEBUG() << "Stream API, status code is set (with body)";
   }
 
-  if (queue_producer.PushNoblock(std::move(buffer))) {
-    return actual_size;
-  }
-  LOG_DEBUG() << "PushNoblock() has failed";
-
-  if (queue_producer.Queue()->NoMoreConsumers()) {
-    return actual_size;
+  // The rest of the body is dropped
+  if (queue->NoMoreConsumers()) return actual_size;
+
+  // Instead of buffering the body, the transfer waits for the consumer. cURL
+  // keeps the chunk and passes it again once the transfer is resumed.
+  if (!HasCapacity(*queue, actual_size)) {
+    stream_data->is_paused = true;
+    // The consumer could have freed the queue before it saw the flag
+    if (!HasCapacity(*queue, actual_size)) {
+      LOG_DEBUG() << "Stream API, the queue is full, pausing the transfer";
+      return CURL_WRITEFUNC_PAUSE;
+    }
+    stream_data->is_paused = false;
   }
 
-  LOG_DEBUG() << "There are some alive consumers";
+  // Fails only if the consumer is gone meanwhile
+  [[maybe_unused]] const auto success =
+      queue_producer.PushNoblock(std::string(ptr, actual_size));
+  return actual_size;
+}
 
-  UINVARIANT(false, "not implemented CURL_WRITEFUNC_PAUSE TAXICOMMON-5611");
+void RequestState::ResumeStream() {
+  auto* stream_data = std::get_if<StreamData>(&data_);
+  UASSERT(stream_data);
+  if (!stream_data->is_paused.exchange(false)) return;
 
-  return CURL_WRITEFUNC_PAUSE;
+  easy().GetThreadControl().RunInEvLoopAsync(
+      [holder = shared_from_this()] { holder->easy().unpause(); });
 }
 
 void RequestState::ApplyTestsuiteConfig() {
@@ -845,7 +962,7 @@ void RequestState::StartNewSpan(utils::impl::SourceLocation location) {
   auto request_editable_instance = GetEditableTracingInstance();
 
   if (headers_propagator_) {
-    headers_propagator_->PropagateHeaders(request_editable_instance);
+    headers_propagator_->PropagateHeaders(easy());
   }
   tracing_manager_->FillRequestWithTracingContext(span,
                                                   request_editable_instance);
@@ -860,6 +977,10 @@ void RequestState::StartStats() {
   if (!dest_req_stats_) {
     dest_req_stats_ =
         dest_stats_->GetStatisticsForDestinationAuto(destination_metric_name_);
+    if (dest_req_stats_) {
+      concurrency_limiter_ =
+          dest_stats_->GetConcurrencyLimiter(destination_metric_name_);
+    }
   }
 
   WithRequestStats([](RequestStats& stats) { stats.Start(); });
@@ -11,6 +11,7 @@
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/request.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -26,6 +27,7 @@
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/not_null.hpp>
 
+#include <clients/http/concurrency_limiter.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/testsuite.hpp>
@@ -40,6 +42,7 @@ namespace clients::http {
 
 class StreamedResponse;
 class ConnectTo;
+class RequestsCoalescer;
 
 class RequestState : public std::enable_shared_from_this<RequestState> {
  public:
@@ -92,6 +95,10 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void proxy(const std::string& value);
   /// sets proxy auth type to use
   void proxy_auth_type(curl::easy::proxyauth_t value);
+  /// remember the method for the coalescing
+  void set_method(HttpMethod method) { method_ = method; }
+  /// join the identical concurrent requests
+  void coalesce(std::chrono::milliseconds cache_ttl);
 
   /// get timeout value in milliseconds
   long timeout() const { return original_timeout_.count(); }
@@ -111,6 +118,14 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void SetAllowedUrlsExtra(const std::vector<std::string>& urls);
 
+  void SetRequestsCoalescer(RequestsCoalescer* coalescer);
+  RequestsCoalescer* GetRequestsCoalescer() const { return coalescer_; }
+  std::chrono::milliseconds GetCoalescingCacheTtl() const {
+    return coalescing_cache_ttl_;
+  }
+  /// Returns the key if the request may be joined with the identical ones
+  std::optional<std::string> GetCoalescingKey() const;
+
   void DisableReplyDecoding();
 
   void SetDeadlinePropagationConfig(
@@ -158,8 +173,14 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   static size_t StreamWriteFunction(char* ptr, size_t size, size_t nmemb,
                                     void* userdata);
+  // Resumes the transfer if it waits for the stream consumer
+  void ResumeStream();
 
   void AccountResponse(std::error_code err);
+  // Returns an exception if the concurrency limit of the destination is reached
+  std::exception_ptr AcquireConcurrencyLimit();
+  void ReleaseConcurrencyLimit(std::error_code err, Status status_code);
+  void ReleaseConcurrencyLimit() noexcept;
   std::exception_ptr PrepareException(std::error_code err);
   std::exception_ptr PrepareDeadlinePassedException(std::string_view url);
 
@@ -182,9 +203,18 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   std::shared_ptr<DestinationStatistics> dest_stats_;
   std::string destination_metric_name_;
 
+  std::shared_ptr<ConcurrencyLimiter> concurrency_limiter_;
+  // Set while the request holds a unit of the concurrency limit
+  std::optional<std::chrono::steady_clock::time_point> concurrency_acquired_at_;
+
   std::shared_ptr<const TestsuiteConfig> testsuite_config_;
   std::vector<std::string> allowed_urls_extra_;
 
+  std::optional<HttpMethod> method_;
+  RequestsCoalescer* coalescer_{nullptr};
+  bool is_coalescing_enabled_{false};
+  std::chrono::milliseconds coalescing_cache_ttl_{0};
+
   crypto::PrivateKey pkey_;
   crypto::Certificate cert_;
   crypto::Certificate ca_;
@@ -232,6 +262,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
           headers_future(headers_promise.get_future()) {}
 
     Queue::Producer queue_producer;
+    // The transfer is paused until the consumer frees the queue
+    std::atomic<bool> is_paused{false};
     std::atomic<bool> headers_promise_set;
     engine::Promise<void> headers_promise;
     engine::Future<void> headers_future;
@@ -0,0 +1,124 @@
+#include <clients/http/requests_coalescer.hpp>
+
+#include <utility>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+
+#include <clients/http/request_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+RequestsCoalescer::~RequestsCoalescer() { tasks_.CancelAndWait(); }
+
+engine::Future<std::shared_ptr<Response>> RequestsCoalescer::Perform(
+    std::string key, std::chrono::milliseconds cache_ttl,
+    const StartFunction& start) {
+  engine::Promise<std::shared_ptr<Response>> promise;
+  auto future = promise.get_future();
+
+  std::shared_ptr<Entry> entry;
+  {
+    std::lock_guard lock(mutex_);
+    auto& existing = entries_[key];
+    if (existing && !existing->response) {
+      existing->waiters.push_back(std::move(promise));
+      return future;
+    }
+    if (existing &&
+        existing->expires_at > std::chrono::steady_clock::now()) {
+      promise.set_value(std::make_shared<Response>(*existing->response));
+      return future;
+    }
+
+    existing = std::make_shared<Entry>();
+    existing->waiters.push_back(std::move(promise));
+    entry = existing;
+  }
+
+  LOG_DEBUG() << "Starting a coalesced HTTP request";
+  Upstream upstream;
+  try {
+    upstream = start();
+  } catch (const std::exception&) {
+    Complete(key, entry, {}, std::current_exception(), cache_ttl);
+    return future;
+  }
+
+  // The waiters may be cancelled independently, so the shared request is
+  // awaited in a separate task
+  tasks_.Detach(engine::CriticalAsyncNoSpan(
+      [this, key = std::move(key), entry = std::move(entry), cache_ttl,
+       upstream = std::move(upstream)]() mutable {
+        std::shared_ptr<Response> response;
+        std::exception_ptr exception;
+        try {
+          response = upstream.future.get();
+        } catch (const engine::WaitInterruptedException&) {
+          upstream.state->Cancel();
+          exception = std::make_exception_ptr(CancelException(
+              "Coalesced HTTP request was cancelled on the client shutdown",
+              {}));
+        } catch (const std::exception&) {
+          exception = std::current_exception();
+        }
+        upstream = {};
+
+        const bool is_cached = Complete(key, entry, std::move(response),
+                                        std::move(exception), cache_ttl);
+        if (!is_cached) return;
+
+        engine::InterruptibleSleepFor(cache_ttl);
+        Erase(key, entry);
+      }));
+  return future;
+}
+
+bool RequestsCoalescer::Complete(const std::string& key,
+                                 const std::shared_ptr<Entry>& entry,
+                                 std::shared_ptr<Response> response,
+                                 std::exception_ptr exception,
+                                 std::chrono::milliseconds ttl) {
+  const bool is_cached = !exception && response->IsOk() &&
+                         ttl > std::chrono::milliseconds::zero();
+  std::vector<engine::Promise<std::shared_ptr<Response>>> waiters;
+  {
+    std::lock_guard lock(mutex_);
+    waiters = std::move(entry->waiters);
+    if (is_cached) {
+      entry->response = response;
+      entry->expires_at = std::chrono::steady_clock::now() + ttl;
+    } else {
+      const auto it = entries_.find(key);
+      if (it != entries_.end() && it->second == entry) entries_.erase(it);
+    }
+  }
+
+  // Each waiter owns its response, so the last one gets the original
+  for (std::size_t i = 0; i < waiters.size(); ++i) {
+    if (exception) {
+      waiters[i].set_exception(exception);
+    } else if (i + 1 == waiters.size() && !is_cached) {
+      waiters[i].set_value(std::move(response));
+    } else {
+      waiters[i].set_value(std::make_shared<Response>(*response));
+    }
+  }
+  return is_cached;
+}
+
+void RequestsCoalescer::Erase(const std::string& key,
+                              const std::shared_ptr<Entry>& entry) {
+  std::lock_guard lock(mutex_);
+  const auto it = entries_.find(key);
+  if (it != entries_.end() && it->second == entry) entries_.erase(it);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
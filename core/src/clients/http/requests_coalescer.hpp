@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/future.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class RequestState;
+
+// Joins the identical concurrent requests into a single upstream request and
+// shares its response among all the waiters. A successful response may be
+// kept for a short time to answer the requests that come right after it.
+class RequestsCoalescer final {
+ public:
+  struct Upstream {
+    engine::Future<std::shared_ptr<Response>> future;
+    // Cancelled if the coalescer is destroyed while the request is in flight
+    std::shared_ptr<RequestState> state;
+  };
+
+  using StartFunction = std::function<Upstream()>;
+
+  RequestsCoalescer() = default;
+  ~RequestsCoalescer();
+
+  // Calls `start` if there is neither an in-flight request with the same key
+  // nor a fresh cached response for it
+  engine::Future<std::shared_ptr<Response>> Perform(
+      std::string key, std::chrono::milliseconds cache_ttl,
+      const StartFunction& start);
+
+ private:
+  struct Entry {
+    std::vector<engine::Promise<std::shared_ptr<Response>>> waiters;
+    std::shared_ptr<const Response> response;
+    std::chrono::steady_clock::time_point expires_at;
+  };
+
+  // Returns whether the response is cached
+  bool Complete(const std::string& key, const std::shared_ptr<Entry>& entry,
+                std::shared_ptr<Response> response,
+                std::exception_ptr exception, std::chrono::milliseconds ttl);
+  void Erase(const std::string& key, const std::shared_ptr<Entry>& entry);
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<Entry>> entries_;
+  concurrent::BackgroundTaskStorageCore tasks_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
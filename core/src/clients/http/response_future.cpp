@@ -47,7 +47,8 @@ void ResponseFuture::Detach() {
 std::future_status ResponseFuture::Wait() {
   auto status = future_.wait_until(deadline_);
   if (status == engine::FutureStatus::kCancelled) {
-    const auto stats = request_state_->easy().get_local_stats();
+    const auto stats = request_state_ ? request_state_->easy().get_local_stats()
+                                      : LocalStats{};
 
     // request_ has armed timers to retry the request. Stopping those ASAP.
     Cancel();
@@ -61,6 +61,10 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
   stats_.socket_open_ += sockets;
 }
 
+void RequestStats::AccountConnection(bool is_new, bool is_http2) noexcept {
+  ++stats_.connections_[Statistics::ToConnectionKind(is_new, is_http2)];
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
   ++stats_.timeout_updated_by_deadline_;
 }
@@ -131,6 +135,13 @@ void Statistics::AccountError(ErrorGroup error) {
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+std::optional<std::chrono::milliseconds> Statistics::GetTimingsPercentile(
+    double percent) const {
+  const auto timings = timings_percentile_.GetStatsForPeriod();
+  if (timings.Count() == 0) return std::nullopt;
+  return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const InstanceStatistics& stats, FormatMode format_mode) {
   writer["timings"] = stats.timings_percentile;
@@ -145,6 +156,14 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["reply-statuses"] = stats.reply_status;
 
   writer["retries"] = stats.retries;
+  for (const bool is_new : {false, true}) {
+    for (const bool is_http2 : {false, true}) {
+      writer["connection-reuse"].ValueWithLabels(
+          stats.connections[Statistics::ToConnectionKind(is_new, is_http2)],
+          {{"http_connection", is_new ? "new" : "reused"},
+           {"http_version", is_http2 ? "2" : "1"}});
+    }
+  }
   writer["pending-requests"] = stats.easy_handles;
 
   writer["timeout-updated-by-deadline"] = stats.timeout_updated_by_deadline;
@@ -189,6 +208,8 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       reply_status(other.reply_status_) {
   for (size_t i = 0; i < error_count.size(); i++)
     error_count[i] = other.error_count_[i].load();
+  for (size_t i = 0; i < connections.size(); i++)
+    connections[i] = other.connections_[i].load();
   multi.socket_open = other.socket_open_;
 }
 
@@ -217,6 +238,9 @@ InstanceStatistics& InstanceStatistics::operator+=(
     error_count[i] += stat.error_count[i];
   }
   retries += stat.retries;
+  for (size_t i = 0; i < Statistics::kConnectionKindCount; i++) {
+    connections[i] += stat.connections[i];
+  }
 
   timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
   cancelled_by_deadline += stat.cancelled_by_deadline;
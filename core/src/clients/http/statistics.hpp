@@ -1,7 +1,10 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -29,6 +32,7 @@ class RequestStats final {
   void StoreTimeToStart(std::chrono::microseconds micro_seconds) noexcept;
 
   void AccountOpenSockets(size_t sockets) noexcept;
+  void AccountConnection(bool is_new, bool is_http2) noexcept;
 
   void AccountTimeoutUpdatedByDeadline() noexcept;
   void AccountCancelledByDeadline() noexcept;
@@ -81,6 +85,12 @@ class Statistics {
   static constexpr auto kErrorGroupCount =
       static_cast<std::size_t>(Statistics::ErrorGroup::kCount);
 
+  // new or reused HTTP/1 or HTTP/2 connection
+  static constexpr std::size_t kConnectionKindCount = 4;
+  static std::size_t ToConnectionKind(bool is_new, bool is_http2) noexcept {
+    return (is_new ? 2 : 0) + (is_http2 ? 1 : 0);
+  }
+
   static ErrorGroup ErrorCodeToGroup(std::error_code ec);
 
   static const char* ToString(ErrorGroup error);
@@ -89,6 +99,9 @@ class Statistics {
 
   void AccountStatus(int);
 
+  std::optional<std::chrono::milliseconds> GetTimingsPercentile(
+      double percent) const;
+
  private:
   std::atomic<uint64_t> easy_handles_{0};
   std::atomic<uint64_t> last_time_to_start_us_{0};
@@ -99,6 +112,8 @@ class Statistics {
       {0, 0, 0, 0, 0, 0, 0}};
   std::atomic_llong retries_{0};
   std::atomic_llong socket_open_{0};
+  std::array<std::atomic<uint64_t>, kConnectionKindCount> connections_{
+      {0, 0, 0, 0}};
 
   std::atomic<std::uint64_t> timeout_updated_by_deadline_{0};
   std::atomic<std::uint64_t> cancelled_by_deadline_{0};
@@ -127,6 +142,8 @@ struct InstanceStatistics {
   std::array<uint64_t, Statistics::kErrorGroupCount> error_count{
       {0, 0, 0, 0, 0, 0, 0}};
   uint64_t retries{0};
+  std::array<uint64_t, Statistics::kConnectionKindCount> connections{
+      {0, 0, 0, 0}};
 
   std::uint64_t timeout_updated_by_deadline{0};
   std::uint64_t cancelled_by_deadline{0};
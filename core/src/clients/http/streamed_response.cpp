@@ -15,6 +15,13 @@ StreamedResponse::StreamedResponse(Queue::Consumer&& queue_consumer,
   UASSERT(std::get_if<RequestState::StreamData>(&request_state_->data_));
 }
 
+StreamedResponse::~StreamedResponse() {
+  if (!request_state_) return;  // moved out
+  // The resumed transfer drops the rest of the body without the consumer
+  { [[maybe_unused]] const auto consumer = std::move(queue_consumer_); }
+  request_state_->ResumeStream();
+}
+
 std::future_status StreamedResponse::WaitForHeaders(engine::Deadline deadline) {
   if (response_) {
     LOG_DEBUG() << "WaitForHeaders() reply is cached";
@@ -72,7 +79,9 @@ bool StreamedResponse::ReadChunk(std::string& output,
                                  engine::Deadline deadline) {
   WaitForHeadersOrThrow(deadline_);
 
-  return queue_consumer_.Pop(output, deadline);
+  if (!queue_consumer_.Pop(output, deadline)) return false;
+  request_state_->ResumeStream();
+  return true;
 }
 
 }  // namespace clients::http
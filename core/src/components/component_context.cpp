@@ -51,6 +51,10 @@ const Manager& ComponentContext::GetManager() const {
 
 void ComponentContext::CancelComponentsLoad() { impl_->CancelComponentsLoad(); }
 
+const std::string& ComponentContext::GetStartupReport() const {
+  return impl_->GetStartupReport();
+}
+
 bool ComponentContext::IsAnyComponentInFatalState() const {
   return impl_->IsAnyComponentInFatalState();
 }
@@ -149,6 +149,35 @@ std::string ComponentInfo::GetDependencies() const {
                      fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::SetConstructionTimes(
+    std::chrono::steady_clock::time_point start,
+    std::chrono::steady_clock::time_point finish) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  construction_start_ = start;
+  construction_finish_ = finish;
+}
+
+void ComponentInfo::AddDependenciesWait(
+    std::chrono::steady_clock::duration wait) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  dependencies_wait_ += wait;
+}
+
+ComponentStartupTimes ComponentInfo::GetStartupTimes() const {
+  ComponentStartupTimes times;
+  times.name = name_;
+
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  times.construction_start = construction_start_;
+  times.construction_finish = construction_finish_;
+  times.dependencies_wait = dependencies_wait_;
+  times.dependencies.reserve(it_depends_on_.size());
+  for (const auto& dependency : it_depends_on_) {
+    times.dependencies.emplace_back(dependency.StringViewName());
+  }
+  return times;
+}
+
 bool ComponentInfo::HasComponent() const {
   std::lock_guard<engine::Mutex> lock(mutex_);
   return !!component_;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -10,6 +11,7 @@
 #include <userver/engine/mutex.hpp>
 
 #include "impl/component_name_from_info.hpp"
+#include "impl/startup_timeline.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -72,6 +74,11 @@ class ComponentInfo final {
 
   std::string GetDependencies() const;
 
+  void SetConstructionTimes(std::chrono::steady_clock::time_point start,
+                            std::chrono::steady_clock::time_point finish);
+  void AddDependenciesWait(std::chrono::steady_clock::duration wait);
+  ComponentStartupTimes GetStartupTimes() const;
+
  private:
   bool HasComponent() const;
   std::unique_ptr<ComponentBase> ExtractComponent();
@@ -92,6 +99,9 @@ class ComponentInfo final {
   ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
   bool stage_switching_cancelled_{false};
   std::atomic<bool> on_loading_cancelled_called_{false};
+  std::chrono::steady_clock::time_point construction_start_{};
+  std::chrono::steady_clock::time_point construction_finish_{};
+  std::chrono::steady_clock::duration dependencies_wait_{};
 };
 
 }  // namespace components::impl
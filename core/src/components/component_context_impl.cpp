@@ -5,18 +5,24 @@
 
 #include <fmt/format.h>
 
+#include <userver/cache/cache_update_trait.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/concurrent/variable.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
+#include <components/impl/startup_timeline.hpp>
 #include <components/manager.hpp>
+#include <components/manager_config.hpp>
 #include <engine/task/task_context.hpp>
+#include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -44,6 +50,18 @@ std::string JoinNamesFromInfo(const Container& container,
   return chain;
 }
 
+void WriteStartupFile(const std::string& path, std::string_view kind,
+                      std::string_view contents) {
+  if (path.empty()) return;
+  try {
+    fs::blocking::RewriteFileContents(path, contents);
+    LOG_INFO() << "Components startup " << kind << " is written to " << path;
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to write components startup " << kind << " to "
+                  << path << ": " << ex;
+  }
+}
+
 }  // namespace
 
 ComponentContext::Impl::TaskToComponentMapScope::TaskToComponentMapScope(
@@ -80,7 +98,7 @@ ComponentContext::Impl::SearchingComponentScope::~SearchingComponentScope() {
 
 ComponentContext::Impl::Impl(const Manager& manager,
                              std::vector<std::string>&& loading_component_names)
-    : manager_(manager) {
+    : manager_(manager), load_start_(std::chrono::steady_clock::now()) {
   UASSERT(std::is_sorted(loading_component_names.begin(),
                          loading_component_names.end()));
   UASSERT(std::unique(loading_component_names.begin(),
@@ -117,7 +135,12 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
-  component_info.SetComponent(factory(context));
+  const auto construction_start = std::chrono::steady_clock::now();
+  auto component_ptr = factory(context);
+  component_info.SetConstructionTimes(construction_start,
+                                      std::chrono::steady_clock::now());
+
+  component_info.SetComponent(std::move(component_ptr));
   auto* component = component_info.GetComponent();
   if (component) {
     // Call the following command on logs to get the component dependencies:
@@ -132,6 +155,7 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
 
 void ComponentContext::Impl::OnAllComponentsLoaded() {
   StopPrintAddingComponentsTask();
+  ReportStartupTimeline();
   tracing::Span span(kOnAllComponentsLoadedRootName);
   return ProcessAllComponentLifetimeStageSwitchings(
       {impl::ComponentLifetimeStage::kRunning,
@@ -343,6 +367,11 @@ impl::ComponentBase* ComponentContext::Impl::DoFindComponent(
   }
   SearchingComponentScope finder(*this, this_component_name);
 
+  const auto wait_start = std::chrono::steady_clock::now();
+  utils::FastScopeGuard account_wait([&]() noexcept {
+    components_.at(this_component_name)
+        .AddDependenciesWait(std::chrono::steady_clock::now() - wait_start);
+  });
   return component_info.WaitAndGetComponent();
 }
 
@@ -419,6 +448,35 @@ impl::ComponentNameFromInfo ComponentContext::Impl::GetLoadingComponentName(
   }
 }
 
+const std::string& ComponentContext::Impl::GetStartupReport() const {
+  return startup_report_;
+}
+
+void ComponentContext::Impl::ReportStartupTimeline() {
+  const auto load_finish = std::chrono::steady_clock::now();
+
+  std::vector<impl::ComponentStartupTimes> timeline;
+  timeline.reserve(components_.size());
+  for (const auto& [name, component_info] : components_) {
+    auto times = component_info.GetStartupTimes();
+    if (const auto* cache = dynamic_cast<const cache::CacheUpdateTrait*>(
+            component_info.GetComponent())) {
+      times.cache_first_update =
+          cache->GetFirstUpdateStagesDurations(utils::InternalTag{});
+    }
+    timeline.push_back(std::move(times));
+  }
+  impl::LogStartupTimeline(timeline, load_start_);
+  startup_report_ = impl::MakeStartupReport(timeline, load_start_, load_finish);
+
+  const auto& config = manager_.GetConfig();
+  WriteStartupFile(config.startup_report_path, "report", startup_report_);
+  if (!config.startup_trace_path.empty()) {
+    WriteStartupFile(config.startup_trace_path, "trace",
+                     impl::MakeStartupTrace(timeline, load_start_));
+  }
+}
+
 void ComponentContext::Impl::StartPrintAddingComponentsTask() {
   print_adding_components_task_ = engine::CriticalAsyncNoSpan([this]() {
     for (;;) {
@@ -3,6 +3,7 @@
 #include <userver/components/component_context.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
@@ -45,6 +46,8 @@ struct ComponentContext::Impl {
 
   bool IsAnyComponentInFatalState() const;
 
+  const std::string& GetStartupReport() const;
+
   bool Contains(std::string_view name) const noexcept;
 
   [[noreturn]] void ThrowNonRegisteredComponent(std::string_view name,
@@ -135,11 +138,14 @@ struct ComponentContext::Impl {
   static impl::ComponentNameFromInfo GetLoadingComponentName(
       const ProtectedData&);
 
+  void ReportStartupTimeline();
+
   void StartPrintAddingComponentsTask();
   void StopPrintAddingComponentsTask();
   void PrintAddingComponents() const;
 
   const Manager& manager_;
+  const std::chrono::steady_clock::time_point load_start_;
 
   ComponentMap components_;
   std::atomic_flag components_load_cancelled_ ATOMIC_FLAG_INIT;
@@ -147,6 +153,8 @@ struct ComponentContext::Impl {
   engine::ConditionVariable print_adding_components_cv_;
   concurrent::Variable<ProtectedData> shared_data_;
   engine::TaskWithResult<void> print_adding_components_task_;
+  // Written once before the components are notified of the load finish
+  std::string startup_report_;
 };
 
 }  // namespace components
@@ -0,0 +1,82 @@
+#include <components/impl/idle_sockets.hpp>
+
+#include <array>
+#include <mutex>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+#ifdef __linux__
+IdleSockets::IdleSockets() : epoll_fd_(::epoll_create1(EPOLL_CLOEXEC)) {
+  if (epoll_fd_ == -1) {
+    throw engine::io::IoSystemError(errno, "epoll_create1");
+  }
+  poller_.Reset(epoll_fd_, engine::io::FdPoller::Kind::kRead);
+}
+
+IdleSockets::~IdleSockets() {
+  poller_.Invalidate();
+  ::close(epoll_fd_);
+}
+
+void IdleSockets::Park(engine::io::Socket&& sock) {
+  const auto fd = sock.Fd();
+  {
+    std::lock_guard lock(mutex_);
+    sockets_.emplace(fd, std::move(sock));
+  }
+
+  ::epoll_event event{};
+  event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  event.data.fd = fd;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) == -1) {
+    const auto err_value = errno;
+    {
+      std::lock_guard lock(mutex_);
+      auto node = sockets_.extract(fd);
+      UASSERT(node);
+      sock = std::move(node.mapped());
+    }
+    throw engine::io::IoSystemError(err_value, "epoll_ctl");
+  }
+}
+
+std::vector<engine::io::Socket> IdleSockets::WaitReady() {
+  if (!poller_.Wait({})) return {};
+
+  std::array<::epoll_event, kMaxEventsPerWait> events{};
+  const auto events_count =
+      ::epoll_wait(epoll_fd_, events.data(), events.size(), 0);
+  if (events_count == -1) {
+    if (errno == EINTR) return {};
+    throw engine::io::IoSystemError(errno, "epoll_wait");
+  }
+
+  std::vector<engine::io::Socket> ready;
+  ready.reserve(events_count);
+  std::lock_guard lock(mutex_);
+  for (int i = 0; i < events_count; ++i) {
+    const auto fd = events[i].data.fd;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    const auto it = sockets_.find(fd);
+    if (it == sockets_.end()) continue;
+    ready.push_back(std::move(it->second));
+    sockets_.erase(it);
+  }
+  return ready;
+}
+#endif
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/io/fd_poller.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+// MAC_COMPAT: no epoll
+#ifdef __linux__
+// Parked sockets are registered in a separate epoll set, which is waited for
+// as a single readable fd by one task
+class IdleSockets final {
+ public:
+  IdleSockets();
+  ~IdleSockets();
+
+  // Throws engine::io::IoSystemError and leaves `sock` intact if the socket
+  // could not be parked
+  void Park(engine::io::Socket&& sock);
+
+  // Waits for some of the parked sockets to become readable and unparks them
+  std::vector<engine::io::Socket> WaitReady();
+
+ private:
+  static constexpr std::size_t kMaxEventsPerWait = 256;
+
+  const int epoll_fd_;
+  engine::io::FdPoller poller_;
+  engine::Mutex mutex_;
+  std::unordered_map<int, engine::io::Socket> sockets_;
+};
+#else
+class IdleSockets final {};
+#endif
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#include <components/impl/idle_sockets.hpp>
+
+#include <fcntl.h>
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+// MAC_COMPAT: no epoll
+#ifdef __linux__
+namespace {
+
+using Deadline = engine::Deadline;
+using TcpListener = internal::net::TcpListener;
+
+std::vector<engine::io::Socket> WaitForReadySockets(
+    components::impl::IdleSockets& idle_sockets) {
+  auto ready = idle_sockets.WaitReady();
+  while (ready.empty()) ready = idle_sockets.WaitReady();
+  return ready;
+}
+
+}  // namespace
+
+UTEST(IdleSockets, UnparkReadable) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  TcpListener listener;
+  auto [server, client] = listener.MakeSocketPair(deadline);
+  const auto fd = server.Fd();
+
+  components::impl::IdleSockets idle_sockets;
+  idle_sockets.Park(std::move(server));
+  EXPECT_EQ(client.SendAll("ping", 4, deadline), 4);
+
+  auto ready = WaitForReadySockets(idle_sockets);
+  ASSERT_EQ(ready.size(), 1);
+  EXPECT_EQ(ready[0].Fd(), fd);
+
+  // the unparked socket is given to ProcessSocket with the data intact
+  std::array<char, 4> buf{};
+  EXPECT_EQ(ready[0].RecvAll(buf.data(), buf.size(), deadline), 4);
+  EXPECT_EQ(std::string_view(buf.data(), buf.size()), "ping");
+}
+
+UTEST(IdleSockets, UnparkClosedByPeer) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  TcpListener listener;
+  auto [server, client] = listener.MakeSocketPair(deadline);
+
+  components::impl::IdleSockets idle_sockets;
+  idle_sockets.Park(std::move(server));
+  client.Close();
+
+  auto ready = WaitForReadySockets(idle_sockets);
+  ASSERT_EQ(ready.size(), 1);
+
+  std::array<char, 1> buf{};
+  EXPECT_EQ(ready[0].ReadSome(buf.data(), buf.size(), deadline), 0);
+}
+
+UTEST(IdleSockets, ParkFailureKeepsSocket) {
+  // epoll does not support regular files and character devices like this one
+  const auto fd = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+  ASSERT_NE(fd, -1);
+  engine::io::Socket not_a_socket{fd};
+
+  components::impl::IdleSockets idle_sockets;
+  UEXPECT_THROW(idle_sockets.Park(std::move(not_a_socket)),
+                engine::io::IoSystemError);
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  ASSERT_TRUE(not_a_socket.IsValid());
+  EXPECT_EQ(not_a_socket.Fd(), fd);
+}
+#endif
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,190 @@
+#include <components/impl/startup_timeline.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+constexpr std::size_t kSlowestComponentsToLog = 5;
+
+template <typename Duration>
+auto ToMilliseconds(Duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+      .count();
+}
+
+template <typename Duration>
+auto ToMicroseconds(Duration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+ComponentStartupTimes::Clock::duration ComponentStartupTimes::OwnDuration()
+    const {
+  const auto total = construction_finish - construction_start;
+  return std::max(total - dependencies_wait, Clock::duration::zero());
+}
+
+std::vector<std::size_t> FindStartupCriticalPath(
+    const std::vector<ComponentStartupTimes>& components) {
+  if (components.empty()) return {};
+
+  std::unordered_map<std::string_view, std::size_t> indexes;
+  indexes.reserve(components.size());
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    indexes.emplace(components[i].name, i);
+  }
+
+  const auto finished_before = [&components](std::size_t lhs, std::size_t rhs) {
+    return components[lhs].construction_finish <
+           components[rhs].construction_finish;
+  };
+
+  std::vector<std::size_t> path;
+  std::vector<std::size_t> all(components.size());
+  std::iota(all.begin(), all.end(), 0);
+  auto current = *std::max_element(all.begin(), all.end(), finished_before);
+  for (;;) {
+    path.push_back(current);
+    const auto& current_times = components[current];
+
+    std::optional<std::size_t> next;
+    for (const auto& dependency : current_times.dependencies) {
+      const auto it = indexes.find(dependency);
+      if (it == indexes.end()) continue;
+      // the dependency did not delay the component if it was ready before
+      if (components[it->second].construction_finish <=
+          current_times.construction_start) {
+        continue;
+      }
+      if (!next || finished_before(*next, it->second)) next = it->second;
+    }
+
+    // dependency cycles are rejected on load, the path is finite
+    if (!next) break;
+    current = *next;
+  }
+  return path;
+}
+
+void LogStartupTimeline(const std::vector<ComponentStartupTimes>& components,
+                        ComponentStartupTimes::Clock::time_point load_start) {
+  if (components.empty()) return;
+
+  const auto path = FindStartupCriticalPath(components);
+  std::string path_description;
+  for (const auto index : path) {
+    const auto& times = components[index];
+    if (!path_description.empty()) path_description += " <- ";
+    path_description += fmt::format(
+        "{} (own {}ms, finished at {}ms)", times.name,
+        ToMilliseconds(times.OwnDuration()),
+        ToMilliseconds(times.construction_finish - load_start));
+  }
+  LOG_INFO() << "Components construction critical path: " << path_description;
+
+  std::vector<std::size_t> slowest(components.size());
+  std::iota(slowest.begin(), slowest.end(), 0);
+  const auto slowest_count = std::min(kSlowestComponentsToLog, slowest.size());
+  std::partial_sort(slowest.begin(), slowest.begin() + slowest_count,
+                    slowest.end(),
+                    [&components](std::size_t lhs, std::size_t rhs) {
+                      return components[lhs].OwnDuration() >
+                             components[rhs].OwnDuration();
+                    });
+  std::string slowest_description;
+  for (std::size_t i = 0; i < slowest_count; ++i) {
+    const auto& times = components[slowest[i]];
+    if (!slowest_description.empty()) slowest_description += ", ";
+    slowest_description += fmt::format("{} ({}ms)", times.name,
+                                       ToMilliseconds(times.OwnDuration()));
+  }
+  LOG_INFO() << "Slowest components to construct: " << slowest_description;
+}
+
+std::string MakeStartupReport(
+    const std::vector<ComponentStartupTimes>& components,
+    ComponentStartupTimes::Clock::time_point load_start,
+    ComponentStartupTimes::Clock::time_point load_finish) {
+  formats::json::ValueBuilder report;
+  report["total_ms"] = ToMilliseconds(load_finish - load_start);
+
+  formats::json::ValueBuilder critical_path{formats::common::Type::kArray};
+  for (const auto index : FindStartupCriticalPath(components)) {
+    critical_path.PushBack(components[index].name);
+  }
+  report["critical_path"] = std::move(critical_path);
+
+  formats::json::ValueBuilder components_json{formats::common::Type::kObject};
+  for (const auto& times : components) {
+    formats::json::ValueBuilder component;
+    component["start_ms"] =
+        ToMilliseconds(times.construction_start - load_start);
+    component["finish_ms"] =
+        ToMilliseconds(times.construction_finish - load_start);
+    component["constructor_ms"] = ToMilliseconds(times.OwnDuration());
+    component["dependencies_wait_ms"] = ToMilliseconds(times.dependencies_wait);
+    component["dependencies"] = times.dependencies;
+    if (times.cache_first_update) {
+      const auto& stages = *times.cache_first_update;
+      auto first_update = component["cache_first_update"];
+      first_update["fetch_ms"] = stages.fetch.count();
+      first_update["parse_ms"] = stages.parse.count();
+      first_update["publish_ms"] = stages.publish.count();
+      first_update["total_ms"] = stages.total.count();
+    }
+    components_json[times.name] = std::move(component);
+  }
+  report["components"] = std::move(components_json);
+
+  return formats::json::ToString(report.ExtractValue());
+}
+
+std::string MakeStartupTrace(
+    const std::vector<ComponentStartupTimes>& components,
+    ComponentStartupTimes::Clock::time_point load_start) {
+  formats::json::ValueBuilder events{formats::common::Type::kArray};
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    const auto& times = components[i];
+
+    formats::json::ValueBuilder event;
+    event["name"] = times.name;
+    event["cat"] = "component";
+    event["ph"] = "X";
+    event["pid"] = 0;
+    // a line per component, as the constructors run concurrently
+    event["tid"] = i;
+    event["ts"] = ToMicroseconds(times.construction_start - load_start);
+    event["dur"] = ToMicroseconds(times.construction_finish -
+                                  times.construction_start);
+    event["args"]["dependencies_wait_ms"] =
+        ToMilliseconds(times.dependencies_wait);
+    event["args"]["dependencies"] = times.dependencies;
+    events.PushBack(std::move(event));
+  }
+
+  formats::json::ValueBuilder trace;
+  trace["traceEvents"] = std::move(events);
+  trace["displayTimeUnit"] = "ms";
+  return formats::json::ToString(trace.ExtractValue());
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
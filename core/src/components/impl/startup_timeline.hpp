@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/cache/cache_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+/// Timings of a component construction
+struct ComponentStartupTimes final {
+  using Clock = std::chrono::steady_clock;
+
+  std::string name;
+  Clock::time_point construction_start{};
+  Clock::time_point construction_finish{};
+  /// Time spent in FindComponent() waiting for the dependencies to construct
+  Clock::duration dependencies_wait{};
+  std::vector<std::string> dependencies;
+  /// Stages of the first update, for caches only
+  std::optional<cache::impl::UpdateStagesDurations> cache_first_update;
+
+  /// Construction time not counting the waits for the dependencies
+  Clock::duration OwnDuration() const;
+};
+
+/// @brief Returns the indexes of the components that delayed the startup
+/// the most, starting from the component that finished construction last.
+///
+/// Each next component in the path is the dependency of the previous one that
+/// finished construction last, while the previous one was already waiting.
+std::vector<std::size_t> FindStartupCriticalPath(
+    const std::vector<ComponentStartupTimes>& components);
+
+/// Logs the startup critical path and the slowest components
+void LogStartupTimeline(const std::vector<ComponentStartupTimes>& components,
+                        ComponentStartupTimes::Clock::time_point load_start);
+
+/// @brief Formats the machine readable startup report as JSON: the total
+/// load time, the critical path and the timings of each component.
+std::string MakeStartupReport(
+    const std::vector<ComponentStartupTimes>& components,
+    ComponentStartupTimes::Clock::time_point load_start,
+    ComponentStartupTimes::Clock::time_point load_finish);
+
+/// @brief Formats the construction timeline in Chrome Trace Event Format,
+/// viewable in chrome://tracing or Perfetto UI.
+std::string MakeStartupTrace(
+    const std::vector<ComponentStartupTimes>& components,
+    ComponentStartupTimes::Clock::time_point load_start);
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
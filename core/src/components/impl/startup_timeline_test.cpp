@@ -0,0 +1,95 @@
+#include <components/impl/startup_timeline.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using components::impl::ComponentStartupTimes;
+
+const auto kLoadStart = ComponentStartupTimes::Clock::time_point{};
+
+ComponentStartupTimes MakeTimes(std::string name, int start_ms, int finish_ms,
+                                std::vector<std::string> dependencies = {}) {
+  ComponentStartupTimes times;
+  times.name = std::move(name);
+  times.construction_start = kLoadStart + std::chrono::milliseconds{start_ms};
+  times.construction_finish = kLoadStart + std::chrono::milliseconds{finish_ms};
+  times.dependencies = std::move(dependencies);
+  return times;
+}
+
+}  // namespace
+
+TEST(StartupTimeline, CriticalPath) {
+  const std::vector<ComponentStartupTimes> components{
+      MakeTimes("logging", 0, 10),
+      MakeTimes("postgres", 15, 300, {"logging"}),
+      MakeTimes("cache", 5, 200, {"logging"}),
+      MakeTimes("handler", 5, 350, {"postgres", "cache", "logging"}),
+      MakeTimes("dns", 0, 20),
+  };
+
+  // logging was ready before postgres started constructing
+  EXPECT_EQ(components::impl::FindStartupCriticalPath(components),
+            (std::vector<std::size_t>{3, 1}));
+}
+
+TEST(StartupTimeline, OwnDuration) {
+  auto times = MakeTimes("handler", 0, 100);
+  times.dependencies_wait = std::chrono::milliseconds{60};
+  EXPECT_EQ(times.OwnDuration(), std::chrono::milliseconds{40});
+}
+
+TEST(StartupTimeline, Trace) {
+  const std::vector<ComponentStartupTimes> components{
+      MakeTimes("logging", 1, 10),
+      MakeTimes("handler", 2, 30, {"logging"}),
+  };
+
+  const auto trace = formats::json::FromString(
+      components::impl::MakeStartupTrace(components, kLoadStart));
+  const auto events = trace["traceEvents"];
+  ASSERT_EQ(events.GetSize(), 2);
+  EXPECT_EQ(events[1]["name"].As<std::string>(), "handler");
+  EXPECT_EQ(events[1]["ph"].As<std::string>(), "X");
+  EXPECT_EQ(events[1]["ts"].As<int>(), 2000);
+  EXPECT_EQ(events[1]["dur"].As<int>(), 28000);
+  EXPECT_EQ(events[1]["args"]["dependencies"][0].As<std::string>(),
+            "logging");
+}
+
+TEST(StartupTimeline, Report) {
+  std::vector<ComponentStartupTimes> components{
+      MakeTimes("postgres", 0, 20),
+      MakeTimes("cache", 0, 120, {"postgres"}),
+  };
+  components[1].dependencies_wait = std::chrono::milliseconds{20};
+  components[1].cache_first_update.emplace();
+  components[1].cache_first_update->fetch = std::chrono::milliseconds{70};
+  components[1].cache_first_update->parse = std::chrono::milliseconds{25};
+  components[1].cache_first_update->publish = std::chrono::milliseconds{5};
+  components[1].cache_first_update->total = std::chrono::milliseconds{100};
+
+  const auto report = formats::json::FromString(
+      components::impl::MakeStartupReport(
+          components, kLoadStart, kLoadStart + std::chrono::milliseconds{150}));
+  EXPECT_EQ(report["total_ms"].As<int>(), 150);
+  EXPECT_EQ(report["critical_path"].As<std::vector<std::string>>(),
+            (std::vector<std::string>{"cache", "postgres"}));
+
+  const auto cache = report["components"]["cache"];
+  EXPECT_EQ(cache["constructor_ms"].As<int>(), 100);
+  EXPECT_EQ(cache["dependencies_wait_ms"].As<int>(), 20);
+  EXPECT_EQ(cache["cache_first_update"]["fetch_ms"].As<int>(), 70);
+  EXPECT_EQ(cache["cache_first_update"]["publish_ms"].As<int>(), 5);
+  EXPECT_FALSE(report["components"]["postgres"].HasMember(
+      "cache_first_update"));
+}
+
+USERVER_NAMESPACE_END
@@ -4,9 +4,11 @@
 #include <logging/dynamic_debug_config.hpp>
 #include <tracing/no_log_spans.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/tracing/tracer.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <logging/rate_limit.hpp>
@@ -34,6 +36,18 @@ logging::DynamicDebugConfig ParseDynamicDebug(
 
 constexpr dynamic_config::Key<ParseDynamicDebug> kDynamicDebugConfig{};
 
+void WriteSamplingStatistics(utils::statistics::Writer& writer) {
+  auto suppressed_writer = writer["suppressed"];
+  for (const auto& location : logging::GetDynamicDebugLocations()) {
+    const auto suppressed = location.suppressed.load(std::memory_order_relaxed);
+    if (suppressed == 0) continue;
+
+    suppressed_writer.ValueWithLabels(
+        utils::statistics::Rate{suppressed},
+        {"location", fmt::format("{}:{}", location.path, location.line)});
+  }
+}
+
 }  // namespace
 
 LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
@@ -47,9 +61,15 @@ LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
       context.FindComponent<components::DynamicConfig>()
           .GetSource()
           .UpdateAndListen(this, kName, &LoggingConfigurator::OnConfigUpdate);
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("logger.sampling", &WriteSamplingStatistics);
 }
 
 LoggingConfigurator::~LoggingConfigurator() {
+  statistics_holder_.Unregister();
   config_subscription_.Unsubscribe();
 }
 
@@ -72,6 +92,7 @@ void LoggingConfigurator::OnConfigUpdate(
 
       // Flush
       AddDynamicDebugLog("", logging::kAnyLine, logging::EntryState::kDefault);
+      logging::SetDynamicDebugSampling("", logging::kAnyLine, 1.0);
 
       for (const auto& location : dd.force_disabled) {
         const auto [path, line] = logging::SplitLocation(location);
@@ -81,6 +102,12 @@ void LoggingConfigurator::OnConfigUpdate(
         const auto [path, line] = logging::SplitLocation(location);
         AddDynamicDebugLog(path, line, logging::EntryState::kForceEnabled);
       }
+      // std::map puts the files before their lines, so the rates of the lines
+      // take precedence
+      for (const auto& [location, rate] : dd.sampling) {
+        const auto [path, line] = logging::SplitLocation(location);
+        logging::SetDynamicDebugSampling(path, line, rate);
+      }
 
       lock.Commit();
     }
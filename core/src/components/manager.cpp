@@ -115,7 +115,7 @@ void Manager::TaskProcessorsStorage::Reset() noexcept {
     task_processor->InitiateShutdown();
   }
   LOG_TRACE() << "Waiting for all coroutines to become idle";
-  while (task_processor_pools_->GetCoroPool().GetStats().active_coroutines) {
+  while (task_processor_pools_->GetCoroPoolsStats().active_coroutines) {
     std::this_thread::sleep_for(std::chrono::milliseconds{10});
   }
   LOG_TRACE() << "Stopping task processors";
@@ -202,6 +202,10 @@ Manager::~Manager() {
 
 const ManagerConfig& Manager::GetConfig() const { return *config_; }
 
+const std::string& Manager::GetStartupReport() const {
+  return component_context_.GetStartupReport();
+}
+
 const std::shared_ptr<engine::impl::TaskProcessorPools>&
 Manager::GetTaskProcessorPools() const {
   return task_processors_storage_.GetTaskProcessorPools();
@@ -42,6 +42,11 @@ class Manager final {
   ~Manager();
 
   const ManagerConfig& GetConfig() const;
+
+  /// JSON with the components construction timings, empty until all the
+  /// components are constructed
+  const std::string& GetStartupReport() const;
+
   const std::shared_ptr<engine::impl::TaskProcessorPools>&
   GetTaskProcessorPools() const;
   const TaskProcessorsMap& GetTaskProcessorsMap() const;
@@ -100,6 +100,86 @@ properties:
                 type: integer
                 description: size of a single coroutine, bytes
                 defaultDescription: 256 * 1024
+            stack_usage_sample_every:
+                type: integer
+                description: |
+                    if not 0, coroutine stacks are painted with a canary
+                    pattern and the stack high-water mark is sampled on
+                    every Nth return of a coroutine to the pool. Painting
+                    makes the whole stacks resident in memory.
+                defaultDescription: 0
+            huge_pages:
+                type: boolean
+                description: |
+                    advise the kernel to back the coroutine stacks with
+                    transparent huge pages, only the stacks that span whole
+                    huge pages may get them
+                defaultDescription: false
+            stack_release_idle_watermark:
+                type: integer
+                description: |
+                    if not 0, the stacks of the coroutines returned to the
+                    pool that already has at least this many idle coroutines
+                    are released to the OS except for the top
+                    stack_release_keep_size bytes, so the peak memory usage
+                    goes away after the load drops. Is ignored if the stack
+                    usage sampling is enabled.
+                defaultDescription: 0
+            stack_release_keep_size:
+                type: integer
+                description: |
+                    size of the top part of a returned coroutine stack that
+                    is never released, bytes. It holds the frames of the idle
+                    coroutine suspended in the pool, so it may not be less
+                    than 8 * 1024
+                defaultDescription: 16 * 1024
+                minimum: 8192
+            stack_release_advice:
+                type: string
+                description: |
+                    `free` (MADV_FREE) lets the kernel free the released
+                    stacks under memory pressure only, `dontneed`
+                    (MADV_DONTNEED) frees them at once
+                defaultDescription: free
+                enum:
+                  - free
+                  - dontneed
+            small_stacks:
+                type: object
+                description: |
+                    coroutines pool for the task processors with
+                    `stack-size-class: small`
+                additionalProperties: false
+                properties:
+                    initial_size:
+                        type: integer
+                        description: amount of coroutines to preallocate
+                        defaultDescription: 0
+                    max_size:
+                        type: integer
+                        description: max amount of preallocated coroutines
+                        defaultDescription: 1000
+                    stack_size:
+                        type: integer
+                        description: size of a single coroutine, bytes
+            large_stacks:
+                type: object
+                description: |
+                    coroutines pool for the task processors with
+                    `stack-size-class: large`
+                additionalProperties: false
+                properties:
+                    initial_size:
+                        type: integer
+                        description: amount of coroutines to preallocate
+                        defaultDescription: 0
+                    max_size:
+                        type: integer
+                        description: max amount of preallocated coroutines
+                        defaultDescription: 1000
+                    stack_size:
+                        type: integer
+                        description: size of a single coroutine, bytes
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -115,6 +195,36 @@ properties:
                 description: >
                     Whether to defer timer events to a per-thread periodic timer
                     or notify ev-loop right away
+            backend:
+                type: string
+                description: |
+                    kernel interface used by the ev-loops to wait for I/O
+                    readiness. `io_uring` submits the poll requests in
+                    batches and avoids a syscall per watcher change, it
+                    requires libev 4.31+ and Linux 5.4+. Falls back to
+                    `auto` if the backend is not available.
+                defaultDescription: auto
+                enum:
+                  - auto
+                  - epoll
+                  - io_uring
+                  - linux-aio
+            timer_wheel:
+                type: boolean
+                description: |
+                    keep the long task timers (sleeps, deadlines) in a
+                    per-thread hierarchical timer wheel with 1ms ticks
+                    instead of the libev timers heap. Rearming is O(1),
+                    timers fire up to 1ms late.
+                defaultDescription: false
+            load_balancing:
+                type: boolean
+                description: |
+                    assign the new sockets and timers to the less loaded of
+                    the next ev-thread in the round-robin order and a random
+                    one, by their `ev-threads.cpu-load-percent`. Otherwise
+                    the ev-threads are assigned round-robin.
+                defaultDescription: false
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -156,6 +266,57 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                adaptive-spinning:
+                    type: boolean
+                    description: |
+                        whether to adapt the number of spin-wait iterations
+                        (up to `spinning-iterations`) to the recent spin hit
+                        rate: it grows while spinning finds new tasks and
+                        shrinks while the threads end up sleeping anyway
+                    defaultDescription: false
+                task-queue:
+                    type: string
+                    description: |
+                        task queue implementation. `global` uses a single
+                        queue shared by all the worker threads.
+                        `work-stealing` gives each worker thread its own
+                        queue and lets idle workers steal from the others,
+                        it does not honor the task priorities.
+                    defaultDescription: global
+                    enum:
+                      - global
+                      - work-stealing
+                stack-size-class:
+                    type: string
+                    description: |
+                        stack size class of the task processor coroutines.
+                        `small` and `large` use the coroutines from
+                        `coro_pool.small_stacks` and `coro_pool.large_stacks`
+                        respectively, falling back to the default pool if
+                        the class pool is not configured.
+                    defaultDescription: default
+                    enum:
+                      - small
+                      - default
+                      - large
+                numa-nodes:
+                    type: array
+                    description: |
+                        NUMA nodes to distribute the worker threads among.
+                        Each worker thread is pinned to the CPUs of its node.
+                        With `task-queue: work-stealing` idle workers steal
+                        tasks from the workers of the same node first.
+                    defaultDescription: '[] (no pinning)'
+                    items:
+                        type: integer
+                        description: NUMA node number
+                blocking-watchdog-threshold:
+                    type: string
+                    description: |
+                        if not 0, a watchdog thread logs the stacktrace of
+                        the worker threads, that run a task for longer than
+                        this duration without a context switch
+                    defaultDescription: 0 (disabled)
                 task-trace:
                     type: object
                     description: .
@@ -180,6 +341,18 @@ properties:
         type: boolean
         description: whether to mlock(2) process debug info
         defaultDescription: true
+    startup_report_path:
+        type: string
+        description: |
+            if not empty, the JSON report with the components construction
+            and cache first update timings is written to this file on startup
+        defaultDescription: ''
+    startup_trace_path:
+        type: string
+        description: |
+            if not empty, the components construction timeline is written
+            to this file in Chrome Trace Event Format on startup
+        defaultDescription: ''
     static_config_validation:
         type: object
         description: settings for basic syntax validation in config.yaml
@@ -220,6 +393,10 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value,
           ValidationMode::kAll);
   config.mlock_debug_info =
       value["mlock_debug_info"].As<bool>(config.mlock_debug_info);
+  config.startup_report_path =
+      value["startup_report_path"].As<std::string>(config.startup_report_path);
+  config.startup_trace_path =
+      value["startup_trace_path"].As<std::string>(config.startup_trace_path);
   return config;
 }
 
@@ -27,6 +27,8 @@ struct ManagerConfig {
   utils::impl::UserverExperimentSet enabled_experiments;
   bool experiments_force_enabled{false};
   bool mlock_debug_info{true};
+  std::string startup_report_path;
+  std::string startup_trace_path;
 
   static ManagerConfig FromString(
       const std::string&, const std::optional<std::string>& config_vars_path,
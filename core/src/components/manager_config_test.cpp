@@ -20,6 +20,8 @@ components_manager:
     max_size: $coro_pool_max_size
     max_size#fallback: 50000
     stack_size#env: USERVER_STACK_SIZE
+    small_stacks:
+      stack_size: 65536
   default_task_processor: main-task-processor
   mlock_debug_info: $variable_does_not_exist
   mlock_debug_info#env: MLOCK_DEBUG_INFO
@@ -27,6 +29,7 @@ components_manager:
     threads: $event_threads
     threads#fallback: 2
     defer_events: false
+    backend: epoll
   task_processors:
     bg-task-processor:
       thread_name: bg-worker
@@ -215,6 +218,10 @@ TEST(ManagerConfig, Basic) {
   EXPECT_FALSE(mc.mlock_debug_info)
       << "#env does not work with missing substitution vars";
   EXPECT_EQ(mc.coro_pool.stack_size, 1024) << "#env does not work";
+  ASSERT_TRUE(mc.coro_pool.small_stacks);
+  EXPECT_EQ(mc.coro_pool.small_stacks->stack_size, 65536);
+  EXPECT_FALSE(mc.coro_pool.large_stacks);
+  EXPECT_EQ(mc.event_thread_pool.backend, engine::ev::LoopBackend::kEpoll);
 
   EXPECT_EQ(mc.task_processors.size(), 5);
 
@@ -48,7 +48,44 @@ void DumpMetric(utils::statistics::Writer& writer,
     context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
   }
 
+  if (auto spinning = writer["spinning"]) {
+    spinning["hits"] = counter.GetSpinHits().value;
+    spinning["misses"] = counter.GetSpinMisses().value;
+  }
+
+  if (auto arena = writer["task-local-arena"]) {
+    arena["used-bytes"] = counter.GetTaskLocalArenaUsedBytes();
+    arena["reserved-bytes"] = counter.GetTaskLocalArenaReservedBytes();
+  }
+
+  const auto& stack_usage = counter.GetStackUsage();
+  if (stack_usage.Count() != 0) {
+    writer["coro-stack-usage-kb"] = stack_usage;
+  }
+
+  if (auto queue_wait = writer["queue-wait-time-us"]) {
+    constexpr std::pair<Task::Priority, std::string_view> kPriorities[]{
+        {Task::Priority::kHigh, "high"},
+        {Task::Priority::kNormal, "normal"},
+        {Task::Priority::kBackground, "background"},
+    };
+    for (const auto& [priority, name] : kPriorities) {
+      const auto& wait_time = counter.GetQueueWait(priority);
+      // Only report the priorities that are actually used
+      if (priority != Task::Priority::kNormal && wait_time.Count() == 0) {
+        continue;
+      }
+      queue_wait.ValueWithLabels(wait_time, {"task_priority", name});
+    }
+  }
+
+  writer["queue-wait-histogram-us"] = counter.GetQueueWaitHistogram();
+
   writer["worker-threads"] = task_processor.GetWorkerCount();
+  writer["cpu-time-us"] = utils::statistics::Rate{static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          task_processor.GetCpuTime())
+          .count())};
 }
 
 }  // namespace engine
@@ -100,19 +137,55 @@ void ManagerControllerComponent::WriteStatistics(
   const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
   auto& ev_thread_pool = pools_ptr->EventThreadPool();
   for (auto* thread : ev_thread_pool.NextThreads(ev_thread_pool.GetSize())) {
-    writer["ev-threads"]["cpu-load-percent"].ValueWithLabels(
-        thread->GetCurrentLoadPercent(),
-        {{"ev_thread_name", thread->GetName()}});
+    const utils::statistics::LabelView label{"ev_thread_name",
+                                             thread->GetName()};
+    auto ev_threads = writer["ev-threads"];
+    ev_threads["cpu-load-percent"].ValueWithLabels(
+        thread->GetCurrentLoadPercent(), label);
+
+    const auto cpu_stats = thread->GetCpuStats();
+    ev_threads["context-switches"]["voluntary"].ValueWithLabels(
+        utils::statistics::Rate{cpu_stats.voluntary_context_switches}, label);
+    ev_threads["context-switches"]["involuntary"].ValueWithLabels(
+        utils::statistics::Rate{cpu_stats.involuntary_context_switches},
+        label);
+    ev_threads["run-delay-us"].ValueWithLabels(
+        utils::statistics::Rate{
+            static_cast<std::uint64_t>(cpu_stats.run_delay.count())},
+        label);
   }
 
   // coroutines
   if (auto coro_pool = writer["coro-pool"]) {
     if (auto coro_stats = coro_pool["coroutines"]) {
-      auto stats =
-          components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
+      auto stats = pools_ptr->GetCoroPoolsStats();
       coro_stats["active"] = stats.active_coroutines;
       coro_stats["total"] = stats.total_coroutines;
     }
+    if (auto stack_stats = coro_pool["released-stacks"]) {
+      auto stats = pools_ptr->GetCoroPoolsStats();
+      stack_stats["count"] = utils::statistics::Rate{stats.released_stacks};
+      stack_stats["bytes"] =
+          utils::statistics::Rate{stats.released_stack_bytes};
+    }
+
+    for (const auto stack_size_class :
+         {engine::coro::StackSizeClass::kSmall,
+          engine::coro::StackSizeClass::kDefault,
+          engine::coro::StackSizeClass::kLarge}) {
+      const auto* pool = pools_ptr->FindCoroPool(stack_size_class);
+      if (!pool) continue;
+
+      const auto stats = pool->GetStats();
+      const utils::statistics::LabelView label{
+          "stack_size_class", engine::coro::ToString(stack_size_class)};
+      auto class_stats = coro_pool["by-stack-size-class"];
+      class_stats["coroutines"]["active"].ValueWithLabels(
+          stats.active_coroutines, label);
+      class_stats["coroutines"]["total"].ValueWithLabels(
+          stats.total_coroutines, label);
+      class_stats["stack-size"].ValueWithLabels(pool->GetStackSize(), label);
+    }
   }
 
   // misc
@@ -1,9 +1,11 @@
 #include <userver/components/tcp_acceptor_base.hpp>
 
 #include <userver/components/component.hpp>
+#include <userver/engine/io/exception.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <components/impl/idle_sockets.hpp>
 #include <server/net/create_socket.hpp>
 #include <server/net/listener_config.hpp>
 
@@ -62,6 +64,12 @@ properties:
       type: string
       description: task processor to process accepted sockets
       defaultDescription: value of `task_processor`
+  park_idle_sockets:
+      type: boolean
+      description: |
+          whether to wait for the accepted and parked sockets to become
+          readable without a coroutine (Linux only)
+      defaultDescription: false
 )");
 }
 
@@ -74,22 +82,80 @@ TcpAcceptorBase::TcpAcceptorBase(const ComponentConfig& config,
           context.GetTaskProcessor(acceptor_config.task_processor)),
       sockets_task_processor_(context.GetTaskProcessor(
           SocketsTaskProcessorName(config, acceptor_config))),
-      listen_sock_(server::net::CreateSocket(acceptor_config)) {}
+      listen_sock_(server::net::CreateSocket(acceptor_config)) {
+  if (config["park_idle_sockets"].As<bool>(false)) {
+#ifdef __linux__
+    idle_sockets_ = std::make_unique<impl::IdleSockets>();
+#else
+    LOG_WARNING() << "park_idle_sockets is not supported on this platform, "
+                     "a coroutine is used for each socket";
+#endif
+  }
+}
+
+void TcpAcceptorBase::ParkSocket(engine::io::Socket&& sock) {
+#ifdef __linux__
+  if (idle_sockets_) {
+    try {
+      idle_sockets_->Park(std::move(sock));
+      return;
+    } catch (const engine::io::IoSystemError& ex) {
+      LOG_WARNING() << "Failed to park an idle socket, waiting for it in a "
+                       "coroutine: "
+                    << ex;
+    }
+  }
+#endif
+
+  tasks_.Detach(engine::AsyncNoSpan(
+      sockets_task_processor_,
+      [this](engine::io::Socket&& sock) {
+        if (!sock.WaitReadable({})) return;
+        ProcessSocket(std::move(sock));
+      },
+      std::move(sock)));
+}
 
 void TcpAcceptorBase::KeepAccepting() {
   while (!engine::current_task::ShouldCancel()) {
     engine::io::Socket sock = listen_sock_.Accept({});
+    if (no_delay_) {
+      sock.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+    }
+
+#ifdef __linux__
+    if (idle_sockets_) {
+      try {
+        // Accepted sockets are usually idle until the client sends something
+        idle_sockets_->Park(std::move(sock));
+        continue;
+      } catch (const engine::io::IoSystemError& ex) {
+        LOG_WARNING() << "Failed to park an accepted socket, processing it "
+                         "right away: "
+                      << ex;
+      }
+    }
+#endif
+    StartProcessing(std::move(sock));
+  }
+}
 
-    tasks_.Detach(engine::AsyncNoSpan(
-        sockets_task_processor_,
-        [this](engine::io::Socket&& sock) {
-          if (no_delay_) {
-            sock.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
-          }
-          ProcessSocket(std::move(sock));
-        },
-        std::move(sock)));
+void TcpAcceptorBase::KeepWaitingForParkedSockets() {
+#ifdef __linux__
+  UASSERT(idle_sockets_);
+  while (!engine::current_task::ShouldCancel()) {
+    for (auto& sock : idle_sockets_->WaitReady()) {
+      StartProcessing(std::move(sock));
+    }
   }
+#endif
+}
+
+void TcpAcceptorBase::StartProcessing(engine::io::Socket&& sock) {
+  tasks_.Detach(engine::AsyncNoSpan(
+      sockets_task_processor_,
+      [this](engine::io::Socket&& sock) { ProcessSocket(std::move(sock)); },
+      std::move(sock)));
 }
 
 void TcpAcceptorBase::OnAllComponentsLoaded() {
@@ -98,10 +164,16 @@ void TcpAcceptorBase::OnAllComponentsLoaded() {
   // NOLINTNEXTLINE(cppcoreguidelines-slicing)
   acceptor_ = engine::AsyncNoSpan(acceptor_task_processor_,
                                   &TcpAcceptorBase::KeepAccepting, this);
+  if (idle_sockets_) {
+    parked_sockets_waiter_ = engine::AsyncNoSpan(
+        acceptor_task_processor_,
+        &TcpAcceptorBase::KeepWaitingForParkedSockets, this);
+  }
 }
 
 void TcpAcceptorBase::OnAllComponentsAreStopping() {
   acceptor_ = {};  // Cancel and wait for finish
+  parked_sockets_waiter_ = {};
   listen_sock_.Close();
   tasks_.CancelAndWait();
 }
@@ -1,5 +1,6 @@
 #include <userver/components/tracer.hpp>
 
+#include <tracing/sampling.hpp>
 #include <userver/components/component.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/tracing/noop.hpp>
@@ -36,6 +37,15 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
     throw std::runtime_error("Tracer type is not supported: " + tracer_type);
   }
 
+  tracing::SamplingConfig sampling;
+  sampling.rate = config["sampling-rate"].As<double>(sampling.rate);
+  sampling.slow_threshold =
+      config["tail-sampling-slow-threshold"].As<std::chrono::milliseconds>(
+          sampling.slow_threshold);
+  sampling.keep_errors =
+      config["tail-sampling-keep-errors"].As<bool>(sampling.keep_errors);
+  tracing::Tracer::SetSamplingConfig(sampling);
+
   tracing::Tracer::SetTracer(std::move(tracer));
 }
 
@@ -52,6 +62,20 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    sampling-rate:
+        type: number
+        description: probability for a new trace to be sampled
+        defaultDescription: 1.0
+        minimum: 0
+        maximum: 1
+    tail-sampling-slow-threshold:
+        type: string
+        description: not sampled traces whose local root span lasts longer are still logged
+        defaultDescription: 0 (disabled)
+    tail-sampling-keep-errors:
+        type: boolean
+        description: not sampled traces with the 'error' tag are still logged
+        defaultDescription: false
 )");
 }
 
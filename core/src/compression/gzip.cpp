@@ -1,15 +1,25 @@
 #include <compression/gzip.hpp>
 
+#include <stdexcept>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
-}
+
+// 15 is the default window size, +16 makes zlib write the gzip wrapper
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+}  // namespace
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
   std::string decompressed;
@@ -38,6 +48,71 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+  StreamCompressor compressor{level};
+  auto result = compressor.Compress(data);
+  result += compressor.Finish();
+  return result;
+}
+
+struct StreamCompressor::Impl {
+  explicit Impl(int level) {
+    const auto ret = deflateInit2(&stream, level, Z_DEFLATED, kGzipWindowBits,
+                                  kMemLevel, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+      throw std::runtime_error("failed to initialize gzip compressor");
+    }
+  }
+
+  ~Impl() { deflateEnd(&stream); }
+
+  std::string Deflate(std::string_view data, int flush) {
+    std::string result;
+    // deflateBound() does not account for the flush markers
+    result.resize(deflateBound(&stream, data.size()) + 16);
+    std::size_t produced = 0;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = data.size();
+    while (true) {
+      if (produced == result.size()) result.resize(result.size() * 2);
+      stream.next_out = reinterpret_cast<Bytef*>(result.data() + produced);
+      stream.avail_out = result.size() - produced;
+
+      const auto ret = deflate(&stream, flush);
+      produced = result.size() - stream.avail_out;
+      UINVARIANT(ret != Z_STREAM_ERROR, "gzip compressor state is broken");
+      if (flush == Z_FINISH ? ret == Z_STREAM_END
+                            : stream.avail_in == 0 && stream.avail_out != 0) {
+        break;
+      }
+    }
+    result.resize(produced);
+    return result;
+  }
+
+  z_stream stream{};
+  bool finished{false};
+};
+
+StreamCompressor::StreamCompressor(int level)
+    : impl_(std::make_unique<Impl>(level)) {}
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::Compress(std::string_view data) {
+  UASSERT_MSG(!impl_->finished, "Compress() after Finish()");
+  if (data.empty()) return {};
+  return impl_->Deflate(data, Z_SYNC_FLUSH);
+}
+
+std::string StreamCompressor::Finish() {
+  UASSERT_MSG(!impl_->finished, "Finish() is called twice");
+  impl_->finished = true;
+  return impl_->Deflate({}, Z_FINISH);
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <compression/error.hpp>
@@ -8,10 +10,41 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
+/// Default compression level, a good balance of speed and ratio
+inline constexpr int kDefaultLevel = 6;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a complete gzip member.
+/// @param level zlib compression level from 1 (fastest) to 9 (best).
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// @brief Produces a single gzip member from the data passed in parts.
+///
+/// Every Compress() call flushes the compressor, so the peer can decompress
+/// each part as soon as it arrives, e.g. for streamed HTTP responses.
+class StreamCompressor final {
+ public:
+  explicit StreamCompressor(int level = kDefaultLevel);
+  ~StreamCompressor();
+
+  StreamCompressor(StreamCompressor&&) = delete;
+  StreamCompressor& operator=(StreamCompressor&&) = delete;
+
+  /// Returns the compressed representation of the next part of the data
+  std::string Compress(std::string_view data);
+
+  /// Returns the tail of the gzip member, must be called exactly once after
+  /// all the data was passed to Compress()
+  std::string Finish();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
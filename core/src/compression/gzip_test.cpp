@@ -0,0 +1,56 @@
+#include <compression/gzip.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeData() {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) data += "userver gzip " + std::to_string(i);
+  return data;
+}
+
+}  // namespace
+
+TEST(Gzip, CompressRoundTrip) {
+  const auto data = MakeData();
+  const auto compressed = compression::gzip::Compress(data);
+  EXPECT_LT(compressed.size(), data.size());
+  EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+}
+
+TEST(Gzip, CompressEmpty) {
+  const auto compressed = compression::gzip::Compress({});
+  EXPECT_FALSE(compressed.empty());
+  EXPECT_EQ(compression::gzip::Decompress(compressed, 1), "");
+}
+
+TEST(Gzip, StreamCompressor) {
+  const auto data = MakeData();
+
+  compression::gzip::StreamCompressor compressor{1};
+  std::string compressed;
+  for (std::size_t pos = 0; pos < data.size(); pos += 777) {
+    const auto part =
+        compressor.Compress(std::string_view{data}.substr(pos, 777));
+    // Every part is flushed
+    EXPECT_FALSE(part.empty());
+    compressed += part;
+  }
+  EXPECT_TRUE(compressor.Compress({}).empty());
+  compressed += compressor.Finish();
+
+  EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+}
+
+TEST(Gzip, DecompressTooBig) {
+  const auto compressed = compression::gzip::Compress(MakeData());
+  EXPECT_THROW(compression::gzip::Decompress(compressed, 100),
+               compression::TooBigError);
+}
+
+USERVER_NAMESPACE_END
@@ -1,13 +1,121 @@
 #include <userver/concurrent/background_task_storage.hpp>
 
+#include <map>
+#include <mutex>
+
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace concurrent {
 
+namespace impl {
+
+class BackgroundTaskLimiter final {
+ public:
+  explicit BackgroundTaskLimiter(const BackgroundTaskStorageLimits& limits)
+      : limits_(limits) {
+    UINVARIANT(limits_.max_tasks > 0, "max_tasks of a bounded BTS must be > 0");
+  }
+
+  BackgroundTaskSlot TryAcquire() {
+    engine::TaskCancellationToken dropped;
+    std::uint64_t id = 0;
+    {
+      std::lock_guard lock(mutex_);
+      if (tasks_.size() >= limits_.max_tasks) {
+        if (limits_.overflow_policy == BackgroundTaskOverflowPolicy::kReject) {
+          ++rejected_;
+          return {};
+        }
+        const auto oldest = tasks_.begin();
+        dropped = std::move(oldest->second);
+        tasks_.erase(oldest);
+        ++dropped_;
+      }
+      id = next_id_++;
+      tasks_.emplace_hint(tasks_.end(), id, engine::TaskCancellationToken{});
+    }
+    ++started_;
+
+    // The dropped task no longer holds a slot, but keeps running and holding
+    // the resources until it notices the cancellation
+    if (dropped.IsValid()) dropped.RequestCancel();
+    return {*this, id};
+  }
+
+  void SetTask(std::uint64_t id, engine::Task& task) {
+    engine::TaskCancellationToken token{task};
+    {
+      std::lock_guard lock(mutex_);
+      const auto it = tasks_.find(id);
+      if (it != tasks_.end()) {
+        std::swap(it->second, token);
+        return;
+      }
+    }
+    // The task has been finished or dropped before it was registered
+    task.RequestCancel();
+  }
+
+  void Release(std::uint64_t id,
+               std::chrono::steady_clock::duration time) noexcept {
+    timings_us_.Account(
+        std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+
+    engine::TaskCancellationToken token;
+    std::lock_guard lock(mutex_);
+    const auto it = tasks_.find(id);
+    if (it == tasks_.end()) return;
+    token = std::move(it->second);
+    tasks_.erase(it);
+  }
+
+  void DumpMetric(utils::statistics::Writer& writer) const {
+    writer["max-tasks"] = limits_.max_tasks;
+    writer["started"] = started_;
+    writer["rejected"] = rejected_;
+    writer["dropped"] = dropped_;
+    writer["timings-us"] = timings_us_;
+  }
+
+ private:
+  const BackgroundTaskStorageLimits limits_;
+
+  std::mutex mutex_;
+  // The tasks in flight from the oldest one
+  std::map<std::uint64_t, engine::TaskCancellationToken> tasks_;
+  std::uint64_t next_id_{0};
+
+  utils::statistics::RateCounter started_;
+  utils::statistics::RateCounter rejected_;
+  utils::statistics::RateCounter dropped_;
+  // From the start of the detach to the end of the task, up to a minute
+  utils::statistics::HdrHistogram<60'000'000> timings_us_;
+};
+
+BackgroundTaskSlot::BackgroundTaskSlot(BackgroundTaskLimiter& limiter,
+                                       std::uint64_t id) noexcept
+    : limiter_(&limiter), id_(id), start_(std::chrono::steady_clock::now()) {}
+
+BackgroundTaskSlot::BackgroundTaskSlot(BackgroundTaskSlot&& other) noexcept
+    : limiter_(std::exchange(other.limiter_, nullptr)),
+      id_(other.id_),
+      start_(other.start_) {}
+
+BackgroundTaskSlot::~BackgroundTaskSlot() {
+  if (limiter_) {
+    limiter_->Release(id_, std::chrono::steady_clock::now() - start_);
+  }
+}
+
+}  // namespace impl
+
 BackgroundTaskStorageCore::BackgroundTaskStorageCore()
     : sync_block_(
           std::in_place,
@@ -44,12 +152,38 @@ BackgroundTaskStorage::BackgroundTaskStorage(
     engine::TaskProcessor& task_processor)
     : task_processor_(task_processor) {}
 
+BackgroundTaskStorage::BackgroundTaskStorage(
+    engine::TaskProcessor& task_processor,
+    const BackgroundTaskStorageLimits& limits)
+    : limiter_(std::make_unique<impl::BackgroundTaskLimiter>(limits)),
+      task_processor_(task_processor) {}
+
+BackgroundTaskStorage::~BackgroundTaskStorage() = default;
+
 void BackgroundTaskStorage::CancelAndWait() noexcept { core_.CancelAndWait(); }
 
 std::int64_t BackgroundTaskStorage::ActiveTasksApprox() const noexcept {
   return core_.ActiveTasksApprox();
 }
 
+impl::BackgroundTaskSlot BackgroundTaskStorage::TryAcquireSlot() {
+  UASSERT(limiter_);
+  return limiter_->TryAcquire();
+}
+
+void BackgroundTaskStorage::DetachWithSlot(std::uint64_t id,
+                                           engine::Task&& task) {
+  UASSERT(limiter_);
+  limiter_->SetTask(id, task);
+  core_.Detach(std::move(task));
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const BackgroundTaskStorage& bts) {
+  writer["active"] = bts.ActiveTasksApprox();
+  if (bts.limiter_) bts.limiter_->DumpMetric(writer);
+}
+
 }  // namespace concurrent
 
 USERVER_NAMESPACE_END
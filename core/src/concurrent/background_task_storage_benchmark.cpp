@@ -12,24 +12,34 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+// All the tasks but one detach the tasks in a loop, the last one is measured
+void RunDetachContention(benchmark::State& state,
+                         concurrent::BackgroundTaskStorage& bts,
+                         std::int64_t threads) {
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::int64_t i = 0; i < threads - 1; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (!engine::current_task::ShouldCancel()) {
+        bts.AsyncDetach("task", [] {});
+        engine::Yield();
+      }
+    }));
+  }
+
+  for (auto _ : state) {
+    bts.AsyncDetach("task", [] {});
+    engine::Yield();
+  }
+}
+
+}  // namespace
+
 void background_task_storage(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     concurrent::BackgroundTaskStorage bts;
-
-    std::vector<engine::TaskWithResult<void>> tasks;
-    for (std::int64_t i = 0; i < state.range(0) - 1; ++i) {
-      tasks.push_back(engine::AsyncNoSpan([&] {
-        while (!engine::current_task::ShouldCancel()) {
-          bts.AsyncDetach("task", [] {});
-          engine::Yield();
-        }
-      }));
-    }
-
-    for (auto _ : state) {
-      bts.AsyncDetach("task", [] {});
-      engine::Yield();
-    }
+    RunDetachContention(state, bts, state.range(0));
   });
 }
 BENCHMARK(background_task_storage)
@@ -41,4 +51,19 @@ BENCHMARK(background_task_storage)
     ->Arg(16)
     ->Arg(32);
 
+void background_task_storage_bounded(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const concurrent::BackgroundTaskStorageLimits limits{
+        static_cast<std::size_t>(state.range(1)),
+        state.range(2) ? concurrent::BackgroundTaskOverflowPolicy::kDropOldest
+                       : concurrent::BackgroundTaskOverflowPolicy::kReject};
+    concurrent::BackgroundTaskStorage bts{
+        engine::current_task::GetTaskProcessor(), limits};
+    RunDetachContention(state, bts, state.range(0));
+  });
+}
+BENCHMARK(background_task_storage_bounded)
+    ->ArgNames({"threads", "max_tasks", "drop_oldest"})
+    ->ArgsProduct({{2, 4, 8, 16, 32}, {16, 1024}, {0, 1}});
+
 USERVER_NAMESPACE_END
@@ -10,6 +10,8 @@
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/task/task_processor_utils.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 using namespace std::chrono_literals;
 
@@ -229,4 +231,100 @@ TEST(BackgroundTaskStorage, StrongTaskProcessorBinding) {
   });
 }
 
+UTEST(BackgroundTaskStorage, BoundedReject) {
+  concurrent::BackgroundTaskStorage bts{
+      engine::current_task::GetTaskProcessor(),
+      {2, concurrent::BackgroundTaskOverflowPolicy::kReject}};
+
+  engine::SingleConsumerEvent first_event;
+  engine::SingleConsumerEvent second_event;
+  EXPECT_TRUE(
+      bts.AsyncDetach("", [&] { ASSERT_TRUE(first_event.WaitForEvent()); }));
+  EXPECT_TRUE(
+      bts.AsyncDetach("", [&] { ASSERT_TRUE(second_event.WaitForEvent()); }));
+  EXPECT_FALSE(bts.AsyncDetach("", [] { FAIL() << "Must not be started"; }));
+
+  // The slot is free once the task is finished
+  first_event.Send();
+  engine::SingleConsumerEvent third_event;
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (!bts.AsyncDetach("", [&] { third_event.Send(); })) {
+    ASSERT_FALSE(deadline.IsReached());
+    engine::Yield();
+  }
+  EXPECT_TRUE(third_event.WaitForEvent());
+  second_event.Send();
+}
+
+UTEST(BackgroundTaskStorage, BoundedDropOldest) {
+  concurrent::BackgroundTaskStorage bts{
+      engine::current_task::GetTaskProcessor(),
+      {1, concurrent::BackgroundTaskOverflowPolicy::kDropOldest}};
+
+  engine::SingleConsumerEvent cancelled;
+  bts.AsyncDetach("", [&] {
+    engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    if (engine::current_task::ShouldCancel()) cancelled.Send();
+  });
+  engine::Yield();
+
+  engine::SingleConsumerEvent finished;
+  EXPECT_TRUE(bts.AsyncDetach("", [&] { finished.Send(); }));
+  EXPECT_TRUE(cancelled.WaitForEvent());
+  EXPECT_TRUE(finished.WaitForEvent());
+}
+
+UTEST(BackgroundTaskStorage, BoundedDropOldestExceedsLimit) {
+  engine::SingleConsumerEvent dropped_started;
+  engine::SingleConsumerEvent dropped_finish;
+  engine::SingleConsumerEvent newer_started;
+  engine::SingleConsumerEvent newer_finish;
+  concurrent::BackgroundTaskStorage bts{
+      engine::current_task::GetTaskProcessor(),
+      {1, concurrent::BackgroundTaskOverflowPolicy::kDropOldest}};
+
+  bts.AsyncDetach("", [&] {
+    const engine::TaskCancellationBlocker blocker;
+    dropped_started.Send();
+    ASSERT_TRUE(dropped_finish.WaitForEvent());
+  });
+  ASSERT_TRUE(dropped_started.WaitForEvent());
+
+  EXPECT_TRUE(bts.AsyncDetach("", [&] {
+    newer_started.Send();
+    ASSERT_TRUE(newer_finish.WaitForEvent());
+  }));
+  ASSERT_TRUE(newer_started.WaitForEvent());
+
+  // The dropped task ignores the cancellation and still runs beyond the limit
+  EXPECT_EQ(bts.ActiveTasksApprox(), 2);
+
+  dropped_finish.Send();
+  newer_finish.Send();
+  while (bts.ActiveTasksApprox() != 0) engine::Yield();
+}
+
+UTEST(BackgroundTaskStorage, BoundedMetrics) {
+  concurrent::BackgroundTaskStorage bts{
+      engine::current_task::GetTaskProcessor(),
+      {1, concurrent::BackgroundTaskOverflowPolicy::kReject}};
+
+  engine::SingleConsumerEvent event;
+  bts.AsyncDetach("", [&] { ASSERT_TRUE(event.WaitForEvent()); });
+  bts.AsyncDetach("", [] {});
+  event.Send();
+  while (bts.ActiveTasksApprox() != 0) engine::Yield();
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "bts", [&](utils::statistics::Writer& writer) { writer = bts; });
+  const utils::statistics::Snapshot snapshot{storage, "bts"};
+  EXPECT_EQ(snapshot.SingleMetric("started").AsRate().value, 1);
+  EXPECT_EQ(snapshot.SingleMetric("rejected").AsRate().value, 1);
+  EXPECT_EQ(snapshot.SingleMetric("dropped").AsRate().value, 0);
+  EXPECT_EQ(snapshot.SingleMetric("max-tasks").AsInt(), 1);
+  EXPECT_EQ(
+      snapshot.SingleMetric("timings-us").AsHistogram().GetTotalCount(), 1);
+}
+
 USERVER_NAMESPACE_END
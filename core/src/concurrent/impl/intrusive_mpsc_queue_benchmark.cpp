@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <unistd.h>
+
+#include <array>
 #include <future>
 #include <vector>
 
@@ -301,4 +304,63 @@ void IntrusiveMpscQueueProduceConsumeNoContentionNoAlloc(
 
 BENCHMARK(IntrusiveMpscQueueProduceConsumeNoContentionNoAlloc);
 
+// Models the ev-thread wake-ups: each Push rings a doorbell (a pipe write, as
+// ev_async_send does without eventfd), unless `coalesce` is set and the
+// doorbell is already rung since the consumer's last drain.
+void IntrusiveMpscQueueDoorbell(benchmark::State& state, bool coalesce) {
+  IntrusiveMpscQueue queue(state.range(0));
+  std::atomic<bool> doorbell_rung{false};
+  std::array<int, 2> fds{};
+  if (::pipe(fds.data()) != 0) {
+    state.SkipWithError("pipe() failed");
+    return;
+  }
+
+  std::atomic<bool> keep_running{true};
+  const auto produce = [&](std::size_t producer_id) {
+    queue.Produce(producer_id);
+    if (!coalesce || !doorbell_rung.exchange(true, std::memory_order_acq_rel)) {
+      [[maybe_unused]] const auto written = ::write(fds[1], "", 1);
+    }
+  };
+
+  std::vector<std::future<void>> producers;
+  producers.reserve(state.range(0) - 1);
+  for (int i = 0; i < state.range(0) - 1; ++i) {
+    producers.push_back(std::async([&, producer_id = i + 1] {
+      while (keep_running) produce(producer_id);
+    }));
+  }
+
+  auto consumer = std::async([&] {
+    std::array<char, 256> buffer{};
+    while (keep_running) {
+      [[maybe_unused]] const auto received =
+          ::read(fds[0], buffer.data(), buffer.size());
+      doorbell_rung.exchange(false, std::memory_order_acq_rel);
+      while (queue.TryConsume()) {
+      }
+    }
+  });
+
+  for (auto _ : state) {
+    produce(0);
+  }
+
+  keep_running = false;
+  for (auto& producer : producers) producer.get();
+  // To unblock the consumer
+  [[maybe_unused]] const auto written = ::write(fds[1], "", 1);
+  consumer.get();
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
+
+BENCHMARK_CAPTURE(IntrusiveMpscQueueDoorbell, every_push, false)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_CAPTURE(IntrusiveMpscQueueDoorbell, coalesced, true)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,343 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <userver/concurrent/queue_helpers.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// A bounded single-producer, single-consumer queue over a ring buffer.
+//
+// Unlike concurrent::SpscQueue, no semaphores and no general purpose
+// lock-free queue are involved: the producer and the consumer only exchange
+// their indices. Each index lives in its own cache line, and each side caches
+// the last seen index of the other one, so the shared cache lines are touched
+// only when the queue looks full or empty. A batch pushed with PushMany is
+// published with a single index store and a single wakeup.
+//
+// The capacity is fixed on creation and the ring buffer is allocated upfront.
+// Producers and consumers may be used from non-coroutine threads with
+// PushNoblock and PopNoblock. The interface of the Producer and the Consumer
+// is the same as for the other concurrent queues.
+template <typename T>
+class SpscRingQueue final
+    : public std::enable_shared_from_this<SpscRingQueue<T>> {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "SpscRingQueue requires a nothrow move constructible type");
+
+  struct EmplaceEnabler final {
+    // Disable {}-initialization in Queue's constructor
+    explicit EmplaceEnabler() = default;
+  };
+
+  friend class concurrent::Producer<SpscRingQueue, NoToken, EmplaceEnabler>;
+  friend class concurrent::Consumer<SpscRingQueue, NoToken, EmplaceEnabler>;
+
+ public:
+  using ValueType = T;
+
+  using Producer = concurrent::Producer<SpscRingQueue, NoToken, EmplaceEnabler>;
+  using Consumer = concurrent::Consumer<SpscRingQueue, NoToken, EmplaceEnabler>;
+
+  // For internal use only
+  SpscRingQueue(std::size_t capacity, EmplaceEnabler /*unused*/)
+      : capacity_(capacity),
+        slots_count_(capacity + 1),
+        queue_(std::make_unique<Slot[]>(slots_count_)) {
+    UINVARIANT(capacity > 0, "SpscRingQueue requires a non-zero capacity");
+  }
+
+  ~SpscRingQueue() {
+    auto head = consumer_->head.load();
+    const auto tail = producer_->tail.load();
+    for (; head != tail; head = Next(head)) {
+      std::destroy_at(Get(head));
+    }
+  }
+
+  SpscRingQueue(SpscRingQueue&&) = delete;
+  SpscRingQueue& operator=(SpscRingQueue&&) = delete;
+
+  static std::shared_ptr<SpscRingQueue> Create(std::size_t capacity) {
+    return std::make_shared<SpscRingQueue>(capacity, EmplaceEnabler{});
+  }
+
+  // Only a single Producer may exist at a time. Another one may be obtained
+  // after the previous one is destroyed.
+  Producer GetProducer() {
+    [[maybe_unused]] const auto old_state =
+        producer_state_.exchange(SideState::kAlive);
+    UASSERT_MSG(old_state != SideState::kAlive,
+                "SpscRingQueue supports only a single producer at a time");
+    return Producer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  // Only a single Consumer may exist at a time. Another one may be obtained
+  // after the previous one is destroyed.
+  Consumer GetConsumer() {
+    [[maybe_unused]] const auto old_state =
+        consumer_state_.exchange(SideState::kAlive);
+    UASSERT_MSG(old_state != SideState::kAlive,
+                "SpscRingQueue supports only a single consumer at a time");
+    return Consumer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  std::size_t GetCapacity() const noexcept { return capacity_; }
+
+  std::size_t GetSizeApproximate() const noexcept {
+    return Distance(consumer_->head.load(), producer_->tail.load());
+  }
+
+ private:
+  enum class SideState { kNotCreated, kAlive, kDead };
+
+  struct Slot final {
+    alignas(T) std::byte storage[sizeof(T)];
+  };
+
+  struct ProducerIndex final {
+    std::atomic<std::size_t> tail{0};
+    // The last seen consumer_->head
+    std::size_t cached_head{0};
+  };
+
+  struct ConsumerIndex final {
+    std::atomic<std::size_t> head{0};
+    // The last seen producer_->tail
+    std::size_t cached_tail{0};
+  };
+
+  // Written only when a side is about to sleep
+  struct WaitFlags final {
+    std::atomic<bool> producer_waits{false};
+    std::atomic<bool> consumer_waits{false};
+  };
+
+  [[nodiscard]] bool Push(NoToken& /*token*/, T&& value,
+                          engine::Deadline deadline) {
+    return DoPush(std::move(value), deadline);
+  }
+
+  [[nodiscard]] bool PushNoblock(NoToken& /*token*/, T&& value) {
+    return DoPush(std::move(value), std::nullopt);
+  }
+
+  [[nodiscard]] bool PushMany(NoToken& /*token*/, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    if (values.empty()) return true;
+    UASSERT_MSG(values.size() <= capacity_,
+                "The batch does not fit into the SpscRingQueue");
+
+    const auto tail = producer_->tail.load(std::memory_order_relaxed);
+    if (!WaitForRoom(tail, values.size(), deadline)) return false;
+
+    auto new_tail = tail;
+    for (auto& value : values) {
+      new (Get(new_tail)) T(std::move(value));
+      new_tail = Next(new_tail);
+    }
+    values.clear();
+    Publish(new_tail);
+    return true;
+  }
+
+  [[nodiscard]] bool Pop(NoToken& /*token*/, T& value,
+                         engine::Deadline deadline) {
+    return DoPop(value, deadline);
+  }
+
+  [[nodiscard]] bool PopNoblock(NoToken& /*token*/, T& value) {
+    return DoPop(value, std::nullopt);
+  }
+
+  [[nodiscard]] std::size_t PopMany(NoToken& /*token*/, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (max_count == 0) return 0;
+
+    const auto head = consumer_->head.load(std::memory_order_relaxed);
+    const auto count =
+        std::min(WaitForElements(head, max_count, deadline), max_count);
+    values.reserve(values.size() + count);
+
+    auto index = head;
+    for (std::size_t i = 0; i < count; ++i) {
+      values.push_back(std::move(*Get(index)));
+      index = Next(index);
+    }
+    Release(head, count);
+    return count;
+  }
+
+  void MarkProducerIsDead() {
+    producer_state_ = SideState::kDead;
+    nonempty_event_.Send();
+  }
+
+  void MarkConsumerIsDead() {
+    consumer_state_ = SideState::kDead;
+    nonfull_event_.Send();
+  }
+
+  [[nodiscard]] bool DoPush(T&& value,
+                            std::optional<engine::Deadline> deadline) {
+    const auto tail = producer_->tail.load(std::memory_order_relaxed);
+    if (!WaitForRoom(tail, 1, deadline)) return false;
+
+    new (Get(tail)) T(std::move(value));
+    Publish(Next(tail));
+    return true;
+  }
+
+  [[nodiscard]] bool DoPop(T& value, std::optional<engine::Deadline> deadline) {
+    const auto head = consumer_->head.load(std::memory_order_relaxed);
+    if (WaitForElements(head, 1, deadline) == 0) return false;
+
+    value = std::move(*Get(head));
+    Release(head, 1);
+    return true;
+  }
+
+  // Waits for the room for `count` elements unless `deadline` is
+  // `std::nullopt`. Returns `false` if there's no room or no consumer.
+  [[nodiscard]] bool WaitForRoom(std::size_t tail, std::size_t count,
+                                 std::optional<engine::Deadline> deadline) {
+    if (IsDead(consumer_state_)) return false;
+
+    while (!HasRoom(tail, count)) {
+      if (!deadline) return false;
+
+      // The consumer checks the flag after publishing its new head, and we
+      // re-check the head after raising the flag, so at least one of us sees
+      // the other's store (both operations are seq_cst).
+      wait_flags_->producer_waits = true;
+      const bool is_consumer_dead = IsDead(consumer_state_);
+      const bool has_room = HasRoom(tail, count);
+      const bool is_woken_up = !has_room && !is_consumer_dead &&
+                               nonfull_event_.WaitForEventUntil(*deadline);
+      wait_flags_->producer_waits = false;
+
+      if (has_room) break;
+      if (!is_woken_up || IsDead(consumer_state_)) return false;
+    }
+    return true;
+  }
+
+  // Waits for at least one element unless `deadline` is `std::nullopt`.
+  // Returns the count of available elements, `0` if there are none. Up to
+  // `wanted` elements are looked up without waiting.
+  [[nodiscard]] std::size_t WaitForElements(
+      std::size_t head, std::size_t wanted,
+      std::optional<engine::Deadline> deadline) {
+    std::size_t available = GetAvailable(head, wanted);
+    while (available == 0) {
+      if (!deadline) return 0;
+
+      // See the comment in WaitForRoom. The elements pushed before the
+      // producer's death are seen by the GetAvailable after the check.
+      wait_flags_->consumer_waits = true;
+      const bool is_producer_dead = IsDead(producer_state_);
+      available = GetAvailable(head, wanted);
+      const bool is_woken_up = available == 0 && !is_producer_dead &&
+                               nonempty_event_.WaitForEventUntil(*deadline);
+      wait_flags_->consumer_waits = false;
+
+      if (available != 0) break;
+      if (!is_woken_up) {
+        // The producer might have pushed something right before the deadline.
+        // Check twice to avoid TOCTOU.
+        return GetAvailable(head, wanted);
+      }
+    }
+    return available;
+  }
+
+  void Publish(std::size_t new_tail) {
+    producer_->tail = new_tail;
+    if (wait_flags_->consumer_waits &&
+        wait_flags_->consumer_waits.exchange(false)) {
+      nonempty_event_.Send();
+    }
+  }
+
+  void Release(std::size_t head, std::size_t count) {
+    if (count == 0) return;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      std::destroy_at(Get(head));
+      head = Next(head);
+    }
+
+    consumer_->head = head;
+    if (wait_flags_->producer_waits &&
+        wait_flags_->producer_waits.exchange(false)) {
+      nonfull_event_.Send();
+    }
+  }
+
+  static bool IsDead(const std::atomic<SideState>& state) noexcept {
+    return state.load() == SideState::kDead;
+  }
+
+  bool HasRoom(std::size_t tail, std::size_t count) {
+    auto& cached_head = producer_->cached_head;
+    if (capacity_ - Distance(cached_head, tail) >= count) return true;
+    cached_head = consumer_->head.load();
+    return capacity_ - Distance(cached_head, tail) >= count;
+  }
+
+  // Refreshes the cached tail only if less than `wanted` elements are known
+  std::size_t GetAvailable(std::size_t head, std::size_t wanted) {
+    auto& cached_tail = consumer_->cached_tail;
+    if (Distance(head, cached_tail) >= wanted) {
+      return Distance(head, cached_tail);
+    }
+    cached_tail = producer_->tail.load();
+    return Distance(head, cached_tail);
+  }
+
+  std::size_t Distance(std::size_t from, std::size_t to) const noexcept {
+    return to >= from ? to - from : to + slots_count_ - from;
+  }
+
+  std::size_t Next(std::size_t index) const noexcept {
+    return index + 1 == slots_count_ ? 0 : index + 1;
+  }
+
+  T* Get(std::size_t index) const noexcept {
+    return std::launder(reinterpret_cast<T*>(queue_[index].storage));
+  }
+
+  const std::size_t capacity_;
+  // One slot is always kept empty to tell a full queue from an empty one
+  const std::size_t slots_count_;
+  // Named `queue_` for the Producer and the Consumer to construct tokens from
+  const std::unique_ptr<Slot[]> queue_;
+
+  InterferenceShield<ProducerIndex> producer_;
+  InterferenceShield<ConsumerIndex> consumer_;
+  InterferenceShield<WaitFlags> wait_flags_;
+
+  engine::SingleConsumerEvent nonempty_event_;
+  engine::SingleConsumerEvent nonfull_event_;
+  std::atomic<SideState> producer_state_{SideState::kNotCreated};
+  std::atomic<SideState> consumer_state_{SideState::kNotCreated};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,212 @@
+#include <concurrent/impl/spsc_ring_queue.hpp>
+
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Queue = concurrent::impl::SpscRingQueue<std::size_t>;
+
+constexpr std::size_t kMessageCount = 10000;
+
+}  // namespace
+
+UTEST(SpscRingQueue, PushPop) {
+  auto queue = Queue::Create(3);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+  EXPECT_EQ(queue->GetCapacity(), 3);
+
+  // Wrap around the ring several times
+  for (std::size_t i = 0; i < 10; ++i) {
+    EXPECT_TRUE(producer.Push(std::size_t{i}));
+    EXPECT_TRUE(producer.Push(std::size_t{i + 100}));
+    EXPECT_EQ(queue->GetSizeApproximate(), 2);
+
+    std::size_t value{};
+    EXPECT_TRUE(consumer.Pop(value));
+    EXPECT_EQ(value, i);
+    EXPECT_TRUE(consumer.PopNoblock(value));
+    EXPECT_EQ(value, i + 100);
+    EXPECT_FALSE(consumer.PopNoblock(value));
+  }
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+UTEST(SpscRingQueue, Full) {
+  auto queue = Queue::Create(2);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  EXPECT_TRUE(producer.PushNoblock(1));
+  EXPECT_TRUE(producer.PushNoblock(2));
+  std::size_t value = 3;
+  EXPECT_FALSE(producer.PushNoblock(std::move(value)));
+  EXPECT_FALSE(producer.Push(std::move(value), engine::Deadline::Passed()));
+  EXPECT_EQ(value, 3);  // NOLINT(bugprone-use-after-move)
+
+  auto push_task = utils::Async("producer", [&] {
+    return producer.Push(std::size_t{3});
+  });
+  engine::Yield();
+  EXPECT_FALSE(push_task.IsFinished());
+
+  EXPECT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(push_task.Get());
+  EXPECT_EQ(queue->GetSizeApproximate(), 2);
+}
+
+UTEST(SpscRingQueue, PushPopMany) {
+  auto queue = Queue::Create(5);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  EXPECT_TRUE(producer.PushMany({0, 1, 2}));
+  EXPECT_FALSE(producer.PushMany({3, 4, 5}, engine::Deadline::Passed()));
+  EXPECT_TRUE(producer.PushMany({3, 4}));
+
+  std::vector<std::size_t> values;
+  EXPECT_EQ(consumer.PopMany(values, 4), 4);
+  EXPECT_TRUE(producer.PushMany({5, 6, 7}));
+  EXPECT_EQ(consumer.PopMany(values, 10), 4);
+  EXPECT_EQ(values, (std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(consumer.PopMany(values, 10, engine::Deadline::Passed()), 0);
+}
+
+UTEST(SpscRingQueue, ProducerIsDead) {
+  auto queue = Queue::Create(10);
+  auto consumer = queue->GetConsumer();
+
+  auto pop_task = utils::Async("consumer", [&] {
+    std::vector<std::size_t> values;
+    std::size_t value{};
+    while (consumer.Pop(value)) values.push_back(value);
+    return values;
+  });
+
+  {
+    auto producer = queue->GetProducer();
+    EXPECT_TRUE(producer.Push(1));
+    EXPECT_TRUE(producer.Push(2));
+  }
+
+  EXPECT_EQ(pop_task.Get(), (std::vector<std::size_t>{1, 2}));
+}
+
+UTEST(SpscRingQueue, ConsumerIsDead) {
+  auto queue = Queue::Create(1);
+  auto producer = queue->GetProducer();
+
+  EXPECT_TRUE(producer.Push(1));
+  auto push_task = utils::Async("producer", [&] {
+    return producer.Push(std::size_t{2});
+  });
+  engine::Yield();
+
+  (void)queue->GetConsumer();
+  EXPECT_FALSE(push_task.Get());
+  EXPECT_FALSE(producer.Push(3));
+}
+
+UTEST(SpscRingQueue, DestroysRemainingElements) {
+  auto queue = concurrent::impl::SpscRingQueue<std::shared_ptr<int>>::Create(4);
+  auto element = std::make_shared<int>(42);
+  {
+    auto producer = queue->GetProducer();
+    EXPECT_TRUE(producer.Push(std::shared_ptr{element}));
+    EXPECT_TRUE(producer.Push(std::shared_ptr{element}));
+  }
+  EXPECT_EQ(element.use_count(), 3);
+
+  queue.reset();
+  EXPECT_EQ(element.use_count(), 1);
+}
+
+UTEST_MT(SpscRingQueue, Spsc, 2) {
+  auto queue = Queue::Create(16);
+  std::optional producer(queue->GetProducer());
+
+  auto consumer_task =
+      utils::Async("consumer", [consumer = queue->GetConsumer()] {
+        std::size_t expected = 0;
+        std::size_t value{};
+        while (consumer.Pop(value)) {
+          EXPECT_EQ(value, expected);
+          ++expected;
+        }
+        return expected;
+      });
+
+  for (std::size_t message = 0; message < kMessageCount; ++message) {
+    ASSERT_TRUE(producer->Push(std::size_t{message}));
+  }
+  producer.reset();
+
+  EXPECT_EQ(consumer_task.Get(), kMessageCount);
+}
+
+UTEST_MT(SpscRingQueue, SpscBatched, 2) {
+  constexpr std::size_t kBatchSize = 7;
+  auto queue = Queue::Create(16);
+  std::optional producer(queue->GetProducer());
+
+  auto consumer_task =
+      utils::Async("consumer", [consumer = queue->GetConsumer()] {
+        std::vector<std::size_t> values;
+        while (consumer.PopMany(values, kBatchSize + 3) != 0) {
+        }
+        return values;
+      });
+
+  std::vector<std::size_t> batch;
+  for (std::size_t message = 0; message < kMessageCount; ++message) {
+    batch.push_back(message);
+    if (batch.size() == kBatchSize) {
+      ASSERT_TRUE(producer->PushMany(std::move(batch)));
+      batch.clear();
+    }
+  }
+  ASSERT_TRUE(producer->PushMany(std::move(batch)));
+  producer.reset();
+
+  const auto values = consumer_task.Get();
+  ASSERT_EQ(values.size(), kMessageCount);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], i);
+  }
+}
+
+UTEST(SpscRingQueue, NonCoroutineProducer) {
+  auto queue = Queue::Create(16);
+  auto consumer = queue->GetConsumer();
+
+  std::thread producer_thread([producer = queue->GetProducer()] {
+    for (std::size_t message = 0; message < kMessageCount;) {
+      if (producer.PushNoblock(std::size_t{message})) {
+        ++message;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::size_t expected = 0;
+  std::size_t value{};
+  while (consumer.Pop(value)) {
+    EXPECT_EQ(value, expected);
+    ++expected;
+  }
+  producer_thread.join();
+  EXPECT_EQ(expected, kMessageCount);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <concurrent/impl/spsc_ring_queue.hpp>
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -31,6 +32,40 @@ auto GetConsumerTask(std::shared_ptr<QueueType> queue,
     }
   });
 }
+
+template <typename QueueType>
+auto GetBatchProducerTask(std::shared_ptr<QueueType> queue,
+                          std::atomic<bool>& run, std::size_t batch_size) {
+  return utils::Async(
+      "producer", [producer = queue->GetProducer(), &run, batch_size] {
+        std::size_t message = 0;
+        std::vector<std::size_t> batch;
+        while (run) {
+          batch.clear();
+          for (std::size_t i = 0; i < batch_size; ++i) {
+            batch.push_back(message++);
+          }
+          bool res = producer.PushMany(std::move(batch));
+          benchmark::DoNotOptimize(res);
+        }
+      });
+}
+
+template <typename QueueType>
+auto GetBatchConsumerTask(std::shared_ptr<QueueType> queue,
+                          const std::atomic<bool>& run,
+                          std::size_t batch_size) {
+  return utils::Async(
+      "consumer", [consumer = queue->GetConsumer(), &run, batch_size]() {
+        std::vector<std::size_t> values;
+        values.reserve(batch_size);
+        while (run) {
+          values.clear();
+          auto res = consumer.PopMany(values, batch_size);
+          benchmark::DoNotOptimize(res);
+        }
+      });
+}
 }  // namespace
 
 template <typename QueueType>
@@ -61,6 +96,50 @@ void producer_consumer(benchmark::State& state) {
         bool res = producer.Push(std::size_t{message++});
         benchmark::DoNotOptimize(res);
       }
+      state.SetItemsProcessed(state.iterations());
+    }
+
+    run = false;
+  });
+}
+
+// Same as producer_consumer, but the elements are pushed and popped in batches
+// of state.range(3) elements
+template <typename QueueType>
+void producer_consumer_batched(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + state.range(1), [&] {
+    std::size_t ProducersCount = state.range(0);
+    std::size_t ConsumersCount = state.range(1);
+    std::size_t QueueSize = state.range(2);
+    std::size_t BatchSize = state.range(3);
+
+    std::atomic<bool> run{true};
+    auto queue = QueueType::Create(QueueSize);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(ProducersCount + ConsumersCount - 1);
+    for (std::size_t i = 0; i < ProducersCount - 1; ++i) {
+      tasks.push_back(GetBatchProducerTask(queue, run, BatchSize));
+    }
+
+    for (std::size_t i = 0; i < ConsumersCount; ++i) {
+      tasks.push_back(GetBatchConsumerTask(queue, run, BatchSize));
+    }
+
+    // Current thread work
+    {
+      std::size_t message = 0;
+      auto producer = queue->GetProducer();
+      std::vector<std::size_t> batch;
+      for (auto _ : state) {
+        batch.clear();
+        for (std::size_t i = 0; i < BatchSize; ++i) {
+          batch.push_back(message++);
+        }
+        bool res = producer.PushMany(std::move(batch));
+        benchmark::DoNotOptimize(res);
+      }
+      state.SetItemsProcessed(state.iterations() * BatchSize);
     }
 
     run = false;
@@ -87,6 +166,35 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 1}, {1, 1}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer_batched,
+                   concurrent::NonFifoMpmcQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 4}, {512, 512}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batched,
+                   concurrent::NonFifoMpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 1}, {512, 512}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batched,
+                   concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {512, 512}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer,
+                   concurrent::impl::SpscRingQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batched,
+                   concurrent::impl::SpscRingQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {512, 512}, {1, 64}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {128, 512}});
@@ -0,0 +1,77 @@
+#include <userver/concurrent/pipeline.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+PipelineStageStatistics::PipelineStageStatistics(
+    std::string name, std::function<std::size_t()> get_queue_size)
+    : name(std::move(name)), get_queue_size(std::move(get_queue_size)) {}
+
+void PipelineStageStatistics::Account(
+    std::size_t items_count, std::chrono::steady_clock::duration time) {
+  items += utils::statistics::Rate{items_count};
+  batches += utils::statistics::Rate{1};
+  timings_us.Account(
+      std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const PipelineStageStatistics& stats) {
+  writer["items"] = stats.items;
+  writer["batches"] = stats.batches;
+  writer["errors"] = stats.errors;
+  writer["queue-size"] = stats.get_queue_size();
+  writer["timings-us"] = stats.timings_us;
+}
+
+PipelineState::PipelineState(engine::TaskProcessor& task_processor)
+    : task_processor_(task_processor) {}
+
+PipelineState::~PipelineState() {
+  stopped_ = true;
+  for (auto& task : tasks_) task.RequestCancel();
+  // The running tasks may still access tasks_ in Fail()
+  for (auto& task : tasks_) task.SyncCancel();
+}
+
+PipelineStageStatistics& PipelineState::AddStage(
+    std::string name, std::function<std::size_t()> get_queue_size) {
+  return stages_.emplace_front(std::move(name), std::move(get_queue_size));
+}
+
+void PipelineState::Fail(std::exception_ptr error) noexcept {
+  if (failed_.exchange(true)) return;
+
+  // Wait() reads the error after all the tasks are finished
+  error_ = std::move(error);
+  stopped_ = true;
+  for (auto& task : tasks_) task.RequestCancel();
+}
+
+void PipelineState::Wait() {
+  for (auto& task : tasks_) {
+    task.Wait();
+    if (!task.IsFinished()) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+  }
+
+  if (failed_) std::rethrow_exception(error_);
+}
+
+void DumpPipelineMetric(utils::statistics::Writer& writer,
+                        const PipelineState& state) {
+  for (const auto& stage : state.GetStages()) {
+    writer.ValueWithLabels(stage, {"stage", stage.name});
+  }
+}
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
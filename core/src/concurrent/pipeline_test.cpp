@@ -0,0 +1,175 @@
+#include <userver/concurrent/pipeline.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+concurrent::PipelineStageSettings MakeSettings(std::string name,
+                                               std::size_t parallelism = 1,
+                                               std::size_t max_batch_size = 1) {
+  concurrent::PipelineStageSettings settings;
+  settings.name = std::move(name);
+  settings.parallelism = parallelism;
+  settings.queue_size = 4;
+  settings.max_batch_size = max_batch_size;
+  return settings;
+}
+
+}  // namespace
+
+UTEST_MT(Pipeline, Sample, 4) {
+  /// [Sample concurrent::Pipeline usage]
+  std::atomic<int> sum{0};
+
+  auto pipeline =
+      concurrent::PipelineBuilder<int>{engine::current_task::GetTaskProcessor()}
+          .Then({"parse", 2}, [](int value) { return std::to_string(value); })
+          .ThenBatched({"filter", 1, 64, 10},
+                       [](std::vector<std::string>&& batch) {
+                         std::vector<int> sizes;
+                         for (const auto& value : batch) {
+                           if (value.size() > 1) sizes.push_back(value.size());
+                         }
+                         return sizes;
+                       })
+          .Finally({"sum"}, [&sum](int size) { sum += size; });
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(pipeline.Push(int{i}));
+  }
+  // Waits for all the elements to be processed
+  pipeline.Finish();
+  /// [Sample concurrent::Pipeline usage]
+
+  EXPECT_EQ(sum, 90 * 2);
+}
+
+UTEST_MT(Pipeline, ParallelStages, 4) {
+  constexpr int kCount = 1000;
+  std::atomic<long> sum{0};
+  std::atomic<int> batches{0};
+
+  auto pipeline =
+      concurrent::PipelineBuilder<int>{engine::current_task::GetTaskProcessor()}
+          .Then(MakeSettings("square", 3),
+                [](int value) { return long{value} * value; })
+          .FinallyBatched(MakeSettings("sum", 2, 16),
+                          [&](std::vector<long>&& batch) {
+                            EXPECT_LE(batch.size(), 16);
+                            ++batches;
+                            for (const auto value : batch) sum += value;
+                          });
+
+  for (int i = 0; i < kCount; ++i) {
+    ASSERT_TRUE(pipeline.Push(int{i}));
+  }
+  pipeline.Finish();
+
+  long expected = 0;
+  for (long i = 0; i < kCount; ++i) expected += i * i;
+  EXPECT_EQ(sum, expected);
+  EXPECT_GE(batches, kCount / 16);
+}
+
+UTEST_MT(Pipeline, ErrorStopsPipeline, 4) {
+  auto pipeline =
+      concurrent::PipelineBuilder<int>{engine::current_task::GetTaskProcessor()}
+          .Then(MakeSettings("check", 2),
+                [](int value) {
+                  if (value == 10) throw std::runtime_error("bad value");
+                  return value;
+                })
+          .Finally(MakeSettings("slow"), [](int) { engine::SleepFor(1ms); });
+
+  // The stages are cancelled, so the pushes fail soon after the error
+  bool stopped = false;
+  for (int i = 0; i < 1000 && !stopped; ++i) {
+    stopped = !pipeline.Push(int{i});
+  }
+  EXPECT_TRUE(stopped);
+
+  UEXPECT_THROW_MSG(pipeline.Finish(), std::runtime_error, "bad value");
+}
+
+UTEST(Pipeline, PushDeadline) {
+  auto pipeline =
+      concurrent::PipelineBuilder<int>{engine::current_task::GetTaskProcessor()}
+          .Finally(MakeSettings("blocked"), [](int) {
+            engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+          });
+
+  bool pushed = true;
+  for (int i = 0; i < 10 && pushed; ++i) {
+    pushed = pipeline.Push(int{i}, engine::Deadline::FromDuration(10ms));
+  }
+  EXPECT_FALSE(pushed);
+
+  // The destructor cancels the blocked stage
+}
+
+UTEST(Pipeline, FinishInterrupted) {
+  auto pipeline =
+      concurrent::PipelineBuilder<int>{engine::current_task::GetTaskProcessor()}
+          .Finally(MakeSettings("blocked"), [](int) {
+            engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+          });
+  ASSERT_TRUE(pipeline.Push(1));
+
+  engine::current_task::GetCancellationToken().RequestCancel();
+  UEXPECT_THROW(pipeline.Finish(), engine::WaitInterruptedException);
+}
+
+UTEST(Pipeline, Metrics) {
+  auto pipeline =
+      concurrent::PipelineBuilder<int>{engine::current_task::GetTaskProcessor()}
+          .ThenBatched(MakeSettings("double", 1, 8),
+                       [](std::vector<int>&& batch) {
+                         for (auto& value : batch) value *= 2;
+                         return std::move(batch);
+                       })
+          .Finally(MakeSettings("sink"), [](int) {});
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(pipeline.Push(int{i}));
+  }
+  pipeline.Finish();
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "pipeline",
+      [&](utils::statistics::Writer& writer) { writer = pipeline; });
+
+  const utils::statistics::Snapshot snapshot{storage, "pipeline"};
+  const auto rate = [&](std::string path, std::string stage) {
+    return snapshot.SingleMetric(std::move(path), {{"stage", std::move(stage)}})
+        .AsRate()
+        .value;
+  };
+  EXPECT_EQ(rate("items", "double"), 10);
+  EXPECT_EQ(rate("items", "sink"), 10);
+  EXPECT_EQ(rate("batches", "sink"), 10);
+  EXPECT_EQ(rate("errors", "sink"), 0);
+  EXPECT_EQ(snapshot.SingleMetric("queue-size", {{"stage", "double"}}).AsInt(),
+            0);
+  EXPECT_EQ(snapshot.SingleMetric("timings-us", {{"stage", "sink"}})
+                .AsHistogram()
+                .GetTotalCount(),
+            10);
+}
+
+USERVER_NAMESPACE_END
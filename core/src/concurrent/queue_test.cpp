@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include <boost/range/irange.hpp>
 
@@ -31,6 +32,9 @@ auto GetProducerTask(const Producer& producer, std::size_t i) {
 template <typename T>
 class NonCoroutineTest : public ::testing::Test {};
 
+template <typename T>
+class BatchedQueue : public ::testing::Test {};
+
 using TestMpmcTypes =
     testing::Types<concurrent::NonFifoMpmcQueue<int>,
                    concurrent::NonFifoMpmcQueue<std::unique_ptr<int>>,
@@ -60,6 +64,7 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, TypedQueueFixture,
                                 TestMpmcTypes);
 
 TYPED_TEST_SUITE(NonCoroutineTest, TestQueueTypes);
+TYPED_UTEST_SUITE(BatchedQueue, TestQueueTypes);
 
 TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   auto queue = TypeParam::Create();
@@ -83,6 +88,71 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   EXPECT_EQ(value, 2);
 }
 
+TYPED_UTEST(BatchedQueue, PushPopMany) {
+  auto queue = TypeParam::Create(10);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> batch{0, 1, 2, 3, 4};
+  EXPECT_TRUE(producer.PushMany(std::move(batch)));
+  EXPECT_TRUE(batch.empty());  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(queue->GetSizeApproximate(), 5);
+
+  std::vector<std::size_t> values;
+  EXPECT_EQ(consumer.PopMany(values, 3), 3);
+  EXPECT_EQ(values, (std::vector<std::size_t>{0, 1, 2}));
+  EXPECT_EQ(consumer.PopMany(values, 10), 2);
+  EXPECT_EQ(values, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+
+  EXPECT_EQ(consumer.PopMany(values, 10, engine::Deadline::Passed()), 0);
+  EXPECT_TRUE(producer.PushMany({}));
+}
+
+TYPED_UTEST(BatchedQueue, PushManyWaitsForCapacity) {
+  auto queue = TypeParam::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  EXPECT_TRUE(producer.PushMany({0, 1, 2}));
+
+  std::vector<std::size_t> batch{3, 4};
+  EXPECT_FALSE(producer.PushMany(std::move(batch), engine::Deadline::Passed()));
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_EQ(batch, (std::vector<std::size_t>{3, 4}));
+
+  auto push_task = utils::Async("producer", [&] {
+    return producer.PushMany(std::move(batch));
+  });
+  engine::Yield();
+  EXPECT_FALSE(push_task.IsFinished());
+
+  std::size_t value{};
+  EXPECT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(push_task.Get());
+
+  std::vector<std::size_t> values;
+  EXPECT_EQ(consumer.PopMany(values, 10), 4);
+  EXPECT_EQ(values, (std::vector<std::size_t>{1, 2, 3, 4}));
+}
+
+TYPED_UTEST(BatchedQueue, PopManyProducerIsDead) {
+  auto queue = TypeParam::Create();
+  auto consumer = queue->GetConsumer();
+
+  {
+    auto producer = queue->GetProducer();
+    EXPECT_TRUE(producer.PushMany({0, 1, 2}));
+  }
+
+  std::vector<std::size_t> values;
+  EXPECT_EQ(consumer.PopMany(values, 2), 2);
+  EXPECT_EQ(consumer.PopMany(values, 2), 1);
+  EXPECT_EQ(consumer.PopMany(values, 2), 0);
+  EXPECT_EQ(values, (std::vector<std::size_t>{0, 1, 2}));
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
   auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
   auto producer = queue->GetProducer();
@@ -140,6 +210,66 @@ UTEST_MT(NonFifoMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
                           [](int item) { return item == 1; }));
 }
 
+UTEST_MT(NonFifoMpmcQueue, MpmcBatched, kProducersCount + kConsumersCount) {
+  constexpr std::size_t kBatchSize = 10;
+
+  auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kMessageCount);
+  std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [&producer = producers[i], i] {
+          std::vector<std::size_t> batch;
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            batch.push_back(message);
+            if (batch.size() == kBatchSize) {
+              ASSERT_TRUE(producer.PushMany(std::move(batch)));
+              batch.clear();
+            }
+          }
+          ASSERT_TRUE(producer.PushMany(std::move(batch)));
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopMany(values, kBatchSize + 3) != 0) {
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+}
+
 UTEST_MT(NonFifoMpmcQueue, SizeAfterConsumersDie, kConsumersCount + 1) {
   constexpr std::size_t kAttemptsCount = 1000;
 
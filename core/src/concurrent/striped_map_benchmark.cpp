@@ -0,0 +1,143 @@
+#include <userver/concurrent/striped_map.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kKeysCount = 1024;
+
+// Emulates the rate-limit counters: mostly updates of the random keys
+class VariableCounters final {
+ public:
+  void Increment(std::uint64_t key) {
+    auto map = map_.UniqueLock();
+    ++(*map)[key];
+  }
+
+ private:
+  concurrent::Variable<std::unordered_map<std::uint64_t, std::uint64_t>> map_;
+};
+
+template <typename Mutex>
+class StripedCounters final {
+ public:
+  void Increment(std::uint64_t key) {
+    map_.Update(key, [](std::uint64_t& value) { ++value; });
+  }
+
+ private:
+  concurrent::StripedMap<std::uint64_t, std::uint64_t,
+                         std::hash<std::uint64_t>,
+                         std::equal_to<std::uint64_t>, Mutex>
+      map_;
+};
+
+template <typename Counters>
+void counters_increment_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    Counters counters;
+
+    const auto do_work = [&counters](std::uint64_t& key) {
+      // a cheap pseudo-random sequence of keys
+      key = (key * 6364136223846793005 + 1442695040888963407);
+      counters.Increment((key >> 32) % kKeysCount);
+    };
+
+    const std::size_t concurrent_jobs = state.range(0);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        std::uint64_t key = thread_id;
+        while (keep_running) {
+          do_work(key);
+        }
+      }));
+    }
+
+    std::uint64_t key = 0;
+    for (auto _ : state) {
+      do_work(key);
+    }
+
+    keep_running = false;
+
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+BENCHMARK_TEMPLATE(counters_increment_contention, VariableCounters)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(counters_increment_contention,
+                   StripedCounters<engine::Mutex>)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(counters_increment_contention,
+                   StripedCounters<engine::SharedMutex>)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+template <typename Mutex>
+void striped_map_get_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    concurrent::StripedMap<std::uint64_t, std::uint64_t,
+                           std::hash<std::uint64_t>,
+                           std::equal_to<std::uint64_t>, Mutex>
+        map;
+    for (std::uint64_t i = 0; i < kKeysCount; ++i) map.Insert(i, i);
+
+    const std::size_t concurrent_jobs = state.range(0);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        std::uint64_t i = thread_id;
+        while (keep_running) {
+          benchmark::DoNotOptimize(map.Get(++i % kKeysCount));
+        }
+      }));
+    }
+
+    std::uint64_t i = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(map.Get(++i % kKeysCount));
+    }
+
+    keep_running = false;
+
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+BENCHMARK_TEMPLATE(striped_map_get_contention, engine::Mutex)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(striped_map_get_contention, engine::SharedMutex)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
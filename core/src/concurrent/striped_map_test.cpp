@@ -0,0 +1,112 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/striped_map.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(StripedMap, Sample) {
+  /// [Sample striped map usage]
+  concurrent::StripedMap<std::string, int> counters;
+
+  counters.Update("requests", [](int& value) { ++value; });
+  counters.Update("requests", [](int& value) { ++value; });
+  EXPECT_EQ(counters.Get("requests"), 2);
+  EXPECT_EQ(counters.Get("errors"), std::nullopt);
+  /// [Sample striped map usage]
+}
+
+UTEST(StripedMap, InsertErase) {
+  concurrent::StripedMap<std::string, std::string> map;
+
+  EXPECT_TRUE(map.Insert("a", "1"));
+  EXPECT_FALSE(map.Insert("a", "2"));
+  EXPECT_EQ(map.Get("a"), "1");
+
+  EXPECT_FALSE(map.InsertOrAssign("a", "3"));
+  EXPECT_EQ(map.Get("a"), "3");
+  EXPECT_TRUE(map.InsertOrAssign("b", "4"));
+  EXPECT_TRUE(map.Contains("b"));
+  EXPECT_EQ(map.Size(), 2);
+
+  EXPECT_TRUE(map.Erase("a"));
+  EXPECT_FALSE(map.Erase("a"));
+  EXPECT_FALSE(map.Contains("a"));
+  EXPECT_EQ(map.Size(), 1);
+
+  map.Clear();
+  EXPECT_EQ(map.Size(), 0);
+  EXPECT_FALSE(map.Contains("b"));
+}
+
+UTEST(StripedMap, UpdateIfExists) {
+  concurrent::StripedMap<int, int> map(3);
+
+  EXPECT_FALSE(map.UpdateIfExists(1, [](int& value) { value = 10; }));
+  EXPECT_FALSE(map.Contains(1));
+
+  map.Insert(1, 1);
+  EXPECT_TRUE(map.UpdateIfExists(1, [](int& value) { value = 10; }));
+  EXPECT_EQ(map.Get(1), 10);
+
+  EXPECT_EQ(map.Update(1, [](int& value) { return value * 2; }), 20);
+}
+
+UTEST(StripedMap, VisitAndEraseIf) {
+  concurrent::StripedMap<int, int> map(4);
+  for (int i = 0; i < 100; ++i) map.Insert(i, i * i);
+
+  int sum = 0;
+  map.VisitAll([&sum](int key, int value) {
+    EXPECT_EQ(key * key, value);
+    sum += key;
+  });
+  EXPECT_EQ(sum, 99 * 100 / 2);
+
+  EXPECT_EQ(map.EraseIf([](int key, int&) { return key % 2 == 0; }), 50);
+  EXPECT_EQ(map.Size(), 50);
+  EXPECT_FALSE(map.Contains(42));
+  EXPECT_TRUE(map.Contains(43));
+}
+
+UTEST(StripedMap, Mutex) {
+  concurrent::StripedMap<int, int, std::hash<int>, std::equal_to<int>,
+                         engine::Mutex>
+      map(1);
+
+  map.Update(1, [](int& value) { value = 42; });
+  EXPECT_EQ(map.Get(1), 42);
+  EXPECT_EQ(map.Size(), 1);
+}
+
+UTEST_MT(StripedMap, ConcurrentUpdates, 4) {
+  constexpr int kTasks = 8;
+  constexpr int kKeys = 16;
+  constexpr int kIterations = 1000;
+
+  concurrent::StripedMap<int, int> map(7);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(utils::Async("updater", [&map] {
+      for (int j = 0; j < kIterations; ++j) {
+        map.Update(j % kKeys, [](int& value) { ++value; });
+        [[maybe_unused]] const auto value = map.Get((j + 1) % kKeys);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(map.Size(), kKeys);
+  map.VisitAll([](int, int value) {
+    EXPECT_EQ(value, kTasks * kIterations / kKeys);
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -98,6 +98,10 @@ Component::Component(const components::ComponentConfig& config,
   pimpl_->server.SetRpsRatelimitStatusCode(
       static_cast<server::http::HttpStatus>(
           config["status-code"].As<int>(429)));
+  if (config.HasMember("tenants")) {
+    pimpl_->server.SetRpsRatelimitTenants(
+        config["tenants"].As<TenantsConfig>());
+  }
 
   if (!pimpl_->fake_mode && only_rtc && !hostinfo::IsInRtc()) {
     LOG_WARNING() << "Started outside of RTC, forcing fake-mode";
@@ -193,6 +197,50 @@ properties:
         type: integer
         description: HTTP status code for ratelimited responses
         defaultDescription: 429
+    tenants:
+        type: object
+        description: splits the RPS limit between the groups of clients and handlers
+        additionalProperties: false
+        properties:
+            client-header:
+                type: string
+                description: header identifying the client of a request
+                defaultDescription: X-YaService-Name
+            default-weight:
+                type: number
+                description: share of the requests of the other clients and handlers
+                defaultDescription: 1
+            items:
+                type: array
+                description: the tenants
+                items:
+                    type: object
+                    description: a group of clients and handlers
+                    additionalProperties: false
+                    properties:
+                        name:
+                            type: string
+                            description: name of the tenant for logs
+                        clients:
+                            type: array
+                            description: values of the client header
+                            items:
+                                type: string
+                                description: value of the client header
+                        handlers:
+                            type: array
+                            description: names of the handler components
+                            items:
+                                type: string
+                                description: name of the handler component
+                        weight:
+                            type: number
+                            description: share of the RPS limit relative to the others
+                            defaultDescription: 1
+                        low-priority:
+                            type: boolean
+                            description: if set, the tenant can not use the unused shares of the others and is throttled first
+                            defaultDescription: false
 )");
 }
 
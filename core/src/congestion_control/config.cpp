@@ -2,6 +2,8 @@
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -48,6 +50,37 @@ Policy Parse(const formats::json::Value& policy, formats::parse::To<Policy>) {
   return p;
 }
 
+Tenant Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tenant>) {
+  Tenant tenant;
+  tenant.name = value["name"].As<std::string>();
+  tenant.clients = value["clients"].As<std::vector<std::string>>({});
+  tenant.handlers = value["handlers"].As<std::vector<std::string>>({});
+  tenant.weight = value["weight"].As<double>(tenant.weight);
+  if (tenant.weight <= 0) {
+    throw std::runtime_error(
+        fmt::format("Validation 0 < x failed for '{}' (got: {})",
+                    value["weight"].GetPath(), tenant.weight));
+  }
+  tenant.is_low_priority = value["low-priority"].As<bool>(false);
+  return tenant;
+}
+
+TenantsConfig Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TenantsConfig>) {
+  TenantsConfig config;
+  config.client_header =
+      value["client-header"].As<std::string>(config.client_header);
+  config.default_weight =
+      value["default-weight"].As<double>(config.default_weight);
+  if (config.default_weight <= 0) {
+    throw std::runtime_error(
+        fmt::format("Validation 0 < x failed for '{}' (got: {})",
+                    value["default-weight"].GetPath(), config.default_weight));
+  }
+  config.tenants = value["items"].As<std::vector<Tenant>>({});
+  return config;
+}
+
 namespace impl {
 
 RpsCcConfig RpsCcConfig::Parse(const dynamic_config::DocsMap& docs_map) {
@@ -181,7 +181,8 @@ void Controller::Feed(const Sensor::Data& data) {
     LOG(log_level) << "congestion control '" << name_
                    << "' state: input load=" << data.current_load
                    << " input overloads=" << data.overload_events_count
-                   << load_prc_str
+                   << load_prc_str << " queue_wait_p99="
+                   << data.queue_wait_p99.count() << "us"
                    << " => is_overloaded=" << state_.is_overloaded
                    << " current_limit=" << state_.current_limit
                    << " times_w=" << state_.times_with_overload
@@ -229,6 +229,14 @@ void easy::do_ev_cancel(size_t request_num) {
   }
 }
 
+void easy::unpause() {
+  const auto code = native::curl_easy_pause(handle_, CURLPAUSE_CONT);
+  if (code != native::CURLE_OK) {
+    LOG_DEBUG() << "Failed to unpause the transfer: "
+                  << native::curl_easy_strerror(code);
+  }
+}
+
 void easy::reset() {
   LOG_TRACE() << "easy::reset start " << this;
 
@@ -419,6 +427,25 @@ std::optional<std::string_view> easy::FindHeaderByName(
   return FindHeaderByNameImpl(headers_, name);
 }
 
+void easy::add_header_line(std::string_view name, const std::string& line) {
+  if (headers_ && headers_->ReplaceFirstIf(
+                      [name](std::string_view header) {
+                        return IsHeaderMatchingName(header, name);
+                      },
+                      line.c_str())) {
+    return;
+  }
+  add_header(line);
+}
+
+void easy::AppendHeaders(std::string& to) const {
+  if (!headers_) return;
+  headers_->ForEach([&to](const std::string& header) {
+    to += header;
+    to += '\n';
+  });
+}
+
 void easy::add_header(const char* header) {
   std::error_code ec;
   add_header(header, ec);
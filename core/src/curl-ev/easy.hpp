@@ -177,6 +177,9 @@ class easy final : public std::enable_shared_from_this<easy> {
   void perform(std::error_code& ec);
   void async_perform(handler_type handler);
   void cancel();
+  // Resumes the transfer paused by a callback, must be called from the ev
+  // thread of the multi
+  void unpause();
   void reset();
   void set_source(std::shared_ptr<std::istream> source);
   void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
@@ -425,9 +428,13 @@ class easy final : public std::enable_shared_from_this<easy> {
   void add_header(const char* header, std::error_code& ec);
   void add_header(const std::string& header);
   void add_header(const std::string& header, std::error_code& ec);
+  // Adds a preformatted "Name: value" line, replacing the header of the name
+  void add_header_line(std::string_view name, const std::string& line);
   void set_headers(std::shared_ptr<string_list> headers);
   void set_headers(std::shared_ptr<string_list> headers, std::error_code& ec);
   std::optional<std::string_view> FindHeaderByName(std::string_view name) const;
+  // Appends the headers in the order of addition, each followed by '\n'
+  void AppendHeaders(std::string& to) const;
   void add_proxy_header(
       std::string_view name, std::string_view value,
       EmptyHeaderAction empty_header_action = EmptyHeaderAction::kSend,
@@ -517,6 +524,7 @@ class easy final : public std::enable_shared_from_this<easy> {
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_fresh_connect,
                                 native::CURLOPT_FRESH_CONNECT);
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_forbot_reuse, native::CURLOPT_FORBID_REUSE);
+  IMPLEMENT_CURL_OPTION_BOOLEAN(set_pipewait, native::CURLOPT_PIPEWAIT);
   IMPLEMENT_CURL_OPTION(set_connect_timeout, native::CURLOPT_CONNECTTIMEOUT,
                         long);
   IMPLEMENT_CURL_OPTION(set_connect_timeout_ms,
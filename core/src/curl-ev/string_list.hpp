@@ -47,6 +47,11 @@ class string_list {
     return std::nullopt;
   }
 
+  template <typename Func>
+  void ForEach(const Func& func) const {
+    for (const auto& list_elem : list_elements_) func(list_elem.value);
+  }
+
   template <typename Pred>
   bool ReplaceFirstIf(const Pred& pred, std::string&& new_value) {
     for (auto& list_elem : list_elements_) {
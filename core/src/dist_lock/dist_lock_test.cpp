@@ -75,6 +75,26 @@ class MockDistLockStrategy final : public dist_lock::DistLockStrategyBase {
 
 auto MakeMockStrategy() { return std::make_shared<MockDistLockStrategy>(); }
 
+class FencingDistLockStrategy final : public dist_lock::DistLockStrategyBase {
+ public:
+  void Acquire(std::chrono::milliseconds lock_ttl,
+               const std::string& locker_id) override {
+    AcquireWithFencingToken(lock_ttl, locker_id);
+  }
+
+  std::optional<dist_lock::FencingToken> AcquireWithFencingToken(
+      std::chrono::milliseconds, const std::string&) override {
+    return ++last_token_;
+  }
+
+  void Release(const std::string&) override {}
+
+  dist_lock::FencingToken GetLastToken() const { return last_token_; }
+
+ private:
+  std::atomic<dist_lock::FencingToken> last_token_{0};
+};
+
 class DistLockWorkload {
  public:
   explicit DistLockWorkload(bool abort_on_cancel = false)
@@ -154,8 +174,32 @@ UTEST_MT(LockedWorker, StartStop, 3) {
 
   strategy->Allow(true);
   EXPECT_TRUE(work.WaitForLocked(true, utest::kMaxTestWaitTime));
+  EXPECT_FALSE(locked_worker.GetFencingToken());
+
+  locked_worker.Stop();
+}
+
+UTEST_MT(LockedWorker, FencingToken, 3) {
+  auto strategy = std::make_shared<FencingDistLockStrategy>();
+  DistLockWorkload work;
+  dist_lock::DistLockedWorker locked_worker(
+      kWorkerName, [&] { work.Work(); }, strategy, MakeSettings());
+  EXPECT_FALSE(locked_worker.GetFencingToken());
+
+  locked_worker.Start();
+  EXPECT_TRUE(work.WaitForLocked(true, utest::kMaxTestWaitTime));
+  const auto first_token = locked_worker.GetFencingToken();
+  ASSERT_TRUE(first_token);
+  EXPECT_LE(*first_token, strategy->GetLastToken());
+
+  // every prolongation returns a new token
+  engine::SleepFor(kAttemptTimeout);
+  const auto token = locked_worker.GetFencingToken();
+  ASSERT_TRUE(token);
+  EXPECT_LT(*first_token, *token);
 
   locked_worker.Stop();
+  EXPECT_FALSE(locked_worker.GetFencingToken());
 }
 
 UTEST_MT(LockedWorker, Watchdog, 3) {
@@ -55,6 +55,10 @@ DistLockedTask::GetLockedDuration() const {
   return locker_ptr_->GetLockedDuration();
 }
 
+std::optional<FencingToken> DistLockedTask::GetFencingToken() const {
+  return locker_ptr_->GetFencingToken();
+}
+
 void DistLockedTask::Get() noexcept(false) {
   UINVARIANT(IsValid(),
              "DistLockedTask::Get was called on an invalid task. Note that "
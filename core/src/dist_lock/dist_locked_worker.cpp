@@ -86,6 +86,10 @@ DistLockedWorker::GetLockedDuration() const {
   return locker_ptr_->GetLockedDuration();
 }
 
+std::optional<FencingToken> DistLockedWorker::GetFencingToken() const {
+  return locker_ptr_->GetFencingToken();
+}
+
 const Statistics& DistLockedWorker::GetStatistics() const {
   return locker_ptr_->GetStatistics();
 }
@@ -1,6 +1,7 @@
 #include <dist_lock/impl/locker.hpp>
 
 #include <atomic>
+#include <limits>
 #include <stdexcept>
 
 #include <fmt/compile.h>
@@ -28,6 +29,9 @@ class WorkerFuncFailedException : public std::runtime_error {
   using std::runtime_error::runtime_error;
 };
 
+constexpr FencingToken kNoFencingToken =
+    std::numeric_limits<FencingToken>::min();
+
 std::string MakeLockerId(const std::string& name) {
   static std::atomic<uint32_t> idx = utils::Rand();
   return fmt::format(FMT_COMPILE("{}-{:x}"), name, idx++);
@@ -63,7 +67,8 @@ Locker::Locker(std::string name, std::shared_ptr<DistLockStrategyBase> strategy,
       strategy_(std::move(strategy)),
       worker_func_(std::move(worker_func)),
       settings_(settings),
-      retry_mode_(retry_mode) {
+      retry_mode_(retry_mode),
+      fencing_token_(kNoFencingToken) {
   UASSERT(strategy_);
 }
 
@@ -88,6 +93,13 @@ std::optional<std::chrono::steady_clock::duration> Locker::GetLockedDuration()
          lock_acquire_since_epoch_.load();
 }
 
+std::optional<FencingToken> Locker::GetFencingToken() const {
+  if (!is_locked_) return {};
+  const auto fencing_token = fencing_token_.load();
+  if (fencing_token == kNoFencingToken) return {};
+  return fencing_token;
+}
+
 const Statistics& Locker::GetStatistics() const { return stats_; }
 
 void Locker::Run(LockerMode mode, dist_lock::DistLockWaitingMode waiting_mode,
@@ -103,7 +115,9 @@ void Locker::Run(LockerMode mode, dist_lock::DistLockWaitingMode waiting_mode,
     const auto attempt_start = utils::datetime::SteadyNow();
 
     try {
-      strategy_->Acquire(settings.lock_ttl, Id());
+      const auto fencing_token =
+          strategy_->AcquireWithFencingToken(settings.lock_ttl, Id());
+      fencing_token_ = fencing_token.value_or(kNoFencingToken);
       stats_.lock_successes++;
       if (!ExchangeLockState(true, attempt_start)) {
         LOG_DEBUG() << "Starting watchdog task";
@@ -35,6 +35,8 @@ class Locker final {
 
   std::optional<std::chrono::steady_clock::duration> GetLockedDuration() const;
 
+  std::optional<FencingToken> GetFencingToken() const;
+
   const Statistics& GetStatistics() const;
 
   engine::TaskWithResult<void> RunAsync(engine::TaskProcessor& task_processor,
@@ -63,6 +65,8 @@ class Locker final {
   std::atomic<bool> is_locked_{false};
   std::atomic<std::chrono::steady_clock::duration> lock_refresh_since_epoch_{};
   std::atomic<std::chrono::steady_clock::duration> lock_acquire_since_epoch_{};
+  // kNoFencingToken if the strategy returns none
+  std::atomic<FencingToken> fencing_token_;
 
   Statistics stats_;
 };
@@ -5,6 +5,7 @@
 #include <boost/endian/conversion.hpp>
 #include <boost/uuid/uuid.hpp>
 
+#include <userver/formats/json/compact_value.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -152,6 +153,16 @@ formats::json::Value Read(Reader& reader, To<formats::json::Value>) {
   return formats::json::FromString(string);
 }
 
+void Write(Writer& writer, const formats::json::CompactValue& value) {
+  writer.Write(formats::json::ToString(value));
+}
+
+formats::json::CompactValue Read(Reader& reader,
+                                 To<formats::json::CompactValue>) {
+  const auto string = ReadStringViewUnsafe(reader);
+  return formats::json::CompactValue::FromString(string);
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
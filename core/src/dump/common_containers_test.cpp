@@ -1,6 +1,7 @@
 #include <userver/dump/common_containers.hpp>
 
 #include <atomic>
+#include <string>
 
 #include <boost/bimap.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -9,6 +10,7 @@
 
 #include <userver/dump/test_helpers.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/blocked_bloom_filter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -218,4 +220,21 @@ TEST(DumpCommonContainers, MultiIndexWithoutReserve) {
   TestWriteReadCycle(dummies);
 }
 
+TEST(DumpCommonContainers, BlockedBloomFilter) {
+  utils::BlockedBloomFilter<std::string> before(16);
+  before.Insert("foo");
+  before.Insert("bar");
+
+  const auto after = FromBinary<decltype(before)>(ToBinary(before));
+  EXPECT_TRUE(after.Has("foo"));
+  EXPECT_TRUE(after.Has("bar"));
+  ASSERT_EQ(after.GetBlocks().size(), before.GetBlocks().size());
+  for (std::size_t i = 0; i < after.GetBlocks().size(); ++i) {
+    EXPECT_EQ(after.GetBlocks()[i].words, before.GetBlocks()[i].words);
+  }
+
+  UEXPECT_THROW_MSG(FromBinary<decltype(before)>(ToBinary(std::size_t{0})),
+                    dump::Error, "must have blocks");
+}
+
 USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <boost/uuid/random_generator.hpp>
 
 #include <userver/decimal64/decimal64.hpp>
+#include <userver/formats/json/compact_value.hpp>
 #include <userver/formats/json/inline.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/fs/blocking/write.hpp>
@@ -209,6 +210,17 @@ TEST(DumpCommon, JsonValue) {
   TestWriteReadCycle(formats::json::MakeObject("foo", 42, "bar", "baz"));
 }
 
+TEST(DumpCommon, JsonCompactValue) {
+  const auto json = formats::json::MakeObject("foo", 42, "bar", "baz");
+  const formats::json::CompactValue compact{json};
+
+  dump::MockReader reader(dump::ToBinary(compact));
+  const auto after_cycle = reader.Read<formats::json::CompactValue>();
+  reader.Finish();
+  EXPECT_EQ(formats::json::ToString(after_cycle),
+            formats::json::ToString(compact));
+}
+
 TEST(DumpCommon, ReadEntire) {
   for (int pre_read = 0; pre_read <= 1; ++pre_read) {
     for (int exp_size = 0; exp_size < 25; ++exp_size) {
@@ -574,6 +574,19 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            mmap:
+                type: boolean
+                description: Whether to read the dumps by mapping them into memory, not supported for the encrypted dumps
+                defaultDescription: false
+            compressed:
+                type: boolean
+                description: Whether to compress the dump by chunks with zlib, not supported for the encrypted dumps and mmap
+                defaultDescription: false
+            compression-tasks:
+                type: integer
+                description: Number of tasks that compress or decompress the chunks of a compressed dump concurrently with the serialization
+                defaultDescription: 2
+                minimum: 1
 )");
 }
 
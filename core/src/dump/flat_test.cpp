@@ -0,0 +1,64 @@
+#include <userver/dump/flat.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Point {
+  std::int32_t x;
+  std::int32_t y;
+  double weight;
+};
+
+bool operator==(const Point& lhs, const Point& rhs) {
+  return lhs.x == rhs.x && lhs.y == rhs.y && lhs.weight == rhs.weight;
+}
+
+}  // namespace
+
+template <>
+struct dump::IsDumpedFlat<Point>;
+
+TEST(DumpFlat, Single) {
+  dump::TestWriteReadCycle(Point{1, -2, 0.5});
+  EXPECT_EQ(dump::ToBinary(Point{1, 2, 3}).size(), sizeof(Point));
+}
+
+TEST(DumpFlat, Vector) {
+  dump::TestWriteReadCycle(std::vector<Point>{});
+
+  std::vector<Point> points;
+  for (std::int32_t i = 0; i < 1000; ++i) points.push_back({i, -i, i * 0.5});
+  dump::TestWriteReadCycle(points);
+
+  // one byte for the size and no per-element overhead
+  EXPECT_EQ(dump::ToBinary(std::vector<Point>(100)).size(),
+            1 + 100 * sizeof(Point));
+}
+
+TEST(DumpFlat, VectorLargerThanChunk) {
+  const std::vector<Point> points(dump::impl::kFlatReadChunkSize / 7,
+                                  Point{1, 2, 3});
+  dump::TestWriteReadCycle(points);
+}
+
+TEST(DumpFlat, Nested) {
+  dump::TestWriteReadCycle(std::vector<std::vector<Point>>{
+      {}, {Point{1, 2, 3}}, {Point{4, 5, 6}, Point{7, 8, 9}}});
+}
+
+TEST(DumpFlat, Truncated) {
+  auto binary = dump::ToBinary(std::vector<Point>(10));
+  binary.pop_back();
+  EXPECT_THROW(dump::FromBinary<std::vector<Point>>(binary), dump::Error);
+}
+
+USERVER_NAMESPACE_END
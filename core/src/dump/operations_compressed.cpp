@@ -0,0 +1,262 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+// The file starts with kMagic, followed by the frames. A frame is a header of
+// 3 little-endian uint32: the size of the chunk, the size of the compressed
+// chunk and the CRC-32 of the chunk, followed by the compressed chunk.
+constexpr std::string_view kMagic = "udumpz1\n";
+constexpr std::size_t kChunkSize = 1 << 20;
+constexpr std::size_t kFrameHeaderSize = 3 * sizeof(std::uint32_t);
+
+void StoreUint32(char* dest, std::uint32_t value) {
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    dest[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+  }
+}
+
+std::uint32_t LoadUint32(const char* src) {
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    value |= std::uint32_t{static_cast<unsigned char>(src[i])} << (i * 8);
+  }
+  return value;
+}
+
+std::uint32_t Checksum(std::string_view data) {
+  return crc32(crc32(0L, Z_NULL, 0),
+               reinterpret_cast<const Bytef*>(data.data()), data.size());
+}
+
+std::string CompressFrame(std::string_view chunk) {
+  const auto bound = compressBound(chunk.size());
+  std::string frame(kFrameHeaderSize + bound, '\0');
+
+  uLongf compressed_size = bound;
+  const auto ret =
+      compress2(reinterpret_cast<Bytef*>(frame.data() + kFrameHeaderSize),
+                &compressed_size, reinterpret_cast<const Bytef*>(chunk.data()),
+                chunk.size(), Z_BEST_SPEED);
+  if (ret != Z_OK) {
+    throw Error(fmt::format("Failed to compress a dump chunk: zlib error {}",
+                            ret));
+  }
+
+  frame.resize(kFrameHeaderSize + compressed_size);
+  StoreUint32(frame.data(), chunk.size());
+  StoreUint32(frame.data() + 4, compressed_size);
+  StoreUint32(frame.data() + 8, Checksum(chunk));
+  return frame;
+}
+
+std::string DecompressFrame(std::string_view compressed, std::size_t size,
+                            std::uint32_t checksum) {
+  std::string chunk(size, '\0');
+
+  uLongf decompressed_size = size;
+  const auto ret = uncompress(
+      reinterpret_cast<Bytef*>(chunk.data()), &decompressed_size,
+      reinterpret_cast<const Bytef*>(compressed.data()), compressed.size());
+  if (ret != Z_OK || decompressed_size != size) {
+    throw Error(fmt::format(
+        "Failed to decompress a dump chunk: zlib error {}, size={}, "
+        "expected-size={}",
+        ret, decompressed_size, size));
+  }
+  if (Checksum(chunk) != checksum) {
+    throw Error("Checksum mismatch in a dump chunk");
+  }
+  return chunk;
+}
+
+}  // namespace
+
+struct CompressedWriter::Impl {
+  Impl(std::string path, boost::filesystem::perms perms,
+       tracing::ScopeTime& scope, std::size_t tasks_count)
+      : file(std::move(path), perms, scope),
+        tasks_count(std::max<std::size_t>(tasks_count, 1)) {
+    WriteStringViewUnsafe(file, kMagic);
+    chunk.reserve(kChunkSize);
+  }
+
+  void Write(std::string_view data) {
+    while (!data.empty()) {
+      const auto size = std::min(data.size(), kChunkSize - chunk.size());
+      chunk.append(data.data(), size);
+      data.remove_prefix(size);
+      if (chunk.size() == kChunkSize) StartCompression();
+    }
+  }
+
+  void StartCompression() {
+    if (in_flight.size() >= tasks_count) WriteFrame();
+    in_flight.push_back(
+        utils::Async("dump-compress", [chunk = std::move(chunk)] {
+          return CompressFrame(chunk);
+        }));
+    chunk = std::string{};
+    chunk.reserve(kChunkSize);
+  }
+
+  // The frames are written in the order of the chunks
+  void WriteFrame() {
+    const auto frame = in_flight.front().Get();
+    in_flight.pop_front();
+    WriteStringViewUnsafe(file, frame);
+  }
+
+  void Finish() {
+    if (!chunk.empty()) StartCompression();
+    while (!in_flight.empty()) WriteFrame();
+    file.Finish();
+  }
+
+  FileWriter file;
+  const std::size_t tasks_count;
+  std::string chunk;
+  std::deque<engine::TaskWithResult<std::string>> in_flight;
+};
+
+CompressedWriter::CompressedWriter(std::string path,
+                                   boost::filesystem::perms perms,
+                                   tracing::ScopeTime& scope,
+                                   std::size_t tasks_count)
+    : impl_(std::make_unique<Impl>(std::move(path), perms, scope,
+                                   tasks_count)) {}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) { impl_->Write(data); }
+
+void CompressedWriter::Finish() { impl_->Finish(); }
+
+struct CompressedReader::Impl {
+  Impl(std::string path, std::size_t tasks_count) : file(path) {
+    if (ReadUnsafeAtMost(file, kMagic.size()) != kMagic) {
+      throw Error(
+          fmt::format("The file \"{}\" is not a compressed dump", path));
+    }
+
+    // read ahead
+    for (std::size_t i = 0; i < std::max<std::size_t>(tasks_count, 1); ++i) {
+      if (!StartDecompression()) break;
+    }
+  }
+
+  bool StartDecompression() {
+    const auto header = ReadUnsafeAtMost(file, kFrameHeaderSize);
+    if (header.empty()) return false;
+    if (header.size() != kFrameHeaderSize) {
+      throw Error("Unexpected end-of-file in a dump chunk header");
+    }
+
+    const std::size_t size = LoadUint32(header.data());
+    const std::size_t compressed_size = LoadUint32(header.data() + 4);
+    const auto checksum = LoadUint32(header.data() + 8);
+    if (size > kChunkSize) {
+      throw Error(fmt::format("Broken dump chunk header: size={}", size));
+    }
+    // checked before the compressed chunk is read into memory
+    if (compressed_size > compressBound(kChunkSize)) {
+      throw Error(fmt::format("Broken dump chunk header: compressed_size={}",
+                              compressed_size));
+    }
+
+    in_flight.push_back(utils::Async(
+        "dump-decompress",
+        [compressed = std::string{ReadStringViewUnsafe(file, compressed_size)},
+         size, checksum] {
+          return DecompressFrame(compressed, size, checksum);
+        }));
+    return true;
+  }
+
+  bool NextChunk() {
+    if (in_flight.empty()) return false;
+    chunk = in_flight.front().Get();
+    in_flight.pop_front();
+    position = 0;
+    StartDecompression();
+    return true;
+  }
+
+  std::string_view Read(std::size_t max_size) {
+    if (position == chunk.size()) NextChunk();
+    if (chunk.size() - position >= max_size) {
+      const std::string_view result{chunk.data() + position, max_size};
+      position += max_size;
+      return result;
+    }
+
+    // the data spans multiple chunks
+    buffer.assign(chunk, position);
+    position = chunk.size();
+    while (buffer.size() < max_size && NextChunk()) {
+      position = std::min(max_size - buffer.size(), chunk.size());
+      buffer.append(chunk, 0, position);
+    }
+    return buffer;
+  }
+
+  void Finish() {
+    if (position != chunk.size() || !in_flight.empty()) {
+      throw Error("Unexpected extra data at the end of the compressed dump");
+    }
+    file.Finish();
+  }
+
+  FileReader file;
+  std::deque<engine::TaskWithResult<std::string>> in_flight;
+  std::string chunk;
+  std::size_t position{0};
+  std::string buffer;
+};
+
+CompressedReader::CompressedReader(std::string path, std::size_t tasks_count)
+    : impl_(std::make_unique<Impl>(std::move(path), tasks_count)) {}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  return impl_->Read(max_size);
+}
+
+void CompressedReader::Finish() { impl_->Finish(); }
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    boost::filesystem::perms perms, std::size_t tasks_count)
+    : perms_(perms), tasks_count_(tasks_count) {}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(std::move(full_path),
+                                            tasks_count_);
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(std::move(full_path), perms_,
+                                            scope, tasks_count_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_compressed.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::int64_t kValuesCount = 1 << 22;
+constexpr auto kPerms = boost::filesystem::perms::owner_read;
+
+// Something like a cache with integer ids and short strings
+void WriteSample(dump::Writer& writer) {
+  for (std::int64_t i = 0; i < kValuesCount; ++i) {
+    writer.Write(i * 7919);
+    writer.Write(std::to_string(i));
+  }
+  writer.Finish();
+}
+
+std::size_t ReadSample(dump::Reader& reader) {
+  std::size_t total_size = 0;
+  for (std::int64_t i = 0; i < kValuesCount; ++i) {
+    benchmark::DoNotOptimize(reader.Read<std::int64_t>());
+    total_size += reader.Read<std::string>().size();
+  }
+  reader.Finish();
+  return total_size;
+}
+
+std::unique_ptr<dump::OperationsFactory> MakeFactory(std::size_t tasks_count) {
+  if (tasks_count == 0) {
+    return std::make_unique<dump::FileOperationsFactory>(kPerms);
+  }
+  return std::make_unique<dump::CompressedOperationsFactory>(kPerms,
+                                                             tasks_count);
+}
+
+// Counts the bytes of the serialized data, not of the file
+class SizeCounter final : public dump::Writer {
+ public:
+  void Finish() override {}
+
+  std::int64_t GetSize() const { return size_; }
+
+ private:
+  void WriteRaw(std::string_view data) override { size_ += data.size(); }
+
+  std::int64_t size_{0};
+};
+
+std::int64_t SerializedSize() {
+  SizeCounter counter;
+  WriteSample(counter);
+  return counter.GetSize();
+}
+
+}  // namespace
+
+// range(0) is the number of compression tasks, 0 for an uncompressed dump
+void dump_write(benchmark::State& state) {
+  const auto tasks_count = static_cast<std::size_t>(state.range(0));
+  engine::RunStandalone(tasks_count + 1, [&] {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/dump";
+    const auto factory = MakeFactory(tasks_count);
+    tracing::Span span("dump_write");
+
+    for (auto _ : state) {
+      auto scope = span.CreateScopeTime("write");
+      WriteSample(*factory->CreateWriter(path, scope));
+
+      state.PauseTiming();
+      fs::blocking::RemoveSingleFile(path);
+      state.ResumeTiming();
+    }
+  });
+  state.SetBytesProcessed(state.iterations() * SerializedSize());
+}
+BENCHMARK(dump_write)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+void dump_read(benchmark::State& state) {
+  const auto tasks_count = static_cast<std::size_t>(state.range(0));
+  engine::RunStandalone(tasks_count + 1, [&] {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/dump";
+    const auto factory = MakeFactory(tasks_count);
+    tracing::Span span("dump_read");
+    {
+      auto scope = span.CreateScopeTime("write");
+      WriteSample(*factory->CreateWriter(path, scope));
+    }
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(ReadSample(*factory->CreateReader(path)));
+    }
+  });
+  state.SetBytesProcessed(state.iterations() * SerializedSize());
+}
+BENCHMARK(dump_read)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+USERVER_NAMESPACE_END
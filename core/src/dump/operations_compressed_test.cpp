@@ -0,0 +1,137 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <string>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kTasksCount = 3;
+constexpr auto kPerms = boost::filesystem::perms::owner_read;
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) {
+  return dir.GetPath() + "/dump";
+}
+
+// a few chunks of compressible data
+std::string MakeLargeString() {
+  std::string result;
+  for (int i = 0; result.size() < 3'500'000; ++i) result += std::to_string(i);
+  return result;
+}
+
+void WriteSample(const std::string& path) {
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(path, kPerms, scope_time, kTasksCount);
+  writer.Write(std::string{"first"});
+  writer.Write(MakeLargeString());
+  for (int i = 0; i < 100'000; ++i) writer.Write(i);
+  writer.Write(std::string{"last"});
+  writer.Finish();
+}
+
+void ReadSample(const std::string& path) {
+  dump::CompressedReader reader(path, kTasksCount);
+  EXPECT_EQ(reader.Read<std::string>(), "first");
+  EXPECT_EQ(reader.Read<std::string>(), MakeLargeString());
+  for (int i = 0; i < 100'000; ++i) ASSERT_EQ(reader.Read<int>(), i);
+  EXPECT_EQ(reader.Read<std::string>(), "last");
+  reader.Finish();
+}
+
+}  // namespace
+
+UTEST(DumpOperationsCompressed, WriteRead) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  WriteSample(path);
+  EXPECT_LT(fs::blocking::ReadFileContents(path).size(), 3'500'000);
+  ReadSample(path);
+}
+
+UTEST(DumpOperationsCompressed, EmptyDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(path, kPerms, scope_time, kTasksCount);
+  writer.Finish();
+
+  dump::CompressedReader reader(path, kTasksCount);
+  reader.Finish();
+}
+
+UTEST(DumpOperationsCompressed, Underread) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteSample(path);
+
+  dump::CompressedReader reader(path, kTasksCount);
+  EXPECT_EQ(reader.Read<std::string>(), "first");
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Corrupted) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteSample(path);
+
+  auto contents = fs::blocking::ReadFileContents(path);
+  contents[contents.size() / 2] ^= 1;
+  fs::blocking::Chmod(path, boost::filesystem::perms::owner_all);
+  fs::blocking::RewriteFileContents(path, contents);
+
+  UEXPECT_THROW(ReadSample(path), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Truncated) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteSample(path);
+
+  auto contents = fs::blocking::ReadFileContents(path);
+  contents.resize(contents.size() - 10);
+  fs::blocking::Chmod(path, boost::filesystem::perms::owner_all);
+  fs::blocking::RewriteFileContents(path, contents);
+
+  UEXPECT_THROW(ReadSample(path), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, HugeCompressedSize) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteSample(path);
+
+  // the compressed size of the first frame follows the magic and the size
+  constexpr std::size_t kCompressedSizeOffset = 8 + 4;
+  auto contents = fs::blocking::ReadFileContents(path);
+  contents.replace(kCompressedSizeOffset, 4, "\xFF\xFF\xFF\xFF");
+  fs::blocking::Chmod(path, boost::filesystem::perms::owner_all);
+  fs::blocking::RewriteFileContents(path, contents);
+
+  UEXPECT_THROW_MSG(dump::CompressedReader(path, kTasksCount), dump::Error,
+                    "compressed_size");
+}
+
+UTEST(DumpOperationsCompressed, NotCompressed) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, kPerms, scope_time);
+  writer.Write(std::string{"uncompressed dump"});
+  writer.Finish();
+
+  UEXPECT_THROW(dump::CompressedReader(path, kTasksCount), dump::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 
 #include <fmt/format.h>
 
+#include <userver/dump/operations_mmap.hpp>
 #include <userver/fs/blocking/write.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -115,11 +116,13 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms,
+                                             bool use_mmap)
+    : perms_(perms), use_mmap_(use_mmap) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
+  if (use_mmap_) return std::make_unique<MmapFileReader>(std::move(full_path));
   return std::make_unique<FileReader>(std::move(full_path));
 }
 
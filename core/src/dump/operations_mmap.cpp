@@ -0,0 +1,67 @@
+#include <userver/dump/operations_mmap.hpp>
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/logging/log.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    auto fd = fs::blocking::FileDescriptor::Open(
+        path_, fs::blocking::OpenFlag::kRead);
+    size_ = fd.GetSize();
+
+    // mmap of an empty file fails
+    if (size_ != 0) {
+      void* const data = utils::CheckSyscallNotEquals(
+          ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd.GetNative(), 0),
+          MAP_FAILED, "calling ::mmap");
+      data_ = static_cast<const char*>(data);
+      // only a hint, nothing to do on failure
+      ::madvise(data, size_, MADV_SEQUENTIAL);
+    }
+    // the mapping stays valid after the file is closed
+    std::move(fd).Close();
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+}
+
+MmapFileReader::~MmapFileReader() {
+  if (data_ != nullptr && ::munmap(const_cast<char*>(data_), size_) == -1) {
+    LOG_ERROR() << "Failed to unmap the dump file \"" << path_ << "\"";
+  }
+}
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+  const auto size = std::min(max_size, size_ - position_);
+  const std::string_view result{data_ + position_, size};
+  position_ += size;
+  return result;
+}
+
+void MmapFileReader::Finish() {
+  if (position_ != size_) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, size_, position_, size_ - position_));
+  }
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <userver/dump/operations_mmap.hpp>
+
+#include <boost/regex.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(DumpOperationsMmap, WriteRead) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(file.GetPath(), boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(std::string(100, 'a'));
+  writer.Write(std::uint64_t{42});
+  writer.Write(std::string{"b"});
+  writer.Finish();
+
+  dump::MmapFileReader reader(file.GetPath());
+  const auto first = ReadStringViewUnsafe(reader);
+  EXPECT_EQ(reader.Read<std::uint64_t>(), 42);
+  EXPECT_EQ(reader.Read<std::string>(), "b");
+  // the views stay valid until the reader is destroyed
+  EXPECT_EQ(first, std::string(100, 'a'));
+  reader.Finish();
+}
+
+TEST(DumpOperationsMmap, EmptyDump) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 0), "");
+  reader.Finish();
+}
+
+TEST(DumpOperationsMmap, Overread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_THROW(ReadStringViewUnsafe(reader, 11), dump::Error);
+}
+
+TEST(DumpOperationsMmap, Underread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  try {
+    reader.Finish();
+  } catch (const dump::Error& ex) {
+    EXPECT_TRUE(boost::regex_match(
+        ex.what(),
+        boost::regex{"Unexpected extra data at the end of the dump file "
+                     "\".+\": file-size=10, position=9, unread-size=1"}))
+        << ex.what();
+    return;
+  }
+  FAIL();
+}
+
+TEST(DumpOperationsMmap, MissingFile) {
+  EXPECT_THROW(dump::MmapFileReader("/non/existing/dump"), dump::Error);
+}
+
+USERVER_NAMESPACE_END
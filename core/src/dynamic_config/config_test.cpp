@@ -6,6 +6,7 @@
 #include <userver/dynamic_config/source.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -424,6 +425,42 @@ UTEST(DynamicConfigSubscription, Snippet) {
   EXPECT_EQ(subscriber.GetFooInterestingEventCounter(), 1);
 }
 
+int parsed_lazy_values = 0;
+
+int ParseLazyValue(const dynamic_config::DocsMap& docs_map) {
+  ++parsed_lazy_values;
+  return docs_map.Get("LAZY_VALUE").As<int>();
+}
+
+constexpr dynamic_config::Key<ParseLazyValue> kLazyValue;
+
+UTEST(DynamicConfig, LazyParsing) {
+  using dynamic_config::impl::ParseMode;
+  using dynamic_config::impl::SnapshotData;
+  parsed_lazy_values = 0;
+
+  // Other configs of the binary are missing in the docs, they are never read
+  dynamic_config::DocsMap docs_map;
+  docs_map.Parse(R"({"LAZY_VALUE": 1, "OTHER_VALUE": 2})", false);
+  const SnapshotData first(docs_map, {}, {}, ParseMode::kLazy);
+  EXPECT_EQ(parsed_lazy_values, 0);
+  EXPECT_EQ(first[kLazyValue], 1);
+  EXPECT_EQ(first[kLazyValue], 1);
+  EXPECT_EQ(parsed_lazy_values, 1);
+
+  // the unchanged config is shared with the previous snapshot
+  docs_map.Set("OTHER_VALUE", formats::json::ValueBuilder{3}.ExtractValue());
+  const SnapshotData second(docs_map, first, {"OTHER_VALUE"},
+                            ParseMode::kLazy);
+  EXPECT_EQ(&second[kLazyValue], &first[kLazyValue]);
+  EXPECT_EQ(parsed_lazy_values, 1);
+
+  docs_map.Set("LAZY_VALUE", formats::json::ValueBuilder{4}.ExtractValue());
+  const SnapshotData third(docs_map, second, {"LAZY_VALUE"}, ParseMode::kLazy);
+  EXPECT_EQ(third[kLazyValue], 4);
+  EXPECT_EQ(parsed_lazy_values, 2);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
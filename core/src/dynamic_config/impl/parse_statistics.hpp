@@ -0,0 +1,15 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+/// Writes the count and the total time of parsing per config key, only for
+/// the keys that have been parsed at least once
+void WriteParseStatistics(utils::statistics::Writer& writer);
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
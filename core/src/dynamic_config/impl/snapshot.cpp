@@ -1,35 +1,119 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
 #include <fmt/format.h>
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/enumerate.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/static_registration.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <dynamic_config/impl/parse_statistics.hpp>
+#include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config::impl {
 namespace {
 
-std::vector<impl::Factory>& Registry() {
-  static std::vector<impl::Factory> registry;
+struct RegisteredConfig final {
+  Factory factory;
+  std::type_index key_type;
+};
+
+struct ParseStatistics final {
+  utils::statistics::RelaxedCounter<std::uint64_t> count;
+  utils::statistics::RelaxedCounter<std::uint64_t> time_us;
+};
+
+std::vector<RegisteredConfig>& Registry() {
+  static std::vector<RegisteredConfig> registry;
   return registry;
 }
 
+std::vector<ParseStatistics>& GetParseStatistics() {
+  utils::impl::AssertStaticRegistrationFinished();
+  static std::vector<ParseStatistics> statistics(Registry().size());
+  return statistics;
+}
+
 }  // namespace
 
+// Lazily parsed configs of a snapshot share the docs, the parsing is
+// serialized because DocsMap is not thread-safe
+struct SnapshotData::LazyDocs final {
+  explicit LazyDocs(const DocsMap& docs_map) : docs_map(docs_map) {}
+
+  const DocsMap docs_map;
+  std::mutex mutex;
+};
+
+struct SnapshotData::ParsedConfig final {
+  std::atomic<bool> is_parsed{false};
+  std::any value;
+
+  // Names of the docs read by the factory, nullopt for the overrides
+  std::optional<std::vector<std::string>> doc_names;
+
+  // Set for the lazily parsed configs
+  std::shared_ptr<LazyDocs> lazy_docs;
+};
+
+void SnapshotData::ParseConfig(ConfigId id, const DocsMap& docs_map,
+                               ParsedConfig& config) {
+  std::vector<std::string> doc_names;
+  docs_map.SetRequestedNamesRecorder(&doc_names, utils::InternalTag{});
+  utils::FastScopeGuard stop_recording([&docs_map]() noexcept {
+    docs_map.SetRequestedNamesRecorder(nullptr, utils::InternalTag{});
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    config.value = Registry()[id].factory(docs_map);
+  } catch (const std::exception& ex) {
+    throw std::runtime_error(
+        fmt::format("While parsing dynamic config values: {} ({})", ex.what(),
+                    compiler::GetTypeName(typeid(ex))));
+  }
+
+  auto& statistics = GetParseStatistics()[id];
+  ++statistics.count;
+  statistics.time_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+
+  config.doc_names = std::move(doc_names);
+  config.is_parsed.store(true, std::memory_order_release);
+}
+
+void SnapshotData::ParseLazily(ConfigId id, ParsedConfig& config) {
+  UASSERT(config.lazy_docs);
+  std::lock_guard lock(config.lazy_docs->mutex);
+  if (config.is_parsed.load(std::memory_order_relaxed)) return;
+
+  ParseConfig(id, config.lazy_docs->docs_map, config);
+}
+
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
   throw std::logic_error(fmt::format("Error in Config::Get<{}>: {}",
                                      compiler::GetTypeName(type), ex.what()));
 }
 
-impl::ConfigId Register(impl::Factory factory) {
+impl::ConfigId Register(impl::Factory factory, std::type_index key_type) {
   utils::impl::AssertStaticRegistrationAllowed(
       "dynamic_config::Key registration");
   auto& registry = Registry();
-  registry.push_back(factory);
+  registry.push_back({factory, key_type});
   return registry.size() - 1;
 }
 
@@ -38,7 +122,10 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    auto config = std::make_shared<ParsedConfig>();
+    config->value = config_variable.GetValue();
+    config->is_parsed = true;
+    user_configs_[config_variable.GetId()] = std::move(config);
   }
 }
 
@@ -46,16 +133,12 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
                            const std::vector<KeyValue>& overrides)
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
-  for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+  for (const auto [id, config] : utils::enumerate(user_configs_)) {
+    if (!config) {
       relax.Relax(1);
-      try {
-        user_configs_[id] = factory(defaults);
-      } catch (const std::exception& ex) {
-        throw std::runtime_error(
-            fmt::format("While parsing dynamic config values: {} ({})",
-                        ex.what(), compiler::GetTypeName(typeid(ex))));
-      }
+      auto parsed = std::make_shared<ParsedConfig>();
+      ParseConfig(id, defaults, *parsed);
+      config = std::move(parsed);
     }
   }
 }
@@ -65,9 +148,48 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
     : SnapshotData(overrides) {
   if (defaults.IsEmpty()) return;
 
-  for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
-    user_configs_[id] = defaults.user_configs_[id];
+  for (const auto [id, config] : utils::enumerate(user_configs_)) {
+    if (config) continue;
+    config = defaults.user_configs_[id];
+  }
+}
+
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const SnapshotData& previous,
+                           const std::unordered_set<std::string>& changed_names,
+                           ParseMode mode)
+    : SnapshotData(std::vector<KeyValue>{}) {
+  UASSERT(previous.IsEmpty() ||
+          previous.user_configs_.size() == user_configs_.size());
+
+  const auto lazy_docs = mode == ParseMode::kLazy
+                             ? std::make_shared<LazyDocs>(docs_map)
+                             : nullptr;
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (const auto [id, config] : utils::enumerate(user_configs_)) {
+    const auto& previous_config =
+        previous.IsEmpty() ? nullptr : previous.user_configs_[id];
+    if (previous_config &&
+        previous_config->is_parsed.load(std::memory_order_acquire) &&
+        previous_config->doc_names &&
+        std::none_of(previous_config->doc_names->begin(),
+                     previous_config->doc_names->end(),
+                     [&changed_names](const std::string& name) {
+                       return changed_names.count(name) != 0;
+                     })) {
+      config = previous_config;
+      continue;
+    }
+
+    auto parsed = std::make_shared<ParsedConfig>();
+    if (lazy_docs) {
+      parsed->lazy_docs = lazy_docs;
+    } else {
+      relax.Relax(1);
+      ParseConfig(id, docs_map, *parsed);
+    }
+    config = std::move(parsed);
   }
 }
 
@@ -76,10 +198,26 @@ bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 const std::any& SnapshotData::Get(impl::ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  if (!config->is_parsed.load(std::memory_order_acquire)) {
+    ParseLazily(id, *config);
+  }
+  return config->value;
+}
+
+void WriteParseStatistics(utils::statistics::Writer& writer) {
+  const auto& registry = Registry();
+  for (const auto [id, statistics] : utils::enumerate(GetParseStatistics())) {
+    const auto count = statistics.count.Load();
+    if (count == 0) continue;
+
+    const auto key = compiler::GetTypeName(registry[id].key_type);
+    const utils::statistics::LabelView label{"config_key", key};
+    writer["count"].ValueWithLabels(count, label);
+    writer["time-us"].ValueWithLabels(statistics.time_us.Load(), label);
+  }
 }
 
 }  // namespace dynamic_config::impl
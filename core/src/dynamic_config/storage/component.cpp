@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <optional>
 #include <string>
 #include <unordered_set>
 
@@ -9,6 +10,7 @@
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/updates_sink/find.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -17,8 +19,11 @@
 #include <userver/fs/write.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <dynamic_config/impl/parse_statistics.hpp>
 #include <dynamic_config/storage_data.hpp>
 #include <utils/internal_tag.hpp>
 
@@ -34,6 +39,7 @@ constexpr std::chrono::seconds kWaitInterval(5);
 class DynamicConfig::Impl final {
  public:
   Impl(const ComponentConfig&, const ComponentContext&);
+  ~Impl();
 
   dynamic_config::Source GetSource();
   auto& GetChannel() { return cache_.GetChannel(); }
@@ -56,14 +62,21 @@ class DynamicConfig::Impl final {
 
   dynamic_config::impl::StorageData cache_;
 
+  // The last value set, unchanged configs are not parsed again
+  engine::Mutex set_config_mutex_;
+  std::optional<dynamic_config::DocsMap> docs_map_;
+
   const std::string fs_cache_path_;
   engine::TaskProcessor* fs_task_processor_;
   std::string fs_loading_error_msg_;
+  const dynamic_config::impl::ParseMode parse_mode_;
 
   std::atomic<bool> is_loaded_{false};
   mutable engine::Mutex loaded_mutex_;
   mutable engine::ConditionVariable loaded_cv_;
   bool config_load_cancelled_{false};
+
+  utils::statistics::Entry statistics_holder_;
 };
 
 DynamicConfig::Impl::Impl(const ComponentConfig& config,
@@ -73,14 +86,28 @@ DynamicConfig::Impl::Impl(const ComponentConfig& config,
           fs_cache_path_.empty()
               ? nullptr
               : &context.GetTaskProcessor(
-                    config["fs-task-processor"].As<std::string>())) {
+                    config["fs-task-processor"].As<std::string>())),
+      parse_mode_(config["lazy-parsing"].As<bool>(false)
+                      ? dynamic_config::impl::ParseMode::kLazy
+                      : dynamic_config::impl::ParseMode::kEager) {
   UINVARIANT(dynamic_config::impl::has_updater,
              fmt::format("At least one dynamic config updater component "
                          "responsible for DynamicConfig initialization should "
                          "be defined in a static config!"));
+  // Eagerly parsed configs are all parsed on each update, the per-key
+  // metrics are of little use and are too many for them
+  if (parse_mode_ == dynamic_config::impl::ParseMode::kLazy) {
+    statistics_holder_ =
+        context.FindComponent<components::StatisticsStorage>()
+            .GetStorage()
+            .RegisterWriter("dynamic-config.parse",
+                            &dynamic_config::impl::WriteParseStatistics);
+  }
   ReadFsCache();
 }
 
+DynamicConfig::Impl::~Impl() { statistics_holder_.Unregister(); }
+
 dynamic_config::Source DynamicConfig::Impl::GetSource() {
   WaitUntilLoaded();
   return dynamic_config::Source{cache_};
@@ -125,12 +152,26 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
-  dynamic_config::impl::SnapshotData config(value, {});
-
-  if (!value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
-    LOG_INFO() << "Some configs expected to be used are actually not needed: "
-               << value.GetConfigsExpectedToBeUsed(utils::InternalTag{});
+  std::lock_guard set_config_lock(set_config_mutex_);
+
+  std::optional<dynamic_config::impl::SnapshotData> config;
+  if (docs_map_) {
+    const auto changed_names = docs_map_->GetChangedNames(value);
+    LOG_DEBUG() << "Parsing dynamic config values that changed: "
+                << changed_names;
+    const auto previous = cache_.Read();
+    config.emplace(value, *previous, changed_names, parse_mode_);
+  } else {
+    config.emplace(value, dynamic_config::impl::SnapshotData{},
+                   std::unordered_set<std::string>{}, parse_mode_);
+
+    if (parse_mode_ == dynamic_config::impl::ParseMode::kEager &&
+        !value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
+      LOG_INFO() << "Some configs expected to be used are actually not needed: "
+                 << value.GetConfigsExpectedToBeUsed(utils::InternalTag{});
+    }
   }
+  docs_map_ = value;
 
   auto after_assign_hook = [&] {
     {
@@ -139,7 +180,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
     }
     loaded_cv_.NotifyAll();
   };
-  cache_.Update(std::move(config), std::move(after_assign_hook));
+  cache_.Update(std::move(*config), std::move(after_assign_hook));
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater,
@@ -272,6 +313,10 @@ properties:
     fs-task-processor:
         type: string
         description: name of the task processor to run the blocking file write operations
+    lazy-parsing:
+        type: boolean
+        description: parse each config on the first access to it instead of parsing all the configs on each update
+        defaultDescription: false
 )");
 }
 
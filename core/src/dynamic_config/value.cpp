@@ -13,6 +13,7 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 
 formats::json::Value DocsMap::Get(std::string_view name) const {
+  RecordRequestedName(name);
   const auto it = utils::impl::FindTransparent(docs_, name);
   if (it == docs_.end()) {
     throw std::runtime_error(fmt::format("Can't find doc for '{}'", name));
@@ -28,6 +29,7 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
 }
 
 bool DocsMap::Has(std::string_view name) const {
+  RecordRequestedName(name);
   return utils::impl::FindTransparent(docs_, name) != docs_.end();
 }
 
@@ -84,6 +86,21 @@ bool DocsMap::AreContentsEqual(const DocsMap& other) const {
   return docs_ == other.docs_;
 }
 
+std::unordered_set<std::string> DocsMap::GetChangedNames(
+    const DocsMap& other) const {
+  std::unordered_set<std::string> names;
+  for (const auto& [name, value] : docs_) {
+    const auto other_it = other.docs_.find(name);
+    if (other_it == other.docs_.end() || other_it->second != value) {
+      names.insert(name);
+    }
+  }
+  for (const auto& [name, value] : other.docs_) {
+    if (docs_.find(name) == docs_.end()) names.insert(name);
+  }
+  return names;
+}
+
 void DocsMap::SetConfigsExpectedToBeUsed(
     utils::impl::TransparentSet<std::string> configs, utils::InternalTag) {
   configs_to_be_used_ = std::move(configs);
@@ -94,6 +111,15 @@ DocsMap::GetConfigsExpectedToBeUsed(utils::InternalTag) const {
   return configs_to_be_used_;
 }
 
+void DocsMap::SetRequestedNamesRecorder(std::vector<std::string>* names,
+                                        utils::InternalTag) const {
+  requested_names_.names = names;
+}
+
+void DocsMap::RecordRequestedName(std::string_view name) const {
+  if (requested_names_.names) requested_names_.names->emplace_back(name);
+}
+
 const std::string kValueDictDefaultName = "__default__";
 
 namespace impl {
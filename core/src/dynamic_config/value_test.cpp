@@ -90,6 +90,37 @@ TEST(DocsMap, Merge) {
   EXPECT_EQ(docs_map1.Get("d").As<std::string>(), "d");
 }
 
+TEST(DocsMap, GetChangedNames) {
+  dynamic_config::DocsMap docs_map1;
+  docs_map1.Parse(R"({"a": "a", "b": "b", "c": {"x": 1}})", false);
+  dynamic_config::DocsMap docs_map2;
+  docs_map2.Parse(R"({"a": "a", "b": "x", "c": {"x": 1}, "d": "d"})", false);
+
+  using Names = std::unordered_set<std::string>;
+  EXPECT_EQ(docs_map1.GetChangedNames(docs_map2), (Names{"b", "d"}));
+  EXPECT_EQ(docs_map2.GetChangedNames(docs_map1), (Names{"b", "d"}));
+  EXPECT_TRUE(docs_map1.GetChangedNames(docs_map1).empty());
+}
+
+TEST(DocsMap, RequestedNamesRecorder) {
+  dynamic_config::DocsMap docs_map;
+  docs_map.Parse(R"({"a": "a", "b": "b"})", false);
+
+  std::vector<std::string> names;
+  docs_map.SetRequestedNamesRecorder(&names, utils::InternalTag{});
+  (void)docs_map.Get("a");
+  EXPECT_FALSE(docs_map.Has("c"));
+
+  // copies do not record into the same vector
+  const dynamic_config::DocsMap docs_map_copy(docs_map);
+  (void)docs_map_copy.Get("b");
+
+  docs_map.SetRequestedNamesRecorder(nullptr, utils::InternalTag{});
+  (void)docs_map.Get("b");
+
+  EXPECT_EQ(names, (std::vector<std::string>{"a", "c"}));
+}
+
 TEST(ValueDict, UseAsRange) {
   using ValueDict = dynamic_config::ValueDict<int>;
 
@@ -3,6 +3,7 @@
 #include <algorithm>  // for std::max
 #include <atomic>
 #include <cerrno>
+#include <optional>
 #include <utility>
 
 #include <moodycamel/concurrentqueue.h>
@@ -14,6 +15,7 @@
 
 #include "pool_config.hpp"
 #include "pool_stats.hpp"
+#include "stack_usage.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,8 +38,15 @@ class Pool final {
   std::size_t GetStackSize() const;
 
  private:
-  Coroutine CreateCoroutine(bool quiet = false);
+  struct PooledCoroutine {
+    Coroutine coroutine;
+    StackArea stack;
+  };
+
+  PooledCoroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
+  std::optional<std::size_t> SampleStackUsage(StackArea stack) noexcept;
+  void ReleaseStack(StackArea stack) noexcept;
 
   template <typename Token>
   Token& GetToken();
@@ -45,17 +54,19 @@ class Pool final {
   const PoolConfig config_;
   const Executor executor_;
 
-  boost::coroutines2::protected_fixedsize_stack stack_allocator_;
-  moodycamel::ConcurrentQueue<Coroutine> coroutines_;
+  StackAllocator stack_allocator_;
+  moodycamel::ConcurrentQueue<PooledCoroutine> coroutines_;
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
+  std::atomic<std::size_t> released_stacks_num_{0};
+  std::atomic<std::size_t> released_stack_bytes_{0};
 };
 
 template <typename Task>
 class Pool<Task>::CoroutinePtr final {
  public:
-  CoroutinePtr(Coroutine&& coro, Pool<Task>& pool) noexcept
-      : coro_(std::move(coro)), pool_(&pool) {}
+  CoroutinePtr(PooledCoroutine&& coro, Pool<Task>& pool) noexcept
+      : coro_(std::move(coro.coroutine)), stack_(coro.stack), pool_(&pool) {}
 
   CoroutinePtr(CoroutinePtr&&) noexcept = default;
   CoroutinePtr& operator=(CoroutinePtr&&) noexcept = default;
@@ -75,8 +86,18 @@ class Pool<Task>::CoroutinePtr final {
     pool_->PutCoroutine(std::move(*this));
   }
 
+  /// Returns the stack high-water mark of the coroutine, bytes, for every
+  /// PoolConfig::stack_usage_sample_every-th call if the sampling is enabled
+  std::optional<std::size_t> SampleStackUsage() noexcept {
+    UASSERT(coro_);
+    return pool_->SampleStackUsage(stack_);
+  }
+
  private:
+  friend class Pool;
+
   Coroutine coro_;
+  StackArea stack_;
   Pool<Task>* pool_;
 };
 
@@ -84,7 +105,9 @@ template <typename Task>
 Pool<Task>::Pool(PoolConfig config, Executor executor)
     : config_(std::move(config)),
       executor_(executor),
-      stack_allocator_(config.stack_size),
+      stack_allocator_(config_.stack_size,
+                       config_.stack_usage_sample_every != 0,
+                       config_.huge_pages),
       coroutines_(config_.max_size),
       idle_coroutines_num_(config_.initial_size),
       total_coroutines_num_(0) {
@@ -93,6 +116,12 @@ Pool<Task>::Pool(PoolConfig config, Executor executor)
     bool ok = coroutines_.enqueue(token, CreateCoroutine(/*quiet =*/true));
     UINVARIANT(ok, "Failed to allocate the initial coro pool");
   }
+
+  if (config_.stack_release_idle_watermark != 0 &&
+      config_.stack_usage_sample_every != 0) {
+    LOG_WARNING() << "Coroutine stacks are not released to the OS, because "
+                     "the released pages would lose the stack usage canaries";
+  }
 }
 
 template <typename Task>
@@ -101,15 +130,15 @@ Pool<Task>::~Pool() = default;
 template <typename Task>
 typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
   struct CoroutineMover {
-    std::optional<Coroutine>& result;
+    std::optional<PooledCoroutine>& result;
 
-    CoroutineMover& operator=(Coroutine&& coro) {
+    CoroutineMover& operator=(PooledCoroutine&& coro) {
       result.emplace(std::move(coro));
       return *this;
     }
   };
 
-  std::optional<Coroutine> coroutine;
+  std::optional<PooledCoroutine> coroutine;
   CoroutineMover mover{coroutine};
   auto& token = GetToken<moodycamel::ConsumerToken>();
   if (coroutines_.try_dequeue(token, mover)) {
@@ -122,9 +151,19 @@ typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
 
 template <typename Task>
 void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
-  if (idle_coroutines_num_.load() >= config_.max_size) return;
+  const auto idle_coroutines = idle_coroutines_num_.load();
+  if (idle_coroutines >= config_.max_size) return;
+  if (config_.stack_release_idle_watermark != 0 &&
+      idle_coroutines >= config_.stack_release_idle_watermark) {
+    // Only the excess idle coroutines after a load peak get here, the ones
+    // that are reused at a steady load keep their stacks resident
+    ReleaseStack(coroutine_ptr.stack_);
+  }
+
   auto& token = GetToken<moodycamel::ProducerToken>();
-  const bool ok = coroutines_.enqueue(token, std::move(coroutine_ptr.Get()));
+  const bool ok = coroutines_.enqueue(
+      token, PooledCoroutine{std::move(coroutine_ptr.coro_),
+                             coroutine_ptr.stack_});
   if (ok) ++idle_coroutines_num_;
 }
 
@@ -135,19 +174,24 @@ PoolStats Pool<Task>::GetStats() const {
       total_coroutines_num_.load() - coroutines_.size_approx();
   stats.total_coroutines =
       std::max(total_coroutines_num_.load(), stats.active_coroutines);
+  stats.released_stacks = released_stacks_num_.load();
+  stats.released_stack_bytes = released_stack_bytes_.load();
   return stats;
 }
 
 template <typename Task>
-typename Pool<Task>::Coroutine Pool<Task>::CreateCoroutine(bool quiet) {
+typename Pool<Task>::PooledCoroutine Pool<Task>::CreateCoroutine(bool quiet) {
   try {
-    Coroutine coroutine(stack_allocator_, executor_);
+    // Coroutine keeps a copy of the allocator, a local one lets us find out
+    // the allocated stack without synchronization
+    auto stack_allocator = stack_allocator_;
+    Coroutine coroutine(stack_allocator, executor_);
     const auto new_total = ++total_coroutines_num_;
     if (!quiet) {
       LOG_DEBUG() << "Created a coroutine #" << new_total << '/'
                   << config_.max_size;
     }
-    return coroutine;
+    return {std::move(coroutine), stack_allocator.GetLastAllocatedArea()};
   } catch (const std::bad_alloc&) {
     if (errno == ENOMEM) {
       // It should be ok to allocate here (which LOG_ERROR might do),
@@ -170,6 +214,30 @@ void Pool<Task>::OnCoroutineDestruction() noexcept {
   --total_coroutines_num_;
 }
 
+template <typename Task>
+std::optional<std::size_t> Pool<Task>::SampleStackUsage(
+    StackArea stack) noexcept {
+  const auto sample_every = config_.stack_usage_sample_every;
+  if (sample_every == 0) return std::nullopt;
+
+  thread_local std::size_t returns_count = 0;
+  if (++returns_count % sample_every != 0) return std::nullopt;
+  return GetStackUsage(stack);
+}
+
+template <typename Task>
+void Pool<Task>::ReleaseStack(StackArea stack) noexcept {
+  if (config_.stack_usage_sample_every != 0) return;
+
+  const auto released_bytes = ReleaseStackTail(
+      stack, config_.stack_release_keep_size,
+      /*lazy=*/config_.stack_release_advice == StackReleaseAdvice::kFree);
+  if (released_bytes == 0) return;
+
+  ++released_stacks_num_;
+  released_stack_bytes_ += released_bytes;
+}
+
 template <typename Task>
 std::size_t Pool<Task>::GetStackSize() const {
   return config_.stack_size;
@@ -1,18 +1,101 @@
 #include "pool_config.hpp"
 
+#include <fmt/format.h>
+
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+constexpr utils::TrivialBiMap kStackSizeClassMap([](auto selector) {
+  return selector()
+      .Case(StackSizeClass::kSmall, "small")
+      .Case(StackSizeClass::kDefault, "default")
+      .Case(StackSizeClass::kLarge, "large");
+});
+
+constexpr utils::TrivialBiMap kStackReleaseAdviceMap([](auto selector) {
+  return selector()
+      .Case(StackReleaseAdvice::kFree, "free")
+      .Case(StackReleaseAdvice::kDontNeed, "dontneed");
+});
+
+}  // namespace
+
+StackSizeClass Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<StackSizeClass>) {
+  return utils::ParseFromValueString(value, kStackSizeClassMap);
+}
+
+std::string_view ToString(StackSizeClass stack_size_class) {
+  return utils::impl::EnumToStringView(stack_size_class, kStackSizeClassMap);
+}
+
+StackReleaseAdvice Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<StackReleaseAdvice>) {
+  return utils::ParseFromValueString(value, kStackReleaseAdviceMap);
+}
+
+StackSizeClassPoolConfig Parse(const yaml_config::YamlConfig& value,
+                               formats::parse::To<StackSizeClassPoolConfig>) {
+  StackSizeClassPoolConfig config;
+  config.initial_size =
+      value["initial_size"].As<size_t>(config.initial_size);
+  config.max_size = value["max_size"].As<size_t>(config.max_size);
+  config.stack_size = value["stack_size"].As<size_t>();
+  return config;
+}
+
 PoolConfig Parse(const yaml_config::YamlConfig& value,
                  formats::parse::To<PoolConfig>) {
   PoolConfig config;
   config.initial_size = value["initial_size"].As<size_t>();
   config.max_size = value["max_size"].As<size_t>();
   config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
+  config.stack_usage_sample_every =
+      value["stack_usage_sample_every"].As<size_t>(
+          config.stack_usage_sample_every);
+  config.huge_pages = value["huge_pages"].As<bool>(config.huge_pages);
+  config.stack_release_idle_watermark =
+      value["stack_release_idle_watermark"].As<size_t>(
+          config.stack_release_idle_watermark);
+  config.stack_release_keep_size = value["stack_release_keep_size"].As<size_t>(
+      config.stack_release_keep_size);
+  if (config.stack_release_keep_size < kMinStackReleaseKeepSize) {
+    throw yaml_config::ParseException(fmt::format(
+        "invalid coro_pool config: stack_release_keep_size ({}) is less than "
+        "{} bytes, the released stacks would lose the live frames of the idle "
+        "coroutines",
+        config.stack_release_keep_size, kMinStackReleaseKeepSize));
+  }
+  config.stack_release_advice =
+      value["stack_release_advice"].As<StackReleaseAdvice>(
+          config.stack_release_advice);
+  config.small_stacks =
+      value["small_stacks"].As<std::optional<StackSizeClassPoolConfig>>();
+  config.large_stacks =
+      value["large_stacks"].As<std::optional<StackSizeClassPoolConfig>>();
   return config;
 }
 
+PoolConfig MakePoolConfig(const PoolConfig& default_config,
+                          const StackSizeClassPoolConfig& config) {
+  PoolConfig result;
+  result.stack_usage_sample_every = default_config.stack_usage_sample_every;
+  result.huge_pages = default_config.huge_pages;
+  result.stack_release_idle_watermark =
+      default_config.stack_release_idle_watermark;
+  result.stack_release_keep_size = default_config.stack_release_keep_size;
+  result.stack_release_advice = default_config.stack_release_advice;
+  result.initial_size = config.initial_size;
+  result.max_size = config.max_size;
+  result.stack_size = config.stack_size;
+  return result;
+}
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
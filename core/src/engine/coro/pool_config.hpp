@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -9,15 +12,77 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+/// Minimal size of the top part of a released coroutine stack, holds the
+/// frames of the idle coroutine with a margin
+inline constexpr std::size_t kMinStackReleaseKeepSize = 8 * 1024;
+
+/// Stack size class of the coroutines that a task processor uses
+enum class StackSizeClass {
+  kSmall,
+  kDefault,
+  kLarge,
+};
+
+StackSizeClass Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<StackSizeClass>);
+
+std::string_view ToString(StackSizeClass stack_size_class);
+
+/// How the released coroutine stacks are returned to the OS
+enum class StackReleaseAdvice {
+  /// MADV_FREE, the pages are freed under memory pressure only, but the next
+  /// use of the stack is cheaper
+  kFree,
+  /// MADV_DONTNEED, the pages are freed at once
+  kDontNeed,
+};
+
+StackReleaseAdvice Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<StackReleaseAdvice>);
+
+/// Options of an additional coroutine pool for a non-default stack size class
+struct StackSizeClassPoolConfig {
+  size_t initial_size = 0;
+  size_t max_size = 1000;
+  size_t stack_size = 0;
+};
+
+StackSizeClassPoolConfig Parse(const yaml_config::YamlConfig& value,
+                               formats::parse::To<StackSizeClassPoolConfig>);
+
 struct PoolConfig {
   size_t initial_size = 1000;
   size_t max_size = 10000;
   size_t stack_size = 256 * 1024ULL;
+
+  // Zero disables the stack painting and the stack usage sampling
+  size_t stack_usage_sample_every = 0;
+
+  // Advise the kernel to back the stacks with transparent huge pages
+  bool huge_pages = false;
+
+  // If not zero, the stacks of the coroutines returned to the pool that has
+  // at least this many idle coroutines are released to the OS, except for
+  // the top stack_release_keep_size bytes
+  size_t stack_release_idle_watermark = 0;
+  // The frames of an idle coroutine that is suspended in the pool live there,
+  // so it may not be less than kMinStackReleaseKeepSize
+  size_t stack_release_keep_size = 16 * 1024ULL;
+  StackReleaseAdvice stack_release_advice = StackReleaseAdvice::kFree;
+
+  // Task processors of a stack size class without a pool use the default pool
+  std::optional<StackSizeClassPoolConfig> small_stacks;
+  std::optional<StackSizeClassPoolConfig> large_stacks;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
                  formats::parse::To<PoolConfig>);
 
+// Makes a config of a stack size class pool, the options that are missing in
+// StackSizeClassPoolConfig are taken from the default pool config
+PoolConfig MakePoolConfig(const PoolConfig& default_config,
+                          const StackSizeClassPoolConfig& config);
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
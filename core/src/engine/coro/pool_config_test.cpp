@@ -0,0 +1,37 @@
+#include <engine/coro/pool_config.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::coro::PoolConfig ParsePoolConfig(const std::string& yaml) {
+  return yaml_config::YamlConfig{formats::yaml::FromString(yaml), {}}
+      .As<engine::coro::PoolConfig>();
+}
+
+}  // namespace
+
+TEST(PoolConfig, StackReleaseKeepSize) {
+  const auto config = ParsePoolConfig(R"(
+initial_size: 10
+max_size: 100
+stack_release_idle_watermark: 10
+stack_release_keep_size: 8192
+)");
+  EXPECT_EQ(config.stack_release_keep_size, 8192);
+
+  UEXPECT_THROW_MSG(ParsePoolConfig(R"(
+initial_size: 10
+max_size: 100
+stack_release_idle_watermark: 10
+stack_release_keep_size: 4096
+)"),
+                    yaml_config::ParseException, "stack_release_keep_size");
+}
+
+USERVER_NAMESPACE_END
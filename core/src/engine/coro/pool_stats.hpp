@@ -10,11 +10,17 @@ namespace engine::coro {
 struct PoolStats {
   size_t active_coroutines = 0;
   size_t total_coroutines = 0;
+
+  // Cumulative counts of the stacks released to the OS and of their bytes
+  size_t released_stacks = 0;
+  size_t released_stack_bytes = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
   lhs.active_coroutines += rhs.active_coroutines;
   lhs.total_coroutines += rhs.total_coroutines;
+  lhs.released_stacks += rhs.released_stacks;
+  lhs.released_stack_bytes += rhs.released_stack_bytes;
   return lhs;
 }
 
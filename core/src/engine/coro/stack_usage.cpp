@@ -0,0 +1,97 @@
+#include <engine/coro/stack_usage.hpp>
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+constexpr std::uint64_t kCanary = 0xC0BEBA5ED0C0FFEEULL;
+
+std::uint64_t* AsWords(std::byte* ptr) noexcept {
+  UASSERT(reinterpret_cast<std::uintptr_t>(ptr) % sizeof(std::uint64_t) == 0);
+  return reinterpret_cast<std::uint64_t*>(ptr);
+}
+
+}  // namespace
+
+StackAllocator::StackAllocator(std::size_t stack_size, bool paint_stacks,
+                               bool huge_pages)
+    : allocator_(stack_size),
+      paint_stacks_(paint_stacks),
+      huge_pages_(huge_pages) {}
+
+boost::context::stack_context StackAllocator::allocate() {
+  auto sctx = allocator_.allocate();
+
+  // The lowest page of the allocated memory is a guard page
+  auto* const top = static_cast<std::byte*>(sctx.sp);
+  last_area_.top = top;
+  last_area_.bottom =
+      top - sctx.size + boost::context::stack_traits::page_size();
+
+#ifdef MADV_HUGEPAGE
+  if (huge_pages_) {
+    // Just a hint, the stack is usable without huge pages
+    ::madvise(last_area_.bottom, last_area_.top - last_area_.bottom,
+              MADV_HUGEPAGE);
+  }
+#endif
+
+  if (paint_stacks_) {
+    std::fill(AsWords(last_area_.bottom), AsWords(last_area_.top), kCanary);
+  }
+  return sctx;
+}
+
+void StackAllocator::deallocate(boost::context::stack_context& sctx) noexcept {
+  allocator_.deallocate(sctx);
+}
+
+std::size_t GetStackUsage(StackArea area) noexcept {
+  UASSERT(area.bottom && area.bottom < area.top);
+
+  // The stack grows down, so the first overwritten canary from the bottom is
+  // the deepest point the stack has ever reached
+  const auto* const first_used = std::find_if(
+      AsWords(area.bottom), AsWords(area.top),
+      [](std::uint64_t word) { return word != kCanary; });
+  return area.top - reinterpret_cast<const std::byte*>(first_used);
+}
+
+std::size_t ReleaseStackTail(StackArea area, std::size_t keep_bytes,
+                             bool lazy) noexcept {
+  UASSERT(area.bottom && area.bottom < area.top);
+  if (static_cast<std::size_t>(area.top - area.bottom) <= keep_bytes) return 0;
+
+  // The pages of a suspended coroutine that are deeper than its stack
+  // pointer hold no live data
+  const auto page_size = boost::context::stack_traits::page_size();
+  const auto end = reinterpret_cast<std::uintptr_t>(area.top - keep_bytes) /
+                   page_size * page_size;
+  const auto begin = reinterpret_cast<std::uintptr_t>(area.bottom);
+  if (end <= begin) return 0;
+
+  int advice = MADV_DONTNEED;
+#ifdef MADV_FREE
+  if (lazy) advice = MADV_FREE;
+#else
+  (void)lazy;
+#endif
+
+  if (::madvise(reinterpret_cast<void*>(begin), end - begin, advice) != 0) {
+    return 0;
+  }
+  return end - begin;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
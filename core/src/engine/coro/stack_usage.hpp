@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+
+#include <coroutines/coroutine.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+/// Usable memory of a coroutine stack, the stack grows down from `top`
+struct StackArea {
+  std::byte* bottom{nullptr};
+  std::byte* top{nullptr};
+};
+
+/// Allocates guarded coroutine stacks. If requested, paints the usable part
+/// of each stack with a canary pattern, so that the high-water mark of the
+/// stack could be found out later with GetStackUsage.
+///
+/// Painting touches every page of the stack, so the whole stack becomes
+/// resident in memory.
+///
+/// If requested, advises the kernel to back the stacks with transparent huge
+/// pages, which only works for the stacks that span whole huge pages.
+class StackAllocator final {
+ public:
+  StackAllocator(std::size_t stack_size, bool paint_stacks,
+                 bool huge_pages = false);
+
+  boost::context::stack_context allocate();
+  void deallocate(boost::context::stack_context& sctx) noexcept;
+
+  /// Usable memory of the stack returned by the last `allocate()` call
+  StackArea GetLastAllocatedArea() const noexcept { return last_area_; }
+
+ private:
+  boost::coroutines2::protected_fixedsize_stack allocator_;
+  bool paint_stacks_;
+  bool huge_pages_;
+  StackArea last_area_;
+};
+
+/// Returns the max amount of bytes that were ever used on a painted stack
+std::size_t GetStackUsage(StackArea area) noexcept;
+
+/// Returns the pages of the stack deeper than `keep_bytes` from the top to the
+/// OS, they are faulted back in on the next use. With `lazy` the kernel frees
+/// the pages only under memory pressure (MADV_FREE), otherwise at once
+/// (MADV_DONTNEED). The released pages lose the painted canary pattern.
+/// @returns the count of the released bytes
+std::size_t ReleaseStackTail(StackArea area, std::size_t keep_bytes,
+                             bool lazy) noexcept;
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#include <engine/coro/stack_usage.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_pools.hpp>
+#include <userver/engine/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 256 * 1024;
+
+}  // namespace
+
+TEST(StackUsage, UntouchedStack) {
+  engine::coro::StackAllocator allocator{kStackSize, /*paint_stacks=*/true};
+  auto sctx = allocator.allocate();
+  const auto area = allocator.GetLastAllocatedArea();
+
+  EXPECT_EQ(area.top, static_cast<std::byte*>(sctx.sp));
+  EXPECT_GE(static_cast<std::size_t>(area.top - area.bottom), kStackSize);
+  EXPECT_EQ(engine::coro::GetStackUsage(area), 0);
+
+  allocator.deallocate(sctx);
+}
+
+TEST(StackUsage, HighWaterMark) {
+  engine::coro::StackAllocator allocator{kStackSize, /*paint_stacks=*/true};
+  auto sctx = allocator.allocate();
+  const auto area = allocator.GetLastAllocatedArea();
+
+  constexpr std::size_t kUsed = 10000;
+  std::fill(area.top - kUsed, area.top, std::byte{42});
+  EXPECT_EQ(engine::coro::GetStackUsage(area), kUsed);
+
+  // Shallower usage does not affect the high-water mark
+  std::fill(area.top - 100, area.top, std::byte{0});
+  EXPECT_EQ(engine::coro::GetStackUsage(area), kUsed);
+
+  allocator.deallocate(sctx);
+}
+
+TEST(StackUsage, ReleaseStackTail) {
+  engine::coro::StackAllocator allocator{kStackSize, /*paint_stacks=*/false};
+  auto sctx = allocator.allocate();
+  const auto area = allocator.GetLastAllocatedArea();
+  std::fill(area.bottom, area.top, std::byte{42});
+
+  constexpr std::size_t kKeep = 16 * 1024;
+  const auto released =
+      engine::coro::ReleaseStackTail(area, kKeep, /*lazy=*/false);
+  EXPECT_EQ(released, static_cast<std::size_t>(area.top - area.bottom) - kKeep);
+
+  // The released pages are zero-filled on the next access
+  EXPECT_EQ(*area.bottom, std::byte{0});
+  EXPECT_EQ(*(area.top - kKeep - 1), std::byte{0});
+  EXPECT_EQ(*(area.top - kKeep), std::byte{42});
+  EXPECT_EQ(*(area.top - 1), std::byte{42});
+
+  // Nothing to release in a stack that is smaller than the kept part
+  EXPECT_EQ(engine::coro::ReleaseStackTail(area, kKeep * 1024, false), 0);
+
+  allocator.deallocate(sctx);
+}
+
+TEST(StackUsage, TaskProcessorStats) {
+  engine::coro::PoolConfig coro_config;
+  coro_config.initial_size = 1;
+  coro_config.max_size = 10;
+  coro_config.stack_size = kStackSize;
+  coro_config.stack_usage_sample_every = 1;
+
+  engine::ev::ThreadPoolConfig ev_config;
+  ev_config.threads = 1;
+
+  auto task_processor = engine::impl::TaskProcessorHolder::Make(
+      1, "stack-usage",
+      std::make_shared<engine::impl::TaskProcessorPools>(
+          std::move(coro_config), std::move(ev_config)));
+
+  constexpr std::size_t kUsed = 64 * 1024;
+  constexpr int kTasks = 10;
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+    for (int i = 0; i < kTasks; ++i) {
+      engine::AsyncNoSpan([] {
+        std::array<volatile unsigned char, kUsed> dummy_data{};
+        for (auto& byte : dummy_data) byte = 42;
+      }).Get();
+    }
+  });
+
+  const auto& stack_usage = task_processor->GetTaskCounter().GetStackUsage();
+  EXPECT_GE(stack_usage.Count(), kTasks);
+  EXPECT_GE(stack_usage.GetPercentile(100), kUsed / 1024);
+  EXPECT_LT(stack_usage.GetPercentile(100), kStackSize / 1024);
+}
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,10 @@
 #include <benchmark/benchmark.h>
 
 #include <chrono>
+#include <memory>
+#include <vector>
 
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 
 #include <utils/gbench_auxilary.hpp>
@@ -47,6 +50,32 @@ void deadline_100s_interval_reached(benchmark::State& state) {
   deadline_is_reached(state, std::chrono::seconds{100});
 }
 
+// Rearming of the deadline timers of many sleeping tasks, as done for the
+// ev-threads with `timer_wheel: true`
+void deadline_timer_wheel_rearm(benchmark::State& state) {
+  using TimerWheel = engine::ev::TimerWheel;
+  const auto timers_count = static_cast<std::size_t>(state.range(0));
+
+  TimerWheel wheel;
+  std::vector<std::unique_ptr<TimerWheel::Timer>> timers;
+  timers.reserve(timers_count);
+  const auto now = TimerWheel::Clock::now();
+  for (std::size_t i = 0; i < timers_count; ++i) {
+    timers.push_back(std::make_unique<TimerWheel::Timer>(
+        [](void*) noexcept {}, nullptr));
+    wheel.Schedule(*timers.back(), now + std::chrono::milliseconds{100 + i});
+  }
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    auto& timer = *timers[i % timers_count];
+    wheel.Schedule(timer, now + std::chrono::seconds{1 + i % 100});
+    ++i;
+  }
+
+  for (auto& timer : timers) wheel.Cancel(*timer);
+}
+
 }  // namespace
 
 BENCHMARK(deadline_1us_interval_construction);
@@ -56,4 +85,6 @@ BENCHMARK(deadline_1us_interval_reached);
 BENCHMARK(deadline_20ms_interval_reached);
 BENCHMARK(deadline_100s_interval_reached);
 
+BENCHMARK(deadline_timer_wheel_rearm)->Range(1, 1024 * 256);
+
 USERVER_NAMESPACE_END
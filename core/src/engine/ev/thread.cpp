@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <stdexcept>
+#include <string_view>
 
 #include <sys/param.h>
 #include <sys/types.h>
@@ -60,26 +61,66 @@ void ReleaseEvDefaultLoop() {
 constexpr std::chrono::milliseconds kCpuStatsCollectInterval{1000};
 constexpr std::size_t kCpuStatsThrottle{16};
 
+unsigned RequireEvBackend(unsigned backend_flag, std::string_view name) {
+  if (!(ev_supported_backends() & backend_flag)) {
+    LOG_WARNING() << "libev backend '" << name
+                  << "' is not supported by the current libev build or "
+                     "kernel, falling back to the default backend";
+    return EVFLAG_AUTO;
+  }
+  return backend_flag;
+}
+
+unsigned GetEvLoopFlags(LoopBackend backend) {
+  switch (backend) {
+    case LoopBackend::kAuto:
+      return EVFLAG_AUTO;
+    case LoopBackend::kEpoll:
+      return RequireEvBackend(EVBACKEND_EPOLL, "epoll");
+    case LoopBackend::kIoUring:
+#ifdef EVBACKEND_IOURING
+      return RequireEvBackend(EVBACKEND_IOURING, "io_uring");
+#else
+      return RequireEvBackend(0, "io_uring");
+#endif
+    case LoopBackend::kLinuxAio:
+#ifdef EVBACKEND_LINUXAIO
+      return RequireEvBackend(EVBACKEND_LINUXAIO, "linux-aio");
+#else
+      return RequireEvBackend(0, "linux-aio");
+#endif
+  }
+
+  UINVARIANT(false, "Unexpected ev-loop backend");
+}
+
 }  // namespace
 
 Thread::Thread(const std::string& thread_name,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, false, register_event_mode) {}
+               RegisterEventMode register_event_mode, LoopBackend backend,
+               bool use_timer_wheel)
+    : Thread(thread_name, false, register_event_mode, backend,
+             use_timer_wheel) {}
 
 Thread::Thread(const std::string& thread_name, UseDefaultEvLoop,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, true, register_event_mode) {}
+               RegisterEventMode register_event_mode, LoopBackend backend,
+               bool use_timer_wheel)
+    : Thread(thread_name, true, register_event_mode, backend,
+             use_timer_wheel) {}
 
 Thread::Thread(const std::string& thread_name, bool use_ev_default_loop,
-               RegisterEventMode register_event_mode)
+               RegisterEventMode register_event_mode, LoopBackend backend,
+               bool use_timer_wheel)
     : use_ev_default_loop_(use_ev_default_loop),
       register_event_mode_(register_event_mode),
+      backend_(backend),
       loop_(nullptr),
       lock_(loop_mutex_, std::defer_lock),
       name_{thread_name},
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
       is_running_(false) {
   if (use_ev_default_loop_) AcquireEvDefaultLoop(name_);
+  if (use_timer_wheel) timer_wheel_.emplace();
   Start();
 }
 
@@ -92,7 +133,10 @@ Thread::~Thread() {
 void Thread::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
   RegisterInEvLoop(payload);
 
-  if (!IsInEvThread()) {
+  // ev_async_send issues full memory fences even if the watcher is already
+  // pending, so the producers that come after the first one skip it
+  if (!IsInEvThread() &&
+      !doorbell_rung_->exchange(true, std::memory_order_acq_rel)) {
     ev_async_send(loop_, &watch_update_);
   }
 }
@@ -129,15 +173,44 @@ bool Thread::IsInEvThread() const {
   return (std::this_thread::get_id() == thread_.get_id());
 }
 
+void Thread::StartWheelTimer(TimerWheel::Timer& timer,
+                             Deadline::TimePoint expiry) noexcept {
+  UASSERT(IsInEvThread());
+  UASSERT(timer_wheel_);
+
+  if (timer_wheel_->IsEmpty()) {
+    // The wheel was not advanced while it was idle
+    timer_wheel_->Advance(TimerWheel::Clock::now());
+  }
+  timer_wheel_->Schedule(timer, expiry);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  if (!ev_is_active(&timer_wheel_driver_)) {
+    ev_timer_again(loop_, &timer_wheel_driver_);
+  }
+}
+
+void Thread::StopWheelTimer(TimerWheel::Timer& timer) noexcept {
+  UASSERT(IsInEvThread());
+  UASSERT(timer_wheel_);
+  // The driver is stopped on its next tick if the wheel becomes empty
+  timer_wheel_->Cancel(timer);
+}
+
 std::uint8_t Thread::GetCurrentLoadPercent() const {
   return cpu_stats_storage_.GetCurrentLoadPercent();
 }
 
+utils::statistics::ThreadCpuStatsStorage::Stats Thread::GetCpuStats() const {
+  return cpu_stats_storage_.GetStats();
+}
+
 const std::string& Thread::GetName() const { return name_; }
 
 void Thread::Start() {
-  loop_ = use_ev_default_loop_ ? ev_default_loop(EVFLAG_AUTO)
-                               : ev_loop_new(EVFLAG_AUTO);
+  const auto loop_flags = GetEvLoopFlags(backend_);
+  loop_ = use_ev_default_loop_ ? ev_default_loop(loop_flags)
+                               : ev_loop_new(loop_flags);
   UASSERT(loop_);
   ev_set_userdata(loop_, this);
   ev_set_loop_release_cb(loop_, Release, Acquire);
@@ -174,6 +247,13 @@ void Thread::Start() {
     ev_timer_start(loop_, &stats_timer_);
   }
 
+  if (timer_wheel_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(
+        &timer_wheel_driver_, TimerWheelDriver, 0.0,
+        std::chrono::duration_cast<LibEvDuration>(TimerWheel::kTick).count());
+  }
+
   if (use_ev_default_loop_) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     ev_child_init(&watch_child_, ChildWatcher, 0, 0);
@@ -215,6 +295,7 @@ void Thread::RunEvLoop() {
   } else {
     ev_timer_stop(loop_, &stats_timer_);
   }
+  if (timer_wheel_) ev_timer_stop(loop_, &timer_wheel_driver_);
   if (use_ev_default_loop_) ev_child_stop(loop_, &watch_child_);
 }
 
@@ -231,7 +312,23 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
   ev_thread->UpdateLoopWatcherImpl();
 }
 
+void Thread::TimerWheelDriver(struct ev_loop* loop, ev_timer*, int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  ev_thread->TimerWheelDriverImpl();
+}
+
+void Thread::TimerWheelDriverImpl() noexcept {
+  UASSERT(timer_wheel_);
+  timer_wheel_->Advance(TimerWheel::Clock::now());
+  if (timer_wheel_->IsEmpty()) ev_timer_stop(loop_, &timer_wheel_driver_);
+}
+
 void Thread::UpdateLoopWatcherImpl() {
+  // Cleared before draining: a producer that finds the doorbell rung has
+  // pushed its payload before this exchange, so the payload is popped below
+  doorbell_rung_->exchange(false, std::memory_order_acq_rel);
+
   while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
     LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
                 << compiler::GetTypeName(typeid(*payload));
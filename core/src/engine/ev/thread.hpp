@@ -3,6 +3,7 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -10,8 +11,11 @@
 
 #include <userver/engine/deadline.hpp>
 
+#include <concurrent/impl/interference_shield.hpp>
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/thread_pool_config.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,8 +38,12 @@ class Thread final {
     kDeferred
   };
 
-  Thread(const std::string& thread_name, RegisterEventMode);
-  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode);
+  Thread(const std::string& thread_name, RegisterEventMode,
+         LoopBackend backend = LoopBackend::kAuto,
+         bool use_timer_wheel = false);
+  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode,
+         LoopBackend backend = LoopBackend::kAuto,
+         bool use_timer_wheel = false);
   ~Thread();
 
   struct ev_loop* GetEvLoop() const { return loop_; }
@@ -52,12 +60,22 @@ class Thread final {
 
   bool IsInEvThread() const;
 
+  bool HasTimerWheel() const noexcept { return timer_wheel_.has_value(); }
+
+  // Must be called from the ev-thread, requires HasTimerWheel()
+  void StartWheelTimer(TimerWheel::Timer& timer,
+                       Deadline::TimePoint expiry) noexcept;
+  void StopWheelTimer(TimerWheel::Timer& timer) noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
+
+  utils::statistics::ThreadCpuStatsStorage::Stats GetCpuStats() const;
   const std::string& GetName() const;
 
  private:
   Thread(const std::string& thread_name, bool use_ev_default_loop,
-         RegisterEventMode register_event_mode);
+         RegisterEventMode register_event_mode, LoopBackend backend,
+         bool use_timer_wheel);
 
   void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -68,6 +86,8 @@ class Thread final {
 
   static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void TimerWheelDriver(struct ev_loop*, ev_timer* w, int) noexcept;
+  void TimerWheelDriverImpl() noexcept;
   void UpdateLoopWatcherImpl();
   static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   void BreakLoopWatcherImpl();
@@ -80,9 +100,14 @@ class Thread final {
   void ReleaseImpl() noexcept;
 
   concurrent::impl::IntrusiveMpscQueue<AsyncPayloadBase> func_queue_;
+  // Set by the first producer after the ev-thread drained func_queue_, so
+  // that a burst of payloads triggers a single ev_async_send
+  concurrent::impl::InterferenceShield<std::atomic<bool>> doorbell_rung_{
+      false};
 
   bool use_ev_default_loop_;
   RegisterEventMode register_event_mode_;
+  LoopBackend backend_;
 
   struct ev_loop* loop_;
   std::thread thread_;
@@ -91,12 +116,14 @@ class Thread final {
 
   ev_timer timers_driver_{};
   ev_timer stats_timer_{};
+  ev_timer timer_wheel_driver_{};
   ev_async watch_update_{};
   ev_async watch_break_{};
   ev_child watch_child_{};
 
   const std::string name_;
   utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
+  std::optional<TimerWheel> timer_wheel_;
 
   bool is_running_;
 };
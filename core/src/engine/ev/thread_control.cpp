@@ -60,6 +60,21 @@ void ThreadControl::Stop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+bool ThreadControl::HasTimerWheel() const noexcept {
+  return thread_.HasTimerWheel();
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControl::Start(TimerWheel::Timer& timer,
+                          Deadline::TimePoint expiry) noexcept {
+  thread_.StartWheelTimer(timer, expiry);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControl::Stop(TimerWheel::Timer& timer) noexcept {
+  thread_.StopWheelTimer(timer);
+}
+
 void ThreadControl::RunPayloadInEvLoopAsync(
     AsyncPayloadBase& payload) noexcept {
   thread_.RunInEvLoopAsync(payload);
@@ -78,6 +93,11 @@ std::uint8_t ThreadControl::GetCurrentLoadPercent() const {
   return thread_.GetCurrentLoadPercent();
 }
 
+utils::statistics::ThreadCpuStatsStorage::Stats ThreadControl::GetCpuStats()
+    const {
+  return thread_.GetCpuStats();
+}
+
 const std::string& ThreadControl::GetName() const { return thread_.GetName(); }
 
 }  // namespace engine::ev
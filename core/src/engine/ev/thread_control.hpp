@@ -9,9 +9,11 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -116,6 +118,13 @@ class ThreadControl final {
   void Start(ev_io& w) noexcept;
   void Stop(ev_io& w) noexcept;
 
+  /// Whether the ev-thread has a TimerWheel for the long timers
+  bool HasTimerWheel() const noexcept;
+
+  /// Requires HasTimerWheel()
+  void Start(TimerWheel::Timer& timer, Deadline::TimePoint expiry) noexcept;
+  void Stop(TimerWheel::Timer& timer) noexcept;
+
   /// Fast non allocating function to execute a `func(*data)` in EvLoop.
   void RunPayloadInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
 
@@ -143,6 +152,7 @@ class ThreadControl final {
   bool IsInEvThread() const noexcept;
 
   std::uint8_t GetCurrentLoadPercent() const;
+  utils::statistics::ThreadCpuStatsStorage::Stats GetCpuStats() const;
   const std::string& GetName() const;
 
  private:
@@ -3,6 +3,7 @@
 #include <fmt/format.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include "thread.hpp"
 #include "thread_control.hpp"
@@ -27,7 +28,8 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, UseDefaultEvLoop)
     : ThreadPool(std::move(config), !config.ev_default_loop_disabled) {}
 
 ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
-    : use_ev_default_loop_(use_ev_default_loop) {
+    : use_ev_default_loop_(use_ev_default_loop),
+      load_balancing_(config.load_balancing) {
   const auto register_timer_event_mode =
       GetRegisterEventMode(config.defer_events);
 
@@ -35,8 +37,10 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
     const auto thread_name = fmt::format("{}_{}", config.thread_name, index);
     return (use_ev_default_loop && index == 0)
                ? Thread(thread_name, Thread::kUseDefaultEvLoop,
-                        register_timer_event_mode)
-               : Thread(thread_name, register_timer_event_mode);
+                        register_timer_event_mode, config.backend,
+                        config.timer_wheel)
+               : Thread(thread_name, register_timer_event_mode,
+                        config.backend, config.timer_wheel);
   });
 
   thread_controls_ = utils::GenerateFixedArray(
@@ -50,8 +54,16 @@ std::size_t ThreadPool::GetSize() const { return threads_.size(); }
 
 ThreadControl& ThreadPool::NextThread() {
   UASSERT(!thread_controls_.empty());
+  const auto size = thread_controls_.size();
   // just ignore counter_ overflow
-  return thread_controls_[next_thread_idx_++ % thread_controls_.size()];
+  const auto next_index = next_thread_idx_++ % size;
+  if (!load_balancing_ || size == 1) return thread_controls_[next_index];
+
+  const auto index = ChooseLessLoadedThread(
+      next_index, utils::RandRange(size), [this](std::size_t i) {
+        return thread_controls_[i].GetCurrentLoadPercent();
+      });
+  return thread_controls_[index];
 }
 
 std::vector<ThreadControl*> ThreadPool::NextThreads(std::size_t count) {
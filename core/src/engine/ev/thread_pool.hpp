@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <vector>
 
 #include <engine/ev/thread_control.hpp>
@@ -13,6 +14,19 @@ namespace engine::ev {
 
 class Thread;
 
+// The power of two choices: a busy ev-thread is skipped without scanning all
+// of them, and the threads with the same load are still assigned round-robin.
+// The random one avoids herding onto a single idle thread while the load
+// percents are not updated yet.
+template <typename LoadPercentOf>
+std::size_t ChooseLessLoadedThread(std::size_t round_robin_index,
+                                   std::size_t random_index,
+                                   const LoadPercentOf& load_percent_of) {
+  return load_percent_of(random_index) < load_percent_of(round_robin_index)
+             ? random_index
+             : round_robin_index;
+}
+
 class ThreadPool final {
  public:
   struct UseDefaultEvLoop {};
@@ -35,6 +49,7 @@ class ThreadPool final {
   ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop);
 
   bool use_ev_default_loop_;
+  bool load_balancing_;
   utils::FixedArray<Thread> threads_;
   utils::FixedArray<ThreadControl> thread_controls_;
   std::atomic<std::size_t> next_thread_idx_{0};
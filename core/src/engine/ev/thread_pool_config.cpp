@@ -1,15 +1,34 @@
 #include "thread_pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+LoopBackend Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<LoopBackend>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(LoopBackend::kAuto, "auto")
+        .Case(LoopBackend::kEpoll, "epoll")
+        .Case(LoopBackend::kIoUring, "io_uring")
+        .Case(LoopBackend::kLinuxAio, "linux-aio");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ThreadPoolConfig>) {
   ThreadPoolConfig config;
   config.threads = value["threads"].As<size_t>(config.threads);
   config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
   config.defer_events = value["defer_events"].As<bool>(config.defer_events);
+  config.backend = value["backend"].As<LoopBackend>(config.backend);
+  config.timer_wheel = value["timer_wheel"].As<bool>(config.timer_wheel);
+  config.load_balancing =
+      value["load_balancing"].As<bool>(config.load_balancing);
   return config;
 }
 
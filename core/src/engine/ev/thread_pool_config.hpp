@@ -9,11 +9,27 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+/// Kernel interface used by the ev-loops to wait for the I/O readiness
+enum class LoopBackend {
+  kAuto,      ///< let libev choose the best available backend
+  kEpoll,     ///< epoll(7)
+  kIoUring,   ///< io_uring(7), poll requests are submitted in batches
+  kLinuxAio,  ///< Linux AIO (io_submit(2)) IOCB_CMD_POLL requests
+};
+
+LoopBackend Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<LoopBackend>);
+
 struct ThreadPoolConfig {
   size_t threads = 2;
   std::string thread_name = "event-worker";
   bool ev_default_loop_disabled = false;
   bool defer_events = false;
+  LoopBackend backend = LoopBackend::kAuto;
+  // Long task timers are kept in a per-thread TimerWheel instead of libev
+  bool timer_wheel = false;
+  // New watchers go to the less loaded of two ev-threads
+  bool load_balancing = false;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
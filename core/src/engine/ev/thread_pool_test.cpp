@@ -0,0 +1,44 @@
+#include <engine/ev/thread_pool.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <std::size_t N>
+std::size_t Choose(const std::array<std::uint8_t, N>& load_percents,
+                   std::size_t round_robin_index, std::size_t random_index) {
+  return engine::ev::ChooseLessLoadedThread(
+      round_robin_index, random_index,
+      [&](std::size_t i) { return load_percents[i]; });
+}
+
+}  // namespace
+
+TEST(EvThreadPool, BusyThreadIsSkipped) {
+  const std::array<std::uint8_t, 4> load_percents{10, 90, 10, 10};
+
+  for (std::size_t random = 0; random < load_percents.size(); ++random) {
+    if (random == 1) continue;
+    EXPECT_EQ(Choose(load_percents, 1, random), random);
+  }
+  // a busy random thread does not steal the work from the next one
+  EXPECT_EQ(Choose(load_percents, 0, 1), 0);
+  EXPECT_EQ(Choose(load_percents, 1, 1), 1);
+}
+
+TEST(EvThreadPool, RoundRobinAtEqualLoad) {
+  const std::array<std::uint8_t, 4> load_percents{30, 30, 30, 30};
+
+  for (std::size_t next = 0; next < load_percents.size(); ++next) {
+    for (std::size_t random = 0; random < load_percents.size(); ++random) {
+      EXPECT_EQ(Choose(load_percents, next, random), next);
+    }
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,167 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+// Timers that expire later than that are parked in the top level, and are
+// re-inserted when the top level slot is cascaded
+constexpr std::uint64_t kMaxDelta = std::uint64_t{1} << (6 * 5);
+
+}  // namespace
+
+TimerWheel::TimerWheel(Clock::time_point now) noexcept : origin_(now) {
+  static_assert(kSlotBits * kLevels == 30, "Fix kMaxDelta");
+}
+
+TimerWheel::~TimerWheel() {
+  UASSERT_MSG(IsEmpty(), "Timers must be cancelled before the wheel dies");
+}
+
+TimerWheel::Timer::~Timer() {
+  UASSERT_MSG(!IsScheduled(), "Destroying a scheduled timer");
+}
+
+void TimerWheel::Schedule(Timer& timer, Clock::time_point expiry) noexcept {
+  Cancel(timer);
+
+  // Round up, the timer must not fire before its expiry
+  const auto since_origin = expiry - origin_;
+  std::uint64_t expiry_tick = 0;
+  if (since_origin.count() > 0) {
+    expiry_tick = std::chrono::ceil<std::chrono::milliseconds>(since_origin) /
+                  kTick;
+  }
+  timer.expiry_tick_ = std::max(expiry_tick, current_tick_ + 1);
+
+  Insert(timer);
+  ++size_;
+}
+
+void TimerWheel::Cancel(Timer& timer) noexcept {
+  if (!timer.IsScheduled()) return;
+  Remove(timer);
+  UASSERT(size_ > 0);
+  --size_;
+}
+
+void TimerWheel::Advance(Clock::time_point now) noexcept {
+  const auto now_tick = ToTick(now);
+  while (current_tick_ < now_tick) {
+    if (IsEmpty()) {
+      current_tick_ = now_tick;
+      return;
+    }
+
+    SkipIdleTicks(now_tick);
+
+    ++current_tick_;
+    for (std::size_t level = 1; level < kLevels; ++level) {
+      const auto level_tick_bits = kSlotBits * level;
+      if (current_tick_ & ((std::uint64_t{1} << level_tick_bits) - 1)) break;
+      Cascade(level);
+    }
+
+    Node expired;
+    Splice(levels_[0][current_tick_ % kSlotsPerLevel], expired);
+    while (expired.next != &expired) {
+      auto& timer = static_cast<Timer&>(*expired.next);
+      UASSERT(timer.expiry_tick_ == current_tick_);
+      Remove(timer);
+      --size_;
+      timer.callback_(timer.data_);
+    }
+  }
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point) const noexcept {
+  const auto since_origin = time_point - origin_;
+  if (since_origin.count() <= 0) return 0;
+  return std::chrono::floor<std::chrono::milliseconds>(since_origin) / kTick;
+}
+
+void TimerWheel::Insert(Timer& timer) noexcept {
+  UASSERT(timer.expiry_tick_ >= current_tick_);
+  const auto delta =
+      std::min(timer.expiry_tick_ - current_tick_, kMaxDelta - 1);
+  const auto slot_tick = current_tick_ + delta;
+
+  std::size_t level = 0;
+  while (level + 1 < kLevels && (delta >> (kSlotBits * (level + 1))) != 0) {
+    ++level;
+  }
+
+  const auto slot = (slot_tick >> (kSlotBits * level)) % kSlotsPerLevel;
+  Link(levels_[level][slot], timer);
+  timer.level_ = level;
+  ++level_sizes_[level];
+}
+
+void TimerWheel::Remove(Timer& timer) noexcept {
+  UASSERT(level_sizes_[timer.level_] > 0);
+  --level_sizes_[timer.level_];
+  Unlink(timer);
+}
+
+void TimerWheel::Cascade(std::size_t level) noexcept {
+  const auto slot = (current_tick_ >> (kSlotBits * level)) % kSlotsPerLevel;
+
+  Node cascaded;
+  Splice(levels_[level][slot], cascaded);
+  while (cascaded.next != &cascaded) {
+    auto& timer = static_cast<Timer&>(*cascaded.next);
+    Remove(timer);
+    Insert(timer);
+  }
+}
+
+void TimerWheel::SkipIdleTicks(std::uint64_t now_tick) noexcept {
+  // If the lowest levels are empty, nothing fires or moves until the next
+  // cascade of the first non-empty level
+  std::size_t empty_levels = 0;
+  while (empty_levels + 1 < kLevels && level_sizes_[empty_levels] == 0) {
+    ++empty_levels;
+  }
+  if (empty_levels == 0) return;
+
+  const auto granularity = std::uint64_t{1} << (kSlotBits * empty_levels);
+  const auto next_cascade = (current_tick_ / granularity + 1) * granularity;
+  current_tick_ = std::min(next_cascade, now_tick) - 1;
+}
+
+void TimerWheel::Link(Node& list, Node& node) noexcept {
+  UASSERT(node.next == &node);
+  node.prev = list.prev;
+  node.next = &list;
+  list.prev->next = &node;
+  list.prev = &node;
+}
+
+void TimerWheel::Unlink(Node& node) noexcept {
+  node.prev->next = node.next;
+  node.next->prev = node.prev;
+  node.prev = &node;
+  node.next = &node;
+}
+
+void TimerWheel::Splice(Node& from, Node& to) noexcept {
+  UASSERT(to.next == &to);
+  if (from.next == &from) return;
+
+  to.next = from.next;
+  to.prev = from.prev;
+  to.next->prev = &to;
+  to.prev->next = &to;
+  from.prev = &from;
+  from.next = &from;
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
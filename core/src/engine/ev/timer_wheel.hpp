@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// Hierarchical timer wheel with 1ms ticks for the timers of an ev-loop.
+///
+/// Unlike the libev timers heap, Schedule() and Cancel() are O(1) and do not
+/// allocate: timers are intrusive and are linked into the slots of the
+/// wheel. Timers never fire before their expiry time and fire at most one
+/// tick after it, as long as Advance() is called every tick.
+///
+/// Not thread-safe, all the methods are expected to be called from the
+/// ev-thread.
+class TimerWheel final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::chrono::milliseconds kTick{1};
+
+  class Timer;
+
+  explicit TimerWheel(Clock::time_point now = Clock::now()) noexcept;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  ~TimerWheel();
+
+  /// Schedules the timer to fire at `expiry`, re-schedules an already
+  /// scheduled timer.
+  void Schedule(Timer& timer, Clock::time_point expiry) noexcept;
+
+  /// Does nothing for a timer that is not scheduled
+  void Cancel(Timer& timer) noexcept;
+
+  /// Fires all the timers that expired by `now`. Timer callbacks may
+  /// schedule and cancel timers.
+  ///
+  /// Call it before scheduling into an empty wheel that was idle for a while,
+  /// so that the next call would not have to go through all the idle ticks.
+  void Advance(Clock::time_point now) noexcept;
+
+  bool IsEmpty() const noexcept { return size_ == 0; }
+  std::size_t GetSize() const noexcept { return size_; }
+
+ private:
+  struct Node {
+    Node* prev{this};
+    Node* next{this};
+  };
+
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlotsPerLevel = 1 << kSlotBits;
+  static constexpr std::size_t kLevels = 5;
+
+  using Slots = std::array<Node, kSlotsPerLevel>;
+
+  std::uint64_t ToTick(Clock::time_point time_point) const noexcept;
+  void Insert(Timer& timer) noexcept;
+  void Remove(Timer& timer) noexcept;
+  void Cascade(std::size_t level) noexcept;
+  void SkipIdleTicks(std::uint64_t now_tick) noexcept;
+
+  static void Link(Node& list, Node& node) noexcept;
+  static void Unlink(Node& node) noexcept;
+  static void Splice(Node& from, Node& to) noexcept;
+
+  const Clock::time_point origin_;
+  // All the timers that expire at or before this tick have already fired
+  std::uint64_t current_tick_{0};
+  std::size_t size_{0};
+  std::array<std::size_t, kLevels> level_sizes_{};
+  std::array<Slots, kLevels> levels_;
+};
+
+/// A timer for TimerWheel, must outlive its scheduling
+class TimerWheel::Timer final : private TimerWheel::Node {
+ public:
+  using Callback = void (*)(void* data) noexcept;
+
+  Timer(Callback callback, void* data) noexcept
+      : callback_(callback), data_(data) {}
+
+  Timer(const Timer&) = delete;
+  Timer& operator=(const Timer&) = delete;
+  ~Timer();
+
+  bool IsScheduled() const noexcept { return next != this; }
+
+ private:
+  friend class TimerWheel;
+
+  Callback callback_;
+  void* data_;
+  std::uint64_t expiry_tick_{0};
+  std::size_t level_{0};
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,174 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using Clock = TimerWheel::Clock;
+using std::chrono::milliseconds;
+
+const auto kOrigin = Clock::time_point{} + std::chrono::hours{1};
+
+struct CountingTimer {
+  CountingTimer() : timer(&OnTimer, this) {}
+
+  static void OnTimer(void* data) noexcept {
+    ++static_cast<CountingTimer*>(data)->fired;
+  }
+
+  int fired{0};
+  TimerWheel::Timer timer;
+};
+
+}  // namespace
+
+TEST(TimerWheel, FiresOnExpiry) {
+  TimerWheel wheel{kOrigin};
+  CountingTimer timer;
+
+  wheel.Schedule(timer.timer, kOrigin + milliseconds{10});
+  EXPECT_TRUE(timer.timer.IsScheduled());
+  EXPECT_EQ(wheel.GetSize(), 1);
+
+  wheel.Advance(kOrigin + milliseconds{9});
+  EXPECT_EQ(timer.fired, 0);
+
+  wheel.Advance(kOrigin + milliseconds{10});
+  EXPECT_EQ(timer.fired, 1);
+  EXPECT_FALSE(timer.timer.IsScheduled());
+  EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, NeverFiresEarly) {
+  TimerWheel wheel{kOrigin};
+  CountingTimer timer;
+
+  wheel.Schedule(timer.timer, kOrigin + std::chrono::microseconds{10'500});
+  wheel.Advance(kOrigin + milliseconds{10});
+  EXPECT_EQ(timer.fired, 0);
+  wheel.Advance(kOrigin + milliseconds{11});
+  EXPECT_EQ(timer.fired, 1);
+}
+
+TEST(TimerWheel, ExpiredTimerFiresOnNextTick) {
+  TimerWheel wheel{kOrigin};
+  wheel.Advance(kOrigin + milliseconds{100});
+
+  CountingTimer timer;
+  wheel.Schedule(timer.timer, kOrigin);
+  wheel.Advance(kOrigin + milliseconds{100});
+  EXPECT_EQ(timer.fired, 0);
+  wheel.Advance(kOrigin + milliseconds{101});
+  EXPECT_EQ(timer.fired, 1);
+}
+
+TEST(TimerWheel, CancelAndReschedule) {
+  TimerWheel wheel{kOrigin};
+  CountingTimer timer;
+
+  wheel.Schedule(timer.timer, kOrigin + milliseconds{5});
+  wheel.Cancel(timer.timer);
+  EXPECT_FALSE(timer.timer.IsScheduled());
+  EXPECT_TRUE(wheel.IsEmpty());
+  wheel.Cancel(timer.timer);
+
+  wheel.Schedule(timer.timer, kOrigin + milliseconds{5});
+  wheel.Schedule(timer.timer, kOrigin + milliseconds{50});
+  EXPECT_EQ(wheel.GetSize(), 1);
+
+  wheel.Advance(kOrigin + milliseconds{49});
+  EXPECT_EQ(timer.fired, 0);
+  wheel.Advance(kOrigin + milliseconds{50});
+  EXPECT_EQ(timer.fired, 1);
+}
+
+TEST(TimerWheel, CascadesThroughLevels) {
+  TimerWheel wheel{kOrigin};
+  // Start in the middle of the level slots to test the wrap-arounds
+  wheel.Advance(kOrigin + milliseconds{12345});
+
+  const std::vector<milliseconds> delays{
+      milliseconds{1},          milliseconds{63},
+      milliseconds{64},         milliseconds{65},
+      milliseconds{4095},       milliseconds{4096},
+      milliseconds{100'000},    milliseconds{262'143},
+      milliseconds{262'144},    milliseconds{20'000'000},
+      std::chrono::hours{24 * 20}};
+
+  std::vector<std::unique_ptr<CountingTimer>> timers;
+  for (const auto delay : delays) {
+    timers.push_back(std::make_unique<CountingTimer>());
+    wheel.Schedule(timers.back()->timer,
+                   kOrigin + milliseconds{12345} + delay);
+  }
+
+  // Advance by big steps, the timers must fire exactly at their ticks anyway
+  for (std::size_t i = 0; i < delays.size(); ++i) {
+    const auto expiry = kOrigin + milliseconds{12345} + delays[i];
+
+    wheel.Advance(expiry - milliseconds{1});
+    EXPECT_EQ(timers[i]->fired, 0) << "delay=" << delays[i].count();
+    wheel.Advance(expiry);
+    EXPECT_EQ(timers[i]->fired, 1) << "delay=" << delays[i].count();
+  }
+  EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, CallbackReschedules) {
+  struct PeriodicTimer {
+    explicit PeriodicTimer(TimerWheel& wheel)
+        : wheel(wheel), timer(&OnTimer, this) {}
+
+    static void OnTimer(void* data) noexcept {
+      auto& self = *static_cast<PeriodicTimer*>(data);
+      ++self.fired;
+      self.next += milliseconds{10};
+      if (self.fired < 3) self.wheel.Schedule(self.timer, self.next);
+    }
+
+    TimerWheel& wheel;
+    Clock::time_point next{kOrigin + milliseconds{10}};
+    int fired{0};
+    TimerWheel::Timer timer;
+  };
+
+  TimerWheel wheel{kOrigin};
+  PeriodicTimer periodic{wheel};
+  wheel.Schedule(periodic.timer, periodic.next);
+
+  wheel.Advance(kOrigin + milliseconds{100});
+  EXPECT_EQ(periodic.fired, 3);
+  EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, EngineSleeps) {
+  engine::TaskProcessorPoolsConfig config;
+  config.timer_wheel = true;
+  engine::RunStandalone(2, config, [] {
+    const auto start = Clock::now();
+    engine::SleepFor(milliseconds{30});
+    EXPECT_GE(Clock::now() - start, milliseconds{30});
+
+    // Short sleeps do not go into the wheel
+    engine::SleepFor(std::chrono::microseconds{100});
+
+    auto sleeper = engine::AsyncNoSpan(
+        [] { engine::InterruptibleSleepFor(std::chrono::hours{1}); });
+    engine::Yield();
+    sleeper.SyncCancel();
+    EXPECT_LT(Clock::now() - start, std::chrono::minutes{1});
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#include <userver/engine/flat_combiner.hpp>
+
+#include <userver/engine/single_use_event.hpp>
+
+#include <concurrent/impl/intrusive_hooks.hpp>
+#include <engine/impl/async_flat_combining_queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+namespace {
+
+using Queue = impl::AsyncFlatCombiningQueue;
+
+struct SectionNode final : public Queue::NodeBase {
+  SectionNode(void (*callback)(void*) noexcept, void* data) noexcept
+      : callback(callback), data(data) {}
+
+  void (*const callback)(void*) noexcept;
+  void* const data;
+  SingleUseEvent completed;
+};
+
+}  // namespace
+
+struct FlatCombiner::Impl final {
+  Queue queue;
+};
+
+FlatCombiner::FlatCombiner() : impl_(std::make_unique<Impl>()) {}
+
+FlatCombiner::~FlatCombiner() = default;
+
+void FlatCombiner::DoExecute(Callback callback, void* data) noexcept {
+  SectionNode node{callback, data};
+
+  auto consumer = impl_->queue.PushAndTryStartConsuming(node);
+  if (!consumer.IsValid()) {
+    // The node is owned by the queue until the combiner signals it.
+    node.completed.WaitNonCancellable();
+    return;
+  }
+
+  std::move(consumer).ConsumeAndStop([&node](Queue::NodeBase& base) noexcept {
+    auto& section = static_cast<SectionNode&>(base);
+    section.callback(section.data);
+    // The waiter may destroy the node right after the signal.
+    if (&section != &node) section.completed.Send();
+  });
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/flat_combiner.hpp>
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(FlatCombiner, Sample) {
+  /// [Sample engine::FlatCombiner usage]
+  engine::FlatCombiner combiner;
+  std::unordered_map<std::string, std::int64_t> hits;
+
+  // Executed exclusively with the other sections of `combiner`
+  const auto count = combiner.Execute([&hits] { return ++hits["/ping"]; });
+  EXPECT_EQ(count, 1);
+  /// [Sample engine::FlatCombiner usage]
+}
+
+UTEST(FlatCombiner, Void) {
+  engine::FlatCombiner combiner;
+  int value = 0;
+
+  combiner.Execute([&value] { value = 42; });
+  EXPECT_EQ(value, 42);
+}
+
+UTEST(FlatCombiner, Exception) {
+  engine::FlatCombiner combiner;
+
+  UEXPECT_THROW_MSG(
+      combiner.Execute([]() -> int { throw std::runtime_error("in section"); }),
+      std::runtime_error, "in section");
+  EXPECT_EQ(combiner.Execute([] { return 1; }), 1);
+}
+
+UTEST_MT(FlatCombiner, Concurrent, 4) {
+  constexpr std::size_t kTasks = 8;
+  constexpr std::int64_t kIterations = 10000;
+
+  engine::FlatCombiner combiner;
+  std::int64_t counter = 0;
+  std::atomic<bool> in_section{false};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      for (std::int64_t j = 0; j < kIterations; ++j) {
+        combiner.Execute([&] {
+          EXPECT_FALSE(in_section.exchange(true));
+          ++counter;
+          in_section = false;
+        });
+        if (j % 100 == 0) engine::Yield();
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(counter, kTasks * kIterations);
+}
+
+UTEST_MT(FlatCombiner, ResultsGoToSubmitters, 4) {
+  constexpr std::size_t kTasks = 8;
+  constexpr std::size_t kIterations = 5000;
+
+  engine::FlatCombiner combiner;
+  std::vector<std::size_t> values;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&, i] {
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        const auto value = i * kIterations + j;
+        const auto result = combiner.Execute([&] {
+          values.push_back(value);
+          return values.back();
+        });
+        EXPECT_EQ(result, value);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(values.size(), kTasks * kIterations);
+}
+
+USERVER_NAMESPACE_END
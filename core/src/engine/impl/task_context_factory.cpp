@@ -1,31 +1,171 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 
+#include <array>
+
+#include <compiler/tls.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/utils/assert.hpp>
 
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define HAS_ASAN 1
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__)
+#define HAS_ASAN 1
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Fused allocations of dead tasks are cached per thread, so that short-lived
+// tasks do not hit the allocator at all. The allocations are grouped into
+// size classes, tasks with huge payloads are not cached.
+constexpr std::size_t kSizeClassGranularity = 256;
+constexpr std::size_t kMaxCachedSize = 8 * 1024;
+constexpr std::size_t kSizeClassesCount =
+    kMaxCachedSize / kSizeClassGranularity;
+constexpr std::size_t kMaxCachedBytesPerThread = 256 * 1024;
+
+#ifdef HAS_ASAN
+// The cache would hide use-after-free of tasks
+constexpr bool kIsCacheEnabled = false;
+#else
+constexpr bool kIsCacheEnabled = true;
+#endif
+
+constexpr std::size_t kNotCached = kSizeClassesCount;
+
+// Precedes the TaskContext in the allocation
+struct alignas(kTaskContextAlignment) AllocationHeader final {
+  std::size_t size_class;
+};
+
+struct FreeBlock final {
+  FreeBlock* next;
+};
+
+struct AllocationCache final {
+  std::array<FreeBlock*, kSizeClassesCount> free_lists;
+  std::size_t cached_bytes;
+  bool is_disabled;
+};
+
+// Trivially destructible, so that it stays accessible for the tasks that die
+// in the destructors of other thread-locals
+thread_local AllocationCache local_cache{};
+
+constexpr std::size_t GetAllocationSize(std::size_t size_class) noexcept {
+  return (size_class + 1) * kSizeClassGranularity;
+}
+
+void* AllocateBlock(std::size_t size) {
+  return ::operator new[](size, std::align_val_t{kTaskContextAlignment});
+}
+
+void DeallocateBlock(void* block) noexcept {
+  ::operator delete[](block, std::align_val_t{kTaskContextAlignment});
+}
+
+void DrainCache(AllocationCache& cache) noexcept {
+  for (auto& head : cache.free_lists) {
+    while (head) {
+      auto* const block = head;
+      head = block->next;
+      DeallocateBlock(block);
+    }
+  }
+  cache.cached_bytes = 0;
+}
+
+struct AllocationCacheDrainer final {
+  ~AllocationCacheDrainer();
+};
+
+USERVER_PREVENT_TLS_CACHING AllocationCache& GetLocalCache() noexcept {
+  if constexpr (kIsCacheEnabled) {
+    // Frees the cached blocks on thread exit
+    thread_local AllocationCacheDrainer drainer;
+    (void)drainer;
+  }
+  return local_cache;
+}
+
+USERVER_PREVENT_TLS_CACHING AllocationCacheDrainer::~AllocationCacheDrainer() {
+  local_cache.is_disabled = true;
+  DrainCache(local_cache);
+}
+
+void* TryAllocateCached(std::size_t size_class) noexcept {
+  auto& cache = GetLocalCache();
+  auto*& head = cache.free_lists[size_class];
+  if (!head) return nullptr;
+
+  auto* const block = head;
+  head = block->next;
+  cache.cached_bytes -= GetAllocationSize(size_class);
+  return block;
+}
+
+bool TryCache(void* block, std::size_t size_class) noexcept {
+  auto& cache = GetLocalCache();
+  const auto size = GetAllocationSize(size_class);
+  if (cache.is_disabled ||
+      cache.cached_bytes + size > kMaxCachedBytesPerThread) {
+    return false;
+  }
+
+  auto& head = cache.free_lists[size_class];
+  head = new (block) FreeBlock{head};
+  cache.cached_bytes += size;
+  return true;
+}
+
+}  // namespace
+
 std::size_t GetTaskContextSize() noexcept { return sizeof(TaskContext); }
 
 static_assert(kTaskContextAlignment >= alignof(TaskContext));
 static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
+static_assert(sizeof(AllocationHeader) == kTaskContextAlignment);
+static_assert(kSizeClassGranularity % kTaskContextAlignment == 0);
 
 TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config,
                                      utils::impl::WrappedCallBase& payload) {
   return *new (storage) TaskContext{config.task_processor, config.importance,
-                                    config.wait_mode, config.deadline, payload};
+                                    config.wait_mode, config.deadline,
+                                    config.priority, payload};
 }
 
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
-  return static_cast<std::byte*>(
-      ::operator new[](total_size, std::align_val_t{kTaskContextAlignment}));
+  const auto allocation_size = sizeof(AllocationHeader) + total_size;
+  auto size_class =
+      (allocation_size + kSizeClassGranularity - 1) / kSizeClassGranularity - 1;
+
+  void* block = nullptr;
+  if (kIsCacheEnabled && size_class < kSizeClassesCount) {
+    block = TryAllocateCached(size_class);
+    if (!block) block = AllocateBlock(GetAllocationSize(size_class));
+  } else {
+    size_class = kNotCached;
+    block = AllocateBlock(allocation_size);
+  }
+
+  auto* const header = new (block) AllocationHeader{size_class};
+  return reinterpret_cast<std::byte*>(header + 1);
 }
 
 void DeleteFusedTaskContext(std::byte* storage) noexcept {
   UASSERT(storage);
-  ::operator delete[](storage, std::align_val_t{kTaskContextAlignment});
+  auto* const header = reinterpret_cast<AllocationHeader*>(storage) - 1;
+  const auto size_class = header->size_class;
+  void* const block = header;
+
+  if (size_class != kNotCached && TryCache(block, size_class)) return;
+  DeallocateBlock(block);
 }
 
 }  // namespace engine::impl
@@ -3,6 +3,7 @@
 #include <boost/intrusive/list.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <engine/task/wakeup_batch.hpp>
 
 #include <userver/utils/assert.hpp>
 
@@ -74,14 +75,32 @@ void WaitList::WakeupOne(Lock& lock) {
 
 void WaitList::WakeupAll(Lock& lock) {
   UASSERT(lock);
+  // Waking up many tasks one by one would push them into the task queue
+  // one by one
+  impl::WakeupBatch batch;
   while (!waiting_contexts_->empty()) {
     boost::intrusive_ptr<impl::TaskContext> context(&waiting_contexts_->front(),
                                                     kAdopt);
     context->wait_list_hook.unlink();
 
     context->Wakeup(impl::TaskContext::WakeupSource::kWaitList,
-                    impl::TaskContext::NoEpoch{});
+                    impl::TaskContext::NoEpoch{}, batch);
+  }
+  batch.Flush();
+}
+
+void WaitList::WakeupUpTo(Lock& lock, std::size_t max_count) {
+  UASSERT(lock);
+  impl::WakeupBatch batch;
+  for (; max_count != 0 && !waiting_contexts_->empty(); --max_count) {
+    boost::intrusive_ptr<impl::TaskContext> context(&waiting_contexts_->front(),
+                                                    kAdopt);
+    context->wait_list_hook.unlink();
+
+    context->Wakeup(impl::TaskContext::WakeupSource::kWaitList,
+                    impl::TaskContext::NoEpoch{}, batch);
   }
+  batch.Flush();
 }
 
 void WaitList::Remove(Lock& lock, impl::TaskContext& context) noexcept {
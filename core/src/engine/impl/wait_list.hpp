@@ -68,6 +68,10 @@ class WaitList final {
   void WakeupOne(Lock&);
   void WakeupAll(Lock&);
 
+  /// @brief Wake up the first `max_count` tasks in the order of `Append`
+  /// with a single push into the task queues
+  void WakeupUpTo(Lock&, std::size_t max_count);
+
   /// @brief Get the maximum amount of coroutines that may be sleeping
   /// @returns 0 if there are definitely no waiters currently, non-0 otherwise
   std::size_t GetCountOfSleepies() const noexcept { return sleepies_.load(); }
@@ -1,11 +1,16 @@
 #include <benchmark/benchmark.h>
 
 #include <atomic>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
 #include <userver/engine/impl/task_context_holder.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
 
 #include <engine/impl/wait_list.hpp>
 #include <engine/task/task_context.hpp>
@@ -105,6 +110,40 @@ void wait_list_removal(benchmark::State& state) {
 }
 BENCHMARK(wait_list_removal)->Iterations(kIterationsCount);
 
+void wait_list_wakeup_all(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto waiters_count = state.range(0);
+    engine::Mutex mutex;
+    engine::ConditionVariable cv;
+
+    for (auto _ : state) {
+      state.PauseTiming();
+      bool notified = false;
+      std::atomic<std::int64_t> waiting{0};
+      std::vector<engine::TaskWithResult<void>> tasks;
+      tasks.reserve(waiters_count);
+      for (std::int64_t i = 0; i < waiters_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+          std::unique_lock lock{mutex};
+          ++waiting;
+          [[maybe_unused]] const bool ok =
+              cv.Wait(lock, [&notified] { return notified; });
+        }));
+      }
+      while (waiting != waiters_count) engine::Yield();
+      state.ResumeTiming();
+
+      {
+        const std::lock_guard lock{mutex};
+        notified = true;
+      }
+      cv.NotifyAll();
+      for (auto& task : tasks) task.Get();
+    }
+  });
+}
+BENCHMARK(wait_list_wakeup_all)->RangeMultiplier(4)->Range(4, 1024);
+
 void wait_list_add_remove_contention(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     std::atomic<bool> run{true};
@@ -1,5 +1,7 @@
 #include <userver/engine/io/buffered.hpp>
 
+#include <algorithm>
+
 #include <boost/algorithm/string/trim.hpp>
 
 #include <engine/io/impl/buffer.hpp>
@@ -8,6 +10,11 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
+namespace {
+
+constexpr size_t kDefaultWriteBufferSize = 16 * 1024;
+
+}  // namespace
 
 TerminatorNotFoundException::TerminatorNotFoundException()
     : IoException("EOF encountered before terminator could be found") {}
@@ -132,6 +139,66 @@ size_t BufferedReader::FillBuffer(Deadline deadline) {
   }
 }
 
+BufferedWriter::BufferedWriter(WritableBasePtr sink)
+    : BufferedWriter(std::move(sink), kDefaultWriteBufferSize) {}
+
+BufferedWriter::BufferedWriter(WritableBasePtr sink, size_t buffer_size)
+    : sink_(std::move(sink)), buffer_size_(std::max<size_t>(buffer_size, 1)) {
+  buffer_.reserve(buffer_size_);
+}
+
+BufferedWriter::~BufferedWriter() = default;
+
+BufferedWriter::BufferedWriter(BufferedWriter&&) noexcept = default;
+BufferedWriter& BufferedWriter::operator=(BufferedWriter&&) noexcept = default;
+
+void BufferedWriter::Write(const void* buf, size_t len, Deadline deadline) {
+  if (buffer_.size() + len > buffer_size_) Flush(deadline);
+
+  if (len >= buffer_size_) {
+    Send(buf, len, deadline);
+  } else {
+    buffer_.append(static_cast<const char*>(buf), len);
+  }
+}
+
+void BufferedWriter::Write(std::string_view data, Deadline deadline) {
+  Write(data.data(), data.size(), deadline);
+}
+
+void BufferedWriter::WriteAll(std::initializer_list<IoData> list,
+                              Deadline deadline) {
+  for (const auto& io_data : list) Write(io_data.data, io_data.len, deadline);
+}
+
+void BufferedWriter::Flush(Deadline deadline) {
+  if (buffer_.empty()) return;
+
+  try {
+    Send(buffer_.data(), buffer_.size(), deadline);
+  } catch (const IoInterrupted& ex) {
+    buffer_.erase(0, ex.BytesTransferred());
+    throw;
+  }
+  buffer_.clear();
+}
+
+void BufferedWriter::Send(const void* buf, size_t len, Deadline deadline) {
+  const auto sent_bytes = sink_->WriteAll(buf, len, deadline);
+  if (sent_bytes != len) {
+    throw IoException("Stream was closed by peer during buffered write");
+  }
+}
+
+BufferedStream::BufferedStream(std::shared_ptr<RwBase> stream)
+    : reader_(stream), writer_(std::move(stream)) {}
+
+BufferedStream::BufferedStream(std::shared_ptr<RwBase> stream,
+                               size_t read_buffer_size,
+                               size_t write_buffer_size)
+    : reader_(stream, read_buffer_size),
+      writer_(std::move(stream), write_buffer_size) {}
+
 }  // namespace engine::io
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdlib>
+#include <limits>
 #include <deque>
 #include <string>
 
@@ -12,7 +13,9 @@
 USERVER_NAMESPACE_BEGIN
 
 using BufferedReader = engine::io::BufferedReader;
+using BufferedWriter = engine::io::BufferedWriter;
 using ReadableBase = engine::io::ReadableBase;
+using WritableBase = engine::io::WritableBase;
 
 class ReadableMock : public ReadableBase {
  public:
@@ -40,6 +43,29 @@ class ReadableMock : public ReadableBase {
   std::deque<char> buffer_;
 };
 
+class WritableMock : public WritableBase {
+ public:
+  bool WaitWriteable(engine::Deadline) override { std::abort(); }
+
+  size_t WriteAll(const void* buf, size_t len, engine::Deadline) override {
+    const auto* data = reinterpret_cast<const char*>(buf);
+    const auto written = std::min(len, capacity_ - data_.size());
+    data_.append(data, written);
+    ++writes_count_;
+    return written;
+  }
+
+  const std::string& Data() const { return data_; }
+  size_t WritesCount() const { return writes_count_; }
+
+  void SetCapacity(size_t capacity) { capacity_ = capacity; }
+
+ private:
+  std::string data_;
+  size_t writes_count_{0};
+  size_t capacity_{std::numeric_limits<size_t>::max()};
+};
+
 TEST(BufferedReader, Ctor) {
   BufferedReader reader(std::make_shared<ReadableMock>());
   EXPECT_TRUE(reader.IsValid());
@@ -104,4 +130,47 @@ TEST(BufferedReader, GetPeek) {
   EXPECT_EQ(EOF, reader.Peek());
 }
 
+TEST(BufferedWriter, CoalescesWrites) {
+  auto mock_ptr = std::make_shared<WritableMock>();
+  BufferedWriter writer(mock_ptr, 8);
+
+  writer.Write("ab");
+  writer.WriteAll({{"cd", 2}, {"ef", 2}});
+  EXPECT_EQ(0, mock_ptr->WritesCount());
+  EXPECT_EQ(6, writer.BufferedBytes());
+
+  writer.Write("ghi");
+  EXPECT_EQ(1, mock_ptr->WritesCount());
+  EXPECT_EQ("abcdef", mock_ptr->Data());
+  EXPECT_EQ(3, writer.BufferedBytes());
+
+  writer.Flush();
+  EXPECT_EQ(2, mock_ptr->WritesCount());
+  EXPECT_EQ("abcdefghi", mock_ptr->Data());
+  EXPECT_EQ(0, writer.BufferedBytes());
+
+  writer.Flush();
+  EXPECT_EQ(2, mock_ptr->WritesCount());
+}
+
+TEST(BufferedWriter, LargeWrite) {
+  auto mock_ptr = std::make_shared<WritableMock>();
+  BufferedWriter writer(mock_ptr, 4);
+
+  writer.Write("a");
+  writer.Write("large write");
+  EXPECT_EQ(2, mock_ptr->WritesCount());
+  EXPECT_EQ("alarge write", mock_ptr->Data());
+  EXPECT_EQ(0, writer.BufferedBytes());
+}
+
+TEST(BufferedWriter, PeerClosed) {
+  auto mock_ptr = std::make_shared<WritableMock>();
+  BufferedWriter writer(mock_ptr, 4);
+
+  mock_ptr->SetCapacity(2);
+  writer.Write("abc");
+  UEXPECT_THROW(writer.Flush(), engine::io::IoException);
+}
+
 USERVER_NAMESPACE_END
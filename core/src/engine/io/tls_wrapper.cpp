@@ -1,18 +1,30 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
+#include <array>
+#include <cstring>
 #include <exception>
 #include <memory>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
 
 #include <crypto/helpers.hpp>
 #include <crypto/openssl.hpp>
 #include <engine/io/fd_control.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -230,8 +242,167 @@ enum InterruptAction {
   kFail,
 };
 
+constexpr std::size_t kTicketKeyNameSize = 16;
+constexpr std::size_t kTicketHmacSecretSize = 32;
+constexpr std::size_t kTicketAesKeySize = 32;
+static_assert(kTicketKeyNameSize + kTicketHmacSecretSize + kTicketAesKeySize ==
+              TlsSessionTicketKeys::kKeySize);
+
+struct TicketKey {
+  std::array<unsigned char, kTicketKeyNameSize> name{};
+  std::array<unsigned char, kTicketHmacSecretSize> hmac_secret{};
+  std::array<unsigned char, kTicketAesKeySize> aes_key{};
+};
+
+struct TicketKeys {
+  TicketKey current;
+  std::optional<TicketKey> previous;
+};
+
+TicketKey ParseTicketKey(std::string_view key) {
+  if (key.size() != TlsSessionTicketKeys::kKeySize) {
+    throw TlsException(
+        fmt::format("Session ticket key must be {} bytes long, got {}",
+                    TlsSessionTicketKeys::kKeySize, key.size()));
+  }
+
+  TicketKey result;
+  const auto* pos = key.data();
+  std::memcpy(result.name.data(), pos, kTicketKeyNameSize);
+  pos += kTicketKeyNameSize;
+  std::memcpy(result.hmac_secret.data(), pos, kTicketHmacSecretSize);
+  pos += kTicketHmacSecretSize;
+  std::memcpy(result.aes_key.data(), pos, kTicketAesKeySize);
+  return result;
+}
+
+TicketKey MakeRandomTicketKey() {
+  crypto::impl::Openssl::Init();
+
+  std::array<char, TlsSessionTicketKeys::kKeySize> key{};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (1 != RAND_bytes(reinterpret_cast<unsigned char*>(key.data()),
+                      key.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to generate a session ticket key: RAND_bytes"));
+  }
+  return ParseTicketKey({key.data(), key.size()});
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+using TicketMacCtx = EVP_MAC_CTX;
+
+bool InitTicketMac(TicketMacCtx* mac_ctx, const TicketKey& key) {
+  std::array<OSSL_PARAM, 3> params{
+      OSSL_PARAM_construct_octet_string(
+          OSSL_MAC_PARAM_KEY,
+          const_cast<unsigned char*>(key.hmac_secret.data()),
+          key.hmac_secret.size()),
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                       const_cast<char*>("SHA256"), 0),
+      OSSL_PARAM_construct_end()};
+  return 1 == EVP_MAC_CTX_set_params(mac_ctx, params.data());
+}
+#else
+using TicketMacCtx = HMAC_CTX;
+
+bool InitTicketMac(TicketMacCtx* mac_ctx, const TicketKey& key) {
+  return 1 == HMAC_Init_ex(mac_ctx, key.hmac_secret.data(),
+                           key.hmac_secret.size(), EVP_sha256(), nullptr);
+}
+#endif
+
 }  // namespace
 
+class TlsSessionTicketKeys::Impl {
+ public:
+  Impl() : keys(TicketKeys{MakeRandomTicketKey(), std::nullopt}) {}
+
+  void Rotate(TicketKey&& key) {
+    auto writer = keys.StartWrite();
+    writer->previous = writer->current;
+    writer->current = std::move(key);
+    writer.Commit();
+  }
+
+  void AccountHandshake(SSL* ssl) {
+    if (SSL_session_reused(ssl)) {
+      ++resumed_handshakes;
+    } else {
+      ++full_handshakes;
+    }
+  }
+
+  // Called by OpenSSL for both issuing and accepting the tickets
+  static int TicketKeyCallback(SSL* ssl, unsigned char* key_name,
+                               unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+                               TicketMacCtx* mac_ctx, int encrypt) noexcept {
+    auto* self =
+        static_cast<Impl*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+    UASSERT(self);
+    const auto snapshot = self->keys.Read();
+
+    if (encrypt) {
+      const auto& key = snapshot->current;
+      if (1 != RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc()))) {
+        return -1;
+      }
+      std::memcpy(key_name, key.name.data(), key.name.size());
+      if (1 != EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr,
+                                  key.aes_key.data(), iv) ||
+          !InitTicketMac(mac_ctx, key)) {
+        return -1;
+      }
+      return 1;
+    }
+
+    const auto matches = [key_name](const TicketKey& key) {
+      return 0 == std::memcmp(key_name, key.name.data(), key.name.size());
+    };
+    const TicketKey* key = nullptr;
+    bool renew = false;
+    if (matches(snapshot->current)) {
+      key = &snapshot->current;
+    } else if (snapshot->previous && matches(*snapshot->previous)) {
+      key = &*snapshot->previous;
+      renew = true;
+    } else {
+      // unknown or expired key, do a full handshake
+      return 0;
+    }
+
+    if (!InitTicketMac(mac_ctx, *key) ||
+        1 != EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr,
+                                key->aes_key.data(), iv)) {
+      return -1;
+    }
+    return renew ? 2 : 1;
+  }
+
+  rcu::Variable<TicketKeys> keys;
+  utils::statistics::RelaxedCounter<std::uint64_t> full_handshakes{0};
+  utils::statistics::RelaxedCounter<std::uint64_t> resumed_handshakes{0};
+};
+
+TlsSessionTicketKeys::TlsSessionTicketKeys() = default;
+
+TlsSessionTicketKeys::~TlsSessionTicketKeys() = default;
+
+void TlsSessionTicketKeys::Rotate(std::string_view key) {
+  impl_->Rotate(ParseTicketKey(key));
+}
+
+void TlsSessionTicketKeys::RotateRandom() {
+  impl_->Rotate(MakeRandomTicketKey());
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TlsSessionTicketKeys& keys) {
+  auto handshakes = writer["handshakes"];
+  handshakes["full"] = keys.impl_->full_handshakes.Load();
+  handshakes["resumed"] = keys.impl_->resumed_handshakes.Load();
+}
+
 class TlsWrapper::Impl {
  public:
   explicit Impl(Socket&& socket) : bio_data(std::move(socket)) {}
@@ -239,12 +410,14 @@ class TlsWrapper::Impl {
   Impl(Impl&& other) noexcept
       : bio_data(std::move(other.bio_data)),
         ssl(std::move(other.ssl)),
-        is_in_shutdown(other.is_in_shutdown) {
-    UASSERT(SSL_get_rbio(ssl.get()) == SSL_get_wbio(ssl.get()));
+        is_in_shutdown(other.is_in_shutdown),
+        has_socket_wbio(other.has_socket_wbio) {
+    UASSERT(has_socket_wbio ||
+            SSL_get_rbio(ssl.get()) == SSL_get_wbio(ssl.get()));
     SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
+  void SetUp(SslCtx&& ssl_ctx, KernelTls kernel_tls) {
     Bio socket_bio{BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
@@ -262,10 +435,72 @@ class TlsWrapper::Impl {
 #if OPENSSL_VERSION_NUMBER < 0x010100000L
     ssl->s3->flags |= SSL3_FLAGS_NO_RENEGOTIATE_CIPHERS;
 #endif
+
+#ifdef SSL_OP_ENABLE_KTLS
+    if (kernel_tls == KernelTls::kSend) {
+      // OpenSSL only passes the keys to the kernel via its own socket BIO,
+      // so the records are written by it directly into the fd, while reads
+      // still go through the Socket
+      Bio write_bio{BIO_new_socket(bio_data.socket.Fd(), BIO_NOCLOSE)};
+      if (!write_bio) {
+        throw TlsException(crypto::FormatSslError(
+            "Failed to set up TLS wrapper: BIO_new_socket"));
+      }
+      SSL_set_options(ssl.get(), SSL_OP_ENABLE_KTLS);
+      SSL_set_bio(ssl.get(), socket_bio.get(), write_bio.get());
+      [[maybe_unused]] const auto* disowned_write_bio = write_bio.release();
+      [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
+      has_socket_wbio = true;
+      return;
+    }
+#else
+    static_cast<void>(kernel_tls);
+#endif
+
     SSL_set_bio(ssl.get(), socket_bio.get(), socket_bio.get());
     [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
   }
 
+  // Performs SSL_connect or SSL_accept
+  template <typename HandshakeFunc>
+  void Handshake(HandshakeFunc&& handshake_func, Deadline deadline,
+                 const char* context) {
+    bio_data.current_deadline = deadline;
+    while (true) {
+      const auto ret = handshake_func(ssl.get());
+      if (ret == 1) return;
+
+      const int ssl_error = SSL_get_error(ssl.get(), ret);
+      if (bio_data.last_exception) {
+        std::rethrow_exception(bio_data.last_exception);
+      }
+      if (IsSocketWbioFull(ssl_error)) {
+        WaitSocketWriteable(/*bytes_transferred=*/0);
+        continue;
+      }
+
+      throw TlsException(crypto::FormatSslError(
+          fmt::format("Failed to set up {} TLS wrapper ({})", context,
+                      ssl_error)));
+    }
+  }
+
+  // Unlike the Socket BIO, the OpenSSL socket BIO does not wait for the
+  // socket to become writeable and reports SSL_ERROR_WANT_WRITE instead
+  bool IsSocketWbioFull(int ssl_error) const {
+    return has_socket_wbio && ssl_error == SSL_ERROR_WANT_WRITE &&
+           !bio_data.last_exception;
+  }
+
+  void WaitSocketWriteable(size_t bytes_transferred) {
+    if (!bio_data.socket.WaitWriteable(bio_data.current_deadline)) {
+      if (current_task::ShouldCancel()) {
+        throw IoCancelled(bytes_transferred);
+      }
+      throw IoTimeout(bytes_transferred);
+    }
+  }
+
   template <typename SslIoFunc>
   size_t PerformSslIo(SslIoFunc&& io_func, void* buf, size_t len,
                       impl::TransferMode mode, InterruptAction interrupt_action,
@@ -308,6 +543,16 @@ class TlsWrapper::Impl {
             UINVARIANT(false,
                        fmt::format("Unexpected SSL_ERROR: {}", ssl_error));
         }
+        if (ssl && IsSocketWbioFull(ssl_error)) {
+          try {
+            WaitSocketWriteable(pos - begin);
+          } catch (const IoInterrupted&) {
+            // same as for the Socket BIO interruptions below
+            if (interrupt_action == InterruptAction::kFail) ssl.reset();
+            throw;
+          }
+          continue;
+        }
         if (bio_data.last_exception) {
           if (interrupt_action == InterruptAction::kFail) {
             // Sometimes (when writing) we must either retry the io_func with
@@ -336,6 +581,7 @@ class TlsWrapper::Impl {
   SocketBioData bio_data;
   Ssl ssl;
   bool is_in_shutdown{false};
+  bool has_socket_wbio{false};
 
  private:
   void SyncBioData(BIO* bio,
@@ -349,7 +595,7 @@ TlsWrapper::TlsWrapper(Socket&& socket) : impl_(std::move(socket)) {}
 
 TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
                                       const std::string& server_name,
-                                      Deadline deadline) {
+                                      Deadline deadline, KernelTls kernel_tls) {
   auto ssl_ctx = MakeSslCtx();
 
   if (!server_name.empty()) {
@@ -367,7 +613,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(std::move(ssl_ctx), kernel_tls);
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -378,27 +624,43 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
     }
   }
 
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_connect(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
-
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up client TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
-  }
+  wrapper.impl_->Handshake(&SSL_connect, deadline, "client");
   return wrapper;
 }
 
 TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
-    const std::vector<crypto::Certificate>& cert_authorities) {
+    const std::vector<crypto::Certificate>& cert_authorities,
+    KernelTls kernel_tls, TlsSessionTicketKeys* session_ticket_keys) {
   auto ssl_ctx = MakeSslCtx();
 
+  if (session_ticket_keys) {
+    static constexpr std::string_view kSessionIdContext = "userver";
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (1 != SSL_CTX_set_session_id_context(
+                 ssl_ctx.get(),
+                 reinterpret_cast<const unsigned char*>(
+                     kSessionIdContext.data()),
+                 kSessionIdContext.size())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: "
+          "SSL_CTX_set_session_id_context"));
+    }
+    SSL_CTX_set_app_data(ssl_ctx.get(), &*session_ticket_keys->impl_);
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+    const auto ticket_key_cb_set = SSL_CTX_set_tlsext_ticket_key_evp_cb(
+        ssl_ctx.get(), &TlsSessionTicketKeys::Impl::TicketKeyCallback);
+#else
+    const auto ticket_key_cb_set = SSL_CTX_set_tlsext_ticket_key_cb(
+        ssl_ctx.get(), &TlsSessionTicketKeys::Impl::TicketKeyCallback);
+#endif
+    if (1 != ticket_key_cb_set) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: ticket key callback"));
+    }
+  }
+
   if (!cert_authorities.empty()) {
     auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
     for (const auto& ca : cert_authorities) {
@@ -420,18 +682,10 @@ TlsWrapper TlsWrapper::StartTlsServer(
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_accept(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
-
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up server TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
+  wrapper.impl_->SetUp(std::move(ssl_ctx), kernel_tls);
+  wrapper.impl_->Handshake(&SSL_accept, deadline, "server");
+  if (session_ticket_keys) {
+    session_ticket_keys->impl_->AccountHandshake(wrapper.impl_->ssl.get());
   }
 
   return wrapper;
@@ -450,6 +704,11 @@ bool TlsWrapper::IsValid() const {
   return impl_->ssl && !impl_->is_in_shutdown;
 }
 
+bool TlsWrapper::IsKernelTlsSendEnabled() const {
+  if (!impl_->ssl || !impl_->has_socket_wbio) return false;
+  return BIO_get_ktls_send(SSL_get_wbio(impl_->ssl.get()));
+}
+
 bool TlsWrapper::WaitReadable(Deadline deadline) {
   impl_->CheckAlive();
   char buf = 0;
@@ -509,6 +768,9 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
             UINVARIANT(false,
                        fmt::format("Unexpected SSL_ERROR: {}", ssl_error));
         }
+        if (impl_->IsSocketWbioFull(ssl_error)) {
+          impl_->WaitSocketWriteable(/*bytes_transferred=*/0);
+        }
         if (impl_->bio_data.last_exception) {
           std::rethrow_exception(impl_->bio_data.last_exception);
         }
@@ -182,6 +182,78 @@ UTEST_MT(TlsWrapper, Smoke, 2) {
   server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, KernelTlsSend, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  // large enough to overflow the socket buffers
+  const std::string data(4 * 1024 * 1024, 'k');
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+  auto server_task = engine::AsyncNoSpan(
+      [test_deadline, &data](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), test_deadline, {},
+            io::KernelTls::kSend);
+        // the kernel support is optional, the data gets through either way
+        LOG_INFO() << "Kernel TLS send enabled: "
+                   << tls_server.IsKernelTlsSendEnabled();
+        EXPECT_EQ(data.size(),
+                  tls_server.SendAll(data.data(), data.size(), test_deadline));
+        char c = 0;
+        EXPECT_EQ(1, tls_server.RecvSome(&c, 1, test_deadline));
+        EXPECT_EQ('2', c);
+      },
+      std::move(server));
+
+  auto tls_client = io::TlsWrapper::StartTlsClient(
+      std::move(client), {}, test_deadline, io::KernelTls::kSend);
+  std::string received(data.size(), '\0');
+  EXPECT_EQ(data.size(), tls_client.RecvAll(received.data(), received.size(),
+                                            test_deadline));
+  EXPECT_EQ(data, received);
+  EXPECT_EQ(1, tls_client.SendAll("2", 1, test_deadline));
+
+  server_task.Get();
+}
+
+UTEST_MT(TlsWrapper, SessionTicketKeys, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  io::TlsSessionTicketKeys ticket_keys;
+  EXPECT_THROW(ticket_keys.Rotate("too short"), io::TlsException);
+
+  for (int i = 0; i < 2; ++i) {
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    auto server_task = engine::AsyncNoSpan(
+        [test_deadline, &ticket_keys](auto&& server) {
+          auto tls_server = io::TlsWrapper::StartTlsServer(
+              std::forward<decltype(server)>(server),
+              crypto::Certificate::LoadFromString(cert),
+              crypto::PrivateKey::LoadFromString(key), test_deadline, {},
+              io::KernelTls::kDisabled, &ticket_keys);
+          EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+        },
+        std::move(server));
+
+    auto tls_client =
+        io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+    char c = 0;
+    EXPECT_EQ(1, tls_client.RecvSome(&c, 1, test_deadline));
+    EXPECT_EQ('1', c);
+    server_task.Get();
+
+    ticket_keys.Rotate(
+        std::string(io::TlsSessionTicketKeys::kKeySize, 'a' + i));
+  }
+  ticket_keys.RotateRandom();
+}
+
 UTEST_MT(TlsWrapper, DocTest, 2) {
   static constexpr std::string_view kData = "hello world";
   const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
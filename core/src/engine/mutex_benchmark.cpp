@@ -8,6 +8,7 @@
 
 #include <concurrent/impl/interference_shield.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/flat_combiner.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_waiting_task_mutex.hpp>
@@ -212,6 +213,43 @@ void generic_contention_with_payload(benchmark::State& state) {
       total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
 }
 
+// The same critical sections as in generic_contention*, submitted to
+// engine::FlatCombiner instead of being guarded by a mutex
+template <typename Section>
+void flat_combiner_contention_impl(benchmark::State& state, Section section) {
+  std::atomic<bool> run{true};
+  std::atomic<std::uint64_t> execute_count{0};
+  concurrent::impl::InterferenceShield<engine::FlatCombiner> combiner;
+
+  AsyncCoroPool pool(state.range(0) - 1, [&]() {
+    std::uint64_t local_execute_count = 0;
+
+    while (run) {
+      combiner->Execute(section);
+      ++local_execute_count;
+    }
+
+    execute_count += local_execute_count;
+  });
+
+  std::uint64_t local_execute_count = 0;
+
+  for (auto _ : state) {
+    combiner->Execute(section);
+    ++local_execute_count;
+  }
+
+  execute_count += local_execute_count;
+
+  run = false;
+  pool.Wait();
+  const auto total_execute_count = static_cast<double>(execute_count.load());
+  state.counters["locks"] =
+      benchmark::Counter(total_execute_count, benchmark::Counter::kIsRate);
+  state.counters["locks-per-thread"] = benchmark::Counter(
+      total_execute_count / state.range(0), benchmark::Counter::kIsRate);
+}
+
 //////// Benchmarks
 
 // Note: We intentionally do not run std::* benchmarks from RunStandalone to
@@ -276,6 +314,24 @@ void single_waiting_task_mutex_contention_with_payload(
   });
 }
 
+void flat_combiner_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::uint64_t counter = 0;
+    flat_combiner_contention_impl(state, [&counter] { ++counter; });
+    benchmark::DoNotOptimize(counter);
+  });
+}
+
+void flat_combiner_contention_with_payload(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    flat_combiner_contention_impl(state, [] {
+      for (int i = 0; i < 10; ++i) {
+        benchmark::DoNotOptimize(utils::DefaultRandom()());
+      }
+    });
+  });
+}
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
@@ -289,9 +345,13 @@ BENCHMARK(single_waiting_task_mutex_unlock);
 BENCHMARK(mutex_coro_contention)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention)->Range(1, 2);
+BENCHMARK(flat_combiner_contention)->RangeMultiplier(2)->Range(1, 32);
 
 BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention_with_payload)->Range(1, 2);
+BENCHMARK(flat_combiner_contention_with_payload)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
 
 USERVER_NAMESPACE_END
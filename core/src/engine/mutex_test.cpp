@@ -2,6 +2,7 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/read_mostly_shared_mutex.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/single_waiting_task_mutex.hpp>
@@ -174,5 +175,7 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(EngineMutex, Mutex, engine::Mutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSharedMutex, Mutex, engine::SharedMutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSingleWaitingTaskMutex, Mutex,
                                 engine::SingleWaitingTaskMutex);
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineReadMostlySharedMutex, Mutex,
+                                engine::ReadMostlySharedMutex);
 
 USERVER_NAMESPACE_END
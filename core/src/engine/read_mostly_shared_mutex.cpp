@@ -0,0 +1,125 @@
+#include <userver/engine/read_mostly_shared_mutex.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Readers usually leave soon, yield a few times before sleeping
+constexpr int kWriterYields = 16;
+constexpr std::chrono::microseconds kWriterMinSleep{10};
+constexpr std::chrono::microseconds kWriterMaxSleep{1000};
+
+}  // namespace
+
+ReadMostlySharedMutex::ReadMostlySharedMutex() = default;
+
+ReadMostlySharedMutex::~ReadMostlySharedMutex() {
+  UASSERT_MSG(GetReadersCount() == 0, "destroying a locked mutex");
+}
+
+void ReadMostlySharedMutex::lock() { try_lock_until(Deadline{}); }
+
+void ReadMostlySharedMutex::unlock() {
+  ReleaseWriter();
+  writers_mutex_.unlock();
+}
+
+bool ReadMostlySharedMutex::try_lock() {
+  return try_lock_until(Deadline::Passed());
+}
+
+bool ReadMostlySharedMutex::try_lock_until(Deadline deadline) {
+  if (!writers_mutex_.try_lock_until(deadline)) return false;
+
+  // Pairs with the increment of the readers count and the check of the flag
+  // in try_lock_shared(), one of the sides sees the other
+  has_writer_.store(true, std::memory_order_seq_cst);
+  if (WaitForNoReaders(deadline)) return true;
+
+  ReleaseWriter();
+  writers_mutex_.unlock();
+  return false;
+}
+
+void ReadMostlySharedMutex::lock_shared() {
+  try_lock_shared_until(Deadline{});
+}
+
+void ReadMostlySharedMutex::unlock_shared() noexcept {
+  GetLocalReaders().fetch_sub(1, std::memory_order_release);
+}
+
+bool ReadMostlySharedMutex::try_lock_shared() {
+  auto& readers = GetLocalReaders();
+  readers.fetch_add(1, std::memory_order_seq_cst);
+  if (!has_writer_.load(std::memory_order_seq_cst)) return true;
+
+  // The task did not switch since the increment, so is on the same shard
+  readers.fetch_sub(1, std::memory_order_release);
+  return false;
+}
+
+bool ReadMostlySharedMutex::try_lock_shared_until(Deadline deadline) {
+  while (!try_lock_shared()) {
+    if (!WaitForNoWriter(deadline)) return false;
+  }
+  return true;
+}
+
+std::atomic<std::int64_t>& ReadMostlySharedMutex::GetLocalReaders() noexcept {
+  return readers_[utils::statistics::impl::GetThreadShardIndex()].count;
+}
+
+std::int64_t ReadMostlySharedMutex::GetReadersCount() const noexcept {
+  std::int64_t count = 0;
+  for (const auto& readers : readers_) {
+    count += readers.count.load(std::memory_order_seq_cst);
+  }
+  return count;
+}
+
+bool ReadMostlySharedMutex::WaitForNoReaders(Deadline deadline) {
+  engine::TaskCancellationBlocker blocker;
+  auto sleep = kWriterMinSleep;
+  for (int attempt = 0; GetReadersCount() != 0; ++attempt) {
+    if (deadline.IsReached()) return false;
+
+    if (attempt < kWriterYields) {
+      engine::Yield();
+    } else {
+      engine::SleepUntil(
+          std::min(deadline, engine::Deadline::FromDuration(sleep)));
+      sleep = std::min(sleep * 2, kWriterMaxSleep);
+    }
+  }
+  return true;
+}
+
+bool ReadMostlySharedMutex::WaitForNoWriter(Deadline deadline) {
+  engine::TaskCancellationBlocker blocker;
+  std::unique_lock lock(no_writer_mutex_);
+  return no_writer_cv_.WaitUntil(lock, deadline, [this] {
+    return !has_writer_.load(std::memory_order_seq_cst);
+  });
+}
+
+void ReadMostlySharedMutex::ReleaseWriter() {
+  has_writer_.store(false, std::memory_order_seq_cst);
+
+  engine::TaskCancellationBlocker blocker;
+  std::lock_guard lock(no_writer_mutex_);
+  no_writer_cv_.NotifyAll();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,166 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/read_mostly_shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using Mutex = engine::ReadMostlySharedMutex;
+
+UTEST(ReadMostlySharedMutex, SharedLockUnlockDouble) {
+  Mutex mutex;
+  mutex.lock_shared();
+  mutex.unlock_shared();
+
+  mutex.lock_shared();
+  mutex.unlock_shared();
+}
+
+UTEST(ReadMostlySharedMutex, SharedAndUniqueLock) {
+  Mutex mutex;
+
+  std::unique_lock lock(mutex);
+  EXPECT_FALSE(mutex.try_lock_shared());
+  auto reader = utils::Async("", [&mutex] { std::shared_lock lock(mutex); });
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(reader.IsFinished());
+
+  lock.unlock();
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(reader.IsFinished());
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(ReadMostlySharedMutex, UniqueAndSharedLock) {
+  Mutex mutex;
+
+  std::shared_lock lock(mutex);
+  EXPECT_FALSE(mutex.try_lock());
+  auto writer = utils::Async("", [&mutex] { std::unique_lock lock(mutex); });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(writer.IsFinished());
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST(ReadMostlySharedMutex, TryLockSharedFor) {
+  Mutex mutex;
+
+  std::unique_lock lock(mutex);
+  auto short_waiter = utils::Async("", [&mutex] {
+    return mutex.try_lock_shared_for(std::chrono::milliseconds{10});
+  });
+  EXPECT_FALSE(short_waiter.Get());
+
+  auto long_waiter = utils::Async("", [&mutex] {
+    const bool locked = mutex.try_lock_shared_for(utest::kMaxTestWaitTime);
+    if (locked) mutex.unlock_shared();
+    return locked;
+  });
+  engine::Yield();
+  EXPECT_FALSE(long_waiter.IsFinished());
+  lock.unlock();
+  EXPECT_TRUE(long_waiter.Get());
+}
+
+UTEST_MT(ReadMostlySharedMutex, WritersDontStarve, 2) {
+  Mutex mutex;
+  std::atomic<int> counter{0};
+  std::atomic<int> loaded{-1};
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex, &counter, &loaded] {
+    std::unique_lock lock(mutex);
+    loaded = counter.load();
+  });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    readers.push_back(utils::Async("", [&counter, &mutex] {
+      std::shared_lock lock(mutex);
+      counter++;
+    }));
+  }
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(writer.IsFinished());
+  EXPECT_EQ(loaded.load(), 0);
+
+  for (auto& reader : readers) reader.Get();
+  EXPECT_EQ(counter.load(), 10);
+}
+
+UTEST_MT(ReadMostlySharedMutex, ReadersAndWriters, 4) {
+  constexpr int kIterations = 1000;
+  Mutex mutex;
+  std::int64_t first = 0;
+  std::int64_t second = 0;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&, is_writer = i == 0] {
+      for (int j = 0; j < kIterations; ++j) {
+        if (is_writer) {
+          std::unique_lock lock(mutex);
+          ++first;
+          engine::Yield();
+          ++second;
+        } else {
+          std::shared_lock lock(mutex);
+          // the reader may move to another thread before unlocking
+          const auto observed_first = first;
+          engine::Yield();
+          ASSERT_EQ(observed_first, second);
+        }
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(first, kIterations);
+}
+
+UTEST(ReadMostlySharedMutex, SampleReadMostlySharedMutex) {
+  /// [Sample engine::ReadMostlySharedMutex usage]
+  constexpr auto kTestString = "123";
+
+  engine::ReadMostlySharedMutex mutex;
+  std::string data;
+  {
+    std::lock_guard lock(mutex);
+    // rarely modifying the data under the mutex
+    data = kTestString;
+  }
+
+  {
+    std::shared_lock lock(mutex);
+    // reading the data on each request, the readers do not contend
+    const auto& x = data;
+    ASSERT_EQ(x, kTestString);
+  }
+  /// [Sample engine::ReadMostlySharedMutex usage]
+}
+
+USERVER_NAMESPACE_END
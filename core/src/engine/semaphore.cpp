@@ -1,5 +1,7 @@
 #include <userver/engine/semaphore.hpp>
 
+#include <optional>
+
 #include <fmt/format.h>
 
 #include <userver/engine/task/cancel.hpp>
@@ -34,6 +36,12 @@ class SemaphoreWaitStrategy final : public impl::WaitStrategy {
     waiters_.Remove(lock_, current_);
   }
 
+  // Hands the capacity left after a wakeup over to the next waiter, which
+  // could be skipped by a release that woke up fewer waiters than fit.
+  void WakeupNext() {
+    if (!waiters_.IsEmpty(lock_)) waiters_.WakeupOne(lock_);
+  }
+
  private:
   impl::WaitList& waiters_;
   impl::TaskContext& current_;
@@ -58,6 +66,7 @@ void CancellableSemaphore::SetCapacity(Counter capacity) {
 
   if (lock_waiters_->GetCountOfSleepies()) {
     impl::WaitList::Lock lock{*lock_waiters_};
+    wakeup_epoch_.fetch_add(1, std::memory_order_relaxed);
     lock_waiters_->WakeupAll(lock);
   }
 }
@@ -101,15 +110,18 @@ void CancellableSemaphore::unlock_shared_count(const Counter count) {
 
   const auto old_acquired_locks =
       acquired_locks_.fetch_sub(count, std::memory_order_acq_rel);
-  UASSERT_MSG(old_acquired_locks >= old_acquired_locks - count,
+  UASSERT_MSG(old_acquired_locks >= count,
               fmt::format("Trying to release more locks than have been "
                           "acquired: count={}, acquired={}",
                           count, old_acquired_locks));
 
   if (lock_waiters_->GetCountOfSleepies()) {
     impl::WaitList::Lock lock{*lock_waiters_};
+    wakeup_epoch_.fetch_add(1, std::memory_order_relaxed);
     if (count > 1) {
-      lock_waiters_->WakeupAll(lock);
+      // Each waiter needs at least one lock, so at most `count` of them may
+      // succeed. They are woken up in a single batch.
+      lock_waiters_->WakeupUpTo(lock, count);
     } else {
       lock_waiters_->WakeupOne(lock);
     }
@@ -143,16 +155,35 @@ bool CancellableSemaphore::LockSlowPath(Deadline deadline,
   auto& current = current_task::GetCurrentTaskContext();
   SemaphoreWaitStrategy wait_manager(*lock_waiters_, current, deadline);
 
+  bool was_woken_up = false;
+  std::optional<std::uint64_t> handed_over_epoch;
   while (true) {
     const auto status = DoTryLock(count);
-    if (status != TryLockStatus::kTransientFailure) {
-      return status == TryLockStatus::kSuccess;
+    if (status == TryLockStatus::kSuccess) {
+      if (was_woken_up && RemainingApprox() != 0) wait_manager.WakeupNext();
+      return true;
+    }
+    if (status == TryLockStatus::kPermanentFailure) return false;
+
+    // A woken up waiter that does not fit lets the next one try the released
+    // locks. The wait list lock is held here, and each waiter hands over once
+    // per release, so the waiters that do not fit don't wake each other up
+    // forever.
+    if (was_woken_up && RemainingApprox() != 0) {
+      const auto epoch = wakeup_epoch_.load(std::memory_order_relaxed);
+      if (handed_over_epoch != epoch) {
+        handed_over_epoch = epoch;
+        wait_manager.WakeupNext();
+      }
     }
 
     const auto wakeup_source = current.Sleep(wait_manager);
     if (!impl::HasWaitSucceeded(wakeup_source)) {
+      // The wakeup of a release might have been consumed by the deadline
+      if (RemainingApprox() != 0) wait_manager.WakeupNext();
       return false;
     }
+    was_woken_up = true;
   }
 }
 
@@ -204,4 +204,34 @@ BENCHMARK(semaphore_lock_unlock_st_coro_contention)
     ->RangeMultiplier(2)
     ->Range(1, 1024);
 
+// Waiters of different weights, the releases of several locks at once must
+// wake up all the waiters that fit
+void semaphore_weighted_coro_contention(benchmark::State& state) {
+  engine::RunStandalone(4, [&]() {
+    constexpr std::size_t kCapacity = 8;
+    std::atomic<bool> run{true};
+    engine::Semaphore sem{kCapacity};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < state.range(0) - 1; i++)
+      tasks.push_back(engine::AsyncNoSpan([&, count = i % 4 + 1]() {
+        while (run) {
+          sem.lock_shared_count(count);
+          engine::Yield();
+          sem.unlock_shared_count(count);
+        }
+      }));
+
+    for (auto _ : state) {
+      sem.lock_shared_count(kCapacity / 2);
+      sem.unlock_shared_count(kCapacity / 2);
+    }
+
+    run = false;
+  });
+}
+BENCHMARK(semaphore_weighted_coro_contention)
+    ->RangeMultiplier(2)
+    ->Range(2, 256);
+
 USERVER_NAMESPACE_END
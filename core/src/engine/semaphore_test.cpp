@@ -276,6 +276,67 @@ UTEST(Semaphore, AllWaitersWakeUpWhenNeeded) {
   EXPECT_TRUE(all_locks_acquired.WaitForEventFor(utest::kMaxTestWaitTime));
 }
 
+UTEST_MT(Semaphore, WeightedWaiters, 4) {
+  constexpr std::size_t kCapacity = 4;
+  constexpr std::size_t kTasksCount = 8;
+  constexpr int kIterationsCount = 1000;
+
+  engine::Semaphore sem{kCapacity};
+  std::atomic<std::size_t> locks_in_use{0};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasksCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&, count = i % kCapacity + 1] {
+      for (int j = 0; j < kIterationsCount; ++j) {
+        sem.lock_shared_count(count);
+        EXPECT_LE(locks_in_use += count, kCapacity);
+        engine::Yield();
+        locks_in_use -= count;
+        sem.unlock_shared_count(count);
+      }
+    }));
+  }
+
+  // Hangs if the released locks are not passed to all the waiters that fit
+  for (auto& task : tasks) {
+    task.WaitFor(utest::kMaxTestWaitTime);
+    ASSERT_TRUE(task.IsFinished());
+    task.Get();
+  }
+  EXPECT_EQ(sem.UsedApprox(), 0);
+}
+
+UTEST(Semaphore, WokenUpWaiterHandsOverLocks) {
+  engine::Semaphore sem{2};
+  sem.lock_shared_count(2);
+
+  bool big_acquired = false;
+  auto big = engine::AsyncNoSpan([&] {
+    sem.lock_shared_count(2);
+    big_acquired = true;
+    sem.unlock_shared_count(2);
+  });
+  engine::Yield();
+
+  auto small = engine::AsyncNoSpan([&] {
+    sem.lock_shared_count(1);
+    sem.unlock_shared_count(1);
+  });
+  engine::Yield();
+
+  // Only the first waiter is woken up, it does not fit and has to wake up the
+  // second one
+  sem.unlock_shared_count(1);
+  small.WaitFor(utest::kMaxTestWaitTime);
+  ASSERT_TRUE(small.IsFinished());
+  small.Get();
+  EXPECT_FALSE(big_acquired);
+
+  sem.unlock_shared_count(1);
+  UEXPECT_NO_THROW(big.Get());
+  EXPECT_TRUE(big_acquired);
+}
+
 UTEST_MT(Semaphore, NotifyAndDeadlineRace, 2) {
   constexpr int kTestIterationsCount = 1000;
   constexpr auto kSmallWaitTime = 5us;
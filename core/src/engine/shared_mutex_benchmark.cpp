@@ -3,16 +3,20 @@
 #include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/read_mostly_shared_mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-void shared_mutex_benchmark(benchmark::State& state) {
+namespace {
+
+template <typename Mutex>
+void SharedLock(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     int variable = 0;
-    engine::SharedMutex mutex;
+    Mutex mutex;
     std::atomic<bool> is_running(true);
 
     std::vector<engine::TaskWithResult<void>> tasks;
@@ -43,6 +47,17 @@ void shared_mutex_benchmark(benchmark::State& state) {
     }
   });
 }
+
+}  // namespace
+
+void shared_mutex_benchmark(benchmark::State& state) {
+  SharedLock<engine::SharedMutex>(state);
+}
 BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
 
+void read_mostly_shared_mutex_benchmark(benchmark::State& state) {
+  SharedLock<engine::ReadMostlySharedMutex>(state);
+}
+BENCHMARK(read_mostly_shared_mutex_benchmark)->DenseRange(1, 6);
+
 USERVER_NAMESPACE_END
@@ -1,16 +1,29 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <engine/ev/thread_control.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 
 using namespace std::chrono_literals;
 
 USERVER_NAMESPACE_BEGIN
 
-void sleep_benchmark_us(benchmark::State& state) {
-  engine::RunStandalone([&] {
+namespace {
+
+engine::TaskProcessorPoolsConfig MakePoolsConfig(bool timer_wheel) {
+  engine::TaskProcessorPoolsConfig config;
+  config.timer_wheel = timer_wheel;
+  return config;
+}
+
+}  // namespace
+
+void sleep_benchmark_us(benchmark::State& state, bool timer_wheel) {
+  engine::RunStandalone(1, MakePoolsConfig(timer_wheel), [&] {
     const std::chrono::microseconds sleep_duration{state.range(0)};
     for (auto _ : state) {
       const auto deadline = engine::Deadline::FromDuration(sleep_duration);
@@ -18,10 +31,43 @@ void sleep_benchmark_us(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(sleep_benchmark_us)
+BENCHMARK_CAPTURE(sleep_benchmark_us, libev_timers, false)
     ->RangeMultiplier(2)
     ->Range(1, 1024 * 128)
     ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(sleep_benchmark_us, timer_wheel, true)
+    ->RangeMultiplier(2)
+    ->Range(1, 1024 * 128)
+    ->Unit(benchmark::kMicrosecond);
+
+// Many tasks keep rearming long deadlines, as with HTTP client timeouts
+void sleep_benchmark_many_sleepers(benchmark::State& state, bool timer_wheel) {
+  engine::RunStandalone(4, MakePoolsConfig(timer_wheel), [&] {
+    const auto sleepers_count = static_cast<std::size_t>(state.range(0));
+    std::vector<engine::TaskWithResult<void>> sleepers;
+    sleepers.reserve(sleepers_count);
+    for (std::size_t i = 0; i < sleepers_count; ++i) {
+      sleepers.push_back(engine::AsyncNoSpan([] {
+        while (!engine::current_task::ShouldCancel()) {
+          engine::InterruptibleSleepFor(20s);
+        }
+      }));
+    }
+
+    for (auto _ : state) {
+      auto task =
+          engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(1s); });
+      engine::Yield();
+      task.SyncCancel();
+    }
+
+    for (auto& sleeper : sleepers) sleeper.SyncCancel();
+  });
+}
+BENCHMARK_CAPTURE(sleep_benchmark_many_sleepers, libev_timers, false)
+    ->Range(1, 1024 * 64);
+BENCHMARK_CAPTURE(sleep_benchmark_many_sleepers, timer_wheel, true)
+    ->Range(1, 1024 * 64);
 
 void run_in_ev_loop_benchmark(benchmark::State& state) {
   engine::RunStandalone([&] {
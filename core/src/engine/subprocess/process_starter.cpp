@@ -1,13 +1,13 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <spawn.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
+#include <system_error>
+#include <utility>
 
 #include <fmt/format.h>
 #include <boost/algorithm/string.hpp>
@@ -31,63 +31,118 @@ USERVER_NAMESPACE_BEGIN
 namespace engine::subprocess {
 namespace {
 
-void DoExecve(const std::string& command, const std::vector<std::string>& args,
-              const EnvironmentVariables& env,
-              const std::optional<std::string>& stdout_file,
-              const std::optional<std::string>& stderr_file) {
-  if (stdout_file) {
-    if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-      utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
-    }
+void CheckSpawnError(int error, std::string_view what) {
+  if (error != 0) {
+    throw std::system_error(std::error_code(error, std::system_category()),
+                            fmt::format("Error while {}", what));
   }
-  if (stderr_file) {
-    if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-      utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
+}
+
+// argv and envp of the child, prepared outside of the ev thread
+class SpawnArguments final {
+ public:
+  SpawnArguments(const std::string& command,
+                 const std::vector<std::string>& args,
+                 const EnvironmentVariables& env) {
+    argv_ptrs_.reserve(args.size() + 2);
+    envp_buf_.reserve(env.size());
+    envp_ptrs_.reserve(env.size() + 1);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    argv_ptrs_.push_back(const_cast<char*>(command.c_str()));
+    for (const auto& arg : args) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      argv_ptrs_.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv_ptrs_.push_back(nullptr);
+
+    for (const auto& elem : env) {
+      envp_buf_.emplace_back(elem.first + '=' + elem.second);
+      envp_ptrs_.push_back(envp_buf_.back().data());
     }
+    envp_ptrs_.push_back(nullptr);
   }
-  std::vector<char*> argv_ptrs;
-  std::vector<std::string> envp_buf;
-  std::vector<char*> envp_ptrs;
-  argv_ptrs.reserve(args.size() + 2);
-  envp_buf.reserve(env.size());
-  envp_ptrs.reserve(env.size() + 1);
-
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  argv_ptrs.push_back(const_cast<char*>(command.c_str()));
-  for (const auto& arg : args) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    argv_ptrs.push_back(const_cast<char*>(arg.c_str()));
+
+  char* const* Argv() const { return argv_ptrs_.data(); }
+  char* const* Envp() const { return envp_ptrs_.data(); }
+
+ private:
+  std::vector<char*> argv_ptrs_;
+  std::vector<std::string> envp_buf_;
+  std::vector<char*> envp_ptrs_;
+};
+
+class FileActions final {
+ public:
+  FileActions() {
+    CheckSpawnError(::posix_spawn_file_actions_init(&actions_),
+                    "initializing posix_spawn file actions");
   }
-  argv_ptrs.push_back(nullptr);
 
-  for (const auto& elem : env) {
-    envp_buf.emplace_back(elem.first + '=' + elem.second);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    envp_ptrs.push_back(const_cast<char*>(envp_buf.back().c_str()));
+  FileActions(const FileActions&) = delete;
+  FileActions& operator=(const FileActions&) = delete;
+
+  ~FileActions() { ::posix_spawn_file_actions_destroy(&actions_); }
+
+  void AppendToFile(int fd, const std::string& path) {
+    CheckSpawnError(
+        ::posix_spawn_file_actions_addopen(
+            &actions_, fd, path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666),
+        fmt::format("redirecting fd {} to {}", fd, path));
   }
-  envp_ptrs.push_back(nullptr);
 
-  utils::CheckSyscall(
-      execve(command.c_str(), argv_ptrs.data(), envp_ptrs.data()), "execve");
-}
+  void Dup2(int fd, int target_fd) {
+    CheckSpawnError(
+        ::posix_spawn_file_actions_adddup2(&actions_, fd, target_fd),
+        fmt::format("redirecting fd {} to a pipe", target_fd));
+  }
 
-}  // namespace
+  const posix_spawn_file_actions_t* Get() const { return &actions_; }
 
-ProcessStarter::ProcessStarter(TaskProcessor& task_processor)
-    : thread_control_(
-          task_processor.EventThreadPool().GetEvDefaultLoopThread()) {}
+ private:
+  posix_spawn_file_actions_t actions_{};
+};
 
-ChildProcess ProcessStarter::Exec(
-    const std::string& command, const std::vector<std::string>& args,
-    const EnvironmentVariables& env,
-    const std::optional<std::string>& stdout_file,
-    const std::optional<std::string>& stderr_file) {
+// The end of a pipe, that is inherited by the child as a standard stream
+class ChildPipeEnd final {
+ public:
+  template <typename PipeEnd>
+  explicit ChildPipeEnd(PipeEnd& end) : fd_(end.Release()) {
+    // The child expects blocking standard streams, the parent end of the pipe
+    // is a separate open file description and stays non-blocking
+    const auto flags = utils::CheckSyscall(::fcntl(fd_, F_GETFL),
+                                           "getting flags of the pipe");
+    utils::CheckSyscall(::fcntl(fd_, F_SETFL, flags & ~O_NONBLOCK),
+                        "making the pipe blocking");
+  }
+
+  ChildPipeEnd(ChildPipeEnd&& other) noexcept
+      : fd_(std::exchange(other.fd_, -1)) {}
+
+  ChildPipeEnd& operator=(ChildPipeEnd&&) = delete;
+
+  ~ChildPipeEnd() {
+    if (fd_ != -1) ::close(fd_);
+  }
+
+  int Fd() const { return fd_; }
+
+ private:
+  int fd_{-1};
+};
+
+ChildProcess DoExec(ev::ThreadControl& thread_control,
+                    const std::string& command,
+                    const std::vector<std::string>& args,
+                    const EnvironmentVariables& env,
+                    const FileActions& file_actions) {
   tracing::Span span("ProcessStarter::Exec");
   span.AddTag("command", command);
+  const SpawnArguments spawn_args{command, args, env};
   Promise<ChildProcess> promise;
   auto future = promise.get_future();
-  thread_control_.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
-    LOG_DEBUG() << "do fork() + execve(), command=" << command << ", args=["
+  thread_control.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
+    LOG_DEBUG() << "do posix_spawn(), command=" << command << ", args=["
                 << (args.empty() ? "" : '\'' + boost::join(args, "' '") + '\'')
                 << "], env=["
                 << (env.empty()
@@ -99,37 +154,32 @@ ChildProcess ProcessStarter::Exec(
                                                 }),
                                       ", "))
                 << ']';
-    auto pid = utils::CheckSyscall(fork(), "fork");
-    if (pid) {
-      // in parent thread
-      span.AddTag("child-process-pid", pid);
-      LOG_DEBUG() << "Started child process with pid=" << pid;
-      Promise<ChildProcessStatus> exec_result_promise;
-      auto res = ChildProcessMapSet(
-          pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-      if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-      } else {
-        std::string msg = "process with pid=" + std::to_string(pid) +
-                          " already exists in child_process_map";
-        LOG_ERROR() << msg << ", send SIGKILL";
-        ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-        promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-      }
+    // posix_spawn does not copy the page tables of the parent, unlike fork()
+    pid_t pid = -1;
+    const auto error =
+        ::posix_spawn(&pid, command.c_str(), file_actions.Get(), nullptr,
+                      spawn_args.Argv(), spawn_args.Envp());
+    if (error != 0) {
+      promise.set_exception(std::make_exception_ptr(std::system_error(
+          std::error_code(error, std::system_category()),
+          fmt::format("Error while starting {}", command))));
+      return;
+    }
+
+    span.AddTag("child-process-pid", pid);
+    LOG_DEBUG() << "Started child process with pid=" << pid;
+    Promise<ChildProcessStatus> exec_result_promise;
+    auto res = ChildProcessMapSet(
+        pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+    if (res.second) {
+      promise.set_value(ChildProcess{
+          ChildProcessImpl{pid, res.first->status_promise.get_future()}});
     } else {
-      // in child thread
-      try {
-        try {
-          DoExecve(command, args, env, stdout_file, stderr_file);
-        } catch (const std::exception& ex) {
-          std::cerr << "Cannot execute child: " << ex.what();
-        }
-      } catch (...) {
-        // must not do anything in a child
-      }
-      // on success execve does not return
-      std::abort();
+      std::string msg = "process with pid=" + std::to_string(pid) +
+                        " already exists in child_process_map";
+      LOG_ERROR() << msg << ", send SIGKILL";
+      ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+      promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
     }
   });
 
@@ -137,6 +187,57 @@ ChildProcess ProcessStarter::Exec(
   return future.get();
 }
 
+}  // namespace
+
+ProcessStarter::ProcessStarter(TaskProcessor& task_processor)
+    : thread_control_(
+          task_processor.EventThreadPool().GetEvDefaultLoopThread()) {}
+
+ChildProcess ProcessStarter::Exec(
+    const std::string& command, const std::vector<std::string>& args,
+    const EnvironmentVariables& env,
+    const std::optional<std::string>& stdout_file,
+    const std::optional<std::string>& stderr_file) {
+  FileActions file_actions;
+  if (stdout_file) file_actions.AppendToFile(STDOUT_FILENO, *stdout_file);
+  if (stderr_file) file_actions.AppendToFile(STDERR_FILENO, *stderr_file);
+  return DoExec(thread_control_, command, args, env, file_actions);
+}
+
+PipedChildProcess ProcessStarter::ExecWithPipes(
+    const std::string& command, const std::vector<std::string>& args,
+    const EnvironmentVariables& env, utils::Flags<PipedStream> streams) {
+  FileActions file_actions;
+  // The child ends are closed in the parent after the spawn
+  std::vector<ChildPipeEnd> child_ends;
+  child_ends.reserve(3);
+
+  std::optional<io::PipeWriter> stdin_writer;
+  if (streams & PipedStream::kStdin) {
+    io::Pipe pipe;
+    file_actions.Dup2(child_ends.emplace_back(pipe.reader).Fd(), STDIN_FILENO);
+    stdin_writer.emplace(std::move(pipe.writer));
+  }
+
+  const auto pipe_output = [&](int fd) {
+    io::Pipe pipe;
+    file_actions.Dup2(child_ends.emplace_back(pipe.writer).Fd(), fd);
+    return std::move(pipe.reader);
+  };
+  std::optional<io::PipeReader> stdout_reader;
+  if (streams & PipedStream::kStdout) {
+    stdout_reader.emplace(pipe_output(STDOUT_FILENO));
+  }
+  std::optional<io::PipeReader> stderr_reader;
+  if (streams & PipedStream::kStderr) {
+    stderr_reader.emplace(pipe_output(STDERR_FILENO));
+  }
+
+  return {DoExec(thread_control_, command, args, env, file_actions),
+          std::move(stdin_writer), std::move(stdout_reader),
+          std::move(stderr_reader)};
+}
+
 ChildProcess ProcessStarter::Exec(
     const std::string& command, const std::vector<std::string>& args,
     EnvironmentVariablesUpdate env_update,
@@ -23,6 +23,7 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/logger.hpp>
@@ -65,6 +66,55 @@ UTEST(Subprocess, False) {
   EXPECT_NE(0, status.GetExitCode());
 }
 
+UTEST(Subprocess, NonExistent) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  EXPECT_THROW(starter.Exec("/non/existent/program", {}), std::system_error);
+}
+
+UTEST(Subprocess, StdoutFile) {
+  const auto file = fs::blocking::TempFile::Create();
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  auto status = starter.Exec("/bin/echo", {"hello"}, file.GetPath()).Get();
+  ASSERT_TRUE(status.IsExited());
+  EXPECT_EQ(0, status.GetExitCode());
+  EXPECT_EQ(fs::blocking::ReadFileContents(file.GetPath()), "hello\n");
+}
+
+UTEST(Subprocess, Pipes) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  auto child = starter.ExecWithPipes(
+      "/bin/cat", {}, engine::subprocess::GetCurrentEnvironmentVariables(),
+      {engine::subprocess::PipedStream::kStdin,
+       engine::subprocess::PipedStream::kStdout});
+  ASSERT_TRUE(child.stdin_writer);
+  ASSERT_TRUE(child.stdout_reader);
+  EXPECT_FALSE(child.stderr_reader);
+
+  const std::string input = "some input for the child";
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  ASSERT_EQ(child.stdin_writer->WriteAll(input.data(), input.size(), deadline),
+            input.size());
+  child.stdin_writer->Close();
+
+  std::string output;
+  char buf[16];
+  while (const auto size = child.stdout_reader->ReadSome(buf, sizeof(buf),
+                                                         deadline)) {
+    output.append(buf, size);
+  }
+  EXPECT_EQ(output, input);
+
+  const auto status = child.process.Get();
+  ASSERT_TRUE(status.IsExited());
+  EXPECT_EQ(0, status.GetExitCode());
+}
+
 UTEST(Subprocess, CheckSpdlogClosesFds) {
   auto file = fs::blocking::TempFile::Create("/tmp", kSpdlogFilePart);
   auto logger = logging::MakeFileLogger("to_file", file.GetPath(),
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+
+#include <compiler/relax_cpu.hpp>
+#include <engine/task/task_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Spins on a semaphore for a while before the worker thread goes to sleep in
+/// the OS wait, which costs a futex wake-up for the producer and a noticeable
+/// delay for the task.
+///
+/// In adaptive mode the amount of spinning grows on spin hits and shrinks
+/// on misses, so that workers don't burn CPU when the load is low and don't
+/// pay for the futex wake-ups on bursts.
+class AdaptiveSpinning final {
+ public:
+  AdaptiveSpinning(int max_spins, bool is_adaptive) noexcept
+      : max_spins_(std::max(max_spins, 0)),
+        min_spins_(is_adaptive ? std::min(max_spins_, kMinAdaptiveSpins)
+                               : max_spins_),
+        spins_(max_spins_) {}
+
+  template <typename Semaphore>
+  void Wait(Semaphore& semaphore, TaskCounter& counter) {
+    if (semaphore.tryWait()) return;
+
+    if (spins_ != 0) {
+      compiler::RelaxCpu relax;
+      for (int i = 0; i < spins_; ++i) {
+        if (semaphore.availableApprox() > 0 && semaphore.tryWait()) {
+          spins_ = (spins_ > max_spins_ / 2) ? max_spins_ : spins_ * 2;
+          counter.AccountSpinHit();
+          return;
+        }
+        relax();
+      }
+
+      spins_ = std::max(spins_ / 2, min_spins_);
+      counter.AccountSpinMiss();
+    }
+
+    semaphore.wait();
+  }
+
+ private:
+  static constexpr int kMinAdaptiveSpins = 100;
+
+  const int max_spins_;
+  const int min_spins_;
+  int spins_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <engine/task/adaptive_spinning.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Grants a permit only after `fails_left` unsuccessful attempts
+struct FakeSemaphore final {
+  bool tryWait() {
+    if (fails_left == 0) return true;
+    --fails_left;
+    return false;
+  }
+
+  std::size_t availableApprox() const { return 1; }
+
+  bool wait() {
+    ++waits;
+    return true;
+  }
+
+  int fails_left{0};
+  int waits{0};
+};
+
+template <typename Func>
+void RunWithTaskCounter(engine::impl::TaskCounter& counter, Func func) {
+  std::thread thread([&] {
+    engine::impl::SetLocalTaskCounterData(counter, 0);
+    func();
+  });
+  thread.join();
+}
+
+}  // namespace
+
+TEST(AdaptiveSpinning, Hit) {
+  engine::impl::TaskCounter counter{1};
+  RunWithTaskCounter(counter, [&counter] {
+    engine::impl::AdaptiveSpinning spinning{1000, true};
+    FakeSemaphore semaphore{10};
+    spinning.Wait(semaphore, counter);
+    EXPECT_EQ(semaphore.waits, 0);
+  });
+
+  EXPECT_EQ(counter.GetSpinHits().value, 1);
+  EXPECT_EQ(counter.GetSpinMisses().value, 0);
+}
+
+TEST(AdaptiveSpinning, Miss) {
+  engine::impl::TaskCounter counter{1};
+  RunWithTaskCounter(counter, [&counter] {
+    engine::impl::AdaptiveSpinning spinning{1000, true};
+    FakeSemaphore semaphore{1'000'000};
+    spinning.Wait(semaphore, counter);
+    EXPECT_EQ(semaphore.waits, 1);
+  });
+
+  EXPECT_EQ(counter.GetSpinHits().value, 0);
+  EXPECT_EQ(counter.GetSpinMisses().value, 1);
+}
+
+TEST(AdaptiveSpinning, AdaptsToMisses) {
+  engine::impl::TaskCounter counter{1};
+  RunWithTaskCounter(counter, [&counter] {
+    engine::impl::AdaptiveSpinning spinning{1000, true};
+
+    // Spinning shrinks after the misses...
+    for (int i = 0; i < 10; ++i) {
+      FakeSemaphore semaphore{1'000'000};
+      spinning.Wait(semaphore, counter);
+    }
+
+    // ...so that a permit that appears late is not caught by spinning
+    FakeSemaphore semaphore{500};
+    spinning.Wait(semaphore, counter);
+    EXPECT_EQ(semaphore.waits, 1);
+  });
+
+  EXPECT_EQ(counter.GetSpinHits().value, 0);
+  EXPECT_EQ(counter.GetSpinMisses().value, 11);
+}
+
+TEST(AdaptiveSpinning, NonAdaptive) {
+  engine::impl::TaskCounter counter{1};
+  RunWithTaskCounter(counter, [&counter] {
+    engine::impl::AdaptiveSpinning spinning{1000, false};
+
+    for (int i = 0; i < 10; ++i) {
+      FakeSemaphore semaphore{1'000'000};
+      spinning.Wait(semaphore, counter);
+    }
+
+    FakeSemaphore semaphore{500};
+    spinning.Wait(semaphore, counter);
+    EXPECT_EQ(semaphore.waits, 0);
+  });
+
+  EXPECT_EQ(counter.GetSpinHits().value, 1);
+  EXPECT_EQ(counter.GetSpinMisses().value, 10);
+}
+
+USERVER_NAMESPACE_END
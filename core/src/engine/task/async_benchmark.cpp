@@ -1,7 +1,9 @@
 #include <benchmark/benchmark.h>
 
 #include <array>
+#include <atomic>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
@@ -17,7 +19,10 @@ using WrappedSpanCall =
     utils::impl::WrappedCallImplType<decltype(utils::impl::SpanLazyPrvalue("")),
                                      void (*)()>;
 
-}
+// A typical number of subtasks of a request in RPC fan-out code
+constexpr std::size_t kFanOutSubtasks = 20;
+
+}  // namespace
 
 // Note: We intentionally do not run this benchmark from RunStandalone to avoid
 // any side-effects (RunStandalone spawns additional std::threads and uses some
@@ -99,4 +104,78 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+void async_fan_out(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kFanOutSubtasks);
+    for (auto _ : state) {
+      for (std::size_t i = 0; i < kFanOutSubtasks; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([] {}));
+      }
+      for (auto& task : tasks) task.Wait();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * kFanOutSubtasks);
+  });
+}
+BENCHMARK(async_fan_out)->RangeMultiplier(2)->Range(1, 32);
+
+void async_fan_out_spanned(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kFanOutSubtasks);
+    for (auto _ : state) {
+      for (std::size_t i = 0; i < kFanOutSubtasks; ++i) {
+        tasks.push_back(utils::Async("", [] {}));
+      }
+      for (auto& task : tasks) task.Wait();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * kFanOutSubtasks);
+  });
+}
+BENCHMARK(async_fan_out_spanned)->RangeMultiplier(2)->Range(1, 32);
+
+// Every worker thread spawns and joins tasks, as the request handlers do
+void async_spawn_join_multiple_threads(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<std::uint64_t>> spawners;
+    spawners.reserve(state.range(0) - 1);
+
+    const auto spawn_join = [] { engine::AsyncNoSpan([] {}).Wait(); };
+    for (int i = 0; i < state.range(0) - 1; i++) {
+      spawners.push_back(engine::AsyncNoSpan([&] {
+        std::uint64_t spawned = 0;
+        while (keep_running) {
+          spawn_join();
+          ++spawned;
+        }
+        return spawned;
+      }));
+    }
+
+    std::uint64_t spawned = 0;
+    for (auto _ : state) {
+      spawn_join();
+      ++spawned;
+    }
+
+    keep_running = false;
+    for (auto& spawner : spawners) {
+      spawned += spawner.Get();
+    }
+
+    state.counters["tasks"] =
+        benchmark::Counter(spawned, benchmark::Counter::kIsRate);
+    state.counters["tasks/thread"] =
+        benchmark::Counter(static_cast<double>(spawned) / state.range(0),
+                           benchmark::Counter::kIsRate);
+  });
+}
+BENCHMARK(async_spawn_join_multiple_threads)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+
 USERVER_NAMESPACE_END
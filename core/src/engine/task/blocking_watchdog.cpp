@@ -0,0 +1,180 @@
+#include <engine/task/blocking_watchdog.hpp>
+
+#include <signal.h>
+
+#include <algorithm>
+#include <cerrno>
+
+#include <boost/stacktrace/safe_dump_to.hpp>
+#include <boost/stacktrace/stacktrace.hpp>
+
+#include <logging/log_extra_stacktrace.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/thread_name.hpp>
+#include <utils/check_syscall.hpp>
+#include <utils/strerror.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// The default action of SIGURG is to ignore it, so a late signal to a thread
+// without the handler is harmless
+constexpr int kStacktraceSignal = SIGURG;
+
+// The signal handler and the signal trampoline
+constexpr std::size_t kSkippedFrames = 2;
+
+constexpr std::chrono::milliseconds kStacktraceWaitTime{50};
+
+thread_local BlockingWatchdog::Worker* current_worker = nullptr;
+
+std::uint64_t NowMs() noexcept {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             utils::datetime::SteadyCoarseClock::now().time_since_epoch())
+      .count();
+}
+
+void OnStacktraceSignal(int) noexcept {
+  const auto saved_errno = errno;
+  auto* worker = current_worker;
+  if (worker && worker->is_stacktrace_requested.exchange(false)) {
+    boost::stacktrace::safe_dump_to(kSkippedFrames, worker->frames,
+                                    sizeof(worker->frames));
+    worker->has_stacktrace.store(true, std::memory_order_release);
+  }
+  errno = saved_errno;
+}
+
+void InstallSignalHandler() {
+  [[maybe_unused]] static const bool kInstalled = [] {
+    // The first unwinding loads the unwinder, that is not async-signal-safe
+    BlockingWatchdog::Worker::Frame frames[2]{};
+    boost::stacktrace::safe_dump_to(frames, sizeof(frames));
+
+    struct sigaction action {};
+    action.sa_handler = &OnStacktraceSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    utils::CheckSyscall(sigaction(kStacktraceSignal, &action, nullptr),
+                        "setting {} handler",
+                        utils::strsignal(kStacktraceSignal));
+    return true;
+  }();
+}
+
+}  // namespace
+
+BlockingWatchdog::BlockingWatchdog(std::string task_processor_name,
+                                   std::size_t worker_count,
+                                   std::chrono::milliseconds threshold)
+    : task_processor_name_(std::move(task_processor_name)),
+      threshold_(threshold),
+      workers_(worker_count) {
+  UASSERT(threshold_.count() > 0);
+  InstallSignalHandler();
+  thread_ = std::thread{[this] { Run(); }};
+}
+
+BlockingWatchdog::~BlockingWatchdog() { Stop(); }
+
+void BlockingWatchdog::RegisterWorker(std::size_t worker_index) noexcept {
+  auto& worker = workers_[worker_index];
+  worker.thread = pthread_self();
+  current_worker = &worker;
+  worker.is_registered.store(true, std::memory_order_release);
+}
+
+void BlockingWatchdog::StartStep(std::size_t worker_index) noexcept {
+  auto& worker = workers_[worker_index];
+  worker.step_id.store(worker.step_id.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+  worker.step_started_ms.store(NowMs(), std::memory_order_relaxed);
+}
+
+void BlockingWatchdog::FinishStep(std::size_t worker_index) noexcept {
+  workers_[worker_index].step_started_ms.store(0, std::memory_order_relaxed);
+}
+
+void BlockingWatchdog::Stop() noexcept {
+  {
+    const std::lock_guard lock(mutex_);
+    if (is_stopped_) return;
+    is_stopped_ = true;
+  }
+  stop_cv_.notify_all();
+  if (thread_.joinable()) thread_.join();
+}
+
+void BlockingWatchdog::Run() {
+  utils::SetCurrentThreadName("blocking-watch");
+
+  const auto period = std::max(threshold_ / 4, std::chrono::milliseconds{1});
+  std::unique_lock lock(mutex_);
+  while (!stop_cv_.wait_for(lock, period, [this] { return is_stopped_; })) {
+    lock.unlock();
+    const auto now_ms = NowMs();
+    for (std::size_t i = 0; i < workers_.size(); ++i) {
+      CheckWorker(i, now_ms);
+    }
+    lock.lock();
+  }
+}
+
+void BlockingWatchdog::CheckWorker(std::size_t worker_index,
+                                   std::uint64_t now_ms) {
+  auto& worker = workers_[worker_index];
+  if (!worker.is_registered.load(std::memory_order_acquire)) return;
+
+  const auto started_ms =
+      worker.step_started_ms.load(std::memory_order_relaxed);
+  if (started_ms == 0 ||
+      now_ms < started_ms + static_cast<std::uint64_t>(threshold_.count())) {
+    return;
+  }
+
+  // Each step is reported once
+  const auto step_id = worker.step_id.load(std::memory_order_relaxed);
+  if (step_id == worker.reported_step_id) return;
+  worker.reported_step_id = step_id;
+
+  worker.has_stacktrace.store(false);
+  worker.is_stacktrace_requested.store(true);
+  if (pthread_kill(worker.thread, kStacktraceSignal) == 0) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + kStacktraceWaitTime;
+    while (!worker.has_stacktrace.load(std::memory_order_acquire) &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+  }
+  worker.is_stacktrace_requested.store(false);
+
+  // The stacktrace is useless if the worker has moved on to another step
+  const bool has_stacktrace =
+      worker.has_stacktrace.load(std::memory_order_acquire) &&
+      worker.step_id.load(std::memory_order_relaxed) == step_id &&
+      worker.step_started_ms.load(std::memory_order_relaxed) != 0;
+
+  logging::LogExtra log_extra;
+  if (has_stacktrace) {
+    logging::impl::ExtendLogExtraWithStacktrace(
+        log_extra, boost::stacktrace::stacktrace::from_dump(
+                       worker.frames, sizeof(worker.frames)));
+  }
+
+  LOG_ERROR() << "Worker thread #" << worker_index << " of task_processor "
+              << task_processor_name_ << " is running a task for "
+              << now_ms - started_ms
+              << "ms without a context switch, probably it is blocked by a "
+                 "syscall or a long computation (blocking-watchdog-threshold="
+              << threshold_.count() << "ms)" << std::move(log_extra);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <pthread.h>
+
+#include <boost/stacktrace/frame.hpp>
+
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Detects the tasks that hold a worker thread of a task processor for longer
+// than the threshold without a context switch, e.g. because of a blocking
+// syscall. The stacktrace of such worker is taken with a signal and logged
+// along with the duration of the step.
+class BlockingWatchdog final {
+ public:
+  // The state of a worker thread, the signal handler of the thread accesses
+  // it via a thread_local pointer
+  struct alignas(64) Worker final {
+    using Frame = boost::stacktrace::frame::native_frame_ptr_t;
+
+    static constexpr std::size_t kMaxFrames = 64;
+
+    // SteadyCoarseClock milliseconds of the step start, 0 if the worker is idle
+    std::atomic<std::uint64_t> step_started_ms{0};
+    std::atomic<std::uint64_t> step_id{0};
+    std::uint64_t reported_step_id{0};  // accessed from the watchdog only
+
+    std::atomic<bool> is_registered{false};
+    pthread_t thread{};
+
+    // Filled by the signal handler of the worker thread
+    std::atomic<bool> is_stacktrace_requested{false};
+    std::atomic<bool> has_stacktrace{false};
+    Frame frames[kMaxFrames]{};
+  };
+
+  BlockingWatchdog(std::string task_processor_name, std::size_t worker_count,
+                   std::chrono::milliseconds threshold);
+
+  BlockingWatchdog(const BlockingWatchdog&) = delete;
+  BlockingWatchdog& operator=(const BlockingWatchdog&) = delete;
+  ~BlockingWatchdog();
+
+  // Must be called from the worker thread before its first step
+  void RegisterWorker(std::size_t worker_index) noexcept;
+
+  // Must be called from the worker thread around each TaskContext::DoStep()
+  void StartStep(std::size_t worker_index) noexcept;
+  void FinishStep(std::size_t worker_index) noexcept;
+
+  // Must be called before the worker threads stop
+  void Stop() noexcept;
+
+ private:
+  void Run();
+  void CheckWorker(std::size_t worker_index, std::uint64_t now_ms);
+
+  const std::string task_processor_name_;
+  const std::chrono::milliseconds threshold_;
+  utils::FixedArray<Worker> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable stop_cv_;
+  bool is_stopped_{false};
+  std::thread thread_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
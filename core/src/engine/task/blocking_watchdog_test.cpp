@@ -0,0 +1,57 @@
+#include <engine/task/blocking_watchdog.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kThreshold{20};
+
+using BlockingWatchdog = LoggingTest;
+
+}  // namespace
+
+TEST_F(BlockingWatchdog, ReportsLongStep) {
+  engine::impl::BlockingWatchdog watchdog{"test-task-processor", 1,
+                                          kThreshold};
+  watchdog.RegisterWorker(0);
+
+  watchdog.StartStep(0);
+  std::this_thread::sleep_for(kThreshold * 10);
+  watchdog.FinishStep(0);
+  watchdog.Stop();
+  logging::LogFlush();
+
+  const auto log = GetStreamString();
+  EXPECT_NE(log.find("Worker thread #0 of task_processor test-task-processor"),
+            std::string::npos)
+      << log;
+  EXPECT_NE(log.find("stacktrace="), std::string::npos) << log;
+  // Each step is reported once
+  EXPECT_EQ(GetRecordsCount(), 1) << log;
+}
+
+TEST_F(BlockingWatchdog, IgnoresShortSteps) {
+  engine::impl::BlockingWatchdog watchdog{"test-task-processor", 2,
+                                          kThreshold};
+  watchdog.RegisterWorker(0);
+
+  for (int i = 0; i < 20; ++i) {
+    watchdog.StartStep(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    watchdog.FinishStep(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  watchdog.Stop();
+  logging::LogFlush();
+
+  EXPECT_EQ(GetRecordsCount(), 0) << GetStreamString();
+}
+
+USERVER_NAMESPACE_END
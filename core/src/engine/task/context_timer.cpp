@@ -13,6 +13,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Shorter timers stay in libev: the wheel may fire up to a tick late, which
+// is too coarse for them
+constexpr auto kTimerWheelMinDelay = 10 * ev::TimerWheel::kTick;
+
+}  // namespace
+
 class ContextTimer::Impl final : public ev::MultiShotAsyncPayload<Impl> {
  public:
   Impl();
@@ -36,6 +44,7 @@ class ContextTimer::Impl final : public ev::MultiShotAsyncPayload<Impl> {
   void DoFinalize();
 
   static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnWheelTimer(void* data) noexcept;
   void DoOnTimer();
 
   class Finalizer final : public ev::SingleShotAsyncPayload<Finalizer> {
@@ -56,11 +65,13 @@ class ContextTimer::Impl final : public ev::MultiShotAsyncPayload<Impl> {
   std::optional<ev::ThreadControl> thread_control_;
   Params params_;
   ev_timer timer_{};
+  ev::TimerWheel::Timer wheel_timer_;
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
   Finalizer finalizer_;
 };
 
-ContextTimer::Impl::Impl() : finalizer_(*this) {
+ContextTimer::Impl::Impl()
+    : wheel_timer_(&OnWheelTimer, this), finalizer_(*this) {
   timer_.data = this;
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_init(&timer_, OnTimer);
@@ -118,9 +129,9 @@ void ContextTimer::Impl::DoPerformAndRelease() {
 
 void ContextTimer::Impl::ArmTimerInEvThread() {
   using LibEvDuration = std::chrono::duration<double>;
+  const auto time_left_duration = params_.deadline.TimeLeft();
   const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
+      std::chrono::duration_cast<LibEvDuration>(time_left_duration).count();
 
   LOG_TRACE() << "time_left=" << time_left;
   if (time_left <= 0.0) {
@@ -129,12 +140,23 @@ void ContextTimer::Impl::ArmTimerInEvThread() {
     return;
   }
 
+  const bool has_timer_wheel = thread_control_->HasTimerWheel();
+  if (has_timer_wheel && params_.deadline.IsReachable() &&
+      time_left_duration >= kTimerWheelMinDelay) {
+    thread_control_->Stop(timer_);
+    thread_control_->Start(wheel_timer_,
+                           Deadline::Clock::now() + time_left_duration);
+    return;
+  }
+
+  if (has_timer_wheel) thread_control_->Stop(wheel_timer_);
   timer_.repeat = time_left;
   thread_control_->Again(timer_);
 }
 
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   thread_control_->Stop(timer_);
+  if (thread_control_->HasTimerWheel()) thread_control_->Stop(wheel_timer_);
 }
 
 void ContextTimer::Impl::DoFinalize() {
@@ -154,6 +176,12 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnWheelTimer(void* data) noexcept {
+  auto* ev_timer = static_cast<Impl*>(data);
+  UASSERT(ev_timer != nullptr);
+  ev_timer->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
   try {
     // do not keep the function object around for much longer
@@ -18,7 +18,13 @@ CountedCoroutinePtr::CoroPool::Coroutine& CountedCoroutinePtr::operator*() {
 }
 
 void CountedCoroutinePtr::ReturnToPool() && {
-  if (coro_) std::move(*coro_).ReturnToPool();
+  if (coro_) {
+    if (const auto stack_usage = coro_->SampleStackUsage()) {
+      UASSERT(token_);
+      token_->GetCounter().AccountStackUsage(*stack_usage);
+    }
+    std::move(*coro_).ReturnToPool();
+  }
   token_ = std::nullopt;
 }
 
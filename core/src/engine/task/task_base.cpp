@@ -168,10 +168,7 @@ TaskProcessor& GetTaskProcessor() {
 }
 
 std::size_t GetStackSize() {
-  return GetTaskProcessor()
-      .GetTaskProcessorPools()
-      ->GetCoroPool()
-      .GetStackSize();
+  return GetTaskProcessor().GetCoroStackSize();
 }
 
 ev::ThreadControl& GetEventThread() {
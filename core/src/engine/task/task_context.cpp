@@ -22,6 +22,8 @@
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/task_processor.hpp>
 #include <utils/impl/assert_extra.hpp>
+#include <utils/jemalloc.hpp>
+#include <utils/task_cpu_usage.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -76,17 +78,25 @@ auto ReadableTaskId(const TaskContext* task) noexcept {
 class CurrentTaskScope final {
  public:
   explicit CurrentTaskScope(TaskContext& context, EhGlobals& eh_store)
-      : eh_store_(eh_store) {
+      : context_(context), eh_store_(eh_store) {
     current_task::SetCurrentTaskContext(&context);
     ExchangeEhGlobals(eh_store_);
+    if (const auto arena = context_.GetMemoryArena()) {
+      utils::jemalloc::SetThreadArena(arena);
+    }
   }
 
   ~CurrentTaskScope() {
+    // The task may have left its utils::jemalloc::ArenaScope by now
+    if (context_.GetMemoryArena()) {
+      utils::jemalloc::SetThreadArena(std::nullopt);
+    }
     ExchangeEhGlobals(eh_store_);
     current_task::SetCurrentTaskContext(nullptr);
   }
 
  private:
+  TaskContext& context_;
   EhGlobals& eh_store_;
 };
 
@@ -102,16 +112,20 @@ auto* const kFinishedDetachedToken =
 
 TaskContext::TaskContext(TaskProcessor& task_processor,
                          Task::Importance importance, Task::WaitMode wait_type,
-                         Deadline deadline,
+                         Deadline deadline, Task::Priority priority,
                          utils::impl::WrappedCallBase& payload)
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      priority_(priority),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
   UASSERT(payload_);
+  if (const auto* parent = current_task::GetCurrentTaskContextUnchecked()) {
+    memory_arena_ = parent->memory_arena_;
+  }
   LOG_TRACE() << "task with task_id="
               << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
               << " created task with task_id=" << ReadableTaskId(this)
@@ -449,22 +463,14 @@ void TaskContext::Wakeup(WakeupSource source, SleepState::Epoch epoch) {
 }
 
 void TaskContext::Wakeup(WakeupSource source, NoEpoch) {
-  UASSERT(source != WakeupSource::kDeadlineTimer);
-  UASSERT(source != WakeupSource::kBootstrap);
-  UASSERT(source != WakeupSource::kCancelRequest);
+  if (SetWakeupFlag(source)) Schedule();
+}
 
-  if (IsFinished()) return;
+void TaskContext::Wakeup(WakeupSource source, NoEpoch, WakeupBatch& batch) {
+  if (!SetWakeupFlag(source)) return;
 
-  // Set flag regardless of kSleeping - missing kSleeping usually means one of
-  // the following: 1) the task is somewhere between Sleep() and setting
-  // kSleeping in DoStep(). 2) the task is already awaken, but DisableWakeups()
-  // is not yet finished (and not all timers/watchers are stopped).
-  const auto prev_sleep_state =
-      sleep_state_.FetchOrFlags<std::memory_order_seq_cst>(
-          static_cast<SleepFlags>(source));
-  if (ShouldSchedule(prev_sleep_state.flags, source)) {
-    Schedule();
-  }
+  MarkQueued();
+  batch.Add(*this);
 }
 
 void TaskContext::WakeupCurrent() {
@@ -528,6 +534,8 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
       }
     }
 
+    // The time after the last span of the task
+    utils::task_cpu_usage::ChargeCurrentTask({});
     context->ProfilerStopExecution();
 
     context->task_pipe_ = nullptr;
@@ -662,15 +670,52 @@ void TaskContext::SetState(Task::State new_state) {
   }
 }
 
-void TaskContext::Schedule() {
+bool TaskContext::SetWakeupFlag(WakeupSource source) {
+  UASSERT(source != WakeupSource::kDeadlineTimer);
+  UASSERT(source != WakeupSource::kBootstrap);
+  UASSERT(source != WakeupSource::kCancelRequest);
+
+  if (IsFinished()) return false;
+
+  // Set flag regardless of kSleeping - missing kSleeping usually means one of
+  // the following: 1) the task is somewhere between Sleep() and setting
+  // kSleeping in DoStep(). 2) the task is already awaken, but DisableWakeups()
+  // is not yet finished (and not all timers/watchers are stopped).
+  const auto prev_sleep_state =
+      sleep_state_.FetchOrFlags<std::memory_order_seq_cst>(
+          static_cast<SleepFlags>(source));
+  return ShouldSchedule(prev_sleep_state.flags, source);
+}
+
+void TaskContext::MarkQueued() {
   UASSERT(state_ != Task::State::kQueued);
   SetState(Task::State::kQueued);
   TraceStateTransition(Task::State::kQueued);
+}
+
+void TaskContext::Schedule() {
+  MarkQueued();
   task_processor_.Schedule(this);
   // NOTE: may be executed at this point
 }
 
+std::chrono::nanoseconds TaskContext::TakeCpuTime() noexcept {
+  UASSERT(IsCurrent());
+  if (!utils::task_cpu_usage::IsEnabled()) return {};
+
+  const auto now = utils::task_cpu_usage::GetThreadCpuTime();
+  auto result = untaken_cpu_time_;
+  if (cpu_slice_started_.count() != 0) result += now - cpu_slice_started_;
+  cpu_slice_started_ = now;
+  untaken_cpu_time_ = {};
+  return result;
+}
+
 void TaskContext::ProfilerStartExecution() {
+  cpu_slice_started_ = utils::task_cpu_usage::IsEnabled()
+                           ? utils::task_cpu_usage::GetThreadCpuTime()
+                           : std::chrono::nanoseconds{};
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
     execute_started_ = std::chrono::steady_clock::now();
@@ -680,6 +725,12 @@ void TaskContext::ProfilerStartExecution() {
 }
 
 void TaskContext::ProfilerStopExecution() {
+  if (cpu_slice_started_.count() != 0) {
+    untaken_cpu_time_ +=
+        utils::task_cpu_usage::GetThreadCpuTime() - cpu_slice_started_;
+    cpu_slice_started_ = {};
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() <= 0) return;
 
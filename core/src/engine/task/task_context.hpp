@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -16,6 +18,7 @@
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_counter.hpp>
+#include <engine/task/wakeup_batch.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
@@ -79,7 +82,7 @@ class TaskContext final : public ContextAccessor {
   };
 
   TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline,
-              utils::impl::WrappedCallBase& payload);
+              Task::Priority, utils::impl::WrappedCallBase& payload);
 
   ~TaskContext() noexcept;
 
@@ -100,6 +103,8 @@ class TaskContext final : public ContextAccessor {
   // exceeding these limits causes task to become cancelled
   bool IsCritical() const;
 
+  Task::Priority GetPriority() const noexcept { return priority_; }
+
   // whether task is allowed to be awaited from multiple coroutines
   // simultaneously
   bool IsSharedWaitAllowed() const;
@@ -153,6 +158,9 @@ class TaskContext final : public ContextAccessor {
   // normally non-blocking, except corner cases in TaskProcessor::Schedule()
   void Wakeup(WakeupSource, SleepState::Epoch epoch);
   void Wakeup(WakeupSource, NoEpoch);
+  // Same as Wakeup(source, NoEpoch), but if the task has to be scheduled, it
+  // is added to the batch instead
+  void Wakeup(WakeupSource, NoEpoch, WakeupBatch& batch);
   void WakeupCurrent();
 
   static void CoroFunc(TaskPipe& task_pipe);
@@ -175,6 +183,31 @@ class TaskContext final : public ContextAccessor {
   bool HasLocalStorage() const noexcept;
   task_local::Storage& GetLocalStorage() noexcept;
 
+  // The name of the innermost span, that is published for utils::cpu_profiler
+  // and is read from the signal handler of the current thread
+  struct ProfiledSpan final {
+    static constexpr std::size_t kMaxNameSize = 48;
+
+    // Id of the profiling session that published the name, 0 if none
+    std::atomic<std::uint64_t> session_id{0};
+    std::array<char, kMaxNameSize> name{};
+  };
+
+  ProfiledSpan& GetProfiledSpan() noexcept { return profiled_span_; }
+
+  // Returns the CPU time consumed by the task since the previous call, if
+  // utils::task_cpu_usage is enabled. Must be called from the task.
+  std::chrono::nanoseconds TakeCpuTime() noexcept;
+
+  // jemalloc arena of the task allocations, see utils::jemalloc::ArenaScope.
+  // Is inherited by the tasks started from the task.
+  std::optional<unsigned> GetMemoryArena() const noexcept {
+    return memory_arena_;
+  }
+  void SetMemoryArena(std::optional<unsigned> arena) noexcept {
+    memory_arena_ = arena;
+  }
+
   // ContextAccessor implementation
   bool IsReady() const noexcept final;
   void AppendWaiter(impl::TaskContext& context) noexcept final;
@@ -202,6 +235,10 @@ class TaskContext final : public ContextAccessor {
   bool WasStartedAsCritical() const;
   void SetState(Task::State);
 
+  // Returns whether the task has to be scheduled
+  bool SetWakeupFlag(WakeupSource source);
+  void MarkQueued();
+
   void Schedule();
   static bool ShouldSchedule(SleepState::Flags flags, WakeupSource source);
 
@@ -218,6 +255,7 @@ class TaskContext final : public ContextAccessor {
   const bool is_critical_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
+  const Task::Priority priority_;
   EhGlobals eh_globals_;
 
   utils::impl::WrappedCallBase* payload_;
@@ -237,6 +275,7 @@ class TaskContext final : public ContextAccessor {
   std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
   size_t trace_csw_left_;
+  std::optional<unsigned> memory_arena_;
 
   AtomicSleepState sleep_state_{
       SleepState{SleepFlags::kSleeping, SleepState::Epoch{0}}};
@@ -248,6 +287,14 @@ class TaskContext final : public ContextAccessor {
 
   std::optional<task_local::Storage> local_storage_{};
 
+  ProfiledSpan profiled_span_;
+
+  // Thread CPU time at the start of the current execution slice, {} if the
+  // slice is not accounted
+  std::chrono::nanoseconds cpu_slice_started_{};
+  // CPU time of the finished slices since the last TakeCpuTime()
+  std::chrono::nanoseconds untaken_cpu_time_{};
+
   // refcounter for task abandoning (cancellation) in engine::SharedTask
   std::atomic<std::size_t> shared_task_usages_{1};
 
@@ -56,6 +56,11 @@ TaskCounter::CoroToken& TaskCounter::CoroToken::operator=(
   return *this;
 }
 
+TaskCounter& TaskCounter::CoroToken::GetCounter() const noexcept {
+  UASSERT(counter_);
+  return *counter_;
+}
+
 TaskCounter::TaskCounter(std::size_t thread_count)
     : local_counters_(thread_count) {}
 
@@ -125,6 +130,37 @@ Rate TaskCounter::GetSpuriousWakeups() const noexcept {
   return GetApproximate(LocalCounterId::kSpuriousWakeups);
 }
 
+Rate TaskCounter::GetSpinHits() const noexcept {
+  return GetApproximate(LocalCounterId::kSpinHits);
+}
+
+Rate TaskCounter::GetSpinMisses() const noexcept {
+  return GetApproximate(LocalCounterId::kSpinMisses);
+}
+
+const TaskCounter::StackUsagePercentile& TaskCounter::GetStackUsage()
+    const noexcept {
+  return stack_usage_;
+}
+
+const TaskCounter::QueueWaitPercentile& TaskCounter::GetQueueWait(
+    Task::Priority priority) const noexcept {
+  return queue_wait_[static_cast<std::size_t>(priority)];
+}
+
+const TaskCounter::QueueWaitHistogram& TaskCounter::GetQueueWaitHistogram()
+    const noexcept {
+  return queue_wait_histogram_;
+}
+
+Rate TaskCounter::GetTaskLocalArenaUsedBytes() const noexcept {
+  return task_local_arena_used_bytes_.Load();
+}
+
+Rate TaskCounter::GetTaskLocalArenaReservedBytes() const noexcept {
+  return task_local_arena_reserved_bytes_.Load();
+}
+
 void TaskCounter::AccountTaskCancel() noexcept {
   Increment(LocalCounterId::kCancelled);
 }
@@ -157,6 +193,35 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountSpinHit() noexcept {
+  Increment(LocalCounterId::kSpinHits);
+}
+
+void TaskCounter::AccountSpinMiss() noexcept {
+  Increment(LocalCounterId::kSpinMisses);
+}
+
+void TaskCounter::AccountStackUsage(std::size_t bytes) noexcept {
+  // Round up, so that any used stack is never reported as 0KiB
+  stack_usage_.Account((bytes + 1023) / 1024);
+}
+
+void TaskCounter::AccountQueueWait(
+    Task::Priority priority, std::chrono::microseconds wait_time) noexcept {
+  const auto wait_time_us = std::max<std::int64_t>(wait_time.count(), 0);
+  queue_wait_[static_cast<std::size_t>(priority)].Account(wait_time_us);
+  // Background tasks are expected to wait in the queue
+  if (priority != Task::Priority::kBackground) {
+    queue_wait_histogram_.Account(wait_time_us);
+  }
+}
+
+void TaskCounter::AccountTaskLocalArena(std::size_t used_bytes,
+                                        std::size_t reserved_bytes) noexcept {
+  task_local_arena_used_bytes_ += Rate{used_bytes};
+  task_local_arena_reserved_bytes_ += Rate{reserved_bytes};
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -7,8 +7,12 @@
 #include <cstdint>
 
 #include <concurrent/impl/interference_shield.hpp>
+#include <userver/engine/task/task.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
+#include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,6 +25,20 @@ class TaskCounter final {
   class Token;
   class CoroToken;
 
+  // Coroutine stack high-water marks, KiB. Precise up to 256KiB, then with
+  // 64KiB precision up to ~8MiB.
+  using StackUsagePercentile =
+      utils::statistics::Percentile<256, std::uint32_t, 120, 64>;
+
+  // Task queue wait times, microseconds. Precise up to 1ms, then with 1ms
+  // precision up to ~0.5s.
+  using QueueWaitPercentile =
+      utils::statistics::Percentile<1000, std::uint64_t, 500, 1000>;
+
+  // Task queue wait times of the non-background tasks, microseconds. The
+  // relative error is within 12.5% up to 1s.
+  using QueueWaitHistogram = utils::statistics::HdrHistogram<1'000'000>;
+
   explicit TaskCounter(std::size_t thread_count);
 
   ~TaskCounter();
@@ -55,6 +73,21 @@ class TaskCounter final {
 
   Rate GetSpuriousWakeups() const noexcept;
 
+  Rate GetSpinHits() const noexcept;
+
+  Rate GetSpinMisses() const noexcept;
+
+  const StackUsagePercentile& GetStackUsage() const noexcept;
+
+  const QueueWaitPercentile& GetQueueWait(Task::Priority) const noexcept;
+
+  const QueueWaitHistogram& GetQueueWaitHistogram() const noexcept;
+
+  // Bytes allocated from and reserved by the finished engine::TaskLocalArena
+  Rate GetTaskLocalArenaUsedBytes() const noexcept;
+
+  Rate GetTaskLocalArenaReservedBytes() const noexcept;
+
   void AccountTaskCancel() noexcept;
 
   void AccountTaskCancelOverload() noexcept;
@@ -71,6 +104,18 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  void AccountSpinHit() noexcept;
+
+  void AccountSpinMiss() noexcept;
+
+  void AccountStackUsage(std::size_t bytes) noexcept;
+
+  void AccountQueueWait(Task::Priority,
+                        std::chrono::microseconds wait_time) noexcept;
+
+  void AccountTaskLocalArena(std::size_t used_bytes,
+                             std::size_t reserved_bytes) noexcept;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -95,6 +140,8 @@ class TaskCounter final {
     kOverload,
     kOverloadSensor,
     kNoOverloadSensor,
+    kSpinHits,
+    kSpinMisses,
 
     kCountersSize,
   };
@@ -123,6 +170,11 @@ class TaskCounter final {
 
   GlobalCounterPack global_counters_;
   utils::FixedArray<LocalCounterPack> local_counters_;
+  StackUsagePercentile stack_usage_;
+  std::array<QueueWaitPercentile, 3> queue_wait_;
+  QueueWaitHistogram queue_wait_histogram_;
+  utils::statistics::ShardedRateCounter task_local_arena_used_bytes_;
+  utils::statistics::ShardedRateCounter task_local_arena_reserved_bytes_;
 };
 
 class TaskCounter::Token final {
@@ -149,6 +201,8 @@ class TaskCounter::CoroToken final {
   CoroToken& operator=(CoroToken&& rhs) noexcept;
   ~CoroToken();
 
+  TaskCounter& GetCounter() const noexcept;
+
  private:
   TaskCounter* counter_;
 };
@@ -0,0 +1,157 @@
+#include <userver/engine/task/task_local_arena.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_counter.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/task/local_variable.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kChunkSize = 16 * 1024;
+
+// Larger allocations would waste too much of the chunks
+constexpr std::size_t kMaxBumpAllocation = kChunkSize / 4;
+
+constexpr std::size_t kMaxBumpAlignment = alignof(std::max_align_t);
+
+// 64MiB of idle chunks at most
+constexpr std::size_t kMaxIdleChunks = 4096;
+
+constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Free list of the chunks shared by all the arenas, like the coroutine pool
+class ChunkPool final {
+ public:
+  ~ChunkPool() {
+    void* chunk = nullptr;
+    while (chunks_.try_dequeue(chunk)) ::operator delete(chunk);
+  }
+
+  void* Get() {
+    void* chunk = nullptr;
+    if (chunks_.try_dequeue(chunk)) {
+      idle_chunks_.fetch_sub(1, std::memory_order_relaxed);
+      return chunk;
+    }
+    return ::operator new(kChunkSize);
+  }
+
+  void Put(void* chunk) noexcept {
+    if (idle_chunks_.fetch_add(1, std::memory_order_relaxed) >=
+            kMaxIdleChunks ||
+        !chunks_.enqueue(chunk)) {
+      idle_chunks_.fetch_sub(1, std::memory_order_relaxed);
+      ::operator delete(chunk);
+    }
+  }
+
+ private:
+  moodycamel::ConcurrentQueue<void*> chunks_;
+  std::atomic<std::size_t> idle_chunks_{0};
+};
+
+ChunkPool& GetChunkPool() {
+  static ChunkPool pool;
+  return pool;
+}
+
+engine::TaskLocalVariable<TaskLocalArena> task_local_arena;
+
+}  // namespace
+
+struct TaskLocalArena::ChunkHeader final {
+  ChunkHeader* next;
+};
+
+struct TaskLocalArena::LargeHeader final {
+  LargeHeader* next;
+  std::size_t alignment;
+};
+
+TaskLocalArena& TaskLocalArena::GetCurrent() { return *task_local_arena; }
+
+TaskLocalArena::TaskLocalArena() noexcept : task_counter_(nullptr) {
+  if (auto* context = current_task::GetCurrentTaskContextUnchecked()) {
+    task_counter_ = &context->GetTaskProcessor().GetTaskCounter();
+  }
+}
+
+TaskLocalArena::~TaskLocalArena() {
+  while (chunks_) {
+    auto* const next = chunks_->next;
+    GetChunkPool().Put(chunks_);
+    chunks_ = next;
+  }
+  while (large_allocations_) {
+    auto* const next = large_allocations_->next;
+    ::operator delete(large_allocations_,
+                      std::align_val_t{large_allocations_->alignment});
+    large_allocations_ = next;
+  }
+
+  if (task_counter_ && used_bytes_ != 0) {
+    task_counter_->AccountTaskLocalArena(used_bytes_, reserved_bytes_);
+  }
+}
+
+void* TaskLocalArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  used_bytes_ += bytes;
+  if (auto* result = TryBump(bytes, alignment)) return result;
+
+  if (bytes > kMaxBumpAllocation || alignment > kMaxBumpAlignment) {
+    return AllocateLarge(bytes, alignment);
+  }
+
+  auto* const chunk = static_cast<ChunkHeader*>(GetChunkPool().Get());
+  chunk->next = chunks_;
+  chunks_ = chunk;
+  reserved_bytes_ += kChunkSize;
+  current_ = reinterpret_cast<std::byte*>(chunk) + sizeof(ChunkHeader);
+  end_ = reinterpret_cast<std::byte*>(chunk) + kChunkSize;
+
+  auto* const result = TryBump(bytes, alignment);
+  UASSERT(result);
+  return result;
+}
+
+void* TaskLocalArena::TryBump(std::size_t bytes,
+                              std::size_t alignment) noexcept {
+  if (!current_) return nullptr;
+
+  const auto begin = AlignUp(reinterpret_cast<std::uintptr_t>(current_),
+                             alignment);
+  if (begin + bytes > reinterpret_cast<std::uintptr_t>(end_)) return nullptr;
+
+  current_ = reinterpret_cast<std::byte*>(begin + bytes);
+  return reinterpret_cast<void*>(begin);
+}
+
+void* TaskLocalArena::AllocateLarge(std::size_t bytes, std::size_t alignment) {
+  alignment = std::max(alignment, alignof(LargeHeader));
+  const auto header_size = AlignUp(sizeof(LargeHeader), alignment);
+  auto* const header = static_cast<LargeHeader*>(
+      ::operator new(header_size + bytes, std::align_val_t{alignment}));
+  header->next = large_allocations_;
+  header->alignment = alignment;
+  large_allocations_ = header;
+  reserved_bytes_ += header_size + bytes;
+  return reinterpret_cast<std::byte*>(header) + header_size;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,99 @@
+#include <userver/engine/task/task_local_arena.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_counter.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsAligned(const void* ptr, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+UTEST(TaskLocalArena, Sample) {
+  /// [Sample engine::TaskLocalArena usage]
+  auto& arena = engine::TaskLocalArena::GetCurrent();
+
+  // The memory is freed at once when the task finishes
+  std::pmr::vector<int> values{&arena};
+  std::pmr::map<int, std::pmr::string> names{&arena};
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(i);
+    names.emplace(i, "some long enough name to allocate");
+  }
+  /// [Sample engine::TaskLocalArena usage]
+
+  EXPECT_EQ(values.size(), 100);
+  EXPECT_EQ(names.at(42), "some long enough name to allocate");
+  EXPECT_GT(arena.GetUsedBytes(), 0);
+  EXPECT_GE(arena.GetReservedBytes(), arena.GetUsedBytes());
+}
+
+UTEST(TaskLocalArena, SameArenaInTask) {
+  auto& arena = engine::TaskLocalArena::GetCurrent();
+  engine::Yield();
+  EXPECT_EQ(&engine::TaskLocalArena::GetCurrent(), &arena);
+
+  const auto* other_arena = utils::Async("other", [] {
+                              return &engine::TaskLocalArena::GetCurrent();
+                            }).Get();
+  EXPECT_NE(other_arena, &arena);
+}
+
+UTEST(TaskLocalArena, Alignment) {
+  engine::TaskLocalArena arena;
+  for (const std::size_t alignment : {1, 2, 8, 16, 64, 4096}) {
+    for (const std::size_t size : {1, 3, 100, 5000, 100000}) {
+      auto* ptr = arena.allocate(size, alignment);
+      EXPECT_TRUE(IsAligned(ptr, alignment)) << size << ' ' << alignment;
+      std::fill_n(static_cast<char*>(ptr), size, 'a');
+      arena.deallocate(ptr, size, alignment);
+    }
+  }
+}
+
+UTEST(TaskLocalArena, DistinctAllocations) {
+  engine::TaskLocalArena arena;
+  std::vector<char*> allocations;
+  for (std::size_t i = 0; i < 10000; ++i) {
+    const auto size = 1 + i % 100;
+    auto* ptr = static_cast<char*>(arena.allocate(size, 1));
+    std::fill_n(ptr, size, static_cast<char>(i));
+    allocations.push_back(ptr);
+  }
+
+  for (std::size_t i = 0; i < allocations.size(); ++i) {
+    const auto size = 1 + i % 100;
+    for (std::size_t j = 0; j < size; ++j) {
+      ASSERT_EQ(allocations[i][j], static_cast<char>(i));
+    }
+  }
+}
+
+UTEST(TaskLocalArena, TaskProcessorStats) {
+  const auto& counter =
+      engine::current_task::GetTaskProcessor().GetTaskCounter();
+  const auto used_before = counter.GetTaskLocalArenaUsedBytes();
+
+  utils::Async("arena-user", [] {
+    engine::TaskLocalArena::GetCurrent().allocate(1000);
+  }).Get();
+
+  EXPECT_EQ(counter.GetTaskLocalArenaUsedBytes().value - used_before.value,
+            1000);
+  EXPECT_GE(counter.GetTaskLocalArenaReservedBytes().value, 1000);
+}
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include <concurrent/impl/latch.hpp>
+#include <userver/hostinfo/blocking/read_numa_node_cpus.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/static_registration.hpp>
@@ -13,9 +14,11 @@
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
 
+#include <engine/task/blocking_watchdog.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
+#include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -53,6 +56,19 @@ void EmitMagicNanosleep() {
   nanosleep(&ts, nullptr);
 }
 
+std::variant<TaskQueue, WorkStealingTaskQueue> MakeTaskQueue(
+    const TaskProcessorConfig& config, impl::TaskCounter& counter) {
+  switch (config.task_queue) {
+    case TaskQueueType::kGlobal:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<TaskQueue>, config, counter};
+    case TaskQueueType::kWorkStealing:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<WorkStealingTaskQueue>, config, counter};
+  }
+  UINVARIANT(false, "Unexpected value of task_queue");
+}
+
 void TaskProcessorThreadStartedHook() {
   utils::impl::AssertStaticRegistrationFinished();
   (void)utils::DefaultRandom();
@@ -67,7 +83,7 @@ void TaskProcessorThreadStartedHook() {
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_counter_(config.worker_threads),
-      task_queue_(config),
+      task_queue_(MakeTaskQueue(config, task_counter_)),
       config_(std::move(config)),
       pools_(std::move(pools)) {
   utils::impl::FinishStaticRegistration();
@@ -75,15 +91,28 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
                << " thread_name=" << config_.thread_name;
+    numa_node_cpus_.reserve(config_.numa_nodes.size());
+    for (const auto numa_node : config_.numa_nodes) {
+      numa_node_cpus_.push_back(
+          hostinfo::blocking::ReadNumaNodeCpus(numa_node));
+    }
+
+    if (config_.blocking_watchdog_threshold.count() > 0) {
+      blocking_watchdog_ = std::make_unique<impl::BlockingWatchdog>(
+          Name(), config_.worker_threads, config_.blocking_watchdog_threshold);
+    }
+
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
+    worker_handles_.reserve(config_.worker_threads);
     for (size_t i = 0; i < config_.worker_threads; ++i) {
       workers_.emplace_back([this, i, &workers_left] {
         PrepareWorkerThread(i);
         workers_left.count_down();
-        ProcessTasks();
+        ProcessTasks(i);
       });
+      worker_handles_.push_back(workers_.back().native_handle());
     }
     workers_left.wait();
   } catch (...) {
@@ -100,7 +129,11 @@ void TaskProcessor::Cleanup() noexcept {
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustion();
 
-  task_queue_.StopProcessing();
+  // The watchdog signals the worker threads, so it is stopped before them
+  if (blocking_watchdog_) blocking_watchdog_->Stop();
+
+  std::visit([](auto& task_queue) { task_queue.StopProcessing(); },
+             task_queue_);
 
   for (auto& w : workers_) {
     w.join();
@@ -116,34 +149,73 @@ void TaskProcessor::InitiateShutdown() {
 
 void TaskProcessor::Schedule(impl::TaskContext* context) {
   UASSERT(context);
-  if (max_task_queue_wait_length_ && !context->IsCritical()) {
+  PrepareToSchedule(*context);
+
+  std::visit([context](auto& task_queue) { task_queue.Push(context); },
+             task_queue_);
+}
+
+void TaskProcessor::ScheduleBatch(impl::TaskContext* const* contexts,
+                                  std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    UASSERT(contexts[i]);
+    UASSERT(&contexts[i]->GetTaskProcessor() == this);
+    PrepareToSchedule(*contexts[i]);
+  }
+
+  std::visit(
+      [contexts, count](auto& task_queue) {
+        task_queue.PushBulk(contexts, count);
+      },
+      task_queue_);
+}
+
+void TaskProcessor::PrepareToSchedule(impl::TaskContext& context) {
+  if (max_task_queue_wait_length_ && !context.IsCritical()) {
     const auto queue_size = GetTaskQueueSize();
     if (queue_size >= max_task_queue_wait_length_) {
       LOG_LIMITED_WARNING()
           << "failed to enqueue task: task_queue_ size=" << queue_size << " >= "
           << "task_queue_size_threshold=" << max_task_queue_wait_length_
           << " task_processor=" << Name();
-      HandleOverload(*context);
+      HandleOverload(context);
     }
   }
   if (is_shutting_down_)
-    context->RequestCancel(TaskCancellationReason::kShutdown);
+    context.RequestCancel(TaskCancellationReason::kShutdown);
 
-  SetTaskQueueWaitTimepoint(context);
-
-  task_queue_.Push(context);
+  SetTaskQueueWaitTimepoint(&context);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
   detached_contexts_->Add(context);
 }
 
+size_t TaskProcessor::GetTaskQueueSize() const {
+  return std::visit(
+      [](const auto& task_queue) { return task_queue.GetSizeApproximate(); },
+      task_queue_);
+}
+
 ev::ThreadPool& TaskProcessor::EventThreadPool() {
   return pools_->EventThreadPool();
 }
 
 impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() {
-  return {pools_->GetCoroPool().GetCoroutine(), *this};
+  return {pools_->GetCoroPool(config_.stack_size_class).GetCoroutine(), *this};
+}
+
+std::size_t TaskProcessor::GetCoroStackSize() const {
+  return pools_->GetCoroPool(config_.stack_size_class).GetStackSize();
+}
+
+std::chrono::nanoseconds TaskProcessor::GetCpuTime() const {
+  // The workers are joined only in the destructor, so the handles are valid
+  std::chrono::nanoseconds total{};
+  for (const auto handle : worker_handles_) {
+    total += utils::statistics::impl::GetThreadCpuTime(handle);
+  }
+  return total;
 }
 
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
@@ -229,28 +301,57 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
       break;
   }
 
+  if (!numa_node_cpus_.empty()) {
+    try {
+      utils::SetCurrentThreadCpuAffinity(
+          numa_node_cpus_[index % numa_node_cpus_.size()]);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to pin worker thread #" << index
+                  << " of task_processor " << Name()
+                  << " to its NUMA node: " << ex;
+    }
+  }
+
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
   impl::SetLocalTaskCounterData(task_counter_, index);
 
+  if (blocking_watchdog_) blocking_watchdog_->RegisterWorker(index);
+
+  if (auto* queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+    queue->PrepareWorker(index);
+  }
+
   TaskProcessorThreadStartedHook();
 }
 
-void TaskProcessor::ProcessTasks() noexcept {
+void TaskProcessor::ProcessTasks(std::size_t worker_index) noexcept {
+  std::visit(
+      [this, worker_index](auto& task_queue) {
+        ProcessTasks(task_queue, worker_index);
+      },
+      task_queue_);
+}
+
+template <typename Queue>
+void TaskProcessor::ProcessTasks(Queue& task_queue,
+                                 std::size_t worker_index) noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto context = task_queue.PopBlocking();
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
     CheckWaitTime(*context);
 
     bool has_failed = false;
+    if (blocking_watchdog_) blocking_watchdog_->StartStep(worker_index);
     try {
       context->DoStep();
     } catch (const std::exception& ex) {
       LOG_ERROR() << "uncaught exception from DoStep: " << ex;
       has_failed = true;
     }
+    if (blocking_watchdog_) blocking_watchdog_->FinishStep(worker_index);
 
     if (has_failed || context->IsFinished()) {
       context->FinishDetached();
@@ -262,14 +363,25 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
   const auto max_wait_time = max_task_queue_wait_time_.load();
   const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
+  const auto wait_timepoint = context.GetQueueWaitTimepoint();
+  const bool has_wait_time =
+      wait_timepoint != std::chrono::steady_clock::time_point();
+  std::chrono::steady_clock::duration wait_time{};
+  if (has_wait_time) {
+    wait_time = std::chrono::steady_clock::now() - wait_timepoint;
+    GetTaskCounter().AccountQueueWait(
+        context.GetPriority(),
+        std::chrono::duration_cast<std::chrono::microseconds>(wait_time));
+  }
+
   if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
     SetTaskQueueWaitTimeOverloaded(false);
     return;
   }
 
-  const auto wait_timepoint = context.GetQueueWaitTimepoint();
-  if (wait_timepoint != std::chrono::steady_clock::time_point()) {
-    const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
+  // Background tasks are expected to wait in the queue, their wait time does
+  // not indicate an overload
+  if (has_wait_time && context.GetPriority() != Task::Priority::kBackground) {
     const auto wait_time_us =
         std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
     LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
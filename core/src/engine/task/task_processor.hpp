@@ -5,6 +5,7 @@
 #include <functional>
 #include <memory>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -13,6 +14,7 @@
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/work_stealing_task_queue.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/logging/logger.hpp>
 
@@ -21,6 +23,7 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 
 namespace impl {
+class BlockingWatchdog;
 class TaskContext;
 class TaskProcessorPools;
 class CountedCoroutinePtr;
@@ -39,10 +42,18 @@ class TaskProcessor final {
 
   void Schedule(impl::TaskContext*);
 
+  // Schedules the contexts with a single push into the task queue. Takes over
+  // the references to the contexts.
+  void ScheduleBatch(impl::TaskContext* const* contexts, std::size_t count);
+
   void Adopt(impl::TaskContext& context);
 
   impl::CountedCoroutinePtr GetCoroutine();
 
+  // Stack size of the coroutines from the pool of the task processor's stack
+  // size class
+  std::size_t GetCoroStackSize() const;
+
   ev::ThreadPool& EventThreadPool();
 
   std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() {
@@ -55,10 +66,13 @@ class TaskProcessor final {
 
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
-  size_t GetTaskQueueSize() const { return task_queue_.GetSizeApproximate(); }
+  size_t GetTaskQueueSize() const;
 
   size_t GetWorkerCount() const { return workers_.size(); }
 
+  // CPU time used by the worker threads since their creation
+  std::chrono::nanoseconds GetCpuTime() const;
+
   void SetSettings(const TaskProcessorSettings& settings);
 
   std::chrono::microseconds GetProfilerThreshold() const;
@@ -78,7 +92,12 @@ class TaskProcessor final {
 
   void PrepareWorkerThread(std::size_t index) noexcept;
 
-  void ProcessTasks() noexcept;
+  void ProcessTasks(std::size_t worker_index) noexcept;
+
+  template <typename Queue>
+  void ProcessTasks(Queue& task_queue, std::size_t worker_index) noexcept;
+
+  void PrepareToSchedule(impl::TaskContext& context);
 
   void CheckWaitTime(impl::TaskContext& context);
 
@@ -91,11 +110,14 @@ class TaskProcessor final {
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<std::atomic<bool>>
       task_queue_wait_time_overloaded_{false};
-  TaskQueue task_queue_;
+  std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  std::vector<std::vector<std::size_t>> numa_node_cpus_;
+  std::unique_ptr<impl::BlockingWatchdog> blocking_watchdog_;
   std::vector<std::thread> workers_;
+  std::vector<std::thread::native_handle_type> worker_handles_;
   logging::LoggerPtr task_trace_logger_{nullptr};
 
   std::atomic<std::chrono::microseconds> task_profiler_threshold_{{}};
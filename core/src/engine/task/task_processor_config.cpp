@@ -1,6 +1,7 @@
 #include <engine/task/task_processor_config.hpp>
 
 #include <cstdint>
+#include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/logging/log.hpp>
@@ -24,6 +25,17 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TaskQueueType::kGlobal, "global")
+        .Case(TaskQueueType::kWorkStealing, "work-stealing");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
@@ -35,6 +47,17 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.adaptive_spinning =
+      value["adaptive-spinning"].As<bool>(config.adaptive_spinning);
+  config.task_queue =
+      value["task-queue"].As<TaskQueueType>(config.task_queue);
+  config.stack_size_class = value["stack-size-class"].As<coro::StackSizeClass>(
+      config.stack_size_class);
+  config.numa_nodes =
+      value["numa-nodes"].As<std::vector<std::size_t>>(config.numa_nodes);
+  config.blocking_watchdog_threshold =
+      value["blocking-watchdog-threshold"].As<std::chrono::milliseconds>(
+          config.blocking_watchdog_threshold);
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
@@ -4,7 +4,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
+#include <engine/coro/pool_config.hpp>
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
@@ -21,6 +23,14 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobal,
+  kWorkStealing,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,6 +39,17 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{10000};
+  bool adaptive_spinning{false};
+  TaskQueueType task_queue{TaskQueueType::kGlobal};
+  coro::StackSizeClass stack_size_class{coro::StackSizeClass::kDefault};
+
+  // Worker threads are distributed round-robin among these NUMA nodes and are
+  // pinned to the CPUs of their node
+  std::vector<std::size_t> numa_nodes;
+
+  // Steps of the tasks that are longer are logged with the stacktrace of the
+  // worker thread, 0 disables the watchdog
+  std::chrono::milliseconds blocking_watchdog_threshold{0};
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
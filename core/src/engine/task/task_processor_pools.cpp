@@ -10,9 +10,27 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+std::unique_ptr<TaskProcessorPools::CoroPool> MakeStackSizeClassPool(
+    const coro::PoolConfig& default_config,
+    const std::optional<coro::StackSizeClassPoolConfig>& config) {
+  if (!config) return nullptr;
+  UINVARIANT(config->stack_size != 0,
+             "stack_size is required for a stack size class coroutine pool");
+  return std::make_unique<TaskProcessorPools::CoroPool>(
+      coro::MakePoolConfig(default_config, *config), &TaskContext::CoroFunc);
+}
+
+}  // namespace
+
 TaskProcessorPools::TaskProcessorPools(coro::PoolConfig coro_pool_config,
                                        ev::ThreadPoolConfig ev_pool_config)
-    : coro_pool_(std::move(coro_pool_config), &TaskContext::CoroFunc),
+    : coro_pool_(coro_pool_config, &TaskContext::CoroFunc),
+      small_stacks_coro_pool_(MakeStackSizeClassPool(
+          coro_pool_config, coro_pool_config.small_stacks)),
+      large_stacks_coro_pool_(MakeStackSizeClassPool(
+          coro_pool_config, coro_pool_config.large_stacks)),
       event_thread_pool_(std::move(ev_pool_config),
                          ev::ThreadPool::kUseDefaultEvLoop) {
   const bool old_value =
@@ -28,6 +46,32 @@ TaskProcessorPools::~TaskProcessorPools() {
   UASSERT(old_value);
 }
 
+TaskProcessorPools::CoroPool& TaskProcessorPools::GetCoroPool(
+    coro::StackSizeClass stack_size_class) {
+  auto* pool = FindCoroPool(stack_size_class);
+  return pool ? *pool : coro_pool_;
+}
+
+TaskProcessorPools::CoroPool* TaskProcessorPools::FindCoroPool(
+    coro::StackSizeClass stack_size_class) {
+  switch (stack_size_class) {
+    case coro::StackSizeClass::kSmall:
+      return small_stacks_coro_pool_.get();
+    case coro::StackSizeClass::kDefault:
+      return &coro_pool_;
+    case coro::StackSizeClass::kLarge:
+      return large_stacks_coro_pool_.get();
+  }
+  UINVARIANT(false, "Unexpected stack size class");
+}
+
+coro::PoolStats TaskProcessorPools::GetCoroPoolsStats() const {
+  auto stats = coro_pool_.GetStats();
+  if (small_stacks_coro_pool_) stats += small_stacks_coro_pool_->GetStats();
+  if (large_stacks_coro_pool_) stats += large_stacks_coro_pool_->GetStats();
+  return stats;
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
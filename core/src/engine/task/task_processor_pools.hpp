@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include <engine/coro/pool.hpp>
+#include <engine/coro/pool_stats.hpp>
 #include <engine/ev/thread_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,10 +22,22 @@ class TaskProcessorPools final {
   ~TaskProcessorPools();
 
   CoroPool& GetCoroPool() { return coro_pool_; }
+
+  // Returns the default pool if there's no pool for the stack size class
+  CoroPool& GetCoroPool(coro::StackSizeClass stack_size_class);
+
+  // Returns nullptr if there's no pool for the stack size class
+  CoroPool* FindCoroPool(coro::StackSizeClass stack_size_class);
+
+  // Stats of all the coroutine pools combined
+  coro::PoolStats GetCoroPoolsStats() const;
+
   ev::ThreadPool& EventThreadPool() { return event_thread_pool_; }
 
  private:
   CoroPool coro_pool_;
+  std::unique_ptr<CoroPool> small_stacks_coro_pool_;
+  std::unique_ptr<CoroPool> large_stacks_coro_pool_;
   ev::ThreadPool event_thread_pool_;
 };
 
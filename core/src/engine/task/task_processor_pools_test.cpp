@@ -0,0 +1,92 @@
+#include <engine/task/task_processor_pools.hpp>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kDefaultStackSize = 256 * 1024;
+constexpr std::size_t kSmallStackSize = 64 * 1024;
+constexpr std::size_t kLargeStackSize = 1024 * 1024;
+
+std::shared_ptr<engine::impl::TaskProcessorPools> MakePools(
+    bool with_large_stacks) {
+  engine::coro::PoolConfig coro_config;
+  coro_config.initial_size = 1;
+  coro_config.max_size = 10;
+  coro_config.stack_size = kDefaultStackSize;
+
+  engine::coro::StackSizeClassPoolConfig small_stacks;
+  small_stacks.initial_size = 1;
+  small_stacks.stack_size = kSmallStackSize;
+  coro_config.small_stacks = small_stacks;
+
+  if (with_large_stacks) {
+    engine::coro::StackSizeClassPoolConfig large_stacks;
+    large_stacks.stack_size = kLargeStackSize;
+    coro_config.large_stacks = large_stacks;
+  }
+
+  engine::ev::ThreadPoolConfig ev_config;
+  ev_config.threads = 1;
+
+  return std::make_shared<engine::impl::TaskProcessorPools>(
+      std::move(coro_config), std::move(ev_config));
+}
+
+std::size_t GetStackSizeOn(
+    const std::shared_ptr<engine::impl::TaskProcessorPools>& pools,
+    engine::coro::StackSizeClass stack_size_class) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "stack-class";
+  config.stack_size_class = stack_size_class;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(std::move(config), pools)};
+
+  std::size_t stack_size = 0;
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [&stack_size] {
+    stack_size = engine::current_task::GetStackSize();
+  });
+  return stack_size;
+}
+
+}  // namespace
+
+TEST(TaskProcessorPools, StackSizeClasses) {
+  const auto pools = MakePools(/*with_large_stacks=*/true);
+
+  EXPECT_EQ(GetStackSizeOn(pools, engine::coro::StackSizeClass::kSmall),
+            kSmallStackSize);
+  EXPECT_EQ(GetStackSizeOn(pools, engine::coro::StackSizeClass::kDefault),
+            kDefaultStackSize);
+  EXPECT_EQ(GetStackSizeOn(pools, engine::coro::StackSizeClass::kLarge),
+            kLargeStackSize);
+
+  const auto default_stats = pools->GetCoroPool().GetStats();
+  const auto small_stats =
+      pools->GetCoroPool(engine::coro::StackSizeClass::kSmall).GetStats();
+  const auto large_stats =
+      pools->GetCoroPool(engine::coro::StackSizeClass::kLarge).GetStats();
+  EXPECT_EQ(pools->GetCoroPoolsStats().total_coroutines,
+            default_stats.total_coroutines + small_stats.total_coroutines +
+                large_stats.total_coroutines);
+}
+
+TEST(TaskProcessorPools, MissingStackSizeClassFallsBackToDefault) {
+  const auto pools = MakePools(/*with_large_stacks=*/false);
+
+  EXPECT_EQ(pools->FindCoroPool(engine::coro::StackSizeClass::kLarge),
+            nullptr);
+  EXPECT_EQ(GetStackSizeOn(pools, engine::coro::StackSizeClass::kLarge),
+            kDefaultStackSize);
+}
+
+USERVER_NAMESPACE_END
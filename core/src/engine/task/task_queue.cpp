@@ -1,6 +1,7 @@
 #include <engine/task/task_queue.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,58 +9,161 @@ namespace engine {
 
 namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// Spinning is done by impl::AdaptiveSpinning
+constexpr int kSemaphoreMaxSpins = 0;
+
+// Under a full load of all the priorities, high priority tasks get 12/16 of
+// the dequeues, normal ones get 3/16 and background ones get 1/16
+constexpr std::size_t kBackgroundShare = 16;
+constexpr std::size_t kNormalShare = 4;
+
+constexpr std::size_t ToIndex(Task::Priority priority) noexcept {
+  return static_cast<std::size_t>(priority);
 }
 
-TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+static_assert(ToIndex(Task::Priority::kHigh) == 0);
+static_assert(ToIndex(Task::Priority::kBackground) == 2);
+
+using PriorityOrder = std::array<Task::Priority, 3>;
+
+constexpr PriorityOrder kHighFirst{Task::Priority::kHigh,
+                                   Task::Priority::kNormal,
+                                   Task::Priority::kBackground};
+constexpr PriorityOrder kNormalFirst{Task::Priority::kNormal,
+                                     Task::Priority::kHigh,
+                                     Task::Priority::kBackground};
+constexpr PriorityOrder kBackgroundFirst{Task::Priority::kBackground,
+                                         Task::Priority::kHigh,
+                                         Task::Priority::kNormal};
+
+const PriorityOrder& GetPriorityOrder(std::size_t dequeue) noexcept {
+  if (dequeue % kBackgroundShare == 0) return kBackgroundFirst;
+  if (dequeue % kNormalShare == 0) return kNormalFirst;
+  return kHighFirst;
+}
+
+}  // namespace
+
+TaskQueue::ConsumerTokens::ConsumerTokens(
+    std::array<Queue, kPrioritiesCount>& queues)
+    : tokens{moodycamel::ConsumerToken{queues[0]},
+             moodycamel::ConsumerToken{queues[1]},
+             moodycamel::ConsumerToken{queues[2]}} {}
+
+TaskQueue::TaskQueue(const TaskProcessorConfig& config,
+                     impl::TaskCounter& counter)
+    : queue_semaphore_(kSemaphoreInitialCount, kSemaphoreMaxSpins),
+      counter_(counter),
+      spinning_iterations_(config.spinning_iterations),
+      adaptive_spinning_(config.adaptive_spinning) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
-  DoPush(context.get());
+  DoPush(context.get(), context->GetPriority());
   context.detach();
 }
 
+void TaskQueue::PushBulk(impl::TaskContext* const* contexts,
+                         std::size_t count) {
+  if (count == 0) return;
+
+  // Enqueue the runs of the same priority at once
+  std::size_t run_begin = 0;
+  while (run_begin < count) {
+    UASSERT(contexts[run_begin]);
+    const auto priority = contexts[run_begin]->GetPriority();
+    auto run_end = run_begin + 1;
+    while (run_end < count && contexts[run_end]->GetPriority() == priority) {
+      ++run_end;
+    }
+    Enqueue(contexts + run_begin, run_end - run_begin, priority);
+    run_begin = run_end;
+  }
+  queue_semaphore_.signal(
+      static_cast<moodycamel::LightweightSemaphore::ssize_t>(count));
+}
+
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
   // Current thread handles only a single TaskProcessor, so it's safe to store
-  // a token for the task processor in a thread-local variable.
-  thread_local moodycamel::ConsumerToken token(queue_);
+  // tokens for the task processor in a thread-local variable.
+  thread_local ConsumerTokens tokens(queues_);
 
-  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(token),
+  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(tokens),
                                                   /* add_ref= */ false};
 
   if (!context) {
     // return "stop" token back
-    DoPush(nullptr);
+    DoPush(nullptr, Task::Priority::kNormal);
   }
 
   return context;
 }
 
-void TaskQueue::StopProcessing() { DoPush(nullptr); }
+void TaskQueue::StopProcessing() { DoPush(nullptr, Task::Priority::kNormal); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept {
-  return queue_.size_approx();
+  std::size_t size = 0;
+  for (const auto& queue : queues_) size += queue.size_approx();
+  return size;
 }
 
-void TaskQueue::DoPush(impl::TaskContext* context) {
+void TaskQueue::DoPush(impl::TaskContext* context, Task::Priority priority) {
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::enqueue
-  queue_.enqueue(context);
+  Enqueue(&context, 1, priority);
   queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
-  impl::TaskContext* context{};
+void TaskQueue::Enqueue(impl::TaskContext* const* contexts, std::size_t count,
+                        Task::Priority priority) {
+  if (priority != Task::Priority::kNormal &&
+      !has_prioritized_tasks_.load(std::memory_order_relaxed)) {
+    has_prioritized_tasks_.store(true, std::memory_order_relaxed);
+  }
+
+  auto& queue = queues_[ToIndex(priority)];
+  if (count == 1) {
+    queue.enqueue(*contexts);
+  } else {
+    queue.enqueue_bulk(contexts, count);
+  }
+}
+
+impl::TaskContext* TaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
+  // Current thread handles only a single TaskProcessor, so it's safe to store
+  // the spinning state in a thread-local variable.
+  thread_local impl::AdaptiveSpinning spinning(spinning_iterations_,
+                                               adaptive_spinning_);
 
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::wait_dequeue
-  queue_semaphore_.wait();
-  while (!queue_.try_dequeue(token, context)) {
+  spinning.Wait(queue_semaphore_, counter_);
+  return DoPop(tokens);
+}
+
+impl::TaskContext* TaskQueue::DoPop(ConsumerTokens& tokens) {
+  impl::TaskContext* context{};
+
+  if (!has_prioritized_tasks_.load(std::memory_order_relaxed)) {
+    auto& queue = queues_[ToIndex(Task::Priority::kNormal)];
+    auto& token = tokens.tokens[ToIndex(Task::Priority::kNormal)];
+    if (queue.try_dequeue(token, context)) return context;
+    // The flag has just been set by a concurrent push
+  }
+
+  const auto& order = GetPriorityOrder(++tokens.dequeues);
+  while (true) {
+    // The semaphore guarantees that one of the queues has an item for us
+    for (const auto priority : order) {
+      const auto index = ToIndex(priority);
+      if (queues_[index].try_dequeue(tokens.tokens[index], context)) {
+        return context;
+      }
+    }
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
   }
-
-  return context;
 }
 
 }  // namespace engine
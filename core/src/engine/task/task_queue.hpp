@@ -1,10 +1,16 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/adaptive_spinning.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,14 +18,24 @@ namespace engine {
 
 namespace impl {
 class TaskContext;
+class TaskCounter;
 }  // namespace impl
 
+/// A global MPMC task queue.
+///
+/// Tasks of each Task::Priority go to a separate queue. Workers prefer the
+/// higher priorities, but every 16th dequeue of a worker prefers background
+/// tasks and every other 4th dequeue prefers normal tasks, so that the lower
+/// priorities are not starved.
 class TaskQueue final {
  public:
-  explicit TaskQueue(const TaskProcessorConfig& config);
+  TaskQueue(const TaskProcessorConfig& config, impl::TaskCounter& counter);
 
   void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
+  // Takes over the references to the contexts
+  void PushBulk(impl::TaskContext* const* contexts, std::size_t count);
+
   // Returns nullptr as a stop signal
   boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -28,12 +44,34 @@ class TaskQueue final {
   std::size_t GetSizeApproximate() const noexcept;
 
  private:
-  void DoPush(impl::TaskContext* context);
+  static constexpr std::size_t kPrioritiesCount = 3;
+
+  using Queue = moodycamel::ConcurrentQueue<impl::TaskContext*>;
+
+  struct ConsumerTokens final {
+    explicit ConsumerTokens(std::array<Queue, kPrioritiesCount>& queues);
+
+    std::array<moodycamel::ConsumerToken, kPrioritiesCount> tokens;
+    std::size_t dequeues{0};
+  };
+
+  void DoPush(impl::TaskContext* context, Task::Priority priority);
+
+  void Enqueue(impl::TaskContext* const* contexts, std::size_t count,
+               Task::Priority priority);
+
+  impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
 
-  impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+  impl::TaskContext* DoPop(ConsumerTokens& tokens);
 
-  moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+  std::array<Queue, kPrioritiesCount> queues_;
+  // Set once a task of non-normal priority is pushed, allows to skip the
+  // priority queues for the task processors that do not use them
+  std::atomic<bool> has_prioritized_tasks_{false};
   moodycamel::LightweightSemaphore queue_semaphore_;
+  impl::TaskCounter& counter_;
+  const int spinning_iterations_;
+  const bool adaptive_spinning_;
 };
 
 }  // namespace engine
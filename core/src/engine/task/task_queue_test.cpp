@@ -0,0 +1,105 @@
+#include <engine/task/task_queue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::unique_ptr<engine::TaskProcessor> MakeSingleThreadedTaskProcessor() {
+  engine::TaskProcessorConfig config;
+  config.name = "priorities";
+  config.thread_name = "prio-worker";
+  config.worker_threads = 1;
+
+  return std::make_unique<engine::TaskProcessor>(
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools());
+}
+
+}  // namespace
+
+UTEST(TaskQueue, PrioritiesWithoutStarvation) {
+  using Priority = engine::Task::Priority;
+  constexpr int kTasksPerPriority = 32;
+
+  auto task_processor = MakeSingleThreadedTaskProcessor();
+
+  // Occupy the only worker, so that all the tasks get queued at once
+  std::atomic<bool> blocker_started{false};
+  std::atomic<bool> release_blocker{false};
+  auto blocker = engine::AsyncNoSpan(*task_processor, [&] {
+    blocker_started = true;
+    while (!release_blocker) std::this_thread::yield();
+  });
+  while (!blocker_started) std::this_thread::yield();
+
+  std::mutex mutex;
+  std::vector<Priority> execution_order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kTasksPerPriority; ++i) {
+    for (const auto priority : {Priority::kBackground, Priority::kHigh}) {
+      tasks.push_back(
+          engine::AsyncNoSpan(*task_processor, priority, [&, priority] {
+            const std::lock_guard lock{mutex};
+            execution_order.push_back(priority);
+          }));
+    }
+  }
+
+  release_blocker = true;
+  blocker.Get();
+  for (auto& task : tasks) task.Get();
+
+  ASSERT_EQ(execution_order.size(), kTasksPerPriority * 2);
+  const auto first_half_end = execution_order.begin() + kTasksPerPriority;
+  const auto high_in_first_half =
+      std::count(execution_order.begin(), first_half_end, Priority::kHigh);
+  EXPECT_GE(high_in_first_half, kTasksPerPriority - 4);
+  // Background tasks get their share even while there are high priority ones
+  EXPECT_LT(high_in_first_half, kTasksPerPriority);
+
+  const auto& counter = task_processor->GetTaskCounter();
+  EXPECT_GT(counter.GetQueueWait(Priority::kHigh).Count(), 0);
+  EXPECT_GT(counter.GetQueueWait(Priority::kBackground).Count(), 0);
+}
+
+UTEST(TaskQueue, NormalPriorityIsFifo) {
+  constexpr int kTasks = 100;
+
+  auto task_processor = MakeSingleThreadedTaskProcessor();
+
+  std::atomic<bool> blocker_started{false};
+  std::atomic<bool> release_blocker{false};
+  auto blocker = engine::AsyncNoSpan(*task_processor, [&] {
+    blocker_started = true;
+    while (!release_blocker) std::this_thread::yield();
+  });
+  while (!blocker_started) std::this_thread::yield();
+
+  std::vector<int> execution_order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(*task_processor, [&execution_order, i] {
+      execution_order.push_back(i);
+    }));
+  }
+
+  release_blocker = true;
+  blocker.Get();
+  for (auto& task : tasks) task.Get();
+
+  ASSERT_EQ(execution_order.size(), kTasks);
+  EXPECT_TRUE(std::is_sorted(execution_order.begin(), execution_order.end()));
+}
+
+USERVER_NAMESPACE_END
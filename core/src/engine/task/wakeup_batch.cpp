@@ -0,0 +1,37 @@
+#include <engine/task/wakeup_batch.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+WakeupBatch::~WakeupBatch() {
+  UASSERT_MSG(size_ == 0, "WakeupBatch was not flushed");
+}
+
+void WakeupBatch::Add(TaskContext& context) {
+  auto& task_processor = context.GetTaskProcessor();
+  if (size_ == kMaxSize || (size_ != 0 && task_processor_ != &task_processor)) {
+    Flush();
+  }
+
+  task_processor_ = &task_processor;
+  intrusive_ptr_add_ref(&context);
+  contexts_[size_++] = &context;
+}
+
+void WakeupBatch::Flush() {
+  if (size_ == 0) return;
+
+  UASSERT(task_processor_);
+  const auto size = size_;
+  size_ = 0;
+  task_processor_->ScheduleBatch(contexts_.data(), size);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+class TaskProcessor;
+
+namespace impl {
+
+class TaskContext;
+
+/// Collects the tasks that are woken up together, e.g. by
+/// WaitList::WakeupAll, and pushes them into the task queues of their task
+/// processors with a single operation per task processor.
+///
+/// Flush() must be called before the destruction.
+class WakeupBatch final {
+ public:
+  WakeupBatch() = default;
+
+  WakeupBatch(const WakeupBatch&) = delete;
+  WakeupBatch& operator=(const WakeupBatch&) = delete;
+  ~WakeupBatch();
+
+  // Takes a reference to the context that is ready to be scheduled
+  void Add(TaskContext& context);
+
+  void Flush();
+
+ private:
+  static constexpr std::size_t kMaxSize = 32;
+
+  TaskProcessor* task_processor_{nullptr};
+  std::size_t size_{0};
+  std::array<TaskContext*, kMaxSize> contexts_{};
+};
+
+}  // namespace impl
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#include <engine/task/wakeup_batch.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(WakeupBatch, NotifyAllAcrossTaskProcessors, 2) {
+  engine::TaskProcessorConfig config;
+  config.name = "work-stealing";
+  config.thread_name = "ws-worker";
+  config.worker_threads = 2;
+  config.task_queue = engine::TaskQueueType::kWorkStealing;
+  engine::TaskProcessor work_stealing_task_processor{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  // Exceeds the size of a single batch, and the waiters of different task
+  // processors are interleaved
+  constexpr int kWaiters = 200;
+  constexpr int kWaitersInARow = 3;
+
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  bool notified = false;
+  std::atomic<int> waiting{0};
+  std::atomic<int> woken_up{0};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kWaiters);
+  for (int i = 0; i < kWaiters; ++i) {
+    auto& task_processor = (i / kWaitersInARow) % 2
+                               ? work_stealing_task_processor
+                               : engine::current_task::GetTaskProcessor();
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+      std::unique_lock lock{mutex};
+      ++waiting;
+      ASSERT_TRUE(cv.Wait(lock, [&notified] { return notified; }));
+      ++woken_up;
+    }));
+  }
+  while (waiting != kWaiters) engine::Yield();
+
+  {
+    const std::lock_guard lock{mutex};
+    notified = true;
+  }
+  cv.NotifyAll();
+
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(woken_up.load(), kWaiters);
+}
+
+USERVER_NAMESPACE_END
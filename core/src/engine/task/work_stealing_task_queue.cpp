@@ -0,0 +1,324 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// Spinning is done by impl::AdaptiveSpinning
+constexpr int kSemaphoreMaxSpins = 0;
+
+// Limits the amount of tasks that may be taken from the LIFO slot in a row,
+// otherwise a pair of tasks that wake each other up could starve the queue.
+constexpr std::size_t kMaxLifoStreak = 3;
+
+constexpr std::size_t kMaxStealBatch = 32;
+
+struct LocalConsumerData final {
+  const void* owner{nullptr};
+  void* consumer{nullptr};
+};
+
+// Current thread handles only a single TaskProcessor, so it's safe to store
+// the consumer for the task processor in a thread-local variable.
+thread_local LocalConsumerData local_consumer_data;
+
+}  // namespace
+
+WorkStealingTaskQueue::Consumer::Consumer(const TaskProcessorConfig& config)
+    : wakeup(kSemaphoreInitialCount, kSemaphoreMaxSpins),
+      spinning(config.spinning_iterations, config.adaptive_spinning) {}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config,
+                                             impl::TaskCounter& counter)
+    : counter_(counter), consumers_(config.worker_threads, config) {
+  UINVARIANT(config.worker_threads != 0,
+             "Work stealing task queue requires at least one worker");
+  sleepers_.reserve(config.worker_threads);
+
+  const auto& numa_nodes = config.numa_nodes;
+  if (!numa_nodes.empty()) {
+    for (std::size_t i = 0; i < consumers_.size(); ++i) {
+      consumers_[i]->numa_node = numa_nodes[i % numa_nodes.size()];
+    }
+    has_multiple_numa_nodes_ = std::any_of(
+        numa_nodes.begin(), numa_nodes.end(),
+        [&numa_nodes](std::size_t node) { return node != numa_nodes[0]; });
+  }
+}
+
+void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
+  UINVARIANT(index < consumers_.size(),
+             "More threads are consuming tasks than the task processor has "
+             "worker threads");
+  UASSERT(!local_consumer_data.owner);
+  local_consumer_data = {this, &*consumers_[index]};
+}
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  DoPush(context.get());
+  context.detach();
+}
+
+void WorkStealingTaskQueue::PushBulk(impl::TaskContext* const* contexts,
+                                     std::size_t count) {
+  if (count == 0) return;
+
+  // All the tasks go to a single queue under a single lock, the idle workers
+  // steal them from there
+  auto* consumer = GetLocalConsumer();
+  if (!consumer) {
+    thread_local std::size_t next_consumer = 0;
+    consumer = &*consumers_[next_consumer++ % consumers_.size()];
+  }
+  {
+    std::lock_guard lock{consumer->mutex};
+    consumer->queue.insert(consumer->queue.end(), contexts, contexts + count);
+    consumer->queue_size.store(consumer->queue.size(),
+                               std::memory_order_relaxed);
+  }
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  for (std::size_t i = 0; i < count && sleeping_count_->load() != 0; ++i) {
+    WakeUpOne();
+  }
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  auto* const consumer = GetLocalConsumer();
+  UASSERT_MSG(consumer, "PrepareWorker was not called for the current thread");
+
+  while (true) {
+    if (auto* context = TryPop(*consumer)) {
+      return {context, /* add_ref= */ false};
+    }
+    if (is_stopped_.load()) return {};
+
+    Park(*consumer);
+
+    // Re-check after announcing ourselves as sleeping, a producer could have
+    // pushed a task without seeing us in the sleepers list
+    auto* context = TryPop(*consumer);
+    if (context || is_stopped_.load()) {
+      if (!TryUnpark(*consumer) && context) {
+        // Somebody has already decided to wake us up for a task, but we've
+        // got a task on our own. Pass the wakeup on.
+        WakeUpOne();
+      }
+      return {context, /* add_ref= */ false};
+    }
+
+    consumer->spinning.Wait(consumer->wakeup, counter_);
+  }
+}
+
+void WorkStealingTaskQueue::StopProcessing() {
+  is_stopped_ = true;
+  WakeUpAll();
+}
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = 0;
+  for (const auto& consumer : consumers_) {
+    size += consumer->queue_size.load(std::memory_order_relaxed);
+    if (consumer->lifo_slot.load(std::memory_order_relaxed)) ++size;
+  }
+  return size;
+}
+
+WorkStealingTaskQueue::Consumer*
+WorkStealingTaskQueue::GetLocalConsumer() noexcept {
+  if (local_consumer_data.owner != this) return nullptr;
+  return static_cast<Consumer*>(local_consumer_data.consumer);
+}
+
+void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
+  UASSERT(context);
+  if (auto* local = GetLocalConsumer()) {
+    // Freshly woken up task is likely to use the data that is hot in the
+    // caches of the current thread
+    auto* previous = local->lifo_slot.exchange(context);
+    if (previous) PushToQueue(*local, previous);
+  } else {
+    thread_local std::size_t next_consumer = 0;
+    PushToQueue(*consumers_[next_consumer++ % consumers_.size()], context);
+  }
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  WakeUpOne();
+}
+
+void WorkStealingTaskQueue::PushToQueue(Consumer& consumer,
+                                        impl::TaskContext* context) {
+  std::lock_guard lock{consumer.mutex};
+  consumer.queue.push_back(context);
+  consumer.queue_size.store(consumer.queue.size(), std::memory_order_relaxed);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPop(Consumer& consumer) {
+  if (consumer.lifo_streak < kMaxLifoStreak) {
+    if (auto* context = TryGetLifo(consumer)) {
+      ++consumer.lifo_streak;
+      return context;
+    }
+  }
+  consumer.lifo_streak = 0;
+
+  if (auto* context = TryPopLocal(consumer)) return context;
+  if (auto* context = TryGetLifo(consumer)) return context;
+  return TrySteal(consumer);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopLocal(Consumer& consumer) {
+  if (consumer.queue_size.load(std::memory_order_relaxed) == 0) return nullptr;
+
+  std::lock_guard lock{consumer.mutex};
+  if (consumer.queue.empty()) return nullptr;
+  auto* context = consumer.queue.front();
+  consumer.queue.pop_front();
+  consumer.queue_size.store(consumer.queue.size(), std::memory_order_relaxed);
+  return context;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryGetLifo(Consumer& consumer) {
+  if (!consumer.lifo_slot.load(std::memory_order_relaxed)) return nullptr;
+  return consumer.lifo_slot.exchange(nullptr);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TrySteal(Consumer& thief) {
+  const auto consumers_count = consumers_.size();
+  if (consumers_count == 1) return nullptr;
+
+  const auto start = utils::RandRange(consumers_count);
+  if (has_multiple_numa_nodes_) {
+    // Cross-node stealing is only for the overflow, as the task data is likely
+    // to reside in the memory of the current node
+    const auto is_same_node = [&thief](const Consumer& victim) {
+      return victim.numa_node == thief.numa_node;
+    };
+    if (auto* context = TryStealIf(thief, start, is_same_node)) return context;
+    if (auto* context = TryStealIf(thief, start, std::not_fn(is_same_node))) {
+      return context;
+    }
+  } else {
+    const auto any = [](const Consumer&) { return true; };
+    if (auto* context = TryStealIf(thief, start, any)) return context;
+  }
+
+  // LIFO slots are stolen only as a last resort, as the owning thread is
+  // going to run that task soon anyway
+  for (std::size_t i = 0; i < consumers_count; ++i) {
+    auto& victim = *consumers_[(start + i) % consumers_count];
+    if (&victim == &thief) continue;
+    if (auto* context = TryGetLifo(victim)) return context;
+  }
+
+  return nullptr;
+}
+
+template <typename Predicate>
+impl::TaskContext* WorkStealingTaskQueue::TryStealIf(Consumer& thief,
+                                                     std::size_t start,
+                                                     Predicate predicate) {
+  const auto consumers_count = consumers_.size();
+  for (std::size_t i = 0; i < consumers_count; ++i) {
+    auto& victim = *consumers_[(start + i) % consumers_count];
+    if (&victim == &thief || !predicate(victim)) continue;
+    if (auto* context = TryStealFrom(thief, victim)) return context;
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFrom(Consumer& thief,
+                                                       Consumer& victim) {
+  if (victim.queue_size.load(std::memory_order_relaxed) == 0) return nullptr;
+
+  std::array<impl::TaskContext*, kMaxStealBatch> stolen{};
+  std::size_t stolen_count = 0;
+  {
+    std::lock_guard lock{victim.mutex};
+    // Steal a half of the victim's queue to amortize the cost of stealing
+    stolen_count = std::min((victim.queue.size() + 1) / 2, kMaxStealBatch);
+    std::copy_n(victim.queue.begin(), stolen_count, stolen.begin());
+    victim.queue.erase(victim.queue.begin(),
+                       victim.queue.begin() + stolen_count);
+    victim.queue_size.store(victim.queue.size(), std::memory_order_relaxed);
+  }
+  if (stolen_count == 0) return nullptr;
+
+  if (stolen_count > 1) {
+    std::lock_guard lock{thief.mutex};
+    thief.queue.insert(thief.queue.end(), stolen.begin() + 1,
+                       stolen.begin() + stolen_count);
+    thief.queue_size.store(thief.queue.size(), std::memory_order_relaxed);
+  }
+  return stolen[0];
+}
+
+void WorkStealingTaskQueue::Park(Consumer& consumer) {
+  {
+    std::lock_guard lock{sleepers_mutex_};
+    UASSERT(!consumer.is_sleeping);
+    consumer.is_sleeping = true;
+    sleepers_.push_back(&consumer);
+    sleeping_count_->fetch_add(1);
+  }
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+bool WorkStealingTaskQueue::TryUnpark(Consumer& consumer) {
+  std::lock_guard lock{sleepers_mutex_};
+  if (!consumer.is_sleeping) return false;
+
+  consumer.is_sleeping = false;
+  const auto it = std::find(sleepers_.begin(), sleepers_.end(), &consumer);
+  UASSERT(it != sleepers_.end());
+  sleepers_.erase(it);
+  sleeping_count_->fetch_sub(1);
+  return true;
+}
+
+void WorkStealingTaskQueue::WakeUpOne() {
+  if (sleeping_count_->load() == 0) return;
+
+  Consumer* consumer = nullptr;
+  {
+    std::lock_guard lock{sleepers_mutex_};
+    if (sleepers_.empty()) return;
+    // The most recently parked consumer is the most likely to still have its
+    // data in CPU caches
+    consumer = sleepers_.back();
+    sleepers_.pop_back();
+    consumer->is_sleeping = false;
+    sleeping_count_->fetch_sub(1);
+  }
+  consumer->wakeup.signal();
+}
+
+void WorkStealingTaskQueue::WakeUpAll() {
+  std::vector<Consumer*> sleepers;
+  {
+    std::lock_guard lock{sleepers_mutex_};
+    sleepers.swap(sleepers_);
+    for (auto* consumer : sleepers) consumer->is_sleeping = false;
+    sleeping_count_->store(0);
+  }
+  for (auto* consumer : sleepers) consumer->wakeup.signal();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <moodycamel/blockingconcurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/adaptive_spinning.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+class TaskCounter;
+}  // namespace impl
+
+/// A task queue with a local queue per worker thread and random-victim
+/// stealing.
+///
+/// Tasks scheduled from a worker thread go to the LIFO slot of that worker,
+/// tasks scheduled from other threads (ev threads, other task processors) are
+/// distributed round-robin among the workers. Idle workers steal from the
+/// others before parking on their own semaphore. If the workers are
+/// distributed among NUMA nodes, workers of the same node are robbed first.
+class WorkStealingTaskQueue final {
+ public:
+  WorkStealingTaskQueue(const TaskProcessorConfig& config,
+                        impl::TaskCounter& counter);
+
+  // Binds the current thread to the local queue of the worker
+  void PrepareWorker(std::size_t index);
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Takes over the references to the contexts
+  void PushBulk(impl::TaskContext* const* contexts, std::size_t count);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+ private:
+  struct Consumer final {
+    explicit Consumer(const TaskProcessorConfig& config);
+
+    // Owner takes tasks from the front, stealers take from the front too to
+    // keep the FIFO order for the tasks that were waiting the longest.
+    std::mutex mutex;
+    std::deque<impl::TaskContext*> queue;
+    std::atomic<std::size_t> queue_size{0};
+
+    std::atomic<impl::TaskContext*> lifo_slot{nullptr};
+    std::size_t lifo_streak{0};
+
+    moodycamel::LightweightSemaphore wakeup;
+    impl::AdaptiveSpinning spinning;
+    bool is_sleeping{false};
+
+    std::size_t numa_node{0};
+  };
+
+  using ConsumerPtr = concurrent::impl::InterferenceShield<Consumer>;
+
+  Consumer* GetLocalConsumer() noexcept;
+
+  void DoPush(impl::TaskContext* context);
+  void PushToQueue(Consumer& consumer, impl::TaskContext* context);
+
+  impl::TaskContext* TryPop(Consumer& consumer);
+  impl::TaskContext* TryPopLocal(Consumer& consumer);
+  impl::TaskContext* TryGetLifo(Consumer& consumer);
+  impl::TaskContext* TrySteal(Consumer& consumer);
+  template <typename Predicate>
+  impl::TaskContext* TryStealIf(Consumer& thief, std::size_t start,
+                                Predicate predicate);
+  impl::TaskContext* TryStealFrom(Consumer& thief, Consumer& victim);
+
+  void Park(Consumer& consumer);
+  bool TryUnpark(Consumer& consumer);
+  void WakeUpOne();
+  void WakeUpAll();
+
+  impl::TaskCounter& counter_;
+  utils::FixedArray<ConsumerPtr> consumers_;
+  bool has_multiple_numa_nodes_{false};
+
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>>
+      sleeping_count_{0};
+  std::mutex sleepers_mutex_;
+  std::vector<Consumer*> sleepers_;
+
+  std::atomic<bool> is_stopped_{false};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
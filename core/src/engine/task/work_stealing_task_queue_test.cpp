@@ -0,0 +1,111 @@
+#include <atomic>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkerThreads = 4;
+
+std::unique_ptr<engine::TaskProcessor> MakeWorkStealingTaskProcessor() {
+  engine::TaskProcessorConfig config;
+  config.name = "work-stealing";
+  config.thread_name = "ws-worker";
+  config.worker_threads = kWorkerThreads;
+  config.task_queue = engine::TaskQueueType::kWorkStealing;
+
+  return std::make_unique<engine::TaskProcessor>(
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools());
+}
+
+}  // namespace
+
+UTEST(WorkStealingTaskQueue, RunsTasks) {
+  auto task_processor = MakeWorkStealingTaskProcessor();
+
+  constexpr int kTasks = 1000;
+  std::atomic<int> counter{0};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(*task_processor, [&counter] {
+      engine::Yield();
+      ++counter;
+    }));
+  }
+
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(counter.load(), kTasks);
+}
+
+UTEST(WorkStealingTaskQueue, NestedTasks) {
+  auto task_processor = MakeWorkStealingTaskProcessor();
+
+  constexpr int kOuterTasks = 16;
+  constexpr int kInnerTasks = 100;
+  std::atomic<int> counter{0};
+
+  auto outer = engine::AsyncNoSpan(*task_processor, [&counter] {
+    std::vector<engine::TaskWithResult<void>> outer_tasks;
+    outer_tasks.reserve(kOuterTasks);
+    for (int i = 0; i < kOuterTasks; ++i) {
+      outer_tasks.push_back(engine::AsyncNoSpan([&counter] {
+        std::vector<engine::TaskWithResult<void>> inner_tasks;
+        inner_tasks.reserve(kInnerTasks);
+        for (int j = 0; j < kInnerTasks; ++j) {
+          inner_tasks.push_back(engine::AsyncNoSpan([&counter] { ++counter; }));
+        }
+        for (auto& task : inner_tasks) task.Get();
+      }));
+    }
+    for (auto& task : outer_tasks) task.Get();
+  });
+
+  outer.Get();
+  EXPECT_EQ(counter.load(), kOuterTasks * kInnerTasks);
+}
+
+UTEST(WorkStealingTaskQueue, PingPong) {
+  auto task_processor = MakeWorkStealingTaskProcessor();
+
+  constexpr int kIterations = 1000;
+  engine::SingleConsumerEvent ping;
+  engine::SingleConsumerEvent pong;
+
+  auto pinger = engine::AsyncNoSpan(*task_processor, [&] {
+    for (int i = 0; i < kIterations; ++i) {
+      ping.Send();
+      ASSERT_TRUE(pong.WaitForEvent());
+    }
+  });
+  auto ponger = engine::AsyncNoSpan(*task_processor, [&] {
+    for (int i = 0; i < kIterations; ++i) {
+      ASSERT_TRUE(ping.WaitForEvent());
+      pong.Send();
+    }
+  });
+
+  pinger.Get();
+  ponger.Get();
+}
+
+UTEST(WorkStealingTaskQueue, WakesUpFromSleep) {
+  auto task_processor = MakeWorkStealingTaskProcessor();
+
+  // Let all the workers park
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  auto task = engine::AsyncNoSpan(*task_processor, [] { return 42; });
+  EXPECT_EQ(task.Get(), 42);
+}
+
+USERVER_NAMESPACE_END
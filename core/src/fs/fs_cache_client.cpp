@@ -24,8 +24,10 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
+  // Only the new and modified files are read again
+  const FileInfoWithDataMap previous = data_.GetSnapshot();
   auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+      tp_, dir_, {fs::SettingsReadFile::kSkipHidden}, previous);
   data_.Assign(std::move(map));
 }
 
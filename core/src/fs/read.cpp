@@ -1,5 +1,7 @@
 #include <userver/fs/read.hpp>
 
+#include <functional>
+
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 
@@ -21,33 +23,66 @@ std::string GetRelative(std::string_view path, std::string_view dir) {
   return std::string{rel};
 }
 
-}  // namespace
+FileInfoWithDataMap DoReadRecursiveFilesInfoWithData(
+    const std::string& path, utils::Flags<SettingsReadFile> flags,
+    const FileInfoWithDataMap& previous) {
+  // The files modified in this second or later may be modified again without
+  // a change of the modification time
+  const auto start_time = std::time(nullptr);
 
-std::string ReadFileContents(engine::TaskProcessor& async_tp,
-                             const std::string& path) {
-  return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
-      .Get();
-}
-
-FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
-    engine::TaskProcessor& async_tp, const std::string& path,
-    utils::Flags<SettingsReadFile> flags) {
   FileInfoWithDataMap data{};
   for (const auto& f : boost::filesystem::recursive_directory_iterator(path)) {
     // only files
     if (f.status().type() != boost::filesystem::regular_file) continue;
     if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(f.path()))
       continue;
+
+    auto relative_path = GetRelative(f.path().string(), path);
+    const auto size = boost::filesystem::file_size(f.path());
+    const auto last_write_time = boost::filesystem::last_write_time(f.path());
+
+    const auto it = previous.find(relative_path);
+    if (it != previous.end() && last_write_time != 0 &&
+        it->second->last_write_time == last_write_time &&
+        it->second->size == size) {
+      data.emplace(std::move(relative_path), it->second);
+      continue;
+    }
+
     FileInfoWithData info{};
-    info.size = boost::filesystem::file_size(f.path());
+    info.size = size;
     info.extension = f.path().extension().string();
-    info.data = ReadFileContents(async_tp, f.path().string());
-    data[GetRelative(f.path().string(), path)] =
+    info.data = fs::blocking::ReadFileContents(f.path().string());
+    if (last_write_time < start_time) info.last_write_time = last_write_time;
+    data[std::move(relative_path)] =
         std::make_shared<const FileInfoWithData>(std::move(info));
   }
   return data;
 }
 
+}  // namespace
+
+std::string ReadFileContents(engine::TaskProcessor& async_tp,
+                             const std::string& path) {
+  return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
+      .Get();
+}
+
+FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    utils::Flags<SettingsReadFile> flags) {
+  return ReadRecursiveFilesInfoWithData(async_tp, path, flags, {});
+}
+
+FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    utils::Flags<SettingsReadFile> flags, const FileInfoWithDataMap& previous) {
+  // One task for the whole traversal instead of a task per file
+  return engine::AsyncNoSpan(async_tp, &DoReadRecursiveFilesInfoWithData,
+                             std::cref(path), flags, std::cref(previous))
+      .Get();
+}
+
 bool FileExists(engine::TaskProcessor& async_tp, const std::string& path) {
   return engine::AsyncNoSpan(async_tp, &fs::blocking::FileExists, path).Get();
 }
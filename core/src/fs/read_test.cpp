@@ -0,0 +1,71 @@
+#include <userver/utest/utest.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/fs/read.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void WriteOldFile(const std::string& path, std::string_view contents,
+                  std::time_t last_write_time) {
+  fs::blocking::RewriteFileContents(path, contents);
+  boost::filesystem::last_write_time(path, last_write_time);
+}
+
+}  // namespace
+
+UTEST(AsyncFs, ReadRecursiveFilesInfoWithData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  fs::blocking::CreateDirectories(dir.GetPath() + "/subdir");
+  fs::blocking::RewriteFileContents(dir.GetPath() + "/a.txt", "a");
+  fs::blocking::RewriteFileContents(dir.GetPath() + "/subdir/b.html", "bb");
+  fs::blocking::RewriteFileContents(dir.GetPath() + "/.hidden", "hidden");
+
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+  const auto files =
+      fs::ReadRecursiveFilesInfoWithData(async_tp, dir.GetPath());
+
+  ASSERT_EQ(files.size(), 2);
+  EXPECT_EQ(files.at("/a.txt")->data, "a");
+  EXPECT_EQ(files.at("/a.txt")->extension, ".txt");
+  EXPECT_EQ(files.at("/subdir/b.html")->data, "bb");
+  EXPECT_EQ(files.at("/subdir/b.html")->size, 2);
+}
+
+UTEST(AsyncFs, ReadRecursiveFilesInfoWithDataIncremental) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto old_time = std::time(nullptr) - 100;
+  WriteOldFile(dir.GetPath() + "/same", "same", old_time);
+  WriteOldFile(dir.GetPath() + "/changed", "old", old_time);
+  WriteOldFile(dir.GetPath() + "/removed", "removed", old_time);
+  fs::blocking::RewriteFileContents(dir.GetPath() + "/recent", "recent");
+
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+  const auto previous =
+      fs::ReadRecursiveFilesInfoWithData(async_tp, dir.GetPath(), {});
+  // The recently modified file may change again within the same second
+  EXPECT_EQ(previous.at("/same")->last_write_time, old_time);
+  EXPECT_EQ(previous.at("/recent")->last_write_time, 0);
+
+  WriteOldFile(dir.GetPath() + "/changed", "new", old_time + 1);
+  boost::filesystem::remove(dir.GetPath() + "/removed");
+  fs::blocking::RewriteFileContents(dir.GetPath() + "/added", "added");
+
+  const auto files = fs::ReadRecursiveFilesInfoWithData(
+      async_tp, dir.GetPath(), {}, previous);
+
+  ASSERT_EQ(files.size(), 4);
+  EXPECT_EQ(files.at("/same"), previous.at("/same"));
+  EXPECT_NE(files.at("/recent"), previous.at("/recent"));
+  EXPECT_EQ(files.at("/recent")->data, "recent");
+  EXPECT_EQ(files.at("/changed")->data, "new");
+  EXPECT_EQ(files.at("/added")->data, "added");
+  EXPECT_EQ(files.count("/removed"), 0);
+}
+
+USERVER_NAMESPACE_END
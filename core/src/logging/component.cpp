@@ -7,6 +7,7 @@
 #include <boost/filesystem/operations.hpp>
 
 #include <logging/config.hpp>
+#include <logging/impl/batching_file_sink.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/fd_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
@@ -65,17 +66,26 @@ void CreateLogDirectory(const std::string& logger_name,
 }
 
 logging::impl::SinkPtr GetSinkFromFilename(
-    const spdlog::filename_t& file_path) {
+    const logging::LoggerConfig& config,
+    logging::statistics::LogStatistics& stats) {
+  const auto& file_path = config.file_path;
   if (boost::starts_with(file_path, kUnixSocketPrefix)) {
     // Use Unix-socket sink
     return std::make_shared<logging::impl::UnixSocketSink>(
         file_path.substr(kUnixSocketPrefix.size()));
+  } else if (config.batched_writes) {
+    auto sink = std::make_shared<logging::impl::BatchingFileSink>(
+        file_path, *config.batched_writes);
+    stats.write = sink->GetWriteStatistics();
+    return sink;
   } else {
     return std::make_shared<logging::impl::BufferedFileSink>(file_path);
   }
 }
 
-logging::impl::SinkPtr MakeOptionalSink(const logging::LoggerConfig& config) {
+logging::impl::SinkPtr MakeOptionalSink(
+    const logging::LoggerConfig& config,
+    logging::statistics::LogStatistics& stats) {
   if (config.file_path == "@null") {
     return nullptr;
   } else if (config.file_path == "@stderr") {
@@ -84,7 +94,7 @@ logging::impl::SinkPtr MakeOptionalSink(const logging::LoggerConfig& config) {
     return std::make_shared<logging::impl::BufferedUnownedFileSink>(stdout);
   } else {
     CreateLogDirectory(config.logger_name, config.file_path);
-    return GetSinkFromFilename(config.file_path);
+    return GetSinkFromFilename(config, stats);
   }
 }
 
@@ -102,7 +112,7 @@ std::shared_ptr<logging::impl::TpLogger> MakeLogger(
   logger->SetLevel(config.level);
   logger->SetFlushOn(config.flush_level);
 
-  if (auto basic_sink = MakeOptionalSink(config)) {
+  if (auto basic_sink = MakeOptionalSink(config, logger->GetStatistics())) {
     logger->AddSink(std::move(basic_sink));
   }
 
@@ -322,6 +332,7 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -353,6 +364,24 @@ properties:
                         port:
                             type: integer
                             description: testsuite port
+                batched-writes:
+                    type: object
+                    description: if exists, the records are written to the file in large batches, see the options below
+                    defaultDescription: "{}"
+                    additionalProperties: false
+                    properties:
+                        buffer_size:
+                            type: integer
+                            description: size of the buffer to collect the records in, records that do not fit are written together with the buffer
+                            defaultDescription: 1048576
+                        direct_io:
+                            type: boolean
+                            description: write the file with O_DIRECT bypassing the page cache, the file must not be written by anyone else
+                            defaultDescription: false
+                        fdatasync_on_flush:
+                            type: boolean
+                            description: call fdatasync on each flush of the logger
+                            defaultDescription: false
 )");
 }
 
@@ -31,6 +31,16 @@ TestsuiteCaptureConfig Parse(const yaml_config::YamlConfig& value,
   return config;
 }
 
+BatchedWritesConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<BatchedWritesConfig>) {
+  BatchedWritesConfig config;
+  config.buffer_size = value["buffer_size"].As<size_t>(config.buffer_size);
+  config.direct_io = value["direct_io"].As<bool>(config.direct_io);
+  config.fdatasync_on_flush =
+      value["fdatasync_on_flush"].As<bool>(config.fdatasync_on_flush);
+  return config;
+}
+
 void LoggerConfig::SetName(std::string name) { logger_name = std::move(name); }
 
 LoggerConfig Parse(const yaml_config::YamlConfig& value,
@@ -58,6 +68,9 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
   config.testsuite_capture =
       value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
 
+  config.batched_writes =
+      value["batched-writes"].As<std::optional<BatchedWritesConfig>>();
+
   return config;
 }
 
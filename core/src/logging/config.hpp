@@ -19,6 +19,18 @@ struct TestsuiteCaptureConfig final {
 TestsuiteCaptureConfig Parse(const yaml_config::YamlConfig& value,
                              formats::parse::To<TestsuiteCaptureConfig>);
 
+struct BatchedWritesConfig final {
+  static constexpr size_t kDefaultBufferSize = 1 << 20;
+
+  size_t buffer_size = kDefaultBufferSize;
+  // Bypass the page cache with O_DIRECT if the file system supports it
+  bool direct_io = false;
+  bool fdatasync_on_flush = false;
+};
+
+BatchedWritesConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<BatchedWritesConfig>);
+
 enum class QueueOverflowBehavior { kDiscard, kBlock };
 
 QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
@@ -44,6 +56,8 @@ struct LoggerConfig final {
   std::optional<std::string> fs_task_processor;
 
   std::optional<TestsuiteCaptureConfig> testsuite_capture;
+
+  std::optional<BatchedWritesConfig> batched_writes;
 };
 
 LoggerConfig Parse(const yaml_config::YamlConfig& value,
@@ -9,14 +9,15 @@ namespace logging {
 
 bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b) {
   return a.force_enabled == b.force_enabled &&
-         a.force_disabled == b.force_disabled;
+         a.force_disabled == b.force_disabled && a.sampling == b.sampling;
 }
 
 DynamicDebugConfig Parse(const formats::json::Value& value,
                          formats::parse::To<DynamicDebugConfig>) {
   return DynamicDebugConfig{
       value["force-enabled"].As<std::vector<std::string>>(),
-      value["force-disabled"].As<std::vector<std::string>>()};
+      value["force-disabled"].As<std::vector<std::string>>(),
+      value["sampling"].As<std::map<std::string, double>>({})};
 }
 
 }  // namespace logging
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -16,6 +17,8 @@ namespace logging {
 struct DynamicDebugConfig {
   std::vector<std::string> force_enabled;
   std::vector<std::string> force_disabled;
+  // location -> the probability to write a log at the location
+  std::map<std::string, double> sampling;
 };
 
 bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b);
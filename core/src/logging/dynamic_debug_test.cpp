@@ -91,4 +91,96 @@ TEST_F(LoggingTest, DynamicDebugAnyLineRemove) {
   EXPECT_FALSE(LoggedTextContains("after"));
 }
 
+namespace {
+
+std::uint64_t GetSuppressedCount(const std::string& location, int line) {
+  const auto& locations = logging::GetDynamicDebugLocations();
+  const auto it = locations.find({location.c_str(), line});
+  EXPECT_NE(it, locations.end());
+  return it == locations.end() ? 0 : it->suppressed.load();
+}
+
+}  // namespace
+
+TEST_F(LoggingTest, DynamicDebugSamplingNone) {
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+
+  const std::string location = USERVER_FILEPATH;
+  logging::SetDynamicDebugSampling(location, 30001, 0);
+  const auto suppressed_before = GetSuppressedCount(location, 30001);
+
+  for (int i = 0; i < 10; ++i) {
+#line 30001
+    LOG_INFO() << "dropped";
+  }
+  LOG_INFO() << "kept";
+
+  logging::SetDynamicDebugSampling(location, 30001, 1);
+
+  EXPECT_FALSE(LoggedTextContains("dropped"));
+  EXPECT_TRUE(LoggedTextContains("kept"));
+  EXPECT_EQ(GetSuppressedCount(location, 30001) - suppressed_before, 10);
+}
+
+TEST_F(LoggingTest, DynamicDebugSamplingRate) {
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+
+  const std::string location = USERVER_FILEPATH;
+  logging::SetDynamicDebugSampling(location, 31001, 0.5);
+  const auto suppressed_before = GetSuppressedCount(location, 31001);
+
+  constexpr int kCount = 1000;
+  for (int i = 0; i < kCount; ++i) {
+#line 31001
+    LOG_INFO() << "sampled";
+  }
+
+  logging::SetDynamicDebugSampling(location, 31001, 1);
+
+  const auto suppressed =
+      GetSuppressedCount(location, 31001) - suppressed_before;
+  EXPECT_GT(suppressed, kCount / 4);
+  EXPECT_LT(suppressed, kCount * 3 / 4);
+  EXPECT_EQ(GetRecordsCount(), kCount - suppressed);
+}
+
+TEST_F(LoggingTest, DynamicDebugSamplingKeepsWarnings) {
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+
+  const std::string location = USERVER_FILEPATH;
+  logging::SetDynamicDebugSampling(location, logging::kAnyLine, 0);
+
+#line 32001
+  LOG_WARNING() << "warning";
+  LOG_INFO() << "info";
+
+  logging::SetDynamicDebugSampling(location, logging::kAnyLine, 1);
+
+  EXPECT_TRUE(LoggedTextContains("warning"));
+  EXPECT_FALSE(LoggedTextContains("info"));
+}
+
+TEST_F(LoggingTest, DynamicDebugSamplingForceEnabled) {
+  SetDefaultLoggerLevel(logging::Level::kNone);
+
+  const std::string location = USERVER_FILEPATH;
+  logging::SetDynamicDebugSampling(location, 33001, 0);
+  logging::AddDynamicDebugLog(location, 33001);
+
+#line 33001
+  LOG_INFO() << "forced";
+
+  logging::RemoveDynamicDebugLog(location, 33001);
+  logging::SetDynamicDebugSampling(location, 33001, 1);
+
+  EXPECT_TRUE(LoggedTextContains("forced"));
+}
+
+TEST_F(LoggingTest, DynamicDebugSamplingBadRate) {
+  const std::string location = USERVER_FILEPATH;
+  UEXPECT_THROW_MSG(
+      logging::SetDynamicDebugSampling(location, logging::kAnyLine, 1.5),
+      std::runtime_error, "not in [0, 1]");
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,246 @@
+#include "batching_file_sink.hpp"
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// Satisfies the O_DIRECT requirements of all the common file systems
+constexpr std::size_t kAlignment = 4096;
+
+constexpr std::size_t RoundDown(std::size_t value) noexcept {
+  return value / kAlignment * kAlignment;
+}
+
+constexpr std::size_t RoundUp(std::size_t value) noexcept {
+  return RoundDown(value + kAlignment - 1);
+}
+
+char* AllocateBuffer(std::size_t size) {
+  UASSERT(size % kAlignment == 0);
+  auto* const buffer = static_cast<char*>(std::aligned_alloc(kAlignment, size));
+  if (!buffer) throw std::bad_alloc();
+  return buffer;
+}
+
+// Writes all the iovecs, retrying on partial writes and EINTR
+void WriteAll(int fd, iovec* iov, int iov_count, const std::string& filename) {
+  while (iov_count > 0) {
+    const auto written = ::writev(fd, iov, iov_count);
+    if (written == -1 && errno == EINTR) continue;
+    auto left = static_cast<std::size_t>(
+        utils::CheckSyscall(written, "writing to the log file '{}'", filename));
+
+    for (; iov_count > 0 && left >= iov->iov_len; ++iov, --iov_count) {
+      left -= iov->iov_len;
+    }
+    if (iov_count > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+      iov->iov_len -= left;
+    }
+  }
+}
+
+void PWriteAll(int fd, const char* data, std::size_t size, std::size_t offset,
+               const std::string& filename) {
+  while (size > 0) {
+    const auto written = ::pwrite(fd, data, size, offset);
+    if (written == -1 && errno == EINTR) continue;
+    const auto count = static_cast<std::size_t>(
+        utils::CheckSyscall(written, "writing to the log file '{}'", filename));
+    data += count;
+    size -= count;
+    offset += count;
+  }
+}
+
+}  // namespace
+
+void BatchingFileSink::FreeDeleter::operator()(char* buffer) const noexcept {
+  std::free(buffer);
+}
+
+BatchingFileSink::BatchingFileSink(const std::string& filename,
+                                   BatchedWritesConfig config)
+    : filename_(filename),
+      config_(config),
+      buffer_size_(RoundUp(std::max(config.buffer_size, kAlignment))),
+      buffer_(AllocateBuffer(buffer_size_)),
+      fd_(OpenFile<fs::blocking::FileDescriptor>(filename)),
+      stats_(std::make_shared<statistics::WriteStatistics>()) {
+  SetUpFile();
+  if (fd_.GetSize() > 0) {
+    Write("\n");
+  }
+}
+
+BatchingFileSink::~BatchingFileSink() {
+  try {
+    FlushBuffer();
+  } catch (const std::exception&) {
+    // Nowhere to report the error, the logging is being shut down
+  }
+}
+
+void BatchingFileSink::Reopen(ReopenMode mode) {
+  const std::lock_guard lock{GetMutex()};
+  FlushBuffer();
+
+  std::move(fd_).Close();
+  fd_ = OpenFile<fs::blocking::FileDescriptor>(filename_, mode);
+  SetUpFile();
+}
+
+void BatchingFileSink::Flush() {
+  const std::lock_guard lock{GetMutex()};
+  if (!fd_.IsOpen()) return;
+
+  FlushBuffer();
+  if (config_.fdatasync_on_flush) {
+    utils::CheckSyscall(::fdatasync(fd_.GetNative()),
+                        "syncing the log file '{}'", filename_);
+  }
+}
+
+std::shared_ptr<const statistics::WriteStatistics>
+BatchingFileSink::GetWriteStatistics() const noexcept {
+  return stats_;
+}
+
+void BatchingFileSink::Write(std::string_view log) {
+  if (!is_direct_) {
+    if (log.size() < buffer_size_ - used_) {
+      std::memcpy(buffer_.get() + used_, log.data(), log.size());
+      used_ += log.size();
+    } else {
+      WriteBuffer(log);
+    }
+    return;
+  }
+
+  // O_DIRECT writes must come from the aligned buffer, so copy the large
+  // records in chunks
+  while (!log.empty()) {
+    const auto count = std::min(log.size(), buffer_size_ - used_);
+    std::memcpy(buffer_.get() + used_, log.data(), count);
+    used_ += count;
+    log.remove_prefix(count);
+    if (used_ == buffer_size_) WriteBufferDirect();
+  }
+}
+
+void BatchingFileSink::SetUpFile() {
+  used_ = 0;
+  written_ = 0;
+  file_offset_ = 0;
+  is_direct_ = false;
+
+  if (!config_.direct_io) return;
+
+  const auto fd = fd_.GetNative();
+  const auto flags =
+      utils::CheckSyscall(::fcntl(fd, F_GETFL), "getting flags of '{}'",
+                          filename_);
+  // pwrite ignores the offset for the files opened with O_APPEND
+  const auto result = ::fcntl(fd, F_SETFL, (flags & ~O_APPEND) | O_DIRECT);
+  // The file system does not support O_DIRECT, use the usual writes
+  if (result == -1 && errno == EINVAL) return;
+  utils::CheckSyscall(result, "enabling O_DIRECT for '{}'", filename_);
+  is_direct_ = true;
+
+  // Keep the incomplete last block of the file in the buffer to append to it
+  const auto size = fd_.GetSize();
+  file_offset_ = RoundDown(size);
+  const auto tail_size = size - file_offset_;
+  if (tail_size > 0) {
+    auto reader = fs::blocking::FileDescriptor::Open(
+        filename_, fs::blocking::OpenFlag::kRead);
+    std::size_t read = 0;
+    while (read < tail_size) {
+      const auto count = ::pread(reader.GetNative(), buffer_.get() + read,
+                                 tail_size - read, file_offset_ + read);
+      if (count == -1 && errno == EINTR) continue;
+      const auto checked = utils::CheckSyscall(
+          count, "reading the tail of the log file '{}'", filename_);
+      UINVARIANT(checked > 0, "The log file was truncated concurrently");
+      read += static_cast<std::size_t>(checked);
+    }
+  }
+  used_ = tail_size;
+  written_ = tail_size;
+}
+
+void BatchingFileSink::FlushBuffer() {
+  if (!fd_.IsOpen()) return;
+
+  if (is_direct_) {
+    WriteBufferDirect();
+  } else {
+    WriteBuffer();
+  }
+}
+
+void BatchingFileSink::WriteBuffer(std::string_view extra) {
+  UASSERT(!is_direct_);
+  if (used_ == 0 && extra.empty()) return;
+
+  iovec iov[2]{{buffer_.get(), used_},
+               {const_cast<char*>(extra.data()), extra.size()}};
+  const auto start = std::chrono::steady_clock::now();
+  WriteAll(fd_.GetNative(), iov, extra.empty() ? 1 : 2, filename_);
+  AccountWrite(used_ + extra.size(), start);
+  used_ = 0;
+}
+
+void BatchingFileSink::WriteBufferDirect() {
+  UASSERT(is_direct_);
+  if (used_ == written_) return;
+
+  const auto padded_size = RoundUp(used_);
+  std::memset(buffer_.get() + used_, 0, padded_size - used_);
+
+  const auto start = std::chrono::steady_clock::now();
+  PWriteAll(fd_.GetNative(), buffer_.get(), padded_size, file_offset_,
+            filename_);
+  if (padded_size != used_) {
+    // Cut the padding off, the next write starts from the incomplete block
+    utils::CheckSyscall(::ftruncate(fd_.GetNative(), file_offset_ + used_),
+                        "truncating the log file '{}'", filename_);
+  }
+  AccountWrite(used_ - written_, start);
+
+  const auto complete_size = RoundDown(used_);
+  std::memmove(buffer_.get(), buffer_.get() + complete_size,
+               used_ - complete_size);
+  file_offset_ += complete_size;
+  used_ -= complete_size;
+  written_ = used_;
+}
+
+void BatchingFileSink::AccountWrite(
+    std::size_t bytes, std::chrono::steady_clock::time_point start) noexcept {
+  const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  ++stats_->writes;
+  stats_->written_bytes.Add(utils::statistics::Rate{bytes});
+  stats_->timings.GetCurrentCounter().Account(duration.count());
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+#include <logging/config.hpp>
+#include <logging/impl/base_sink.hpp>
+#include <logging/statistics/log_stats.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+// Aggregates the records into a large aligned buffer and writes it out with a
+// single syscall once the buffer is full or on Flush. Records that do not fit
+// into the buffer are written together with it via writev without copying.
+//
+// With `direct_io` the file is written in aligned blocks at aligned offsets,
+// the incomplete last block is kept in the buffer and is rewritten by the
+// next write. So the sink must be the only writer of the file.
+class BatchingFileSink final : public BaseSink {
+ public:
+  BatchingFileSink(const std::string& filename, BatchedWritesConfig config);
+  ~BatchingFileSink() override;
+
+  void Reopen(ReopenMode mode) override;
+
+  void Flush() override;
+
+  std::shared_ptr<const statistics::WriteStatistics> GetWriteStatistics()
+      const noexcept;
+
+ protected:
+  void Write(std::string_view log) final;
+
+ private:
+  struct FreeDeleter final {
+    void operator()(char* buffer) const noexcept;
+  };
+
+  void SetUpFile();
+  void FlushBuffer();
+  void WriteBuffer(std::string_view extra = {});
+  void WriteBufferDirect();
+  void AccountWrite(std::size_t bytes,
+                    std::chrono::steady_clock::time_point start) noexcept;
+
+  const std::string filename_;
+  const BatchedWritesConfig config_;
+  const std::size_t buffer_size_;
+  const std::unique_ptr<char, FreeDeleter> buffer_;
+  std::size_t used_{0};
+
+  fs::blocking::FileDescriptor fd_;
+  bool is_direct_{false};
+  // For direct I/O: the file offset of buffer_[0] and the count of bytes at
+  // the beginning of the buffer that are already in the file
+  std::size_t file_offset_{0};
+  std::size_t written_{0};
+
+  const std::shared_ptr<statistics::WriteStatistics> stats_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,174 @@
+#include "batching_file_sink.hpp"
+
+#include <gtest/gtest.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/rand.hpp>
+
+#include "sink_helper_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSmallBuffer = 8 * 1024;
+
+class BatchingFileSinkTest : public testing::TestWithParam<bool> {
+ protected:
+  logging::BatchedWritesConfig MakeConfig(
+      std::size_t buffer_size = kSmallBuffer) const {
+    logging::BatchedWritesConfig config;
+    config.buffer_size = buffer_size;
+    config.direct_io = GetParam();
+    return config;
+  }
+
+  std::string MakeFilename() const {
+    return temp_root_.GetPath() + "/temp_file_" +
+           std::to_string(utils::Rand());
+  }
+
+ private:
+  const fs::blocking::TempDirectory temp_root_ =
+      fs::blocking::TempDirectory::Create();
+};
+
+}  // namespace
+
+UTEST_P(BatchingFileSinkTest, TestValidWriteInFile) {
+  const auto filename = MakeFilename();
+  auto sink = logging::impl::BatchingFileSink(filename, MakeConfig());
+  ASSERT_TRUE(boost::filesystem::exists(filename));
+
+  EXPECT_NO_THROW(sink.Log({"default", spdlog::level::warn, "message"}));
+  EXPECT_TRUE(fs::blocking::ReadFileContents(filename).empty());
+
+  EXPECT_NO_THROW(sink.Flush());
+  const auto result =
+      test::NormalizeLogs(fs::blocking::ReadFileContents(filename));
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result.front(), "[datetime] [default] [warning] message");
+
+  const auto stats = sink.GetWriteStatistics();
+  EXPECT_EQ(stats->writes.Load().value, 1);
+  EXPECT_EQ(stats->written_bytes.Load().value,
+            fs::blocking::ReadFileContents(filename).size());
+}
+
+UTEST_P(BatchingFileSinkTest, WritesInBatches) {
+  const auto filename = MakeFilename();
+  auto sink = logging::impl::BatchingFileSink(filename, MakeConfig());
+
+  constexpr std::size_t kCount = 1000;
+  for (std::size_t i = 0; i < kCount; ++i) {
+    sink.Log({"default", spdlog::level::info, "message " + std::to_string(i)});
+  }
+  sink.Flush();
+
+  const auto content = fs::blocking::ReadFileContents(filename);
+  const auto result = test::NormalizeLogs(content);
+  ASSERT_EQ(result.size(), kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(result[i],
+              "[datetime] [default] [info] message " + std::to_string(i));
+  }
+
+  const auto stats = sink.GetWriteStatistics();
+  EXPECT_LE(stats->writes.Load().value, content.size() / kSmallBuffer + 2);
+  EXPECT_EQ(stats->written_bytes.Load().value, content.size());
+}
+
+UTEST_P(BatchingFileSinkTest, LargeRecords) {
+  const auto filename = MakeFilename();
+  auto sink = logging::impl::BatchingFileSink(filename, MakeConfig());
+
+  const std::string msg_a(3 * kSmallBuffer + 17, 'a');
+  const std::string msg_b(test::kOneKb, 'b');
+  sink.Log({"default", spdlog::level::warn, msg_b});
+  sink.Log({"default", spdlog::level::warn, msg_a});
+  sink.Log({"default", spdlog::level::warn, msg_b});
+  sink.Flush();
+
+  const auto result =
+      test::NormalizeLogs(fs::blocking::ReadFileContents(filename));
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[0], "[datetime] [default] [warning] " + msg_b);
+  EXPECT_EQ(result[1], "[datetime] [default] [warning] " + msg_a);
+  EXPECT_EQ(result[2], "[datetime] [default] [warning] " + msg_b);
+}
+
+UTEST_P(BatchingFileSinkTest, AppendsToExistingFile) {
+  const auto filename = MakeFilename();
+  // Not a multiple of the block size
+  fs::blocking::RewriteFileContents(filename, std::string(5000, 'x'));
+
+  {
+    auto sink = logging::impl::BatchingFileSink(filename, MakeConfig());
+    sink.Log({"default", spdlog::level::warn, "message"});
+    sink.Flush();
+    sink.Log({"default", spdlog::level::info, "message 2"});
+  }
+
+  const auto result =
+      test::NormalizeLogs(fs::blocking::ReadFileContents(filename));
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[0], std::string(5000, 'x'));
+  EXPECT_EQ(result[1], "[datetime] [default] [warning] message");
+  EXPECT_EQ(result[2], "[datetime] [default] [info] message 2");
+}
+
+UTEST_P(BatchingFileSinkTest, TestReopenWithTruncateWrite) {
+  const auto filename = MakeFilename();
+  auto sink = logging::impl::BatchingFileSink(filename, MakeConfig());
+  sink.Log({"default", spdlog::level::warn, "message"});
+
+  EXPECT_NO_THROW(sink.Reopen(logging::impl::ReopenMode::kAppend));
+  auto result = test::NormalizeLogs(fs::blocking::ReadFileContents(filename));
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result.front(), "[datetime] [default] [warning] message");
+
+  EXPECT_NO_THROW(sink.Reopen(logging::impl::ReopenMode::kTruncate));
+  EXPECT_TRUE(fs::blocking::ReadFileContents(filename).empty());
+
+  sink.Log({"default", spdlog::level::info, "message 2"});
+  sink.Flush();
+  result = test::NormalizeLogs(fs::blocking::ReadFileContents(filename));
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result.front(), "[datetime] [default] [info] message 2");
+}
+
+UTEST_P(BatchingFileSinkTest, TestReopenMoveFile) {
+  const auto filename = MakeFilename();
+  const auto filename_2 = MakeFilename();
+  ASSERT_NE(filename, filename_2);
+
+  auto sink = logging::impl::BatchingFileSink(filename, MakeConfig());
+  sink.Log({"default", spdlog::level::warn, "message"});
+  sink.Flush();
+  ::rename(filename.c_str(), filename_2.c_str());
+  sink.Log({"default", spdlog::level::info, "message 2"});
+
+  EXPECT_NO_THROW(sink.Reopen(logging::impl::ReopenMode::kAppend));
+  sink.Log({"default", spdlog::level::info, "message 3"});
+  sink.Flush();
+
+  auto result = test::NormalizeLogs(fs::blocking::ReadFileContents(filename_2));
+  ASSERT_EQ(result.size(), 2);
+  EXPECT_EQ(result[0], "[datetime] [default] [warning] message");
+  EXPECT_EQ(result[1], "[datetime] [default] [info] message 2");
+
+  result = test::NormalizeLogs(fs::blocking::ReadFileContents(filename));
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result[0], "[datetime] [default] [info] message 3");
+}
+
+INSTANTIATE_UTEST_SUITE_P(/*no prefix*/, BatchingFileSinkTest,
+                          testing::Values(false, true),
+                          [](const testing::TestParamInfo<bool>& info) {
+                            return info.param ? "DirectIo" : "PageCache";
+                          });
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/utils/rand.hpp>
 
+#include "batching_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "file_sink.hpp"
 
@@ -40,6 +41,22 @@ void check_buffered_file_sink(benchmark::State& state) {
 }
 BENCHMARK(check_buffered_file_sink);
 
+void check_batching_file_sink(benchmark::State& state) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const std::string filename =
+      temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+  logging::BatchedWritesConfig config;
+  config.direct_io = state.range(0) != 0;
+  auto sink = logging::impl::BatchingFileSink(filename, config);
+  for (auto _ : state) {
+    for (auto i = 0; i < kCountLogs; ++i) {
+      sink.Log({"default", spdlog::level::warn, "message"});
+    }
+  }
+  sink.Flush();
+}
+BENCHMARK(check_batching_file_sink)->Arg(0)->Arg(1);
+
 void check_spdlog_file_sink(benchmark::State& state) {
   const auto temp_root = fs::blocking::TempDirectory::Create();
   const std::string filename =
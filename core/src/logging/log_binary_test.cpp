@@ -0,0 +1,101 @@
+#include <gmock/gmock.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/logging/impl/binary_format.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace binary = logging::impl::binary;
+
+std::optional<std::string_view> FindField(const binary::Record& record,
+                                          std::string_view key) {
+  for (const auto& field : record.fields) {
+    if (field.key == key) return field.value;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+TEST_F(LoggingBinaryTest, Basic) {
+  constexpr std::string_view kText = "Some\ttext\nwith \"special\" chars\\";
+  LOG_WARNING() << kText
+                << logging::LogExtra{{"key.with.period", 42},
+                                     {"custom", "value\n"}};
+  logging::LogFlush();
+
+  const auto log = GetStreamString();
+  std::string_view input = log;
+  const auto record = binary::ParseRecord(input);
+  ASSERT_TRUE(record);
+  EXPECT_TRUE(input.empty());
+  EXPECT_FALSE(binary::ParseRecord(input));
+
+  EXPECT_EQ(record->level, logging::Level::kWarning);
+  EXPECT_EQ(FindField(*record, "text"), kText);
+  EXPECT_EQ(FindField(*record, "key.with.period"), "42");
+  EXPECT_EQ(FindField(*record, "custom"), "value\n");
+  EXPECT_TRUE(FindField(*record, "module"));
+  EXPECT_TRUE(FindField(*record, "thread_id"));
+
+  const auto tskv = binary::ToTskv(*record);
+  EXPECT_THAT(tskv, testing::StartsWith("tskv\ttimestamp="));
+  EXPECT_THAT(tskv, testing::HasSubstr("\tlevel=WARNING\t"));
+  EXPECT_THAT(tskv, testing::HasSubstr(
+                        "\ttext=Some\\ttext\\nwith \"special\" chars\\\\\t"));
+  EXPECT_THAT(tskv, testing::HasSubstr("\tkey_with_period=42"));
+  EXPECT_THAT(tskv, testing::HasSubstr("\tcustom=value\\n"));
+
+  const auto json = binary::ToJson(*record);
+  EXPECT_THAT(json, testing::HasSubstr(R"("level":"WARNING")"));
+  EXPECT_THAT(json, testing::HasSubstr(R"("custom":"value\n")"));
+}
+
+TEST_F(LoggingBinaryTest, MultipleRecords) {
+  // Values with 1, 2 and 3 bytes long sizes
+  const std::string medium(300, 'm');
+  const std::string large(20000, 'l');
+
+  LOG_INFO() << "short";
+  LOG_ERROR() << medium;
+  LOG_INFO() << logging::LogExtra{{"large", large}};
+  logging::LogFlush();
+
+  const auto log = GetStreamString();
+  std::string_view input = log;
+
+  const auto first = binary::ParseRecord(input);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(FindField(*first, "text"), "short");
+
+  const auto second = binary::ParseRecord(input);
+  ASSERT_TRUE(second);
+  EXPECT_EQ(second->level, logging::Level::kError);
+  EXPECT_EQ(FindField(*second, "text"), medium);
+  EXPECT_LE(first->timestamp, second->timestamp);
+
+  const auto third = binary::ParseRecord(input);
+  ASSERT_TRUE(third);
+  EXPECT_EQ(FindField(*third, "text"), "");
+  EXPECT_EQ(FindField(*third, "large"), large);
+
+  EXPECT_FALSE(binary::ParseRecord(input));
+}
+
+TEST(LoggingBinaryFormat, Malformed) {
+  std::string_view no_magic = "tskv\ttext=a\n";
+  EXPECT_THROW(binary::ParseRecord(no_magic), std::runtime_error);
+
+  std::string_view truncated = "\xB1\x05\x01";
+  EXPECT_THROW(binary::ParseRecord(truncated), std::runtime_error);
+
+  // Body: timestamp 1, level kInfo, unknown key id 127 with an empty value
+  std::string_view unknown_key("\xB1\x04\x01\x02\x7F\x00", 6);
+  EXPECT_THROW(binary::ParseRecord(unknown_key), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#include <userver/logging/log_fmt.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/logging/log_extra.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EvaluationCounter final {
+  int Get() {
+    ++count;
+    return count;
+  }
+
+  int count{0};
+};
+
+}  // namespace
+
+TEST_F(LoggingTest, FmtBasic) {
+  LOG_CRITICAL_FMT("{} + {} = {:.1f}, {}", 1, 2, 3.0, "done");
+  EXPECT_EQ(LoggedText(), "1 + 2 = 3.0, done");
+}
+
+TEST_F(LoggingTest, FmtNoArgs) {
+  LOG_CRITICAL_FMT("just text");
+  EXPECT_EQ(LoggedText(), "just text");
+}
+
+TEST_F(LoggingTest, FmtEscaping) {
+  const std::string value = "a\tb\nc\\";
+  LOG_CRITICAL_FMT("value: {}\t!", value);
+  EXPECT_EQ(LoggedText(), R"(value: a\tb\nc\\\t!)");
+  EXPECT_EQ(GetRecordsCount(), 1);
+}
+
+TEST_F(LoggingTest, FmtArgumentsNotEvaluated) {
+  EvaluationCounter counter;
+  LOG_TRACE_FMT("{}", counter.Get());
+  LOG_FMT(logging::Level::kDebug, "{}", counter.Get());
+  EXPECT_EQ(counter.count, 0);
+  EXPECT_EQ(GetRecordsCount(), 0);
+
+  LOG_INFO_FMT("{}", counter.Get());
+  EXPECT_EQ(counter.count, 1);
+  EXPECT_EQ(LoggedText(), "1");
+}
+
+TEST_F(LoggingTest, FmtAppending) {
+  LOG_CRITICAL_FMT("answer={}", 42)
+      << ", streamed" << logging::LogExtra{{"key", "value"}};
+  EXPECT_EQ(LoggedText(), "answer=42, streamed");
+  EXPECT_NE(GetStreamString().find("\tkey=value"), std::string::npos);
+}
+
+TEST_F(LoggingTest, FmtTo) {
+  LOG_FMT_TO(GetStreamLogger(), logging::Level::kError, "to {}", "logger");
+  EXPECT_EQ(LoggedText(), "to logger");
+}
+
+TEST_F(LoggingBinaryTest, FmtNotEscaped) {
+  LOG_CRITICAL_FMT("a\t{}", "b\n");
+  EXPECT_NE(GetStreamString().find("a\tb\n"), std::string::npos);
+}
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/logging/log_fmt.hpp>
 #include <userver/logging/logger.hpp>
 
 #include <utils/gbench_auxilary.hpp>
@@ -100,6 +101,46 @@ BENCHMARK_REGISTER_F(LogHelperBenchmark, LogCheck)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogNumbersStream)
+(benchmark::State& state) {
+  const auto id = Launder(42);
+  const auto ratio = Launder(0.25);
+  for (auto _ : state) {
+    LOG_INFO() << "id=" << id << " ratio=" << ratio << " done";
+  }
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogNumbersStream);
+
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogNumbersFmt)
+(benchmark::State& state) {
+  const auto id = Launder(42);
+  const auto ratio = Launder(0.25);
+  for (auto _ : state) {
+    LOG_INFO_FMT("id={} ratio={} done", id, ratio);
+  }
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogNumbersFmt);
+
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogStringFmt)(benchmark::State& state) {
+  const auto msg = Launder(std::string(state.range(0), '*'));
+  for (auto _ : state) {
+    LOG_INFO_FMT("message: {}", msg);
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogStringFmt)
+    ->RangeMultiplier(2)
+    ->Range(8, 8 << 10)
+    ->Complexity();
+
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogCheckFmt)(benchmark::State& state) {
+  const auto msg = Launder(std::string(state.range(0), '*'));
+  for (auto _ : state) {
+    LOG_TRACE_FMT("message: {}", msg);
+  }
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogCheckFmt)->Arg(8);
+
 struct StreamedStruct {
   int64_t intVal;
   std::string stringVal;
@@ -135,4 +135,11 @@ class LoggingLtsvTest : public LoggingTestBase {
   }
 };
 
+class LoggingBinaryTest : public LoggingTestBase {
+ protected:
+  LoggingBinaryTest() : LoggingTestBase(logging::Format::kBinary) {
+    SetDefaultLogger(GetStreamLogger());
+  }
+};
+
 USERVER_NAMESPACE_END
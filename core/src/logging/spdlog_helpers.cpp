@@ -12,6 +12,8 @@ const std::string& GetSpdlogPattern(Format format) {
   static const std::string kSpdlogLtsvPattern =
       "timestamp:%Y-%m-%dT%H:%M:%S.%f\tlevel:%l%v";
   static const std::string kSpdlogRawPattern = "%v";
+  // The timestamp and the level are encoded by the LogHelper
+  static const std::string kSpdlogBinaryPattern = "%v";
 
   switch (format) {
     case Format::kTskv:
@@ -20,6 +22,8 @@ const std::string& GetSpdlogPattern(Format format) {
       return kSpdlogLtsvPattern;
     case Format::kRaw:
       return kSpdlogRawPattern;
+    case Format::kBinary:
+      return kSpdlogBinaryPattern;
   }
 
   UINVARIANT(false, "Invalid logging::Format enum value");
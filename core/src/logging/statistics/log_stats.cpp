@@ -6,6 +6,13 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::statistics {
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const WriteStatistics& stats) {
+  writer["writes"] = stats.writes;
+  writer["written_bytes"] = stats.written_bytes;
+  writer["timings"] = stats.timings;
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats) {
   writer["dropped"].ValueWithLabels(stats.dropped, {"version", "2"});
 
@@ -19,6 +26,8 @@ void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats) {
   }
 
   writer["total"] = total;
+
+  if (stats.write) writer["write"] = *stats.write;
 }
 
 }  // namespace logging::statistics
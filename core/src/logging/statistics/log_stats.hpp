@@ -1,9 +1,13 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
 #include <userver/logging/level.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,12 +16,33 @@ namespace logging::statistics {
 
 using Counter = utils::statistics::RateCounter;
 
+// Precise up to 2ms, then with 1ms buckets up to 258ms
+using WriteTimingsPercentile =
+    utils::statistics::Percentile<2048, std::uint32_t, 256, 1000>;
+
+/// Statistics of the sinks that write the records in batches
+struct WriteStatistics final {
+  Counter writes{};
+  Counter written_bytes{};
+  // In microseconds
+  utils::statistics::RecentPeriod<WriteTimingsPercentile,
+                                  WriteTimingsPercentile,
+                                  utils::datetime::SteadyClock>
+      timings{};
+};
+
 struct LogStatistics final {
   Counter dropped{};
 
   std::array<Counter, kLevelMax + 1> by_level{};
+
+  // Set before the logger starts for the sinks that collect it
+  std::shared_ptr<const WriteStatistics> write{};
 };
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const WriteStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats);
 
 }  // namespace logging::statistics
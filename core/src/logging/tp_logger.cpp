@@ -3,6 +3,7 @@
 #include <spdlog/common.h>
 #include <spdlog/spdlog.h>
 
+#include <compiler/tls.hpp>
 #include <engine/task/task_context.hpp>
 #include <logging/spdlog_helpers.hpp>
 #include <userver/engine/async.hpp>
@@ -15,6 +16,32 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kThreadBufferCacheSize = 4;
+
+struct ThreadBufferCache final {
+  struct Entry final {
+    std::uint64_t logger_id{0};
+    async::ThreadBuffer* buffer{nullptr};
+  };
+
+  std::array<Entry, kThreadBufferCacheSize> entries{};
+  std::size_t next_evicted{0};
+};
+
+// Logger ids are never reused, so the entries of the destroyed loggers
+// never match
+thread_local ThreadBufferCache thread_buffer_cache;
+
+USERVER_PREVENT_TLS_CACHING ThreadBufferCache& GetThreadBufferCache() noexcept {
+  return thread_buffer_cache;
+}
+
+std::atomic<std::uint64_t> last_logger_id{0};
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
   TpLogger& logger;
 
@@ -27,6 +54,10 @@ struct TpLogger::ActionVisitor final {
     // The consumer thread will check state_ later.
   }
 
+  void operator()(impl::async::DrainBuffer&& drain) const noexcept {
+    logger.ConsumeThreadBuffer(*drain.buffer);
+  }
+
   template <class Flush>
   void operator()(Flush&& flush) const {
     logger.BackendFlush();
@@ -36,6 +67,7 @@ struct TpLogger::ActionVisitor final {
 
 TpLogger::TpLogger(Format format, std::string logger_name)
     : LoggerBase(format),
+      id_(++last_logger_id),
       logger_name_(std::move(logger_name)),
       formatter_pattern_(GetSpdlogPattern(format)) {
   SetLevel(logging::Level::kInfo);
@@ -133,7 +165,7 @@ void TpLogger::Log(Level level, std::string_view msg) {
     // in queue_ will not typically go over max_size + n_threads.
     produced_->fetch_add(1);
 
-    Push(std::move(action));
+    if (!TryPushToThreadBuffer(action)) Push(std::move(action));
   } else {
     ++stats_.dropped;
   }
@@ -230,6 +262,50 @@ void TpLogger::Push(impl::async::Action&& action) {
   DoPush(*node.release());
 }
 
+bool TpLogger::TryPushToThreadBuffer(impl::async::Log& log) {
+  // In sync mode the records are written out right away, the buffers would
+  // only add latency
+  if (state_.load() != State::kAsync) return false;
+
+  auto* const buffer = GetThreadBuffer();
+  if (!buffer || !buffer->TryPush(log)) return false;
+
+  // The previously pushed node is still in the queue otherwise, and the
+  // consumer will see the new record when processing it.
+  if (buffer->TrySchedule()) DoPush(buffer->node);
+  return true;
+}
+
+impl::async::ThreadBuffer* TpLogger::GetThreadBuffer() {
+  auto& cache = GetThreadBufferCache();
+  for (const auto& entry : cache.entries) {
+    if (entry.logger_id == id_) return entry.buffer;
+  }
+
+  auto* const buffer = FindOrCreateThreadBuffer();
+  if (!buffer) return nullptr;
+
+  auto& evicted = cache.entries[cache.next_evicted];
+  cache.next_evicted = (cache.next_evicted + 1) % kThreadBufferCacheSize;
+  evicted = {id_, buffer};
+  return buffer;
+}
+
+impl::async::ThreadBuffer* TpLogger::FindOrCreateThreadBuffer() {
+  // The buffers of the finished threads are reused by the new threads that
+  // get the same id, so there is still a single producer per buffer.
+  const auto thread_id = std::this_thread::get_id();
+
+  const std::lock_guard lock{thread_buffers_mutex_};
+  const auto it = thread_buffers_.find(thread_id);
+  if (it != thread_buffers_.end()) return it->second.get();
+  if (thread_buffers_.size() >= kMaxThreadBuffers) return nullptr;
+
+  auto& buffer = thread_buffers_[thread_id];
+  buffer = std::make_unique<impl::async::ThreadBuffer>();
+  return buffer.get();
+}
+
 void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   auto consumer = queue_.PushAndTryStartConsuming(node);
   if (consumer.IsValid()) {
@@ -253,14 +329,48 @@ void TpLogger::AccountLogConsumed() noexcept {
   }
 }
 
+void TpLogger::AccountLogsConsumed(std::size_t count) noexcept {
+  if (count == 0) return;
+
+  consumed_->store(consumed_->load(std::memory_order_relaxed) +
+                       static_cast<QueueSize>(count),
+                   std::memory_order_relaxed);
+  if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
+    {
+      // See the comment in AccountLogConsumed
+      const std::lock_guard lock{capacity_waiters_mutex_};
+    }
+    capacity_waiters_cv_.NotifyAll();
+  }
+}
+
 void TpLogger::ConsumeNode(
     concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
   auto& action_node = static_cast<impl::async::ActionNode&>(node);
   if (&action_node == &stop_node_) return;
 
+  // The node of a ThreadBuffer is owned by the buffer and is pushed again on
+  // the next drain request.
+  const bool is_owned_by_buffer =
+      std::holds_alternative<impl::async::DrainBuffer>(action_node.action);
+
   BackendPerform(std::move(action_node.action));
-  delete &action_node;
+  if (!is_owned_by_buffer) delete &action_node;
+}
+
+void TpLogger::ConsumeThreadBuffer(
+    impl::async::ThreadBuffer& buffer) noexcept {
+  const auto count = buffer.Drain([this](impl::async::Log&& log) {
+    try {
+      BackendLog(std::move(log));
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, fmt::format(
+                             "Exception while doing an async logging: {}",
+                             e.what()));
+    }
+  });
+  AccountLogsConsumed(count);
 }
 
 void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
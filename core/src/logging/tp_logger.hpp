@@ -1,11 +1,16 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -47,12 +52,89 @@ struct FlushThreaded {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded>;
+class ThreadBuffer;
+
+// Asks the consumer to write out all the records of the buffer
+struct DrainBuffer {
+  ThreadBuffer* buffer;
+};
+
+using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, DrainBuffer>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
   Action action{Stop{}};
 };
 
+// A lock-free single-producer single-consumer ring of log records, there is
+// one per each logger and thread. The producer schedules the drain by pushing
+// the embedded `node` into the logger queue once the buffer becomes
+// non-empty, so a single queue push serves a whole batch of records.
+class ThreadBuffer final {
+ public:
+  static constexpr std::size_t kCapacity = 128;
+
+  ThreadBuffer() noexcept { node.action = DrainBuffer{this}; }
+
+  ThreadBuffer(ThreadBuffer&&) = delete;
+  ThreadBuffer& operator=(ThreadBuffer&&) = delete;
+
+  // For the owning thread only. Leaves `log` intact if the buffer is full.
+  bool TryPush(Log& log) noexcept {
+    auto& producer = *producer_;
+    const auto tail = producer.tail.load(std::memory_order_relaxed);
+    if (tail - producer.cached_head == kCapacity) {
+      producer.cached_head = head_->load(std::memory_order_acquire);
+      if (tail - producer.cached_head == kCapacity) return false;
+    }
+
+    records_[tail % kCapacity] = std::move(log);
+    // seq_cst store and load in TrySchedule pair with the ones in Drain: either
+    // the consumer sees the new tail, or we see the cleared flag.
+    producer.tail.store(tail + 1);
+    return true;
+  }
+
+  // For the owning thread only. Returns `true` if `node` should be pushed
+  // into the queue.
+  bool TrySchedule() noexcept {
+    auto& is_scheduled = producer_->is_scheduled;
+    return !is_scheduled.load() && !is_scheduled.exchange(true);
+  }
+
+  // For the queue consumer only. Calls `func(Log&&)` for all the published
+  // records and frees them, returns their count.
+  template <typename Func>
+  std::size_t Drain(Func&& func) noexcept {
+    auto& producer = *producer_;
+    producer.is_scheduled.store(false);
+
+    const auto head = head_->load(std::memory_order_relaxed);
+    const auto tail = producer.tail.load();
+    for (auto index = head; index != tail; ++index) {
+      // The record is moved out, so that the slot does not retain the payload
+      // memory until it is reused
+      auto log = std::move(records_[index % kCapacity]);
+      func(std::move(log));
+    }
+    head_->store(tail, std::memory_order_release);
+    return tail - head;
+  }
+
+  ActionNode node;
+
+ private:
+  struct ProducerSide final {
+    std::atomic<std::size_t> tail{0};
+    // The last seen head_
+    std::size_t cached_head{0};
+    std::atomic<bool> is_scheduled{false};
+  };
+
+  std::array<Log, kCapacity> records_{};
+  concurrent::impl::InterferenceShield<ProducerSide> producer_;
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>> head_{0};
+};
+
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
@@ -91,19 +173,28 @@ class TpLogger final : public LoggerBase {
   using Queue = engine::impl::AsyncFlatCombiningQueue;
   using QueueSize = std::int64_t;
 
+  // Threads over the limit use the queue directly
+  static constexpr std::size_t kMaxThreadBuffers = 256;
+
   void ProcessingLoop();
   bool HasFreeQueueCapacity() noexcept;
   bool TryWaitFreeQueueCapacity();
   void Push(impl::async::Action&& action);
+  bool TryPushToThreadBuffer(impl::async::Log& log);
+  impl::async::ThreadBuffer* GetThreadBuffer();
+  impl::async::ThreadBuffer* FindOrCreateThreadBuffer();
+  void ConsumeThreadBuffer(impl::async::ThreadBuffer& buffer) noexcept;
   void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
   void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
   void AccountLogConsumed() noexcept;
+  void AccountLogsConsumed(std::size_t count) noexcept;
   void BackendPerform(impl::async::Action&& action) noexcept;
   void BackendLog(impl::async::Log&& action) const;
   void BackendFlush() const;
 
+  const std::uint64_t id_;
   const std::string logger_name_;
   const std::string formatter_pattern_;
   std::vector<impl::SinkPtr> sinks_;
@@ -122,6 +213,10 @@ class TpLogger final : public LoggerBase {
   impl::async::ActionNode stop_node_;
 
   Queue queue_;
+  std::mutex thread_buffers_mutex_;
+  std::unordered_map<std::thread::id,
+                     std::unique_ptr<impl::async::ThreadBuffer>>
+      thread_buffers_;
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
 };
@@ -1,9 +1,14 @@
 #include <logging/tp_logger.hpp>
 
+#include <atomic>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <logging/impl/null_sink.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
@@ -64,4 +69,37 @@ BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+// The consumer runs on one of the threads, the others log concurrently
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringContention)
+(benchmark::State& state) {
+  const std::size_t producers = state.range(0);
+  engine::RunStandalone(producers + 1, [&] {
+    auto scope = StartAsyncLoggerScope();
+    const auto msg = Launder(std::string(64, '*'));
+
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(producers - 1);
+    for (std::size_t i = 1; i < producers; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&] {
+        while (keep_running) {
+          LOG_INFO() << msg;
+        }
+      }));
+    }
+
+    for (auto _ : state) {
+      LOG_INFO() << msg;
+    }
+
+    keep_running = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringContention)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
 USERVER_NAMESPACE_END
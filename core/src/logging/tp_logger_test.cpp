@@ -4,6 +4,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/pretty_format.hpp>
@@ -602,6 +603,27 @@ UTEST_F(LoggingTestCoro, TpLoggerFlushMultiple) {
   EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
 }
 
+UTEST_F(LoggingTestCoro, TpLoggerKeepsOrder) {
+  auto logger = StartAsyncLogger(kLoggingTestIterations);
+
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    LOG_INFO_TO(logger) << i << ';';
+    // Overflow the per-thread buffer of the logger between the yields
+    if (i % (logging::impl::async::ThreadBuffer::kCapacity * 3 / 2) == 0) {
+      engine::Yield();
+    }
+  }
+  logger->StopConsumerTask();
+
+  const auto logs = GetStreamString();
+  std::size_t position = 0;
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    position = logs.find(fmt::format("text={};", i), position);
+    ASSERT_NE(position, std::string::npos) << "Record " << i;
+  }
+  EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
+}
+
 UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleMT, 4) {
   const std::size_t message_count =
       kLoggingTestIterations * (GetThreadCount() - 1);
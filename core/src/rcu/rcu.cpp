@@ -1,16 +1,74 @@
 #include <userver/rcu/rcu.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace rcu::impl {
 
+namespace {
+
+std::atomic<EpochRecord*> epoch_records_head{nullptr};
+
+// Returns the record to the pool on thread exit
+struct EpochRecordOwner final {
+  ~EpochRecordOwner() {
+    if (record) record->is_owned = false;
+    this_thread_epoch_record = nullptr;
+  }
+
+  EpochRecord* record{nullptr};
+};
+
+thread_local EpochRecordOwner epoch_record_owner;
+
+EpochRecord& FindOrCreateEpochRecord() {
+  for (auto* record = epoch_records_head.load(); record;
+       record = record->next) {
+    bool expected = false;
+    if (!record->is_owned.load() &&
+        record->is_owned.compare_exchange_strong(expected, true)) {
+      return *record;
+    }
+  }
+
+  auto* record = new EpochRecord();
+  record->is_owned = true;
+  auto* head = epoch_records_head.load();
+  do {
+    record->next = head;
+  } while (!epoch_records_head.compare_exchange_weak(head, record));
+  return *record;
+}
+
+}  // namespace
+
 uint64_t GetNextEpoch() noexcept {
   static std::atomic<uint64_t> counter{1};  // 0 is the default value in data
   return counter++;
 }
 
+EpochRecord& AcquireThisThreadEpochRecord() {
+  UASSERT(!this_thread_epoch_record);
+  auto& record = FindOrCreateEpochRecord();
+  epoch_record_owner.record = &record;
+  this_thread_epoch_record = &record;
+  return record;
+}
+
+std::uint64_t GetMinPinnedEpoch() noexcept {
+  auto result = std::numeric_limits<std::uint64_t>::max();
+  for (auto* record = epoch_records_head.load(); record;
+       record = record->next) {
+    if (record->readers.load() != 0) {
+      result = std::min(result, record->epoch.load());
+    }
+  }
+  return result;
+}
+
 }  // namespace rcu::impl
 
 USERVER_NAMESPACE_END
@@ -9,14 +9,19 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-template <int VariableCount>
+using EpochTraits = rcu::EpochRcuTraits<std::uint64_t>;
+
+template <int VariableCount,
+          typename RcuTraits = rcu::DefaultRcuTraits<std::uint64_t>>
 void rcu_read(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
+    rcu::Variable<std::uint64_t, RcuTraits> vars[VariableCount];
     {
       std::uint64_t i = 0;
       for (auto& var : vars) {
@@ -36,6 +41,9 @@ void rcu_read(benchmark::State& state) {
 BENCHMARK_TEMPLATE(rcu_read, 1);
 BENCHMARK_TEMPLATE(rcu_read, 2);
 BENCHMARK_TEMPLATE(rcu_read, 4);
+BENCHMARK_TEMPLATE(rcu_read, 1, EpochTraits);
+BENCHMARK_TEMPLATE(rcu_read, 2, EpochTraits);
+BENCHMARK_TEMPLATE(rcu_read, 4, EpochTraits);
 
 template <int VariableCount>
 void rcu_write(benchmark::State& state) {
@@ -53,6 +61,7 @@ BENCHMARK_TEMPLATE(rcu_write, 1);
 BENCHMARK_TEMPLATE(rcu_write, 2);
 BENCHMARK_TEMPLATE(rcu_write, 4);
 
+template <typename RcuTraits = rcu::DefaultRcuTraits<std::uint64_t>>
 void rcu_contention(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
   const std::size_t writers_count = state.range(1);
@@ -63,14 +72,14 @@ void rcu_contention(benchmark::State& state) {
 
   engine::RunStandalone(thread_count, [&] {
     std::atomic<bool> run{true};
-    rcu::Variable<std::uint64_t> var{0};
+    rcu::Variable<std::uint64_t, RcuTraits> var{0};
 
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(readers_count - 1 + writers_count);
 
     for (std::size_t j = 0; j < readers_count - 1; j++) {
       tasks.push_back(utils::Async("reader", [&] {
-        std::vector<rcu::ReadablePtr<std::uint64_t>> pointers;
+        std::vector<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
         pointers.reserve(kept_readable_pointers_count);
 
         while (run) {
@@ -94,7 +103,7 @@ void rcu_contention(benchmark::State& state) {
     }
 
     {
-      std::queue<rcu::ReadablePtr<std::uint64_t>> pointers;
+      std::queue<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
       for (std::size_t i = 0; i < kept_readable_pointers_count; i++) {
         pointers.push(var.Read());
       }
@@ -112,10 +121,13 @@ void rcu_contention(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(rcu_contention)
+BENCHMARK(rcu_contention<>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 16}, {0, 1}, {1, 4}})
     ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
+BENCHMARK_TEMPLATE(rcu_contention, EpochTraits)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 16}, {0, 1}, {1, 4}});
 
 void rcu_of_shared_ptr(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
@@ -150,4 +162,68 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+namespace {
+
+constexpr std::uint64_t kHotKeysCount = 4;
+
+// All the readers access the same few hot keys of the map
+template <typename Map, typename ReadFunc>
+void RunMapReaders(benchmark::State& state, Map& map, ReadFunc read) {
+  const std::size_t readers_count = state.range(0);
+
+  engine::RunStandalone(readers_count, [&] {
+    for (std::uint64_t i = 0; i < 1024; ++i) map.TryEmplace(i, i);
+
+    std::atomic<bool> run{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count - 1);
+
+    for (std::size_t i = 0; i < readers_count - 1; i++) {
+      tasks.push_back(utils::Async("reader", [&] {
+        std::uint64_t key = 0;
+        while (run) read(map, key++ % kHotKeysCount);
+      }));
+    }
+
+    {
+      std::uint64_t key = 0;
+      for (auto _ : state) read(map, key++ % kHotKeysCount);
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+}  // namespace
+
+void rcu_map_get_contention(benchmark::State& state) {
+  rcu::RcuMap<std::uint64_t, std::uint64_t> map;
+  RunMapReaders(state, map, [](auto& map, std::uint64_t key) {
+    auto value = map.Get(key);
+    benchmark::DoNotOptimize(*value);
+  });
+}
+BENCHMARK(rcu_map_get_contention)->RangeMultiplier(2)->Range(1, 32);
+
+void sharded_rcu_map_get_contention(benchmark::State& state) {
+  rcu::ShardedRcuMap<std::uint64_t, std::uint64_t> map;
+  RunMapReaders(state, map, [](auto& map, std::uint64_t key) {
+    auto value = map.Get(key);
+    benchmark::DoNotOptimize(*value);
+  });
+}
+BENCHMARK(sharded_rcu_map_get_contention)->RangeMultiplier(2)->Range(1, 32);
+
+void sharded_rcu_map_borrow_contention(benchmark::State& state) {
+  rcu::ShardedRcuMap<std::uint64_t, std::uint64_t> map;
+  RunMapReaders(state, map, [](auto& map, std::uint64_t key) {
+    auto value = map.Borrow(key);
+    benchmark::DoNotOptimize(*value);
+  });
+}
+BENCHMARK(sharded_rcu_map_borrow_contention)->RangeMultiplier(2)->Range(1, 32);
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <future>
+#include <optional>
 #include <thread>
 
 #include <engine/task/task_context.hpp>
@@ -20,6 +21,11 @@ struct StdMutexRcuTraits {
   using MutexType = std::mutex;
 };
 
+struct StdMutexEpochRcuTraits {
+  using MutexType = std::mutex;
+  static constexpr auto kReclamation = rcu::ReclamationType::kEpoch;
+};
+
 }  // namespace
 
 UTEST(Rcu, Ctr) { rcu::Variable<X> ptr; }
@@ -413,14 +419,13 @@ constexpr std::size_t kSleeperTask = 1;
 constexpr std::size_t kTotalTasks =
     kReadablePtrPingPongTasks + kReadingTasks + kWritingTasks + kSleeperTask;
 
-}  // namespace
-
-UTEST_MT(Rcu, TortureTest, kTotalTasks) {
-  rcu::Variable<CleaningUpInt> data{1};
+template <typename RcuTraits>
+void RunTortureTest() {
+  rcu::Variable<CleaningUpInt, RcuTraits> data{1};
   std::atomic<bool> keep_running{true};
 
   engine::Mutex ping_pong_mutex;
-  rcu::ReadablePtr<CleaningUpInt> ptr = data.Read();
+  rcu::ReadablePtr<CleaningUpInt, RcuTraits> ptr = data.Read();
 
   std::vector<engine::TaskWithResult<void>> tasks;
 
@@ -457,6 +462,16 @@ UTEST_MT(Rcu, TortureTest, kTotalTasks) {
   keep_running = false;
 }
 
+}  // namespace
+
+UTEST_MT(Rcu, TortureTest, kTotalTasks) {
+  RunTortureTest<rcu::DefaultRcuTraits<CleaningUpInt>>();
+}
+
+UTEST_MT(Rcu, EpochTortureTest, kTotalTasks) {
+  RunTortureTest<rcu::EpochRcuTraits<CleaningUpInt>>();
+}
+
 UTEST(Rcu, WritablePtrUnlocksInCommit) {
   rcu::Variable<int> var{1};
 
@@ -624,4 +639,58 @@ TEST(Rcu, StdMutexConcurrentWrites) {
   EXPECT_EQ(std::make_pair(3, 2), *reader);
 }
 
+TEST(Rcu, EpochLifetime) {
+  using Counted = Counted<struct EpochLifetimeTag>;
+
+  rcu::Variable<Counted, StdMutexEpochRcuTraits> ptr;
+  EXPECT_EQ(1, Counted::counter);
+
+  {
+    auto reader = ptr.Read();
+    ptr.Emplace();
+    // the old value is used by the reader
+    EXPECT_EQ(2, Counted::counter);
+
+    auto new_reader = ptr.Read();
+    ptr.Emplace();
+    EXPECT_EQ(3, Counted::counter);
+  }
+
+  ptr.Cleanup();
+  EXPECT_EQ(1, Counted::counter);
+
+  ptr.Emplace();
+  EXPECT_EQ(1, Counted::counter);
+}
+
+TEST(Rcu, EpochCopyReadablePtr) {
+  rcu::Variable<int, StdMutexEpochRcuTraits> ptr{1};
+
+  auto reader = ptr.Read();
+  ptr.Assign(2);
+
+  const auto reader_copy = reader;
+  EXPECT_EQ(1, *reader_copy);
+
+  reader = ptr.Read();
+  EXPECT_EQ(2, *reader);
+  EXPECT_EQ(1, *reader_copy);
+}
+
+TEST(Rcu, EpochReadablePtrFromAnotherThread) {
+  using Counted = Counted<struct EpochThreadTag>;
+
+  rcu::Variable<Counted, StdMutexEpochRcuTraits> ptr;
+  std::optional<rcu::ReadablePtr<Counted, StdMutexEpochRcuTraits>> reader;
+
+  // mimic a coroutine that has migrated to another thread
+  std::async([&] { reader.emplace(ptr.Read()); }).get();
+  ptr.Emplace();
+  EXPECT_EQ(2, Counted::counter);
+
+  reader.reset();
+  ptr.Cleanup();
+  EXPECT_EQ(1, Counted::counter);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,140 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedRcuMap, Empty) {
+  rcu::ShardedRcuMap<std::string, int> map;
+  const auto& cmap = map;
+
+  EXPECT_EQ(map.GetShardsCount(),
+            (rcu::ShardedRcuMap<std::string, int>::kDefaultShardsCount));
+  EXPECT_EQ(map.SizeApprox(), 0);
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(cmap.Get("any"));
+  EXPECT_FALSE(map.Borrow("any"));
+  EXPECT_FALSE(cmap.Borrow("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_TRUE(map.GetSnapshot().empty());
+}
+
+UTEST(ShardedRcuMap, Modify) {
+  rcu::ShardedRcuMap<int, int> map{3};
+  EXPECT_EQ(map.GetShardsCount(), 3);
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(map.Insert(i, std::make_shared<int>(i)).inserted);
+  }
+  EXPECT_FALSE(map.Insert(1, std::make_shared<int>(-1)).inserted);
+  EXPECT_EQ(map.SizeApprox(), 100);
+
+  EXPECT_EQ(*map.Get(1), 1);
+  const auto borrowed = map.Borrow(2);
+  ASSERT_TRUE(borrowed);
+  EXPECT_EQ(*borrowed, 2);
+
+  map.InsertOrAssign(1, std::make_shared<int>(-1));
+  EXPECT_EQ(*map.Get(1), -1);
+
+  const auto res = map.TryEmplace(100, 100);
+  EXPECT_TRUE(res.inserted);
+  EXPECT_EQ(*res.value, 100);
+  EXPECT_FALSE(map.TryEmplace(100, 0).inserted);
+
+  EXPECT_TRUE(map.Erase(1));
+  EXPECT_FALSE(map.Erase(1));
+  EXPECT_FALSE(map.Get(1));
+
+  const auto snapshot = map.GetSnapshot();
+  EXPECT_EQ(snapshot.size(), 100);
+  EXPECT_EQ(snapshot.count(1), 0);
+  EXPECT_EQ(*snapshot.at(100), 100);
+
+  map.Clear();
+  EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST(ShardedRcuMap, BorrowOutlivesErase) {
+  rcu::ShardedRcuMap<std::string, std::string> map;
+  map.InsertOrAssign("key", std::make_shared<std::string>("value"));
+
+  auto borrowed = map.Borrow("key");
+  ASSERT_TRUE(borrowed);
+
+  EXPECT_TRUE(map.Erase("key"));
+  map.InsertOrAssign("key", std::make_shared<std::string>("new"));
+
+  // The borrowed pointer keeps the old snapshot of the shard alive
+  EXPECT_EQ(*borrowed, "value");
+  const auto new_borrowed = map.Borrow("key");
+  EXPECT_EQ(*new_borrowed, "new");
+}
+
+UTEST(ShardedRcuMap, BorrowedValueIsModifiable) {
+  rcu::ShardedRcuMap<int, std::atomic<int>> map;
+  map.TryEmplace(1, 0);
+
+  {
+    auto borrowed = map.Borrow(1);
+    ++*borrowed;
+  }
+  EXPECT_EQ(map.Get(1)->load(), 1);
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentReadersAndWriters, 4) {
+  constexpr int kKeysCount = 64;
+  rcu::ShardedRcuMap<int, int> map{4};
+  for (int i = 0; i < kKeysCount; ++i) map.TryEmplace(i, i);
+
+  std::atomic<bool> stop_flag{false};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(utils::Async("reader", [&map, &stop_flag] {
+      while (!stop_flag) {
+        for (int key = 0; key < kKeysCount; ++key) {
+          auto borrowed = map.Borrow(key);
+          ASSERT_TRUE(borrowed);
+          ASSERT_EQ(*borrowed % kKeysCount, key);
+        }
+      }
+    }));
+  }
+
+  for (int value = kKeysCount; value < kKeysCount * 100; ++value) {
+    map.InsertOrAssign(value % kKeysCount, std::make_shared<int>(value));
+    engine::Yield();
+  }
+  stop_flag = true;
+  for (auto& task : tasks) task.Get();
+}
+
+UTEST(ShardedRcuMap, SampleShardedRcuMap) {
+  /// [Sample rcu::ShardedRcuMap usage]
+  struct Data {
+    // Access to ShardedRcuMap content must be synchronized via std::atomic
+    // or other synchronization primitives
+    std::atomic<int> hits{0};
+  };
+  rcu::ShardedRcuMap<std::string, Data> map{/*shards_count=*/16};
+  map.TryEmplace("hot-key");
+
+  // Borrow() does not touch the reference counter of the value, it is the
+  // fastest way to access a value for a short time
+  if (auto data = map.Borrow("hot-key")) {
+    data->hits++;
+  }
+
+  // Get() shares the ownership of the value, the result may be stored
+  std::shared_ptr<Data> data = map.Get("hot-key");
+  ASSERT_EQ(data->hits.load(), 1);
+  /// [Sample rcu::ShardedRcuMap usage]
+}
+
+USERVER_NAMESPACE_END
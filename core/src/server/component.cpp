@@ -135,15 +135,35 @@ properties:
                         defaultDescription: 32 * 1024
                     requests_queue_size_threshold:
                         type: integer
-                        description: drop requests from handlers that allow trottling if there's more pending requests than allowed by this value
+                        description: drop requests from handlers that allow trottling if there's more pending requests than allowed by this value; also the max count of pipelined requests of a connection that are handled concurrently, their responses are sent in the order of the requests
                         defaultDescription: 100
                     keepalive_timeout:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    http2_enabled:
+                        type: boolean
+                        description: accept HTTP/2 connections with prior knowledge (h2c) along with the HTTP/1.x ones
+                        defaultDescription: false
+                    http2_max_concurrent_streams:
+                        type: integer
+                        description: max count of concurrent streams of a single HTTP/2 connection
+                        defaultDescription: 100
+                    request_parser:
+                        type: string
+                        description: HTTP/1.x request parser, 'http-parser' for the http_parser library or 'simd' for the parser that scans the request head with SSE2/AVX2/NEON
+                        defaultDescription: http-parser
+                        enum:
+                          - http-parser
+                          - simd
             shards:
                 type: integer
-                description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+                description: how many SO_REUSEPORT sockets with their own accept tasks to open for the port, the kernel balances new connections between them; do not set if not sure what it is doing
+                defaultDescription: <count of the event threads of the task processor>
+            incoming_cpu_affinity:
+                type: boolean
+                description: set SO_INCOMING_CPU of the socket with index `i` to CPU `i % <CPU count>`, so the connections processed by that CPU in the kernel go to that socket; useful with shards equal to the CPU count and RX queues bound to CPUs
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -38,15 +38,27 @@ Sensor::Data Sensor::FetchCurrent() {
                   server_stats.requests_processed_count.load();
   auto rps = (requests - last_requests_) * kSecond / duration_ms;
 
+  using QueueWaitHistogram = engine::impl::TaskCounter::QueueWaitHistogram;
+  auto queue_wait_counts =
+      tp_.GetTaskCounter().GetQueueWaitHistogram().LoadCounts();
+  auto recent_queue_wait_counts = queue_wait_counts;
+  for (std::size_t i = 0; i < recent_queue_wait_counts.size(); ++i) {
+    recent_queue_wait_counts[i] -= last_queue_wait_counts_[i];
+  }
+  const std::chrono::microseconds queue_wait_p99{
+      QueueWaitHistogram::GetPercentileOf(recent_queue_wait_counts, 99)};
+
   last_fetch_tp_ = now;
   last_overloads_ = overloads;
   last_no_overloads_ = no_overloads;
   last_requests_ = requests;
+  last_queue_wait_counts_ = queue_wait_counts;
 
   return Data{
       first_fetch ? 0 : rps,
       first_fetch ? 0 : overloads_ps,
       first_fetch ? 0 : no_overloads_ps,
+      first_fetch ? std::chrono::microseconds{0} : queue_wait_p99,
       now,
   };
 }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include <engine/task/task_counter.hpp>
 #include <userver/congestion_control/sensor.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/server/server.hpp>
@@ -25,6 +26,8 @@ class Sensor final : public USERVER_NAMESPACE::congestion_control::Sensor {
   std::uint64_t last_overloads_{0};
   std::uint64_t last_no_overloads_{0};
   std::uint64_t last_requests_{0};
+  engine::impl::TaskCounter::QueueWaitHistogram::Counts
+      last_queue_wait_counts_{};
 };
 
 }  // namespace server::congestion_control
@@ -0,0 +1,107 @@
+#include <server/congestion_control/tenants_limiter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::congestion_control {
+
+namespace {
+
+constexpr TenantsLimiter::TenantId kDefaultTenant = 0;
+
+}  // namespace
+
+TenantsLimiter::TenantsLimiter(
+    USERVER_NAMESPACE::congestion_control::TenantsConfig config)
+    : client_header_(std::move(config.client_header)) {
+  tenants_.push_back({"default", config.default_weight, false});
+  for (auto& tenant : config.tenants) {
+    const TenantId id = tenants_.size();
+    for (auto& client : tenant.clients) {
+      if (!by_client_.emplace(std::move(client), id).second) {
+        throw std::runtime_error(fmt::format(
+            "Client is listed in several congestion control tenants, "
+            "including '{}'",
+            tenant.name));
+      }
+    }
+    for (auto& handler : tenant.handlers) {
+      if (!by_handler_.emplace(std::move(handler), id).second) {
+        throw std::runtime_error(fmt::format(
+            "Handler is listed in several congestion control tenants, "
+            "including '{}'",
+            tenant.name));
+      }
+    }
+    tenants_.push_back(
+        {std::move(tenant.name), tenant.weight, tenant.is_low_priority});
+  }
+
+  for (TenantId id = 0; id < tenants_.size(); ++id) {
+    buckets_.push_back(utils::TokenBucket::MakeUnbounded());
+    borrow_order_.push_back(id);
+    total_weight_ += tenants_[id].weight;
+  }
+  std::stable_partition(
+      borrow_order_.begin(), borrow_order_.end(),
+      [this](TenantId id) { return tenants_[id].is_low_priority; });
+}
+
+TenantsLimiter::TenantId TenantsLimiter::FindTenant(
+    std::string_view client, std::string_view handler_name) const {
+  if (!client.empty()) {
+    const auto it = by_client_.find(std::string{client});
+    if (it != by_client_.end()) return it->second;
+  }
+  const auto it = by_handler_.find(std::string{handler_name});
+  if (it != by_handler_.end()) return it->second;
+  return kDefaultTenant;
+}
+
+const std::string& TenantsLimiter::GetTenantName(TenantId tenant) const {
+  UASSERT(tenant < tenants_.size());
+  return tenants_[tenant].name;
+}
+
+void TenantsLimiter::SetRpsRatelimit(std::optional<std::size_t> rps) {
+  for (TenantId id = 0; id < tenants_.size(); ++id) {
+    auto& bucket = buckets_[id];
+    if (!rps) {
+      bucket.SetMaxSize(1);  // in case it was zero
+      bucket.SetInstantRefillPolicy();
+      continue;
+    }
+
+    const auto share = static_cast<std::size_t>(
+        static_cast<double>(*rps) * tenants_[id].weight / total_weight_);
+    if (share > 0) {
+      bucket.SetMaxSize(share);
+      bucket.SetRefillPolicy(
+          {1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / share});
+    } else {
+      bucket.SetMaxSize(0);
+    }
+  }
+}
+
+bool TenantsLimiter::Obtain(TenantId tenant) {
+  UASSERT(tenant < tenants_.size());
+  if (buckets_[tenant].Obtain()) return true;
+  if (tenants_[tenant].is_low_priority) return false;
+
+  for (const auto id : borrow_order_) {
+    if (id != tenant && buckets_[id].Obtain()) return true;
+  }
+  return false;
+}
+
+}  // namespace server::congestion_control
+
+USERVER_NAMESPACE_END
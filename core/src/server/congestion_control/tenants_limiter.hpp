@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/congestion_control/config.hpp>
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::congestion_control {
+
+/// @brief Splits the RPS limit between the tenants by their weights
+///
+/// Each tenant obtains the tokens from its own bucket first. Tenants that are
+/// not low priority may then use the tokens left unused by the others, low
+/// priority tenants are drained first. So when the limit is reached, low
+/// priority tenants are throttled before the rest.
+class TenantsLimiter final {
+ public:
+  using TenantId = std::size_t;
+
+  explicit TenantsLimiter(USERVER_NAMESPACE::congestion_control::TenantsConfig
+                              config);
+
+  const std::string& GetClientHeader() const { return client_header_; }
+
+  /// Finds the tenant by the client first, by the handler name then
+  TenantId FindTenant(std::string_view client,
+                      std::string_view handler_name) const;
+
+  const std::string& GetTenantName(TenantId tenant) const;
+
+  /// @note Not thread-safe against itself, as TokenBucket setters are
+  void SetRpsRatelimit(std::optional<std::size_t> rps);
+
+  bool Obtain(TenantId tenant);
+
+ private:
+  struct TenantInfo {
+    std::string name;
+    double weight;
+    bool is_low_priority;
+  };
+
+  const std::string client_header_;
+  std::vector<TenantInfo> tenants_;
+  std::vector<utils::TokenBucket> buckets_;
+  // low priority tenants go first
+  std::vector<TenantId> borrow_order_;
+  double total_weight_{0};
+
+  std::unordered_map<std::string, TenantId> by_client_;
+  std::unordered_map<std::string, TenantId> by_handler_;
+};
+
+}  // namespace server::congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <server/congestion_control/tenants_limiter.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::congestion_control::TenantsLimiter;
+
+congestion_control::TenantsConfig MakeConfig() {
+  congestion_control::TenantsConfig config;
+  config.tenants.push_back({"batch", {"batch-service"}, {}, 1, true});
+  config.tenants.push_back({"admin", {}, {"handler-admin"}, 2, false});
+  return config;
+}
+
+std::size_t ObtainAll(TenantsLimiter& limiter,
+                      TenantsLimiter::TenantId tenant) {
+  std::size_t obtained = 0;
+  while (obtained < 1000 && limiter.Obtain(tenant)) ++obtained;
+  return obtained;
+}
+
+}  // namespace
+
+TEST(TenantsLimiter, FindTenant) {
+  const TenantsLimiter limiter{MakeConfig()};
+
+  const auto batch = limiter.FindTenant("batch-service", "handler-admin");
+  EXPECT_EQ(limiter.GetTenantName(batch), "batch");
+  const auto admin = limiter.FindTenant("other-service", "handler-admin");
+  EXPECT_EQ(limiter.GetTenantName(admin), "admin");
+  const auto other = limiter.FindTenant("", "handler-other");
+  EXPECT_EQ(limiter.GetTenantName(other), "default");
+}
+
+TEST(TenantsLimiter, Unbounded) {
+  TenantsLimiter limiter{MakeConfig()};
+  const auto batch = limiter.FindTenant("batch-service", {});
+
+  EXPECT_EQ(ObtainAll(limiter, batch), 1000);
+  limiter.SetRpsRatelimit(4);
+  limiter.SetRpsRatelimit(std::nullopt);
+  EXPECT_EQ(ObtainAll(limiter, batch), 1000);
+}
+
+TEST(TenantsLimiter, LowPriorityIsThrottledFirst) {
+  TenantsLimiter limiter{MakeConfig()};
+  const auto batch = limiter.FindTenant("batch-service", {});
+  const auto other = limiter.FindTenant({}, {});
+
+  // weights are 1 for default, 1 for batch and 2 for admin
+  limiter.SetRpsRatelimit(400);
+
+  // the default tenant takes the unused shares of the others
+  EXPECT_GE(ObtainAll(limiter, other), 400);
+  EXPECT_LE(ObtainAll(limiter, batch), 1);
+}
+
+TEST(TenantsLimiter, LowPriorityDoesNotBorrow) {
+  TenantsLimiter limiter{MakeConfig()};
+  const auto batch = limiter.FindTenant("batch-service", {});
+  const auto admin = limiter.FindTenant({}, "handler-admin");
+
+  limiter.SetRpsRatelimit(400);
+
+  const auto batch_obtained = ObtainAll(limiter, batch);
+  EXPECT_GE(batch_obtained, 100);
+  EXPECT_LE(batch_obtained, 101);
+  EXPECT_GE(ObtainAll(limiter, admin), 300);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,111 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <chrono>
+#include <optional>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <utils/cpu_profiler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::size_t kDefaultSeconds = 10;
+constexpr std::size_t kMaxSeconds = 60;
+constexpr std::size_t kDefaultFrequency = 100;
+constexpr std::size_t kMaxFrequency = 1000;
+
+// Returns std::nullopt and fills the error on invalid arguments
+std::optional<std::size_t> ParseArg(const http::HttpRequest& request,
+                                    const std::string& name,
+                                    std::size_t default_value,
+                                    std::size_t max_value,
+                                    std::string& error) {
+  if (!request.HasArg(name)) return default_value;
+
+  std::size_t value = 0;
+  try {
+    value = utils::FromString<std::size_t>(request.GetArg(name));
+  } catch (const std::exception& ex) {
+    error = "invalid '" + name + "' value: " + ex.what();
+    return std::nullopt;
+  }
+  if (value == 0 || value > max_value) {
+    error = "'" + name + "' must be in [1, " + std::to_string(max_value) + "]";
+    return std::nullopt;
+  }
+  return value;
+}
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config,
+                         const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      max_samples_(config["max-samples"].As<std::size_t>(20'000)) {
+  profiler_statistics_holder_ =
+      component_context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("cpu-profiler",
+                          [](utils::statistics::Writer& writer) {
+                            writer = utils::cpu_profiler::GetStatistics();
+                          });
+}
+
+CpuProfiler::~CpuProfiler() { profiler_statistics_holder_.Unregister(); }
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  std::string error;
+  const auto seconds =
+      ParseArg(request, "seconds", kDefaultSeconds, kMaxSeconds, error);
+  const auto frequency =
+      seconds ? ParseArg(request, "frequency", kDefaultFrequency,
+                         kMaxFrequency, error)
+              : std::nullopt;
+  if (!seconds || !frequency) {
+    request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+    return error;
+  }
+
+  utils::cpu_profiler::SessionConfig session_config;
+  session_config.duration = std::chrono::seconds{*seconds};
+  session_config.frequency = *frequency;
+  session_config.max_samples = max_samples_;
+
+  try {
+    LOG_INFO() << "Starting CPU profiling for " << *seconds << "s";
+    return utils::cpu_profiler::Profile(session_config);
+  } catch (const utils::cpu_profiler::SessionIsRunningError& ex) {
+    request.SetResponseStatus(server::http::HttpStatus::kConflict);
+    return ex.what();
+  }
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-cpu-profiler config
+additionalProperties: false
+properties:
+    max-samples:
+        type: integer
+        description: |
+            the samples above this limit are dropped, each sample takes
+            about 450 bytes of memory during the session
+        defaultDescription: 20000
+        minimum: 1
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
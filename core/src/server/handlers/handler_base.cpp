@@ -107,6 +107,84 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    response-body-stream-buffer-size:
+        type: integer
+        description: max size in bytes of the streamed response body that is buffered while the client receives it, server::http::ResponseBodyStream::PushBodyChunk() waits for the buffer to free up
+        defaultDescription: unlimited
+        minimum: 1
+    request-body-stream:
+        type: boolean
+        description: pass the request to the handler as soon as its headers are received, the handler reads the body via server::http::HttpRequest::GetBodyStream()
+        defaultDescription: false
+    compression:
+        type: object
+        description: gzip compression of the responses for the clients that accept it, disabled if not set
+        additionalProperties: false
+        properties:
+            min-size:
+                type: integer
+                description: buffered responses with smaller bodies are sent uncompressed, streamed responses are always compressed
+                defaultDescription: 1024
+                minimum: 0
+            level:
+                type: integer
+                description: compression level from 1 (fastest) to 9 (best)
+                defaultDescription: 6
+                minimum: 1
+                maximum: 9
+            content-types:
+                type: array
+                description: content types of the responses to compress, any content type if empty
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: content type without parameters, e.g. 'application/json'
+    response-cache:
+        type: object
+        description: cache of the serialized responses to the GET requests, disabled if not set
+        additionalProperties: false
+        properties:
+            ttl:
+                type: string
+                description: for how long a cached response is served, e.g. '1s' or '500ms'
+                defaultDescription: 1s
+            size:
+                type: integer
+                description: max count of the cached responses
+                defaultDescription: 1000
+                minimum: 1
+            ways:
+                type: integer
+                description: count of the independently locked parts of the cache
+                defaultDescription: 16
+                minimum: 1
+            args:
+                type: array
+                description: request args that select the response, other args are ignored
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: arg name
+            headers:
+                type: array
+                description: request headers that select the response, other headers are ignored
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: header name
+    queue-time-limit:
+        type: object
+        description: rejects the requests that waited for too long before the handling, disabled if not set
+        additionalProperties: false
+        properties:
+            target:
+                type: string
+                description: acceptable queue time of the requests under sustained overload, e.g. '5ms'
+                defaultDescription: 5ms
+            interval:
+                type: string
+                description: requests queued for longer are always rejected, the overload is detected over such intervals
+                defaultDescription: 100ms
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -132,6 +210,14 @@ properties:
             Deadline propagation is disabled if disabled statically OR
             dynamically.
         defaultDescription: true
+    cancel_by_deadline:
+        type: boolean
+        description: |
+            Whether to cancel the request task once the deadline received from
+            the client is reached, overrides the
+            USERVER_CANCEL_HANDLE_REQUEST_BY_DEADLINE dynamic config for this
+            handler.
+        defaultDescription: the value of USERVER_CANCEL_HANDLE_REQUEST_BY_DEADLINE
 )");
 }
 
@@ -29,6 +29,60 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml,
   return FallbackHandlerFromString(value);
 }
 
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<ResponseCompressionConfig>) {
+  ResponseCompressionConfig config;
+  config.min_size = value["min-size"].As<size_t>(config.min_size);
+  config.level = value["level"].As<int>(config.level);
+  config.content_types =
+      value["content-types"].As<std::vector<std::string>>({});
+
+  if (config.level < 1 || config.level > 9) {
+    throw std::runtime_error(
+        "compression level should be in [1, 9], current value is " +
+        std::to_string(config.level));
+  }
+  return config;
+}
+
+ResponseCacheConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<ResponseCacheConfig>) {
+  ResponseCacheConfig config;
+  config.ttl = value["ttl"].As<std::chrono::milliseconds>(config.ttl);
+  config.size = value["size"].As<size_t>(config.size);
+  config.ways = value["ways"].As<size_t>(config.ways);
+  config.args = value["args"].As<std::vector<std::string>>({});
+  config.headers = value["headers"].As<std::vector<std::string>>({});
+
+  if (config.ttl <= std::chrono::milliseconds::zero()) {
+    throw std::runtime_error("response cache ttl should be positive");
+  }
+  if (config.ways == 0 || config.size < config.ways) {
+    throw std::runtime_error(fmt::format(
+        "response cache size should be at least the count of ways, "
+        "current values are size={} ways={}",
+        config.size, config.ways));
+  }
+  return config;
+}
+
+QueueTimeLimitConfig Parse(const yaml_config::YamlConfig& value,
+                           formats::parse::To<QueueTimeLimitConfig>) {
+  QueueTimeLimitConfig config;
+  config.target = value["target"].As<std::chrono::milliseconds>(config.target);
+  config.interval =
+      value["interval"].As<std::chrono::milliseconds>(config.interval);
+
+  if (config.target <= std::chrono::milliseconds::zero() ||
+      config.interval < config.target) {
+    throw std::runtime_error(fmt::format(
+        "queue time limit target should be positive and not greater than "
+        "the interval, current values are target={}ms interval={}ms",
+        config.target.count(), config.interval.count()));
+  }
+  return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config, bool is_monitor) {
@@ -86,6 +140,15 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.response_body_stream_buffer_size =
+      value["response-body-stream-buffer-size"].As<std::optional<size_t>>();
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
+  config.response_compression =
+      value["compression"].As<std::optional<ResponseCompressionConfig>>();
+  config.response_cache =
+      value["response-cache"].As<std::optional<ResponseCacheConfig>>();
+  config.queue_time_limit =
+      value["queue-time-limit"].As<std::optional<QueueTimeLimitConfig>>();
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
@@ -100,6 +163,8 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
   config.deadline_propagation_enabled =
       value["deadline_propagation_enabled"].As<bool>(
           handler_defaults.deadline_propagation_enabled);
+  config.cancel_by_deadline =
+      value["cancel_by_deadline"].As<std::optional<bool>>();
 
   return config;
 }
@@ -6,7 +6,10 @@
 #include <compression/gzip.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
+#include <server/handlers/queue_time_limiter.hpp>
 #include <server/http/http_request_impl.hpp>
+#include <server/handlers/response_cache.hpp>
+#include <server/http/response_compression.hpp>
 #include <server/server_config.hpp>
 #include <userver/baggage/baggage.hpp>
 #include <userver/baggage/baggage_settings.hpp>
@@ -373,7 +376,10 @@ void SetUpInheritedDeadline(RequestProcessor& processor,
     return;
   }
 
-  if (processor.GetInitialDynamicConfig()[kCancelHandleRequestByDeadline]) {
+  const auto cancel_by_deadline =
+      processor.GetHandler().GetConfig().cancel_by_deadline.value_or(
+          processor.GetInitialDynamicConfig()[kCancelHandleRequestByDeadline]);
+  if (cancel_by_deadline) {
     engine::current_task::SetDeadline(deadline);
   }
 }
@@ -434,6 +440,29 @@ void CompleteDeadlinePropagation(RequestProcessor& processor,
   }
 }
 
+bool IsGzipAccepted(const http::HttpRequest& http_request) {
+  return http::IsGzipAccepted(http_request.GetHeader(
+      USERVER_NAMESPACE::http::headers::kAcceptEncoding));
+}
+
+void CompressResponseBody(const http::HttpRequest& http_request,
+                          http::HttpResponse& response,
+                          const ResponseCompressionConfig& config) {
+  const auto& data = response.GetData();
+  if (data.empty() || data.size() < config.min_size ||
+      !http::IsCompressible(response, config) ||
+      !IsGzipAccepted(http_request)) {
+    return;
+  }
+
+  auto compressed = compression::gzip::Compress(data, config.level);
+  // Incompressible data, e.g. an image, is not worth the decompression
+  if (compressed.size() >= data.size()) return;
+
+  response.SetData(std::move(compressed));
+  http::SetGzipContentEncoding(response);
+}
+
 std::string CutTrailingSlash(
     std::string&& meta_type,
     server::handlers::UrlTrailingSlashOption trailing_slash) {
@@ -505,6 +534,15 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       log_level_(config["log-level"].As<std::optional<logging::Level>>()),
       rate_limit_(utils::TokenBucket::MakeUnbounded()),
       is_body_streamed_(config["response-body-stream"].As<bool>(false)) {
+  if (GetConfig().response_cache) {
+    response_cache_ =
+        std::make_unique<ResponseCache>(*GetConfig().response_cache);
+  }
+  if (GetConfig().queue_time_limit) {
+    queue_time_limiter_ =
+        std::make_unique<QueueTimeLimiter>(*GetConfig().queue_time_limit);
+  }
+
   if (allowed_methods_.empty()) {
     LOG_WARNING() << "empty allowed methods list in " << config.Name();
   }
@@ -564,7 +602,12 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
               .set_response_server_hostname);
 }
 
-HttpHandlerBase::~HttpHandlerBase() { statistics_holder_.Unregister(); }
+HttpHandlerBase::~HttpHandlerBase() {
+  for (auto& subscription : response_cache_subscriptions_) {
+    subscription.Unsubscribe();
+  }
+  statistics_holder_.Unregister();
+}
 
 void HttpHandlerBase::HandleRequestStream(
     const http::HttpRequest& http_request,
@@ -575,6 +618,10 @@ void HttpHandlerBase::HandleRequestStream(
   auto& http_response = http_request.GetHttpResponse();
   server::http::ResponseBodyStream response_body_stream{
       response.GetBodyProducer(), http_response};
+  const auto& compression_config = GetConfig().response_compression;
+  if (compression_config && IsGzipAccepted(http_request)) {
+    response_body_stream.EnableCompression(*compression_config);
+  }
 
   // Just in case HandleStreamRequest() throws an exception.
   // Though it can be changed in HandleStreamRequest().
@@ -614,6 +661,8 @@ void HttpHandlerBase::HandleRequestStream(
                                 }));
     }
   }
+
+  response_body_stream.Finish(engine::Deadline());
 }
 
 void HttpHandlerBase::HandleRequest(request::RequestBase& request,
@@ -624,6 +673,8 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
   http::HttpRequest http_request(http_request_impl);
   auto& response = http_request.GetHttpResponse();
   std::optional<tracing::Span> span_storage;
+  std::optional<ResponseCache::Key> response_cache_key;
+  bool is_response_cached = false;
 
   try {
     HttpHandlerStatisticsScope stats_scope(*handler_statistics_,
@@ -656,7 +707,7 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
                     request_processor.GetInitialDynamicConfig());
         });
 
-    if (GetConfig().decompress_request) {
+    if (GetConfig().decompress_request && !http_request.IsBodyStreamed()) {
       request_processor.ProcessRequestStep(
           "decompress_request_body",
           [this, &http_request] { DecompressRequestBody(http_request); });
@@ -684,12 +735,31 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     }
 
     request_processor.ProcessRequestStep(
-        "handle_request", [this, &response, &http_request, &context] {
+        "handle_request", [&, this] {
           if (response.IsBodyStreamed()) {
             HandleRequestStream(http_request, context);
-          } else {
-            // !IsBodyStreamed()
-            response.SetData(HandleRequestThrow(http_request, context));
+            return;
+          }
+
+          // !IsBodyStreamed()
+          if (response_cache_) {
+            response_cache_key = response_cache_->MakeKey(
+                http_request, GetConfig().response_compression &&
+                                  IsGzipAccepted(http_request));
+            if (response_cache_key &&
+                response_cache_->Respond(*response_cache_key, http_request)) {
+              is_response_cached = true;
+              return;
+            }
+          }
+
+          auto data = HandleRequestThrow(http_request, context);
+          // An empty result keeps the body set by SetSharedData()
+          if (!data.empty() || !response.HasSharedData()) {
+            response.SetData(std::move(data));
+          }
+          if (response_cache_key) {
+            ResponseCache::OnHandled(*response_cache_key, response);
           }
         });
 
@@ -704,6 +774,22 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     LOG_ERROR() << "unable to handle request: " << ex;
   }
 
+  if (GetConfig().response_compression && !response.IsBodyStreamed() &&
+      !is_response_cached) {
+    try {
+      CompressResponseBody(http_request, response,
+                           *GetConfig().response_compression);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "unable to compress response: " << ex;
+    }
+  }
+  if (response_cache_key && !is_response_cached) {
+    try {
+      response_cache_->Store(*response_cache_key, http_request);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "unable to cache response: " << ex;
+    }
+  }
   SetResponseAcceptEncoding(response);
   SetResponseServerHostname(response);
   response.SetHeadersEnd();
@@ -750,6 +836,10 @@ void HttpHandlerBase::ReportMalformedRequest(
   }
 }
 
+void HttpHandlerBase::InvalidateResponseCache() const {
+  if (response_cache_) response_cache_->Invalidate();
+}
+
 const std::string& HttpHandlerBase::HandlerName() const {
   return handler_name_;
 }
@@ -834,6 +924,27 @@ void HttpHandlerBase::CheckRatelimit(
     throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
   }
 
+  if (queue_time_limiter_) {
+    const auto now = std::chrono::steady_clock::now();
+    const auto queue_time = now - http_request.GetStartTime();
+    if (queue_time_limiter_->ShouldReject(queue_time, now)) {
+      auto& http_response = http_request.GetHttpResponse();
+      auto log_reason = fmt::format(
+          "queued for {}ms{}",
+          std::chrono::duration_cast<std::chrono::milliseconds>(queue_time)
+              .count(),
+          queue_time_limiter_->IsOverloaded() ? " under overload" : "");
+      SetThrottleReason(
+          http_response, std::move(log_reason),
+          std::string{
+              USERVER_NAMESPACE::http::headers::ratelimit_reason::kQueueTime});
+      statistics.IncrementQueueTimeLimitReached();
+      total_statistics.IncrementQueueTimeLimitReached();
+
+      throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
+    }
+  }
+
   auto max_requests_in_flight = GetConfig().max_requests_in_flight;
   auto requests_in_flight = statistics.GetInFlight();
   if (max_requests_in_flight &&
@@ -11,6 +11,7 @@
 #include <userver/utils/statistics/aggregated_values.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -55,12 +56,20 @@ class HttpHandlerMethodStatistics final {
 
   size_t GetRateLimitReached() const noexcept { return rate_limit_reached_; }
 
+  void IncrementQueueTimeLimitReached() noexcept {
+    queue_time_limit_reached_++;
+  }
+
+  std::uint64_t GetQueueTimeLimitReached() const noexcept {
+    return queue_time_limit_reached_;
+  }
+
   std::uint64_t GetDeadlineReceived() const noexcept {
-    return deadline_received_.load();
+    return deadline_received_.Load();
   }
 
   std::uint64_t GetCancelledByDeadline() const noexcept {
-    return cancelled_by_deadline_.load();
+    return cancelled_by_deadline_.Load();
   }
 
  private:
@@ -70,11 +79,13 @@ class HttpHandlerMethodStatistics final {
 
   RecentPeriod timings_;
   utils::statistics::HttpCodes reply_codes_;
-  std::atomic<std::size_t> in_flight_{0};
-  std::atomic<std::uint64_t> too_many_requests_in_flight_{0};
-  std::atomic<std::uint64_t> rate_limit_reached_{0};
-  std::atomic<std::uint64_t> deadline_received_{0};
-  std::atomic<std::uint64_t> cancelled_by_deadline_{0};
+  // Updated by each request of the handler from all the threads
+  utils::statistics::ShardedCounter<std::size_t> in_flight_;
+  utils::statistics::ShardedCounter<std::uint64_t> too_many_requests_in_flight_;
+  utils::statistics::ShardedCounter<std::uint64_t> rate_limit_reached_;
+  utils::statistics::ShardedCounter<std::uint64_t> queue_time_limit_reached_;
+  utils::statistics::ShardedCounter<std::uint64_t> deadline_received_;
+  utils::statistics::ShardedCounter<std::uint64_t> cancelled_by_deadline_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -93,6 +104,7 @@ struct HttpHandlerStatisticsSnapshot final {
   std::size_t in_flight{0};
   std::uint64_t too_many_requests_in_flight{0};
   std::uint64_t rate_limit_reached{0};
+  std::uint64_t queue_time_limit_reached{0};
   std::uint64_t deadline_received{0};
   std::uint64_t cancelled_by_deadline{0};
 };
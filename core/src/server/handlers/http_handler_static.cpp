@@ -1,9 +1,19 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <algorithm>
+#include <charconv>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,6 +28,57 @@ auto ParseContentTypeMap(const dynamic_config::DocsMap& docs_map) {
 }
 constexpr dynamic_config::Key<ParseContentTypeMap> kContentTypeMap{};
 
+struct ByteRangeSpec {
+  std::optional<std::size_t> first;
+  // The suffix length if `first` is not set
+  std::optional<std::size_t> last;
+};
+
+std::optional<std::size_t> ParseRangeBound(std::string_view value) {
+  if (value.empty()) return std::nullopt;
+  std::size_t result = 0;
+  const auto* end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, result);
+  if (ec != std::errc{} || ptr != end) return std::nullopt;
+  return result;
+}
+
+// Returns std::nullopt for the Range headers that should be ignored: the
+// malformed ones and the ones with multiple ranges, RFC 7233 section 3.1
+std::optional<ByteRangeSpec> ParseRange(std::string_view value) {
+  constexpr std::string_view kBytesUnit = "bytes=";
+  if (value.substr(0, kBytesUnit.size()) != kBytesUnit) return std::nullopt;
+  value.remove_prefix(kBytesUnit.size());
+  if (value.find(',') != std::string_view::npos) return std::nullopt;
+
+  const auto dash_pos = value.find('-');
+  if (dash_pos == std::string_view::npos) return std::nullopt;
+  const auto first_str = value.substr(0, dash_pos);
+  const auto last_str = value.substr(dash_pos + 1);
+
+  ByteRangeSpec spec{ParseRangeBound(first_str), ParseRangeBound(last_str)};
+  if (spec.first.has_value() != !first_str.empty()) return std::nullopt;
+  if (spec.last.has_value() != !last_str.empty()) return std::nullopt;
+  if (!spec.first && !spec.last) return std::nullopt;
+  if (spec.first && spec.last && *spec.last < *spec.first) return std::nullopt;
+  return spec;
+}
+
+// Returns the first and the last bytes of the range, std::nullopt if the
+// range is not satisfiable
+std::optional<std::pair<std::size_t, std::size_t>> ResolveRange(
+    const ByteRangeSpec& spec, std::size_t size) {
+  if (size == 0) return std::nullopt;
+  if (spec.first) {
+    if (*spec.first >= size) return std::nullopt;
+    return std::pair{*spec.first, std::min(spec.last.value_or(size), size - 1)};
+  }
+
+  const auto suffix_length = std::min(*spec.last, size);
+  if (suffix_length == 0) return std::nullopt;
+  return std::pair{size - suffix_length, size - 1};
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -35,14 +96,45 @@ std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
   const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
-    const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+  if (!file) {
+    request.GetResponse().SetStatusNotFound();
+    return "File not found";
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+
+  auto& response = request.GetHttpResponse();
+  const auto config = config_.GetSnapshot();
+  response.SetContentType(config[kContentTypeMap][file->extension]);
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptRanges,
+                     "bytes");
+
+  // No validators are sent, so an If-Range never matches
+  const auto& range_header =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kRange);
+  const auto range_spec =
+      request.HasHeader(USERVER_NAMESPACE::http::headers::kIfRange)
+          ? std::nullopt
+          : ParseRange(range_header);
+  if (range_spec) {
+    const auto size = file->data.size();
+    const auto range = ResolveRange(*range_spec, size);
+    if (!range) {
+      response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+      response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                         fmt::format("bytes */{}", size));
+      return {};
+    }
+
+    const auto [first, last] = *range;
+    response.SetStatus(http::HttpStatus::kPartialContent);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                       fmt::format("bytes {}-{}/{}", first, last, size));
+    return file->data.substr(first, last - first + 1);
+  }
+
+  // The whole file is sent right from the cache, without copying it
+  response.SetSharedData(
+      std::shared_ptr<const std::string>{file, &file->data});
+  return {};
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
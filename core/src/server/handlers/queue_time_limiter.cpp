@@ -0,0 +1,40 @@
+#include <server/handlers/queue_time_limiter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+QueueTimeLimiter::QueueTimeLimiter(const QueueTimeLimitConfig& config)
+    : target_(config.target),
+      interval_(config.interval),
+      interval_end_((Clock::now() + interval_).time_since_epoch().count()),
+      min_queue_time_(Clock::duration::max().count()) {}
+
+bool QueueTimeLimiter::ShouldReject(Clock::duration queue_time,
+                                    Clock::time_point now) noexcept {
+  const auto queue_time_rep = queue_time.count();
+  const auto now_rep = now.time_since_epoch().count();
+
+  auto interval_end = interval_end_.load();
+  if (now_rep >= interval_end &&
+      interval_end_.compare_exchange_strong(
+          interval_end, (now + interval_).time_since_epoch().count())) {
+    // The interval is over, the winner of the race starts the next one
+    const auto min_queue_time = min_queue_time_.exchange(queue_time_rep);
+    is_overloaded_ = min_queue_time != Clock::duration::max().count() &&
+                     min_queue_time > target_.count();
+  } else {
+    auto min_queue_time = min_queue_time_.load();
+    while (queue_time_rep < min_queue_time &&
+           !min_queue_time_.compare_exchange_weak(min_queue_time,
+                                                  queue_time_rep)) {
+    }
+  }
+
+  const auto limit = is_overloaded_.load() ? target_ : interval_;
+  return queue_time > limit;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
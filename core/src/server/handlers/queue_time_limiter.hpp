@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/server/handlers/handler_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// @brief Rejects the requests that waited in queue for too long, see the
+/// `queue-time-limit` static option.
+///
+/// CoDel-style: if the minimal queue time over an interval exceeds the
+/// target, the overload is sustained and the requests queued for longer than
+/// the target are rejected. Otherwise only the requests queued for longer
+/// than the whole interval are rejected, which absorbs the bursts.
+///
+/// Thread-safe, lock-free.
+class QueueTimeLimiter final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit QueueTimeLimiter(const QueueTimeLimitConfig& config);
+
+  /// @returns whether a request queued for `queue_time` should be rejected
+  bool ShouldReject(Clock::duration queue_time,
+                    Clock::time_point now = Clock::now()) noexcept;
+
+  bool IsOverloaded() const noexcept { return is_overloaded_.load(); }
+
+ private:
+  const Clock::duration target_;
+  const Clock::duration interval_;
+
+  std::atomic<Clock::rep> interval_end_;
+  std::atomic<Clock::rep> min_queue_time_;
+  std::atomic<bool> is_overloaded_{false};
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
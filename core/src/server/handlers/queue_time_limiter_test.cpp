@@ -0,0 +1,48 @@
+#include <server/handlers/queue_time_limiter.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::QueueTimeLimiter;
+using std::chrono::milliseconds;
+
+constexpr server::handlers::QueueTimeLimitConfig kConfig{milliseconds{5},
+                                                        milliseconds{100}};
+
+}  // namespace
+
+TEST(QueueTimeLimiter, Burst) {
+  QueueTimeLimiter limiter{kConfig};
+  const auto now = QueueTimeLimiter::Clock::now();
+
+  EXPECT_FALSE(limiter.ShouldReject(milliseconds{50}, now));
+  EXPECT_FALSE(limiter.ShouldReject(milliseconds{1}, now));
+  EXPECT_TRUE(limiter.ShouldReject(milliseconds{150}, now));
+
+  // a short queue time within the interval means there is no overload
+  EXPECT_FALSE(limiter.ShouldReject(milliseconds{50}, now + milliseconds{150}));
+  EXPECT_FALSE(limiter.IsOverloaded());
+}
+
+TEST(QueueTimeLimiter, SustainedOverload) {
+  QueueTimeLimiter limiter{kConfig};
+  auto now = QueueTimeLimiter::Clock::now();
+
+  for (int i = 0; i < 10; ++i) {
+    limiter.ShouldReject(milliseconds{20}, now);
+    now += milliseconds{15};
+  }
+  EXPECT_TRUE(limiter.IsOverloaded());
+  EXPECT_TRUE(limiter.ShouldReject(milliseconds{20}, now));
+  EXPECT_FALSE(limiter.ShouldReject(milliseconds{1}, now));
+
+  // the overload is over once the queue time drops below the target
+  now += milliseconds{150};
+  EXPECT_FALSE(limiter.ShouldReject(milliseconds{20}, now));
+  EXPECT_FALSE(limiter.IsOverloaded());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,185 @@
+#include <server/handlers/response_cache.hpp>
+
+#include <chrono>
+#include <functional>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+void AppendKeyPart(std::string& key, std::string_view part) {
+  // Length prefixes keep the key unambiguous whatever the parts contain
+  key += std::to_string(part.size());
+  key += ':';
+  key += part;
+}
+
+std::string MakeETag(std::string_view body) {
+  return fmt::format("\"{:016x}\"", std::hash<std::string_view>{}(body));
+}
+
+std::string_view TrimWhitespace(std::string_view value) noexcept {
+  const auto begin = value.find_first_not_of(" \t");
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(" \t");
+  return value.substr(begin, end - begin + 1);
+}
+
+std::string_view StripWeakPrefix(std::string_view etag) noexcept {
+  if (etag.substr(0, 2) == "W/") etag.remove_prefix(2);
+  return etag;
+}
+
+bool IsNoStore(const http::HttpResponse& response) {
+  const auto& cache_control =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kCacheControl);
+  return cache_control.find("no-store") != std::string::npos;
+}
+
+}  // namespace
+
+struct ResponseCache::Entry {
+  std::shared_ptr<const std::string> body;
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string etag;
+  std::chrono::steady_clock::time_point expiration;
+  std::uint64_t generation{0};
+};
+
+ResponseCache::ResponseCache(const ResponseCacheConfig& config)
+    : config_(config),
+      entries_(config.ways, (config.size + config.ways - 1) / config.ways) {}
+
+ResponseCache::~ResponseCache() = default;
+
+std::optional<ResponseCache::Key> ResponseCache::MakeKey(
+    const http::HttpRequest& request, bool is_gzip_accepted) const {
+  // HEAD requests are handled as GET ones
+  if (request.GetMethod() != http::HttpMethod::kGet) return std::nullopt;
+
+  Key key;
+  key.generation = generation_.load();
+  AppendKeyPart(key.value, request.GetRequestPath());
+  for (const auto& arg : config_.args) {
+    if (request.HasArg(arg)) {
+      AppendKeyPart(key.value, request.GetArg(arg));
+    } else {
+      key.value += '-';
+    }
+  }
+  for (const auto& header : config_.headers) {
+    AppendKeyPart(key.value, request.GetHeader(header));
+  }
+  key.value += (is_gzip_accepted ? 'g' : 'i');
+  return key;
+}
+
+bool ResponseCache::Respond(const Key& key, const http::HttpRequest& request) {
+  const auto now = utils::datetime::SteadyNow();
+  const auto generation = generation_.load();
+  const auto entry = entries_.Get(key.value, [&](const EntryPtr& entry) {
+    return entry->generation == generation && now < entry->expiration;
+  });
+  if (!entry) return false;
+
+  auto& response = request.GetHttpResponse();
+  for (const auto& [name, value] : (*entry)->headers) {
+    response.SetHeader(name, value);
+  }
+  response.SetStatus(http::HttpStatus::kOk);
+  SetBody(**entry, request);
+  return true;
+}
+
+void ResponseCache::OnHandled(Key& key, const http::HttpResponse& response) {
+  for (const auto& name : response.GetHeaderNames()) {
+    key.header_names.push_back(name);
+  }
+}
+
+void ResponseCache::Store(const Key& key, const http::HttpRequest& request) {
+  auto& response = request.GetHttpResponse();
+  if (response.GetStatus() != http::HttpStatus::kOk ||
+      response.IsBodyStreamed() ||
+      response.GetCookieNames().begin() != response.GetCookieNames().end() ||
+      IsNoStore(response)) {
+    return;
+  }
+  // The data changed while the response was rendered
+  if (key.generation != generation_.load()) return;
+
+  auto entry = std::make_shared<Entry>();
+  entry->body = std::make_shared<const std::string>(response.GetData());
+  entry->generation = key.generation;
+  entry->expiration = utils::datetime::SteadyNow() + config_.ttl;
+
+  if (response.HasHeader(USERVER_NAMESPACE::http::headers::kETag)) {
+    entry->etag = response.GetHeader(USERVER_NAMESPACE::http::headers::kETag);
+  } else {
+    entry->etag = MakeETag(*entry->body);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, entry->etag);
+    entry->headers.emplace_back(
+        std::string{USERVER_NAMESPACE::http::headers::kETag}, entry->etag);
+  }
+
+  for (const auto& name : key.header_names) {
+    entry->headers.emplace_back(name, response.GetHeader(name));
+  }
+  // Set by the response compression after the handler
+  for (const auto& header :
+       {USERVER_NAMESPACE::http::headers::kContentEncoding,
+        USERVER_NAMESPACE::http::headers::kVary}) {
+    if (response.HasHeader(header)) {
+      entry->headers.emplace_back(std::string{header},
+                                  response.GetHeader(header));
+    }
+  }
+
+  // The response refers to the cached body as well
+  SetBody(*entry, request);
+  entries_.Put(key.value, std::move(entry));
+}
+
+void ResponseCache::SetBody(const Entry& entry,
+                            const http::HttpRequest& request) {
+  auto& response = request.GetHttpResponse();
+  const auto& if_none_match =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+  if (!if_none_match.empty() && IsETagMatched(if_none_match, entry.etag)) {
+    response.SetStatus(http::HttpStatus::kNotModified);
+    response.SetData({});
+  } else {
+    response.SetSharedData(entry.body);
+  }
+}
+
+void ResponseCache::Invalidate() {
+  ++generation_;
+  entries_.Invalidate();
+}
+
+bool IsETagMatched(std::string_view if_none_match, std::string_view etag) {
+  if (TrimWhitespace(if_none_match) == "*") return true;
+
+  etag = StripWeakPrefix(etag);
+  while (!if_none_match.empty()) {
+    const auto tag_end = if_none_match.find(',');
+    const auto tag = TrimWhitespace(if_none_match.substr(0, tag_end));
+    if (StripWeakPrefix(tag) == etag) return true;
+    if (tag_end == std::string_view::npos) break;
+    if_none_match.remove_prefix(tag_end + 1);
+  }
+  return false;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// @brief Cache of the responses of an HttpHandlerBase, see the
+/// `response-cache` static option.
+///
+/// The bodies are cached as shared strings and are sent without copying. The
+/// responses are selected by the request path and by the configured args and
+/// headers. Whether the client accepts gzip is a part of the key, so the
+/// compressed bodies are cached as well.
+class ResponseCache final {
+ public:
+  /// State of a request between the lookup and the store of its response
+  struct Key {
+    std::string value;
+    std::uint64_t generation{0};
+    // Headers set by the handler, the headers added later are per-request,
+    // e.g. the tracing ones
+    std::vector<std::string> header_names;
+  };
+
+  explicit ResponseCache(const ResponseCacheConfig& config);
+  ~ResponseCache();
+
+  /// Returns std::nullopt if the response to the request may not be cached
+  std::optional<Key> MakeKey(const http::HttpRequest& request,
+                             bool is_gzip_accepted) const;
+
+  /// Fills the response from the cache, returns false on a cache miss. Answers
+  /// with 304 if the `If-None-Match` of the request matches.
+  bool Respond(const Key& key, const http::HttpRequest& request);
+
+  /// Remembers the headers set by the handler, to be called right after it
+  static void OnHandled(Key& key, const http::HttpResponse& response);
+
+  /// Caches the response to the request if it is cacheable. Sets the `ETag`
+  /// of the response unless the handler did.
+  void Store(const Key& key, const http::HttpRequest& request);
+
+  /// Drops all the cached responses, including the ones being rendered
+  void Invalidate();
+
+ private:
+  struct Entry;
+  using EntryPtr = std::shared_ptr<const Entry>;
+
+  static void SetBody(const Entry& entry, const http::HttpRequest& request);
+
+  const ResponseCacheConfig config_;
+  std::atomic<std::uint64_t> generation_{0};
+  cache::NWayLRU<std::string, EntryPtr> entries_;
+};
+
+/// Whether the `If-None-Match` header value matches the entity tag,
+/// using the weak comparison of RFC 7232
+bool IsETagMatched(std::string_view if_none_match, std::string_view etag);
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
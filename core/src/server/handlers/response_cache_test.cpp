@@ -0,0 +1,193 @@
+#include <server/handlers/response_cache.hpp>
+
+#include <memory>
+#include <string>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+
+#include <server/http/create_parser_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::ResponseCache;
+using server::http::HttpStatus;
+
+std::shared_ptr<server::request::RequestBase> ParseRequest(
+    const std::string& request_text) {
+  std::shared_ptr<server::request::RequestBase> result;
+  auto parser = server::CreateTestParser(
+      [&result](std::shared_ptr<server::request::RequestBase>&& request) {
+        result = std::move(request);
+      });
+  parser.Parse(request_text.data(), request_text.size());
+  return result;
+}
+
+class Request final {
+ public:
+  explicit Request(const std::string& request_text)
+      : request_(ParseRequest(request_text)),
+        http_request_(
+            dynamic_cast<server::http::HttpRequestImpl&>(*request_)) {}
+
+  const server::http::HttpRequest& Get() const { return http_request_; }
+  server::http::HttpResponse& GetResponse() const {
+    return http_request_.GetHttpResponse();
+  }
+
+ private:
+  std::shared_ptr<server::request::RequestBase> request_;
+  server::http::HttpRequest http_request_;
+};
+
+server::handlers::ResponseCacheConfig MakeConfig() {
+  server::handlers::ResponseCacheConfig config;
+  config.ttl = std::chrono::seconds{10};
+  config.size = 4;
+  config.ways = 1;
+  config.args = {"id"};
+  config.headers = {"X-Lang"};
+  return config;
+}
+
+// Handles the request as HttpHandlerBase does, returns if it was a cache hit
+bool Handle(ResponseCache& cache, const Request& request,
+            const std::string& body) {
+  auto key = cache.MakeKey(request.Get(), /*is_gzip_accepted=*/false);
+  if (!key) return false;
+  if (cache.Respond(*key, request.Get())) return true;
+
+  auto& response = request.GetResponse();
+  response.SetHeader(std::string_view{"X-Handler"}, "value");
+  response.SetData(body);
+  response.SetStatus(HttpStatus::kOk);
+  ResponseCache::OnHandled(*key, response);
+  // Per-request headers are not cached
+  response.SetHeader(std::string_view{"X-YaTraceId"}, "trace");
+  cache.Store(*key, request.Get());
+  return false;
+}
+
+}  // namespace
+
+TEST(ResponseCache, IsETagMatched) {
+  using server::handlers::IsETagMatched;
+  EXPECT_TRUE(IsETagMatched("\"a\"", "\"a\""));
+  EXPECT_TRUE(IsETagMatched(" * ", "\"a\""));
+  EXPECT_TRUE(IsETagMatched("\"b\", W/\"a\"", "\"a\""));
+  EXPECT_TRUE(IsETagMatched("\"a\"", "W/\"a\""));
+  EXPECT_FALSE(IsETagMatched("\"b\", \"c\"", "\"a\""));
+  EXPECT_FALSE(IsETagMatched("", "\"a\""));
+}
+
+UTEST(ResponseCache, HitAndMiss) {
+  ResponseCache cache{MakeConfig()};
+
+  const Request first{"GET /v1/data?id=1&other=1 HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, first, "first"));
+  const auto etag = first.GetResponse().GetHeader(http::headers::kETag);
+  EXPECT_FALSE(etag.empty());
+
+  // Args and headers that are not configured do not select the response
+  const Request second{"GET /v1/data?other=2&id=1 HTTP/1.1\r\nX-A: b\r\n\r\n"};
+  EXPECT_TRUE(Handle(cache, second, "second"));
+  EXPECT_EQ(second.GetResponse().GetData(), "first");
+  EXPECT_EQ(&second.GetResponse().GetData(), &first.GetResponse().GetData());
+  EXPECT_EQ(second.GetResponse().GetHeader("X-Handler"), "value");
+  EXPECT_EQ(second.GetResponse().GetHeader(http::headers::kETag), etag);
+  EXPECT_FALSE(second.GetResponse().HasHeader("X-YaTraceId"));
+
+  const Request other_arg{"GET /v1/data?id=2 HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, other_arg, "other_arg"));
+  const Request other_header{
+      "GET /v1/data?id=1 HTTP/1.1\r\nX-Lang: en\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, other_header, "other_header"));
+  const Request other_path{"GET /v1/data2?id=1 HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, other_path, "other_path"));
+
+  const Request post{"POST /v1/data?id=1 HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(cache.MakeKey(post.Get(), false));
+}
+
+UTEST(ResponseCache, NotModified) {
+  ResponseCache cache{MakeConfig()};
+
+  const Request first{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, first, "body"));
+  const auto etag = first.GetResponse().GetHeader(http::headers::kETag);
+
+  const Request conditional{"GET /v1/data HTTP/1.1\r\nIf-None-Match: " + etag +
+                            "\r\n\r\n"};
+  EXPECT_TRUE(Handle(cache, conditional, "body"));
+  EXPECT_EQ(conditional.GetResponse().GetStatus(), HttpStatus::kNotModified);
+  EXPECT_EQ(conditional.GetResponse().GetData(), "");
+  EXPECT_EQ(conditional.GetResponse().GetHeader(http::headers::kETag), etag);
+}
+
+UTEST(ResponseCache, Invalidate) {
+  ResponseCache cache{MakeConfig()};
+
+  const Request first{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, first, "old"));
+  cache.Invalidate();
+
+  const Request second{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, second, "new"));
+  const Request third{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_TRUE(Handle(cache, third, "unused"));
+  EXPECT_EQ(third.GetResponse().GetData(), "new");
+
+  // A response rendered before the invalidation is not cached
+  const Request rendering{"GET /v1/other HTTP/1.1\r\n\r\n"};
+  auto key = cache.MakeKey(rendering.Get(), false);
+  ASSERT_TRUE(key);
+  EXPECT_FALSE(cache.Respond(*key, rendering.Get()));
+  cache.Invalidate();
+  rendering.GetResponse().SetData("stale");
+  cache.Store(*key, rendering.Get());
+
+  const Request after{"GET /v1/other HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, after, "fresh"));
+}
+
+UTEST(ResponseCache, Ttl) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  ResponseCache cache{MakeConfig()};
+
+  const Request first{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, first, "body"));
+  utils::datetime::MockSleep(std::chrono::seconds{9});
+  const Request second{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_TRUE(Handle(cache, second, "body"));
+  utils::datetime::MockSleep(std::chrono::seconds{2});
+  const Request third{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, third, "body"));
+
+  utils::datetime::MockNowUnset();
+}
+
+UTEST(ResponseCache, NotCacheable) {
+  ResponseCache cache{MakeConfig()};
+
+  const Request error{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  auto key = cache.MakeKey(error.Get(), false);
+  ASSERT_TRUE(key);
+  error.GetResponse().SetStatus(HttpStatus::kInternalServerError);
+  cache.Store(*key, error.Get());
+
+  const Request no_store{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  key = cache.MakeKey(no_store.Get(), false);
+  ASSERT_TRUE(key);
+  EXPECT_FALSE(cache.Respond(*key, no_store.Get()));
+  no_store.GetResponse().SetHeader(http::headers::kCacheControl, "no-store");
+  cache.Store(*key, no_store.Get());
+
+  const Request after{"GET /v1/data HTTP/1.1\r\n\r\n"};
+  EXPECT_FALSE(Handle(cache, after, "body"));
+}
+
+USERVER_NAMESPACE_END
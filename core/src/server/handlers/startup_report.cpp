@@ -0,0 +1,40 @@
+#include <userver/server/handlers/startup_report.hpp>
+
+#include <userver/components/component_context.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+#include <components/manager.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+StartupReport::StartupReport(const components::ComponentConfig& config,
+                             const components::ComponentContext& context)
+    : HttpHandlerBase(config, context, /*is_monitor = */ true),
+      manager_(context.GetManager()) {}
+
+std::string StartupReport::HandleRequestThrow(const http::HttpRequest& request,
+                                              request::RequestContext&) const {
+  const auto& report = manager_.GetStartupReport();
+  if (report.empty()) {
+    throw InternalServerError(
+        InternalMessage{"Components are still being constructed"});
+  }
+
+  request.GetHttpResponse().SetContentType(
+      USERVER_NAMESPACE::http::content_type::kApplicationJson);
+  return report;
+}
+
+yaml_config::Schema StartupReport::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-startup-report config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
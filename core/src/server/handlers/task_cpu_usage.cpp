@@ -0,0 +1,80 @@
+#include <userver/server/handlers/task_cpu_usage.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <utils/task_cpu_usage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::size_t kDefaultLimit = 20;
+
+std::size_t ParseLimit(const http::HttpRequest& request) {
+  const auto& limit = request.GetArg("limit");
+  if (limit.empty()) return kDefaultLimit;
+
+  try {
+    return utils::FromString<std::size_t>(limit);
+  } catch (const std::exception& ex) {
+    const auto message = std::string{"invalid 'limit' value: "} + ex.what();
+    throw ClientError(InternalMessage{message}, ExternalBody{message});
+  }
+}
+
+}  // namespace
+
+TaskCpuUsage::TaskCpuUsage(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerJsonBase(config, component_context, /*is_monitor = */ true) {
+  utils::task_cpu_usage::SetEnabled(true);
+  cpu_usage_statistics_holder_ =
+      component_context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("task-cpu-usage",
+                          &utils::task_cpu_usage::WriteStatistics);
+}
+
+TaskCpuUsage::~TaskCpuUsage() {
+  cpu_usage_statistics_holder_.Unregister();
+  utils::task_cpu_usage::SetEnabled(false);
+}
+
+formats::json::Value TaskCpuUsage::HandleRequestJsonThrow(
+    const http::HttpRequest& request, const formats::json::Value&,
+    request::RequestContext&) const {
+  const auto limit = ParseLimit(request);
+
+  formats::json::ValueBuilder result(formats::json::Type::kArray);
+  for (const auto& usage : utils::task_cpu_usage::GetTopSpans(limit)) {
+    formats::json::ValueBuilder usage_json(formats::json::Type::kObject);
+    usage_json["span_name"] = usage.span_name;
+    usage_json["cpu-time-us"] = usage.cpu_time.count();
+    usage_json["spans"] = usage.spans;
+    if (usage.spans != 0) {
+      usage_json["cpu-time-per-span-us"] =
+          static_cast<double>(usage.cpu_time.count()) /
+          static_cast<double>(usage.spans);
+    }
+    result.PushBack(std::move(usage_json));
+  }
+  return result.ExtractValue();
+}
+
+yaml_config::Schema TaskCpuUsage::GetStaticConfigSchema() {
+  auto schema = HttpHandlerJsonBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-task-cpu-usage config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <testsuite/impl/actions/http_allowed_urls_extra.hpp>
 #include <testsuite/impl/actions/logcapture.hpp>
 #include <testsuite/impl/actions/metrics_portability.hpp>
+#include <testsuite/impl/actions/perf_counters.hpp>
 #include <testsuite/impl/actions/periodic.hpp>
 #include <testsuite/impl/actions/reset_metrics.hpp>
 #include <testsuite/impl/actions/tasks.hpp>
@@ -81,6 +82,11 @@ TestsControl::TestsControl(
       "metrics_portability",
       std::make_unique<actions::MetricsPortability>(component_context));
 
+  // Performance counters
+  testsuite_support.GetPerfCountersControl().Enable();
+  actions_.emplace("perf_counters",
+                   std::make_unique<actions::PerfCounters>(component_context));
+
   // Log capture
   actions_.emplace("log_capture",
                    std::make_unique<actions::LogCapture>(component_context));
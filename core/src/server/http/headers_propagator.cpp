@@ -1,21 +1,58 @@
 #include <server/http/headers_propagator.hpp>
 
-#include <userver/server/request/task_inherited_request.hpp>
+#include <memory>
+#include <utility>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/engine/task/inherited_variable.hpp>
+
+#include <curl-ev/easy.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/request/task_inherited_request_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
+namespace {
+
+struct PropagatedHeaders final {
+  const HeadersPropagator* propagator{nullptr};
+  // Holds the request, so that its address identifies it
+  std::shared_ptr<HttpRequestImpl> request;
+  // The names and the "Name: value" lines of the present headers
+  std::vector<std::pair<std::string, std::string>> lines;
+};
+
+engine::TaskInheritedVariable<PropagatedHeaders> kPropagatedHeaders;
+
+}  // namespace
+
 HeadersPropagator::HeadersPropagator(std::vector<std::string>&& headers)
     : headers_(std::move(headers)) {}
 
-void HeadersPropagator::PropagateHeaders(
-    clients::http::RequestTracingEditor request) const {
-  for (const auto& header : headers_) {
-    if (server::request::HasTaskInheritedHeader(header)) {
-      request.SetHeader(header,
-                        server::request::GetTaskInheritedHeader(header));
+void HeadersPropagator::PropagateHeaders(curl::easy& easy) const {
+  const auto* request = server::request::kTaskInheritedRequest.GetOptional();
+  if (request == nullptr || *request == nullptr) return;
+
+  const auto* propagated = kPropagatedHeaders.GetOptional();
+  if (propagated == nullptr || propagated->propagator != this ||
+      propagated->request != *request) {
+    PropagatedHeaders new_propagated{this, *request, {}};
+    for (const auto& header : headers_) {
+      if (!(*request)->HasHeader(header)) continue;
+      new_propagated.lines.emplace_back(
+          header, fmt::format(FMT_COMPILE("{}: {}"), header,
+                              (*request)->GetHeader(header)));
     }
+    kPropagatedHeaders.Set(std::move(new_propagated));
+    propagated = &kPropagatedHeaders.Get();
+  }
+
+  for (const auto& [name, line] : propagated->lines) {
+    easy.add_header_line(name, line);
   }
 }
 
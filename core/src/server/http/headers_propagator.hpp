@@ -3,18 +3,21 @@
 #include <string>
 #include <vector>
 
-#include <userver/clients/http/request_tracing_editor.hpp>
-#include <userver/server/http/http_request.hpp>
-
 USERVER_NAMESPACE_BEGIN
 
+namespace curl {
+class easy;
+}  // namespace curl
+
 namespace server::http {
 
 class HeadersPropagator final {
  public:
   explicit HeadersPropagator(std::vector<std::string>&&);
 
-  void PropagateHeaders(clients::http::RequestTracingEditor request) const;
+  // The header lines are formatted once per incoming request and are kept in
+  // the task inherited data for all the outgoing requests
+  void PropagateHeaders(curl::easy& easy) const;
 
  private:
   const std::vector<std::string> headers_;
@@ -0,0 +1,454 @@
+#include "http2_session.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// Bounds the memory used for the frames that are sent at once
+constexpr std::size_t kMaxWriteSize = 64 * 1024;
+
+HttpMethod ConvertHttpMethod(std::string_view method) {
+  try {
+    return HttpMethodFromString(method);
+  } catch (const std::exception&) {
+    return HttpMethod::kUnknown;
+  }
+}
+
+nghttp2_nv MakeNv(std::string_view name, std::string_view value) {
+  // nghttp2 copies the headers on submit, the const_cast is safe
+  nghttp2_nv nv{};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  nv.name = reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data()));
+  nv.namelen = name.size();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  nv.value = reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data()));
+  nv.valuelen = value.size();
+  nv.flags = NGHTTP2_NV_FLAG_NONE;
+  return nv;
+}
+
+std::string_view ToStringView(const std::uint8_t* data, std::size_t size) {
+  return {reinterpret_cast<const char*>(data), size};
+}
+
+Http2Session& GetSession(void* user_data) {
+  auto* session = static_cast<Http2Session*>(user_data);
+  UASSERT(session != nullptr);
+  return *session;
+}
+
+}  // namespace
+
+Http2Stream::Http2Stream(Http2Session& session, std::int32_t id)
+    : session_(session), id_(id) {}
+
+void Http2Stream::SubmitResponse(HttpStatus status, Headers&& headers,
+                                 std::optional<std::string_view> body) {
+  const auto status_string =
+      fmt::format(FMT_COMPILE("{}"), static_cast<int>(status));
+
+  std::vector<nghttp2_nv> nva;
+  nva.reserve(headers.size() + 1);
+  nva.push_back(MakeNv(":status", status_string));
+  std::size_t headers_size = 0;
+  for (const auto& [name, value] : headers) {
+    nva.push_back(MakeNv(name, value));
+    headers_size += name.size() + value.size();
+  }
+
+  std::lock_guard lock{session_.mutex_};
+  if (is_closed_) return;
+
+  if (body) {
+    pending_data_ = *body;
+    is_data_finished_ = true;
+  }
+  const bool has_data = !body || !body->empty();
+  is_response_complete_ = !has_data;
+
+  nghttp2_data_provider data_provider{};
+  data_provider.source.ptr = this;
+  data_provider.read_callback = &Http2Session::OnDataSourceRead;
+
+  const auto result =
+      nghttp2_submit_response(session_.session_.get(), id_, nva.data(),
+                              nva.size(), has_data ? &data_provider : nullptr);
+  if (result != 0) {
+    LOG_WARNING() << "Failed to submit the response of HTTP/2 stream " << id_
+                  << ": " << nghttp2_strerror(result);
+    nghttp2_submit_rst_stream(session_.session_.get(), NGHTTP2_FLAG_NONE, id_,
+                              NGHTTP2_INTERNAL_ERROR);
+  }
+  sent_bytes_ += headers_size;
+  session_.writer_event_.Send();
+}
+
+void Http2Stream::AppendData(std::string data) {
+  std::lock_guard lock{session_.mutex_};
+  if (is_closed_) return;
+
+  if (pending_data_.empty()) {
+    buffer_ = std::move(data);
+  } else {
+    std::string merged;
+    merged.reserve(pending_data_.size() + data.size());
+    merged.append(pending_data_).append(data);
+    buffer_ = std::move(merged);
+  }
+  pending_data_ = buffer_;
+  ResumeData();
+}
+
+void Http2Stream::FinishData() {
+  std::lock_guard lock{session_.mutex_};
+  if (is_closed_) return;
+
+  is_data_finished_ = true;
+  ResumeData();
+}
+
+bool Http2Stream::WaitClosed() {
+  if (!closed_event_.WaitForEvent()) return false;
+  return is_response_complete_ && close_error_code_ == NGHTTP2_NO_ERROR;
+}
+
+void Http2Stream::ResumeData() {
+  if (is_data_deferred_) {
+    is_data_deferred_ = false;
+    nghttp2_session_resume_data(session_.session_.get(), id_);
+  }
+  session_.writer_event_.Send();
+}
+
+Http2Session::Http2Session(const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           OnNewRequestCb&& on_new_request_cb,
+                           net::ParserStats& stats,
+                           request::ResponseDataAccounter& data_accounter,
+                           std::uint32_t max_concurrent_streams)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter) {
+  nghttp2_session_callbacks* callbacks = nullptr;
+  if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+    throw std::bad_alloc();
+  }
+  nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks,
+                                                          &OnBeginHeaders);
+  nghttp2_session_callbacks_set_on_header_callback(callbacks, &OnHeader);
+  nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks,
+                                                       &OnFrameRecv);
+  nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks,
+                                                            &OnDataChunkRecv);
+  nghttp2_session_callbacks_set_on_stream_close_callback(callbacks,
+                                                         &OnStreamClose);
+
+  nghttp2_session* session = nullptr;
+  const auto result = nghttp2_session_server_new(&session, callbacks, this);
+  nghttp2_session_callbacks_del(callbacks);
+  if (result != 0) {
+    throw std::runtime_error(
+        fmt::format("Failed to create HTTP/2 session: {}",
+                    nghttp2_strerror(result)));
+  }
+  session_.reset(session);
+
+  const nghttp2_settings_entry settings[] = {
+      {NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, max_concurrent_streams},
+  };
+  nghttp2_submit_settings(session_.get(), NGHTTP2_FLAG_NONE, settings,
+                          std::size(settings));
+  writer_event_.Send();
+}
+
+Http2Session::~Http2Session() {
+  for (const auto& [id, stream] : streams_) {
+    if (stream->request_constructor_) --stats_.parsing_request_count;
+  }
+}
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  std::lock_guard lock{mutex_};
+  const auto read = nghttp2_session_mem_recv(
+      session_.get(), reinterpret_cast<const std::uint8_t*>(data), size);
+  // Acknowledgements, window updates, GOAWAY and so on
+  writer_event_.Send();
+
+  if (read < 0) {
+    LOG_WARNING() << "HTTP/2 session error: "
+                  << nghttp2_strerror(static_cast<int>(read));
+    return false;
+  }
+  UASSERT(static_cast<std::size_t>(read) == size);
+  return nghttp2_session_want_read(session_.get()) ||
+         nghttp2_session_want_write(session_.get());
+}
+
+void Http2Session::RunWriter(engine::io::Socket& socket) {
+  std::string buffer;
+  while (writer_event_.WaitForEvent()) {
+    {
+      std::lock_guard lock{mutex_};
+      while (buffer.size() < kMaxWriteSize) {
+        const std::uint8_t* data = nullptr;
+        const auto size = nghttp2_session_mem_send(session_.get(), &data);
+        if (size < 0) {
+          throw std::runtime_error(
+              fmt::format("HTTP/2 session error: {}",
+                          nghttp2_strerror(static_cast<int>(size))));
+        }
+        if (size == 0) break;
+        buffer.append(reinterpret_cast<const char*>(data), size);
+      }
+      // More frames are pending, do not wait for the next notification
+      if (buffer.size() >= kMaxWriteSize) writer_event_.Send();
+    }
+
+    if (buffer.empty()) continue;
+    // Sending outside the lock, the requests are still parsed meanwhile
+    if (socket.SendAll(buffer.data(), buffer.size(), {}) != buffer.size()) {
+      LOG_TRACE() << "Peer closed the HTTP/2 connection";
+      return;
+    }
+    buffer.clear();
+  }
+}
+
+int Http2Session::OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                                 void* user_data) {
+  try {
+    GetSession(user_data).OnBeginHeadersImpl(*frame);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to start HTTP/2 stream: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+int Http2Session::OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                           const std::uint8_t* name, std::size_t name_size,
+                           const std::uint8_t* value, std::size_t value_size,
+                           std::uint8_t /*flags*/, void* user_data) {
+  try {
+    GetSession(user_data).OnHeaderImpl(*frame, ToStringView(name, name_size),
+                                       ToStringView(value, value_size));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to process HTTP/2 header: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+int Http2Session::OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                              void* user_data) {
+  try {
+    GetSession(user_data).OnFrameRecvImpl(*frame);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to process HTTP/2 frame: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+int Http2Session::OnDataChunkRecv(nghttp2_session*, std::uint8_t /*flags*/,
+                                  std::int32_t stream_id,
+                                  const std::uint8_t* data, std::size_t size,
+                                  void* user_data) {
+  try {
+    GetSession(user_data).OnDataChunkRecvImpl(stream_id,
+                                              ToStringView(data, size));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to process HTTP/2 data: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+int Http2Session::OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                                std::uint32_t error_code, void* user_data) {
+  GetSession(user_data).OnStreamCloseImpl(stream_id, error_code);
+  return 0;
+}
+
+ssize_t Http2Session::OnDataSourceRead(nghttp2_session*, std::int32_t,
+                                       std::uint8_t* buf, std::size_t length,
+                                       std::uint32_t* data_flags,
+                                       nghttp2_data_source* source, void*) {
+  auto& stream = *static_cast<Http2Stream*>(source->ptr);
+  auto& pending = stream.pending_data_;
+
+  const auto size = std::min(length, pending.size());
+  std::memcpy(buf, pending.data(), size);
+  pending.remove_prefix(size);
+  stream.sent_bytes_ += size;
+
+  if (pending.empty()) {
+    if (stream.is_data_finished_) {
+      *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+      stream.is_response_complete_ = true;
+    } else if (size == 0) {
+      // Resumed by Http2Stream::AppendData() or Http2Stream::FinishData()
+      stream.is_data_deferred_ = true;
+      return NGHTTP2_ERR_DEFERRED;
+    }
+  }
+  return static_cast<ssize_t>(size);
+}
+
+void Http2Session::OnBeginHeadersImpl(const nghttp2_frame& frame) {
+  if (frame.hd.type != NGHTTP2_HEADERS ||
+      frame.headers.cat != NGHTTP2_HCAT_REQUEST) {
+    return;
+  }
+
+  const auto stream_id = frame.hd.stream_id;
+  auto stream = std::make_shared<Http2Stream>(*this, stream_id);
+  stream->request_constructor_.emplace(request_constructor_config_,
+                                       handler_info_index_, data_accounter_);
+  ++stats_.parsing_request_count;
+  streams_.emplace(stream_id, std::move(stream));
+  LOG_TRACE() << "HTTP/2 stream " << stream_id << " started";
+}
+
+void Http2Session::OnHeaderImpl(const nghttp2_frame& frame,
+                                std::string_view name,
+                                std::string_view value) {
+  // Trailers are ignored
+  if (frame.headers.cat != NGHTTP2_HCAT_REQUEST) return;
+  auto* stream = FindParsingStream(frame.hd.stream_id);
+  if (!stream) return;
+
+  LOG_TRACE() << "header: '" << name << "': '" << value << '\'';
+  auto& constructor = *stream->request_constructor_;
+  try {
+    if (name == ":method") {
+      constructor.SetMethod(ConvertHttpMethod(value));
+    } else if (name == ":path") {
+      constructor.AppendUrl(value.data(), value.size());
+    } else if (name == ":authority") {
+      CompleteUrl(*stream);
+      const std::string_view host = USERVER_NAMESPACE::http::headers::kHost;
+      constructor.AppendHeaderField(host.data(), host.size());
+      constructor.AppendHeaderValue(value.data(), value.size());
+    } else if (!name.empty() && name.front() != ':') {
+      CompleteUrl(*stream);
+      constructor.AppendHeaderField(name.data(), name.size());
+      constructor.AppendHeaderValue(value.data(), value.size());
+    }
+  } catch (const std::exception& ex) {
+    // Respond with the error status right away, the rest of the stream frames
+    // are ignored
+    LOG_WARNING() << "can't append header: " << ex;
+    FinalizeRequest(*stream);
+  }
+}
+
+void Http2Session::OnFrameRecvImpl(const nghttp2_frame& frame) {
+  auto* stream = FindParsingStream(frame.hd.stream_id);
+  if (!stream) return;
+
+  if (frame.hd.type == NGHTTP2_HEADERS &&
+      frame.headers.cat == NGHTTP2_HCAT_REQUEST) {
+    try {
+      CompleteUrl(*stream);
+      stream->request_constructor_->AppendHeaderField("", 0);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't complete headers: " << ex;
+      FinalizeRequest(*stream);
+      return;
+    }
+    LOG_TRACE() << "headers complete";
+  }
+
+  if (frame.hd.flags & NGHTTP2_FLAG_END_STREAM) {
+    LOG_TRACE() << "message complete";
+    FinalizeRequest(*stream);
+  }
+}
+
+void Http2Session::OnDataChunkRecvImpl(std::int32_t stream_id,
+                                       std::string_view data) {
+  auto* stream = FindParsingStream(stream_id);
+  if (!stream) return;
+
+  try {
+    stream->request_constructor_->AppendBody(data.data(), data.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append body: " << ex;
+    FinalizeRequest(*stream);
+  }
+}
+
+void Http2Session::OnStreamCloseImpl(std::int32_t stream_id,
+                                     std::uint32_t error_code) {
+  const auto it = streams_.find(stream_id);
+  if (it == streams_.end()) return;
+
+  auto& stream = *it->second;
+  if (stream.request_constructor_) {
+    --stats_.parsing_request_count;
+    stream.request_constructor_.reset();
+  }
+  stream.is_closed_ = true;
+  stream.close_error_code_ = error_code;
+  stream.closed_event_.Send();
+  LOG_TRACE() << "HTTP/2 stream " << stream_id
+              << " closed, error_code=" << error_code;
+
+  streams_.erase(it);
+}
+
+Http2Stream* Http2Session::FindParsingStream(std::int32_t stream_id) {
+  const auto it = streams_.find(stream_id);
+  if (it == streams_.end() || !it->second->request_constructor_) {
+    return nullptr;
+  }
+  return it->second.get();
+}
+
+void Http2Session::CompleteUrl(Http2Stream& stream) {
+  if (stream.url_complete_) return;
+  stream.url_complete_ = true;
+
+  auto& constructor = *stream.request_constructor_;
+  constructor.SetHttpMajor(2);
+  constructor.SetHttpMinor(0);
+  constructor.ParseUrl();
+}
+
+void Http2Session::FinalizeRequest(Http2Stream& stream) {
+  UASSERT(stream.request_constructor_);
+  auto request = stream.request_constructor_->Finalize();
+  --stats_.parsing_request_count;
+  stream.request_constructor_.reset();
+
+  if (!request) {
+    LOG_ERROR() << "request is null after Finalize()";
+    nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE, stream.id_,
+                              NGHTTP2_INTERNAL_ERROR);
+    return;
+  }
+  on_new_request_cb_(std::move(request), streams_.at(stream.id_));
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
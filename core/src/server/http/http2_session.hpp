@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/server/http/http_status.hpp>
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class Http2Session;
+
+/// A single request/response exchange of an HTTP/2 connection
+class Http2Stream final {
+ public:
+  using Headers = std::vector<std::pair<std::string, std::string>>;
+
+  // Use Http2Session to create streams
+  Http2Stream(Http2Session& session, std::int32_t id);
+
+  /// Submits the response headers. If `body` is std::nullopt, the body is
+  /// streamed with AppendData() and FinishData(). Otherwise the `body` must
+  /// stay alive until WaitClosed() returns.
+  void SubmitResponse(HttpStatus status, Headers&& headers,
+                      std::optional<std::string_view> body);
+
+  void AppendData(std::string data);
+  void FinishData();
+
+  /// @returns false if the stream was reset or the connection was closed
+  /// before the whole response was sent
+  bool WaitClosed();
+
+  /// Approximate, as the headers are accounted before HPACK compression
+  std::size_t GetSentBytes() const noexcept { return sent_bytes_; }
+
+ private:
+  friend class Http2Session;
+
+  void ResumeData();
+
+  Http2Session& session_;
+  const std::int32_t id_;
+
+  // Request parsing state, empty once the request is finalized
+  std::optional<HttpRequestConstructor> request_constructor_;
+  bool url_complete_{false};
+
+  // Response state, guarded by the session mutex
+  std::string buffer_;
+  std::string_view pending_data_;
+  bool is_data_finished_{false};
+  bool is_data_deferred_{false};
+  bool is_response_complete_{false};
+  bool is_closed_{false};
+  std::uint32_t close_error_code_{NGHTTP2_NO_ERROR};
+  std::size_t sent_bytes_{0};
+  engine::SingleConsumerEvent closed_event_;
+};
+
+/// @brief Server side of an HTTP/2 connection over nghttp2.
+///
+/// Parse() feeds the received bytes into the session and reports the
+/// completed requests of the streams, RunWriter() sends the frames produced
+/// by the session. The responses of the streams are submitted independently
+/// and in any order, nghttp2 takes care of the multiplexing, HPACK and flow
+/// control.
+class Http2Session final : public request::RequestParser {
+ public:
+  using OnNewRequestCb =
+      std::function<void(std::shared_ptr<request::RequestBase>&&,
+                         std::shared_ptr<Http2Stream>)>;
+
+  /// Connection preface of the HTTP/2 client, RFC 7540 section 3.5
+  static constexpr std::string_view kClientPreface{
+      "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"};
+
+  Http2Session(const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
+               request::ResponseDataAccounter& data_accounter,
+               std::uint32_t max_concurrent_streams);
+  ~Http2Session() override;
+
+  /// Returns false if the session is over, e.g. due to a protocol error
+  bool Parse(const char* data, size_t size) override;
+
+  /// Sends the frames produced by the session until cancelled or until the
+  /// peer closes the connection
+  void RunWriter(engine::io::Socket& socket);
+
+ private:
+  friend class Http2Stream;
+
+  struct SessionDeleter {
+    void operator()(nghttp2_session* session) const noexcept {
+      nghttp2_session_del(session);
+    }
+  };
+
+  static int OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                            void* user_data);
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const std::uint8_t* name, std::size_t name_size,
+                      const std::uint8_t* value, std::size_t value_size,
+                      std::uint8_t flags, void* user_data);
+  static int OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                         void* user_data);
+  static int OnDataChunkRecv(nghttp2_session*, std::uint8_t flags,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             std::size_t size, void* user_data);
+  static int OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data);
+  static ssize_t OnDataSourceRead(nghttp2_session*, std::int32_t stream_id,
+                                  std::uint8_t* buf, std::size_t length,
+                                  std::uint32_t* data_flags,
+                                  nghttp2_data_source* source, void* user_data);
+
+  void OnBeginHeadersImpl(const nghttp2_frame& frame);
+  void OnHeaderImpl(const nghttp2_frame& frame, std::string_view name,
+                    std::string_view value);
+  void OnFrameRecvImpl(const nghttp2_frame& frame);
+  void OnDataChunkRecvImpl(std::int32_t stream_id, std::string_view data);
+  void OnStreamCloseImpl(std::int32_t stream_id, std::uint32_t error_code);
+
+  // Returns nullptr if the request of the stream is not being parsed
+  Http2Stream* FindParsingStream(std::int32_t stream_id);
+  static void CompleteUrl(Http2Stream& stream);
+  void FinalizeRequest(Http2Stream& stream);
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+
+  engine::Mutex mutex_;
+  std::unique_ptr<nghttp2_session, SessionDeleter> session_;
+  std::unordered_map<std::int32_t, std::shared_ptr<Http2Stream>> streams_;
+  engine::SingleConsumerEvent writer_event_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -159,6 +159,12 @@ const std::string& HttpRequest::RequestBody() const {
   return impl_.RequestBody();
 }
 
+bool HttpRequest::IsBodyStreamed() const { return impl_.IsBodyStreamed(); }
+
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+  return impl_.GetBodyStream();
+}
+
 const HttpRequest::HeadersMap& HttpRequest::RequestHeaders() const {
   return impl_.GetHeaders();
 }
@@ -0,0 +1,40 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(Queue::Consumer&& queue_consumer)
+    : queue_consumer_(std::move(queue_consumer)) {}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream::~RequestBodyStream() = default;
+
+bool RequestBodyStream::ReadChunk(std::string& output,
+                                  engine::Deadline deadline) {
+  if (is_body_read_) return false;
+
+  if (!queue_consumer_.Pop(output, deadline)) {
+    if (deadline.IsReached() || engine::current_task::ShouldCancel()) {
+      return false;
+    }
+    // The producer is gone without the end of the body
+    throw handlers::RequestParseError(
+        handlers::InternalMessage{"the request body is incomplete"});
+  }
+
+  // An empty part marks the end of the body
+  if (output.empty()) {
+    is_body_read_ = true;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::RequestBodyStream;
+
+constexpr std::size_t kQueueSize = 2;
+
+}  // namespace
+
+UTEST(RequestBodyStream, ReadsUntilEnd) {
+  auto queue = RequestBodyStream::Queue::Create(kQueueSize);
+  auto producer = queue->GetProducer();
+  RequestBodyStream stream{queue->GetConsumer()};
+
+  auto task = engine::AsyncNoSpan([&producer] {
+    for (const auto* part : {"a", "bc", "def"}) {
+      // Blocks while the queue is full
+      EXPECT_TRUE(producer.Push(part, {}));
+    }
+    EXPECT_TRUE(producer.Push({}, {}));
+  });
+
+  std::string body;
+  std::string chunk;
+  while (stream.ReadChunk(chunk, {})) body += chunk;
+  task.Get();
+
+  EXPECT_EQ(body, "abcdef");
+  EXPECT_TRUE(stream.IsBodyRead());
+  EXPECT_FALSE(stream.ReadChunk(chunk, {}));
+}
+
+UTEST(RequestBodyStream, Incomplete) {
+  auto queue = RequestBodyStream::Queue::Create(kQueueSize);
+  auto producer = queue->GetProducer();
+  RequestBodyStream stream{queue->GetConsumer()};
+
+  ASSERT_TRUE(producer.Push("part", {}));
+  {
+    [[maybe_unused]] auto dropped = std::move(producer);
+  }
+
+  std::string chunk;
+  EXPECT_TRUE(stream.ReadChunk(chunk, {}));
+  EXPECT_EQ(chunk, "part");
+  EXPECT_THROW(stream.ReadChunk(chunk, {}),
+               server::handlers::RequestParseError);
+  EXPECT_FALSE(stream.IsBodyRead());
+}
+
+UTEST(RequestBodyStream, Deadline) {
+  auto queue = RequestBodyStream::Queue::Create(kQueueSize);
+  auto producer = queue->GetProducer();
+  RequestBodyStream stream{queue->GetConsumer()};
+
+  std::string chunk;
+  EXPECT_FALSE(stream.ReadChunk(
+      chunk, engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+  EXPECT_FALSE(stream.IsBodyRead());
+
+  ASSERT_TRUE(producer.Push({}, {}));
+  EXPECT_FALSE(stream.ReadChunk(chunk, {}));
+  EXPECT_TRUE(stream.IsBodyRead());
+}
+
+UTEST(RequestBodyStream, DroppedConsumerUnblocksProducer) {
+  auto queue = RequestBodyStream::Queue::Create(kQueueSize);
+  auto producer = queue->GetProducer();
+  auto stream = std::make_unique<RequestBodyStream>(queue->GetConsumer());
+
+  ASSERT_TRUE(producer.Push("a", {}));
+  ASSERT_TRUE(producer.Push("b", {}));
+  auto task = engine::AsyncNoSpan(
+      [&producer] { return producer.Push("c", engine::Deadline{}); });
+
+  engine::Yield();
+  EXPECT_FALSE(task.IsFinished());
+  stream.reset();
+  EXPECT_FALSE(task.Get());
+}
+
+USERVER_NAMESPACE_END
@@ -17,6 +17,10 @@ namespace server::http {
 
 namespace {
 
+// Max count of the buffered body parts of a streamed request. A part is at
+// most the `in_buffer_size` of the connection.
+constexpr std::size_t kMaxBodyStreamQueueSize = 16;
+
 inline void Strip(const char*& begin, const char*& end) {
   while (begin < end && isspace(*begin)) ++begin;
   while (begin < end && isspace(end[-1])) --end;
@@ -36,7 +40,7 @@ void StripDuplicateStartingSlashes(std::string& s) {
     return;
   }
 
-  s = s.substr(non_slash_pos - 1);
+  s.erase(0, non_slash_pos - 1);
 }
 
 }  // namespace
@@ -83,7 +87,7 @@ void HttpRequestConstructor::ParseUrl() {
     const auto& str_info =
         parsed_url_.field_data[http_parser_url_fields::UF_PATH];
 
-    request_->request_path_ = request_->url_.substr(str_info.off, str_info.len);
+    request_->request_path_.assign(request_->url_, str_info.off, str_info.len);
     StripDuplicateStartingSlashes(request_->request_path_);
     LOG_TRACE() << "path='" << request_->request_path_ << '\'';
   } else {
@@ -113,6 +117,7 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    is_body_streamed_ = handler_config.request_body_stream;
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
@@ -159,24 +164,88 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   AccountRequestSize(size);
+  if (body_producer_) {
+    // Blocks while the handler is behind. If the handler has already returned,
+    // the rest of the body is dropped.
+    [[maybe_unused]] const bool is_pushed =
+        body_producer_->Push(std::string(data, size), engine::Deadline{});
+    return;
+  }
+  // The request is already handled, e.g. with an error
+  if (is_head_finalized_) return;
   request_->request_body_.append(data, size);
 }
 
+void HttpRequestConstructor::SetBodyComplete() { is_body_complete_ = true; }
+
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
+  // The request may be already handled by another task
+  if (is_head_finalized_) return;
   request_->is_final_ = is_final;
 }
 
+std::shared_ptr<request::RequestBase> HttpRequestConstructor::FinalizeHead() {
+  UASSERT(is_body_streamed_);
+  UASSERT(!is_head_finalized_);
+  LOG_TRACE() << "method=" << request_->GetMethodStr()
+              << " orig_method=" << request_->GetOrigMethodStr()
+              << ", streaming the body";
+
+  FinalizeImpl();
+  if (status_ == Status::kOk) CreateBodyStream();
+
+  CheckStatus();
+
+  is_head_finalized_ = true;
+  // request_ is kept for the error messages about the body
+  return request_;
+}
+
 std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
+  if (is_head_finalized_) {
+    // The producer is dropped without the end of the body on errors
+    if (body_producer_ && is_body_complete_ && status_ == Status::kOk) {
+      [[maybe_unused]] const bool is_pushed =
+          body_producer_->Push(std::string{}, engine::Deadline{});
+    }
+    body_producer_.reset();
+    request_.reset();
+    return nullptr;
+  }
+
   LOG_TRACE() << "method=" << request_->GetMethodStr()
               << " orig_method=" << request_->GetOrigMethodStr();
 
   FinalizeImpl();
 
+  if (is_body_streamed_ && status_ == Status::kOk) {
+    // The body is received in full anyway, e.g. over HTTP/2
+    CreateBodyStream();
+    auto body = std::move(request_->request_body_);
+    request_->request_body_.clear();
+    if (!body.empty()) {
+      [[maybe_unused]] const bool is_pushed =
+          body_producer_->PushNoblock(std::move(body));
+      UASSERT(is_pushed);
+    }
+    [[maybe_unused]] const bool is_pushed =
+        body_producer_->PushNoblock(std::string{});
+    UASSERT(is_pushed);
+    body_producer_.reset();
+  }
+
   CheckStatus();
 
   return std::move(request_);  // request_ is left empty
 }
 
+void HttpRequestConstructor::CreateBodyStream() {
+  UASSERT(!body_producer_);
+  auto queue = RequestBodyStream::Queue::Create(kMaxBodyStreamQueueSize);
+  body_producer_.emplace(queue->GetProducer());
+  request_->body_stream_.emplace(queue->GetConsumer());
+}
+
 void HttpRequestConstructor::FinalizeImpl() {
   if (status_ != Status::kOk &&
       (!config_.testing_mode || status_ != Status::kHandlerNotFound)) {
@@ -190,7 +259,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   try {
     ParseArgs(parsed_url_);
-    if (config_.parse_args_from_body) {
+    if (config_.parse_args_from_body && !is_body_streamed_) {
       if (!config_.decompress_request || !request_->IsBodyCompressed())
         ParseArgs(request_->request_body_.data(),
                   request_->request_body_.size());
@@ -218,6 +287,9 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   LOG_TRACE() << "cookies:" << request_->cookies_;
 
+  // A streamed body is parsed by the handler
+  if (is_body_streamed_) return;
+
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
   if (IsMultipartFormDataContentType(content_type)) {
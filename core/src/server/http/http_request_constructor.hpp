@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <http_parser.h>
 
@@ -51,13 +52,25 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void AppendHeaderField(const char* data, size_t size);
   void AppendHeaderValue(const char* data, size_t size);
   void AppendBody(const char* data, size_t size);
+  void SetBodyComplete();
 
   void SetIsFinal(bool is_final);
 
+  // Whether the handler reads the body as a stream, known after ParseUrl()
+  bool IsBodyStreamed() const { return is_body_streamed_; }
+  bool IsHeadFinalized() const { return is_head_finalized_; }
+
+  // Returns the request to handle before its body is received, the body is
+  // pushed into the request body stream afterwards. Must be called after the
+  // headers and SetIsFinal().
+  std::shared_ptr<request::RequestBase> FinalizeHead();
+
+  // Returns nullptr if the request was returned by FinalizeHead()
   std::shared_ptr<request::RequestBase> Finalize() override;
 
  private:
   void FinalizeImpl();
+  void CreateBodyStream();
 
   void ParseArgs(const http_parser_url& url);
   void ParseArgs(const char* data, size_t size);
@@ -86,6 +99,11 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   bool url_parsed_ = false;
   Status status_ = Status::kOk;
 
+  bool is_body_streamed_ = false;
+  bool is_head_finalized_ = false;
+  bool is_body_complete_ = false;
+  std::optional<RequestBodyStream::Queue::Producer> body_producer_;
+
   std::shared_ptr<HttpRequestImpl> request_;
 };
 
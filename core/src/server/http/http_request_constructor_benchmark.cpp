@@ -1,12 +1,30 @@
 #include <benchmark/benchmark.h>
 
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace {
 
+constexpr std::string_view kTypicalRequest =
+    "POST /v1/orders/estimate?zone=moscow&user_id=6b3a1c9e8f2d4a7b&"
+    "lang=ru&comment=%D0%BF%D1%80%D0%B8%D0%B2%D0%B5%D1%82+world HTTP/1.1\r\n"
+    "Host: orders.example.com:8080\r\n"
+    "User-Agent: userver/2.0 (Linux; x86_64)\r\n"
+    "Accept: application/json\r\n"
+    "Accept-Encoding: gzip, identity\r\n"
+    "Content-Type: application/json\r\n"
+    "X-YaRequestId: 5f0c3e9b1a2d4c6e8f0a1b3c5d7e9f1a\r\n"
+    "X-YaTraceId: 0a1b2c3d4e5f60718293a4b5c6d7e8f9\r\n"
+    "X-YaSpanId: 1a2b3c4d5e6f7081\r\n"
+    "Cookie: session=8c1f2d3e4a5b6c7d; theme=dark\r\n"
+    "Content-Length: 18\r\n"
+    "\r\n"
+    "{\"points\":[1, 2]}\n";
+
 void http_request_constructor_url_decode(benchmark::State& state) {
   std::string tmp = "1";
   std::string input;
@@ -16,9 +34,56 @@ void http_request_constructor_url_decode(benchmark::State& state) {
   for (auto _ : state)
     benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+void http_request_constructor_url_decode_escaped(benchmark::State& state) {
+  std::string input;
+
+  for (int64_t i = 0; i < state.range(0); i++) input += "%D0%BF+";
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
+}
+
+// Parses a request with a query, typical headers, cookies and a body
+template <typename Parser>
+void http_request_constructor_typical_request(benchmark::State& state) {
+  const server::http::HandlerInfoIndex handler_info_index;
+  server::request::HttpRequestConfig request_config;
+  // Parse the args and cookies although there is no handler for the path
+  request_config.testing_mode = true;
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter data_accounter;
+
+  std::size_t requests = 0;
+  Parser parser(
+      handler_info_index, request_config,
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        benchmark::DoNotOptimize(request);
+        ++requests;
+      },
+      stats, data_accounter);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        parser.Parse(kTypicalRequest.data(), kTypicalRequest.size()));
+  }
+  if (requests != static_cast<std::size_t>(state.iterations())) {
+    state.SkipWithError("Failed to parse the request");
+  }
+}
+
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)
     ->RangeMultiplier(2)
     ->Range(1, 1024);
 
+BENCHMARK(http_request_constructor_url_decode_escaped)
+    ->RangeMultiplier(4)
+    ->Range(1, 256);
+
+BENCHMARK_TEMPLATE(http_request_constructor_typical_request,
+                   server::http::HttpRequestParser);
+BENCHMARK_TEMPLATE(http_request_constructor_typical_request,
+                   server::http::SimdHttpRequestParser);
+
 USERVER_NAMESPACE_END
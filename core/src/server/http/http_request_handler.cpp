@@ -145,7 +145,15 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
   }
   const auto& config = config_source_.GetSnapshot();
 
-  if (throttling_enabled && !rate_limit_.Obtain()) {
+  std::optional<congestion_control::TenantsLimiter::TenantId> tenant;
+  if (throttling_enabled && tenants_limiter_) {
+    tenant = tenants_limiter_->FindTenant(
+        http_request.GetHeader(tenants_limiter_->GetClientHeader()),
+        handler->HandlerName());
+  }
+
+  if (throttling_enabled &&
+      !(tenant ? tenants_limiter_->Obtain(*tenant) : rate_limit_.Obtain())) {
     auto config_var = config[kCcCustomStatus];
     const auto& delta = config_var.max_time_delta;
 
@@ -170,13 +178,18 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
            "limit via USERVER_RPS_CCONTROL and USERVER_RPS_CCONTROL_ENABLED), "
         << "limit=" << rate_limit_.GetRatePs() << "/sec, "
         << "url=" << http_request.GetUrl()
-        << ", status_code=" << static_cast<size_t>(status);
+        << ", status_code=" << static_cast<size_t>(status)
+        << (tenant ? ", tenant=" + tenants_limiter_->GetTenantName(*tenant)
+                   : std::string{});
 
     return StartFailsafeTask(std::move(request));
   }
 
-  if (handler->GetConfig().response_body_stream && config[kStreamApiEnabled]) {
-    http_response.SetStreamBody();
+  const auto& handler_config = handler->GetConfig();
+  if (handler_config.response_body_stream && config[kStreamApiEnabled]) {
+    http_response.SetStreamBody(
+        handler_config.response_body_stream_buffer_size.value_or(
+            HttpResponse::Queue::kUnbounded));
   }
 
   auto payload = [request = std::move(request), handler] {
@@ -252,6 +265,8 @@ void HttpRequestHandler::SetRpsRatelimit(std::optional<size_t> rps) {
     rate_limit_.SetMaxSize(1);  // in case it was zero
     rate_limit_.SetInstantRefillPolicy();
   }
+
+  if (tenants_limiter_) tenants_limiter_->SetRpsRatelimit(rps);
 }
 
 void HttpRequestHandler::SetRpsRatelimitStatusCode(HttpStatus status_code) {
@@ -259,6 +274,14 @@ void HttpRequestHandler::SetRpsRatelimitStatusCode(HttpStatus status_code) {
   cc_status_code_ = status_code;
 }
 
+void HttpRequestHandler::SetRpsRatelimitTenants(
+    USERVER_NAMESPACE::congestion_control::TenantsConfig config) {
+  UASSERT_MSG(!add_handler_disabled_,
+              "tenants must be set before the server start");
+  tenants_limiter_ =
+      std::make_unique<congestion_control::TenantsLimiter>(std::move(config));
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
+#include <server/congestion_control/tenants_limiter.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/mutex.hpp>
@@ -50,6 +52,10 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
+  /// Must be called before the server start
+  void SetRpsRatelimitTenants(
+      USERVER_NAMESPACE::congestion_control::TenantsConfig config);
+
  private:
   logging::LoggerPtr logger_access_;
   logging::LoggerPtr logger_access_tskv_;
@@ -65,6 +71,7 @@ class HttpRequestHandler final : public RequestHandlerBase {
   const std::string server_name_;
   NewRequestHook new_request_hook_;
   mutable utils::TokenBucket rate_limit_;
+  std::unique_ptr<congestion_control::TenantsLimiter> tenants_limiter_;
   std::atomic<HttpStatus> cc_status_code_{HttpStatus::kTooManyRequests};
   std::chrono::steady_clock::time_point cc_enabled_tp_;
   utils::statistics::MetricsStoragePtr metrics_;
@@ -6,6 +6,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
@@ -253,6 +254,13 @@ void HttpRequestImpl::ParseArgsFromBody() {
   USERVER_NAMESPACE::http::parser::ParseArgs(request_body_, request_args_);
 }
 
+RequestBodyStream& HttpRequestImpl::GetBodyStream() const {
+  UINVARIANT(body_stream_,
+             "The body is not streamed, the handler should have the "
+             "'request-body-stream' static option");
+  return *body_stream_;
+}
+
 bool HttpRequestImpl::IsBodyCompressed() const {
   const auto& encoding =
       GetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
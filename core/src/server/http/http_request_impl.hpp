@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -10,6 +11,7 @@
 
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
@@ -87,6 +89,8 @@ class HttpRequestImpl final : public request::RequestBase {
   const std::string& RequestBody() const { return request_body_; }
   void SetRequestBody(std::string body);
   void ParseArgsFromBody();
+  bool IsBodyStreamed() const { return body_stream_.has_value(); }
+  RequestBodyStream& GetBodyStream() const;
   void SetResponseStatus(HttpStatus status) const {
     response_.SetStatus(status);
   }
@@ -137,6 +141,7 @@ class HttpRequestImpl final : public request::RequestBase {
   std::string url_;
   std::string request_path_;
   std::string request_body_;
+  mutable std::optional<RequestBodyStream> body_stream_;
   std::string path_suffix_;
   std::unordered_map<std::string, std::vector<std::string>, utils::StrCaseHash>
       request_args_;
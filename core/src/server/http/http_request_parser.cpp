@@ -182,6 +182,11 @@ int HttpRequestParser::OnHeadersCompleteImpl(http_parser* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+
+  if (request_constructor_->IsBodyStreamed() && !p->upgrade) {
+    request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+    on_new_request_cb_(request_constructor_->FinalizeHead());
+  }
   return 0;
 }
 
@@ -206,6 +211,7 @@ int HttpRequestParser::OnMessageCompleteImpl(http_parser* p) {
     return -1;  // error
   }
   request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+  request_constructor_->SetBodyComplete();
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "message complete";
   if (!FinalizeRequest()) return -1;
@@ -245,9 +251,10 @@ bool HttpRequestParser::FinalizeRequest() {
 bool HttpRequestParser::FinalizeRequestImpl() {
   if (!request_constructor_) CreateRequestConstructor();
 
+  const bool is_head_finalized = request_constructor_->IsHeadFinalized();
   if (auto request = request_constructor_->Finalize()) {
     on_new_request_cb_(std::move(request));
-  } else {
+  } else if (!is_head_finalized) {
     LOG_ERROR() << "request is null after Finalize()";
     return false;
   }
@@ -16,7 +16,9 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/http_cached_date.hpp>
+#include <server/http/http_status_line.hpp>
 
 #include "http_request_impl.hpp"
 
@@ -33,6 +35,21 @@ const auto kDefaultContentTypeString =
 constexpr std::string_view kClose = "close";
 constexpr std::string_view kKeepAlive = "keep-alive";
 
+// The most common headers, preformatted to be appended with a single copy
+std::string MakeHeaderLine(std::string_view key, std::string_view value) {
+  std::string result;
+  result.append(key).append(kKeyValueHeaderSeparator).append(value);
+  result.append(kCrlf);
+  return result;
+}
+
+const std::string kDefaultContentTypeHeader = MakeHeaderLine(
+    http::headers::kContentType, kDefaultContentTypeString);
+const std::string kConnectionCloseHeader =
+    MakeHeaderLine(http::headers::kConnection, kClose);
+const std::string kConnectionKeepAliveHeader =
+    MakeHeaderLine(http::headers::kConnection, kKeepAlive);
+
 const std::string kHostname = hostinfo::blocking::GetRealHostName();
 
 void CheckHeaderName(std::string_view name) {
@@ -74,6 +91,24 @@ bool IsBodyForbiddenForStatus(server::http::HttpStatus status) {
 
 const std::string kEmptyString{};
 
+// RFC 7540 section 8.1.2.2, such headers make the HTTP/2 response malformed
+bool IsConnectionSpecificHeader(std::string_view name) {
+  const utils::StrIcaseEqual equal{};
+  return equal(name, USERVER_NAMESPACE::http::headers::kConnection) ||
+         equal(name, USERVER_NAMESPACE::http::headers::kTransferEncoding) ||
+         equal(name, "Keep-Alive") || equal(name, "Proxy-Connection") ||
+         equal(name, "Upgrade");
+}
+
+// HTTP/2 header names must be lowercase
+std::string ToHttp2HeaderName(std::string_view name) {
+  std::string result{name};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace server::http {
@@ -233,22 +268,86 @@ void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
 
 void HttpResponse::SendResponse(engine::io::Socket& socket) {
+  std::string header;
+  SendResponse(socket, header);
+}
+
+void HttpResponse::SendResponse(engine::io::Socket& socket,
+                                std::string& header) {
   // According to https://www.chromium.org/spdy/spdy-whitepaper/
   // "typical header sizes of 700-800 bytes is common"
   // Adjusting it to 1KiB to fit jemalloc size class
   static constexpr auto kTypicalHeadersSize = 1024;
 
-  // TODO : this could very well be small_vector<char> instead, or we could
-  // pass a string from connection and reuse it.
-  std::string header;
+  header.clear();
   header.reserve(kTypicalHeadersSize);
+  OutputHeaders(header);
 
-  header.append("HTTP/");
-  fmt::format_to(std::back_inserter(header), FMT_COMPILE("{}.{} {} "),
-                 request_.GetHttpMajor(), request_.GetHttpMinor(),
-                 static_cast<int>(status_));
-  header.append(HttpStatusString(status_));
-  header.append(kCrlf);
+  std::size_t sent_bytes{};
+
+  if (IsBodyStreamed() && GetData().empty()) {
+    sent_bytes = SetBodyStreamed(socket, header);
+  } else {
+    // e.g. a CustomHandlerException
+    sent_bytes = SetBodyNotStreamed(socket, header);
+  }
+
+  SetSent(sent_bytes, std::chrono::steady_clock::now());
+}
+
+void HttpResponse::SendResponses(engine::io::Socket& socket,
+                                 std::string& header_buffer,
+                                 const std::vector<HttpResponse*>& responses) {
+  UASSERT(!responses.empty());
+
+  // The headers of all the responses go one after another into
+  // `header_buffer`, the bodies are sent right from the responses
+  header_buffer.clear();
+  std::vector<std::size_t> header_ends;
+  std::vector<std::string_view> bodies;
+  header_ends.reserve(responses.size());
+  bodies.reserve(responses.size());
+  for (auto* response : responses) {
+    UASSERT(!response->IsBodyStreamed() || !response->GetData().empty());
+    response->OutputHeaders(header_buffer);
+    bodies.push_back(response->OutputNotStreamedHeadersEnd(header_buffer));
+    header_ends.push_back(header_buffer.size());
+  }
+
+  std::vector<engine::io::IoData> io_data;
+  io_data.reserve(responses.size() * 2);
+  std::size_t header_begin = 0;
+  for (std::size_t i = 0; i < responses.size(); ++i) {
+    io_data.push_back({header_buffer.data() + header_begin,
+                       header_ends[i] - header_begin});
+    if (!bodies[i].empty()) {
+      io_data.push_back({bodies[i].data(), bodies[i].size()});
+    }
+    header_begin = header_ends[i];
+  }
+
+  const auto sent_bytes =
+      socket.SendAll(io_data.data(), io_data.size(), engine::Deadline{});
+  const auto now = std::chrono::steady_clock::now();
+
+  // The peer may close the connection in the middle of the batch
+  std::size_t response_end = 0;
+  header_begin = 0;
+  for (std::size_t i = 0; i < responses.size(); ++i) {
+    const auto size = header_ends[i] - header_begin + bodies[i].size();
+    header_begin = header_ends[i];
+    response_end += size;
+    if (response_end <= sent_bytes) {
+      responses[i]->SetSent(size, now);
+    } else {
+      responses[i]->SetSendFailed(now);
+    }
+  }
+}
+
+void HttpResponse::OutputHeaders(std::string& header) {
+  impl::AppendStatusLine(header, request_.GetHttpMajor(),
+                         request_.GetHttpMinor(), status_);
 
   headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
   const auto end = headers_.end();
@@ -258,13 +357,12 @@ void HttpResponse::SendResponse(engine::io::Socket& socket) {
                        impl::GetCachedDate());
   }
   if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
-    impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentType,
-                       kDefaultContentTypeString);
+    header.append(kDefaultContentTypeHeader);
   }
   headers_.OutputInHttpFormat(header);
   if (headers_.find(USERVER_NAMESPACE::http::headers::kConnection) == end) {
-    impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kConnection,
-                       (request_.IsFinal() ? kClose : kKeepAlive));
+    header.append(request_.IsFinal() ? kConnectionCloseHeader
+                                     : kConnectionKeepAliveHeader);
   }
   for (const auto& cookie : cookies_) {
     header.append(USERVER_NAMESPACE::http::headers::kSetCookie);
@@ -272,21 +370,74 @@ void HttpResponse::SendResponse(engine::io::Socket& socket) {
     cookie.second.AppendToString(header);
     header.append(kCrlf);
   }
+}
 
-  std::size_t sent_bytes{};
+void HttpResponse::SendResponse(Http2Stream& stream) {
+  headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
+
+  Http2Stream::Headers headers;
+  headers.reserve(headers_.size() + cookies_.size() + 3);
+  const auto end = headers_.end();
+  if (headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
+    // impl::GetCachedDate() must not cross thread boundaries
+    headers.emplace_back("date", impl::GetCachedDate());
+  }
+  if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
+    headers.emplace_back("content-type", kDefaultContentTypeString);
+  }
+  for (const auto& [name, value] : headers_) {
+    if (IsConnectionSpecificHeader(name)) continue;
+    headers.emplace_back(ToHttp2HeaderName(name), value);
+  }
+  for (const auto& cookie : cookies_) {
+    std::string value;
+    cookie.second.AppendToString(value);
+    headers.emplace_back("set-cookie", std::move(value));
+  }
 
   if (IsBodyStreamed() && GetData().empty()) {
-    sent_bytes = SetBodyStreamed(socket, header);
+    stream.SubmitResponse(status_, std::move(headers), std::nullopt);
+
+    std::string body_part;
+    while (body_stream_->Pop(body_part)) {
+      if (body_part.empty()) continue;
+      stream.AppendData(std::move(body_part));
+    }
+    stream.FinishData();
+
+    body_stream_producer_.reset();
+    body_stream_.reset();
   } else {
-    // e.g. a CustomHandlerException
-    sent_bytes = SetBodyNotStreamed(socket, header);
+    const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+    const bool is_head_request = request_.GetOrigMethod() == HttpMethod::kHead;
+    const auto& data = GetData();
+
+    if (!is_body_forbidden) {
+      headers.emplace_back("content-length",
+                           fmt::format(FMT_COMPILE("{}"), data.size()));
+    } else if (!data.empty()) {
+      LOG_LIMITED_WARNING()
+          << "Non-empty body provided for response with HTTP code "
+          << static_cast<int>(status_)
+          << " which does not allow one, it will be dropped";
+    }
+
+    const bool has_body = !is_head_request && !is_body_forbidden;
+    stream.SubmitResponse(status_, std::move(headers),
+                          has_body ? std::string_view{data}
+                                   : std::string_view{});
   }
 
-  SetSent(sent_bytes, std::chrono::steady_clock::now());
+  // The stream reads the non-streamed body right from GetData() until closed
+  if (!stream.WaitClosed()) {
+    SetSendFailed(std::chrono::steady_clock::now());
+    return;
+  }
+  SetSent(stream.GetSentBytes(), std::chrono::steady_clock::now());
 }
 
-std::size_t HttpResponse::SetBodyNotStreamed(engine::io::Socket& socket,
-                                             std::string& header) {
+std::string_view HttpResponse::OutputNotStreamedHeadersEnd(
+    std::string& header) {
   const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
   const bool is_head_request = request_.GetOrigMethod() == HttpMethod::kHead;
   const auto& data = GetData();
@@ -304,10 +455,18 @@ std::size_t HttpResponse::SetBodyNotStreamed(engine::io::Socket& socket,
         << " which does not allow one, it will be dropped";
   }
 
+  if (is_head_request || is_body_forbidden) return {};
+  return data;
+}
+
+std::size_t HttpResponse::SetBodyNotStreamed(engine::io::Socket& socket,
+                                             std::string& header) {
+  const auto body = OutputNotStreamedHeadersEnd(header);
+
   ssize_t sent_bytes = 0;
-  if (!is_head_request && !is_body_forbidden) {
+  if (!body.empty()) {
     sent_bytes = socket.SendAll(
-        {{header.data(), header.size()}, {data.data(), data.size()}},
+        {{header.data(), header.size()}, {body.data(), body.size()}},
         engine::Deadline{});
   } else {
     sent_bytes =
@@ -324,7 +483,7 @@ std::size_t HttpResponse::SetBodyStreamed(engine::io::Socket& socket,
 
   // send HTTP headers
   size_t sent_bytes = socket.SendAll(header.data(), header.size(), {});
-  std::string{}.swap(header);  // free memory before time-consuming operation
+  header.clear();
 
   // Transmit HTTP response body
   std::string body_part;
@@ -364,10 +523,10 @@ void SetThrottleReason(http::HttpResponse& http_response,
   }
 }
 
-void HttpResponse::SetStreamBody() {
+void HttpResponse::SetStreamBody(std::size_t max_buffered_size) {
   UASSERT(!body_stream_);
 
-  const auto body_queue = Queue::Create();
+  const auto body_queue = Queue::Create(max_buffered_size);
   body_stream_.emplace(body_queue->GetConsumer());
   body_stream_producer_.emplace(body_queue->GetProducer());
 }
@@ -7,6 +7,8 @@
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
 
+#include <server/http/http_status_line.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -67,9 +69,44 @@ void http_headers_serialization_ostreams(benchmark::State& state) {
   }
 }
 
+const server::http::HttpStatus kStatuses[] = {
+    server::http::HttpStatus::kOk,
+    server::http::HttpStatus::kNotFound,
+    server::http::HttpStatus::kTooManyRequests,
+    server::http::HttpStatus::kInternalServerError,
+};
+
+void http_status_line_format(benchmark::State& state) {
+  std::string os;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    os.clear();
+    const auto status = kStatuses[i++ % std::size(kStatuses)];
+    os.append("HTTP/");
+    fmt::format_to(std::back_inserter(os), FMT_COMPILE("{}.{} {} "), 1, 1,
+                   static_cast<int>(status));
+    os.append(HttpStatusString(status));
+    os.append("\r\n");
+    benchmark::DoNotOptimize(os);
+  }
+}
+
+void http_status_line_precomputed(benchmark::State& state) {
+  std::string os;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    os.clear();
+    const auto status = kStatuses[i++ % std::size(kStatuses)];
+    server::http::impl::AppendStatusLine(os, 1, 1, status);
+    benchmark::DoNotOptimize(os);
+  }
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
+BENCHMARK(http_status_line_format);
+BENCHMARK(http_status_line_precomputed);
 
 USERVER_NAMESPACE_END
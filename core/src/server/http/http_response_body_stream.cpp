@@ -1,5 +1,9 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <compression/gzip.hpp>
+#include <server/http/response_compression.hpp>
+
+#include <userver/server/handlers/handler_config.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,11 +16,19 @@ ResponseBodyStream::ResponseBodyStream(
     : queue_producer_(std::move(queue_producer)),
       http_response_(http_response) {}
 
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) = default;
+
+ResponseBodyStream::~ResponseBodyStream() = default;
+
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk,
                                        engine::Deadline deadline) {
   UASSERT_MSG(headers_ended_,
               "SetEndOfHeaders() was not called before PushBodyChunk()");
-  const auto success = queue_producer_.Push(std::move(chunk), deadline);
+  if (compressor_) {
+    chunk = compressor_->Compress(chunk);
+    if (chunk.empty()) return;
+  }
+  const auto success = Push(std::move(chunk), deadline);
   UASSERT(success);
 }
 
@@ -31,6 +43,12 @@ void ResponseBodyStream::SetHeader(std::string_view name,
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+  if (compression_config_ && !headers_ended_ &&
+      IsCompressible(http_response_, *compression_config_)) {
+    compressor_ = std::make_unique<compression::gzip::StreamCompressor>(
+        compression_config_->level);
+    SetGzipContentEncoding(http_response_);
+  }
   headers_ended_ = true;
   http_response_.SetHeadersEnd();
 }
@@ -43,6 +61,35 @@ void ResponseBodyStream::SetStatusCode(HttpStatus status) {
   http_response_.SetStatus(status);
 }
 
+void ResponseBodyStream::EnableCompression(
+    const handlers::ResponseCompressionConfig& config) {
+  UASSERT_MSG(!headers_ended_, "Headers are already sent");
+  compression_config_ = &config;
+}
+
+void ResponseBodyStream::Finish(engine::Deadline deadline) {
+  if (!compressor_) return;
+  auto tail = compressor_->Finish();
+  compressor_.reset();
+  // The consumer is gone if the client has closed the connection
+  [[maybe_unused]] const auto success = Push(std::move(tail), deadline);
+}
+
+bool ResponseBodyStream::Push(std::string&& chunk, engine::Deadline deadline) {
+  // A chunk bigger than the buffer would never fit into it
+  const auto max_size = queue_producer_.Queue()->GetSoftMaxSize();
+  if (chunk.size() <= max_size) {
+    return queue_producer_.Push(std::move(chunk), deadline);
+  }
+
+  for (std::size_t pos = 0; pos < chunk.size(); pos += max_size) {
+    if (!queue_producer_.Push(chunk.substr(pos, max_size), deadline)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
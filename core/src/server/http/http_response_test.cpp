@@ -5,6 +5,7 @@
 #include <gmock/gmock.h>
 
 #include <server/http/http_request_impl.hpp>
+#include <server/http/http_status_line.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/internal/net/net_listener.hpp>
@@ -46,6 +47,42 @@ UTEST(HttpResponse, Smoke) {
             fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, SharedBody) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  response.SetData("copied");
+  const auto body = std::make_shared<const std::string>(10000, 'a');
+  response.SetSharedData(body);
+  EXPECT_TRUE(response.HasSharedData());
+  EXPECT_EQ(&response.GetData(), body.get());
+  response.SetStatus(server::http::HttpStatus::kOk);
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  std::string header_buffer;
+  auto send_task = engine::AsyncNoSpan(
+      [&header_buffer](auto&& response, auto&& socket) {
+        response.SendResponse(socket, header_buffer);
+      },
+      std::ref(response), std::move(server));
+
+  std::string buffer(2 * body->size(), '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+  buffer.resize(reply_size);
+  send_task.Get();
+
+  EXPECT_THAT(buffer, testing::StartsWith("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(buffer, testing::EndsWith(fmt::format("\r\n\r\n{}", *body)));
+  // The headers were built in the buffer, its memory is kept for reuse
+  EXPECT_GT(header_buffer.capacity(), 0);
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
   auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
   const server::http::HttpRequestImpl request{*accounter};
@@ -117,6 +154,28 @@ UTEST_P(HttpResponseBody, ForbiddenBody) {
 INSTANTIATE_UTEST_SUITE_P(HttpResponseForbiddenBody, HttpResponseBody,
                           testing::Values(100, 101, 150, 199, 304, 204));
 
+TEST(HttpResponse, StatusLine) {
+  std::string header = "prefix ";
+  server::http::impl::AppendStatusLine(header, 1, 1,
+                                       server::http::HttpStatus::kOk);
+  EXPECT_EQ(header, "prefix HTTP/1.1 200 OK\r\n");
+
+  header.clear();
+  server::http::impl::AppendStatusLine(header, 1, 0,
+                                       server::http::HttpStatus::kNotFound);
+  EXPECT_EQ(header, "HTTP/1.0 404 Not Found\r\n");
+
+  // Not precomputed
+  header.clear();
+  server::http::impl::AppendStatusLine(header, 2, 0,
+                                       server::http::HttpStatus::kOk);
+  EXPECT_EQ(header, "HTTP/2.0 200 OK\r\n");
+  header.clear();
+  server::http::impl::AppendStatusLine(
+      header, 1, 1, static_cast<server::http::HttpStatus>(600));
+  EXPECT_EQ(header, "HTTP/1.1 600 Unknown status (600)\r\n");
+}
+
 TEST(HttpResponse, GetHeaderDoesntThrow) {
   server::request::ResponseDataAccounter accounter{};
   const server::http::HttpRequestImpl request_impl{accounter};
@@ -0,0 +1,60 @@
+#include <server/http/http_status_line.hpp>
+
+#include <array>
+#include <iterator>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+constexpr int kMinStatus = 100;
+constexpr int kMaxStatus = 599;
+constexpr int kStatuses = kMaxStatus - kMinStatus + 1;
+constexpr int kMinorVersions = 2;  // HTTP/1.0 and HTTP/1.1
+
+constexpr std::size_t Index(int http_minor, int status) {
+  return http_minor * kStatuses + status - kMinStatus;
+}
+
+void FormatStatusLine(std::string& header, int http_major, int http_minor,
+                      HttpStatus status) {
+  fmt::format_to(std::back_inserter(header),
+                 FMT_COMPILE("HTTP/{}.{} {} {}\r\n"), http_major, http_minor,
+                 static_cast<int>(status), HttpStatusString(status));
+}
+
+using StatusLines = std::array<std::string, kMinorVersions * kStatuses>;
+
+const StatusLines kStatusLines = [] {
+  StatusLines lines;
+  for (int minor = 0; minor < kMinorVersions; ++minor) {
+    for (int status = kMinStatus; status <= kMaxStatus; ++status) {
+      auto& line = lines[Index(minor, status)];
+      FormatStatusLine(line, 1, minor, static_cast<HttpStatus>(status));
+      line.shrink_to_fit();
+    }
+  }
+  return lines;
+}();
+
+}  // namespace
+
+void AppendStatusLine(std::string& header, int http_major, int http_minor,
+                      HttpStatus status) {
+  const auto code = static_cast<int>(status);
+  if (http_major != 1 || http_minor < 0 || http_minor >= kMinorVersions ||
+      code < kMinStatus || code > kMaxStatus) {
+    FormatStatusLine(header, http_major, http_minor, status);
+    return;
+  }
+  header.append(kStatusLines[Index(http_minor, code)]);
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
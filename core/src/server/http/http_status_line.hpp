@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include <userver/server/http/http_status.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief Appends the HTTP/1.x status line, e.g. "HTTP/1.1 200 OK\r\n".
+///
+/// The lines of HTTP/1.0 and HTTP/1.1 for the statuses 100-599 are
+/// precomputed, others are formatted on each call.
+void AppendStatusLine(std::string& header, int http_major, int http_minor,
+                      HttpStatus status);
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
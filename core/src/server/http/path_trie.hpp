@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Values of the `{name}` segments of the matched path, in the order of the
+/// pattern. Views into the path passed to PathTrie::Match.
+using PathWildcardValues = boost::container::small_vector<std::string_view, 8>;
+
+struct PathTrieMatch final {
+  const PathWildcardValues& wildcards;
+
+  /// Position of the path part matched by the trailing `*`, npos if the
+  /// pattern has no such suffix
+  std::size_t suffix_begin{std::string_view::npos};
+};
+
+/// @brief Segment trie of the handler path patterns
+///
+/// Patterns are split by '/', the `{name}` segments match any single segment
+/// and a trailing `*` segment matches any non-empty remainder of the path.
+/// Matching walks the path once, without allocations, trying a fixed segment
+/// before a wildcard one and a wildcard before the `*` suffix at each level.
+template <typename Value>
+class PathTrie final {
+ public:
+  /// @returns the value of the pattern, default constructed for a new one
+  Value& operator[](std::string_view pattern);
+
+  /// @brief Calls `accept(value, match)` for the patterns matching the path,
+  /// most specific first, until it returns true.
+  /// @returns true if some `accept` call returned true
+  template <typename Accept>
+  bool Match(std::string_view path, const Accept& accept) const;
+
+ private:
+  struct Node final {
+    utils::impl::TransparentMap<std::string, std::unique_ptr<Node>> fixed;
+    std::unique_ptr<Node> wildcard;
+    std::optional<Value> value;
+    std::optional<Value> suffix_value;
+  };
+
+  template <typename Accept>
+  static bool MatchFrom(const Node& node, std::string_view path,
+                        std::size_t begin, PathWildcardValues& wildcards,
+                        const Accept& accept);
+
+  Node root_;
+};
+
+template <typename Value>
+Value& PathTrie<Value>::operator[](std::string_view pattern) {
+  Node* node = &root_;
+  std::size_t begin = 0;
+  while (true) {
+    const auto end = pattern.find('/', begin);
+    const auto segment = pattern.substr(begin, end - begin);
+    if (end == std::string_view::npos && segment == "*") {
+      if (!node->suffix_value) node->suffix_value.emplace();
+      return *node->suffix_value;
+    }
+
+    std::unique_ptr<Node>* next = nullptr;
+    if (!segment.empty() && segment.front() == '{' && segment.back() == '}') {
+      next = &node->wildcard;
+    } else {
+      next = &node->fixed[std::string{segment}];
+    }
+    if (!*next) *next = std::make_unique<Node>();
+    node = next->get();
+
+    if (end == std::string_view::npos) break;
+    begin = end + 1;
+  }
+
+  if (!node->value) node->value.emplace();
+  return *node->value;
+}
+
+template <typename Value>
+template <typename Accept>
+bool PathTrie<Value>::Match(std::string_view path,
+                            const Accept& accept) const {
+  PathWildcardValues wildcards;
+  return MatchFrom(root_, path, 0, wildcards, accept);
+}
+
+template <typename Value>
+template <typename Accept>
+bool PathTrie<Value>::MatchFrom(const Node& node, std::string_view path,
+                                std::size_t begin,
+                                PathWildcardValues& wildcards,
+                                const Accept& accept) {
+  if (begin == std::string_view::npos) {
+    return node.value && accept(*node.value, PathTrieMatch{wildcards});
+  }
+
+  const auto end = path.find('/', begin);
+  const auto segment = path.substr(begin, end - begin);
+  const auto next = end == std::string_view::npos ? end : end + 1;
+
+  const auto* fixed =
+      utils::impl::FindTransparentOrNullptr(node.fixed, segment);
+  if (fixed && MatchFrom(**fixed, path, next, wildcards, accept)) return true;
+
+  if (node.wildcard) {
+    wildcards.push_back(segment);
+    if (MatchFrom(*node.wildcard, path, next, wildcards, accept)) return true;
+    wildcards.pop_back();
+  }
+
+  return node.suffix_value &&
+         accept(*node.suffix_value, PathTrieMatch{wildcards, begin});
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
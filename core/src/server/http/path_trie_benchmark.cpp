@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+using server::http::impl::PathTrieMatch;
+
+// Resembles the routes of an API gateway: the handlers of several services
+// with an equal number of fixed and parameterized paths
+PathTrie<std::size_t> MakeGatewayTrie(std::size_t services) {
+  PathTrie<std::size_t> trie;
+  std::size_t id = 0;
+  for (std::size_t i = 0; i < services; ++i) {
+    trie[fmt::format("/service{}/v1/ping", i)] = id++;
+    trie[fmt::format("/service{}/v1/items", i)] = id++;
+    trie[fmt::format("/service{}/v1/items/{{id}}", i)] = id++;
+    trie[fmt::format("/service{}/v1/items/{{id}}/history", i)] = id++;
+    trie[fmt::format("/service{}/v2/{{kind}}/{{id}}/info", i)] = id++;
+    trie[fmt::format("/service{}/static/*", i)] = id++;
+  }
+  return trie;
+}
+
+void path_trie_match(benchmark::State& state) {
+  const auto services = static_cast<std::size_t>(state.range(0));
+  const auto trie = MakeGatewayTrie(services);
+
+  std::vector<std::string> paths;
+  for (std::size_t i = 0; i < services; i += 7) {
+    paths.push_back(fmt::format("/service{}/v1/items", i));
+    paths.push_back(fmt::format("/service{}/v1/items/42/history", i));
+    paths.push_back(fmt::format("/service{}/v2/orders/42/info", i));
+    paths.push_back(fmt::format("/service{}/static/css/site.css", i));
+  }
+
+  std::size_t path_index = 0;
+  for (auto _ : state) {
+    const auto& path = paths[path_index++ % paths.size()];
+    const bool matched =
+        trie.Match(path, [](std::size_t id, const PathTrieMatch& match) {
+          benchmark::DoNotOptimize(id);
+          benchmark::DoNotOptimize(match.wildcards.size());
+          return true;
+        });
+    if (!matched) state.SkipWithError("Failed to match the path");
+  }
+}
+
+}  // namespace
+
+BENCHMARK(path_trie_match)->RangeMultiplier(4)->Range(4, 64);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+using server::http::impl::PathTrieMatch;
+
+struct MatchResult {
+  std::string pattern;
+  std::vector<std::string> wildcards;
+  std::string suffix;
+};
+
+class TestTrie final {
+ public:
+  void Add(const std::string& pattern) { trie_[pattern] = pattern; }
+
+  std::optional<MatchResult> Match(std::string_view path) const {
+    std::optional<MatchResult> result;
+    trie_.Match(path, [&](const std::string& pattern,
+                          const PathTrieMatch& match) {
+      result.emplace();
+      result->pattern = pattern;
+      result->wildcards.assign(match.wildcards.begin(), match.wildcards.end());
+      if (match.suffix_begin != std::string_view::npos) {
+        result->suffix = path.substr(match.suffix_begin);
+      }
+      return true;
+    });
+    return result;
+  }
+
+ private:
+  PathTrie<std::string> trie_;
+};
+
+}  // namespace
+
+TEST(PathTrie, Fixed) {
+  TestTrie trie;
+  trie.Add("/v1/orders");
+  trie.Add("/v1/orders/");
+
+  EXPECT_EQ(trie.Match("/v1/orders")->pattern, "/v1/orders");
+  EXPECT_EQ(trie.Match("/v1/orders/")->pattern, "/v1/orders/");
+  EXPECT_FALSE(trie.Match("/v1/order"));
+  EXPECT_FALSE(trie.Match("/v1/orders/x"));
+  EXPECT_FALSE(trie.Match(""));
+}
+
+TEST(PathTrie, Wildcards) {
+  TestTrie trie;
+  trie.Add("/v1/orders/{id}");
+  trie.Add("/v1/{kind}/{id}/items");
+
+  auto result = trie.Match("/v1/orders/42");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/v1/orders/{id}");
+  EXPECT_EQ(result->wildcards, std::vector<std::string>{"42"});
+
+  result = trie.Match("/v1/users/7/items");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/v1/{kind}/{id}/items");
+  EXPECT_EQ(result->wildcards, (std::vector<std::string>{"users", "7"}));
+
+  result = trie.Match("/v1/orders/");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->wildcards, std::vector<std::string>{""});
+
+  EXPECT_FALSE(trie.Match("/v1/users/7"));
+}
+
+TEST(PathTrie, FixedSegmentsArePreferred) {
+  TestTrie trie;
+  trie.Add("/{a}/b");
+  trie.Add("/a/{b}");
+  trie.Add("/{a}/{b}");
+
+  EXPECT_EQ(trie.Match("/a/b")->pattern, "/a/{b}");
+  EXPECT_EQ(trie.Match("/c/b")->pattern, "/{a}/b");
+  EXPECT_EQ(trie.Match("/c/d")->pattern, "/{a}/{b}");
+}
+
+TEST(PathTrie, Backtracking) {
+  TestTrie trie;
+  trie.Add("/a/b/c");
+  trie.Add("/a/{x}/d");
+
+  const auto result = trie.Match("/a/b/d");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/a/{x}/d");
+  EXPECT_EQ(result->wildcards, std::vector<std::string>{"b"});
+}
+
+TEST(PathTrie, AnySuffix) {
+  TestTrie trie;
+  trie.Add("/static/*");
+  trie.Add("/static/{dir}/*");
+  trie.Add("/static/{dir}/index");
+
+  EXPECT_FALSE(trie.Match("/static"));
+
+  auto result = trie.Match("/static/");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/static/*");
+  EXPECT_EQ(result->suffix, "");
+
+  result = trie.Match("/static/css/index");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/static/{dir}/index");
+
+  result = trie.Match("/static/css/main/site.css");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/static/{dir}/*");
+  EXPECT_EQ(result->wildcards, std::vector<std::string>{"css"});
+  EXPECT_EQ(result->suffix, "main/site.css");
+
+  result = trie.Match("/static/favicon.ico");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->pattern, "/static/*");
+  EXPECT_TRUE(result->wildcards.empty());
+  EXPECT_EQ(result->suffix, "favicon.ico");
+}
+
+TEST(PathTrie, RejectedCandidates) {
+  PathTrie<int> trie;
+  trie["/a/b"] = 1;
+  trie["/a/{x}"] = 2;
+  trie["/a/*"] = 3;
+
+  std::vector<int> candidates;
+  EXPECT_FALSE(trie.Match("/a/b", [&](int value, const PathTrieMatch&) {
+    candidates.push_back(value);
+    return false;
+  }));
+  EXPECT_EQ(candidates, (std::vector<int>{1, 2, 3}));
+}
+
+USERVER_NAMESPACE_END
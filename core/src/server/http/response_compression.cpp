@@ -0,0 +1,110 @@
+#include <server/http/response_compression.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+std::string_view TrimView(std::string_view value) {
+  while (!value.empty() && utils::text::IsAsciiSpace(value.front())) {
+    value.remove_prefix(1);
+  }
+  while (!value.empty() && utils::text::IsAsciiSpace(value.back())) {
+    value.remove_suffix(1);
+  }
+  return value;
+}
+
+// Returns false for "q=0", "q=0.0" and so on, RFC 9110 section 12.4.2
+bool IsAcceptableWeight(std::string_view params) {
+  while (!params.empty()) {
+    const auto pos = params.find(';');
+    const auto param = TrimView(params.substr(0, pos));
+    params = (pos == std::string_view::npos) ? std::string_view{}
+                                             : params.substr(pos + 1);
+
+    if (param.size() < 2 || (param[0] != 'q' && param[0] != 'Q') ||
+        param[1] != '=') {
+      continue;
+    }
+    const auto weight = param.substr(2);
+    return !weight.empty() &&
+           std::any_of(weight.begin(), weight.end(),
+                       [](char c) { return c >= '1' && c <= '9'; });
+  }
+  return true;
+}
+
+}  // namespace
+
+bool IsGzipAccepted(std::string_view accept_encoding) {
+  const utils::StrIcaseEqual equal;
+  std::optional<bool> gzip;
+  bool any = false;
+
+  while (!accept_encoding.empty()) {
+    const auto pos = accept_encoding.find(',');
+    const auto element = accept_encoding.substr(0, pos);
+    accept_encoding = (pos == std::string_view::npos)
+                          ? std::string_view{}
+                          : accept_encoding.substr(pos + 1);
+
+    const auto params_pos = element.find(';');
+    const auto coding = TrimView(element.substr(0, params_pos));
+    const auto params = (params_pos == std::string_view::npos)
+                            ? std::string_view{}
+                            : element.substr(params_pos + 1);
+
+    if (equal(coding, "gzip") || equal(coding, "x-gzip")) {
+      gzip = IsAcceptableWeight(params);
+    } else if (coding == "*") {
+      any = IsAcceptableWeight(params);
+    }
+  }
+
+  return gzip.value_or(any);
+}
+
+bool IsCompressible(const HttpResponse& response,
+                    const handlers::ResponseCompressionConfig& config) {
+  const auto status = static_cast<int>(response.GetStatus());
+  if (status < 200 || status == 204 || status == 206 || status == 304) {
+    return false;
+  }
+  if (response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+    return false;
+  }
+  if (config.content_types.empty()) return true;
+
+  std::string_view content_type =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
+  content_type = TrimView(content_type.substr(0, content_type.find(';')));
+  const utils::StrIcaseEqual equal;
+  return std::any_of(
+      config.content_types.begin(), config.content_types.end(),
+      [&](const std::string& allowed) { return equal(allowed, content_type); });
+}
+
+void SetGzipContentEncoding(HttpResponse& response) {
+  response.SetContentEncoding("gzip");
+
+  std::string vary =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+  if (vary == "*") return;
+  if (!vary.empty()) vary += ", ";
+  vary += USERVER_NAMESPACE::http::headers::kAcceptEncoding;
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::move(vary));
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// Returns whether the `Accept-Encoding` request header value allows gzip
+bool IsGzipAccepted(std::string_view accept_encoding);
+
+/// Returns whether the response with the headers and status already set may be
+/// compressed. Does not account for the body size.
+bool IsCompressible(const HttpResponse& response,
+                    const handlers::ResponseCompressionConfig& config);
+
+/// Sets `Content-Encoding: gzip` and adds `Accept-Encoding` to `Vary`
+void SetGzipContentEncoding(HttpResponse& response);
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
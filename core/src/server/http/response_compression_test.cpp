@@ -0,0 +1,26 @@
+#include <server/http/response_compression.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(ResponseCompression, IsGzipAccepted) {
+  using server::http::IsGzipAccepted;
+
+  EXPECT_TRUE(IsGzipAccepted("gzip"));
+  EXPECT_TRUE(IsGzipAccepted("deflate, GZIP"));
+  EXPECT_TRUE(IsGzipAccepted("br;q=1.0, gzip;q=0.8, *;q=0.1"));
+  EXPECT_TRUE(IsGzipAccepted("x-gzip"));
+  EXPECT_TRUE(IsGzipAccepted("*"));
+  EXPECT_TRUE(IsGzipAccepted("gzip; q=0.001"));
+
+  EXPECT_FALSE(IsGzipAccepted(""));
+  EXPECT_FALSE(IsGzipAccepted("identity"));
+  EXPECT_FALSE(IsGzipAccepted("br, deflate"));
+  EXPECT_FALSE(IsGzipAccepted("gzip;q=0"));
+  EXPECT_FALSE(IsGzipAccepted("gzip;q=0.000, *"));
+  EXPECT_FALSE(IsGzipAccepted("*;q=0"));
+  EXPECT_FALSE(IsGzipAccepted("gzipped"));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,491 @@
+#include "simd_http_request_parser.hpp"
+
+#include <charconv>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// Same as the default HTTP_MAX_HEADER_SIZE of http_parser
+constexpr std::size_t kMaxHeadSize = 80 * 1024;
+
+constexpr std::string_view kUpgradeHeader = "Upgrade";
+
+constexpr bool IsControlChar(char c) noexcept {
+  const auto byte = static_cast<unsigned char>(c);
+  return (byte < 0x20 && c != '\t') || byte == 0x7f;
+}
+
+// Returns the first control character other than HT in [begin, end), or `end`.
+// CR and LF end the lines, other control characters are not allowed in the
+// request head.
+const char* FindControlChar(const char* begin, const char* end) noexcept {
+#if defined(__AVX2__)
+  const auto max_ctl = _mm256_set1_epi8(0x1f);
+  const auto tab = _mm256_set1_epi8('\t');
+  const auto del = _mm256_set1_epi8(0x7f);
+  for (; end - begin >= 32; begin += 32) {
+    const auto block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    const auto is_ctl =
+        _mm256_cmpeq_epi8(_mm256_max_epu8(block, max_ctl), max_ctl);
+    const auto is_bad = _mm256_or_si256(
+        _mm256_andnot_si256(_mm256_cmpeq_epi8(block, tab), is_ctl),
+        _mm256_cmpeq_epi8(block, del));
+    const auto mask =
+        static_cast<std::uint32_t>(_mm256_movemask_epi8(is_bad));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+#endif
+#if defined(__SSE2__)
+  const auto max_ctl16 = _mm_set1_epi8(0x1f);
+  const auto tab16 = _mm_set1_epi8('\t');
+  const auto del16 = _mm_set1_epi8(0x7f);
+  for (; end - begin >= 16; begin += 16) {
+    const auto block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    const auto is_ctl =
+        _mm_cmpeq_epi8(_mm_max_epu8(block, max_ctl16), max_ctl16);
+    const auto is_bad =
+        _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi8(block, tab16), is_ctl),
+                     _mm_cmpeq_epi8(block, del16));
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(is_bad));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const auto max_ctl = vdupq_n_u8(0x1f);
+  const auto tab = vdupq_n_u8('\t');
+  const auto del = vdupq_n_u8(0x7f);
+  for (; end - begin >= 16; begin += 16) {
+    const auto block = vld1q_u8(reinterpret_cast<const std::uint8_t*>(begin));
+    const auto is_bad = vorrq_u8(
+        vbicq_u8(vcleq_u8(block, max_ctl), vceqq_u8(block, tab)),
+        vceqq_u8(block, del));
+    // There is no movemask on NEON, the scalar loop finds the position
+    if (vmaxvq_u8(is_bad) != 0) break;
+  }
+#endif
+  for (; begin != end; ++begin) {
+    if (IsControlChar(*begin)) return begin;
+  }
+  return end;
+}
+
+std::string_view TrimWhitespace(std::string_view value) noexcept {
+  const auto begin = value.find_first_not_of(" \t");
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(" \t");
+  return value.substr(begin, end - begin + 1);
+}
+
+std::optional<HttpMethod> ParseMethod(std::string_view method) noexcept {
+  if (method == "GET") return HttpMethod::kGet;
+  if (method == "POST") return HttpMethod::kPost;
+  if (method == "PUT") return HttpMethod::kPut;
+  if (method == "DELETE") return HttpMethod::kDelete;
+  if (method == "HEAD") return HttpMethod::kHead;
+  if (method == "PATCH") return HttpMethod::kPatch;
+  if (method == "OPTIONS") return HttpMethod::kOptions;
+  if (method == "CONNECT") return HttpMethod::kConnect;
+
+  if (method.empty()) return std::nullopt;
+  for (const char c : method) {
+    if (c < 'A' || c > 'Z') return std::nullopt;
+  }
+  return HttpMethod::kUnknown;
+}
+
+bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+}  // namespace
+
+SimdHttpRequestParser::SimdHttpRequestParser(
+    const HandlerInfoIndex& handler_info_index,
+    const request::HttpRequestConfig& request_config,
+    OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
+    request::ResponseDataAccounter& data_accounter)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter) {}
+
+bool SimdHttpRequestParser::Parse(const char* data, size_t size) {
+  std::string_view input{data, size};
+  while (!input.empty()) {
+    if (state_ == State::kBody || state_ == State::kChunkData) {
+      if (!ProcessBody(input)) return false;
+      continue;
+    }
+
+    std::string_view line;
+    const auto status = TakeLine(input, line);
+    if (status == LineStatus::kIncomplete) break;
+    if (status == LineStatus::kError) {
+      return Fail("malformed or too large request head");
+    }
+
+    const bool is_processed = ProcessLine(line);
+    partial_line_.clear();
+    if (!is_processed) return false;
+  }
+  return true;
+}
+
+SimdHttpRequestParser::LineStatus SimdHttpRequestParser::TakeLine(
+    std::string_view& input, std::string_view& line) {
+  UASSERT(!input.empty());
+
+  // The previous chunk of data ended right after CR
+  if (!partial_line_.empty() && partial_line_.back() == '\r') {
+    if (input.front() != '\n') return LineStatus::kError;
+    partial_line_.pop_back();
+    line = partial_line_;
+    input.remove_prefix(1);
+    ++head_size_;
+    return LineStatus::kComplete;
+  }
+
+  const char* const begin = input.data();
+  const char* const end = begin + input.size();
+  const char* const line_end = FindControlChar(begin, end);
+
+  std::size_t eol_size = 1;
+  if (line_end == end || (*line_end == '\r' && line_end + 1 == end)) {
+    head_size_ += input.size();
+    if (head_size_ > kMaxHeadSize) return LineStatus::kError;
+    partial_line_.append(begin, end);
+    input = {};
+    return LineStatus::kIncomplete;
+  }
+  if (*line_end == '\r') {
+    if (line_end[1] != '\n') return LineStatus::kError;
+    eol_size = 2;
+  } else if (*line_end != '\n') {
+    return LineStatus::kError;
+  }
+
+  const auto consumed = static_cast<std::size_t>(line_end - begin) + eol_size;
+  head_size_ += consumed;
+  if (head_size_ > kMaxHeadSize) return LineStatus::kError;
+
+  if (partial_line_.empty()) {
+    line = std::string_view(begin, line_end - begin);
+  } else {
+    partial_line_.append(begin, line_end);
+    line = partial_line_;
+  }
+  input.remove_prefix(consumed);
+  return LineStatus::kComplete;
+}
+
+bool SimdHttpRequestParser::ProcessLine(std::string_view line) {
+  switch (state_) {
+    case State::kRequestLine:
+      // RFC 7230 section 3.5, empty lines before the request line are ignored
+      if (line.empty()) {
+        head_size_ = 0;
+        return true;
+      }
+      return ProcessRequestLine(line);
+    case State::kHeaders:
+      if (line.empty()) return ProcessHeaders();
+      return ProcessHeaderLine(line);
+    case State::kChunkSize:
+      return ProcessChunkSizeLine(line);
+    case State::kChunkDataEnd:
+      if (!line.empty()) return Fail("no CRLF after the chunk data");
+      state_ = State::kChunkSize;
+      head_size_ = 0;
+      return true;
+    case State::kTrailers:
+      // The trailers are not merged into the headers, as http_parser does
+      if (line.empty()) return CompleteMessage();
+      return true;
+    case State::kBody:
+    case State::kChunkData:
+      break;
+  }
+  UASSERT_MSG(false, "The body is not processed by lines");
+  return false;
+}
+
+bool SimdHttpRequestParser::ProcessRequestLine(std::string_view line) {
+  CreateRequestConstructor();
+
+  const auto method_end = line.find(' ');
+  const auto url_end = line.rfind(' ');
+  if (method_end == std::string_view::npos || url_end == method_end) {
+    return Fail("malformed request line");
+  }
+  const auto url = line.substr(method_end + 1, url_end - method_end - 1);
+  const auto version = line.substr(url_end + 1);
+
+  const auto method = ParseMethod(line.substr(0, method_end));
+  if (!method) return Fail("bad method");
+  if (url.empty() || url.find(' ') != std::string_view::npos) {
+    return Fail("bad url");
+  }
+  if (version.size() != 8 || version.substr(0, 5) != "HTTP/" ||
+      !IsDigit(version[5]) || version[6] != '.' || !IsDigit(version[7])) {
+    return Fail("bad http version");
+  }
+
+  method_ = *method;
+  http_major_ = version[5] - '0';
+  http_minor_ = version[7] - '0';
+
+  request_constructor_->SetMethod(method_);
+  request_constructor_->SetHttpMajor(http_major_);
+  request_constructor_->SetHttpMinor(http_minor_);
+  try {
+    request_constructor_->AppendUrl(url.data(), url.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append url: " << ex;
+    return Fail("bad url");
+  }
+  try {
+    request_constructor_->ParseUrl();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse url: " << ex;
+    return Fail("bad url");
+  }
+
+  state_ = State::kHeaders;
+  return true;
+}
+
+bool SimdHttpRequestParser::ProcessHeaderLine(std::string_view line) {
+  UASSERT(request_constructor_);
+  if (line.front() == ' ' || line.front() == '\t') {
+    return Fail("obsolete line folding");
+  }
+
+  const auto colon = line.find(':');
+  if (colon == 0 || colon == std::string_view::npos) {
+    return Fail("malformed header line");
+  }
+  const auto name = line.substr(0, colon);
+  if (name.find_first_of(" \t") != std::string_view::npos) {
+    return Fail("whitespace in header name");
+  }
+  const auto value = TrimWhitespace(line.substr(colon + 1));
+
+  try {
+    request_constructor_->AppendHeaderField(name.data(), name.size());
+    request_constructor_->AppendHeaderValue(value.data(), value.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append header: " << ex;
+    return Fail("bad header");
+  }
+  return ProcessFramingHeader(name, value);
+}
+
+bool SimdHttpRequestParser::ProcessFramingHeader(std::string_view name,
+                                                 std::string_view value) {
+  const utils::StrIcaseEqual equal;
+
+  if (equal(name, USERVER_NAMESPACE::http::headers::kContentLength)) {
+    std::uint64_t content_length = 0;
+    const auto* const end = value.data() + value.size();
+    const auto [ptr, ec] = std::from_chars(value.data(), end, content_length);
+    if (value.empty() || ec != std::errc{} || ptr != end) {
+      return Fail("bad Content-Length");
+    }
+    if (content_length_ && *content_length_ != content_length) {
+      return Fail("conflicting Content-Length headers");
+    }
+    content_length_ = content_length;
+  } else if (equal(name, USERVER_NAMESPACE::http::headers::kTransferEncoding)) {
+    // Only the last transfer coding defines the framing
+    const auto last_coding_begin = value.rfind(',');
+    const auto last_coding = TrimWhitespace(
+        last_coding_begin == std::string_view::npos
+            ? value
+            : value.substr(last_coding_begin + 1));
+    has_transfer_encoding_ = true;
+    is_chunked_ = equal(last_coding, "chunked");
+  } else if (equal(name, USERVER_NAMESPACE::http::headers::kConnection)) {
+    while (!value.empty()) {
+      const auto token_end = value.find(',');
+      const auto token = TrimWhitespace(value.substr(0, token_end));
+      if (equal(token, "close")) {
+        connection_close_ = true;
+      } else if (equal(token, "keep-alive")) {
+        connection_keep_alive_ = true;
+      } else if (equal(token, "upgrade")) {
+        connection_upgrade_ = true;
+      }
+      if (token_end == std::string_view::npos) break;
+      value.remove_prefix(token_end + 1);
+    }
+  } else if (equal(name, kUpgradeHeader)) {
+    has_upgrade_header_ = true;
+  }
+  return true;
+}
+
+bool SimdHttpRequestParser::ProcessHeaders() {
+  UASSERT(request_constructor_);
+  try {
+    request_constructor_->AppendHeaderField("", 0);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append header value: " << ex;
+    return Fail("bad header");
+  }
+
+  if (method_ == HttpMethod::kConnect ||
+      (has_upgrade_header_ && connection_upgrade_)) {
+    return Fail("upgrade detected");
+  }
+
+  // RFC 7230 section 3.3.3, such requests may be a smuggling attempt
+  if (has_transfer_encoding_ && content_length_) {
+    return Fail("both Content-Length and Transfer-Encoding are set");
+  }
+  if (has_transfer_encoding_ && !is_chunked_) {
+    return Fail("the last transfer coding is not chunked");
+  }
+
+  if (request_constructor_->IsBodyStreamed()) {
+    request_constructor_->SetIsFinal(!IsKeepAlive());
+    on_new_request_cb_(request_constructor_->FinalizeHead());
+  }
+
+  head_size_ = 0;
+  if (has_transfer_encoding_) {
+    state_ = State::kChunkSize;
+    return true;
+  }
+
+  body_remaining_ = content_length_.value_or(0);
+  if (body_remaining_ == 0) return CompleteMessage();
+  state_ = State::kBody;
+  return true;
+}
+
+bool SimdHttpRequestParser::ProcessChunkSizeLine(std::string_view line) {
+  // Chunk extensions are ignored
+  const auto size_str = line.substr(0, line.find_first_of("; \t"));
+  std::uint64_t chunk_size = 0;
+  const auto* const end = size_str.data() + size_str.size();
+  const auto [ptr, ec] =
+      std::from_chars(size_str.data(), end, chunk_size, /*base=*/16);
+  if (size_str.empty() || ec != std::errc{} || ptr != end) {
+    return Fail("bad chunk size");
+  }
+
+  head_size_ = 0;
+  if (chunk_size == 0) {
+    state_ = State::kTrailers;
+  } else {
+    body_remaining_ = chunk_size;
+    state_ = State::kChunkData;
+  }
+  return true;
+}
+
+bool SimdHttpRequestParser::ProcessBody(std::string_view& input) {
+  UASSERT(request_constructor_);
+  UASSERT(body_remaining_ > 0);
+  const auto size = static_cast<std::size_t>(
+      std::min<std::uint64_t>(body_remaining_, input.size()));
+  try {
+    request_constructor_->AppendBody(input.data(), size);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append body: " << ex;
+    return Fail("bad body");
+  }
+  input.remove_prefix(size);
+  body_remaining_ -= size;
+  if (body_remaining_ != 0) return true;
+
+  if (state_ == State::kChunkData) {
+    state_ = State::kChunkDataEnd;
+    return true;
+  }
+  return CompleteMessage();
+}
+
+bool SimdHttpRequestParser::CompleteMessage() {
+  UASSERT(request_constructor_);
+  request_constructor_->SetIsFinal(!IsKeepAlive());
+  request_constructor_->SetBodyComplete();
+  LOG_TRACE() << "message complete";
+
+  state_ = State::kRequestLine;
+  head_size_ = 0;
+  if (!FinalizeRequest()) return Fail("can't finalize the request");
+  return true;
+}
+
+bool SimdHttpRequestParser::IsKeepAlive() const {
+  // Same as http_should_keep_alive()
+  return (http_major_ > 0 && http_minor_ > 0) ? !connection_close_
+                                              : connection_keep_alive_;
+}
+
+bool SimdHttpRequestParser::Fail(std::string_view reason) {
+  LOG_WARNING() << "can't parse the request: " << reason;
+  FinalizeRequest();
+  return false;
+}
+
+void SimdHttpRequestParser::CreateRequestConstructor() {
+  ++stats_.parsing_request_count;
+  request_constructor_.emplace(request_constructor_config_, handler_info_index_,
+                               data_accounter_);
+
+  method_ = HttpMethod::kUnknown;
+  http_major_ = 0;
+  http_minor_ = 0;
+  content_length_.reset();
+  body_remaining_ = 0;
+  is_chunked_ = false;
+  has_transfer_encoding_ = false;
+  has_upgrade_header_ = false;
+  connection_close_ = false;
+  connection_keep_alive_ = false;
+  connection_upgrade_ = false;
+}
+
+bool SimdHttpRequestParser::FinalizeRequest() {
+  bool res = FinalizeRequestImpl();
+  --stats_.parsing_request_count;
+  request_constructor_.reset();
+  return res;
+}
+
+bool SimdHttpRequestParser::FinalizeRequestImpl() {
+  if (!request_constructor_) CreateRequestConstructor();
+
+  const bool is_head_finalized = request_constructor_->IsHeadFinalized();
+  if (auto request = request_constructor_->Finalize()) {
+    on_new_request_cb_(std::move(request));
+  } else if (!is_head_finalized) {
+    LOG_ERROR() << "request is null after Finalize()";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief HTTP/1.x request parser that scans the request head with SIMD
+/// instructions (AVX2, SSE2 or NEON, whatever the build targets).
+///
+/// Unlike the byte-at-a-time state machine of http_parser, the request line
+/// and the header lines are found by a vectorized search of the first control
+/// character, which is either the end of the line or an error. Complete lines
+/// are processed in place, only a line split between the received chunks is
+/// buffered. Bodies of a known length and chunked bodies are supported, the
+/// chunk extensions and the trailers are skipped; obsolete line folding is
+/// rejected.
+class SimdHttpRequestParser final : public request::RequestParser {
+ public:
+  using OnNewRequestCb =
+      std::function<void(std::shared_ptr<request::RequestBase>&&)>;
+
+  SimdHttpRequestParser(const HandlerInfoIndex& handler_info_index,
+                        const request::HttpRequestConfig& request_config,
+                        OnNewRequestCb&& on_new_request_cb,
+                        net::ParserStats& stats,
+                        request::ResponseDataAccounter& data_accounter);
+
+  SimdHttpRequestParser(SimdHttpRequestParser&&) = delete;
+  SimdHttpRequestParser& operator=(SimdHttpRequestParser&&) = delete;
+
+  bool Parse(const char* data, size_t size) override;
+
+ private:
+  enum class State {
+    kRequestLine,
+    kHeaders,
+    kBody,
+    kChunkSize,
+    kChunkData,
+    kChunkDataEnd,
+    kTrailers,
+  };
+
+  enum class LineStatus { kComplete, kIncomplete, kError };
+
+  // Cuts the next line off the `input`, the line does not include CRLF
+  LineStatus TakeLine(std::string_view& input, std::string_view& line);
+
+  bool ProcessLine(std::string_view line);
+  bool ProcessRequestLine(std::string_view line);
+  bool ProcessHeaderLine(std::string_view line);
+  bool ProcessFramingHeader(std::string_view name, std::string_view value);
+  bool ProcessHeaders();
+  bool ProcessChunkSizeLine(std::string_view line);
+  bool ProcessBody(std::string_view& input);
+
+  bool IsKeepAlive() const;
+  bool CompleteMessage();
+  bool Fail(std::string_view reason);
+
+  void CreateRequestConstructor();
+  bool FinalizeRequest();
+  bool FinalizeRequestImpl();
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+
+  OnNewRequestCb on_new_request_cb_;
+
+  State state_{State::kRequestLine};
+  std::string partial_line_;
+  // Size of the request head, or of the chunk size line, or of the trailers
+  std::size_t head_size_{0};
+  std::optional<HttpRequestConstructor> request_constructor_;
+
+  // Framing and connection state of the current request
+  HttpMethod method_{HttpMethod::kUnknown};
+  unsigned short http_major_{0};
+  unsigned short http_minor_{0};
+  std::optional<std::uint64_t> content_length_;
+  std::uint64_t body_remaining_{0};
+  bool is_chunked_{false};
+  bool has_transfer_encoding_{false};
+  bool has_upgrade_header_{false};
+  bool connection_close_{false};
+  bool connection_keep_alive_{false};
+  bool connection_upgrade_{false};
+
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
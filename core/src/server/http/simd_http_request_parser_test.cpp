@@ -0,0 +1,234 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+
+#include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
+
+#include "create_parser_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpMethod = server::http::HttpMethod;
+using HttpStatus = server::http::HttpStatus;
+
+struct ParsedRequest {
+  HttpMethod orig_method{HttpMethod::kUnknown};
+  std::string url;
+  std::string path;
+  std::string body;
+  std::size_t header_count{0};
+  std::string host;
+  bool is_final{false};
+  HttpStatus status{HttpStatus::kOk};
+};
+
+struct ParseResult {
+  bool is_ok{true};
+  std::vector<ParsedRequest> requests;
+};
+
+constexpr std::size_t kWhole = std::string_view::npos;
+
+// Feeds the `data` to the parser by chunks of `chunk_size` bytes
+template <typename Parser>
+ParseResult Parse(std::string_view data, std::size_t chunk_size = kWhole) {
+  ParseResult result;
+  auto parser = server::CreateTestParser<Parser>(
+      [&result](std::shared_ptr<server::request::RequestBase>&& request) {
+        const auto& impl =
+            dynamic_cast<server::http::HttpRequestImpl&>(*request);
+        result.requests.push_back(ParsedRequest{
+            impl.GetOrigMethod(), impl.GetUrl(), impl.GetRequestPath(),
+            impl.RequestBody(), impl.HeaderCount(), impl.GetHeader("Host"),
+            impl.IsFinal(), impl.GetHttpResponse().GetStatus()});
+      });
+
+  while (!data.empty() && result.is_ok) {
+    const auto chunk = data.substr(0, chunk_size);
+    result.is_ok = parser.Parse(chunk.data(), chunk.size());
+    data.remove_prefix(chunk.size());
+  }
+  return result;
+}
+
+constexpr std::string_view kTypicalRequest =
+    "POST /v1/orders/estimate?zone=moscow&lang=ru HTTP/1.1\r\n"
+    "Host: orders.example.com:8080\r\n"
+    "User-Agent: userver/2.0 (Linux; x86_64)\r\n"
+    "Accept-Encoding: gzip, identity\r\n"
+    "X-YaRequestId:5f0c3e9b1a2d4c6e8f0a1b3c5d7e9f1a  \r\n"
+    "Content-Length: 18\r\n"
+    "\r\n"
+    "{\"points\":[1, 2]}\n";
+
+template <typename Parser>
+class HttpRequestParsers : public ::testing::Test {};
+
+using ParserTypes = ::testing::Types<server::http::HttpRequestParser,
+                                     server::http::SimdHttpRequestParser>;
+
+}  // namespace
+
+TYPED_UTEST_SUITE(HttpRequestParsers, ParserTypes);
+
+TYPED_UTEST(HttpRequestParsers, TypicalRequest) {
+  for (const auto chunk_size : {kWhole, std::size_t{1}, std::size_t{7}}) {
+    const auto result = Parse<TypeParam>(kTypicalRequest, chunk_size);
+    ASSERT_TRUE(result.is_ok) << "chunk_size=" << chunk_size;
+    ASSERT_EQ(result.requests.size(), 1);
+
+    const auto& request = result.requests.front();
+    EXPECT_EQ(request.orig_method, HttpMethod::kPost);
+    EXPECT_EQ(request.url, "/v1/orders/estimate?zone=moscow&lang=ru");
+    EXPECT_EQ(request.path, "/v1/orders/estimate");
+    EXPECT_EQ(request.body, "{\"points\":[1, 2]}\n");
+    EXPECT_EQ(request.header_count, 5);
+    EXPECT_EQ(request.host, "orders.example.com:8080");
+    EXPECT_FALSE(request.is_final);
+    EXPECT_EQ(request.status, HttpStatus::kOk);
+  }
+}
+
+TYPED_UTEST(HttpRequestParsers, Pipelined) {
+  const std::string data = std::string{kTypicalRequest} +
+                           "GET /ping HTTP/1.1\r\nHost: a\r\n\r\n" +
+                           std::string{kTypicalRequest};
+  for (const auto chunk_size : {kWhole, std::size_t{1}, std::size_t{13}}) {
+    const auto result = Parse<TypeParam>(data, chunk_size);
+    ASSERT_TRUE(result.is_ok);
+    ASSERT_EQ(result.requests.size(), 3);
+    EXPECT_EQ(result.requests[1].orig_method, HttpMethod::kGet);
+    EXPECT_EQ(result.requests[1].path, "/ping");
+    EXPECT_EQ(result.requests[1].host, "a");
+    EXPECT_EQ(result.requests[2].body, result.requests[0].body);
+  }
+}
+
+TYPED_UTEST(HttpRequestParsers, ChunkedBody) {
+  constexpr std::string_view kRequest =
+      "PUT /upload HTTP/1.1\r\n"
+      "Transfer-Encoding: chunked\r\n"
+      "\r\n"
+      "5\r\nhello\r\n"
+      "1;name=value\r\n \r\n"
+      "A\r\n0123456789\r\n"
+      "0\r\n"
+      "\r\n";
+  for (const auto chunk_size : {kWhole, std::size_t{1}, std::size_t{5}}) {
+    const auto result = Parse<TypeParam>(kRequest, chunk_size);
+    ASSERT_TRUE(result.is_ok);
+    ASSERT_EQ(result.requests.size(), 1);
+    EXPECT_EQ(result.requests[0].body, "hello 0123456789");
+  }
+}
+
+TYPED_UTEST(HttpRequestParsers, KeepAlive) {
+  const auto is_final = [](std::string_view request) {
+    const auto result = Parse<TypeParam>(request);
+    EXPECT_TRUE(result.is_ok);
+    EXPECT_EQ(result.requests.size(), 1);
+    return !result.requests.empty() && result.requests.front().is_final;
+  };
+
+  EXPECT_FALSE(is_final("GET / HTTP/1.1\r\n\r\n"));
+  EXPECT_TRUE(is_final("GET / HTTP/1.1\r\nConnection: close\r\n\r\n"));
+  EXPECT_TRUE(is_final("GET / HTTP/1.0\r\n\r\n"));
+  EXPECT_FALSE(is_final("GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n"));
+}
+
+TYPED_UTEST(HttpRequestParsers, BadRequests) {
+  const std::vector<std::string> requests{
+      "GET / HTTP/1.1\r\nX-Header: a\001b\r\n\r\n",
+      "GET / HTTP/1.1\r\nX-Header: a\rb\r\n\r\n",
+      "GET / HTTP/1.1\r\nX-Header : value\r\n\r\n",
+      "GET / HTTP/1.1\r\nX-Header\r\n\r\n",
+      "GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n",
+      "GET / HTTP/1.1\r\nContent-Length: 1\r\n"
+      "Transfer-Encoding: chunked\r\n\r\n",
+      "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nz\r\n",
+      "GET / HTTP/1.1\r\nConnection: upgrade\r\nUpgrade: websocket\r\n\r\n",
+      "GET /a b HTTP/1.1\r\n\r\n",
+      "GET / HTTX/1.1\r\n\r\n",
+      "get / HTTP/1.1\r\n\r\n",
+  };
+  for (const auto& request : requests) {
+    const auto result = Parse<TypeParam>(request);
+    EXPECT_FALSE(result.is_ok) << request;
+    // The request is passed on anyway, to respond and to close the connection
+    EXPECT_EQ(result.requests.size(), 1) << request;
+  }
+}
+
+TYPED_UTEST(HttpRequestParsers, ControlCharAtAnyPosition) {
+  // Checks all the positions within and between the SIMD blocks
+  for (std::size_t position = 0; position < 100; ++position) {
+    std::string value(100, 'v');
+    value[position] = '\x7f';
+    const auto request = "GET / HTTP/1.1\r\nX-Header: " + value + "\r\n\r\n";
+    EXPECT_FALSE(Parse<TypeParam>(request).is_ok) << "position=" << position;
+  }
+
+  const auto request =
+      "GET / HTTP/1.1\r\nX-Header: " + std::string(100, 'v') + "\t\r\n\r\n";
+  EXPECT_TRUE(Parse<TypeParam>(request).is_ok);
+}
+
+TYPED_UTEST(HttpRequestParsers, TooLargeBody) {
+  const auto request = "POST / HTTP/1.1\r\nContent-Length: 2000000\r\n\r\n" +
+                       std::string(2000000, 'b');
+  const auto result = Parse<TypeParam>(request, 32 * 1024);
+  EXPECT_FALSE(result.is_ok);
+  ASSERT_EQ(result.requests.size(), 1);
+  EXPECT_EQ(result.requests.front().status, HttpStatus::kPayloadTooLarge);
+}
+
+UTEST(SimdHttpRequestParser, LineEndings) {
+  using server::http::SimdHttpRequestParser;
+
+  // Bare LF is tolerated, as well as the empty lines before the request
+  auto result = Parse<SimdHttpRequestParser>(
+      "\r\n\nGET /a HTTP/1.1\nHost: b\n\nGET /c HTTP/1.1\r\n\r\n");
+  ASSERT_TRUE(result.is_ok);
+  ASSERT_EQ(result.requests.size(), 2);
+  EXPECT_EQ(result.requests[0].path, "/a");
+  EXPECT_EQ(result.requests[0].host, "b");
+  EXPECT_EQ(result.requests[1].path, "/c");
+
+  // CR is the last byte of a chunk
+  result = Parse<SimdHttpRequestParser>("GET /d HTTP/1.1\r\n\r\n", 16);
+  ASSERT_TRUE(result.is_ok);
+  ASSERT_EQ(result.requests.size(), 1);
+  EXPECT_EQ(result.requests[0].path, "/d");
+
+  result = Parse<SimdHttpRequestParser>("GET /d HTTP/1.1\r");
+  EXPECT_TRUE(result.is_ok);
+  EXPECT_TRUE(result.requests.empty());
+
+  result = Parse<SimdHttpRequestParser>("GET /d HTTP/1.1\rX\r\n\r\n", 16);
+  EXPECT_FALSE(result.is_ok);
+}
+
+UTEST(SimdHttpRequestParser, ObsoleteLineFolding) {
+  const auto result = Parse<server::http::SimdHttpRequestParser>(
+      "GET / HTTP/1.1\r\nX-Header: a\r\n b\r\n\r\n");
+  EXPECT_FALSE(result.is_ok);
+}
+
+UTEST(SimdHttpRequestParser, TooLargeHead) {
+  const auto request =
+      "GET / HTTP/1.1\r\nX-Header: " + std::string(100 * 1024, 'v');
+  const auto result =
+      Parse<server::http::SimdHttpRequestParser>(request, 4 * 1024);
+  EXPECT_FALSE(result.is_ok);
+  EXPECT_EQ(result.requests.size(), 1);
+}
+
+USERVER_NAMESPACE_END
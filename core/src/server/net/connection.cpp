@@ -2,12 +2,16 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
 #include <stdexcept>
+#include <string_view>
 #include <system_error>
 #include <vector>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
+#include <server/http/simd_http_request_parser.hpp>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/exception.hpp>
@@ -15,6 +19,7 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_config.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/scope_guard.hpp>
@@ -23,6 +28,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+// Responses with huge headers should not pin the memory of the connection
+constexpr std::size_t kMaxHeaderBufferCapacity = 16 * 1024;
+
+// Max count of the pipelined responses to send with a single write. Each
+// response takes up to 2 iovecs, the limit must be below IOV_MAX.
+constexpr std::size_t kMaxResponsesBatchSize = 64;
+
+}  // namespace
+
 std::shared_ptr<Connection> Connection::Create(
     engine::TaskProcessor& task_processor, const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -50,7 +66,8 @@ Connection::Connection(
       stats_(std::move(stats)),
       data_accounter_(data_accounter),
       remote_address_(peer_socket_.Getpeername().PrimaryAddressString()),
-      request_tasks_(Queue::Create()) {
+      request_tasks_(Queue::Create(
+          std::max<std::size_t>(config_.requests_queue_size_threshold, 1))) {
   LOG_DEBUG() << "Incoming connection from " << peer_socket_.Getpeername()
               << ", fd " << Fd();
 
@@ -129,8 +146,6 @@ bool Connection::IsRequestTasksEmpty() const noexcept {
 }
 
 void Connection::ListenForRequests(Queue::Producer producer) noexcept {
-  using RequestBasePtr = std::shared_ptr<request::RequestBase>;
-
   utils::ScopeGuard send_stopper([this]() {
     // do not request cancel unless we're sure it's in valid state
     // this task can only normally be cancelled from response sender
@@ -140,16 +155,12 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
   });
 
   try {
-    request_tasks_->SetSoftMaxSize(config_.requests_queue_size_threshold);
-
-    http::HttpRequestParser request_parser(
-        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
-        [this, &producer](RequestBasePtr&& request_ptr) {
-          if (!NewRequest(std::move(request_ptr), producer)) {
-            is_accepting_requests_ = false;
-          }
-        },
-        stats_->parser_stats, data_accounter_);
+    // Declared after the parser, so that the tasks of an HTTP/2 session are
+    // cancelled and awaited before the session is destroyed
+    std::unique_ptr<request::RequestParser> request_parser;
+    concurrent::BackgroundTaskStorageCore http2_tasks;
+    request_parser = MakeRequestParser({}, producer, http2_tasks);
+    std::string protocol_detection_data;
 
     std::vector<char> buf(config_.in_buffer_size);
     std::size_t last_bytes_read = 0;
@@ -190,7 +201,20 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
       LOG_TRACE() << "Received " << last_bytes_read << " byte(s) from "
                   << peer_socket_.Getpeername() << " on fd " << Fd();
 
-      if (!request_parser.Parse(buf.data(), last_bytes_read)) {
+      bool is_parsed = false;
+      if (!request_parser) {
+        protocol_detection_data.append(buf.data(), last_bytes_read);
+        request_parser = MakeRequestParser(protocol_detection_data, producer,
+                                           http2_tasks);
+        if (!request_parser) continue;
+
+        const auto data = std::move(protocol_detection_data);
+        is_parsed = request_parser->Parse(data.data(), data.size());
+      } else {
+        is_parsed = request_parser->Parse(buf.data(), last_bytes_read);
+      }
+
+      if (!is_parsed) {
         LOG_DEBUG() << "Malformed request from " << peer_socket_.Getpeername()
                     << " on fd " << Fd();
 
@@ -223,6 +247,88 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
   }
 }
 
+std::unique_ptr<request::RequestParser> Connection::MakeRequestParser(
+    std::string_view data, Queue::Producer& producer,
+    concurrent::BackgroundTaskStorageCore& http2_tasks) {
+  using RequestBasePtr = std::shared_ptr<request::RequestBase>;
+
+  if (config_.http2_enabled) {
+    // h2c with prior knowledge, RFC 7540 section 3.4. No HTTP/1.x request
+    // starts with "PRI ".
+    constexpr auto kPreface = http::Http2Session::kClientPreface;
+    constexpr std::size_t kDetectionSize = 4;
+
+    const auto size = std::min(data.size(), kPreface.size());
+    const bool is_http2 = data.substr(0, size) == kPreface.substr(0, size);
+    if (is_http2 && data.size() < kDetectionSize) return nullptr;
+
+    if (is_http2) {
+      LOG_TRACE() << "HTTP/2 connection on fd " << Fd();
+      auto session = std::make_unique<http::Http2Session>(
+          request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+          [this, &http2_tasks](RequestBasePtr&& request_ptr,
+                               std::shared_ptr<http::Http2Stream> stream) {
+            NewHttp2Request(std::move(request_ptr), std::move(stream),
+                            http2_tasks);
+          },
+          stats_->parser_stats, data_accounter_,
+          config_.http2_max_concurrent_streams);
+
+      // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+      http2_tasks.Detach(engine::CriticalAsyncNoSpan(
+          task_processor_, [this, &session = *session]() noexcept {
+            try {
+              session.RunWriter(peer_socket_);
+            } catch (const engine::io::IoCancelled&) {
+              LOG_TRACE() << "engine::io::IoCancelled thrown in RunWriter()";
+            } catch (const std::exception& ex) {
+              LOG_WARNING() << "Error while sending to peer "
+                            << peer_socket_.Getpeername() << " on fd " << Fd()
+                            << ": " << ex;
+            }
+          }));
+      return session;
+    }
+  }
+
+  auto on_new_request_cb = [this, &producer](RequestBasePtr&& request_ptr) {
+    if (!NewRequest(std::move(request_ptr), producer)) {
+      is_accepting_requests_ = false;
+    }
+  };
+  if (config_.request_parser == RequestParserType::kSimd) {
+    return std::make_unique<http::SimdHttpRequestParser>(
+        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+        std::move(on_new_request_cb), stats_->parser_stats, data_accounter_);
+  }
+  return std::make_unique<http::HttpRequestParser>(
+      request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+      std::move(on_new_request_cb), stats_->parser_stats, data_accounter_);
+}
+
+void Connection::NewHttp2Request(
+    std::shared_ptr<request::RequestBase>&& request_ptr,
+    std::shared_ptr<http::Http2Stream> stream,
+    concurrent::BackgroundTaskStorageCore& http2_tasks) {
+  ++stats_->active_request_count;
+  auto task = request_handler_.StartRequestTask(request_ptr);
+
+  // Unlike HTTP/1.1 pipelining, the responses are sent as soon as they are
+  // ready. Each stream task always starts, so the accounting of
+  // SendResponse() is always done.
+  // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+  http2_tasks.Detach(engine::CriticalAsyncNoSpan(
+      task_processor_,
+      [this](QueueItem item, std::shared_ptr<http::Http2Stream> stream) {
+        HandleQueueItem(item);
+
+        // Cancellation is not blocked: the stream is closed by the session
+        // writer, which is cancelled together with the stream tasks
+        SendResponse(*item.first, stream.get());
+      },
+      QueueItem{std::move(request_ptr), std::move(task)}, std::move(stream)));
+}
+
 bool Connection::NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                             Queue::Producer& producer) {
   if (!is_accepting_requests_) {
@@ -243,20 +349,47 @@ bool Connection::NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
 }
 
 void Connection::ProcessResponses(Queue::Consumer& consumer) noexcept {
+  const auto is_handled_buffered = [](const QueueItem& item) {
+    return item.second.IsValid() && item.second.IsFinished() &&
+           !item.first->GetResponse().IsBodyStreamed();
+  };
+
   try {
     QueueItem item;
-    while (consumer.Pop(item)) {
+    std::vector<QueueItem> batch;
+    bool has_item = consumer.Pop(item);
+    while (has_item) {
       HandleQueueItem(item);
+      has_item = false;
 
       // now we must complete processing
       engine::TaskCancellationBlocker block_cancel;
 
-      /* In stream case we don't want a user task to exit
-       * until SendResponse() as the task produces body chunks.
-       */
-      SendResponse(*item.first);
-      item.first.reset();
-      item.second = {};
+      if (!item.first->GetResponse().IsBodyStreamed()) {
+        // The pipelined requests are handled concurrently. The responses that
+        // are ready by now are sent along with this one in a single write.
+        batch.push_back(std::move(item));
+        while (batch.size() < kMaxResponsesBatchSize &&
+               consumer.PopNoblock(item)) {
+          if (!is_handled_buffered(item)) {
+            has_item = true;
+            break;
+          }
+          HandleQueueItem(item);
+          batch.push_back(std::move(item));
+        }
+        SendResponses(batch);
+        batch.clear();
+      } else {
+        /* In stream case we don't want a user task to exit
+         * until SendResponse() as the task produces body chunks.
+         */
+        SendResponse(*item.first);
+        item.first.reset();
+        item.second = {};
+      }
+
+      if (!has_item) has_item = consumer.Pop(item);
     }
   } catch (const std::exception& e) {
     LOG_ERROR() << "Exception for fd " << Fd() << ": " << e;
@@ -301,14 +434,24 @@ void Connection::HandleQueueItem(QueueItem& item) noexcept {
   }
 }
 
-void Connection::SendResponse(request::RequestBase& request) {
+void Connection::SendResponse(request::RequestBase& request,
+                              http::Http2Stream* stream) {
   auto& response = request.GetResponse();
   UASSERT(!response.IsSent());
   request.SetStartSendResponseTime();
   if (is_response_chain_valid_ && peer_socket_) {
     try {
       // Might be a stream reading or a fully constructed response
-      response.SendResponse(peer_socket_);
+      // Only HTTP requests are parsed from the connection
+      auto& http_response = static_cast<http::HttpResponse&>(response);
+      if (stream) {
+        http_response.SendResponse(*stream);
+      } else {
+        http_response.SendResponse(peer_socket_, response_header_buffer_);
+        if (response_header_buffer_.capacity() > kMaxHeaderBufferCapacity) {
+          std::string{}.swap(response_header_buffer_);
+        }
+      }
     } catch (const engine::io::IoSystemError& ex) {
       // working with raw values because std::errc compares error_category
       // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
@@ -325,6 +468,49 @@ void Connection::SendResponse(request::RequestBase& request) {
   } else {
     response.SetSendFailed(std::chrono::steady_clock::now());
   }
+  FinishResponse(request);
+}
+
+void Connection::SendResponses(std::vector<QueueItem>& batch) {
+  UASSERT(!batch.empty());
+  if (batch.size() == 1) {
+    SendResponse(*batch.front().first);
+    return;
+  }
+
+  std::vector<http::HttpResponse*> responses;
+  responses.reserve(batch.size());
+  for (auto& [request, task] : batch) {
+    UASSERT(!request->GetResponse().IsSent());
+    request->SetStartSendResponseTime();
+    // Only HTTP requests are parsed from the connection
+    responses.push_back(
+        static_cast<http::HttpResponse*>(&request->GetResponse()));
+  }
+
+  if (is_response_chain_valid_ && peer_socket_) {
+    try {
+      http::HttpResponse::SendResponses(peer_socket_, response_header_buffer_,
+                                        responses);
+      if (response_header_buffer_.capacity() > kMaxHeaderBufferCapacity) {
+        std::string{}.swap(response_header_buffer_);
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Error while sending pipelined responses: " << ex;
+      const auto now = std::chrono::steady_clock::now();
+      for (auto* response : responses) {
+        if (!response->IsSent()) response->SetSendFailed(now);
+      }
+    }
+  } else {
+    const auto now = std::chrono::steady_clock::now();
+    for (auto* response : responses) response->SetSendFailed(now);
+  }
+
+  for (auto& [request, task] : batch) FinishResponse(*request);
+}
+
+void Connection::FinishResponse(request::RequestBase& request) {
   request.SetFinishSendResponseTime();
   --stats_->active_request_count;
   ++stats_->requests_processed_count;
@@ -1,15 +1,18 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <concurrent/impl/spsc_ring_queue.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 
-#include <userver/concurrent/queue.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task.hpp>
@@ -20,6 +23,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace server::http {
+class Http2Stream;
+}  // namespace server::http
+
 namespace server::net {
 
 class Connection final : public std::enable_shared_from_this<Connection> {
@@ -58,7 +65,7 @@ class Connection final : public std::enable_shared_from_this<Connection> {
  private:
   using QueueItem = std::pair<std::shared_ptr<request::RequestBase>,
                               engine::TaskWithResult<void>>;
-  using Queue = concurrent::SpscQueue<QueueItem>;
+  using Queue = concurrent::impl::SpscRingQueue<QueueItem>;
 
   void Shutdown() noexcept;
 
@@ -68,9 +75,23 @@ class Connection final : public std::enable_shared_from_this<Connection> {
   bool NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                   Queue::Producer&);
 
+  // Detects the protocol of the connection from its first bytes
+  std::unique_ptr<request::RequestParser> MakeRequestParser(
+      std::string_view data, Queue::Producer& producer,
+      concurrent::BackgroundTaskStorageCore& http2_tasks);
+  void NewHttp2Request(std::shared_ptr<request::RequestBase>&& request_ptr,
+                       std::shared_ptr<http::Http2Stream> stream,
+                       concurrent::BackgroundTaskStorageCore& http2_tasks);
+
   void ProcessResponses(Queue::Consumer&) noexcept;
   void HandleQueueItem(QueueItem& item) noexcept;
-  void SendResponse(request::RequestBase& request);
+  // Sends into the HTTP/2 `stream` if it is not null
+  void SendResponse(request::RequestBase& request,
+                    http::Http2Stream* stream = nullptr);
+  // Sends the handled non-streamed responses of pipelined requests
+  void SendResponses(std::vector<QueueItem>& batch);
+  // Accounts the response that was sent or failed to be sent
+  void FinishResponse(request::RequestBase& request);
 
   engine::TaskProcessor& task_processor_;
   const ConnectionConfig& config_;
@@ -87,7 +108,11 @@ class Connection final : public std::enable_shared_from_this<Connection> {
   engine::Task response_sender_task_;
 
   bool is_accepting_requests_{true};
-  bool is_response_chain_valid_{true};
+  // Reused by the HTTP/1.x responses, that are sent one by one
+  std::string response_header_buffer_;
+
+  // Written by the concurrent stream tasks of an HTTP/2 connection
+  std::atomic<bool> is_response_chain_valid_{true};
   CloseCb close_cb_;
 };
 
@@ -1,11 +1,23 @@
 #include <server/net/connection_config.hpp>
 
+#include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+RequestParserType Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<RequestParserType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(RequestParserType::kHttpParser, "http-parser")
+        .Case(RequestParserType::kSimd, "simd");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ConnectionConfig>) {
   ConnectionConfig config;
@@ -18,6 +30,12 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
   config.keepalive_timeout =
       value["keepalive_timeout"].As<std::chrono::seconds>(
           config.keepalive_timeout);
+  config.http2_enabled = value["http2_enabled"].As<bool>(config.http2_enabled);
+  config.http2_max_concurrent_streams =
+      value["http2_max_concurrent_streams"].As<std::uint32_t>(
+          config.http2_max_concurrent_streams);
+  config.request_parser =
+      value["request_parser"].As<RequestParserType>(config.request_parser);
 
   return config;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -9,10 +11,23 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+enum class RequestParserType {
+  /// Byte-at-a-time state machine of the http_parser library
+  kHttpParser,
+  /// SIMD scan of the request head, see http::SimdHttpRequestParser
+  kSimd,
+};
+
+RequestParserType Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<RequestParserType>);
+
 struct ConnectionConfig {
   size_t in_buffer_size = 32 * 1024;
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
+  bool http2_enabled = false;
+  std::uint32_t http2_max_concurrent_streams = 100;
+  RequestParserType request_parser = RequestParserType::kHttpParser;
 };
 
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
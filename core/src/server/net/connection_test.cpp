@@ -1,7 +1,12 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+#include <vector>
+
 #include <fmt/format.h>
 
+#include <netinet/in.h>
+
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/http/request_handler_base.hpp>
@@ -92,6 +97,16 @@ clients::http::ResponseFuture CreateRequest(
   return ret.async_perform();
 }
 
+clients::http::ResponseFuture CreateHttp2Request(
+    clients::http::Client& http_client, engine::io::Socket& request_socket) {
+  return http_client.CreateRequest()
+      .get(HttpConnectionUriFromSocket(request_socket))
+      .http_version(clients::http::HttpVersion::k2PriorKnowledge)
+      .retry(1)
+      .timeout(utest::kMaxTestWaitTime)
+      .async_perform();
+}
+
 net::ListenerConfig CreateConfig() {
   net::ListenerConfig config;
   config.handler_defaults = server::request::HttpRequestConfig{};
@@ -282,6 +297,107 @@ UTEST(ServerNetConnection, KeepAlive) {
   EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST(ServerNetConnection, Pipelining) {
+  constexpr std::size_t kPipelinedRequests = 100;
+  net::ListenerConfig config = CreateConfig();
+  auto request_socket = net::CreateSocket(config);
+
+  engine::io::Sockaddr addr;
+  auto* sa = addr.As<sockaddr_in6>();
+  sa->sin6_family = AF_INET6;
+  sa->sin6_addr = in6addr_loopback;
+  // NOLINTNEXTLINE(hicpp-no-assembler,readability-isolate-declaration)
+  sa->sin6_port = htons(request_socket.Getsockname().Port());
+
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, deadline);
+
+  std::string requests;
+  for (std::size_t i = 0; i + 1 < kPipelinedRequests; ++i) {
+    requests += fmt::format("GET /{} HTTP/1.1\r\nHost: localhost\r\n\r\n", i);
+  }
+  requests +=
+      "GET /last HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+  ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline),
+            requests.size());
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto connection_ptr = net::Connection::Create(
+      engine::current_task::GetTaskProcessor(), config.connection_config,
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+  connection_ptr->Start();
+
+  // The server closes the connection after the response to the last request
+  std::string responses;
+  std::array<char, 4096> buf{};
+  while (const auto size = client.RecvSome(buf.data(), buf.size(), deadline)) {
+    responses.append(buf.data(), size);
+  }
+
+  std::size_t response_count = 0;
+  for (auto pos = responses.find("HTTP/1.1 "); pos != std::string::npos;
+       pos = responses.find("HTTP/1.1 ", pos + 1)) {
+    ++response_count;
+  }
+  EXPECT_EQ(response_count, kPipelinedRequests);
+  EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+  EXPECT_EQ(stats->requests_processed_count, kPipelinedRequests);
+}
+
+UTEST(ServerNetConnection, Http2PriorKnowledge) {
+  constexpr std::size_t kConcurrentRequests = 10;
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.http2_enabled = true;
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+
+  std::vector<clients::http::ResponseFuture> requests;
+  requests.push_back(CreateHttp2Request(*http_client_ptr, request_socket));
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto connection_ptr = net::Connection::Create(
+      engine::current_task::GetTaskProcessor(), config.connection_config,
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+  connection_ptr->Start();
+
+  EXPECT_EQ(requests.front().Get()->status_code(), 404);
+  requests.clear();
+
+  // The requests are multiplexed over the same connection
+  for (std::size_t i = 0; i < kConcurrentRequests; ++i) {
+    requests.push_back(CreateHttp2Request(*http_client_ptr, request_socket));
+  }
+  for (auto& request : requests) {
+    EXPECT_EQ(request.Get()->status_code(), 404);
+  }
+  EXPECT_EQ(handler.asyncs_finished, kConcurrentRequests + 1);
+  EXPECT_EQ(stats->connections_created, 1);
+
+  connection_ptr->Stop();
+  std::weak_ptr<net::Connection> weak = connection_ptr;
+  connection_ptr.reset();
+
+  auto task = engine::AsyncNoSpan([weak]() {
+    while (weak.lock()) engine::Yield();
+  });
+
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
 UTEST(ServerNetConnection, CancelMultipleInFlight) {
   constexpr std::size_t kInFlightRequests = 10;
   constexpr std::size_t kMaxAttempts = 10;
@@ -7,11 +7,14 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <thread>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -21,6 +24,7 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -58,7 +62,21 @@ engine::io::Socket CreateUnixSocket(const std::string& path, int backlog) {
   return socket;
 }
 
-engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog) {
+void SetIncomingCpu(engine::io::Socket& socket, std::size_t shard_index) {
+#ifdef SO_INCOMING_CPU
+  const auto cpu_count = std::max(std::thread::hardware_concurrency(), 1U);
+  socket.SetOption(SOL_SOCKET, SO_INCOMING_CPU,
+                   static_cast<int>(shard_index % cpu_count));
+#else
+  (void)socket;
+  (void)shard_index;
+  LOG_WARNING() << "SO_INCOMING_CPU is not defined, incoming_cpu_affinity is "
+                   "ignored";
+#endif
+}
+
+engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog,
+                                    std::optional<std::size_t> incoming_cpu) {
   engine::io::Sockaddr addr;
   auto* sa = addr.As<struct sockaddr_in6>();
   sa->sin6_family = AF_INET6;
@@ -68,6 +86,7 @@ engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog) {
   sa->sin6_addr = in6addr_any;
 
   engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+  if (incoming_cpu) SetIncomingCpu(socket, *incoming_cpu);
   socket.Bind(addr);
   socket.Listen(backlog);
   return socket;
@@ -75,9 +94,13 @@ engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog) {
 
 }  // namespace
 
-engine::io::Socket CreateSocket(const ListenerConfig& config) {
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t shard_index) {
   if (config.unix_socket_path.empty())
-    return CreateIpv6Socket(config.port, config.backlog);
+    return CreateIpv6Socket(config.port, config.backlog,
+                            config.incoming_cpu_affinity
+                                ? std::optional<std::size_t>{shard_index}
+                                : std::nullopt);
   else
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
 }
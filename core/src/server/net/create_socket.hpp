@@ -7,7 +7,12 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
-engine::io::Socket CreateSocket(const ListenerConfig& config);
+/// Creates a listening socket. TCP sockets have SO_REUSEPORT set, so each
+/// shard of a listener gets its own socket and accept queue. With
+/// `incoming_cpu_affinity` the socket of the shard prefers the connections
+/// that are processed by the CPU `shard_index % <CPU count>` in the kernel.
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t shard_index = 0);
 
 }  // namespace server::net
 
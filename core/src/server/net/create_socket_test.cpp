@@ -0,0 +1,29 @@
+#include <server/net/create_socket.hpp>
+
+#include <sys/socket.h>
+
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ServerNetCreateSocket, ShardsShareThePort) {
+  server::net::ListenerConfig config;
+  auto first = server::net::CreateSocket(config, 0);
+  config.port = first.Getsockname().Port();
+
+  auto second = server::net::CreateSocket(config, 1);
+  EXPECT_EQ(second.Getsockname().Port(), config.port);
+}
+
+#ifdef SO_INCOMING_CPU
+UTEST(ServerNetCreateSocket, IncomingCpuAffinity) {
+  server::net::ListenerConfig config;
+  config.incoming_cpu_affinity = true;
+
+  auto socket = server::net::CreateSocket(config, 0);
+  EXPECT_EQ(socket.GetOption(SOL_SOCKET, SO_INCOMING_CPU), 0);
+}
+#endif
+
+USERVER_NAMESPACE_END
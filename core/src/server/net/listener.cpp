@@ -9,10 +9,12 @@ namespace server::net {
 
 Listener::Listener(std::shared_ptr<EndpointInfo> endpoint_info,
                    engine::TaskProcessor& task_processor,
-                   request::ResponseDataAccounter& data_accounter)
+                   request::ResponseDataAccounter& data_accounter,
+                   std::size_t shard_index)
     : task_processor_(&task_processor),
       endpoint_info_(std::move(endpoint_info)),
-      data_accounter_(&data_accounter) {}
+      data_accounter_(&data_accounter),
+      shard_index_(shard_index) {}
 
 Listener::~Listener() {
   if (!impl_) return;
@@ -24,7 +26,7 @@ Listener::~Listener() {
 
 void Listener::Start() {
   impl_ = std::make_unique<ListenerImpl>(*task_processor_, endpoint_info_,
-                                         *data_accounter_);
+                                         *data_accounter_, shard_index_);
 }
 
 Stats Listener::GetStats() const {
@@ -20,6 +20,7 @@ struct ListenerConfig {
   int backlog = 1024;  // truncated to net.core.somaxconn
   size_t max_connections = 32768;
   std::optional<size_t> shards;
+  bool incoming_cpu_affinity = false;
   std::string task_processor;
 };
 
@@ -21,7 +21,8 @@ class ListenerImpl final {
  public:
   ListenerImpl(engine::TaskProcessor& task_processor,
                std::shared_ptr<EndpointInfo> endpoint_info,
-               request::ResponseDataAccounter& data_accounter);
+               request::ResponseDataAccounter& data_accounter,
+               std::size_t shard_index);
   ~ListenerImpl();
 
   Stats GetStats() const;
@@ -57,9 +57,18 @@ ResponseBase::~ResponseBase() noexcept {
 void ResponseBase::SetData(std::string data) {
   create_time_ = std::chrono::steady_clock::now();
   data_ = std::move(data);
+  shared_data_.reset();
   guard_.emplace(accounter_, create_time_, data_.size());
 }
 
+void ResponseBase::SetSharedData(std::shared_ptr<const std::string> data) {
+  UASSERT(data);
+  create_time_ = std::chrono::steady_clock::now();
+  std::string{}.swap(data_);
+  shared_data_ = std::move(data);
+  guard_.emplace(accounter_, create_time_, shared_data_->size());
+}
+
 void ResponseBase::SetReady() { SetReady(std::chrono::steady_clock::now()); }
 
 void ResponseBase::SetReady(std::chrono::steady_clock::time_point now) {
@@ -4,6 +4,7 @@
 #include <shared_mutex>
 #include <stdexcept>
 
+#include <userver/congestion_control/config.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -64,8 +65,9 @@ void PortInfo::Init(const ServerConfig& config,
                                                   : event_thread_pool.GetSize();
 
   listeners_.reserve(listener_shards);
-  while (listener_shards--) {
-    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
+  for (size_t shard_index = 0; shard_index < listener_shards; ++shard_index) {
+    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_,
+                            shard_index);
   }
 }
 
@@ -130,6 +132,8 @@ class ServerImpl final {
 
   void SetRpsRatelimitStatusCode(http::HttpStatus status_code);
   void SetRpsRatelimit(std::optional<size_t> rps);
+  void SetRpsRatelimitTenants(
+      USERVER_NAMESPACE::congestion_control::TenantsConfig config);
 
  private:
   PortInfo main_port_info_;
@@ -302,6 +306,12 @@ void ServerImpl::SetRpsRatelimit(std::optional<size_t> rps) {
   main_port_info_.request_handler_->SetRpsRatelimit(rps);
 }
 
+void ServerImpl::SetRpsRatelimitTenants(
+    USERVER_NAMESPACE::congestion_control::TenantsConfig config) {
+  UASSERT(main_port_info_.request_handler_);
+  main_port_info_.request_handler_->SetRpsRatelimitTenants(std::move(config));
+}
+
 Server::Server(ServerConfig config,
                const components::ComponentContext& component_context)
     : pimpl(
@@ -364,6 +374,11 @@ void Server::SetRpsRatelimit(std::optional<size_t> rps) {
   pimpl->SetRpsRatelimit(rps);
 }
 
+void Server::SetRpsRatelimitTenants(
+    USERVER_NAMESPACE::congestion_control::TenantsConfig config) {
+  pimpl->SetRpsRatelimitTenants(std::move(config));
+}
+
 void Server::SetRpsRatelimitStatusCode(http::HttpStatus status_code) {
   pimpl->SetRpsRatelimitStatusCode(status_code);
 }
@@ -0,0 +1,329 @@
+#include <benchmark/benchmark.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <charconv>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/components/run.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/server/component.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <utils/check_syscall.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kStaticConfig = R"(
+components_manager:
+  coro_pool:
+    initial_size: 500
+    max_size: 1000
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 2
+  task_processors:
+    main-task-processor:
+      thread_name: main-worker
+      worker_threads: 4
+    load-task-processor:
+      thread_name: load-worker
+      worker_threads: 2
+    fs-task-processor:
+      thread_name: fs-worker
+      worker_threads: 1
+  components:
+    logging:
+      fs-task-processor: fs-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+          level: error
+    tracer:
+      service-name: server-benchmark
+    dynamic-config:
+      fs-cache-path: ''
+    dynamic-config-fallbacks:
+      fallback-path: {fallback_path}
+    server:
+      listener:
+        port: {port}
+        task_processor: main-task-processor
+    handler-benchmark:
+      path: /benchmark
+      method: GET
+      task_processor: main-task-processor
+    load-generator:
+      port: {port}
+      task_processor: load-task-processor
+)";
+
+constexpr std::string_view kRequest =
+    "GET /benchmark HTTP/1.1\r\nHost: localhost\r\n\r\n";
+constexpr std::string_view kResponseStart = "HTTP/1.1 200 ";
+constexpr std::string_view kContentLength = "\r\nContent-Length: ";
+
+constexpr std::chrono::seconds kRoundTimeout{10};
+constexpr std::size_t kRecvSize = 16 * 1024;
+
+// Microseconds, exact up to 1ms and with 1ms buckets up to 100ms
+using Latencies = utils::statistics::Percentile<1000, std::uint64_t, 99, 1000>;
+
+// Set for the duration of components::RunOnce
+benchmark::State* current_state = nullptr;
+
+class BenchmarkHandler final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-benchmark";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest&,
+      server::request::RequestContext&) const override {
+    return "OK";
+  }
+};
+
+// Returns 0 while the response is not received completely
+std::size_t GetResponseSize(std::string_view data) {
+  const auto headers_end = data.find("\r\n\r\n");
+  if (headers_end == std::string_view::npos) return 0;
+
+  if (data.substr(0, kResponseStart.size()) != kResponseStart) {
+    throw std::runtime_error(fmt::format(
+        "Unexpected response: {}", data.substr(0, data.find("\r\n"))));
+  }
+
+  // The server writes Content-Length right before the end of the headers
+  const auto headers = data.substr(0, headers_end);
+  const auto length_pos = headers.rfind(kContentLength);
+  if (length_pos == std::string_view::npos) {
+    throw std::runtime_error("No Content-Length in the response");
+  }
+  const auto* const length_begin =
+      headers.data() + length_pos + kContentLength.size();
+  std::size_t length = 0;
+  const auto [ptr, ec] =
+      std::from_chars(length_begin, headers.data() + headers.size(), length);
+  if (ec != std::errc{}) {
+    throw std::runtime_error("Invalid Content-Length in the response");
+  }
+
+  const auto size = headers_end + 4 + length;
+  return data.size() < size ? 0 : size;
+}
+
+// A wrk-like keep-alive connection that sends the requests in batches
+class LoadConnection final {
+ public:
+  LoadConnection(const engine::io::Sockaddr& addr, std::size_t pipeline)
+      : socket_(addr.Domain(), engine::io::SocketType::kStream),
+        pipeline_(pipeline) {
+    for (std::size_t i = 0; i < pipeline_; ++i) requests_.append(kRequest);
+    socket_.Connect(addr, engine::Deadline::FromDuration(kRoundTimeout));
+  }
+
+  void RunRound(Latencies& latencies) {
+    const auto deadline = engine::Deadline::FromDuration(kRoundTimeout);
+    const auto start = std::chrono::steady_clock::now();
+    [[maybe_unused]] const auto sent =
+        socket_.SendAll(requests_.data(), requests_.size(), deadline);
+
+    std::size_t parsed = 0;
+    for (std::size_t responses = 0; responses < pipeline_;) {
+      const auto size =
+          GetResponseSize(std::string_view{buffer_}.substr(parsed));
+      if (size == 0) {
+        const auto old_size = buffer_.size();
+        buffer_.resize(old_size + kRecvSize);
+        const auto received =
+            socket_.RecvSome(buffer_.data() + old_size, kRecvSize, deadline);
+        buffer_.resize(old_size + received);
+        if (received == 0) {
+          throw std::runtime_error("The server closed the connection");
+        }
+        continue;
+      }
+
+      parsed += size;
+      ++responses;
+      latencies.Account(std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count());
+    }
+    buffer_.erase(0, parsed);
+  }
+
+ private:
+  engine::io::Socket socket_;
+  const std::size_t pipeline_;
+  std::string requests_;
+  std::string buffer_;
+};
+
+class LoadGenerator final : public components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "load-generator";
+
+  LoadGenerator(const components::ComponentConfig& config,
+                const components::ComponentContext& context)
+      : LoggableComponentBase(config, context),
+        task_processor_(context.GetTaskProcessor(
+            config["task_processor"].As<std::string>())),
+        port_(config["port"].As<int>()) {
+    // The server starts listening in its OnAllComponentsLoaded(), which is
+    // called before the one of the dependent components
+    context.FindComponent<components::Server>();
+  }
+
+  void OnAllComponentsLoaded() override {
+    UASSERT(current_state);
+    Run(*current_state);
+  }
+
+  static yaml_config::Schema GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: HTTP load generator of the server benchmark
+additionalProperties: false
+properties:
+    port:
+        type: integer
+        description: port of the server
+    task_processor:
+        type: string
+        description: task processor to run the connections on
+)");
+  }
+
+ private:
+  void Run(benchmark::State& state) {
+    const auto connections_count = static_cast<std::size_t>(state.range(0));
+    const auto pipeline = static_cast<std::size_t>(state.range(1));
+
+    engine::io::Sockaddr addr;
+    auto* sa = addr.As<struct sockaddr_in6>();
+    sa->sin6_family = AF_INET6;
+    sa->sin6_addr = in6addr_loopback;
+    addr.SetPort(port_);
+
+    std::vector<LoadConnection> connections;
+    connections.reserve(connections_count);
+    for (std::size_t i = 0; i < connections_count; ++i) {
+      connections.emplace_back(addr, pipeline);
+    }
+    std::vector<Latencies> latencies(connections_count);
+
+    std::uint64_t allocations_before = 0;
+    const bool has_allocations =
+        !utils::jemalloc::GetAllocationsCount(allocations_before);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(connections_count);
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < connections_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(
+            task_processor_, [&connection = connections[i],
+                              &latencies = latencies[i]] {
+              connection.RunRound(latencies);
+            }));
+      }
+      engine::GetAll(tasks);
+      tasks.clear();
+    }
+
+    const auto requests = static_cast<std::int64_t>(
+        state.iterations() * connections_count * pipeline);
+    state.SetItemsProcessed(requests);
+
+    std::uint64_t allocations_after = 0;
+    if (has_allocations &&
+        !utils::jemalloc::GetAllocationsCount(allocations_after)) {
+      // Both of the server and the client allocations
+      state.counters["allocations/request"] =
+          static_cast<double>(allocations_after - allocations_before) /
+          static_cast<double>(requests);
+    }
+
+    Latencies total;
+    for (const auto& connection_latencies : latencies) {
+      total.Add(connection_latencies);
+    }
+    for (const auto percent : {50.0, 90.0, 99.0, 99.9}) {
+      state.counters[fmt::format("p{}_us", percent)] =
+          static_cast<double>(total.GetPercentile(percent));
+    }
+  }
+
+  engine::TaskProcessor& task_processor_;
+  const int port_;
+};
+
+// The listener requires an explicit port, so a free one is found in advance
+int FindFreePort() {
+  const int fd = utils::CheckSyscall(::socket(AF_INET6, SOCK_STREAM, 0),
+                                     "creating a socket");
+  struct sockaddr_in6 addr {};
+  addr.sin6_family = AF_INET6;
+  addr.sin6_addr = in6addr_loopback;
+  socklen_t addr_len = sizeof(addr);
+  utils::CheckSyscall(
+      ::bind(fd, reinterpret_cast<struct sockaddr*>(&addr), addr_len),
+      "binding a socket");
+  utils::CheckSyscall(
+      ::getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr), &addr_len),
+      "getting a socket address");
+  ::close(fd);
+  return ntohs(addr.sin6_port);
+}
+
+}  // namespace
+
+template <>
+inline constexpr bool components::kHasValidate<LoadGenerator> = true;
+
+// Boots a minimal server and loads it over the loopback. An iteration is a
+// round of `pipeline` requests over each of the `connections`.
+void http_server_end_to_end(benchmark::State& state) {
+  current_state = &state;
+  const auto port = FindFreePort();
+  const auto config = fmt::format(
+      kStaticConfig, fmt::arg("port", port),
+      fmt::arg("fallback_path", DEFAULT_DYNAMIC_CONFIG_FILENAME));
+
+  components::RunOnce(components::InMemoryConfig{config},
+                      components::MinimalServerComponentList()
+                          .Append<BenchmarkHandler>()
+                          .Append<LoadGenerator>(),
+                      "@null");
+  current_state = nullptr;
+}
+BENCHMARK(http_server_end_to_end)
+    ->ArgNames({"connections", "pipeline"})
+    ->Args({1, 1})
+    ->Args({16, 1})
+    ->Args({64, 1})
+    ->Args({16, 16})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+USERVER_NAMESPACE_END
@@ -16,10 +16,13 @@ namespace storages::secdist {
 
 namespace {
 
-std::vector<std::function<std::any(const formats::json::Value&)>>&
-GetConfigFactories() {
-  static std::vector<std::function<std::any(const formats::json::Value&)>>
-      factories;
+struct ConfigFactory final {
+  std::function<std::any(const formats::json::Value&)> factory;
+  bool (*is_equal)(const std::any&, const std::any&){nullptr};
+};
+
+std::vector<ConfigFactory>& GetConfigFactories() {
+  static std::vector<ConfigFactory> factories;
   return factories;
 }
 
@@ -31,26 +34,45 @@ SecdistConfig::SecdistConfig(const SecdistConfig::Settings& settings) {
   // if we don't want to read secdist, then we don't need to initialize
   if (GetConfigFactories().empty()) return;
 
-  Init(settings.provider->Get());
+  Init(settings.provider->Get(), nullptr);
+}
+
+SecdistConfig::SecdistConfig(const formats::json::Value& doc,
+                             const SecdistConfig& previous) {
+  if (GetConfigFactories().empty()) return;
+
+  Init(doc, &previous);
 }
 
-void SecdistConfig::Init(const formats::json::Value& doc) {
-  for (const auto& config_factory : GetConfigFactories()) {
-    configs_.emplace_back(config_factory(doc));
+void SecdistConfig::Init(const formats::json::Value& doc,
+                         const SecdistConfig* previous) {
+  const auto& config_factories = GetConfigFactories();
+  configs_.reserve(config_factories.size());
+  for (const auto& [factory, is_equal] : config_factories) {
+    auto config = factory(doc);
+
+    const auto index = configs_.size();
+    if (previous && index < previous->configs_.size() && is_equal &&
+        is_equal(*previous->configs_[index], config)) {
+      configs_.push_back(previous->configs_[index]);
+    } else {
+      configs_.push_back(std::make_shared<const std::any>(std::move(config)));
+    }
   }
 }
 
 std::size_t SecdistConfig::Register(
-    std::function<std::any(const formats::json::Value&)>&& factory) {
+    std::function<std::any(const formats::json::Value&)>&& factory,
+    bool (*is_equal)(const std::any&, const std::any&)) {
   auto& config_factories = GetConfigFactories();
-  config_factories.emplace_back(std::move(factory));
+  config_factories.push_back({std::move(factory), is_equal});
   return config_factories.size() - 1;
 }
 
 const std::any& SecdistConfig::Get(const std::type_index& type,
                                    std::size_t index) const {
   try {
-    return configs_.at(index);
+    return *configs_.at(index);
   } catch (const std::out_of_range&) {
     throw std::out_of_range("Type " + compiler::GetTypeName(type) +
                             " is not registered as config");
@@ -77,8 +99,13 @@ class Secdist::Impl {
  private:
   void StartUpdateTask();
 
+  void Update();
+
   storages::secdist::SecdistConfig::Settings settings_;
 
+  // The document of dynamic_secdist_config_, only used by Update()
+  formats::json::Value doc_;
+
   SecdistConfig secdist_config_;
   rcu::Variable<storages::secdist::SecdistConfig> dynamic_secdist_config_;
   concurrent::AsyncEventChannel<const SecdistConfig&> channel_;
@@ -91,7 +118,14 @@ Secdist::Impl::Impl(SecdistConfig::Settings settings)
         const auto snapshot = dynamic_secdist_config_.Read();
         function(*snapshot);
       }) {
-  dynamic_secdist_config_.Assign(storages::secdist::SecdistConfig(settings_));
+  if (IsPeriodicUpdateEnabled()) {
+    doc_ = settings_.provider->Get();
+    dynamic_secdist_config_.Assign(
+        storages::secdist::SecdistConfig(doc_, SecdistConfig{}));
+  } else {
+    dynamic_secdist_config_.Assign(
+        storages::secdist::SecdistConfig(settings_));
+  }
 
   if (IsPeriodicUpdateEnabled()) {
     StartUpdateTask();
@@ -138,16 +172,29 @@ void Secdist::Impl::StartUpdateTask() {
       settings_.update_period, {utils::PeriodicTask::Flags::kCritical});
   update_task_.Start("secdist_update", periodic_settings, [this]() {
     try {
-      dynamic_secdist_config_.Assign(
-          storages::secdist::SecdistConfig(settings_));
-      auto snapshot = dynamic_secdist_config_.Read();
-      channel_.SendEvent(*snapshot);
+      Update();
     } catch (const std::exception& ex) {
       LOG_ERROR() << "Secdist loading failed: " << ex;
     }
   });
 }
 
+void Secdist::Impl::Update() {
+  auto doc = settings_.provider->Get();
+  // Most of the periodic updates find the same document, so neither the
+  // modules are parsed nor the subscribers are notified
+  if (doc == doc_) return;
+
+  {
+    const auto previous = dynamic_secdist_config_.Read();
+    dynamic_secdist_config_.Assign(SecdistConfig(doc, *previous));
+  }
+  doc_ = std::move(doc);
+
+  const auto snapshot = dynamic_secdist_config_.Read();
+  channel_.SendEvent(*snapshot);
+}
+
 Secdist::Secdist(SecdistConfig::Settings settings)
     : impl_(std::move(settings)) {}
 
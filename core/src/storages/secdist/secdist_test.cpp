@@ -43,6 +43,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace {
 
+class ServiceToken {
+ public:
+  ServiceToken(const formats::json::Value& doc)
+      : token_(doc["service-token"].As<std::string>("")) {}
+
+  const std::string& Get() const { return token_; }
+
+  bool operator==(const ServiceToken& other) const {
+    return token_ == other.token_;
+  }
+
+ private:
+  std::string token_;
+};
+
+}  // namespace
+
+namespace {
+
 const std::string kSecdistJson =
     /** [Secdist Usage Sample - json] */ R"~(
   {
@@ -282,4 +301,88 @@ UTEST(Secdist, DynamicUpdate) {
   subscriber.Unsubscribe();
 }
 
+UTEST(Secdist, ModuleUpdate) {
+  const std::string kSecdistInitJson = R"~(
+  {
+      "service-token": "token_old",
+      "user-passwords": {"username": "password_old"}
+  }
+  )~";
+
+  const std::string kSecdistPasswordUpdateJson = R"~(
+  {
+      "service-token": "token_old",
+      "user-passwords": {"username": "password_updated"}
+  }
+  )~";
+
+  const std::string kSecdistTokenUpdateJson = R"~(
+  {
+      "service-token": "token_updated",
+      "user-passwords": {"username": "password_updated"}
+  }
+  )~";
+
+  struct ConfigSubscriber {
+    void OnSecdistUpdate(const storages::secdist::SecdistConfig&) {
+      ++updates;
+    }
+
+    std::atomic<int> updates{0};
+  };
+
+  struct TokenSubscriber {
+    void OnSecdistUpdate(const ServiceToken& new_token) {
+      token = new_token.Get();
+      ++updates;
+    }
+
+    std::atomic<int> updates{0};
+    std::string token;
+  };
+
+  auto temp_file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(temp_file.GetPath(), kSecdistInitJson);
+
+  storages::secdist::DefaultLoader provider{
+      {temp_file.GetPath(), storages::secdist::SecdistFormat::kJson, false,
+       std::nullopt, &engine::current_task::GetTaskProcessor()}};
+  storages::secdist::Secdist secdist{
+      {&provider, std::chrono::milliseconds(10)}};
+
+  ConfigSubscriber config_subscriber;
+  TokenSubscriber token_subscriber;
+  auto config_scope =
+      secdist.UpdateAndListen(&config_subscriber, "test/secdist",
+                              &ConfigSubscriber::OnSecdistUpdate);
+  auto token_scope =
+      secdist.UpdateAndListen(&token_subscriber, "test/secdist_token",
+                              &TokenSubscriber::OnSecdistUpdate);
+  EXPECT_EQ(config_subscriber.updates, 1);
+  EXPECT_EQ(token_subscriber.updates, 1);
+  EXPECT_EQ(token_subscriber.token, "token_old");
+
+  // An unchanged secdist is not delivered
+  engine::SleepFor(std::chrono::milliseconds(50));
+  EXPECT_EQ(config_subscriber.updates, 1);
+
+  fs::blocking::RewriteFileContents(temp_file.GetPath(),
+                                    kSecdistPasswordUpdateJson);
+  while (config_subscriber.updates < 2) {
+    engine::SleepFor(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(token_subscriber.updates, 1);
+
+  fs::blocking::RewriteFileContents(temp_file.GetPath(),
+                                    kSecdistTokenUpdateJson);
+  while (token_subscriber.updates < 2 || config_subscriber.updates < 3) {
+    engine::SleepFor(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(config_subscriber.updates, 3);
+  EXPECT_EQ(token_subscriber.token, "token_updated");
+
+  token_scope.Unsubscribe();
+  config_scope.Unsubscribe();
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,69 @@
+#include "perf_counters.hpp"
+
+#include <userver/components/component.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <components/manager.hpp>
+#include <engine/task/task_processor.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace testsuite::impl::actions {
+
+namespace {
+
+bool HasAllocationsCount() {
+  std::uint64_t allocations = 0;
+  return !utils::jemalloc::GetAllocationsCount(allocations);
+}
+
+}  // namespace
+
+PerfCounters::PerfCounters(
+    const components::ComponentContext& component_context)
+    : manager_(component_context.GetManager()),
+      control_(component_context.FindComponent<components::TestsuiteSupport>()
+                   .GetPerfCountersControl()),
+      has_allocations_(HasAllocationsCount()),
+      baseline_(GetCurrent()) {}
+
+formats::json::Value PerfCounters::Perform(
+    const formats::json::Value& request_body) const {
+  const auto reset = request_body["reset"].As<bool>(false);
+
+  const auto current = GetCurrent();
+  formats::json::ValueBuilder counters{control_.GetCounters()};
+  {
+    std::lock_guard lock(baseline_mutex_);
+    counters["tasks-created"] = current.created_tasks - baseline_.created_tasks;
+    if (has_allocations_) {
+      // Includes the allocations of the concurrent requests and of the
+      // background tasks
+      counters["allocations"] = current.allocations - baseline_.allocations;
+    }
+    if (reset) baseline_ = current;
+  }
+  if (reset) control_.Reset();
+
+  formats::json::ValueBuilder result;
+  result["counters"] = std::move(counters);
+  return result.ExtractValue();
+}
+
+PerfCounters::Baseline PerfCounters::GetCurrent() const {
+  Baseline current;
+  for (const auto& [name, task_processor] : manager_.GetTaskProcessorsMap()) {
+    current.created_tasks +=
+        task_processor->GetTaskCounter().GetCreatedTasks().value;
+  }
+  if (has_allocations_) {
+    [[maybe_unused]] const auto error =
+        utils::jemalloc::GetAllocationsCount(current.allocations);
+  }
+  return current;
+}
+
+}  // namespace testsuite::impl::actions
+
+USERVER_NAMESPACE_END
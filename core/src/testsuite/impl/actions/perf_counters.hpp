@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include <userver/testsuite/testsuite_support.hpp>
+
+#include <testsuite/impl/actions/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+class Manager;
+}  // namespace components
+
+namespace testsuite::impl::actions {
+
+// Returns the counters accounted since the last reset. Besides the ones of
+// testsuite::AccountPerfCounter, reports the created tasks and the jemalloc
+// allocations, if available.
+class PerfCounters final : public BaseTestsuiteAction {
+ public:
+  PerfCounters(const components::ComponentContext& component_context);
+
+  formats::json::Value Perform(
+      const formats::json::Value& request_body) const override;
+
+ private:
+  struct Baseline {
+    std::uint64_t created_tasks{0};
+    std::uint64_t allocations{0};
+  };
+
+  Baseline GetCurrent() const;
+
+  const components::Manager& manager_;
+  testsuite::PerfCountersControl& control_;
+  const bool has_allocations_;
+
+  mutable std::mutex baseline_mutex_;
+  mutable Baseline baseline_;
+};
+
+}  // namespace testsuite::impl::actions
+
+USERVER_NAMESPACE_END
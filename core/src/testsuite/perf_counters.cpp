@@ -0,0 +1,76 @@
+#include <userver/testsuite/perf_counters.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <string>
+
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace testsuite {
+
+namespace {
+
+std::atomic<bool> counters_enabled{false};
+std::atomic<PerfCountersControl*> control_instance{nullptr};
+
+// The critical sections are short and never suspend the coroutine
+std::mutex counters_mutex;
+utils::impl::TransparentMap<std::string, std::uint64_t> counters;
+
+}  // namespace
+
+void AccountPerfCounter(std::string_view name, std::uint64_t value) noexcept {
+  if (!counters_enabled.load(std::memory_order_relaxed)) return;
+
+  std::lock_guard lock(counters_mutex);
+  // Only the first accounting of a counter allocates
+  auto* counter = utils::impl::FindTransparentOrNullptr(counters, name);
+  if (counter) {
+    *counter += value;
+    return;
+  }
+
+  try {
+    counters.emplace(std::string{name}, value);
+  } catch (const std::bad_alloc&) {
+    UASSERT_MSG(false, "Failed to account a testsuite performance counter");
+  }
+}
+
+PerfCountersControl::PerfCountersControl() {
+  PerfCountersControl* expected = nullptr;
+  UINVARIANT(control_instance.compare_exchange_strong(expected, this),
+             "Only 1 PerfCountersControl instance may exist at a time");
+}
+
+PerfCountersControl::~PerfCountersControl() {
+  counters_enabled = false;
+  Reset();
+  control_instance = nullptr;
+}
+
+void PerfCountersControl::Enable() { counters_enabled = true; }
+
+void PerfCountersControl::Reset() {
+  std::lock_guard lock(counters_mutex);
+  // The nodes are kept to not allocate during the next accounting
+  for (auto& [name, value] : counters) value = 0;
+}
+
+formats::json::Value PerfCountersControl::GetCounters() const {
+  formats::json::ValueBuilder builder(formats::json::Type::kObject);
+  std::lock_guard lock(counters_mutex);
+  for (const auto& [name, value] : counters) {
+    if (value != 0) builder[name] = value;
+  }
+  return builder.ExtractValue();
+}
+
+}  // namespace testsuite
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#include <userver/testsuite/perf_counters.hpp>
+
+#include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(PerfCounters, Basic) {
+  testsuite::PerfCountersControl control;
+  testsuite::AccountPerfCounter("queries");
+  EXPECT_EQ(control.GetCounters(), formats::json::MakeObject());
+
+  control.Enable();
+  testsuite::AccountPerfCounter("queries");
+  testsuite::AccountPerfCounter("queries", 2);
+  testsuite::AccountPerfCounter("commands", 5);
+  EXPECT_EQ(control.GetCounters(),
+            formats::json::MakeObject("queries", 3, "commands", 5));
+
+  control.Reset();
+  EXPECT_EQ(control.GetCounters(), formats::json::MakeObject());
+  testsuite::AccountPerfCounter("commands");
+  EXPECT_EQ(control.GetCounters(), formats::json::MakeObject("commands", 1));
+}
+
+USERVER_NAMESPACE_END
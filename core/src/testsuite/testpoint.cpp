@@ -1,9 +1,11 @@
 #include <userver/testsuite/testpoint.hpp>
 
+#include <mutex>
+#include <shared_mutex>
 #include <utility>
 #include <variant>
 
-#include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/read_mostly_shared_mutex.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/testsuite/testpoint_control.hpp>
 #include <userver/utils/assert.hpp>
@@ -22,7 +24,7 @@ struct EnableAll {};
 using EnabledTestpoints = std::variant<EnableOnly, EnableAll>;
 
 std::atomic<TestpointClientBase*> client_instance{nullptr};
-engine::SharedMutex client_instance_mutex;
+engine::ReadMostlySharedMutex client_instance_mutex;
 
 rcu::Variable<EnabledTestpoints> enabled_testpoints;
 std::atomic<TestpointControl*> control_instance{nullptr};
@@ -34,7 +36,7 @@ namespace impl {
 struct TestpointScope::Impl final {
   Impl() : lock(client_instance_mutex), client(client_instance) {}
 
-  std::shared_lock<engine::SharedMutex> lock{};
+  std::shared_lock<engine::ReadMostlySharedMutex> lock{};
   TestpointClientBase* client{nullptr};
 };
 
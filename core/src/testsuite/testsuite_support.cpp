@@ -119,6 +119,10 @@ testsuite::GrpcControl& TestsuiteSupport::GetGrpcControl() {
   return grpc_control_;
 }
 
+testsuite::PerfCountersControl& TestsuiteSupport::GetPerfCountersControl() {
+  return perf_counters_control_;
+}
+
 yaml_config::Schema TestsuiteSupport::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<impl::ComponentBase>(R"(
 type: object
@@ -7,6 +7,11 @@ USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
 
+namespace {
+constexpr std::string_view kSampled = "1";
+constexpr std::string_view kNotSampled = "0";
+}  // namespace
+
 bool DefaultTracingManager::TryFillSpanBuilderFromRequest(
     const server::http::HttpRequest& request, SpanBuilder& span_builder) const {
   const auto& trace_id = request.GetHeader(http::headers::kXYaTraceId);
@@ -17,6 +22,11 @@ bool DefaultTracingManager::TryFillSpanBuilderFromRequest(
   const auto& parent_link = request.GetHeader(http::headers::kXYaRequestId);
   if (!parent_link.empty()) span_builder.SetParentLink(parent_link);
 
+  const auto& sampled = request.GetHeader(http::headers::kXYaSampled);
+  if (sampled == kSampled || sampled == kNotSampled) {
+    span_builder.SetSampled(sampled == kSampled);
+  }
+
   return true;
 }
 
@@ -26,6 +36,8 @@ void DefaultTracingManager::FillRequestWithTracingContext(
   request.SetHeader(http::headers::kXYaRequestId, span.GetLink());
   request.SetHeader(http::headers::kXYaTraceId, span.GetTraceId());
   request.SetHeader(http::headers::kXYaSpanId, span.GetSpanId());
+  request.SetHeader(http::headers::kXYaSampled,
+                    span.IsSampled() ? kSampled : kNotSampled);
 }
 
 void DefaultTracingManager::FillResponseWithTracingContext(
@@ -0,0 +1,183 @@
+#include <tracing/otlp/exporter.hpp>
+
+#include <optional>
+
+#include <compression/gzip.hpp>
+#include <tracing/otlp/trace_encoder.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tracer.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+namespace {
+
+constexpr std::string_view kContentTypeProtobuf = "application/x-protobuf";
+constexpr std::string_view kExportSpanName = "otlp_export";
+
+}  // namespace
+
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(Compression::kNone, "none")
+        .Case(Compression::kGzip, "gzip");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
+ExporterConfig Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<ExporterConfig>) {
+  ExporterConfig config;
+  config.endpoint = value["endpoint"].As<std::string>();
+  config.max_queue_size =
+      value["max-queue-size"].As<std::size_t>(config.max_queue_size);
+  config.max_batch_size =
+      value["max-batch-size"].As<std::size_t>(config.max_batch_size);
+  config.export_interval =
+      value["export-interval"].As<std::chrono::milliseconds>(
+          config.export_interval);
+  config.timeout =
+      value["timeout"].As<std::chrono::milliseconds>(config.timeout);
+  config.compression = value["compression"].As<Compression>(config.compression);
+  config.log_spans = value["log-spans"].As<bool>(config.log_spans);
+
+  UINVARIANT(config.max_batch_size > 0, "max-batch-size must be positive");
+  UINVARIANT(config.export_interval.count() > 0,
+             "export-interval must be positive");
+  return config;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExporterStatistics& stats) {
+  writer["exported"] = stats.exported;
+  writer["dropped"] = stats.dropped;
+  writer["batches"] = stats.batches;
+  writer["send_errors"] = stats.send_errors;
+  writer["sent_bytes"] = stats.sent_bytes;
+}
+
+Exporter::Exporter(clients::http::Client& http_client, ExporterConfig config)
+    : impl::SpanExporter(config.log_spans),
+      http_client_(http_client),
+      config_(std::move(config)),
+      queue_(Queue::Create(config_.max_queue_size)),
+      producer_(queue_->GetMultiProducer()) {}
+
+Exporter::~Exporter() { Stop(); }
+
+void Exporter::Start(engine::TaskProcessor& task_processor) {
+  UASSERT(!task_.IsValid());
+  task_ = engine::CriticalAsyncNoSpan(
+      task_processor, [this, consumer = queue_->GetConsumer()]() mutable {
+        ProcessingLoop(std::move(consumer));
+      });
+}
+
+void Exporter::Stop() noexcept {
+  if (task_.IsValid()) task_.SyncCancel();
+}
+
+void Exporter::Export(impl::SpanData&& span) noexcept {
+  try {
+    if (producer_.PushNoblock(std::move(span))) return;
+  } catch (const std::exception&) {
+    // The same as an overflow for the span
+  }
+  ++stats_.dropped;
+}
+
+const ExporterStatistics& Exporter::GetStatistics() const noexcept {
+  return stats_;
+}
+
+void Exporter::ProcessingLoop(Queue::Consumer consumer) {
+  std::vector<impl::SpanData> batch;
+  batch.reserve(config_.max_batch_size);
+
+  while (!engine::current_task::ShouldCancel()) {
+    const auto deadline =
+        engine::Deadline::FromDuration(config_.export_interval);
+    while (batch.size() < config_.max_batch_size &&
+           consumer.PopMany(batch, config_.max_batch_size - batch.size(),
+                            deadline) != 0) {
+    }
+
+    if (!batch.empty()) {
+      SendBatch(batch);
+      batch.clear();
+    }
+  }
+
+  // Send out the spans that were queued before the stop
+  while (consumer.PopMany(batch, config_.max_batch_size,
+                          engine::Deadline::Passed()) != 0) {
+    SendBatch(batch);
+    batch.clear();
+  }
+}
+
+void Exporter::SendBatch(const std::vector<impl::SpanData>& spans) noexcept {
+  // Stop() waits for the current request instead of losing the batch
+  const engine::TaskCancellationBlocker block_cancel;
+
+  std::optional<std::string> error;
+  {
+    // Neither logs nor exports the spans of the request to the collector,
+    // that would produce new spans to send
+    tracing::Span span{std::string{kExportSpanName}};
+    span.SetLocalLogLevel(logging::Level::kNone);
+    try {
+      DoSendBatch(spans);
+    } catch (const std::exception& e) {
+      error = e.what();
+    }
+  }
+
+  if (error) {
+    ++stats_.send_errors;
+    stats_.dropped.Add(utils::statistics::Rate{spans.size()});
+    LOG_LIMITED_WARNING() << "Failed to export " << spans.size()
+                          << " spans to '" << config_.endpoint
+                          << "': " << *error;
+  }
+}
+
+void Exporter::DoSendBatch(const std::vector<impl::SpanData>& spans) {
+  auto body = EncodeExportTraceRequest(
+      tracing::Tracer::GetTracer()->GetServiceName(), spans);
+
+  clients::http::Headers headers{
+      {USERVER_NAMESPACE::http::headers::kContentType,
+       std::string{kContentTypeProtobuf}}};
+  if (config_.compression == Compression::kGzip) {
+    body = compression::gzip::Compress(body);
+    headers.emplace(USERVER_NAMESPACE::http::headers::kContentEncoding, "gzip");
+  }
+  const auto body_size = body.size();
+
+  const auto response = http_client_.CreateRequest()
+                            .post(config_.endpoint, std::move(body))
+                            .headers(headers)
+                            .timeout(config_.timeout)
+                            .perform();
+  response->raise_for_status();
+
+  ++stats_.batches;
+  stats_.exported.Add(utils::statistics::Rate{spans.size()});
+  stats_.sent_bytes.Add(utils::statistics::Rate{body_size});
+}
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+#include <tracing/span_exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+enum class Compression {
+  kNone,
+  kGzip,
+};
+
+struct ExporterConfig final {
+  std::string endpoint;
+  std::size_t max_queue_size{65536};
+  std::size_t max_batch_size{512};
+  std::chrono::milliseconds export_interval{1000};
+  std::chrono::milliseconds timeout{1000};
+  Compression compression{Compression::kGzip};
+  bool log_spans{true};
+};
+
+ExporterConfig Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<ExporterConfig>);
+
+struct ExporterStatistics final {
+  utils::statistics::RateCounter exported{};
+  utils::statistics::RateCounter dropped{};
+  utils::statistics::RateCounter batches{};
+  utils::statistics::RateCounter send_errors{};
+  utils::statistics::RateCounter sent_bytes{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExporterStatistics& stats);
+
+/// @brief Sends the spans to an OpenTelemetry collector over OTLP/HTTP
+///
+/// Spans are put into a bounded queue, spans that do not fit are dropped.
+/// A background task sends them in batches of up to `max_batch_size` spans
+/// at least once per `export_interval`.
+class Exporter final : public impl::SpanExporter {
+ public:
+  Exporter(clients::http::Client& http_client, ExporterConfig config);
+  ~Exporter() override;
+
+  void Start(engine::TaskProcessor& task_processor);
+
+  /// Sends out the queued spans and stops the background task
+  void Stop() noexcept;
+
+  void Export(impl::SpanData&& span) noexcept override;
+
+  const ExporterStatistics& GetStatistics() const noexcept;
+
+ private:
+  using Queue = concurrent::NonFifoMpscQueue<impl::SpanData>;
+
+  void ProcessingLoop(Queue::Consumer consumer);
+  void SendBatch(const std::vector<impl::SpanData>& spans) noexcept;
+  void DoSendBatch(const std::vector<impl::SpanData>& spans);
+
+  clients::http::Client& http_client_;
+  const ExporterConfig config_;
+  const std::shared_ptr<Queue> queue_;
+  Queue::MultiProducer producer_;
+  ExporterStatistics stats_;
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
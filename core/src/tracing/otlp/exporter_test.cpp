@@ -0,0 +1,183 @@
+#include <tracing/otlp/exporter.hpp>
+
+#include <string>
+#include <vector>
+
+#include <compression/gzip.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/http_server_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMaxBodySize = 1 << 20;
+
+std::string_view GetHeader(const clients::http::Headers& headers,
+                           const http::headers::PredefinedHeader& header) {
+  const auto it = headers.find(header);
+  return it == headers.end() ? std::string_view{} : it->second;
+}
+
+tracing::impl::SpanData MakeSpan(std::string name) {
+  tracing::impl::SpanData span;
+  span.name = std::move(name);
+  span.trace_id = "0123456789abcdef0123456789abcdef";
+  span.span_id = "0011223344556677";
+  span.start_time = std::chrono::system_clock::now();
+  span.end_time = span.start_time;
+  return span;
+}
+
+class Collector final {
+ public:
+  explicit Collector(int status = 200)
+      : server_([this, status](const utest::HttpServerMock::HttpRequest& r) {
+          {
+            const std::lock_guard lock{mutex_};
+            requests_.push_back(r);
+          }
+          event_.Send();
+          return utest::HttpServerMock::HttpResponse{status, {}, {}};
+        }) {}
+
+  tracing::otlp::ExporterConfig MakeConfig() const {
+    tracing::otlp::ExporterConfig config;
+    config.endpoint = server_.GetBaseUrl() + "/v1/traces";
+    config.export_interval = std::chrono::milliseconds{10};
+    config.timeout = utest::kMaxTestWaitTime;
+    return config;
+  }
+
+  bool WaitForRequest() {
+    return event_.WaitForEventFor(utest::kMaxTestWaitTime);
+  }
+
+  std::vector<utest::HttpServerMock::HttpRequest> GetRequests() {
+    const std::lock_guard lock{mutex_};
+    return requests_;
+  }
+
+ private:
+  engine::Mutex mutex_;
+  std::vector<utest::HttpServerMock::HttpRequest> requests_;
+  engine::SingleConsumerEvent event_;
+  utest::HttpServerMock server_;
+};
+
+}  // namespace
+
+UTEST(OtlpExporter, SendsSpans) {
+  Collector collector;
+  const auto http_client = utest::CreateHttpClient();
+  tracing::otlp::Exporter exporter{*http_client, collector.MakeConfig()};
+  exporter.Start(engine::current_task::GetTaskProcessor());
+
+  exporter.Export(MakeSpan("first_span"));
+  exporter.Export(MakeSpan("second_span"));
+  ASSERT_TRUE(collector.WaitForRequest());
+  exporter.Stop();
+
+  std::string body;
+  for (const auto& request : collector.GetRequests()) {
+    EXPECT_EQ(request.method, clients::http::HttpMethod::kPost);
+    EXPECT_EQ(request.path, "/v1/traces");
+    EXPECT_EQ(GetHeader(request.headers, http::headers::kContentType),
+              "application/x-protobuf");
+    ASSERT_EQ(GetHeader(request.headers, http::headers::kContentEncoding),
+              "gzip");
+    body += compression::gzip::Decompress(request.body, kMaxBodySize);
+  }
+  EXPECT_NE(body.find("first_span"), std::string::npos);
+  EXPECT_NE(body.find("second_span"), std::string::npos);
+
+  const auto& stats = exporter.GetStatistics();
+  EXPECT_EQ(stats.exported.Load().value, 2);
+  EXPECT_EQ(stats.dropped.Load().value, 0);
+  EXPECT_EQ(stats.send_errors.Load().value, 0);
+  EXPECT_GE(stats.batches.Load().value, 1);
+}
+
+UTEST(OtlpExporter, NoCompression) {
+  Collector collector;
+  const auto http_client = utest::CreateHttpClient();
+  auto config = collector.MakeConfig();
+  config.compression = tracing::otlp::Compression::kNone;
+  tracing::otlp::Exporter exporter{*http_client, config};
+  exporter.Start(engine::current_task::GetTaskProcessor());
+
+  exporter.Export(MakeSpan("plain_span"));
+  ASSERT_TRUE(collector.WaitForRequest());
+  exporter.Stop();
+
+  const auto requests = collector.GetRequests();
+  ASSERT_EQ(requests.size(), 1);
+  EXPECT_EQ(GetHeader(requests[0].headers, http::headers::kContentEncoding),
+            "");
+  EXPECT_NE(requests[0].body.find("plain_span"), std::string::npos);
+}
+
+UTEST(OtlpExporter, SendsQueuedSpansOnStop) {
+  Collector collector;
+  const auto http_client = utest::CreateHttpClient();
+  auto config = collector.MakeConfig();
+  config.export_interval = std::chrono::hours{1};
+  tracing::otlp::Exporter exporter{*http_client, config};
+  exporter.Start(engine::current_task::GetTaskProcessor());
+
+  exporter.Export(MakeSpan("last_span"));
+  exporter.Stop();
+
+  const auto requests = collector.GetRequests();
+  ASSERT_EQ(requests.size(), 1);
+  EXPECT_EQ(exporter.GetStatistics().exported.Load().value, 1);
+}
+
+UTEST(OtlpExporter, BatchSize) {
+  Collector collector;
+  const auto http_client = utest::CreateHttpClient();
+  auto config = collector.MakeConfig();
+  config.export_interval = std::chrono::hours{1};
+  config.max_batch_size = 2;
+  tracing::otlp::Exporter exporter{*http_client, config};
+
+  for (int i = 0; i < 5; ++i) exporter.Export(MakeSpan("span"));
+  exporter.Start(engine::current_task::GetTaskProcessor());
+  exporter.Stop();
+
+  EXPECT_EQ(collector.GetRequests().size(), 3);
+  EXPECT_EQ(exporter.GetStatistics().batches.Load().value, 3);
+}
+
+UTEST(OtlpExporter, DropsOnQueueOverflow) {
+  const auto http_client = utest::CreateHttpClient();
+  tracing::otlp::ExporterConfig config;
+  config.endpoint = "http://localhost:1/v1/traces";
+  config.max_queue_size = 2;
+  tracing::otlp::Exporter exporter{*http_client, config};
+
+  for (int i = 0; i < 5; ++i) exporter.Export(MakeSpan("span"));
+  EXPECT_EQ(exporter.GetStatistics().dropped.Load().value, 3);
+}
+
+UTEST(OtlpExporter, SendErrors) {
+  Collector collector{500};
+  const auto http_client = utest::CreateHttpClient();
+  tracing::otlp::Exporter exporter{*http_client, collector.MakeConfig()};
+  exporter.Start(engine::current_task::GetTaskProcessor());
+
+  exporter.Export(MakeSpan("span"));
+  ASSERT_TRUE(collector.WaitForRequest());
+  exporter.Stop();
+
+  const auto& stats = exporter.GetStatistics();
+  EXPECT_EQ(stats.exported.Load().value, 0);
+  EXPECT_EQ(stats.dropped.Load().value, 1);
+  EXPECT_EQ(stats.send_errors.Load().value, 1);
+}
+
+USERVER_NAMESPACE_END
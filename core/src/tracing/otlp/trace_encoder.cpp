@@ -0,0 +1,287 @@
+#include <tracing/otlp/trace_encoder.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <variant>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/overloaded.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+namespace {
+
+// Field numbers from opentelemetry/proto/{collector/,}trace/v1/*.proto,
+// opentelemetry/proto/common/v1/common.proto and
+// opentelemetry/proto/resource/v1/resource.proto
+namespace fields {
+
+constexpr std::uint32_t kRequestResourceSpans = 1;
+
+constexpr std::uint32_t kResourceSpansResource = 1;
+constexpr std::uint32_t kResourceSpansScopeSpans = 2;
+
+constexpr std::uint32_t kResourceAttributes = 1;
+
+constexpr std::uint32_t kScopeSpansScope = 1;
+constexpr std::uint32_t kScopeSpansSpans = 2;
+
+constexpr std::uint32_t kScopeName = 1;
+
+constexpr std::uint32_t kSpanTraceId = 1;
+constexpr std::uint32_t kSpanSpanId = 2;
+constexpr std::uint32_t kSpanParentSpanId = 4;
+constexpr std::uint32_t kSpanName = 5;
+constexpr std::uint32_t kSpanKind = 6;
+constexpr std::uint32_t kSpanStartTime = 7;
+constexpr std::uint32_t kSpanEndTime = 8;
+constexpr std::uint32_t kSpanAttributes = 9;
+constexpr std::uint32_t kSpanStatus = 15;
+
+constexpr std::uint32_t kStatusCode = 3;
+
+constexpr std::uint32_t kKeyValueKey = 1;
+constexpr std::uint32_t kKeyValueValue = 2;
+
+constexpr std::uint32_t kAnyValueString = 1;
+constexpr std::uint32_t kAnyValueInt = 3;
+constexpr std::uint32_t kAnyValueDouble = 4;
+
+}  // namespace fields
+
+constexpr std::uint64_t kSpanKindInternal = 1;
+constexpr std::uint64_t kStatusCodeError = 2;
+
+constexpr std::size_t kTraceIdSize = 16;
+constexpr std::size_t kSpanIdSize = 8;
+
+constexpr std::string_view kScopeNameValue = "userver";
+constexpr std::string_view kServiceNameKey = "service.name";
+
+enum class WireType : std::uint8_t {
+  kVarint = 0,
+  kFixed64 = 1,
+  kLengthDelimited = 2,
+};
+
+std::size_t VarintSize(std::uint64_t value) noexcept {
+  std::size_t size = 1;
+  for (; value >= 0x80; value >>= 7) ++size;
+  return size;
+}
+
+char* WriteVarintTo(char* out, std::uint64_t value) noexcept {
+  for (; value >= 0x80; value >>= 7) {
+    *out++ = static_cast<char>((value & 0x7F) | 0x80);
+  }
+  *out++ = static_cast<char>(value);
+  return out;
+}
+
+class ProtoWriter final {
+ public:
+  explicit ProtoWriter(std::string& out) noexcept : out_(out) {}
+
+  void Varint(std::uint32_t field, std::uint64_t value) {
+    Tag(field, WireType::kVarint);
+    WriteVarint(value);
+  }
+
+  void Fixed64(std::uint32_t field, std::uint64_t value) {
+    Tag(field, WireType::kFixed64);
+    char bytes[sizeof(value)];
+    for (auto& byte : bytes) {
+      byte = static_cast<char>(value & 0xFF);
+      value >>= 8;
+    }
+    out_.append(bytes, sizeof(bytes));
+  }
+
+  void Double(std::uint32_t field, double value) {
+    static_assert(std::numeric_limits<double>::is_iec559);
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Fixed64(field, bits);
+  }
+
+  void Bytes(std::uint32_t field, std::string_view value) {
+    Tag(field, WireType::kLengthDelimited);
+    WriteVarint(value.size());
+    out_.append(value);
+  }
+
+  // Writes the nested message built by `func(ProtoWriter&)` in place: the
+  // length is written afterwards, the message is shifted only if its length
+  // takes more than one byte.
+  template <typename Func>
+  void Message(std::uint32_t field, Func&& func) {
+    Tag(field, WireType::kLengthDelimited);
+    const auto length_pos = out_.size();
+    out_.push_back('\0');
+    func(*this);
+
+    const auto length = out_.size() - length_pos - 1;
+    const auto length_size = VarintSize(length);
+    if (length_size > 1) out_.insert(length_pos + 1, length_size - 1, '\0');
+    WriteVarintTo(out_.data() + length_pos, length);
+  }
+
+ private:
+  void Tag(std::uint32_t field, WireType type) {
+    WriteVarint((static_cast<std::uint64_t>(field) << 3) |
+                static_cast<std::uint8_t>(type));
+  }
+
+  void WriteVarint(std::uint64_t value) {
+    char buffer[10];
+    const auto* end = WriteVarintTo(buffer, value);
+    out_.append(buffer, end - buffer);
+  }
+
+  std::string& out_;
+};
+
+// userver ids are hex strings of the right size unless they came from
+// a foreign system, such ids are cut or zero padded to stay deterministic
+// across services.
+void WriteId(ProtoWriter& writer, std::uint32_t field, std::string_view id,
+             std::size_t size, std::string& buffer) {
+  if (id.size() == utils::encoding::LengthInHexForm(size) &&
+      utils::encoding::IsHexData(id)) {
+    // FromHex appends to the output
+    buffer.clear();
+    utils::encoding::FromHex(id, buffer);
+  } else {
+    buffer.assign(id.substr(0, size));
+    buffer.resize(size, '\0');
+  }
+  writer.Bytes(field, buffer);
+}
+
+void WriteAnyValue(ProtoWriter& writer, const logging::LogExtra::Value& value) {
+  std::visit(
+      utils::Overloaded{
+          [&writer](const std::string& string) {
+            writer.Bytes(fields::kAnyValueString, string);
+          },
+          [&writer](auto number) {
+            using Number = decltype(number);
+            if constexpr (std::is_floating_point_v<Number>) {
+              writer.Double(fields::kAnyValueDouble, number);
+            } else if constexpr (std::is_unsigned_v<Number> &&
+                                 sizeof(Number) >= sizeof(std::int64_t)) {
+              if (number > static_cast<std::uint64_t>(
+                               std::numeric_limits<std::int64_t>::max())) {
+                writer.Bytes(fields::kAnyValueString, std::to_string(number));
+              } else {
+                writer.Varint(fields::kAnyValueInt, number);
+              }
+            } else {
+              // int64 is encoded as a two's complement varint
+              writer.Varint(fields::kAnyValueInt,
+                            static_cast<std::uint64_t>(
+                                static_cast<std::int64_t>(number)));
+            }
+          },
+      },
+      value);
+}
+
+void WriteAttribute(ProtoWriter& writer, std::uint32_t field,
+                    std::string_view key,
+                    const logging::LogExtra::Value& value) {
+  writer.Message(field, [&](ProtoWriter& key_value) {
+    key_value.Bytes(fields::kKeyValueKey, key);
+    key_value.Message(fields::kKeyValueValue, [&](ProtoWriter& any_value) {
+      WriteAnyValue(any_value, value);
+    });
+  });
+}
+
+bool IsErrorFlagSet(const logging::LogExtra::Value& value) {
+  return std::visit(utils::Overloaded{
+                        [](const std::string& string) {
+                          return string == "true" || string == "1";
+                        },
+                        [](auto number) { return number != 0; },
+                    },
+                    value);
+}
+
+void WriteSpan(ProtoWriter& writer, const impl::SpanData& span,
+               std::string& buffer) {
+  WriteId(writer, fields::kSpanTraceId, span.trace_id, kTraceIdSize, buffer);
+  WriteId(writer, fields::kSpanSpanId, span.span_id, kSpanIdSize, buffer);
+  if (!span.parent_id.empty()) {
+    WriteId(writer, fields::kSpanParentSpanId, span.parent_id, kSpanIdSize,
+            buffer);
+  }
+  writer.Bytes(fields::kSpanName, span.name);
+  writer.Varint(fields::kSpanKind, kSpanKindInternal);
+
+  const auto to_nanos = [](std::chrono::system_clock::time_point time) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            time.time_since_epoch())
+            .count());
+  };
+  writer.Fixed64(fields::kSpanStartTime, to_nanos(span.start_time));
+  writer.Fixed64(fields::kSpanEndTime, to_nanos(span.end_time));
+
+  bool is_error = false;
+  for (const auto& [key, value] : span.tags) {
+    if (key == kErrorFlag) {
+      is_error = IsErrorFlagSet(value);
+      continue;
+    }
+    WriteAttribute(writer, fields::kSpanAttributes, key, value);
+  }
+
+  if (is_error) {
+    writer.Message(fields::kSpanStatus, [](ProtoWriter& status) {
+      status.Varint(fields::kStatusCode, kStatusCodeError);
+    });
+  }
+}
+
+}  // namespace
+
+std::string EncodeExportTraceRequest(std::string_view service_name,
+                                     const std::vector<impl::SpanData>& spans) {
+  std::string result;
+  std::string id_buffer;
+  ProtoWriter writer{result};
+
+  const auto write_resource_spans = [&](ProtoWriter& resource_spans) {
+    resource_spans.Message(
+        fields::kResourceSpansResource, [&](ProtoWriter& resource) {
+          WriteAttribute(resource, fields::kResourceAttributes,
+                         kServiceNameKey, std::string{service_name});
+        });
+
+    resource_spans.Message(
+        fields::kResourceSpansScopeSpans, [&](ProtoWriter& scope_spans) {
+          scope_spans.Message(fields::kScopeSpansScope, [](ProtoWriter& scope) {
+            scope.Bytes(fields::kScopeName, kScopeNameValue);
+          });
+          for (const auto& span : spans) {
+            scope_spans.Message(
+                fields::kScopeSpansSpans, [&](ProtoWriter& span_writer) {
+                  WriteSpan(span_writer, span, id_buffer);
+                });
+          }
+        });
+  };
+  writer.Message(fields::kRequestResourceSpans, write_resource_spans);
+
+  return result;
+}
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
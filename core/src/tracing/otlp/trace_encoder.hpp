@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tracing/span_exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+/// @brief Encodes the spans into the protobuf wire format of the OTLP
+/// `opentelemetry.proto.collector.trace.v1.ExportTraceServiceRequest`
+///
+/// The message is simple and stable enough to be written by hand, so
+/// the core does not depend on protobuf and on the generated code.
+std::string EncodeExportTraceRequest(std::string_view service_name,
+                                     const std::vector<impl::SpanData>& spans);
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
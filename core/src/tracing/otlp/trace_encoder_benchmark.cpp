@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <compression/gzip.hpp>
+#include <tracing/otlp/trace_encoder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::vector<tracing::impl::SpanData> MakeSpans(std::size_t count) {
+  tracing::impl::SpanData span;
+  span.name = "http/handler-v1_upload-post";
+  span.trace_id = "2f6bf12265934260876a236c373b37dc";
+  span.span_id = "8f828566189db0d0";
+  span.parent_id = "fdae1985431a6a57";
+  span.start_time = std::chrono::system_clock::now();
+  span.end_time = span.start_time + std::chrono::milliseconds{36};
+  span.tags = {
+      {"meta_type", std::string{"/v1/upload"}},
+      {"method", std::string{"POST"}},
+      {"meta_code", 200},
+      {"link", std::string{"48e0029fc25e460880529b9d300967df"}},
+      {"http_handle_request_time", 36.277501},
+  };
+  return std::vector<tracing::impl::SpanData>(count, span);
+}
+
+void otlp_encode_spans(benchmark::State& state) {
+  const auto spans = MakeSpans(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        tracing::otlp::EncodeExportTraceRequest("test_service", spans));
+  }
+  state.SetItemsProcessed(state.iterations() * spans.size());
+}
+BENCHMARK(otlp_encode_spans)->Arg(1)->Arg(512);
+
+void otlp_encode_and_compress_spans(benchmark::State& state) {
+  const auto spans = MakeSpans(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(compression::gzip::Compress(
+        tracing::otlp::EncodeExportTraceRequest("test_service", spans)));
+  }
+  state.SetItemsProcessed(state.iterations() * spans.size());
+}
+BENCHMARK(otlp_encode_and_compress_spans)->Arg(512);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,189 @@
+#include <tracing/otlp/trace_encoder.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// A minimal protobuf reader: maps the field numbers to the raw values of the
+// length-delimited fields and to the values of the numeric fields
+struct Fields {
+  std::multimap<std::uint32_t, std::string> messages;
+  std::multimap<std::uint32_t, std::uint64_t> numbers;
+
+  std::string Message(std::uint32_t field) const {
+    EXPECT_EQ(messages.count(field), 1) << "field " << field;
+    const auto it = messages.find(field);
+    return it == messages.end() ? std::string{} : it->second;
+  }
+
+  std::uint64_t Number(std::uint32_t field) const {
+    EXPECT_EQ(numbers.count(field), 1) << "field " << field;
+    const auto it = numbers.find(field);
+    return it == numbers.end() ? 0 : it->second;
+  }
+};
+
+std::uint64_t ReadVarint(std::string_view& data) {
+  std::uint64_t result = 0;
+  for (int shift = 0; !data.empty(); shift += 7) {
+    const auto byte = static_cast<std::uint8_t>(data.front());
+    data.remove_prefix(1);
+    result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return result;
+  }
+  ADD_FAILURE() << "truncated varint";
+  return result;
+}
+
+Fields Parse(std::string_view data) {
+  Fields fields;
+  while (!data.empty()) {
+    const auto tag = ReadVarint(data);
+    const auto field = static_cast<std::uint32_t>(tag >> 3);
+    switch (tag & 7) {
+      case 0:
+        fields.numbers.emplace(field, ReadVarint(data));
+        break;
+      case 1: {
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) {
+          value = (value << 8) | static_cast<std::uint8_t>(data[i]);
+        }
+        data.remove_prefix(8);
+        fields.numbers.emplace(field, value);
+        break;
+      }
+      case 2: {
+        const auto size = ReadVarint(data);
+        EXPECT_LE(size, data.size());
+        fields.messages.emplace(field, std::string{data.substr(0, size)});
+        data.remove_prefix(size);
+        break;
+      }
+      default:
+        ADD_FAILURE() << "unexpected wire type " << (tag & 7);
+        return fields;
+    }
+  }
+  return fields;
+}
+
+tracing::impl::SpanData MakeSpan() {
+  tracing::impl::SpanData span;
+  span.name = "handler";
+  span.trace_id = "0123456789abcdef0123456789abcdef";
+  span.span_id = "0011223344556677";
+  span.parent_id = "8899aabbccddeeff";
+  span.start_time = std::chrono::system_clock::time_point{
+      std::chrono::seconds{1'700'000'000}};
+  span.end_time = span.start_time + std::chrono::milliseconds{5};
+  return span;
+}
+
+// ExportTraceServiceRequest -> ResourceSpans -> ScopeSpans
+Fields ParseScopeSpans(const std::string& request) {
+  const auto resource_spans = Parse(Parse(request).Message(1));
+  return Parse(resource_spans.Message(2));
+}
+
+}  // namespace
+
+TEST(OtlpTraceEncoder, Resource) {
+  const auto request =
+      tracing::otlp::EncodeExportTraceRequest("my-service", {MakeSpan()});
+
+  const auto resource = Parse(Parse(Parse(request).Message(1)).Message(1));
+  const auto attribute = Parse(resource.Message(1));
+  EXPECT_EQ(attribute.Message(1), "service.name");
+  EXPECT_EQ(Parse(attribute.Message(2)).Message(1), "my-service");
+
+  const auto scope = Parse(ParseScopeSpans(request).Message(1));
+  EXPECT_EQ(scope.Message(1), "userver");
+}
+
+TEST(OtlpTraceEncoder, Span) {
+  const auto request =
+      tracing::otlp::EncodeExportTraceRequest("my-service", {MakeSpan()});
+
+  const auto span = Parse(ParseScopeSpans(request).Message(2));
+  EXPECT_EQ(utils::encoding::ToHex(span.Message(1)),
+            "0123456789abcdef0123456789abcdef");
+  EXPECT_EQ(utils::encoding::ToHex(span.Message(2)), "0011223344556677");
+  EXPECT_EQ(utils::encoding::ToHex(span.Message(4)), "8899aabbccddeeff");
+  EXPECT_EQ(span.Message(5), "handler");
+  EXPECT_EQ(span.Number(6), 1);  // SPAN_KIND_INTERNAL
+  EXPECT_EQ(span.Number(7), 1'700'000'000'000'000'000);
+  EXPECT_EQ(span.Number(8), 1'700'000'000'005'000'000);
+  EXPECT_EQ(span.messages.count(9), 0);
+  EXPECT_EQ(span.messages.count(15), 0);
+}
+
+TEST(OtlpTraceEncoder, Attributes) {
+  auto data = MakeSpan();
+  data.tags = {
+      {"string", std::string(300, 's')},
+      {"int", -3},
+      {"unsigned", 18446744073709551615ULL},
+      {"double", 0.5},
+  };
+  const auto request =
+      tracing::otlp::EncodeExportTraceRequest("my-service", {data});
+  const auto span = Parse(ParseScopeSpans(request).Message(2));
+
+  std::map<std::string, Fields> attributes;
+  const auto range = span.messages.equal_range(9);
+  for (auto it = range.first; it != range.second; ++it) {
+    const auto key_value = Parse(it->second);
+    attributes.emplace(key_value.Message(1), Parse(key_value.Message(2)));
+  }
+  ASSERT_EQ(attributes.size(), 4);
+
+  EXPECT_EQ(attributes["string"].Message(1), std::string(300, 's'));
+  EXPECT_EQ(static_cast<std::int64_t>(attributes["int"].Number(3)), -3);
+  EXPECT_EQ(attributes["unsigned"].Message(1), "18446744073709551615");
+
+  const auto double_bits = attributes["double"].Number(4);
+  double value = 0;
+  std::memcpy(&value, &double_bits, sizeof(value));
+  EXPECT_EQ(value, 0.5);
+}
+
+TEST(OtlpTraceEncoder, ErrorStatus) {
+  auto data = MakeSpan();
+  data.tags = {{"error", 1}};
+  const auto request =
+      tracing::otlp::EncodeExportTraceRequest("my-service", {data});
+  const auto span = Parse(ParseScopeSpans(request).Message(2));
+
+  EXPECT_EQ(span.messages.count(9), 0);
+  EXPECT_EQ(Parse(span.Message(15)).Number(3), 2);  // STATUS_CODE_ERROR
+}
+
+TEST(OtlpTraceEncoder, ForeignIds) {
+  auto data = MakeSpan();
+  data.trace_id = "not-a-hex-id";
+  data.parent_id.clear();
+  const auto request =
+      tracing::otlp::EncodeExportTraceRequest("my-service", {data});
+  const auto span = Parse(ParseScopeSpans(request).Message(2));
+
+  EXPECT_EQ(span.Message(1), std::string("not-a-hex-id\0\0\0\0", 16));
+  EXPECT_EQ(span.messages.count(4), 0);
+}
+
+TEST(OtlpTraceEncoder, ManySpans) {
+  std::vector<tracing::impl::SpanData> spans(1000, MakeSpan());
+  const auto request =
+      tracing::otlp::EncodeExportTraceRequest("my-service", spans);
+  EXPECT_EQ(ParseScopeSpans(request).messages.count(2), spans.size());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/tracing/otlp_exporter_component.hpp>
+
+#include <userver/clients/http/component.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <tracing/otlp/exporter.hpp>
+#include <tracing/span_exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+OtlpExporterComponent::OtlpExporterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : components::LoggableComponentBase(config, context),
+      exporter_(std::make_shared<otlp::Exporter>(
+          context
+              .FindComponent<components::HttpClient>(
+                  config["http-client"].As<std::string>("http-client"))
+              .GetHttpClient(),
+          config.As<otlp::ExporterConfig>())) {
+  auto& task_processor =
+      config.HasMember("task_processor")
+          ? context.GetTaskProcessor(
+                config["task_processor"].As<std::string>())
+          : engine::current_task::GetTaskProcessor();
+  exporter_->Start(task_processor);
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("tracing.otlp",
+                          [this](utils::statistics::Writer& writer) {
+                            writer = exporter_->GetStatistics();
+                          });
+
+  impl::SetSpanExporter(exporter_);
+}
+
+OtlpExporterComponent::~OtlpExporterComponent() {
+  impl::SetSpanExporter(nullptr);
+  statistics_holder_.Unregister();
+  exporter_->Stop();
+}
+
+yaml_config::Schema OtlpExporterComponent::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: sends the spans to an OpenTelemetry collector over OTLP/HTTP
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: URL of the OTLP/HTTP traces receiver
+    http-client:
+        type: string
+        description: name of the components::HttpClient to send the spans with
+        defaultDescription: http-client
+    task_processor:
+        type: string
+        description: task processor for the background sending task
+        defaultDescription: the task processor of the component
+    max-queue-size:
+        type: integer
+        description: max count of the spans waiting to be sent
+        defaultDescription: 65536
+        minimum: 1
+    max-batch-size:
+        type: integer
+        description: max count of the spans in a single request
+        defaultDescription: 512
+        minimum: 1
+    export-interval:
+        type: string
+        description: max time a span waits in the queue
+        defaultDescription: 1s
+    timeout:
+        type: string
+        description: timeout of a request to the collector
+        defaultDescription: 1s
+    compression:
+        type: string
+        description: compression of the requests
+        defaultDescription: gzip
+        enum:
+          - gzip
+          - none
+    log-spans:
+        type: boolean
+        description: whether to also write the spans into the default logger
+        defaultDescription: true
+)");
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// Head- and tail-based sampling of the traces started by this service
+struct SamplingConfig {
+  /// Probability for a new trace to be sampled, the decision is inherited by
+  /// all the spans of the trace and is propagated to the downstream services
+  double rate{1.0};
+
+  /// Not sampled traces are still logged if their local root span lasts
+  /// longer, zero disables the check
+  std::chrono::milliseconds slow_threshold{0};
+
+  /// Not sampled traces are still logged if any of their spans has the
+  /// tracing::kErrorFlag tag
+  bool keep_errors{false};
+
+  bool IsTailSamplingEnabled() const noexcept {
+    return slow_threshold.count() > 0 || keep_errors;
+  }
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -1,23 +1,40 @@
 #include <tracing/span_impl.hpp>
 
-#include <random>
+#include <algorithm>
+#include <mutex>
 #include <type_traits>
 
+#include <boost/container/small_vector.hpp>
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <compiler/tls.hpp>
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
+#include <tracing/sampling.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/overloaded.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
+#include <utils/cpu_profiler.hpp>
 #include <utils/internal_tag.hpp>
+#include <utils/task_cpu_usage.hpp>
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define HAS_ASAN 1
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__)
+#define HAS_ASAN 1
+#endif
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,6 +53,9 @@ constexpr std::string_view kReferenceType = "span_ref_type";
 const std::string kReferenceTypeChild = "child";
 const std::string kReferenceTypeFollows = "follows";
 
+// Bounds the memory used by a not sampled trace with lots of spans
+constexpr std::size_t kMaxDeferredSpans = 1000;
+
 std::string_view StartTsToString(std::chrono::system_clock::time_point start) {
   const auto start_ts_epoch =
       std::chrono::duration_cast<std::chrono::microseconds>(
@@ -66,9 +86,73 @@ std::string_view StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
+// The profilers should be notified on each change of the innermost span
+bool IsInnermostSpanTracked() noexcept {
+  return utils::cpu_profiler::IsProfiling() ||
+         utils::task_cpu_usage::IsEnabled();
+}
+
+std::string_view GetInnermostSpanName() {
+  const auto* spans_ptr = task_local_spans.GetOptional();
+  if (!spans_ptr || spans_ptr->empty()) return {};
+  return spans_ptr->back().GetName();
+}
+
+void OnInnermostSpanChange(std::string_view previous_name,
+                           std::string_view new_name) noexcept {
+  utils::cpu_profiler::SetCurrentSpanName(new_name);
+  utils::task_cpu_usage::ChargeCurrentTask(previous_name);
+}
+
+// The memory of the destroyed Span::Impl is cached per thread, so that the
+// short-lived spans of DB and HTTP calls do not hit the allocator
+constexpr std::size_t kMaxCachedImplsPerThread = 64;
+
+#ifdef HAS_ASAN
+// The cache would hide use-after-free of spans
+constexpr bool kIsImplCacheEnabled = false;
+#else
+constexpr bool kIsImplCacheEnabled = true;
+#endif
+
+struct FreeImpl final {
+  FreeImpl* next;
+};
+
+struct ImplCache final {
+  FreeImpl* head;
+  std::size_t size;
+  bool is_disabled;
+};
+
+// Trivially destructible, so that it stays accessible for the spans that die
+// in the destructors of other thread-locals
+thread_local ImplCache local_impl_cache{};
+
+struct ImplCacheDrainer final {
+  ~ImplCacheDrainer();
+};
+
+USERVER_PREVENT_TLS_CACHING ImplCache& GetLocalImplCache() noexcept {
+  // Frees the cached memory on thread exit
+  thread_local ImplCacheDrainer drainer;
+  (void)drainer;
+  return local_impl_cache;
+}
+
+USERVER_PREVENT_TLS_CACHING ImplCacheDrainer::~ImplCacheDrainer() {
+  local_impl_cache.is_disabled = true;
+  while (local_impl_cache.head) {
+    auto* const block = local_impl_cache.head;
+    local_impl_cache.head = block->next;
+    ::operator delete(block);
+  }
+  local_impl_cache.size = 0;
+}
+
 std::string GenerateSpanId() {
-  std::uniform_int_distribution<std::uint64_t> dist;
-  auto random_value = dist(utils::DefaultRandom());
+  std::uint64_t random_value = 0;
+  utils::RandFill(&random_value, sizeof(random_value));
 
   static_assert(sizeof(random_value) == 8);
   return utils::encoding::ToHex(&random_value, 8);
@@ -76,6 +160,43 @@ std::string GenerateSpanId() {
 
 }  // namespace
 
+struct Span::Impl::DeferredSpans final {
+  enum class State { kPending, kKept, kDropped };
+
+  std::mutex mutex;
+  State state{State::kPending};
+  bool has_error{false};
+  std::vector<std::unique_ptr<Span::Impl>> spans;
+};
+
+void* Span::Impl::operator new(std::size_t size) {
+  UASSERT(size == sizeof(Impl));
+  if constexpr (kIsImplCacheEnabled) {
+    auto& cache = GetLocalImplCache();
+    if (cache.head) {
+      auto* const block = cache.head;
+      cache.head = block->next;
+      --cache.size;
+      return block;
+    }
+  }
+  return ::operator new(size);
+}
+
+void Span::Impl::operator delete(void* ptr) noexcept {
+  if constexpr (kIsImplCacheEnabled) {
+    auto& cache = GetLocalImplCache();
+    if (!cache.is_disabled && cache.size < kMaxCachedImplsPerThread) {
+      cache.head = new (ptr) FreeImpl{cache.head};
+      ++cache.size;
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+static_assert(alignof(Span::Impl) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
 Span::Impl::Impl(std::string name, ReferenceType reference_type,
                  logging::Level log_level,
                  utils::impl::SourceLocation source_location)
@@ -91,34 +212,58 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
+      trace_id_(parent ? parent->trace_id_
+                       : std::make_shared<const std::string>(
+                             utils::generators::GenerateUuid())),
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
-      source_location_(source_location) {
+      source_location_(source_location),
+      is_local_root_(parent == nullptr) {
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    sampling_ = parent->sampling_;
+    deferred_spans_ = parent->deferred_spans_;
+  } else {
+    const auto rate = tracing::Tracer::GetSamplingConfig().rate;
+    SetSampled(rate >= 1.0 || (rate > 0.0 && utils::RandRange(1.0) < rate));
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
+  // The hook unlinks the span silently, the profilers should know the new
+  // innermost span of the task
+  if (is_linked() && IsInnermostSpanTracked()) {
+    DetachFromCoroStack();
+    utils::task_cpu_usage::CountFinishedSpan(name_);
+  }
+
+  if (sampling_ == Sampling::kDeferred && !FinishDeferred()) {
     return;
   }
+  if (sampling_ == Sampling::kDropped || !ShouldLog()) {
+    return;
+  }
+  if (finish_steady_time_ == std::chrono::steady_clock::time_point{}) {
+    finish_steady_time_ = std::chrono::steady_clock::now();
+  }
 
-  {
+  const auto exporter = impl::GetSpanExporter();
+  if (!exporter || exporter->ShouldLogSpans()) {
     const DetachLocalSpansScope ignore_local_span;
     logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
                           source_location_};
     PutIntoLogger(lh.GetTagWriterAfterText({}));
   }
+
+  if (exporter) {
+    exporter->Export(std::move(*this).MakeSpanData());
+  }
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) {
-  const auto steady_now = std::chrono::steady_clock::now();
-  const auto duration = steady_now - start_steady_time_;
+  const auto duration = finish_steady_time_ - start_steady_time_;
   const auto total_time_ms =
       std::chrono::duration_cast<RealMilliseconds>(duration).count();
 
@@ -145,11 +290,139 @@ void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   tracer_->LogSpanContextTo(*this, writer);
 }
 
-void Span::Impl::DetachFromCoroStack() { unlink(); }
+impl::SpanData Span::Impl::MakeSpanData() && {
+  const auto duration = finish_steady_time_ - start_steady_time_;
+
+  impl::SpanData data;
+  data.name = name_;
+  data.trace_id = *trace_id_;
+  data.span_id = std::move(span_id_);
+  data.parent_id = std::move(parent_id_);
+  data.start_time = start_system_time_;
+  data.end_time =
+      start_system_time_ +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(duration);
+
+  // Local tags take precedence over the inherited ones with the same keys
+  if (log_extra_local_) MoveTagsInto(data.tags, *log_extra_local_);
+  MoveTagsInto(data.tags, log_extra_inheritable_);
+  return data;
+}
+
+void Span::Impl::MoveTagsInto(std::vector<logging::LogExtra::Pair>& output,
+                              logging::LogExtra& input) {
+  const auto local_tags_count = output.size();
+  for (auto& [key, value] : *input.extra_) {
+    const auto& tag_key = key;
+    const auto is_overridden = std::any_of(
+        output.begin(), output.begin() + local_tags_count,
+        [&tag_key](const auto& tag) { return tag.first == tag_key; });
+    if (!is_overridden) {
+      output.emplace_back(std::move(key), std::move(value.GetValue()));
+    }
+  }
+}
+
+void Span::Impl::SetSampled(bool sampled) {
+  // The decision of the local parent span takes precedence
+  if (!is_local_root_) return;
+
+  deferred_spans_.reset();
+  if (sampled) {
+    sampling_ = Sampling::kSampled;
+  } else if (tracing::Tracer::GetSamplingConfig().IsTailSamplingEnabled()) {
+    sampling_ = Sampling::kDeferred;
+    deferred_spans_ = std::make_shared<DeferredSpans>();
+  } else {
+    sampling_ = Sampling::kDropped;
+  }
+}
+
+bool Span::Impl::FinishDeferred() {
+  UASSERT(deferred_spans_);
+  finish_steady_time_ = std::chrono::steady_clock::now();
+  // The buffered copies of the spans must not refer to the buffer
+  const auto deferred_spans = std::move(deferred_spans_);
+  std::unique_lock lock{deferred_spans->mutex};
+
+  if (is_local_root_) {
+    const auto config = tracing::Tracer::GetSamplingConfig();
+    const bool is_slow =
+        config.slow_threshold.count() > 0 &&
+        finish_steady_time_ - start_steady_time_ >= config.slow_threshold;
+    const bool is_error =
+        config.keep_errors && (deferred_spans->has_error || HasErrorTag());
+    const bool keep = is_slow || is_error;
+
+    deferred_spans->state = keep ? DeferredSpans::State::kKept
+                                 : DeferredSpans::State::kDropped;
+    auto spans = std::move(deferred_spans->spans);
+    lock.unlock();
+
+    for (auto& span : spans) {
+      if (keep) span->sampling_ = Sampling::kSampled;
+      // Logs the kept span
+      span.reset();
+    }
+    return keep;
+  }
+
+  switch (deferred_spans->state) {
+    case DeferredSpans::State::kKept:
+      return true;
+    case DeferredSpans::State::kDropped:
+      return false;
+    case DeferredSpans::State::kPending:
+      break;
+  }
+
+  if (HasErrorTag()) deferred_spans->has_error = true;
+  if (ShouldLog() && deferred_spans->spans.size() < kMaxDeferredSpans) {
+    auto span = std::make_unique<Impl>(std::move(*this));
+    span->sampling_ = Sampling::kDropped;
+    deferred_spans->spans.push_back(std::move(span));
+  }
+  return false;
+}
+
+bool Span::Impl::HasErrorTag() const {
+  const auto has_error = [](const logging::LogExtra& tags) {
+    // A missing tag is an empty string
+    return std::visit(utils::Overloaded{
+                          [](const std::string& string) {
+                            return string == "true" || string == "1";
+                          },
+                          [](auto number) { return number != 0; },
+                      },
+                      tags.GetValue(kErrorFlag));
+  };
+  return has_error(log_extra_inheritable_) ||
+         (log_extra_local_ && has_error(*log_extra_local_));
+}
+
+void Span::Impl::DetachFromCoroStack() {
+  if (!IsInnermostSpanTracked()) {
+    unlink();
+    return;
+  }
+
+  // Points either to this span or to the innermost one, that both outlive
+  // the call
+  const auto previous_name = GetInnermostSpanName();
+  unlink();
+  OnInnermostSpanChange(previous_name, GetInnermostSpanName());
+}
 
 void Span::Impl::AttachToCoroStack() {
   UASSERT(!is_linked());
+  if (!IsInnermostSpanTracked()) {
+    task_local_spans->push_back(*this);
+    return;
+  }
+
+  const auto previous_name = GetInnermostSpanName();
   task_local_spans->push_back(*this);
+  OnInnermostSpanChange(previous_name, name_);
 }
 
 std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
@@ -307,6 +580,7 @@ tracing::ScopeTime Span::CreateScopeTime(std::string name) {
 
 void Span::AddNonInheritableTag(std::string key,
                                 logging::LogExtra::Value value) {
+  if (!pimpl_->IsTagStorageEnabled()) return;
   if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
@@ -327,10 +601,12 @@ std::optional<logging::Level> Span::GetLocalLogLevel() const {
 }
 
 void Span::AddTag(std::string key, logging::LogExtra::Value value) {
+  if (!pimpl_->IsTagStorageEnabled()) return;
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value));
 }
 
 void Span::AddTags(const logging::LogExtra& log_extra, utils::InternalTag) {
+  if (!pimpl_->IsTagStorageEnabled()) return;
   pimpl_->log_extra_inheritable_.Extend(log_extra);
 }
 
@@ -346,16 +622,21 @@ std::string Span::GetTag(std::string_view tag) const {
 }
 
 void Span::AddTagFrozen(std::string key, logging::LogExtra::Value value) {
+  if (!pimpl_->IsTagStorageEnabled()) return;
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value),
                                         logging::LogExtra::ExtendType::kFrozen);
 }
 
+// Links are kept even for the not sampled spans, they are propagated to the
+// other services and are written into the logs
 void Span::SetLink(std::string link) {
-  AddTagFrozen(kLinkTag, std::move(link));
+  pimpl_->log_extra_inheritable_.Extend(kLinkTag, std::move(link),
+                                        logging::LogExtra::ExtendType::kFrozen);
 }
 
 void Span::SetParentLink(std::string parent_link) {
-  AddTagFrozen(kParentLinkTag, std::move(parent_link));
+  pimpl_->log_extra_inheritable_.Extend(kParentLinkTag, std::move(parent_link),
+                                        logging::LogExtra::ExtendType::kFrozen);
 }
 
 std::string Span::GetLink() const { return GetTag(kLinkTag); }
@@ -368,6 +649,8 @@ void Span::LogTo(logging::impl::TagWriter writer) const& {
 
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
+bool Span::IsSampled() const noexcept { return pimpl_->IsSampled(); }
+
 void Span::DetachFromCoroStack() {
   if (pimpl_) pimpl_->DetachFromCoroStack();
 }
@@ -17,7 +17,9 @@ SpanBuilder::SpanBuilder(std::string name,
              Span::OptionalDeleter{Span::OptionalDeleter::ShouldDelete()}) {
   pimpl_->AttachToCoroStack();
   if (pimpl_->GetParentId().empty()) {
-    AddTagFrozen(kLinkTag, utils::generators::GenerateUuid());
+    pimpl_->log_extra_inheritable_.Extend(
+        kLinkTag, utils::generators::GenerateUuid(),
+        logging::LogExtra::ExtendType::kFrozen);
   }
 }
 
@@ -39,14 +41,18 @@ const std::string& SpanBuilder::GetTraceId() const noexcept {
 
 void SpanBuilder::AddTagFrozen(std::string key,
                                logging::LogExtra::Value value) {
+  if (!pimpl_->IsTagStorageEnabled()) return;
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value),
                                         logging::LogExtra::ExtendType::kFrozen);
 }
 
 void SpanBuilder::SetParentLink(std::string parent_link) {
-  AddTagFrozen(kParentLinkTag, std::move(parent_link));
+  pimpl_->log_extra_inheritable_.Extend(kParentLinkTag, std::move(parent_link),
+                                        logging::LogExtra::ExtendType::kFrozen);
 }
 
+void SpanBuilder::SetSampled(bool sampled) { pimpl_->SetSampled(sampled); }
+
 Span SpanBuilder::Build() && { return Span(std::move(pimpl_)); }
 
 }  // namespace tracing
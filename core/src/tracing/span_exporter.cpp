@@ -0,0 +1,29 @@
+#include <tracing/span_exporter.hpp>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+auto& SpanExporterInternal() {
+  static rcu::Variable<SpanExporterPtr> span_exporter_ptr;
+  return span_exporter_ptr;
+}
+}  // namespace
+
+SpanExporter::~SpanExporter() = default;
+
+SpanExporterPtr GetSpanExporter() { return SpanExporterInternal().ReadCopy(); }
+
+void SetSpanExporter(SpanExporterPtr exporter) {
+  UASSERT(engine::current_task::IsTaskProcessorThread());
+  SpanExporterInternal().Assign(std::move(exporter));
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/logging/log_extra.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// The data of a finished span
+struct SpanData final {
+  std::string name;
+  std::string trace_id;
+  std::string span_id;
+  std::string parent_id;
+  std::chrono::system_clock::time_point start_time;
+  std::chrono::system_clock::time_point end_time;
+  std::vector<logging::LogExtra::Pair> tags;
+};
+
+/// Receives the spans that are destroyed while the exporter is set
+class SpanExporter {
+ public:
+  explicit SpanExporter(bool log_spans) noexcept : log_spans_(log_spans) {}
+  virtual ~SpanExporter();
+
+  /// Must not block, is called from the span destructors on any thread
+  virtual void Export(SpanData&& span) noexcept = 0;
+
+  /// Whether the spans should still be written into the default logger
+  bool ShouldLogSpans() const noexcept { return log_spans_; }
+
+ private:
+  const bool log_spans_;
+};
+
+using SpanExporterPtr = std::shared_ptr<SpanExporter>;
+
+/// Returns the current exporter or nullptr
+SpanExporterPtr GetSpanExporter();
+
+/// Must be called from a coroutine
+void SetSpanExporter(SpanExporterPtr exporter);
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
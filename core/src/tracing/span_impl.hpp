@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -18,6 +20,7 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/span_exporter.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -45,6 +48,10 @@ class Span::Impl
 
   ~Impl();
 
+  // The memory of the destroyed spans is cached per thread
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr) noexcept;
+
   impl::TimeStorage& GetTimeStorage() { return time_storage_; }
   const impl::TimeStorage& GetTimeStorage() const { return time_storage_; }
 
@@ -52,29 +59,53 @@ class Span::Impl
 
   void LogTo(logging::impl::TagWriter writer);
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
+  const std::string& GetTraceId() const& noexcept { return *trace_id_; }
   const std::string& GetSpanId() const& noexcept { return span_id_; }
   const std::string& GetParentId() const& noexcept { return parent_id_; }
 
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
   std::string GetSpanId() && noexcept { return std::move(span_id_); }
   std::string GetParentId() && noexcept { return std::move(parent_id_); }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
+  void SetTraceId(std::string&& id) {
+    trace_id_ = std::make_shared<const std::string>(std::move(id));
+  }
   void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
   void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  const std::string& GetName() const noexcept { return name_; }
+
+  /// Overrides the head-based sampling decision of a local root span, e.g.
+  /// with the one that came in the request headers
+  void SetSampled(bool sampled);
+  bool IsSampled() const noexcept { return sampling_ == Sampling::kSampled; }
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
  private:
+  // kDeferred spans are kept in DeferredSpans until the local root span of
+  // the trace decides whether to log them, kDropped ones store no tags and
+  // are not logged at all
+  enum class Sampling { kSampled, kDeferred, kDropped };
+  struct DeferredSpans;
+
+  bool FinishDeferred();
+  bool HasErrorTag() const;
+  bool IsTagStorageEnabled() const noexcept {
+    return sampling_ != Sampling::kDropped;
+  }
+
   void LogOpenTracing() const;
   void DoLogOpenTracing(logging::impl::TagWriter writer) const;
   static void AddOpentracingTags(formats::json::StringBuilder& output,
                                  const logging::LogExtra& input);
 
+  impl::SpanData MakeSpanData() &&;
+  static void MoveTagsInto(std::vector<logging::LogExtra::Pair>& output,
+                           logging::LogExtra& input);
+
   static std::string GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
 
@@ -93,13 +124,19 @@ class Span::Impl
 
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
+  std::chrono::steady_clock::time_point finish_steady_time_;
 
-  std::string trace_id_;
+  // Shared with the child spans to not copy it for each of them
+  std::shared_ptr<const std::string> trace_id_;
   std::string span_id_;
   std::string parent_id_;
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  const bool is_local_root_;
+  Sampling sampling_{Sampling::kSampled};
+  std::shared_ptr<DeferredSpans> deferred_spans_;
+
   friend class Span;
   friend class SpanBuilder;
 };
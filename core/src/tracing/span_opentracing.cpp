@@ -93,8 +93,7 @@ void Span::Impl::LogOpenTracing() const {
 }
 
 void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
-  const auto steady_now = std::chrono::steady_clock::now();
-  const auto duration = steady_now - start_steady_time_;
+  const auto duration = finish_steady_time_ - start_steady_time_;
   const auto duration_microseconds =
       std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
   auto start_time = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -104,7 +103,7 @@ void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
   if (tracer_) {
     writer.PutTag(jaeger::kServiceName, tracer_->GetServiceName());
   }
-  writer.PutTag(jaeger::kTraceId, trace_id_);
+  writer.PutTag(jaeger::kTraceId, *trace_id_);
   writer.PutTag(jaeger::kParentId, parent_id_);
   writer.PutTag(jaeger::kSpanId, span_id_);
   writer.PutTag(jaeger::kStartTime, start_time);
@@ -4,11 +4,16 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampling.hpp>
+#include <tracing/span_exporter.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/noop.hpp>
 #include <userver/tracing/opentracing.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_builder.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -74,6 +79,57 @@ class OpentracingSpan : public Span {
   std::shared_ptr<logging::impl::TpLogger> opentracing_logger_;
 };
 
+class CollectingSpanExporter final : public tracing::impl::SpanExporter {
+ public:
+  explicit CollectingSpanExporter(bool log_spans) : SpanExporter(log_spans) {}
+
+  void Export(tracing::impl::SpanData&& span) noexcept override {
+    const std::lock_guard lock{mutex_};
+    spans_.push_back(std::move(span));
+  }
+
+  std::vector<tracing::impl::SpanData> GetSpans() {
+    const std::lock_guard lock{mutex_};
+    return spans_;
+  }
+
+ private:
+  engine::Mutex mutex_;
+  std::vector<tracing::impl::SpanData> spans_;
+};
+
+class ExportedSpan : public Span {
+ protected:
+  void SetExporter(bool log_spans) {
+    exporter_ = std::make_shared<CollectingSpanExporter>(log_spans);
+    tracing::impl::SetSpanExporter(exporter_);
+  }
+
+  void TearDown() override {
+    tracing::impl::SetSpanExporter({});
+    Span::TearDown();
+  }
+
+  std::vector<tracing::impl::SpanData> GetExportedSpans() {
+    return exporter_->GetSpans();
+  }
+
+ private:
+  std::shared_ptr<CollectingSpanExporter> exporter_;
+};
+
+class SampledSpan : public Span {
+ protected:
+  void SetSampling(tracing::SamplingConfig config) {
+    tracing::Tracer::SetSamplingConfig(config);
+  }
+
+  void TearDown() override {
+    tracing::Tracer::SetSamplingConfig({});
+    Span::TearDown();
+  }
+};
+
 UTEST_F(Span, Ctr) {
   {
     logging::LogFlush();
@@ -726,4 +782,222 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
   }
 }
 
+UTEST_F(ExportedSpan, Export) {
+  SetExporter(true);
+  std::string trace_id;
+  std::string span_id;
+  {
+    tracing::Span span("span_name");
+    span.AddTag("meta_code", 200);
+    span.AddTag("key", "inherited");
+    span.AddNonInheritableTag("key", "local");
+    trace_id = span.GetTraceId();
+    span_id = span.GetSpanId();
+
+    tracing::Span child("child_name");
+  }
+
+  const auto spans = GetExportedSpans();
+  ASSERT_EQ(spans.size(), 2);
+
+  EXPECT_EQ(spans[0].name, "child_name");
+  EXPECT_EQ(spans[0].trace_id, trace_id);
+  EXPECT_EQ(spans[0].parent_id, span_id);
+
+  const auto& span = spans[1];
+  EXPECT_EQ(span.name, "span_name");
+  EXPECT_EQ(span.trace_id, trace_id);
+  EXPECT_EQ(span.span_id, span_id);
+  EXPECT_LE(span.start_time, span.end_time);
+
+  EXPECT_EQ(std::count(span.tags.begin(), span.tags.end(),
+                       logging::LogExtra::Pair{"key", "local"}),
+            1);
+  EXPECT_EQ(std::count(span.tags.begin(), span.tags.end(),
+                       logging::LogExtra::Pair{"key", "inherited"}),
+            0);
+  EXPECT_EQ(std::count(span.tags.begin(), span.tags.end(),
+                       logging::LogExtra::Pair{"meta_code", 200}),
+            1);
+
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+}
+
+UTEST_F(ExportedSpan, NoLogSpans) {
+  SetExporter(false);
+  { tracing::Span span("span_name"); }
+
+  EXPECT_EQ(GetExportedSpans().size(), 1);
+  logging::LogFlush();
+  EXPECT_EQ(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+}
+
+UTEST_F(ExportedSpan, LocalLogLevel) {
+  SetExporter(true);
+  {
+    tracing::Span span("span_name");
+    span.SetLocalLogLevel(logging::Level::kNone);
+    tracing::Span child("child_name");
+  }
+
+  EXPECT_TRUE(GetExportedSpans().empty());
+}
+
+UTEST_F(SampledSpan, Sampled) {
+  SetSampling({});
+  {
+    tracing::Span span("span_name");
+    EXPECT_TRUE(span.IsSampled());
+    tracing::Span child("child_name");
+    EXPECT_TRUE(child.IsSampled());
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+  EXPECT_NE(GetStreamString().find("stopwatch_name=child_name"),
+            std::string::npos);
+}
+
+UTEST_F(SampledSpan, NotSampled) {
+  tracing::SamplingConfig config;
+  config.rate = 0.0;
+  SetSampling(config);
+  {
+    tracing::Span span("span_name");
+    EXPECT_FALSE(span.IsSampled());
+    EXPECT_FALSE(span.GetLink().empty());
+    span.AddTag("test_tag", "test_value");
+
+    tracing::Span child("child_name");
+    EXPECT_FALSE(child.IsSampled());
+    EXPECT_EQ(child.GetTraceId(), span.GetTraceId());
+
+    LOG_INFO() << "simplelog";
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("simplelog"), std::string::npos);
+  EXPECT_NE(GetStreamString().find("link="), std::string::npos);
+  EXPECT_EQ(GetStreamString().find("test_tag"), std::string::npos);
+  EXPECT_EQ(GetStreamString().find("stopwatch_name="), std::string::npos);
+}
+
+UTEST_F(SampledSpan, SampledByBuilder) {
+  tracing::SamplingConfig config;
+  config.rate = 0.0;
+  SetSampling(config);
+  {
+    tracing::SpanBuilder builder("span_name");
+    builder.SetSampled(true);
+    auto span = std::move(builder).Build();
+    EXPECT_TRUE(span.IsSampled());
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+}
+
+UTEST_F(SampledSpan, NotSampledByBuilder) {
+  SetSampling({});
+  {
+    tracing::SpanBuilder builder("span_name");
+    builder.SetSampled(false);
+    auto span = std::move(builder).Build();
+    EXPECT_FALSE(span.IsSampled());
+  }
+
+  logging::LogFlush();
+  EXPECT_EQ(GetStreamString().find("stopwatch_name="), std::string::npos);
+}
+
+UTEST_F(SampledSpan, TailKeepsSlow) {
+  tracing::SamplingConfig config;
+  config.rate = 0.0;
+  config.slow_threshold = std::chrono::milliseconds{1};
+  SetSampling(config);
+  {
+    tracing::Span span("span_name");
+    span.AddTag("test_tag", "test_value");
+    EXPECT_FALSE(span.IsSampled());
+    { tracing::Span child("child_name"); }
+
+    engine::SleepFor(std::chrono::milliseconds{10});
+    logging::LogFlush();
+    EXPECT_EQ(GetStreamString().find("stopwatch_name="), std::string::npos);
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+  EXPECT_NE(GetStreamString().find("stopwatch_name=child_name"),
+            std::string::npos);
+  EXPECT_NE(GetStreamString().find("test_tag=test_value"), std::string::npos);
+}
+
+UTEST_F(SampledSpan, TailDropsFast) {
+  tracing::SamplingConfig config;
+  config.rate = 0.0;
+  config.slow_threshold = std::chrono::hours{1};
+  config.keep_errors = true;
+  SetSampling(config);
+  {
+    tracing::Span span("span_name");
+    tracing::Span child("child_name");
+  }
+
+  logging::LogFlush();
+  EXPECT_EQ(GetStreamString().find("stopwatch_name="), std::string::npos);
+}
+
+UTEST_F(SampledSpan, TailKeepsErrors) {
+  tracing::SamplingConfig config;
+  config.rate = 0.0;
+  config.keep_errors = true;
+  SetSampling(config);
+  {
+    tracing::Span span("span_name");
+    {
+      tracing::Span child("child_name");
+      child.AddNonInheritableTag(tracing::kErrorFlag, true);
+    }
+    { tracing::Span other_child("other_child_name"); }
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+  EXPECT_NE(GetStreamString().find("stopwatch_name=child_name"),
+            std::string::npos);
+  EXPECT_NE(GetStreamString().find("stopwatch_name=other_child_name"),
+            std::string::npos);
+}
+
+UTEST_F(SampledSpan, TailAfterRootFinished) {
+  tracing::SamplingConfig config;
+  config.rate = 0.0;
+  config.keep_errors = true;
+  SetSampling(config);
+
+  std::optional<tracing::Span> orphan;
+  {
+    tracing::Span span("span_name");
+    span.AddTag(tracing::kErrorFlag, true);
+    orphan.emplace(span.CreateChild("orphan_name"));
+    orphan->DetachFromCoroStack();
+  }
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=span_name"),
+            std::string::npos);
+
+  orphan.reset();
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=orphan_name"),
+            std::string::npos);
+}
+
 USERVER_NAMESPACE_END
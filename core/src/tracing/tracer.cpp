@@ -3,6 +3,7 @@
 #include <atomic>
 
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampling.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/tracing/noop.hpp>
 #include <userver/utils/uuid4.hpp>
@@ -18,6 +19,11 @@ auto& GlobalNoLogSpans() {
   return spans;
 }
 
+auto& GlobalSamplingConfig() {
+  static rcu::Variable<SamplingConfig> config{};
+  return config;
+}
+
 auto& GlobalTracer() {
   static const std::string kEmptyServiceName;
   static rcu::Variable<TracerPtr> tracer(
@@ -63,6 +69,14 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
          spans->names.find(name) != spans->names.end();
 }
 
+void Tracer::SetSamplingConfig(const SamplingConfig& config) {
+  GlobalSamplingConfig().Assign(config);
+}
+
+SamplingConfig Tracer::GetSamplingConfig() {
+  return GlobalSamplingConfig().ReadCopy();
+}
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) {
   GlobalTracer().Assign(tracer);
 }
@@ -4,6 +4,9 @@
 #include <userver/logging/null_logger.hpp>
 #include <userver/tracing/noop.hpp>
 #include <userver/tracing/opentracing.hpp>
+#include <userver/tracing/tracer.hpp>
+
+#include <tracing/sampling.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,6 +37,20 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_ctr(benchmark::State& state) {
+  logging::DefaultLoggerGuard guard{logging::MakeNullLogger()};
+
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeNoopTracer("test_service");
+    auto parent = tracer->CreateSpanWithoutParent("parent");
+    parent.AddTag("meta_type", "/v1/handler");
+
+    for (auto _ : state)
+      benchmark::DoNotOptimize(parent.CreateChild("child"));
+  });
+}
+BENCHMARK(tracing_child_ctr);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
@@ -55,6 +72,26 @@ void tracing_opentracing_ctr(benchmark::State& state) {
 }
 BENCHMARK(tracing_opentracing_ctr);
 
+void tracing_sampled_tags(benchmark::State& state) {
+  logging::DefaultLoggerGuard guard{logging::MakeNullLogger()};
+
+  engine::RunStandalone([&] {
+    tracing::SamplingConfig sampling;
+    sampling.rate = static_cast<double>(state.range(0)) / 100;
+    tracing::Tracer::SetSamplingConfig(sampling);
+    auto tracer = tracing::MakeNoopTracer("test_service");
+
+    for (auto _ : state) {
+      auto span = GetSpanWithOpentracingHttpTags(tracer);
+      auto child = span.CreateChild("child");
+      child.AddNonInheritableTag("key", "value");
+      benchmark::DoNotOptimize(child);
+    }
+    tracing::Tracer::SetSamplingConfig({});
+  });
+}
+BENCHMARK(tracing_sampled_tags)->Arg(0)->Arg(10)->Arg(100);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,321 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <boost/stacktrace/frame.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <utils/check_syscall.hpp>
+#include <utils/strerror.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_profiler {
+
+namespace {
+
+using FramePtr = boost::stacktrace::frame::native_frame_ptr_t;
+using ProfiledSpan = engine::impl::TaskContext::ProfiledSpan;
+
+// Including the terminating null frame
+constexpr std::size_t kMaxFrames = 48;
+
+// The signal handler and the signal trampoline
+constexpr std::size_t kSkippedFrames = 2;
+
+constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
+constexpr std::string_view kNoTaskProcessor = "[no task processor]";
+constexpr std::string_view kNoSpan = "[no span]";
+
+struct Sample final {
+  std::array<FramePtr, kMaxFrames> frames;
+  // nullptr if the thread was not running a coroutine
+  const std::string* task_processor_name;
+  std::array<char, ProfiledSpan::kMaxNameSize> span_name;
+};
+
+struct Session final {
+  Session(std::uint64_t id, std::size_t max_samples)
+      : id(id), samples(max_samples) {}
+
+  const std::uint64_t id;
+  std::vector<Sample> samples;
+  std::atomic<std::size_t> next_sample{0};
+};
+
+std::atomic<bool> is_running{false};
+std::uint64_t last_session_id{0};  // protected by is_running
+
+std::atomic<Session*> current_session{nullptr};
+std::atomic<std::uint64_t> active_session_id{0};
+std::atomic<std::size_t> handlers_in_flight{0};
+
+std::atomic<std::uint64_t> sessions_total{0};
+std::atomic<std::uint64_t> samples_total{0};
+std::atomic<std::uint64_t> dropped_samples_total{0};
+std::atomic<std::uint64_t> signal_handler_time_ns_total{0};
+
+std::uint64_t NowNs() noexcept {
+  struct timespec ts {};
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000 +
+         static_cast<std::uint64_t>(ts.tv_nsec);
+}
+
+void FillSample(const Session& session, Sample& sample) noexcept {
+  boost::stacktrace::safe_dump_to(kSkippedFrames, sample.frames.data(),
+                                  sizeof(sample.frames));
+
+  sample.task_processor_name = nullptr;
+  sample.span_name[0] = '\0';
+
+  // Only the memory of the task, that is running on this thread, is accessed
+  auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+
+  sample.task_processor_name = &context->GetTaskProcessor().Name();
+  const auto& span = context->GetProfiledSpan();
+  if (span.session_id.load(std::memory_order_relaxed) == session.id) {
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    sample.span_name = span.name;
+    sample.span_name.back() = '\0';
+  }
+}
+
+void OnProfilingSignal(int) noexcept {
+  const auto saved_errno = errno;
+  const auto start = NowNs();
+
+  handlers_in_flight.fetch_add(1);
+  auto* session = current_session.load();
+  if (session) {
+    const auto index =
+        session->next_sample.fetch_add(1, std::memory_order_relaxed);
+    if (index < session->samples.size()) {
+      FillSample(*session, session->samples[index]);
+      samples_total.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      dropped_samples_total.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  handlers_in_flight.fetch_sub(1, std::memory_order_release);
+
+  signal_handler_time_ns_total.fetch_add(NowNs() - start,
+                                         std::memory_order_relaxed);
+  errno = saved_errno;
+}
+
+void InstallSignalHandler() {
+  // The handler is never removed, because SIGPROF may still be pending after
+  // the timer is disabled and the default action terminates the process
+  [[maybe_unused]] static const bool kInstalled = [] {
+    // The first unwinding loads the unwinder, that is not async-signal-safe
+    std::array<FramePtr, kMaxFrames> frames{};
+    boost::stacktrace::safe_dump_to(frames.data(), sizeof(frames));
+
+    struct sigaction action {};
+    action.sa_handler = &OnProfilingSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    utils::CheckSyscall(sigaction(SIGPROF, &action, nullptr),
+                        "setting {} handler", utils::strsignal(SIGPROF));
+    return true;
+  }();
+}
+
+void SetProfilingTimer(std::size_t frequency) {
+  struct itimerval timer {};
+  if (frequency != 0) {
+    const auto interval_us =
+        std::max<std::size_t>(std::size_t{1'000'000} / frequency, 1);
+    timer.it_interval.tv_sec = interval_us / 1'000'000;
+    timer.it_interval.tv_usec = interval_us % 1'000'000;
+    timer.it_value = timer.it_interval;
+  }
+  utils::CheckSyscall(::setitimer(ITIMER_PROF, &timer, nullptr),
+                      "setting the profiling timer");
+}
+
+void StopSession() noexcept {
+  struct itimerval timer {};
+  [[maybe_unused]] const auto rc = ::setitimer(ITIMER_PROF, &timer, nullptr);
+  UASSERT(rc == 0);
+
+  active_session_id.store(0, std::memory_order_relaxed);
+  current_session.store(nullptr);
+  // The handlers on the other threads may be still filling the samples
+  while (handlers_in_flight.load() != 0) std::this_thread::yield();
+}
+
+struct FrameInfo final {
+  std::string name;
+  bool is_start_of_coroutine{false};
+};
+
+class FrameNames final {
+ public:
+  const FrameInfo& Get(FramePtr address) {
+    auto [it, inserted] = frames_.try_emplace(address);
+    if (inserted) {
+      auto& info = it->second;
+      info.name = boost::stacktrace::frame{address}.name();
+      if (info.name.empty()) info.name = fmt::format("{}", address);
+      info.is_start_of_coroutine =
+          info.name.find(kStartOfCoroutine) != std::string::npos;
+      // ';' separates the frames of the collapsed stack
+      std::replace(info.name.begin(), info.name.end(), ';', ':');
+    }
+    return it->second;
+  }
+
+ private:
+  std::unordered_map<FramePtr, FrameInfo> frames_;
+};
+
+std::string FormatCollapsedStacks(const Session& session,
+                                  std::size_t sample_count) {
+  FrameNames frame_names;
+  std::map<std::string, std::uint64_t> stacks;
+
+  std::string stack;
+  std::vector<const FrameInfo*> frames;
+  for (std::size_t i = 0; i < sample_count; ++i) {
+    const auto& sample = session.samples[i];
+
+    frames.clear();
+    for (const auto address : sample.frames) {
+      if (!address) break;
+      const auto& info = frame_names.Get(address);
+      // The rest is the common stack of the coroutine machinery
+      if (info.is_start_of_coroutine) break;
+      frames.push_back(&info);
+    }
+
+    stack.clear();
+    if (sample.task_processor_name) {
+      stack += *sample.task_processor_name;
+    } else {
+      stack += kNoTaskProcessor;
+    }
+    stack += ';';
+    if (sample.span_name[0] != '\0') {
+      const auto begin = stack.size();
+      stack += sample.span_name.data();
+      std::replace(stack.begin() + begin, stack.end(), ';', ':');
+    } else {
+      stack += kNoSpan;
+    }
+    // The frames are stored starting from the innermost one
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+      stack += ';';
+      stack += (*it)->name;
+    }
+
+    ++stacks[stack];
+  }
+
+  fmt::memory_buffer result;
+  for (const auto& [collapsed_stack, count] : stacks) {
+    fmt::format_to(std::back_inserter(result), "{} {}\n", collapsed_stack,
+                   count);
+  }
+  return fmt::to_string(result);
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
+  writer["sessions"] = utils::statistics::Rate{stats.sessions};
+  writer["samples"] = utils::statistics::Rate{stats.samples};
+  writer["dropped-samples"] = utils::statistics::Rate{stats.dropped_samples};
+  writer["signal-handler-time-us"] = utils::statistics::Rate{
+      static_cast<std::uint64_t>(stats.signal_handler_time.count())};
+}
+
+std::string Profile(const SessionConfig& config) {
+  UINVARIANT(config.frequency > 0, "Profiling frequency must be positive");
+
+  bool expected = false;
+  if (!is_running.compare_exchange_strong(expected, true)) {
+    throw SessionIsRunningError("Another CPU profiling session is running");
+  }
+  const utils::FastScopeGuard running_guard(
+      []() noexcept { is_running.store(false); });
+
+  InstallSignalHandler();
+  Session session{++last_session_id, config.max_samples};
+  sessions_total.fetch_add(1, std::memory_order_relaxed);
+
+  active_session_id.store(session.id, std::memory_order_relaxed);
+  current_session.store(&session);
+  {
+    const utils::FastScopeGuard stop_guard([]() noexcept { StopSession(); });
+    SetProfilingTimer(config.frequency);
+    engine::InterruptibleSleepFor(config.duration);
+  }
+
+  const auto sample_count =
+      std::min(session.next_sample.load(), session.samples.size());
+  return FormatCollapsedStacks(session, sample_count);
+}
+
+Statistics GetStatistics() noexcept {
+  Statistics stats;
+  stats.sessions = sessions_total.load(std::memory_order_relaxed);
+  stats.samples = samples_total.load(std::memory_order_relaxed);
+  stats.dropped_samples =
+      dropped_samples_total.load(std::memory_order_relaxed);
+  stats.signal_handler_time =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::nanoseconds{
+              signal_handler_time_ns_total.load(std::memory_order_relaxed)});
+  return stats;
+}
+
+bool IsProfiling() noexcept {
+  return active_session_id.load(std::memory_order_relaxed) != 0;
+}
+
+void SetCurrentSpanName(std::string_view name) noexcept {
+  const auto session_id = active_session_id.load(std::memory_order_relaxed);
+  if (session_id == 0) return;
+
+  auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+
+  // The signal handler of this thread ignores the name while it is written
+  auto& span = context->GetProfiledSpan();
+  span.session_id.store(0, std::memory_order_relaxed);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+
+  const auto size = std::min(name.size(), span.name.size() - 1);
+  std::memcpy(span.name.data(), name.data(), size);
+  span.name[size] = '\0';
+
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  span.session_id.store(session_id, std::memory_order_relaxed);
+}
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_profiler {
+
+/// Thrown by Profile() if another profiling session is running
+class SessionIsRunningError final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+struct SessionConfig final {
+  std::chrono::milliseconds duration{std::chrono::seconds{10}};
+  // Samples per second of the CPU time consumed by the process
+  std::size_t frequency{100};
+  // The samples above this limit are dropped
+  std::size_t max_samples{20'000};
+};
+
+struct Statistics final {
+  std::uint64_t sessions{0};
+  std::uint64_t samples{0};
+  std::uint64_t dropped_samples{0};
+  std::chrono::microseconds signal_handler_time{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
+
+// Samples the stacks of the threads, that consume CPU, with SIGPROF for the
+// duration of the session. Interruptible, must be called from a coroutine.
+//
+// Returns the stacks in the collapsed format, one stack per line:
+// `<task processor>;<span>;<outermost frame>;...;<innermost frame> <count>`.
+// Frames of the coroutine machinery are cut off.
+//
+// Throws SessionIsRunningError if another session is running.
+std::string Profile(const SessionConfig& config);
+
+Statistics GetStatistics() noexcept;
+
+bool IsProfiling() noexcept;
+
+// Publishes the name of the innermost span of the current task for the running
+// profiling session. Empty name clears the span. No-op if the profiler is not
+// running, so the spans that were started before the session are not shown.
+void SetCurrentSpanName(std::string_view name) noexcept;
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
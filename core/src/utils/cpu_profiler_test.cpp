@@ -0,0 +1,70 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <atomic>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::cpu_profiler::SessionConfig MakeConfig() {
+  utils::cpu_profiler::SessionConfig config;
+  config.duration = 500ms;
+  config.frequency = 1000;
+  config.max_samples = 1000;
+  return config;
+}
+
+void WaitForProfiling() {
+  while (!utils::cpu_profiler::IsProfiling()) engine::SleepFor(1ms);
+}
+
+}  // namespace
+
+UTEST_MT(CpuProfiler, SamplesBusyTask, 2) {
+  const auto stats_before = utils::cpu_profiler::GetStatistics();
+
+  auto profile = engine::AsyncNoSpan(
+      [] { return utils::cpu_profiler::Profile(MakeConfig()); });
+  WaitForProfiling();
+
+  std::atomic<std::uint64_t> iterations{0};
+  {
+    tracing::Span span{"busy_span"};
+    while (utils::cpu_profiler::IsProfiling()) {
+      iterations.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  const auto stacks = profile.Get();
+  EXPECT_NE(stacks.find(";busy_span;"), std::string::npos) << stacks;
+  EXPECT_EQ(stacks.back(), '\n');
+
+  const auto stats_after = utils::cpu_profiler::GetStatistics();
+  EXPECT_EQ(stats_after.sessions, stats_before.sessions + 1);
+  EXPECT_GT(stats_after.samples, stats_before.samples);
+}
+
+UTEST(CpuProfiler, SingleSession) {
+  auto profile = engine::AsyncNoSpan([] {
+    auto config = MakeConfig();
+    config.duration = 10s;
+    return utils::cpu_profiler::Profile(config);
+  });
+  WaitForProfiling();
+
+  UEXPECT_THROW(utils::cpu_profiler::Profile(MakeConfig()),
+                utils::cpu_profiler::SessionIsRunningError);
+
+  profile.RequestCancel();
+  UEXPECT_NO_THROW(profile.Get());
+  EXPECT_FALSE(utils::cpu_profiler::IsProfiling());
+}
+
+USERVER_NAMESPACE_END
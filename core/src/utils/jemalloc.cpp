@@ -6,6 +6,13 @@
 #include <cerrno>
 #endif
 
+#include <cstdint>
+
+#include <fmt/format.h>
+
+#include <compiler/tls.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,6 +24,12 @@ namespace {
 #ifndef JEMALLOC_ENABLED
 int mallctl(const char*, void*, size_t*, void*, size_t) { return ENOTSUP; }
 
+int mallctlnametomib(const char*, size_t*, size_t*) { return ENOTSUP; }
+
+int mallctlbymib(const size_t*, size_t, void*, size_t*, void*, size_t) {
+  return ENOTSUP;
+}
+
 void malloc_stats_print(void (*write_cb)(void*, const char*), void* je_cbopaque,
                         const char*) {
   write_cb(je_cbopaque, "(libjemalloc support is disabled)");
@@ -36,6 +49,43 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code MallCtlRead(const char* name, T& value) {
+  size_t size = sizeof(value);
+  int rc = mallctl(name, &value, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
+// The MIB of "thread.arena" saves the name lookup on each context switch of
+// the tasks with an arena
+struct ThreadArenaMib final {
+  ThreadArenaMib() { rc = mallctlnametomib("thread.arena", mib, &size); }
+
+  size_t mib[2]{};
+  size_t size{2};
+  int rc{0};
+};
+
+std::error_code ExchangeThreadArena(unsigned new_arena, unsigned* old_arena) {
+  static const ThreadArenaMib kMib;
+  if (kMib.rc != 0) return MakeErrorCode(kMib.rc);
+
+  size_t old_size = sizeof(unsigned);
+  int rc = mallctlbymib(kMib.mib, kMib.size, old_arena,
+                        old_arena ? &old_size : nullptr, &new_arena,
+                        sizeof(new_arena));
+  return MakeErrorCode(rc);
+}
+
+thread_local std::optional<unsigned> thread_initial_arena;
+
+std::error_code RefreshStats() {
+  std::uint64_t epoch = 1;
+  size_t epoch_size = sizeof(epoch);
+  int rc = mallctl("epoch", &epoch, &epoch_size, &epoch, sizeof(epoch));
+  return MakeErrorCode(rc);
+}
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -68,6 +118,82 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+std::error_code CreateArena(unsigned& arena) {
+  return MallCtlRead("arenas.create", arena);
+}
+
+USERVER_PREVENT_TLS_CACHING std::error_code SetThreadArena(
+    std::optional<unsigned> arena) {
+  if (!arena) {
+    if (!thread_initial_arena) return {};
+    return ExchangeThreadArena(*thread_initial_arena, nullptr);
+  }
+  if (thread_initial_arena) return ExchangeThreadArena(*arena, nullptr);
+
+  unsigned old_arena = 0;
+  auto ec = ExchangeThreadArena(*arena, &old_arena);
+  if (!ec) thread_initial_arena = old_arena;
+  return ec;
+}
+
+std::error_code GetArenaStats(unsigned arena, ArenaStats& stats) {
+  if (auto ec = RefreshStats()) return ec;
+
+  size_t small_allocated = 0;
+  size_t large_allocated = 0;
+  for (const auto& [name, value] :
+       {std::pair{"small.allocated", &small_allocated},
+        std::pair{"large.allocated", &large_allocated},
+        std::pair{"resident", &stats.resident}}) {
+    const auto full_name = fmt::format("stats.arenas.{}.{}", arena, name);
+    auto ec = MallCtlRead(full_name.c_str(), *value);
+    if (ec) return ec;
+  }
+  stats.allocated = small_allocated + large_allocated;
+  return {};
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ArenaStats& stats) {
+  writer["allocated-bytes"] = stats.allocated;
+  writer["resident-bytes"] = stats.resident;
+}
+
+std::error_code GetAllocationsCount(std::uint64_t& count) {
+  if (auto ec = RefreshStats()) return ec;
+
+  // 4096 is MALLCTL_ARENAS_ALL, the merged statistics of all the arenas
+  std::uint64_t small_requests = 0;
+  std::uint64_t large_requests = 0;
+  if (auto ec = MallCtlRead("stats.arenas.4096.small.nrequests",
+                            small_requests)) {
+    return ec;
+  }
+  if (auto ec = MallCtlRead("stats.arenas.4096.large.nrequests",
+                            large_requests)) {
+    return ec;
+  }
+  count = small_requests + large_requests;
+  return {};
+}
+
+ArenaScope::ArenaScope(std::optional<unsigned> arena)
+    : is_active_(arena.has_value()) {
+  if (!is_active_) return;
+
+  auto& context = engine::current_task::GetCurrentTaskContext();
+  previous_arena_ = context.GetMemoryArena();
+  context.SetMemoryArena(arena);
+  SetThreadArena(arena);
+}
+
+ArenaScope::~ArenaScope() {
+  if (!is_active_) return;
+
+  engine::current_task::GetCurrentTaskContext().SetMemoryArena(
+      previous_arena_);
+  SetThreadArena(previous_arena_);
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
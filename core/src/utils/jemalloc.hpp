@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <system_error>
 
+#include <userver/utils/statistics/fwd.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::jemalloc {
@@ -22,6 +27,51 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+/// Creates a new arena, the memory of an arena is accounted separately
+std::error_code CreateArena(unsigned& arena);
+
+/// Switches the allocations of the current thread to the arena, std::nullopt
+/// switches back to the arena the thread had before the first switch
+std::error_code SetThreadArena(std::optional<unsigned> arena);
+
+/// Memory of an arena, bytes
+struct ArenaStats {
+  std::size_t allocated{0};
+  std::size_t resident{0};
+};
+
+/// Refreshes the jemalloc statistics and returns the ones of the arena
+std::error_code GetArenaStats(unsigned arena, ArenaStats& stats);
+
+void DumpMetric(utils::statistics::Writer& writer, const ArenaStats& stats);
+
+/// @brief Refreshes the jemalloc statistics and returns the count of the
+/// allocations made by the process so far.
+///
+/// The allocations from the thread caches are accounted on the caches flush,
+/// so the count is approximate.
+std::error_code GetAllocationsCount(std::uint64_t& count);
+
+/// @brief Makes the current task and the tasks started from it allocate from
+/// the arena. The accounting is approximate: the thread caches may serve
+/// some allocations from the previous arena.
+///
+/// Switching of the arenas makes the context switches of the task slower, so
+/// the scope is for the heavy long operations, e.g. cache updates. Does
+/// nothing for std::nullopt.
+class ArenaScope final {
+ public:
+  explicit ArenaScope(std::optional<unsigned> arena);
+  ~ArenaScope();
+
+  ArenaScope(ArenaScope&&) = delete;
+  ArenaScope& operator=(ArenaScope&&) = delete;
+
+ private:
+  const bool is_active_;
+  std::optional<unsigned> previous_arena_;
+};
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
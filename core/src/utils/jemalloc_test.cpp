@@ -0,0 +1,65 @@
+#include <utils/jemalloc.hpp>
+
+#include <string>
+#include <vector>
+
+#include <engine/task/task_context.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::optional<unsigned> GetCurrentTaskArena() {
+  return engine::current_task::GetCurrentTaskContext().GetMemoryArena();
+}
+
+}  // namespace
+
+UTEST(Jemalloc, ArenaScope) {
+  EXPECT_EQ(GetCurrentTaskArena(), std::nullopt);
+  {
+    // The arena 0 always exists with jemalloc
+    const utils::jemalloc::ArenaScope scope{0};
+    EXPECT_EQ(GetCurrentTaskArena(), 0);
+
+    // The arena survives the context switches
+    engine::Yield();
+    std::vector<std::string> allocations(100, std::string(100, 'a'));
+    EXPECT_EQ(GetCurrentTaskArena(), 0);
+
+    // The nested tasks inherit the arena
+    utils::Async("nested", [] {
+      EXPECT_EQ(GetCurrentTaskArena(), 0);
+    }).Get();
+  }
+  EXPECT_EQ(GetCurrentTaskArena(), std::nullopt);
+
+  {
+    const utils::jemalloc::ArenaScope disabled_scope{std::nullopt};
+    EXPECT_EQ(GetCurrentTaskArena(), std::nullopt);
+  }
+}
+
+UTEST(Jemalloc, ArenaStats) {
+  unsigned arena = 0;
+  if (utils::jemalloc::CreateArena(arena)) {
+    GTEST_SKIP() << "No jemalloc";
+  }
+
+  std::vector<std::string> allocations;
+  {
+    const utils::jemalloc::ArenaScope scope{arena};
+    allocations.assign(1000, std::string(1000, 'a'));
+  }
+
+  utils::jemalloc::ArenaStats stats;
+  ASSERT_FALSE(utils::jemalloc::GetArenaStats(arena, stats));
+  // The thread cache may serve some of the allocations from another arena
+  EXPECT_GT(stats.allocated, 0);
+  EXPECT_GE(stats.resident, stats.allocated);
+}
+
+USERVER_NAMESPACE_END
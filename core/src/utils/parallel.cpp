@@ -0,0 +1,66 @@
+#include <userver/utils/parallel.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task.hpp>
+
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+ParallelChunks::ParallelChunks(const ParallelSettings& settings,
+                               std::size_t size, std::size_t chunks_per_part)
+    : size_(size) {
+  const auto min_chunk_size = std::max<std::size_t>(settings.min_chunk_size, 1);
+  const auto max_parts =
+      settings.max_parts != 0
+          ? settings.max_parts
+          : GetParallelTaskProcessor(settings).GetWorkerCount();
+
+  parts_ = std::clamp<std::size_t>(size / min_chunk_size, 1, max_parts);
+  chunk_size_ = std::max(min_chunk_size,
+                         (size + parts_ * chunks_per_part - 1) /
+                             (parts_ * chunks_per_part));
+  count_ = (size + chunk_size_ - 1) / chunk_size_;
+}
+
+engine::TaskProcessor& GetParallelTaskProcessor(
+    const ParallelSettings& settings) {
+  return settings.task_processor ? *settings.task_processor
+                                 : engine::current_task::GetTaskProcessor();
+}
+
+void CheckParallelInterrupted(engine::Deadline deadline) {
+  if (deadline.IsReached()) {
+    throw engine::WaitInterruptedException(
+        engine::TaskCancellationReason::kDeadline);
+  }
+  if (engine::current_task::ShouldCancel()) {
+    throw engine::WaitInterruptedException(
+        engine::current_task::CancellationReason());
+  }
+}
+
+void WaitParallelParts(std::vector<engine::TaskWithResult<void>>& tasks,
+                       engine::Deadline deadline) {
+  for (auto& task : tasks) {
+    task.WaitUntil(deadline);
+    if (!task.IsFinished()) {
+      CheckParallelInterrupted(deadline);
+    }
+
+    try {
+      task.Get();
+    } catch (const engine::TaskCancelledException& ex) {
+      // A part that did not start because of the task processor overload
+      // leaves its work to the others.
+      if (ex.Reason() != engine::TaskCancellationReason::kOverload) throw;
+    }
+  }
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
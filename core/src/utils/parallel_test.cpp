@@ -0,0 +1,145 @@
+#include <userver/utils/parallel.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/rand.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::vector<std::int64_t> MakeRandomValues(std::size_t size) {
+  std::vector<std::int64_t> values(size);
+  for (auto& value : values) {
+    value = utils::RandRange(std::int64_t{-1000}, std::int64_t{1000});
+  }
+  return values;
+}
+
+}  // namespace
+
+UTEST_MT(Parallel, For, 4) {
+  /// [Sample utils::ParallelFor usage]
+  std::vector<std::int64_t> values(10000);
+  std::iota(values.begin(), values.end(), 0);
+
+  // The elements are processed by 4 tasks including the current one
+  utils::ParallelFor(values.begin(), values.end(),
+                     [](std::int64_t& value) { value *= 2; });
+  /// [Sample utils::ParallelFor usage]
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], static_cast<std::int64_t>(i) * 2);
+  }
+}
+
+UTEST_MT(Parallel, ForUsesSeveralTasks, 4) {
+  std::vector<int> values(64);
+  std::atomic<int> concurrent{0};
+  std::atomic<int> max_concurrent{0};
+
+  utils::ParallelSettings settings;
+  settings.max_parts = 2;
+  utils::ParallelFor(
+      values.begin(), values.end(),
+      [&](int&) {
+        const auto current = ++concurrent;
+        for (auto max = max_concurrent.load(); max < current;) {
+          max_concurrent.compare_exchange_weak(max, current);
+        }
+        engine::SleepFor(1ms);
+        --concurrent;
+      },
+      settings);
+
+  EXPECT_EQ(max_concurrent, 2);
+}
+
+UTEST(Parallel, Empty) {
+  std::vector<int> values;
+  utils::ParallelFor(values.begin(), values.end(), [](int&) { FAIL(); });
+  EXPECT_EQ(utils::ParallelReduce(values.begin(), values.end(), 42), 42);
+  utils::ParallelSort(values.begin(), values.end());
+}
+
+UTEST_MT(Parallel, Transform, 4) {
+  const auto values = MakeRandomValues(12345);
+  std::vector<std::string> strings(values.size());
+
+  const auto end = utils::ParallelTransform(
+      values.begin(), values.end(), strings.begin(),
+      [](std::int64_t value) { return std::to_string(value); });
+  EXPECT_EQ(end, strings.end());
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(strings[i], std::to_string(values[i]));
+  }
+}
+
+UTEST_MT(Parallel, Reduce, 4) {
+  const auto values = MakeRandomValues(12345);
+
+  utils::ParallelSettings settings;
+  settings.min_chunk_size = 100;
+  EXPECT_EQ(utils::ParallelReduce(values.begin(), values.end(),
+                                  std::int64_t{10}, std::plus<>{}, settings),
+            std::accumulate(values.begin(), values.end(), std::int64_t{10}));
+}
+
+UTEST_MT(Parallel, ReduceKeepsOrder, 4) {
+  std::vector<std::string> values;
+  for (int i = 0; i < 1000; ++i) values.push_back(std::to_string(i));
+
+  std::string expected;
+  for (const auto& value : values) expected += value;
+
+  EXPECT_EQ(utils::ParallelReduce(values.begin(), values.end(), std::string{}),
+            expected);
+}
+
+UTEST_MT(Parallel, Sort, 4) {
+  for (const std::size_t size : {1, 2, 7, 100, 10001}) {
+    auto values = MakeRandomValues(size);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+    utils::ParallelSort(values.begin(), values.end(), std::greater<>{});
+    EXPECT_EQ(values, expected) << "size=" << size;
+  }
+}
+
+UTEST_MT(Parallel, Exception, 4) {
+  std::vector<int> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+
+  UEXPECT_THROW_MSG(utils::ParallelFor(values.begin(), values.end(),
+                                       [](int value) {
+                                         if (value == 500) {
+                                           throw std::runtime_error("500");
+                                         }
+                                       }),
+                    std::runtime_error, "500");
+}
+
+UTEST_MT(Parallel, Deadline, 4) {
+  std::vector<int> values(1000);
+
+  utils::ParallelSettings settings;
+  settings.deadline = engine::Deadline::FromDuration(10ms);
+  UEXPECT_THROW(utils::ParallelFor(
+                    values.begin(), values.end(),
+                    [](int&) { engine::SleepFor(1ms); }, settings),
+                engine::WaitInterruptedException);
+}
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <compiler/tls.hpp>
 
@@ -159,7 +160,7 @@ void PeriodicTask::Run() {
       start = std::chrono::steady_clock::now();
     }
 
-    while (changed_event_.WaitForEventUntil(start + MutatePeriod(period))) {
+    while (changed_event_.WaitForEventUntil(GetNextStepTime(start, period))) {
       if (should_force_step_.exchange(false)) {
         break;
       }
@@ -177,14 +178,22 @@ bool PeriodicTask::DoStep() {
   const auto span_log_level = settings_ptr->span_level;
   const auto name_ptr = name_.Read();
   tracing::Span span(*name_ptr, tracing::ReferenceType::kChild, span_log_level);
+  const auto start = std::chrono::steady_clock::now();
+  ++steps_;
+  bool success = true;
   try {
     callback_();
-    return true;
   } catch (const std::exception& e) {
     LOG_ERROR() << "Exception in PeriodicTask with name=" << *name_ptr << ": "
                 << e;
-    return false;
+    ++errors_;
+    success = false;
   }
+  execution_time_ms_ += utils::statistics::Rate{static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count())};
+  return success;
 }
 
 bool PeriodicTask::Step() {
@@ -223,6 +232,35 @@ std::chrono::milliseconds PeriodicTask::MutatePeriod(
   return std::chrono::milliseconds(ms);
 }
 
+std::chrono::steady_clock::time_point PeriodicTask::GetNextStepTime(
+    std::chrono::steady_clock::time_point start,
+    std::chrono::milliseconds period) {
+  auto settings_ptr = settings_.Read();
+  const std::chrono::steady_clock::duration granularity =
+      settings_ptr->coalescing_granularity;
+  if (granularity.count() <= 0) return start + MutatePeriod(period);
+
+  const auto distribution = (settings_ptr->flags & Flags::kChaotic)
+                                ? settings_ptr->distribution
+                                : std::chrono::milliseconds{0};
+  const auto earliest = start + period - distribution;
+  const auto latest = start + period + distribution;
+
+  // The first multiple of the granularity, that is not before `earliest`
+  const auto remainder = earliest.time_since_epoch() % granularity;
+  const auto first = (remainder == granularity.zero())
+                         ? earliest
+                         : earliest + (granularity - remainder);
+  // The jitter is too small for the granularity, the step is delayed to stay
+  // coalesced with the other tasks
+  if (first > latest) return first;
+
+  const auto steps = (latest - first) / granularity;
+  const auto step = std::uniform_int_distribution<std::int64_t>(
+      0, steps)(GetFastRandomBitsGenerator());
+  return first + step * granularity;
+}
+
 void PeriodicTask::SuspendDebug() {
   // step_mutex_ waits, for a potentially long time, for Step() call completion
   std::lock_guard<engine::Mutex> lock_step(step_mutex_);
@@ -252,6 +290,12 @@ PeriodicTask::Settings PeriodicTask::GetCurrentSettings() const {
   return *settings_ptr;
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const PeriodicTask& task) {
+  writer["steps"] = task.steps_;
+  writer["errors"] = task.errors_;
+  writer["execution-time-ms"] = task.execution_time_ms_;
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -8,6 +8,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 using namespace std::chrono_literals;
 
@@ -406,6 +408,92 @@ UTEST(PeriodicTask, SynchronizeDebugFailure) {
   task.Stop();
 }
 
+UTEST(PeriodicTask, Statistics) {
+  SimpleTaskData simple;
+
+  constexpr auto period = utest::kMaxTestWaitTime;
+  utils::PeriodicTask task("task", period, simple.GetTaskFunction());
+
+  EXPECT_TRUE(task.SynchronizeDebug());
+  simple.throw_exception = true;
+  EXPECT_FALSE(task.SynchronizeDebug());
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "task", [&](utils::statistics::Writer& writer) { writer = task; });
+
+  const utils::statistics::Snapshot snapshot{storage, "task"};
+  EXPECT_EQ(snapshot.SingleMetric("steps").AsRate().value, 2);
+  EXPECT_EQ(snapshot.SingleMetric("errors").AsRate().value, 1);
+  EXPECT_NO_THROW(snapshot.SingleMetric("execution-time-ms").AsRate());
+
+  task.Stop();
+}
+
+UTEST(PeriodicTask, Coalescing) {
+  constexpr auto kGranularity = 100ms;
+  constexpr auto kSteps = 3;
+
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  std::vector<std::chrono::steady_clock::time_point> step_times;
+
+  utils::PeriodicTask::Settings settings{100ms, 50ms,
+                                         utils::PeriodicTask::Flags::kChaotic};
+  settings.coalescing_granularity = kGranularity;
+  utils::PeriodicTask task("task", settings, [&] {
+    const std::lock_guard lock(mutex);
+    step_times.push_back(std::chrono::steady_clock::now());
+    cv.NotifyOne();
+  });
+
+  {
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(cv.WaitFor(lock, utest::kMaxTestWaitTime,
+                           [&] { return step_times.size() >= kSteps; }));
+  }
+  task.Stop();
+
+  for (const auto step_time : step_times) {
+    // The steps start right after the multiples of the granularity
+    const auto lateness = step_time.time_since_epoch() % kGranularity;
+    EXPECT_LT(lateness, kGranularity / 2);
+  }
+}
+
+UTEST(PeriodicTask, CoalescingSmallJitter) {
+  constexpr auto kGranularity = 80ms;
+  constexpr auto kSteps = 3;
+
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  std::vector<std::chrono::steady_clock::time_point> step_times;
+
+  // `period +/- distribution` is narrower than the granularity and usually
+  // holds none of its multiples
+  utils::PeriodicTask::Settings settings{100ms, 5ms,
+                                         utils::PeriodicTask::Flags::kChaotic};
+  settings.coalescing_granularity = kGranularity;
+  utils::PeriodicTask task("task", settings, [&] {
+    const std::lock_guard lock(mutex);
+    step_times.push_back(std::chrono::steady_clock::now());
+    cv.NotifyOne();
+  });
+
+  {
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(cv.WaitFor(lock, utest::kMaxTestWaitTime,
+                           [&] { return step_times.size() >= kSteps; }));
+  }
+  task.Stop();
+
+  for (const auto step_time : step_times) {
+    // The steps are still aligned to the granularity
+    const auto lateness = step_time.time_since_epoch() % kGranularity;
+    EXPECT_LT(lateness, kGranularity / 2);
+  }
+}
+
 UTEST(PeriodicTask, SynchronizeDebugSpan) {
   const tracing::Span span(__func__);
   std::string task_link;
@@ -0,0 +1,132 @@
+#include <userver/utils/sharded_token_bucket.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+// Keeps all the cached tokens under a quarter of the bucket size
+constexpr std::size_t kBatchDivisor = 4 * statistics::impl::kThreadShardCount;
+
+bool TryTakeToken(std::atomic<std::size_t>& tokens) noexcept {
+  auto expected = tokens.load(std::memory_order_relaxed);
+  while (expected != 0) {
+    if (tokens.compare_exchange_weak(expected, expected - 1,
+                                     std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+ShardedTokenBucket::ShardedTokenBucket() noexcept = default;
+
+ShardedTokenBucket::ShardedTokenBucket(std::size_t max_size,
+                                       RefillPolicy policy)
+    : ShardedTokenBucket(TokenBucket{max_size, policy}) {}
+
+ShardedTokenBucket::ShardedTokenBucket(TokenBucket&& bucket) noexcept
+    : bucket_(std::move(bucket)) {
+  UpdateBatchSize();
+}
+
+ShardedTokenBucket ShardedTokenBucket::MakeUnbounded() noexcept {
+  return ShardedTokenBucket{TokenBucket::MakeUnbounded()};
+}
+
+bool ShardedTokenBucket::IsUnbounded() const { return bucket_.IsUnbounded(); }
+
+std::size_t ShardedTokenBucket::GetMaxSizeApprox() const {
+  return bucket_.GetMaxSizeApprox();
+}
+
+double ShardedTokenBucket::GetRatePs() const { return bucket_.GetRatePs(); }
+
+std::size_t ShardedTokenBucket::GetTokensApprox() {
+  auto tokens = bucket_.GetTokensApprox();
+  for (const auto& shard : shards_) {
+    tokens += shard.tokens.load(std::memory_order_relaxed);
+  }
+  return tokens;
+}
+
+void ShardedTokenBucket::SetMaxSize(std::size_t max_size) {
+  bucket_.SetMaxSize(max_size);
+  UpdateBatchSize();
+  DropCachedTokens();
+}
+
+void ShardedTokenBucket::SetRefillPolicy(RefillPolicy policy) {
+  bucket_.SetRefillPolicy(policy);
+  DropCachedTokens();
+}
+
+void ShardedTokenBucket::SetInstantRefillPolicy() {
+  bucket_.SetInstantRefillPolicy();
+  DropCachedTokens();
+}
+
+bool ShardedTokenBucket::Obtain() {
+  auto& local_tokens =
+      shards_[statistics::impl::GetThreadShardIndex()].tokens;
+  if (TryTakeToken(local_tokens)) return true;
+
+  // Instantly refilled buckets are not depleted, nothing to cache
+  const auto batch_size = batch_size_.load(std::memory_order_relaxed);
+  if (batch_size > 1 &&
+      bucket_.GetRefillIntervalApprox() != Duration::zero() &&
+      bucket_.ObtainAll(batch_size)) {
+    local_tokens.fetch_add(batch_size - 1, std::memory_order_relaxed);
+    return true;
+  }
+  if (bucket_.Obtain()) return true;
+
+  for (auto& shard : shards_) {
+    if (TryTakeToken(shard.tokens)) return true;
+  }
+  return false;
+}
+
+bool ShardedTokenBucket::WaitToken(engine::Deadline deadline) {
+  while (!Obtain()) {
+    if (deadline.IsReached() || engine::current_task::ShouldCancel()) {
+      return false;
+    }
+
+    // A token may appear no earlier than in a refill interval. Zero or
+    // infinite interval with no tokens means that the bucket is never refilled
+    const auto interval = bucket_.GetRefillIntervalApprox();
+    if (interval == Duration::zero() || interval == Duration::max()) {
+      engine::InterruptibleSleepUntil(deadline);
+    } else {
+      engine::InterruptibleSleepUntil(
+          std::min(deadline, engine::Deadline::FromDuration(interval)));
+    }
+  }
+  return true;
+}
+
+void ShardedTokenBucket::UpdateBatchSize() {
+  batch_size_.store(
+      std::max(std::size_t{1}, bucket_.GetMaxSizeApprox() / kBatchDivisor),
+      std::memory_order_relaxed);
+}
+
+void ShardedTokenBucket::DropCachedTokens() noexcept {
+  for (auto& shard : shards_) {
+    shard.tokens.store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#include <userver/utils/sharded_token_bucket.hpp>
+
+#include <chrono>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Refills faster than the tokens are obtained, so the buckets never run out
+constexpr std::size_t kMaxSize = 100'000;
+constexpr utils::TokenBucket::RefillPolicy kRefillPolicy{
+    kMaxSize, std::chrono::milliseconds{1}};
+
+template <typename Bucket>
+void Obtain(benchmark::State& state) {
+  static Bucket bucket{kMaxSize, kRefillPolicy};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bucket.Obtain());
+  }
+}
+
+}  // namespace
+
+void token_bucket_obtain(benchmark::State& state) {
+  Obtain<utils::TokenBucket>(state);
+}
+BENCHMARK(token_bucket_obtain)->ThreadRange(1, 32);
+
+void sharded_token_bucket_obtain(benchmark::State& state) {
+  Obtain<utils::ShardedTokenBucket>(state);
+}
+BENCHMARK(sharded_token_bucket_obtain)->ThreadRange(1, 32);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#include <userver/utils/sharded_token_bucket.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSize = 1000;
+
+std::size_t ObtainAll(utils::ShardedTokenBucket& bucket) {
+  std::size_t obtained = 0;
+  while (bucket.Obtain()) ++obtained;
+  return obtained;
+}
+
+}  // namespace
+
+TEST(ShardedTokenBucket, Default) {
+  utils::ShardedTokenBucket bucket;
+  EXPECT_EQ(0, bucket.GetMaxSizeApprox());
+  EXPECT_EQ(0, bucket.GetTokensApprox());
+  EXPECT_FALSE(bucket.Obtain());
+}
+
+TEST(ShardedTokenBucket, Unbounded) {
+  auto bucket = utils::ShardedTokenBucket::MakeUnbounded();
+  EXPECT_TRUE(bucket.IsUnbounded());
+  for (std::size_t i = 0; i < kSize; ++i) {
+    EXPECT_TRUE(bucket.Obtain());
+  }
+}
+
+TEST(ShardedTokenBucket, ObtainsMaxSize) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{});
+
+  utils::ShardedTokenBucket bucket{kSize, {1, std::chrono::seconds{1}}};
+  EXPECT_EQ(kSize, bucket.GetTokensApprox());
+  EXPECT_TRUE(bucket.Obtain());
+  EXPECT_EQ(kSize - 1, bucket.GetTokensApprox());
+  EXPECT_EQ(kSize - 1, ObtainAll(bucket));
+  EXPECT_EQ(0, bucket.GetTokensApprox());
+
+  utils::datetime::MockSleep(std::chrono::seconds{3});
+  EXPECT_EQ(3, ObtainAll(bucket));
+}
+
+TEST(ShardedTokenBucket, SetMaxSizeDropsCachedTokens) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{});
+
+  utils::ShardedTokenBucket bucket{kSize, {1, std::chrono::seconds{1}}};
+  EXPECT_TRUE(bucket.Obtain());
+  EXPECT_LT(0, bucket.GetTokensApprox());
+
+  bucket.SetMaxSize(1);
+  EXPECT_EQ(1, bucket.GetMaxSizeApprox());
+  EXPECT_EQ(1, ObtainAll(bucket));
+}
+
+UTEST_MT(ShardedTokenBucket, ObtainsMaxSizeFromAllThreads, 4) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{});
+
+  utils::ShardedTokenBucket bucket{kSize, {1, std::chrono::seconds{1}}};
+  std::vector<engine::TaskWithResult<std::size_t>> tasks;
+  for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+    tasks.push_back(
+        engine::AsyncNoSpan([&bucket] { return ObtainAll(bucket); }));
+  }
+
+  std::size_t obtained = 0;
+  for (auto& task : tasks) obtained += task.Get();
+  EXPECT_EQ(kSize, obtained);
+}
+
+UTEST(ShardedTokenBucket, WaitToken) {
+  utils::datetime::MockNowUnset();
+
+  utils::ShardedTokenBucket bucket{1, {1, std::chrono::milliseconds{10}}};
+  EXPECT_TRUE(bucket.Obtain());
+  EXPECT_TRUE(bucket.WaitToken(
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime)));
+}
+
+UTEST(ShardedTokenBucket, WaitTokenDeadline) {
+  utils::datetime::MockNowUnset();
+
+  utils::ShardedTokenBucket bucket{1, {1, std::chrono::hours{1}}};
+  EXPECT_TRUE(bucket.Obtain());
+  EXPECT_FALSE(bucket.WaitToken(
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+
+  utils::ShardedTokenBucket empty_bucket;
+  EXPECT_FALSE(empty_bucket.WaitToken(
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+}
+
+USERVER_NAMESPACE_END
@@ -36,6 +36,9 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
+    // Graphite has no histograms
+    if (value.IsHistogram()) return;
+
     AppendGraphiteSafe(buf_, path);
 
     for (const auto& label : labels) {
@@ -0,0 +1,51 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/statistics/percentile.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kMaxValue = 1000;
+
+template <typename Histogram>
+void Account(benchmark::State& state) {
+  static Histogram histogram;
+
+  std::uint64_t value = state.thread_index() * 7;
+  for (auto _ : state) {
+    histogram.Account(value % kMaxValue);
+    value += 13;
+  }
+  benchmark::DoNotOptimize(histogram.Count());
+}
+
+}  // namespace
+
+void hdr_histogram_account(benchmark::State& state) {
+  Account<utils::statistics::HdrHistogram<kMaxValue>>(state);
+}
+BENCHMARK(hdr_histogram_account)->ThreadRange(1, 8);
+
+void percentile_account(benchmark::State& state) {
+  Account<utils::statistics::Percentile<kMaxValue>>(state);
+}
+BENCHMARK(percentile_account)->ThreadRange(1, 8);
+
+void hdr_histogram_percentile(benchmark::State& state) {
+  utils::statistics::HdrHistogram<kMaxValue> histogram;
+  for (std::uint64_t value = 0; value < kMaxValue; ++value) {
+    histogram.Account(value);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(histogram.GetPercentile(99));
+  }
+}
+BENCHMARK(hdr_histogram_percentile);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,160 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Histogram = utils::statistics::HdrHistogram<100>;
+
+}  // namespace
+
+static_assert(utils::statistics::kHasWriterSupport<Histogram>);
+static_assert(Histogram::kBucketCount == 37);
+
+TEST(HdrHistogram, Buckets) {
+  for (std::uint64_t value = 0; value < 8; ++value) {
+    EXPECT_EQ(Histogram::GetBucketIndex(value), value);
+    EXPECT_EQ(Histogram::GetUpperBoundAt(value), value);
+  }
+
+  EXPECT_EQ(Histogram::GetBucketIndex(15), 15);
+  EXPECT_EQ(Histogram::GetBucketIndex(16), 16);
+  EXPECT_EQ(Histogram::GetBucketIndex(17), 16);
+  EXPECT_EQ(Histogram::GetUpperBoundAt(16), 17);
+  EXPECT_EQ(Histogram::GetBucketIndex(100), 36);
+  EXPECT_EQ(Histogram::GetUpperBoundAt(36), 103);
+
+  for (std::uint64_t value = 1; value < 100'000; ++value) {
+    const auto index = Histogram::GetBucketIndex(value);
+    ASSERT_GE(Histogram::GetUpperBoundAt(index), value);
+    ASSERT_LT(Histogram::GetUpperBoundAt(index - 1), value);
+    // The relative error is bounded by 2^-PrecisionBits
+    ASSERT_LE(Histogram::GetUpperBoundAt(index) - value, value / 8);
+  }
+}
+
+TEST(HdrHistogram, Percentiles) {
+  Histogram histogram;
+  EXPECT_EQ(histogram.GetPercentile(50), 0);
+  EXPECT_EQ(histogram.Count(), 0);
+
+  for (std::uint64_t value = 1; value <= 100; ++value) {
+    histogram.Account(value);
+  }
+  EXPECT_EQ(histogram.Count(), 100);
+  EXPECT_EQ(histogram.Sum(), 5050);
+
+  EXPECT_EQ(histogram.GetPercentile(0), 1);
+  EXPECT_EQ(histogram.GetPercentile(5), 5);
+  EXPECT_EQ(histogram.GetPercentile(50), 51);
+  EXPECT_EQ(histogram.GetPercentile(100), 103);
+
+  histogram.Account(1000, 900);
+  EXPECT_EQ(histogram.Count(), 1000);
+  EXPECT_EQ(histogram.GetPercentile(1), 10);
+  EXPECT_EQ(histogram.GetPercentile(50), 103);
+}
+
+TEST(HdrHistogram, PercentileOfDifference) {
+  Histogram histogram;
+  histogram.Account(5, 100);
+  const auto before = histogram.LoadCounts();
+  histogram.Account(90, 10);
+
+  auto difference = histogram.LoadCounts();
+  for (std::size_t i = 0; i < difference.size(); ++i) {
+    difference[i] -= before[i];
+  }
+  EXPECT_EQ(Histogram::GetPercentileOf(difference, 50), 95);
+  EXPECT_EQ(histogram.GetPercentile(50), 5);
+  EXPECT_EQ(Histogram::GetPercentileOf(Histogram::Counts{}, 99), 0);
+}
+
+TEST(HdrHistogram, AddAndReset) {
+  Histogram first;
+  Histogram second;
+  first.Account(3);
+  second.Account(3);
+  second.Account(50);
+
+  first.Add(second);
+  EXPECT_EQ(first.Count(), 3);
+  EXPECT_EQ(first.Sum(), 56);
+  EXPECT_EQ(first.GetPercentile(50), 3);
+
+  const Histogram copy{first};
+  EXPECT_EQ(copy.LoadCounts(), first.LoadCounts());
+
+  first.Reset();
+  EXPECT_EQ(first.Count(), 0);
+  EXPECT_EQ(first.Sum(), 0);
+  EXPECT_EQ(copy.Count(), 3);
+}
+
+UTEST_MT(HdrHistogram, Concurrent, 4) {
+  constexpr std::size_t kTasks = 16;
+  constexpr std::uint64_t kIterations = 10'000;
+
+  Histogram histogram;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&histogram] {
+      for (std::uint64_t value = 0; value < kIterations; ++value) {
+        histogram.Account(value % 200);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  const auto counts = histogram.LoadCounts();
+  EXPECT_EQ(histogram.Count(), kTasks * kIterations);
+  EXPECT_EQ(counts[Histogram::kBucketCount], kTasks * kIterations / 200 * 96);
+  EXPECT_EQ(counts[0], kTasks * kIterations / 200);
+}
+
+UTEST(HdrHistogram, RecentPeriod) {
+  utils::statistics::RecentPeriod<Histogram, Histogram> recent;
+  recent.GetCurrentCounter().Account(5);
+  recent.GetCurrentCounter().Account(7);
+  EXPECT_EQ(recent.GetStatsForPeriod(std::chrono::seconds{60}, true).Count(),
+            2);
+}
+
+UTEST(HdrHistogram, Snapshot) {
+  using SmallHistogram = utils::statistics::HdrHistogram<10, 1>;
+  SmallHistogram histogram;
+  histogram.Account(1);
+  histogram.Account(4, 2);
+  histogram.Account(100);
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "hist", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+  const utils::statistics::Snapshot snapshot{storage};
+  const auto value = snapshot.SingleMetric("hist");
+  ASSERT_TRUE(value.IsHistogram());
+
+  const auto view = value.AsHistogram();
+  ASSERT_EQ(view.GetBucketCount(), SmallHistogram::kBucketCount);
+  const std::vector<double> expected_bounds{0, 1, 2, 3, 5, 7, 11};
+  const std::vector<std::uint64_t> expected_counts{0, 1, 0, 0, 2, 0, 0};
+  for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+    EXPECT_EQ(view.GetUpperBoundAt(i), expected_bounds[i]);
+    EXPECT_EQ(view.GetValueAt(i), expected_counts[i]);
+  }
+  EXPECT_EQ(view.GetValueAtInf(), 1);
+  EXPECT_EQ(view.GetTotalCount(), 4);
+  EXPECT_EQ(view.GetSum(), 109);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <userver/utils/statistics/histogram_view.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+double HistogramView::GetUpperBoundAt(std::size_t index) const {
+  UASSERT(index < bucket_count_);
+  return upper_bounds_[index];
+}
+
+std::uint64_t HistogramView::GetValueAt(std::size_t index) const {
+  UASSERT(index < bucket_count_);
+  return counts_[index];
+}
+
+std::uint64_t HistogramView::GetTotalCount() const noexcept {
+  std::uint64_t total = inf_count_;
+  for (std::size_t i = 0; i < bucket_count_; ++i) total += counts_[i];
+  return total;
+}
+
+bool operator==(HistogramView lhs, HistogramView rhs) noexcept {
+  if (lhs.GetBucketCount() != rhs.GetBucketCount() ||
+      lhs.GetValueAtInf() != rhs.GetValueAtInf() ||
+      lhs.GetSum() != rhs.GetSum()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < lhs.GetBucketCount(); ++i) {
+    if (lhs.GetUpperBoundAt(i) != rhs.GetUpperBoundAt(i) ||
+        lhs.GetValueAt(i) != rhs.GetValueAt(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool operator!=(HistogramView lhs, HistogramView rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
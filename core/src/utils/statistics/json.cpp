@@ -1,6 +1,7 @@
 #include <userver/utils/statistics/json.hpp>
 
 #include <string_view>
+#include <type_traits>
 
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utils/assert.hpp>
@@ -20,10 +21,17 @@ class JsonFormat final : public utils::statistics::BaseFormatBuilder {
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
     formats::json::ValueBuilder node;
-    value.Visit([&node](const auto& v) { node["value"] = v; });
+    value.Visit([&node](const auto& v) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(v)>, HistogramView>) {
+        node["value"] = BuildHistogram(v);
+      } else {
+        node["value"] = v;
+      }
+    });
     node["labels"] = BuildLabels(labels);
     node["type"] = value.Visit(utils::Overloaded{
         [](const Rate&) -> std::string_view { return "RATE"; },
+        [](const HistogramView&) -> std::string_view { return "HIST_RATE"; },
         [](const auto&) -> std::string_view { return "GAUGE"; }});
 
     builder_[std::string{path}].PushBack(std::move(node));
@@ -43,6 +51,21 @@ class JsonFormat final : public utils::statistics::BaseFormatBuilder {
     return result;
   }
 
+  static formats::json::ValueBuilder BuildHistogram(HistogramView histogram) {
+    formats::json::ValueBuilder bounds{formats::common::Type::kArray};
+    formats::json::ValueBuilder buckets{formats::common::Type::kArray};
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      bounds.PushBack(histogram.GetUpperBoundAt(i));
+      buckets.PushBack(histogram.GetValueAt(i));
+    }
+
+    formats::json::ValueBuilder result{formats::common::Type::kObject};
+    result["bounds"] = std::move(bounds);
+    result["buckets"] = std::move(buckets);
+    result["inf"] = histogram.GetValueAtInf();
+    return result;
+  }
+
   formats::json::ValueBuilder builder_{formats::common::Type::kObject};
 };
 
@@ -44,6 +44,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
     const auto type = value.Visit(utils::Overloaded{
         [](const Rate&) -> std::string_view { return "RATE"; },
+        [](const HistogramView&) -> std::string_view { return "HIST_RATE"; },
         [](const auto&) -> std::string_view { return "GAUGE"; }});
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("\t{}\t{}\n"), type,
                    value);
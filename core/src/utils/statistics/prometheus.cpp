@@ -1,8 +1,10 @@
 #include <userver/utils/statistics/prometheus.hpp>
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -29,12 +31,16 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
+    if (value.IsHistogram()) {
+      DumpHistogram(path, labels, value.AsHistogram());
+      return;
+    }
     DumpMetricNameAndType(path, value);
     DumpLabels(labels);
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
   }
 
-  std::string Release() { return fmt::to_string(buf_); }
+  std::string Release() { return std::move(buf_); }
 
  private:
   void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
@@ -50,37 +56,141 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     metrics_.emplace(name, std::move(prometheus_name));
   }
 
+  // Prometheus text format has no native histograms, so the cumulative
+  // `_bucket` series are written. Empty buckets do not change the cumulative
+  // counts and are skipped to keep the output small.
+  void DumpHistogram(std::string_view path,
+                     utils::statistics::LabelsSpan labels,
+                     HistogramView histogram) {
+    const auto& name = GetHistogramName(path);
+
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      const auto count = histogram.GetValueAt(i);
+      if (count == 0) continue;
+      cumulative += count;
+      std::array<char, kMaxDoubleLength> le;
+      const auto le_size =
+          fmt::format_to_n(le.data(), le.size(), FMT_COMPILE("{}"),
+                           histogram.GetUpperBoundAt(i))
+              .size;
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket"), name);
+      DumpLabels(labels, std::string_view{le.data(), le_size});
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"),
+                     cumulative);
+    }
+    cumulative += histogram.GetValueAtInf();
+
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket"), name);
+    DumpLabels(labels, "+Inf");
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n{}_sum"),
+                   cumulative, name);
+    DumpLabels(labels);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n{}_count"),
+                   histogram.GetSum(), name);
+    DumpLabels(labels);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), cumulative);
+  }
+
+  const std::string& GetHistogramName(std::string_view path) {
+    if (const auto* const converted =
+            utils::impl::FindTransparentOrNullptr(metrics_, path)) {
+      return *converted;
+    }
+
+    auto prometheus_name = impl::ToPrometheusName(path);
+    if constexpr (IsTyped == Typed::kYes) {
+      fmt::format_to(std::back_inserter(buf_),
+                     FMT_COMPILE("# TYPE {} histogram\n"), prometheus_name);
+    }
+    return metrics_.emplace(path, std::move(prometheus_name)).first->second;
+  }
+
   void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
                       [[maybe_unused]] const MetricValue& value) {
     if constexpr (IsTyped == Typed::kYes) {
       const auto type = value.Visit(utils::Overloaded{
           [](const Rate&) -> std::string_view { return "counter"; },
+          [](const HistogramView&) -> std::string_view { return "histogram"; },
           [](const auto&) -> std::string_view { return "gauge"; }});
       fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"),
                      prometheus_name, type);
     }
   }
 
-  void DumpLabels(utils::statistics::LabelsSpan labels) {
+  void DumpLabels(utils::statistics::LabelsSpan labels,
+                  std::string_view le = {}) {
+    UpdateEncodedLabels(labels);
     buf_.push_back('{');
-    bool sep = false;
-    for (const auto& label : labels) {
-      if (sep) {
+    buf_.append(encoded_labels_);
+    if (!le.empty()) {
+      if (!encoded_labels_.empty()) {
         buf_.push_back(',');
       }
-      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""),
-                     impl::ToPrometheusLabel(label.Name()));
-      const auto& value = label.Value();
-      std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_),
-                        '"', '\'');
-      buf_.push_back('"');
-      sep = true;
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""), le);
     }
     buf_.push_back('}');
   }
 
-  fmt::memory_buffer buf_;
+  // Consecutive metrics usually share the leading labels (the labels of the
+  // request, of the writer and of the parent Writer), so the encoding of the
+  // labels of the previous metric is reused up to the first difference.
+  void UpdateEncodedLabels(utils::statistics::LabelsSpan labels) {
+    std::size_t common = 0;
+    auto it = labels.begin();
+    for (; it != labels.end() && common < encoded_labels_cache_.size();
+         ++it, ++common) {
+      if (!(LabelView{encoded_labels_cache_[common].label} == *it)) break;
+    }
+    if (it == labels.end() && common == encoded_labels_cache_.size()) {
+      return;
+    }
+
+    encoded_labels_cache_.erase(encoded_labels_cache_.begin() + common,
+                                encoded_labels_cache_.end());
+    encoded_labels_.resize(
+        common == 0 ? 0 : encoded_labels_cache_[common - 1].encoded_end);
+
+    for (; it != labels.end(); ++it) {
+      const auto label = *it;
+      if (!encoded_labels_.empty()) {
+        encoded_labels_.push_back(',');
+      }
+      encoded_labels_.append(GetLabelName(label.Name()));
+      encoded_labels_.append("=\"");
+      const auto& value = label.Value();
+      std::replace_copy(value.cbegin(), value.cend(),
+                        std::back_inserter(encoded_labels_), '"', '\'');
+      encoded_labels_.push_back('"');
+      encoded_labels_cache_.push_back(
+          {Label{label}, encoded_labels_.size()});
+    }
+  }
+
+  const std::string& GetLabelName(std::string_view name) {
+    if (const auto* const converted =
+            utils::impl::FindTransparentOrNullptr(label_names_, name)) {
+      return *converted;
+    }
+    return label_names_.emplace(name, impl::ToPrometheusLabel(name))
+        .first->second;
+  }
+
+  struct EncodedLabel final {
+    Label label;
+    // The size of `encoded_labels_` up to and including this label
+    std::size_t encoded_end;
+  };
+
+  // Enough for the shortest representation of any double
+  static constexpr std::size_t kMaxDoubleLength = 32;
+
+  // Written directly to the resulting string to avoid copying it on Release
+  std::string buf_;
   utils::impl::TransparentMap<std::string, std::string> metrics_;
+  utils::impl::TransparentMap<std::string, std::string> label_names_;
+  std::vector<EncodedLabel> encoded_labels_cache_;
+  std::string encoded_labels_;
 };
 
 }  // namespace
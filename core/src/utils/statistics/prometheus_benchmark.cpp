@@ -0,0 +1,40 @@
+#include <userver/utils/statistics/prometheus.hpp>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+void prometheus_format(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto handlers = state.range(0);
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter(
+        "http", [handlers](utils::statistics::Writer& writer) {
+          for (std::int64_t i = 0; i < handlers; ++i) {
+            const auto path = "/v1/handler-" + std::to_string(i);
+            writer["in-flight"].ValueWithLabels(i, {"http_handler", path});
+            for (const int code : {200, 400, 404, 500}) {
+              writer["reply-codes"].ValueWithLabels(
+                  code,
+                  {{"http_handler", path}, {"http_code", std::to_string(code)}});
+            }
+          }
+        });
+    const auto request = utils::statistics::Request::MakeWithPrefix(
+        {}, {{"application", "benchmark"}});
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          utils::statistics::ToPrometheusFormat(storage, request));
+    }
+  });
+}
+BENCHMARK(prometheus_format)->Arg(100)->Arg(10'000);
+
+USERVER_NAMESPACE_END
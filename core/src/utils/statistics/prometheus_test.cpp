@@ -5,6 +5,7 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <userver/formats/json/serialize.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
@@ -413,6 +414,51 @@ child{application="processing"} 8
   }
 }
 
+UTEST(MetricsPrometheus, LabelsOfConsecutiveMetrics) {
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder =
+      statistics_storage.RegisterWriter("m", [](Writer& writer) {
+        writer.ValueWithLabels(1, {{"a", "1"}, {"b", "2"}});
+        writer.ValueWithLabels(2, {{"a", "1"}, {"b", "3"}});
+        writer.ValueWithLabels(3, {"a", "1"});
+        writer.ValueWithLabels(4, {{"a", "1"}, {"b", "2"}, {"c", "\"x\""}});
+        writer.ValueWithLabels(5, {"b", "2"});
+        writer = 6;
+      });
+
+  constexpr std::string_view expected = R"(
+# TYPE m gauge
+m{application="processing",a="1",b="2"} 1
+m{application="processing",a="1",b="3"} 2
+m{application="processing",a="1"} 3
+m{application="processing",a="1",b="2",c="'x'"} 4
+m{application="processing",b="2"} 5
+m{application="processing"} 6
+)";
+  TestToMetricsPrometheus(statistics_storage, expected.substr(1));
+}
+
+UTEST(MetricsPrometheus, Histogram) {
+  HdrHistogram<10, 1> histogram;
+  histogram.Account(1);
+  histogram.Account(4, 2);
+  histogram.Account(100);
+
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "hist", [&](Writer& writer) { writer = histogram; });
+
+  constexpr std::string_view expected = R"(
+# TYPE hist histogram
+hist_bucket{application="processing",le="1"} 1
+hist_bucket{application="processing",le="5"} 3
+hist_bucket{application="processing",le="+Inf"} 4
+hist_sum{application="processing"} 109
+hist_count{application="processing"} 4
+)";
+  TestToMetricsPrometheus(statistics_storage, expected.substr(1));
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
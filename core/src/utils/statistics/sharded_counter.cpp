@@ -0,0 +1,36 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <compiler/tls.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+namespace {
+
+std::atomic<std::size_t> next_shard_index{0};
+
+thread_local const std::size_t local_shard_index =
+    next_shard_index.fetch_add(1, std::memory_order_relaxed) %
+    kThreadShardCount;
+
+}  // namespace
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetThreadShardIndex() noexcept {
+  return local_shard_index;
+}
+
+}  // namespace impl
+
+void DumpMetric(Writer& writer, const ShardedRateCounter& value) {
+  writer = value.Load();
+}
+
+void ResetMetric(ShardedRateCounter& value) { value.Store(Rate{0}); }
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,44 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename Counter>
+void Increment(benchmark::State& state) {
+  static Counter counter;
+
+  for (auto _ : state) {
+    ++counter;
+  }
+  benchmark::DoNotOptimize(counter.Load());
+}
+
+}  // namespace
+
+void relaxed_counter_increment(benchmark::State& state) {
+  Increment<utils::statistics::RelaxedCounter<std::uint64_t>>(state);
+}
+BENCHMARK(relaxed_counter_increment)->ThreadRange(1, 32);
+
+void sharded_counter_increment(benchmark::State& state) {
+  Increment<utils::statistics::ShardedCounter<std::uint64_t>>(state);
+}
+BENCHMARK(sharded_counter_increment)->ThreadRange(1, 32);
+
+void sharded_counter_load(benchmark::State& state) {
+  utils::statistics::ShardedCounter<std::uint64_t> counter{42};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(counter.Load());
+  }
+}
+BENCHMARK(sharded_counter_load);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,118 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/metrics_storage.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+struct ShardedMetric final {
+  ShardedCounter<std::int64_t> gauge;
+  ShardedRateCounter rate;
+};
+
+void DumpMetric(Writer& writer, const ShardedMetric& metric) {
+  writer["gauge"] = metric.gauge;
+  writer["rate"] = metric.rate;
+}
+
+void ResetMetric(ShardedMetric& metric) {
+  ResetMetric(metric.gauge);
+  ResetMetric(metric.rate);
+}
+
+const MetricTag<ShardedMetric> kShardedMetric{"sharded-metric"};
+
+}  // namespace
+
+TEST(ShardedCounter, Basic) {
+  ShardedCounter<std::int64_t> counter;
+  EXPECT_EQ(counter.Load(), 0);
+
+  ++counter;
+  counter++;
+  counter += 10;
+  EXPECT_EQ(counter.Load(), 12);
+
+  --counter;
+  counter -= 20;
+  EXPECT_EQ(counter.Load(), -9);
+
+  counter = 5;
+  EXPECT_EQ(counter, 5);
+
+  const ShardedCounter<std::int64_t> copy{counter};
+  EXPECT_EQ(copy.Load(), 5);
+}
+
+TEST(ShardedCounter, Unsigned) {
+  ShardedCounter<std::size_t> counter;
+  ++counter;
+  ++counter;
+  --counter;
+  EXPECT_EQ(counter.Load(), 1);
+}
+
+TEST(ShardedRateCounter, Basic) {
+  ShardedRateCounter counter{Rate{10}};
+  ++counter;
+  counter++;
+  counter += Rate{8};
+  EXPECT_EQ(counter.Load(), Rate{20});
+
+  counter.Store(Rate{1});
+  EXPECT_EQ(counter.Load(), Rate{1});
+}
+
+UTEST_MT(ShardedCounter, Concurrent, 4) {
+  constexpr std::size_t kTasks = 16;
+  constexpr std::size_t kIterations = 10'000;
+
+  ShardedCounter<std::uint64_t> counter;
+  ShardedRateCounter rate;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        ++counter;
+        ++rate;
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(counter.Load(), kTasks * kIterations);
+  EXPECT_EQ(rate.Load(), Rate{kTasks * kIterations});
+}
+
+UTEST(ShardedCounter, MetricsStorage) {
+  Storage storage;
+  MetricsStorage metrics_storage;
+  const auto holders = metrics_storage.RegisterIn(storage);
+
+  auto& metric = metrics_storage.GetMetric(kShardedMetric);
+  metric.gauge += 3;
+  metric.rate += Rate{5};
+
+  const Snapshot snapshot{storage, "sharded-metric"};
+  EXPECT_EQ(snapshot.SingleMetric("gauge").AsInt(), 3);
+  EXPECT_EQ(snapshot.SingleMetric("rate").AsRate(), Rate{5});
+
+  metrics_storage.ResetMetrics();
+  EXPECT_EQ(metric.gauge.Load(), 0);
+  EXPECT_EQ(metric.rate.Load(), Rate{0});
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <userver/utils/statistics/solomon.hpp>
 
+#include <algorithm>
 #include <array>
+#include <type_traits>
 
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/log.hpp>
@@ -29,8 +31,21 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
     formats::json::StringBuilder::ObjectGuard guard{builder_};
     builder_.Key("labels");
     DumpLabels(path, labels);
+
+    if (value.IsHistogram()) {
+      builder_.Key("type");
+      builder_.WriteString("HIST_RATE");
+      builder_.Key("hist");
+      DumpHistogram(value.AsHistogram());
+      return;
+    }
+
     builder_.Key("value");
-    value.Visit([this](auto x) { WriteToStream(x, builder_); });
+    value.Visit([this](auto x) {
+      if constexpr (!std::is_same_v<decltype(x), HistogramView>) {
+        WriteToStream(x, builder_);
+      }
+    });
 
     if (value.IsRate()) {
       builder_.Key("type");
@@ -48,6 +63,39 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
   }
 
  private:
+  // Solomon limits the bucket count, so the adjacent buckets are merged in
+  // equal groups. The grouping depends only on the bucket count, so the bounds
+  // are the same from one dump to another.
+  void DumpHistogram(HistogramView histogram) {
+    const auto bucket_count = histogram.GetBucketCount();
+    const auto step =
+        (bucket_count + impl::solomon::kMaxHistogramBuckets - 1) /
+        impl::solomon::kMaxHistogramBuckets;
+
+    formats::json::StringBuilder::ObjectGuard guard{builder_};
+    builder_.Key("bounds");
+    {
+      formats::json::StringBuilder::ArrayGuard array_guard{builder_};
+      for (std::size_t i = 0; i < bucket_count; i += step) {
+        const auto last = std::min(i + step, bucket_count) - 1;
+        builder_.WriteDouble(histogram.GetUpperBoundAt(last));
+      }
+    }
+    builder_.Key("buckets");
+    {
+      formats::json::StringBuilder::ArrayGuard array_guard{builder_};
+      for (std::size_t i = 0; i < bucket_count; i += step) {
+        std::uint64_t count = 0;
+        for (std::size_t j = i; j < std::min(i + step, bucket_count); ++j) {
+          count += histogram.GetValueAt(j);
+        }
+        builder_.WriteUInt64(count);
+      }
+    }
+    builder_.Key("inf");
+    builder_.WriteUInt64(histogram.GetValueAtInf());
+  }
+
   void DumpLabels(std::string_view path, utils::statistics::LabelsSpan labels) {
     formats::json::StringBuilder::ObjectGuard guard{builder_};
     builder_.Key("sensor");
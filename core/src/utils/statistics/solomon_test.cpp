@@ -3,10 +3,13 @@
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <userver/utils/statistics/hdr_histogram.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/statistics/solomon.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
+#include <utils/statistics/solomon_limits.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::statistics::impl {
@@ -397,6 +400,58 @@ UTEST(MetricsSolomon, RateMetric) {
   TestToMetricsSolomon(statistics_storage, expected);
 }
 
+UTEST(MetricsSolomon, Histogram) {
+  HdrHistogram<10, 1> histogram;
+  histogram.Account(1);
+  histogram.Account(4, 2);
+  histogram.Account(100);
+
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "hist", [&](Writer& writer) { writer = histogram; });
+
+  const auto* const expected = R"([
+    {"labels": {"sensor": "hist"}, "type": "HIST_RATE", "hist": {
+      "bounds": [0.0, 1.0, 2.0, 3.0, 5.0, 7.0, 11.0],
+      "buckets": [0, 1, 0, 0, 2, 0, 0],
+      "inf": 1
+    }}
+  ])";
+  TestToMetricsSolomon(statistics_storage, expected);
+}
+
+UTEST(MetricsSolomon, HistogramBucketsLimit) {
+  using Histogram = HdrHistogram<1'000'000>;
+  static_assert(Histogram::kBucketCount > solomon::kMaxHistogramBuckets);
+
+  Histogram histogram;
+  for (std::uint64_t value = 1; value <= 1'000'000; value *= 3) {
+    histogram.Account(value);
+  }
+
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "hist", [&](Writer& writer) { writer = histogram; });
+
+  const auto result = formats::json::FromString(
+      ToSolomonFormat(statistics_storage, {}))["metrics"][0]["hist"];
+  const auto bounds = result["bounds"];
+  const auto buckets = result["buckets"];
+  ASSERT_LE(bounds.GetSize(), solomon::kMaxHistogramBuckets);
+  ASSERT_EQ(bounds.GetSize(), buckets.GetSize());
+
+  std::uint64_t total = 0;
+  for (std::size_t i = 0; i < bounds.GetSize(); ++i) {
+    if (i != 0) {
+      EXPECT_LT(bounds[i - 1].As<double>(), bounds[i].As<double>());
+    }
+    total += buckets[i].As<std::uint64_t>();
+  }
+  EXPECT_EQ(total, histogram.Count());
+  EXPECT_EQ(bounds[bounds.GetSize() - 1].As<double>(),
+            Histogram::GetUpperBoundAt(Histogram::kBucketCount - 1));
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,123 @@
+#include <utils/statistics/statsd.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/utils/overloaded.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+bool IsStatsdPrintable(char c) noexcept {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '-' ||
+         c == '_' || c == '/';
+}
+
+void AppendStatsdSafe(std::string& out, std::string_view value) {
+  std::replace_copy_if(
+      value.cbegin(), value.cend(), std::back_inserter(out),
+      [](char c) { return !IsStatsdPrintable(c); }, '_');
+}
+
+using Rates = std::unordered_map<std::string, std::uint64_t>;
+
+class FormatBuilder final : public BaseFormatBuilder {
+ public:
+  FormatBuilder(std::size_t max_datagram_size, const Rates& previous_rates)
+      : max_datagram_size_(max_datagram_size),
+        previous_rates_(previous_rates) {}
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override {
+    // StatsD has no histograms
+    if (value.IsHistogram()) return;
+
+    name_.clear();
+    AppendStatsdSafe(name_, path);
+    tags_.clear();
+    for (const auto& label : labels) {
+      tags_ += tags_.empty() ? "|#" : ",";
+      AppendStatsdSafe(tags_, label.Name());
+      tags_.push_back(':');
+      AppendStatsdSafe(tags_, label.Value());
+    }
+
+    value.Visit(utils::Overloaded{
+        [&](Rate rate) {
+          auto key = name_ + tags_;
+          const auto it = previous_rates_.find(key);
+          const auto previous = (it == previous_rates_.end()) ? 0 : it->second;
+          // The counter was reset if it has decreased
+          const auto delta =
+              (rate.value >= previous) ? rate.value - previous : rate.value;
+          if (delta != 0) {
+            AppendLine(fmt::format(FMT_COMPILE("{}:{}|c{}"), name_, delta,
+                                   tags_));
+          }
+          rates_.emplace(std::move(key), rate.value);
+        },
+        [&](HistogramView) {},
+        [&](auto gauge) {
+          // A signed gauge value is a change of the gauge in StatsD
+          if (gauge < 0) {
+            AppendLine(fmt::format(FMT_COMPILE("{0}:0|g{2}\n{0}:{1}|g{2}"),
+                                   name_, gauge, tags_));
+          } else {
+            AppendLine(
+                fmt::format(FMT_COMPILE("{}:{}|g{}"), name_, gauge, tags_));
+          }
+        },
+    });
+  }
+
+  std::vector<std::string> ReleaseDatagrams() {
+    if (!datagram_.empty()) datagrams_.push_back(std::move(datagram_));
+    return std::move(datagrams_);
+  }
+
+  Rates ReleaseRates() { return std::move(rates_); }
+
+ private:
+  void AppendLine(std::string_view line) {
+    if (!datagram_.empty() &&
+        datagram_.size() + 1 + line.size() > max_datagram_size_) {
+      datagrams_.push_back(std::move(datagram_));
+      datagram_.clear();
+    }
+    if (!datagram_.empty()) datagram_.push_back('\n');
+    datagram_.append(line);
+  }
+
+  const std::size_t max_datagram_size_;
+  const Rates& previous_rates_;
+  Rates rates_;
+  std::string name_;
+  std::string tags_;
+  std::vector<std::string> datagrams_;
+  std::string datagram_;
+};
+
+}  // namespace
+
+StatsdFormatter::StatsdFormatter(std::size_t max_datagram_size)
+    : max_datagram_size_(max_datagram_size) {}
+
+std::vector<std::string> StatsdFormatter::Format(const Storage& storage,
+                                                 const Request& request) {
+  FormatBuilder builder{max_datagram_size_, previous_rates_};
+  storage.VisitMetrics(builder, request);
+  // The rates of the gone metrics are forgotten
+  previous_rates_ = builder.ReleaseRates();
+  return builder.ReleaseDatagrams();
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
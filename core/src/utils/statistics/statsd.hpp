@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+// Serializes the metrics into StatsD lines with DogStatsD tags, packed into
+// datagrams of at most `max_datagram_size` bytes.
+//
+// Rate metrics are sent as counters with the delta since the previous
+// Format() call (delta temporality), the unchanged ones are skipped. Integer
+// and floating-point metrics are sent as gauges. Histograms are skipped.
+class StatsdFormatter final {
+ public:
+  explicit StatsdFormatter(std::size_t max_datagram_size);
+
+  std::vector<std::string> Format(const Storage& storage,
+                                  const Request& request = {});
+
+ private:
+  const std::size_t max_datagram_size_;
+  std::unordered_map<std::string, std::uint64_t> previous_rates_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,242 @@
+#include <userver/utils/statistics/statsd_pusher.hpp>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <userver/clients/dns/component.hpp>
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <utils/check_syscall.hpp>
+#include <utils/statistics/statsd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+utils::statistics::Request MakeRequest(const ComponentConfig& config) {
+  utils::statistics::Request::AddLabels labels;
+  for (const auto& [name, value] : Items(config["labels"])) {
+    labels.emplace(name, value.As<std::string>());
+  }
+  return utils::statistics::Request::MakeWithPrefix(
+      config["prefix"].As<std::string>(""), std::move(labels));
+}
+
+bool IsSameAddress(const engine::io::Sockaddr& lhs,
+                   const engine::io::Sockaddr& rhs) {
+  return lhs.Size() == rhs.Size() &&
+         std::memcmp(lhs.Data(), rhs.Data(), lhs.Size()) == 0;
+}
+
+// Returns the count of the sent datagrams
+std::size_t SendDatagrams(engine::io::Socket& socket,
+                          const std::vector<std::string>& datagrams,
+                          engine::Deadline deadline) {
+#ifdef __linux__
+  // A syscall for a batch of the datagrams instead of a syscall per datagram
+  constexpr std::size_t kMaxBatchSize = 64;
+  std::array<struct ::mmsghdr, kMaxBatchSize> messages{};
+  std::array<struct ::iovec, kMaxBatchSize> iovecs{};
+
+  std::size_t sent = 0;
+  while (sent < datagrams.size()) {
+    const auto batch_size = std::min(kMaxBatchSize, datagrams.size() - sent);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      auto& datagram = datagrams[sent + i];
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      iovecs[i].iov_base = const_cast<char*>(datagram.data());
+      iovecs[i].iov_len = datagram.size();
+      messages[i] = {};
+      messages[i].msg_hdr.msg_iov = &iovecs[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const auto result =
+        ::sendmmsg(socket.Fd(), messages.data(), batch_size, MSG_NOSIGNAL);
+    if (result == -1) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        if (!socket.WaitWriteable(deadline)) throw engine::io::IoTimeout();
+        continue;
+      }
+      utils::CheckSyscallCustomException<engine::io::IoSystemError>(
+          -1, "sending StatsD datagrams");
+    }
+    sent += static_cast<std::size_t>(result);
+  }
+  return sent;
+#else
+  // MAC_COMPAT: no sendmmsg
+  for (const auto& datagram : datagrams) {
+    [[maybe_unused]] const auto sent =
+        socket.SendAll(datagram.data(), datagram.size(), deadline);
+  }
+  return datagrams.size();
+#endif
+}
+
+}  // namespace
+
+class StatsdPusher::Impl final {
+ public:
+  Impl(const ComponentConfig& config, const ComponentContext& context)
+      : storage_(context.FindComponent<components::StatisticsStorage>()
+                     .GetStorage()),
+        resolver_(context.FindComponent<clients::dns::Component>()
+                      .GetResolver()),
+        host_(config["host"].As<std::string>("localhost")),
+        port_(config["port"].As<int>(8125)),
+        period_(config["period"].As<std::chrono::milliseconds>(
+            std::chrono::seconds{10})),
+        request_(MakeRequest(config)),
+        formatter_(config["max-datagram-size"].As<std::size_t>(1432)) {
+    push_task_.Start("statsd-pusher", {period_, {}, logging::Level::kDebug},
+                     [this] { Push(); });
+  }
+
+  void Stop() {
+    push_task_.Stop();
+    try {
+      // The last period of the short-lived processes
+      Push();
+    } catch (const std::exception& e) {
+      LOG_ERROR() << "Failed to push the metrics on stop: " << e;
+    }
+  }
+
+  void WriteStatistics(utils::statistics::Writer& writer) const {
+    writer["datagrams"] = datagrams_;
+    writer["bytes"] = bytes_;
+    writer["errors"] = errors_;
+  }
+
+ private:
+  void Push() {
+    const auto datagrams = formatter_.Format(storage_, request_);
+    if (datagrams.empty()) return;
+
+    const auto deadline = engine::Deadline::FromDuration(period_);
+    try {
+      auto& socket = GetSocket(deadline);
+      const auto sent = SendDatagrams(socket, datagrams, deadline);
+      datagrams_ += utils::statistics::Rate{sent};
+      for (std::size_t i = 0; i < sent; ++i) {
+        bytes_ += utils::statistics::Rate{datagrams[i].size()};
+      }
+    } catch (const std::exception&) {
+      ++errors_;
+      // The agent may have been restarted on another address
+      socket_ = {};
+      throw;
+    }
+  }
+
+  engine::io::Socket& GetSocket(engine::Deadline deadline) {
+    auto address = resolver_.Resolve(host_, deadline).front();
+    address.SetPort(port_);
+    if (!socket_.IsValid() || !IsSameAddress(address, address_)) {
+      socket_ = engine::io::Socket{address.Domain(),
+                                   engine::io::SocketType::kDgram};
+      socket_.Connect(address, deadline);
+      address_ = address;
+    }
+    return socket_;
+  }
+
+  utils::statistics::Storage& storage_;
+  clients::dns::Resolver& resolver_;
+  const std::string host_;
+  const int port_;
+  const std::chrono::milliseconds period_;
+  const utils::statistics::Request request_;
+
+  utils::statistics::impl::StatsdFormatter formatter_;
+  engine::io::Sockaddr address_;
+  engine::io::Socket socket_;
+
+  utils::statistics::RateCounter datagrams_;
+  utils::statistics::RateCounter bytes_;
+  utils::statistics::RateCounter errors_;
+
+  utils::PeriodicTask push_task_;
+};
+
+StatsdPusher::StatsdPusher(const ComponentConfig& config,
+                           const ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      impl_(std::make_unique<Impl>(config, context)) {
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("statsd-pusher",
+                          [this](utils::statistics::Writer& writer) {
+                            WriteStatistics(writer);
+                          });
+}
+
+StatsdPusher::~StatsdPusher() { statistics_holder_.Unregister(); }
+
+void StatsdPusher::OnAllComponentsAreStopping() { impl_->Stop(); }
+
+void StatsdPusher::WriteStatistics(utils::statistics::Writer& writer) {
+  impl_->WriteStatistics(writer);
+}
+
+yaml_config::Schema StatsdPusher::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: Component that periodically pushes the metrics to a StatsD agent
+additionalProperties: false
+properties:
+    host:
+        type: string
+        description: host of the StatsD agent
+        defaultDescription: localhost
+    port:
+        type: integer
+        description: UDP port of the StatsD agent
+        defaultDescription: 8125
+        minimum: 1
+        maximum: 65535
+    period:
+        type: string
+        description: period of the metrics push
+        defaultDescription: 10s
+    max-datagram-size:
+        type: integer
+        description: max size of a UDP datagram
+        defaultDescription: 1432
+        minimum: 64
+    prefix:
+        type: string
+        description: |
+            push only the metrics with the path that starts with the prefix
+    labels:
+        type: object
+        description: labels to add to each metric
+        additionalProperties:
+            type: string
+            description: label value
+        properties: {}
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <utils/statistics/statsd.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(MetricsStatsd, Format) {
+  utils::statistics::Storage storage;
+  utils::statistics::RateCounter requests{10};
+  const auto holder = storage.RegisterWriter(
+      "service", [&](utils::statistics::Writer& writer) {
+        writer["requests"].ValueWithLabels(requests, {"handler", "/v1/some"});
+        writer["queue-size"] = 5;
+        writer["balance"] = -2;
+        writer["load"] = 0.5;
+      });
+
+  utils::statistics::impl::StatsdFormatter formatter{1000};
+  const auto datagrams = formatter.Format(storage);
+  ASSERT_EQ(datagrams.size(), 1);
+  EXPECT_EQ(datagrams[0],
+            "service.requests:10|c|#handler:/v1/some\n"
+            "service.queue-size:5|g\n"
+            "service.balance:0|g\n"
+            "service.balance:-2|g\n"
+            "service.load:0.5|g");
+}
+
+UTEST(MetricsStatsd, DeltaTemporality) {
+  utils::statistics::Storage storage;
+  utils::statistics::RateCounter requests{10};
+  utils::statistics::RateCounter errors{1};
+  const auto holder = storage.RegisterWriter(
+      "service", [&](utils::statistics::Writer& writer) {
+        writer["requests"] = requests;
+        writer["errors"] = errors;
+      });
+
+  utils::statistics::impl::StatsdFormatter formatter{1000};
+  EXPECT_EQ(formatter.Format(storage),
+            std::vector<std::string>{
+                "service.requests:10|c\nservice.errors:1|c"});
+
+  // The unchanged counters are not sent
+  requests += utils::statistics::Rate{5};
+  EXPECT_EQ(formatter.Format(storage),
+            std::vector<std::string>{"service.requests:5|c"});
+  EXPECT_TRUE(formatter.Format(storage).empty());
+
+  // The counter was reset
+  requests = utils::statistics::Rate{3};
+  EXPECT_EQ(formatter.Format(storage),
+            std::vector<std::string>{"service.requests:3|c"});
+}
+
+UTEST(MetricsStatsd, Datagrams) {
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "metric", [&](utils::statistics::Writer& writer) {
+        for (int i = 0; i < 100; ++i) {
+          writer.ValueWithLabels(i, {"label", "a;b" + std::to_string(i)});
+        }
+      });
+
+  constexpr std::size_t kMaxDatagramSize = 100;
+  utils::statistics::impl::StatsdFormatter formatter{kMaxDatagramSize};
+  const auto datagrams = formatter.Format(storage);
+  ASSERT_GT(datagrams.size(), 1);
+
+  std::size_t lines = 0;
+  for (const auto& datagram : datagrams) {
+    EXPECT_LE(datagram.size(), kMaxDatagramSize);
+    EXPECT_EQ(datagram.find(';'), std::string::npos) << datagram;
+    lines += std::count(datagram.begin(), datagram.end(), '\n') + 1;
+  }
+  EXPECT_EQ(lines, 100);
+  EXPECT_EQ(datagrams[0].substr(0, datagrams[0].find('\n')),
+            "metric:0|g|#label:a_b0");
+}
+
+USERVER_NAMESPACE_END
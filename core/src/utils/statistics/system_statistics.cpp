@@ -2,9 +2,9 @@
 
 #ifdef __APPLE__
 #include <mach/mach.h>
+#endif
 #include <sys/resource.h>
 #include <sys/time.h>
-#endif
 #include <unistd.h>
 
 #include <algorithm>
@@ -148,27 +148,28 @@ void ParseProcStatIo(std::string_view data, SystemStats& stats) {
   }
 }
 
-SystemStats GetSystemStatisticsByProcPath(std::string_view path) {
-  SystemStats stats;
+void ReadProcStat(std::string_view path, SystemStats& stats) {
   try {
     ParseProcStat(fs::blocking::ReadFileContents(fmt::format("{}/stat", path)),
                   stats);
   } catch (const std::exception& ex) {
     LOG_LIMITED_DEBUG() << "Could not get stats from " << path << ": " << ex;
   }
+}
 
-  {
-    boost::system::error_code ec;
-    boost::filesystem::directory_iterator it{fmt::format("{}/fd", path), ec};
-    if (!ec) {
-      stats.open_files = 0;
-      while (!ec && it != boost::filesystem::directory_iterator{}) {
-        ++*stats.open_files;
-        it.increment(ec);
-      }
+void CountOpenFiles(std::string_view path, SystemStats& stats) {
+  boost::system::error_code ec;
+  boost::filesystem::directory_iterator it{fmt::format("{}/fd", path), ec};
+  if (!ec) {
+    stats.open_files = 0;
+    while (!ec && it != boost::filesystem::directory_iterator{}) {
+      ++*stats.open_files;
+      it.increment(ec);
     }
   }
+}
 
+void ReadProcStatIo(std::string_view path, SystemStats& stats) {
   try {
     ParseProcStatIo(fs::blocking::ReadFileContents(fmt::format("{}/io", path)),
                     stats);
@@ -176,7 +177,48 @@ SystemStats GetSystemStatisticsByProcPath(std::string_view path) {
     LOG_LIMITED_DEBUG() << "Could not get I/O stats from " << path << ": "
                         << ex;
   }
+}
+
+SystemStats GetSystemStatisticsByProcPath(std::string_view path) {
+  SystemStats stats;
+  ReadProcStat(path, stats);
+  CountOpenFiles(path, stats);
+  ReadProcStatIo(path, stats);
+  return stats;
+}
+
+// The CPU time and the page faults of the current process come from
+// getrusage(2) with the microsecond precision instead of the clock ticks of
+// /proc/self/stat, and RSS comes from the much shorter /proc/self/statm
+SystemStats GetSelfSystemStatisticsFromProc() {
+  static const auto kPageSizeKb = sysconf(_SC_PAGESIZE) / 1024;
+
+  SystemStats stats;
+  {
+    struct rusage rusage {};
+    if (::getrusage(RUSAGE_SELF, &rusage) != -1) {
+      timeradd(&rusage.ru_utime, &rusage.ru_stime, &rusage.ru_utime);
+      stats.cpu_time_sec =
+          rusage.ru_utime.tv_sec + rusage.ru_utime.tv_usec * 1e-6;
+      stats.major_pagefaults = rusage.ru_majflt;
+    }
+  }
+
+  try {
+    // proc(5): "size resident shared text lib data dt", in pages
+    const auto statm = fs::blocking::ReadFileContents("/proc/self/statm");
+    const auto resident_pos = statm.find(' ') + 1;
+    const auto resident_end = statm.find(' ', resident_pos);
+    stats.rss_kb =
+        utils::FromString<std::int64_t>(
+            statm.substr(resident_pos, resident_end - resident_pos)) *
+        kPageSizeKb;
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_DEBUG() << "Could not get RSS from /proc/self/statm: " << ex;
+  }
 
+  CountOpenFiles("/proc/self", stats);
+  ReadProcStatIo("/proc/self", stats);
   return stats;
 }
 
@@ -273,7 +315,7 @@ static_assert(kHasWriterSupport<SystemStats>);
 
 SystemStats GetSelfSystemStatistics() {
 #if defined(__linux__)
-  return GetSystemStatisticsByProcPath("/proc/self");
+  return GetSelfSystemStatisticsFromProc();
 #elif defined(__APPLE__)
   return GetSelfSystemStatisticsFromKernel();
 #endif
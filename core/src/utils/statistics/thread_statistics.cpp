@@ -1,8 +1,13 @@
 #include <utils/statistics/thread_statistics.hpp>
 
-#include <algorithm>
-
+#include <fcntl.h>
+#include <pthread.h>
 #include <sys/resource.h>  // for RUSAGE_THREAD
+#include <unistd.h>
+#include <ctime>
+
+#include <algorithm>
+#include <charconv>
 
 #include <userver/utils/assert.hpp>
 
@@ -28,12 +33,57 @@ ThreadCpuUsage GetCurrentThreadCpuUsage() {
   ThreadCpuUsage result;
   result.user = timeval_to_mcs(usage.ru_utime);
   result.system = timeval_to_mcs(usage.ru_stime);
+  result.voluntary_context_switches = usage.ru_nvcsw;
+  result.involuntary_context_switches = usage.ru_nivcsw;
   return result;
 #else
   return {};
 #endif
 }
 
+std::optional<ThreadSchedStats> GetCurrentThreadSchedStats() {
+#ifdef __linux__
+  // Not fs::blocking::ReadFileContents to avoid the allocations and the
+  // exceptions in the ev-threads
+  const int fd = ::open("/proc/thread-self/schedstat", O_RDONLY | O_CLOEXEC);
+  if (fd == -1) return std::nullopt;
+
+  // "<run_time_ns> <run_delay_ns> <timeslices>\n"
+  char buffer[128];
+  const auto size = ::read(fd, buffer, sizeof(buffer));
+  ::close(fd);
+  if (size <= 0) return std::nullopt;
+
+  const char* const end = buffer + size;
+  std::uint64_t run_time = 0;
+  std::uint64_t run_delay = 0;
+  const auto run_time_result = std::from_chars(buffer, end, run_time);
+  if (run_time_result.ec != std::errc{} || run_time_result.ptr == end) {
+    return std::nullopt;
+  }
+  const auto run_delay_result =
+      std::from_chars(run_time_result.ptr + 1, end, run_delay);
+  if (run_delay_result.ec != std::errc{}) return std::nullopt;
+
+  ThreadSchedStats result;
+  result.run_time = std::chrono::nanoseconds{run_time};
+  result.run_delay = std::chrono::nanoseconds{run_delay};
+  return result;
+#else
+  return std::nullopt;
+#endif
+}
+
+std::chrono::nanoseconds GetThreadCpuTime(
+    std::thread::native_handle_type thread) {
+  clockid_t clock_id{};
+  if (pthread_getcpuclockid(thread, &clock_id) != 0) return {};
+
+  timespec ts{};
+  if (clock_gettime(clock_id, &ts) != 0) return {};
+  return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
 }  // namespace impl
 
 ThreadCpuStatsStorage::ThreadCpuStatsStorage(
@@ -57,6 +107,16 @@ std::uint8_t ThreadCpuStatsStorage::GetCurrentLoadPercent() const {
   return current_usage_pct_.load(std::memory_order_relaxed);
 }
 
+ThreadCpuStatsStorage::Stats ThreadCpuStatsStorage::GetStats() const {
+  Stats stats;
+  stats.voluntary_context_switches =
+      voluntary_context_switches_.load(std::memory_order_relaxed);
+  stats.involuntary_context_switches =
+      involuntary_context_switches_.load(std::memory_order_relaxed);
+  stats.run_delay = run_delay_.load(std::memory_order_relaxed);
+  return stats;
+}
+
 bool ThreadCpuStatsStorage::Throttle() {
   ++times_called_;
   if (times_called_ < throttle_) {
@@ -86,6 +146,16 @@ void ThreadCpuStatsStorage::DoCollect() {
                              std::memory_order_relaxed);
   }
 
+  voluntary_context_switches_.store(usage.voluntary_context_switches,
+                                    std::memory_order_relaxed);
+  involuntary_context_switches_.store(usage.involuntary_context_switches,
+                                      std::memory_order_relaxed);
+  if (const auto sched_stats = impl::GetCurrentThreadSchedStats()) {
+    run_delay_.store(std::chrono::duration_cast<std::chrono::microseconds>(
+                         sched_stats->run_delay),
+                     std::memory_order_relaxed);
+  }
+
   last_usage_ = usage;
   last_ts_ = now;
 }
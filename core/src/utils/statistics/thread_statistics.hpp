@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <optional>
 #include <thread>
 
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
@@ -19,10 +20,31 @@ struct ThreadCpuUsage final {
   std::chrono::microseconds user{};
   /// System CPU time used since the thread creation.
   std::chrono::microseconds system{};
+  /// Times the thread gave up the CPU by itself, e.g. to wait for I/O.
+  std::uint64_t voluntary_context_switches{0};
+  /// Times the thread was preempted by the OS scheduler.
+  std::uint64_t involuntary_context_switches{0};
 };
 
 ThreadCpuUsage GetCurrentThreadCpuUsage();
 
+/// Scheduler stats of a thread, consult the kernel sched-stats docs for more
+/// context.
+struct ThreadSchedStats final {
+  /// Time spent on the CPU since the thread creation.
+  std::chrono::nanoseconds run_time{};
+  /// Time spent in a run queue waiting for a CPU since the thread creation.
+  std::chrono::nanoseconds run_delay{};
+};
+
+/// Reads /proc/thread-self/schedstat, which is a single short line.
+/// Returns std::nullopt if the kernel provides no sched-stats.
+std::optional<ThreadSchedStats> GetCurrentThreadSchedStats();
+
+/// CPU time used by the thread of the current process since its creation.
+/// Unlike the functions above, may be called from any thread.
+std::chrono::nanoseconds GetThreadCpuTime(std::thread::native_handle_type);
+
 }  // namespace impl
 
 /// @brief Helper class to maintain current thread CPU usage.
@@ -31,9 +53,17 @@ ThreadCpuUsage GetCurrentThreadCpuUsage();
 /// `collect_interval` and `throttle`: every `throttle` calls if
 /// `collect_interval` has passed since last syscall query OS again.
 /// @note `Collect` is not thread-safe, as it doesn't make sense to mix stats
-/// from different threads. `GetCurrentLoadPercent` is thread-safe.
+/// from different threads. `GetCurrentLoadPercent` and `GetStats` are
+/// thread-safe.
 class ThreadCpuStatsStorage final {
  public:
+  /// Cumulative stats of the thread as of the last OS query
+  struct Stats final {
+    std::uint64_t voluntary_context_switches{0};
+    std::uint64_t involuntary_context_switches{0};
+    std::chrono::microseconds run_delay{};
+  };
+
   /// @param collect_interval query OS not often than provided interval
   /// @param throttle throttle querying OS with this value
   ThreadCpuStatsStorage(std::chrono::milliseconds collect_interval,
@@ -45,6 +75,9 @@ class ThreadCpuStatsStorage final {
   /// @brief Get current CPU usage percent.
   std::uint8_t GetCurrentLoadPercent() const;
 
+  /// @brief Get the context switches and the run delay of the thread.
+  Stats GetStats() const;
+
  private:
   using Clock = utils::datetime::SteadyCoarseClock;
 
@@ -60,6 +93,9 @@ class ThreadCpuStatsStorage final {
   utils::statistics::impl::ThreadCpuUsage last_usage_{};
 
   std::atomic<std::uint8_t> current_usage_pct_{0};
+  std::atomic<std::uint64_t> voluntary_context_switches_{0};
+  std::atomic<std::uint64_t> involuntary_context_switches_{0};
+  std::atomic<std::chrono::microseconds> run_delay_{{}};
 
   std::thread::id caller_id_;
 };
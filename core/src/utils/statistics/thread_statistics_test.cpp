@@ -0,0 +1,38 @@
+#include <utils/statistics/thread_statistics.hpp>
+
+#include <pthread.h>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void BurnCpu(std::chrono::milliseconds duration) {
+  const auto start = std::chrono::steady_clock::now();
+  while (std::chrono::steady_clock::now() - start < duration) {
+  }
+}
+
+}  // namespace
+
+TEST(ThreadStatistics, ThreadCpuTime) {
+  const auto before = utils::statistics::impl::GetThreadCpuTime(pthread_self());
+  BurnCpu(std::chrono::milliseconds{20});
+  const auto after = utils::statistics::impl::GetThreadCpuTime(pthread_self());
+  EXPECT_GT(after, before);
+}
+
+TEST(ThreadStatistics, SchedStats) {
+  const auto before = utils::statistics::impl::GetCurrentThreadSchedStats();
+  // The kernel may be built without sched-stats
+  if (!before) GTEST_SKIP() << "No /proc/thread-self/schedstat";
+
+  BurnCpu(std::chrono::milliseconds{20});
+  const auto after = utils::statistics::impl::GetCurrentThreadSchedStats();
+  ASSERT_TRUE(after);
+  EXPECT_GE(after->run_time, before->run_time);
+  EXPECT_GE(after->run_delay, before->run_delay);
+}
+
+USERVER_NAMESPACE_END
@@ -68,8 +68,7 @@ bool CanSubPathSucceedStartsWith(std::string_view current_path,
                                  current_path.substr(initial_path_size));
 }
 
-void CheckAndWrite(impl::WriterState& state,
-                   std::variant<std::int64_t, double, Rate> value) {
+void CheckAndWrite(impl::WriterState& state, MetricValue::RawType value) {
   UINVARIANT(!state.path.empty(),
              "Detected an attempt to write a metric by empty path");
 
@@ -163,6 +162,13 @@ void Writer::Write(Rate value) {
   }
 }
 
+void Writer::Write(HistogramView value) {
+  if (state_) {
+    ValidateUsage();
+    CheckAndWrite(*state_, value);
+  }
+}
+
 void Writer::ResetState() noexcept {
   UASSERT(state_);
 
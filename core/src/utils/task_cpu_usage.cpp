@@ -0,0 +1,135 @@
+#include <utils/task_cpu_usage.hpp>
+
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::task_cpu_usage {
+
+namespace {
+
+std::atomic<bool> is_enabled{false};
+
+struct Counters final {
+  std::atomic<std::uint64_t> cpu_time_ns{0};
+  std::atomic<std::uint64_t> spans{0};
+};
+
+class Storage final {
+ public:
+  Counters& Get(std::string_view span_name) {
+    {
+      const std::shared_lock lock(mutex_);
+      auto* counters =
+          utils::impl::FindTransparentOrNullptr(counters_, span_name);
+      if (counters) return **counters;
+    }
+
+    const std::unique_lock lock(mutex_);
+    // The count of the names is bounded, [other] is added above the limit
+    if (counters_.size() >= kMaxSpanNames) span_name = kOtherSpans;
+    auto* counters =
+        utils::impl::FindTransparentOrNullptr(counters_, span_name);
+    if (counters) return **counters;
+    return *counters_
+                .emplace(std::string{span_name}, std::make_unique<Counters>())
+                .first->second;
+  }
+
+  std::vector<SpanCpuUsage> GetAll() const {
+    std::vector<SpanCpuUsage> result;
+    const std::shared_lock lock(mutex_);
+    result.reserve(counters_.size());
+    for (const auto& [span_name, counters] : counters_) {
+      result.push_back(
+          {span_name,
+           std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::nanoseconds{
+                   counters->cpu_time_ns.load(std::memory_order_relaxed)}),
+           counters->spans.load(std::memory_order_relaxed)});
+    }
+    return result;
+  }
+
+ private:
+  mutable std::shared_mutex mutex_;
+  utils::impl::TransparentMap<std::string, std::unique_ptr<Counters>>
+      counters_;
+};
+
+Storage& GetStorage() {
+  static Storage storage;
+  return storage;
+}
+
+}  // namespace
+
+void SetEnabled(bool enabled) noexcept { is_enabled.store(enabled); }
+
+bool IsEnabled() noexcept {
+  return is_enabled.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds GetThreadCpuTime() noexcept {
+  struct timespec ts {};
+  ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+void ChargeCurrentTask(std::string_view span_name) noexcept {
+  if (!IsEnabled()) return;
+
+  auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+
+  const auto cpu_time = context->TakeCpuTime();
+  if (cpu_time.count() <= 0) return;
+
+  GetStorage()
+      .Get(span_name.empty() ? kNoSpan : span_name)
+      .cpu_time_ns.fetch_add(static_cast<std::uint64_t>(cpu_time.count()),
+                             std::memory_order_relaxed);
+}
+
+void CountFinishedSpan(std::string_view span_name) noexcept {
+  if (!IsEnabled()) return;
+
+  GetStorage().Get(span_name).spans.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<SpanCpuUsage> GetTopSpans(std::size_t limit) {
+  auto result = GetStorage().GetAll();
+  limit = std::min(limit, result.size());
+  std::partial_sort(result.begin(), result.begin() + limit, result.end(),
+                    [](const SpanCpuUsage& lhs, const SpanCpuUsage& rhs) {
+                      return lhs.cpu_time > rhs.cpu_time;
+                    });
+  result.resize(limit);
+  return result;
+}
+
+void WriteStatistics(utils::statistics::Writer& writer) {
+  for (const auto& usage : GetStorage().GetAll()) {
+    writer["cpu-time-us"].ValueWithLabels(
+        utils::statistics::Rate{
+            static_cast<std::uint64_t>(usage.cpu_time.count())},
+        {"span_name", usage.span_name});
+    writer["spans"].ValueWithLabels(utils::statistics::Rate{usage.spans},
+                                    {"span_name", usage.span_name});
+  }
+}
+
+}  // namespace utils::task_cpu_usage
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::task_cpu_usage {
+
+// The name, that the CPU time of the tasks outside of any span is charged to
+inline constexpr std::string_view kNoSpan = "[no span]";
+
+// The name for the spans above the limit of the distinct span names
+inline constexpr std::string_view kOtherSpans = "[other]";
+
+inline constexpr std::size_t kMaxSpanNames = 1000;
+
+struct SpanCpuUsage final {
+  std::string span_name;
+  std::chrono::microseconds cpu_time{0};
+  // Count of the finished spans
+  std::uint64_t spans{0};
+};
+
+// The accounting measures the thread CPU time at each context switch of a task
+// and at each change of the innermost span of the task, so it costs a couple
+// of syscalls per context switch. Disabled by default.
+void SetEnabled(bool enabled) noexcept;
+
+bool IsEnabled() noexcept;
+
+// CPU time consumed by the current thread
+std::chrono::nanoseconds GetThreadCpuTime() noexcept;
+
+// Charges the CPU time of the current task since the previous charge to the
+// span, that was the innermost span of the task. No-op outside of a coroutine
+// or if the accounting is disabled.
+void ChargeCurrentTask(std::string_view span_name) noexcept;
+
+void CountFinishedSpan(std::string_view span_name) noexcept;
+
+// The spans with the most CPU time, sorted by the CPU time
+std::vector<SpanCpuUsage> GetTopSpans(std::size_t limit);
+
+// Writes the CPU time and the count of all the spans with the `span_name` label
+void WriteStatistics(utils::statistics::Writer& writer);
+
+}  // namespace utils::task_cpu_usage
+
+USERVER_NAMESPACE_END
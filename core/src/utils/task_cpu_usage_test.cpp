@@ -0,0 +1,67 @@
+#include <utils/task_cpu_usage.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::task_cpu_usage::SpanCpuUsage FindSpan(std::string_view span_name) {
+  const auto spans =
+      utils::task_cpu_usage::GetTopSpans(utils::task_cpu_usage::kMaxSpanNames);
+  const auto it = std::find_if(spans.begin(), spans.end(), [&](const auto& x) {
+    return x.span_name == span_name;
+  });
+  return it == spans.end() ? utils::task_cpu_usage::SpanCpuUsage{} : *it;
+}
+
+void BurnCpu(std::chrono::nanoseconds duration) {
+  const auto start = utils::task_cpu_usage::GetThreadCpuTime();
+  while (utils::task_cpu_usage::GetThreadCpuTime() - start < duration) {
+  }
+}
+
+}  // namespace
+
+UTEST(TaskCpuUsage, ChargesInnermostSpan) {
+  utils::task_cpu_usage::SetEnabled(true);
+  const utils::FastScopeGuard disable_guard(
+      []() noexcept { utils::task_cpu_usage::SetEnabled(false); });
+
+  {
+    tracing::Span outer{"task_cpu_usage_outer"};
+    BurnCpu(20ms);
+    {
+      tracing::Span inner{"task_cpu_usage_inner"};
+      BurnCpu(40ms);
+      engine::SleepFor(10ms);
+    }
+    engine::SleepFor(50ms);
+  }
+
+  const auto outer = FindSpan("task_cpu_usage_outer");
+  const auto inner = FindSpan("task_cpu_usage_inner");
+  EXPECT_EQ(outer.spans, 1);
+  EXPECT_EQ(inner.spans, 1);
+  EXPECT_GE(outer.cpu_time, 20ms);
+  EXPECT_LT(outer.cpu_time, 40ms);
+  EXPECT_GE(inner.cpu_time, 40ms);
+  EXPECT_LT(inner.cpu_time, 60ms);
+}
+
+UTEST(TaskCpuUsage, Disabled) {
+  {
+    tracing::Span span{"task_cpu_usage_disabled"};
+    BurnCpu(1ms);
+  }
+  EXPECT_EQ(FindSpan("task_cpu_usage_disabled").spans, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -1,13 +1,15 @@
 #include <userver/utils/text.hpp>
 
 #include <algorithm>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/locale.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
-#include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/read_mostly_shared_mutex.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -137,7 +139,7 @@ bool IsAscii(std::string_view text) noexcept {
 }
 
 const std::locale& GetLocale(const std::string& name) {
-  static engine::SharedMutex m;
+  static engine::ReadMostlySharedMutex m;
   using locales_map_t = std::unordered_map<std::string, std::locale>;
   static locales_map_t locales;
   {
@@ -418,4 +418,36 @@ maximum: 19.5
                     "Value 'What' of field '/' must be number");
 }
 
+TEST(StaticConfigValidator, SchemaCopy) {
+  const std::string kSchema = R"(
+type: object
+description: object with a nested object
+additionalProperties: false
+properties:
+    nested:
+        type: object
+        description: nested object
+        additionalProperties: false
+        properties:
+            value:
+                type: integer
+                description: value
+)";
+
+  yaml_config::Schema copy;
+  {
+    const auto schema = yaml_config::impl::SchemaFromString(kSchema);
+    copy = schema;
+  }
+
+  const yaml_config::YamlConfig valid(
+      formats::yaml::FromString("nested: {value: 1}"), {});
+  UEXPECT_NO_THROW(yaml_config::impl::Validate(valid, copy));
+
+  const yaml_config::YamlConfig invalid(
+      formats::yaml::FromString("nested: {other: 1}"), {});
+  UEXPECT_THROW(yaml_config::impl::Validate(invalid, copy),
+                std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
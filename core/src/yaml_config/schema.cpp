@@ -132,6 +132,16 @@ SchemaPtr Parse(const formats::yaml::Value& schema,
 SchemaPtr::SchemaPtr(Schema&& schema)
     : schema_(std::make_unique<Schema>(std::move(schema))) {}
 
+SchemaPtr::SchemaPtr(const SchemaPtr& other)
+    : schema_(std::make_unique<Schema>(*other.schema_)) {}
+
+SchemaPtr& SchemaPtr::operator=(const SchemaPtr& other) {
+  if (this != &other) schema_ = std::make_unique<Schema>(*other.schema_);
+  return *this;
+}
+
+SchemaPtr::~SchemaPtr() = default;
+
 std::variant<bool, SchemaPtr> Parse(
     const formats::yaml::Value& value,
     formats::parse::To<std::variant<bool, SchemaPtr>>) {
@@ -13,14 +13,14 @@ namespace yaml_config {
 
 namespace {
 
-bool IsSubstitution(const formats::yaml::Value& value) {
-  if (!value.IsString()) return false;
-  const auto& str = value.As<std::string>();
-  return !str.empty() && str.front() == '$';
-}
-
-std::string GetSubstitutionVarName(const formats::yaml::Value& value) {
-  return value.As<std::string>().substr(1);
+// Returns the variable name of a `$variable` value, copies the string once
+std::optional<std::string> GetSubstitutionVarName(
+    const formats::yaml::Value& value) {
+  if (!value.IsString()) return std::nullopt;
+  auto str = value.As<std::string>();
+  if (str.empty() || str.front() != '$') return std::nullopt;
+  str.erase(0, 1);
+  return str;
 }
 
 std::string GetFallbackName(std::string_view str) {
@@ -48,22 +48,24 @@ void AssertEnvMode(YamlConfig::Mode mode) {
 std::optional<formats::yaml::Value> GetFromEnvByKey(
     std::string_view key, const formats::yaml::Value& yaml,
     YamlConfig::Mode mode) {
-  const auto env_name = yaml[GetEnvName(key)];
-  if (!env_name.IsMissing()) {
-    AssertEnvMode(mode);
-
-    // NOLINTNEXTLINE(concurrency-mt-unsafe)
-    const auto* env_value = std::getenv(env_name.As<std::string>().c_str());
-    if (env_value) {
-      LOG_INFO() << "using env value for '" << key << '\'';
-      return formats::yaml::FromString(env_value);
-    }
+  // Most of the keys have no #env, avoid building the path of a missing value
+  const auto env_key = GetEnvName(key);
+  if (!yaml.HasMember(env_key)) return {};
+
+  AssertEnvMode(mode);
+
+  const auto env_name = yaml[env_key];
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const auto* env_value = std::getenv(env_name.As<std::string>().c_str());
+  if (env_value) {
+    LOG_INFO() << "using env value for '" << key << '\'';
+    return formats::yaml::FromString(env_value);
+  }
 
-    const auto fallback_name = GetFallbackName(key);
-    if (yaml.HasMember(fallback_name)) {
-      LOG_INFO() << "using fallback value for '" << key << '\'';
-      return yaml[fallback_name];
-    }
+  const auto fallback_name = GetFallbackName(key);
+  if (yaml.HasMember(fallback_name)) {
+    LOG_INFO() << "using fallback value for '" << key << '\'';
+    return yaml[fallback_name];
   }
 
   return {};
@@ -93,10 +95,8 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
 
   auto value = yaml_[key];
 
-  if (IsSubstitution(value)) {
-    const auto var_name = GetSubstitutionVarName(value);
-
-    auto var_data = config_vars_[var_name];
+  if (const auto var_name = GetSubstitutionVarName(value)) {
+    auto var_data = config_vars_[*var_name];
     if (!var_data.IsMissing()) {
       // Strip substitutions off to disallow nested substitutions
       return YamlConfig{std::move(var_data), {}, Mode::kSecure};
@@ -133,10 +133,8 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
 YamlConfig YamlConfig::operator[](size_t index) const {
   auto value = yaml_[index];
 
-  if (IsSubstitution(value)) {
-    const auto var_name = GetSubstitutionVarName(value);
-
-    auto var_data = config_vars_[var_name];
+  if (const auto var_name = GetSubstitutionVarName(value)) {
+    auto var_data = config_vars_[*var_name];
     if (!var_data.IsMissing()) {
       // Strip substitutions off to disallow nested substitutions
       return YamlConfig{std::move(var_data), {}, Mode::kSecure};
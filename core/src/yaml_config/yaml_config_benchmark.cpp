@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/yaml_config/impl/validate_static_config.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kComponents = 500;
+
+// 10 lines per component, 5000 lines in total
+std::string MakeConfig() {
+  std::string config;
+  for (std::size_t i = 0; i < kComponents; ++i) {
+    config += fmt::format(
+        "component-{}:\n"
+        "    load-enabled: true\n"
+        "    name: component-name-{}\n"
+        "    timeout: $timeout\n"
+        "    timeout#fallback: 1s\n"
+        "    retries: {}\n"
+        "    path: /some/long/path/to/the/component/{}\n"
+        "    options:\n"
+        "      - first-option\n"
+        "      - $option\n",
+        i, i, i % 10, i);
+  }
+  return config;
+}
+
+const std::string kVars = R"(
+timeout: 500ms
+option: second-option
+)";
+
+const std::string kComponentSchema = R"(
+type: object
+description: component
+additionalProperties: false
+properties:
+    load-enabled:
+        type: boolean
+        description: load-enabled
+    name:
+        type: string
+        description: name
+    timeout:
+        type: string
+        description: timeout
+    retries:
+        type: integer
+        description: retries
+        minimum: 0
+    path:
+        type: string
+        description: path
+    options:
+        type: array
+        description: options
+        items:
+            type: string
+            description: option
+)";
+
+yaml_config::YamlConfig MakeYamlConfig() {
+  return yaml_config::YamlConfig(formats::yaml::FromString(MakeConfig()),
+                                 formats::yaml::FromString(kVars));
+}
+
+}  // namespace
+
+void yaml_config_parse(benchmark::State& state) {
+  const auto config = MakeConfig();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(formats::yaml::FromString(config));
+  }
+}
+BENCHMARK(yaml_config_parse);
+
+void yaml_config_read_options(benchmark::State& state) {
+  const auto config = MakeYamlConfig();
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < kComponents; ++i) {
+      const auto component = config[fmt::format("component-{}", i)];
+      benchmark::DoNotOptimize(component["load-enabled"].As<bool>());
+      benchmark::DoNotOptimize(component["name"].As<std::string>());
+      benchmark::DoNotOptimize(component["timeout"].As<std::string>());
+      benchmark::DoNotOptimize(component["retries"].As<int>());
+      benchmark::DoNotOptimize(component["missing"].As<int>(42));
+      for (const auto& option : component["options"]) {
+        benchmark::DoNotOptimize(option.As<std::string>());
+      }
+    }
+  }
+}
+BENCHMARK(yaml_config_read_options);
+
+void yaml_config_validate(benchmark::State& state) {
+  const auto config = MakeYamlConfig();
+  const auto schema = yaml_config::impl::SchemaFromString(kComponentSchema);
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& component : config) {
+      yaml_config::impl::Validate(component, schema);
+    }
+  }
+}
+BENCHMARK(yaml_config_validate);
+
+void yaml_config_parse_schema(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < kComponents; ++i) {
+      benchmark::DoNotOptimize(
+          yaml_config::impl::SchemaFromString(kComponentSchema));
+    }
+  }
+}
+BENCHMARK(yaml_config_parse_schema);
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,12 @@
 #include <userver/utils/statistics/testing.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <deque>
 #include <iostream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <boost/algorithm/cxx11/all_of.hpp>
@@ -33,11 +36,18 @@ struct SnapshotDataEntry final {
   MetricValue value;
 };
 
+// HistogramView does not own the buckets, so they are copied into the snapshot
+struct HistogramData final {
+  std::vector<double> upper_bounds;
+  std::vector<std::uint64_t> counts;
+};
+
 }  // namespace
 namespace impl {
 
 struct SnapshotData final {
   std::unordered_multimap<std::string, SnapshotDataEntry> metrics;
+  std::deque<HistogramData> histograms;
 };
 
 }  // namespace impl
@@ -54,11 +64,25 @@ class SnapshotVisitor final : public BaseFormatBuilder {
     for (const auto& l : labels) {
       labels_owned.emplace(std::string{l.Name()}, std::string{l.Value()});
     }
-    SnapshotDataEntry entry{std::move(labels_owned), value};
+    SnapshotDataEntry entry{std::move(labels_owned),
+                            value.IsHistogram()
+                                ? CopyHistogram(value.AsHistogram())
+                                : value};
     data_.metrics.emplace(std::string{path}, std::move(entry));
   }
 
  private:
+  MetricValue CopyHistogram(HistogramView histogram) {
+    auto& copy = data_.histograms.emplace_back();
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      copy.upper_bounds.push_back(histogram.GetUpperBoundAt(i));
+      copy.counts.push_back(histogram.GetValueAt(i));
+    }
+    return MetricValue{HistogramView{
+        copy.upper_bounds.data(), copy.counts.data(), copy.counts.size(),
+        histogram.GetValueAtInf(), histogram.GetSum()}};
+  }
+
   impl::SnapshotData& data_;
 };
 
@@ -0,0 +1,301 @@
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server_builder.h>
+
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+#include <ugrpc/client/middlewares/baggage/middleware.hpp>
+#include <ugrpc/client/middlewares/deadline_propagation/middleware.hpp>
+#include <ugrpc/client/middlewares/log/middleware.hpp>
+#include <ugrpc/server/middlewares/baggage/middleware.hpp>
+#include <ugrpc/server/middlewares/deadline_propagation/middleware.hpp>
+#include <ugrpc/server/middlewares/log/middleware.hpp>
+#include <userver/ugrpc/client/client_factory.hpp>
+#include <userver/ugrpc/server/server.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkerThreads = 4;
+
+class BenchmarkService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(std::move(*request.mutable_name()));
+    call.Finish(response);
+  }
+
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_name(request.name());
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+
+  void WriteMany(WriteManyCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    int count = 0;
+    while (call.Read(request)) ++count;
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_number(count);
+    call.Finish(response);
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+// An in-process server and a client connected to it over a unix socket
+class GrpcEnvironment final {
+ public:
+  explicit GrpcEnvironment(bool with_middlewares)
+      : socket_path_(fmt::format("/tmp/userver-grpc-benchmark-{}.sock",
+                                 ::getpid())),
+        endpoint_("unix:" + socket_path_),
+        config_storage_(dynamic_config::MakeDefaultStorage({})),
+        server_({}, statistics_storage_, config_storage_.GetSource()) {
+    if (with_middlewares) {
+      server_middlewares_ = {
+          std::make_shared<ugrpc::server::middlewares::log::Middleware>(
+              ugrpc::server::middlewares::log::Middleware::Settings{}),
+          std::make_shared<
+              ugrpc::server::middlewares::deadline_propagation::Middleware>(),
+          std::make_shared<ugrpc::server::middlewares::baggage::Middleware>(),
+      };
+      client_middlewares_ = {
+          std::make_shared<ugrpc::client::middlewares::log::MiddlewareFactory>(
+              ugrpc::client::middlewares::log::Middleware::Settings{}),
+          std::make_shared<ugrpc::client::middlewares::deadline_propagation::
+                               MiddlewareFactory>(),
+          std::make_shared<
+              ugrpc::client::middlewares::baggage::MiddlewareFactory>(),
+      };
+    }
+
+    server_.WithServerBuilder([this](grpc::ServerBuilder& builder) {
+      builder.AddListeningPort(endpoint_, grpc::InsecureServerCredentials());
+    });
+    server_.AddService(service_,
+                       ugrpc::server::ServiceConfig{
+                           engine::current_task::GetTaskProcessor(),
+                           server_middlewares_,
+                       });
+    server_.Start();
+
+    client_factory_.emplace(ugrpc::client::ClientFactoryConfig{},
+                            engine::current_task::GetTaskProcessor(),
+                            client_middlewares_, server_.GetCompletionQueue(),
+                            statistics_storage_, testsuite_,
+                            config_storage_.GetSource());
+  }
+
+  ~GrpcEnvironment() {
+    client_factory_.reset();
+    server_.Stop();
+    std::remove(socket_path_.c_str());
+  }
+
+  sample::ugrpc::UnitTestServiceClient MakeClient() {
+    return client_factory_->MakeClient<sample::ugrpc::UnitTestServiceClient>(
+        "benchmark", endpoint_);
+  }
+
+  const std::string& GetEndpoint() const { return endpoint_; }
+
+ private:
+  const std::string socket_path_;
+  const std::string endpoint_;
+  utils::statistics::Storage statistics_storage_;
+  dynamic_config::StorageMock config_storage_;
+  ugrpc::server::Server server_;
+  ugrpc::server::Middlewares server_middlewares_;
+  ugrpc::client::MiddlewareFactories client_middlewares_;
+  testsuite::GrpcControl testsuite_{{}, false};
+  BenchmarkService service_;
+  std::optional<ugrpc::client::ClientFactory> client_factory_;
+};
+
+sample::ugrpc::GreetingRequest MakeRequest() {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  return request;
+}
+
+// Measures the latency of the calls of the main task while
+// `state.range(0) - 1` tasks load the server with the same calls
+template <typename Call>
+void RunUnderLoad(benchmark::State& state, Call call) {
+  const auto concurrency = static_cast<std::size_t>(state.range(0));
+  std::atomic<bool> keep_running{true};
+  std::atomic<std::uint64_t> background_calls{0};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(concurrency - 1);
+  for (std::size_t i = 1; i < concurrency; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        call();
+        ++background_calls;
+      }
+    }));
+  }
+
+  for (auto _ : state) call();
+
+  keep_running = false;
+  for (auto& task : tasks) task.Get();
+
+  state.counters["rps"] = benchmark::Counter(
+      static_cast<double>(background_calls.load() + state.iterations()),
+      benchmark::Counter::kIsRate);
+}
+
+void UnaryCall(benchmark::State& state, bool with_middlewares) {
+  engine::RunStandalone(kWorkerThreads, [&] {
+    GrpcEnvironment env{with_middlewares};
+    auto client = env.MakeClient();
+    const auto request = MakeRequest();
+
+    RunUnderLoad(state, [&] {
+      benchmark::DoNotOptimize(client.SayHello(request).Finish());
+    });
+  });
+}
+
+void grpc_unary(benchmark::State& state) { UnaryCall(state, false); }
+BENCHMARK(grpc_unary)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+
+void grpc_unary_middlewares(benchmark::State& state) {
+  UnaryCall(state, true);
+}
+BENCHMARK(grpc_unary_middlewares)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime();
+
+// The baseline: the synchronous grpc++ stub calling the same server. The call
+// blocks an engine worker thread, so the concurrency is limited to one.
+void grpc_unary_raw_grpcpp(benchmark::State& state) {
+  engine::RunStandalone(kWorkerThreads, [&] {
+    GrpcEnvironment env{false};
+    const auto stub = sample::ugrpc::UnitTestService::NewStub(
+        grpc::CreateChannel(env.GetEndpoint(),
+                            grpc::InsecureChannelCredentials()));
+    const auto request = MakeRequest();
+
+    for (auto _ : state) {
+      grpc::ClientContext context;
+      sample::ugrpc::GreetingResponse response;
+      benchmark::DoNotOptimize(stub->SayHello(&context, request, &response));
+    }
+  });
+}
+BENCHMARK(grpc_unary_raw_grpcpp)->UseRealTime();
+
+void grpc_server_stream(benchmark::State& state) {
+  engine::RunStandalone(kWorkerThreads, [&] {
+    GrpcEnvironment env{false};
+    auto client = env.MakeClient();
+    const auto messages = state.range(0);
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_number(messages);
+    sample::ugrpc::StreamGreetingResponse response;
+    for (auto _ : state) {
+      auto stream = client.ReadMany(request);
+      while (stream.Read(response)) benchmark::DoNotOptimize(response);
+    }
+    state.SetItemsProcessed(state.iterations() * messages);
+  });
+}
+BENCHMARK(grpc_server_stream)->RangeMultiplier(8)->Range(1, 512);
+
+void grpc_client_stream(benchmark::State& state) {
+  engine::RunStandalone(kWorkerThreads, [&] {
+    GrpcEnvironment env{false};
+    auto client = env.MakeClient();
+    const auto messages = state.range(0);
+    const auto batch_size = static_cast<std::size_t>(state.range(1));
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    for (auto _ : state) {
+      auto stream = client.WriteMany();
+      stream.SetWriteBatchSize(batch_size);
+      for (int i = 0; i < messages; ++i) {
+        request.set_number(i);
+        if (!stream.Write(request)) break;
+      }
+      benchmark::DoNotOptimize(stream.Finish());
+    }
+    state.SetItemsProcessed(state.iterations() * messages);
+  });
+}
+BENCHMARK(grpc_client_stream)
+    ->ArgsProduct({{1, 64, 512}, {1, 16}})
+    ->ArgNames({"messages", "batch"});
+
+void grpc_bidirectional_ping_pong(benchmark::State& state) {
+  engine::RunStandalone(kWorkerThreads, [&] {
+    GrpcEnvironment env{false};
+    auto client = env.MakeClient();
+    auto stream = client.Chat();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    bool is_open = true;
+    for (auto _ : state) {
+      request.set_number(request.number() + 1);
+      stream.WriteAndCheck(request);
+      if (!stream.Read(response)) {
+        is_open = false;
+        state.SkipWithError("The stream is closed");
+        break;
+      }
+    }
+
+    if (is_open && stream.WritesDone()) {
+      while (stream.Read(response)) {
+      }
+    }
+  });
+}
+BENCHMARK(grpc_bidirectional_ping_pong);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
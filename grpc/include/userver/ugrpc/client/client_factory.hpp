@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/client/client_factory.hpp
 /// @brief @copybrief ugrpc::client::ClientFactory
 
+#include <chrono>
 #include <cstddef>
 
 #include <grpcpp/completion_queue.h>
@@ -18,6 +19,7 @@
 
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/load_balancing.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
@@ -40,8 +42,20 @@ struct ClientFactoryConfig {
   logging::Level native_log_level{logging::Level::kError};
 
   /// Number of underlying channels that will be created for every client
-  /// in this factory.
+  /// in this factory. Each of the channels has its own connections.
   std::size_t channel_count{1};
+
+  /// Connect the channels eagerly, when the first client of an endpoint is
+  /// created, instead of on the first call
+  bool prewarm_channels{false};
+
+  /// How long the creation of a client waits for the prewarmed channels to
+  /// become ready. Zero disables the wait.
+  std::chrono::milliseconds prewarm_timeout{std::chrono::seconds{5}};
+
+  /// Balancing of the calls between the channels of every client in this
+  /// factory
+  LoadBalancingConfig load_balancing{};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
@@ -63,6 +77,13 @@ class ClientFactory final {
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
 
+  /// Makes a client with load balancing settings overriding the ones of the
+  /// factory
+  template <typename Client>
+  Client MakeClient(const std::string& client_name,
+                    const std::string& endpoint,
+                    const LoadBalancingConfig& load_balancing);
+
  private:
   impl::ChannelCache::Token GetChannel(const std::string& endpoint);
 
@@ -73,11 +94,21 @@ class ClientFactory final {
   ugrpc::impl::StatisticsStorage client_statistics_storage_;
   const dynamic_config::Source config_source_;
   testsuite::GrpcControl& testsuite_grpc_;
+  const LoadBalancingConfig load_balancing_;
+  const bool prewarm_channels_;
+  const std::chrono::milliseconds prewarm_timeout_;
 };
 
 template <typename Client>
 Client ClientFactory::MakeClient(const std::string& client_name,
                                  const std::string& endpoint) {
+  return MakeClient<Client>(client_name, endpoint, load_balancing_);
+}
+
+template <typename Client>
+Client ClientFactory::MakeClient(const std::string& client_name,
+                                 const std::string& endpoint,
+                                 const LoadBalancingConfig& load_balancing) {
   auto& statistics =
       client_statistics_storage_.GetServiceStatistics(Client::GetMetadata());
 
@@ -88,7 +119,8 @@ Client ClientFactory::MakeClient(const std::string& client_name,
 
   return Client(impl::ClientParams{client_name, std::move(mws), queue_,
                                    statistics, GetChannel(endpoint),
-                                   config_source_, testsuite_grpc_});
+                                   config_source_, testsuite_grpc_,
+                                   load_balancing});
 }
 
 }  // namespace ugrpc::client
@@ -46,7 +46,11 @@ namespace ugrpc::client {
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
-/// channel-count | Number of underlying grpc::Channel objects | 1
+/// channel-count | Number of underlying grpc::Channel objects, each one with its own connections | 1
+/// prewarm-channels | connect the channels when the first client of an endpoint is created instead of on the first call | false
+/// prewarm-timeout | how long the creation of a client waits for the prewarmed channels to become ready, 0 disables the wait | 5s
+/// load-balancing.policy | `random` or `least-request` picking of a channel for a call | random
+/// load-balancing.outlier-ejection | temporary ejection of the failing or slow channels, see ugrpc::client::OutlierEjectionConfig | -
 /// middlewares | middlewares names to use | []
 ///
 ///
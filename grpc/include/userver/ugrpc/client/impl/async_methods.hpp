@@ -120,6 +120,9 @@ class RpcData final {
 
   grpc::Status& GetStatus() noexcept;
 
+  /// Accounts the outcome of the call for the load balancing between channels
+  void AccountChannelResult(bool is_failure) noexcept;
+
   class AsyncMethodInvocationGuard {
    public:
     AsyncMethodInvocationGuard(RpcData& data) noexcept;
@@ -142,6 +145,7 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  ChannelBalancer::Lease channel_lease_;
 
   std::optional<AsyncMethodInvocation> invocation_;
   grpc::Status status_;
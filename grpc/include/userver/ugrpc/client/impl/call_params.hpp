@@ -23,6 +23,7 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  ChannelBalancer::Lease channel_lease;
 };
 
 CallParams DoCreateCallParams(const ClientData&, std::size_t method_id,
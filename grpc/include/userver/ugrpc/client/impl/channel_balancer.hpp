@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include <userver/utils/fixed_array.hpp>
+
+#include <userver/ugrpc/client/load_balancing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+/// Picks the channels of a client for the calls according to
+/// LoadBalancingConfig, tracking the calls in flight and the outcomes of the
+/// calls of each channel
+class ChannelBalancer final
+    : public std::enable_shared_from_this<ChannelBalancer> {
+ public:
+  /// Accounts a call on the picked channel until the call is finished
+  class Lease final {
+   public:
+    Lease() noexcept = default;
+
+    Lease(Lease&&) noexcept;
+    Lease& operator=(Lease&&) noexcept;
+    ~Lease();
+
+    /// Accounts the outcome of the call, the call is considered neither
+    /// failed nor successful if it is destroyed unfinished
+    void Finish(bool is_failure) noexcept;
+
+   private:
+    friend class ChannelBalancer;
+
+    void Release(std::optional<bool> is_failure) noexcept;
+
+    std::shared_ptr<ChannelBalancer> balancer_;
+    std::size_t index_{0};
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  ChannelBalancer(std::size_t channel_count, const LoadBalancingConfig& config);
+
+  /// Returns the index of the channel for a new call
+  std::size_t Pick(Lease& lease);
+
+  /// @returns true if the client with the config needs a balancer
+  static bool IsNeeded(std::size_t channel_count,
+                       const LoadBalancingConfig& config) noexcept;
+
+  /// For tests
+  bool IsEjected(std::size_t index) const noexcept;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct ChannelState final {
+    std::atomic<std::uint64_t> in_flight{0};
+    std::atomic<std::uint64_t> requests{0};
+    std::atomic<std::uint64_t> failures{0};
+    std::atomic<std::uint64_t> latency_sum_us{0};
+    std::atomic<Clock::rep> ejected_until{0};
+    // guarded by 'evaluation_mutex_'
+    std::size_t consecutive_ejections{0};
+  };
+
+  std::size_t PickNotEjected(Clock::rep now) const;
+  bool IsEjected(const ChannelState& channel, Clock::rep now) const noexcept;
+  void Account(std::size_t index, Clock::duration latency,
+               std::optional<bool> is_failure) noexcept;
+  void EvaluateIfNeeded(Clock::rep now);
+  void Evaluate(Clock::rep now);
+
+  const LoadBalancingConfig config_;
+  utils::FixedArray<ChannelState> channels_;
+  std::atomic<Clock::rep> next_evaluation_;
+  std::mutex evaluation_mutex_;
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -21,7 +21,7 @@ class ChannelCache final {
  public:
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               std::size_t channel_count, bool prewarm = false);
 
   ~ChannelCache();
 
@@ -36,7 +36,7 @@ class ChannelCache final {
     CountedChannel(const std::string& endpoint,
                    const std::shared_ptr<grpc::ChannelCredentials>& credentials,
                    const grpc::ChannelArguments& channel_args,
-                   std::size_t count);
+                   std::size_t count, bool prewarm);
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
     std::uint64_t counter{0};
@@ -47,6 +47,7 @@ class ChannelCache final {
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
   const std::size_t channel_count_;
+  const bool prewarm_;
   concurrent::Variable<Map> channels_;
 };
 
@@ -9,7 +9,9 @@
 
 #include <userver/dynamic_config/source.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
+#include <userver/ugrpc/client/load_balancing.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
@@ -28,6 +30,7 @@ struct ClientParams final {
   impl::ChannelCache::Token channel_token;
   const dynamic_config::Source config_source;
   testsuite::GrpcControl& testsuite_grpc;
+  LoadBalancingConfig load_balancing;
 };
 
 /// A helper class for generated gRPC clients
@@ -48,6 +51,10 @@ class ClientData final {
           Service::NewStub(GetChannelToken().GetChannel(index)).release(),
           &StubDeleter<Service>);
     });
+    if (ChannelBalancer::IsNeeded(channel_count, params_.load_balancing)) {
+      balancer_ = std::make_shared<ChannelBalancer>(channel_count,
+                                                    params_.load_balancing);
+    }
   }
 
   ClientData(ClientData&&) noexcept = default;
@@ -56,10 +63,13 @@ class ClientData final {
   ClientData(const ClientData&) = delete;
   ClientData& operator=(const ClientData&) = delete;
 
+  /// Picks the stub of a channel for a new call, the lease accounts the call
+  /// until it is finished if the calls are balanced
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  Stub<Service>& NextStub(ChannelBalancer::Lease& lease) const {
+    const auto index = balancer_ ? balancer_->Pick(lease)
+                                 : utils::RandRange(stubs_.size());
+    return *static_cast<Stub<Service>*>(stubs_[index].get());
   }
 
   grpc::CompletionQueue& GetQueue() const { return params_.queue; }
@@ -98,6 +108,7 @@ class ClientData final {
   ClientParams params_;
   ugrpc::impl::StaticServiceMetadata metadata_;
   utils::FixedArray<StubPtr> stubs_;
+  std::shared_ptr<ChannelBalancer> balancer_;
 };
 
 template <typename Client>
@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/ugrpc/client/load_balancing.hpp
+/// @brief @copybrief ugrpc::client::LoadBalancingConfig
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// How a call picks one of the client's channels
+enum class LoadBalancingPolicy {
+  /// A random channel
+  kRandom,
+  /// The channel with fewer calls in flight of two random ones
+  kLeastRequest,
+};
+
+/// Temporary exclusion of the channels that fail or respond much slower than
+/// the others
+struct OutlierEjectionConfig final {
+  bool enabled{false};
+
+  /// A channel is ejected if the share of its failed calls in an interval is
+  /// greater. Only UNAVAILABLE, DEADLINE_EXCEEDED, RESOURCE_EXHAUSTED,
+  /// INTERNAL, UNKNOWN and network errors are failures.
+  double max_error_rate{0.5};
+
+  /// A channel is ejected if its average latency in an interval is this many
+  /// times greater than the average of all the channels, 0 disables the check
+  double max_latency_factor{0};
+
+  /// The channels with fewer calls in an interval are not checked
+  std::size_t min_requests{20};
+
+  /// The channels are checked once per interval
+  std::chrono::milliseconds interval{std::chrono::seconds{10}};
+
+  /// A channel is ejected for this time multiplied by the number of its
+  /// consecutive ejections
+  std::chrono::milliseconds ejection_time{std::chrono::seconds{30}};
+
+  /// Upper bound of the percentage of simultaneously ejected channels, at
+  /// least one channel is never ejected
+  double max_ejection_percent{50};
+};
+
+/// Balancing of the calls between the channels of a client, see
+/// ClientFactoryConfig::channel_count. The gRPC load balancing policy
+/// (see `default-service-config`) still balances within each channel.
+struct LoadBalancingConfig final {
+  LoadBalancingPolicy policy{LoadBalancingPolicy::kRandom};
+  OutlierEjectionConfig outlier_ejection{};
+};
+
+LoadBalancingPolicy Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<LoadBalancingPolicy>);
+
+OutlierEjectionConfig Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<OutlierEjectionConfig>);
+
+LoadBalancingConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<LoadBalancingConfig>);
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 /// @file userver/ugrpc/client/rpc.hpp
 /// @brief Classes representing an outgoing RPC
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string_view>
 #include <utility>
@@ -21,6 +23,7 @@
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/impl/write_batching.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -254,6 +257,16 @@ class [[nodiscard]] OutputStream final : public CallAnyBase {
   /// @throws ugrpc::client::RpcCancelledError on task cancellation
   void WriteAndCheck(const Request& request);
 
+  /// @brief Coalesce the writes of up to `batch_size` messages into a single
+  /// flush
+  ///
+  /// The messages are written with `grpc::WriteOptions::set_buffer_hint`, so
+  /// `Write` does not wait for each message to go to the wire. Every
+  /// `batch_size`-th message, `WriteAndCheck` and `WritesDone` flush the
+  /// buffered messages. The default of 1 disables the buffering, which suits
+  /// the ping-pong interactions.
+  void SetWriteBatchSize(std::size_t batch_size);
+
   /// @brief Complete the RPC successfully
   ///
   /// Should be called once all the data is written. The server will then
@@ -285,6 +298,7 @@ class [[nodiscard]] OutputStream final : public CallAnyBase {
   std::unique_ptr<impl::RpcData> data_;
   std::unique_ptr<Response> final_response_;
   impl::RawWriter<Request> stream_;
+  ugrpc::impl::WriteBatching write_batching_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -360,6 +374,16 @@ class [[nodiscard]] BidirectionalStream final : public CallAnyBase {
   /// @throws ugrpc::client::RpcCancelledError on task cancellation
   void WriteAndCheck(const Request& request);
 
+  /// @brief Coalesce the writes of up to `batch_size` messages into a single
+  /// flush
+  ///
+  /// The messages are written with `grpc::WriteOptions::set_buffer_hint`, so
+  /// `Write` does not wait for each message to go to the wire. Every
+  /// `batch_size`-th message, `WriteAndCheck` and `WritesDone` flush the
+  /// buffered messages. The default of 1 disables the buffering, which suits
+  /// the ping-pong interactions.
+  void SetWriteBatchSize(std::size_t batch_size);
+
   /// @brief Announce end-of-output to the server
   ///
   /// Should be called to notify the server and receive the final response(s).
@@ -386,6 +410,7 @@ class [[nodiscard]] BidirectionalStream final : public CallAnyBase {
  private:
   std::unique_ptr<impl::RpcData> data_;
   impl::RawReaderWriter<Request, Response> stream_;
+  ugrpc::impl::WriteBatching write_batching_;
 };
 
 void CallMiddlewares(const Middlewares& mws, CallAnyBase& call,
@@ -536,11 +561,15 @@ OutputStream<Request, Response>::OutputStream(
 
 template <typename Request, typename Response>
 bool OutputStream<Request, Response>::Write(const Request& request) {
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
-
-  return impl::Write(*stream_, request, write_options, GetData());
+  // Don't buffer writes by default, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  const auto write_options = write_batching_.NextWriteOptions();
+
+  const auto start = std::chrono::steady_clock::now();
+  const bool result = impl::Write(*stream_, request, write_options, GetData());
+  GetData().GetStatsScope().OnWrite(write_options.get_buffer_hint(),
+                                    std::chrono::steady_clock::now() - start);
+  return result;
 }
 
 template <typename Request, typename Response>
@@ -548,12 +577,19 @@ void OutputStream<Request, Response>::WriteAndCheck(const Request& request) {
   // Don't buffer writes, otherwise in an event subscription scenario, events
   // may never actually be delivered
   grpc::WriteOptions write_options{};
+  write_batching_.OnFlush();
 
   if (!impl::Write(*stream_, request, write_options, GetData())) {
     impl::Finish(*stream_, GetData(), true);
   }
 }
 
+template <typename Request, typename Response>
+void OutputStream<Request, Response>::SetWriteBatchSize(
+    std::size_t batch_size) {
+  write_batching_.SetBatchSize(batch_size);
+}
+
 template <typename Request, typename Response>
 Response OutputStream<Request, Response>::Finish() {
   // gRPC does not implicitly call `WritesDone` in `Finish`,
@@ -599,10 +635,14 @@ bool BidirectionalStream<Request, Response>::Read(Response& response) {
 
 template <typename Request, typename Response>
 bool BidirectionalStream<Request, Response>::Write(const Request& request) {
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
-
-  return impl::Write(*stream_, request, write_options, GetData());
+  // Don't buffer writes by default, optimize for ping-pong-style interaction
+  const auto write_options = write_batching_.NextWriteOptions();
+
+  const auto start = std::chrono::steady_clock::now();
+  const bool result = impl::Write(*stream_, request, write_options, GetData());
+  GetData().GetStatsScope().OnWrite(write_options.get_buffer_hint(),
+                                    std::chrono::steady_clock::now() - start);
+  return result;
 }
 
 template <typename Request, typename Response>
@@ -610,10 +650,17 @@ void BidirectionalStream<Request, Response>::WriteAndCheck(
     const Request& request) {
   // Don't buffer writes, optimize for ping-pong-style interaction
   grpc::WriteOptions write_options{};
+  write_batching_.OnFlush();
 
   impl::WriteAndCheck(*stream_, request, write_options, GetData());
 }
 
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::SetWriteBatchSize(
+    std::size_t batch_size) {
+  write_batching_.SetBatchSize(batch_size);
+}
+
 template <typename Request, typename Response>
 bool BidirectionalStream<Request, Response>::WritesDone() {
   return impl::WritesDone(*stream_, GetData());
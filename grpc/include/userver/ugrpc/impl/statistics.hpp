@@ -45,6 +45,9 @@ class MethodStatistics final {
 
   void AccountCancelled() noexcept;
 
+  void AccountWrite(bool is_buffered,
+                    std::chrono::microseconds wait_time) noexcept;
+
   friend void DumpMetric(utils::statistics::Writer& writer,
                          const MethodStatistics& stats);
 
@@ -66,6 +69,10 @@ class MethodStatistics final {
 
   RateCounter deadline_updated_{0};
   RateCounter deadline_cancelled_{0};
+
+  RateCounter writes_{0};
+  RateCounter buffered_writes_{0};
+  RateCounter write_wait_us_{0};
 };
 
 class ServiceStatistics final {
@@ -27,6 +27,10 @@ class RpcStatisticsScope final {
 
   void OnNetworkError();
 
+  // A message write of a stream, wait_time is the time Write waited for the
+  // completion
+  void OnWrite(bool is_buffered, std::chrono::steady_clock::duration wait_time);
+
  private:
   // Represents how the RPC was finished. Kinds with higher numeric values
   // override those with lower ones.
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#include <grpcpp/impl/codegen/call_op_set.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+/// Coalesces the message writes of a stream into flushes of up to
+/// `batch_size` messages using `grpc::WriteOptions::set_buffer_hint`
+class WriteBatching final {
+ public:
+  void SetBatchSize(std::size_t batch_size) noexcept {
+    UINVARIANT(batch_size > 0, "Write batch size must be greater than zero");
+    batch_size_ = batch_size;
+    buffered_ = 0;
+  }
+
+  /// Returns the options of the next message write
+  grpc::WriteOptions NextWriteOptions() noexcept {
+    grpc::WriteOptions options{};
+    if (++buffered_ < batch_size_) {
+      options.set_buffer_hint();
+    } else {
+      buffered_ = 0;
+    }
+    return options;
+  }
+
+  /// An unbuffered write or finish flushes the buffered messages
+  void OnFlush() noexcept { buffered_ = 0; }
+
+ private:
+  std::size_t batch_size_{1};
+  std::size_t buffered_{0};
+};
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
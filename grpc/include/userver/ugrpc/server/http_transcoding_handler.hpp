@@ -0,0 +1,91 @@
+#pragma once
+
+/// @file userver/ugrpc/server/http_transcoding_handler.hpp
+/// @brief @copybrief ugrpc::server::HttpTranscodingHandler
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+class Server;
+
+namespace impl {
+class HttpRoute;
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief HTTP handler that transcodes HTTP/JSON requests to the unary methods
+/// of the gRPC services, as described by their `google.api.http` annotations
+///
+/// The calls go to the services of ugrpc::server::ServerComponent through the
+/// in-process channel of the server, i.e. without network, sockets and a
+/// separate gateway process. The request path is matched against the path
+/// templates of the annotations of the listed `services`, the handler `path`
+/// must cover all of them, e.g. `/v1/*`.
+///
+/// The request message is built from the JSON body, the path variables and
+/// the query arguments. The response message (or its `response_body` field)
+/// is returned as JSON. A non-OK gRPC status is mapped to the HTTP status as
+/// in `google/rpc/code.proto` with the `{"code": ..., "message": ...}` body.
+///
+/// The deadline of the HTTP request is propagated to the gRPC call.
+///
+/// ## Static options:
+/// The default component name for static config is
+/// `"grpc-http-transcoding-handler"`.
+///
+/// Additionally to the @ref userver_http_handlers "common handler options":
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// services | full names of the gRPC services to transcode, e.g. `my.package.MyService` | -
+/// forwarded-headers | HTTP headers passed to the gRPC calls as metadata | []
+
+// clang-format on
+
+class HttpTranscodingHandler final
+    : public USERVER_NAMESPACE::server::handlers::HttpHandlerBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of ugrpc::server::HttpTranscodingHandler
+  static constexpr std::string_view kName = "grpc-http-transcoding-handler";
+
+  HttpTranscodingHandler(const components::ComponentConfig& config,
+                         const components::ComponentContext& context);
+
+  ~HttpTranscodingHandler() override;
+
+  std::string HandleRequestThrow(
+      const USERVER_NAMESPACE::server::http::HttpRequest& request,
+      USERVER_NAMESPACE::server::request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::string Call(
+      const impl::HttpRoute& route,
+      const USERVER_NAMESPACE::server::http::HttpRequest& request,
+      const std::vector<std::pair<std::string, std::string>>& path_bindings)
+      const;
+
+  Server& server_;
+  std::vector<impl::HttpRoute> routes_;
+  std::vector<std::string> forwarded_headers_;
+};
+
+}  // namespace ugrpc::server
+
+template <>
+inline constexpr bool
+    components::kHasValidate<ugrpc::server::HttpTranscodingHandler> = true;
+
+USERVER_NAMESPACE_END
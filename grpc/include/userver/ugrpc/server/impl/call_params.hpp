@@ -2,6 +2,7 @@
 
 #include <string_view>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_context.h>
 
@@ -21,6 +22,7 @@ struct CallParams {
   ugrpc::impl::RpcStatisticsScope& statistics;
   logging::LoggerRef access_tskv_logger;
   tracing::Span& call_span;
+  google::protobuf::Arena& arena;
 };
 
 }  // namespace ugrpc::server::impl
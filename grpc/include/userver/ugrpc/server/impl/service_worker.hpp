@@ -23,7 +23,8 @@ namespace ugrpc::server::impl {
 
 /// Config for a `ServiceWorker`, provided by `ugrpc::server::Server`
 struct ServiceSettings final {
-  grpc::ServerCompletionQueue& queue;
+  /// RPCs of each method are listened to on each of the queues
+  std::vector<grpc::ServerCompletionQueue*> queues;
   engine::TaskProcessor& task_processor;
   ugrpc::impl::StatisticsStorage& statistics_storage;
   Middlewares middlewares;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <string>
@@ -8,6 +9,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -76,6 +78,7 @@ struct MethodData final {
   const std::size_t method_id{};
   typename CallTraits::ServiceBase& service;
   const typename CallTraits::ServiceMethod service_method;
+  grpc::ServerCompletionQueue& queue;
 
   std::string_view call_name{
       service_data.metadata.method_full_names[method_id]};
@@ -108,9 +111,9 @@ class CallData final {
     context_.AsyncNotifyWhenDone(notify_when_done.GetTag());
 
     // the request for an incoming RPC must be performed synchronously
-    auto& queue = method_data_.service_data.settings.queue;
+    auto& queue = method_data_.queue;
     method_data_.service_data.async_service.template Prepare<CallTraits>(
-        method_data_.method_id, context_, initial_request_, raw_responder_,
+        method_data_.method_id, context_, *initial_request_, raw_responder_,
         queue, queue, prepare_.GetTag());
 
     if (prepare_.Wait() != impl::AsyncMethodInvocation::WaitStatus::kOk) {
@@ -146,6 +149,18 @@ class CallData final {
   using RawCall = typename CallTraits::RawCall;
   using Call = typename CallTraits::Call;
 
+  // Small messages fit into the initial block on the coroutine stack, so that
+  // neither they nor their nested fields are allocated on the heap
+  static constexpr std::size_t kArenaInitialBlockSize = 1024;
+
+  static InitialRequest* CreateInitialRequest(google::protobuf::Arena& arena) {
+    if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
+      return google::protobuf::Arena::Create<InitialRequest>(&arena);
+    } else {
+      return google::protobuf::Arena::CreateMessage<InitialRequest>(&arena);
+    }
+  }
+
   void HandleRpc() {
     const auto call_name = method_data_.call_name;
     auto& service = method_data_.service;
@@ -163,20 +178,20 @@ class CallData final {
     auto& access_tskv_logger =
         method_data_.service_data.settings.access_tskv_logger;
     Call responder(CallParams{context_, call_name, statistics_scope,
-                              *access_tskv_logger, span_->Get()},
+                              *access_tskv_logger, span_->Get(), arena_},
                    raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
         (service.*service_method)(responder);
       } else {
-        (service.*service_method)(responder, std::move(initial_request_));
+        (service.*service_method)(responder, std::move(*initial_request_));
       }
     };
 
     try {
       ::google::protobuf::Message* initial_request = nullptr;
       if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-        initial_request = &initial_request_;
+        initial_request = initial_request_;
       }
 
       // TODO: pass responder as function_ref?
@@ -201,7 +216,10 @@ class CallData final {
   MethodData<GrpcppService, CallTraits> method_data_;
 
   grpc::ServerContext context_{};
-  InitialRequest initial_request_{};
+  alignas(std::max_align_t) char arena_initial_block_[kArenaInitialBlockSize];
+  google::protobuf::Arena arena_{arena_initial_block_, kArenaInitialBlockSize};
+  // destroyed together with 'arena_' after the RPC is finished
+  InitialRequest* const initial_request_{CreateInitialRequest(arena_)};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -216,10 +234,15 @@ class ServiceWorkerImpl final : public ServiceWorker {
                     Service& service, ServiceMethods... service_methods)
       : service_data_(settings, metadata),
         start_{[this, &service, service_methods...] {
-          std::size_t method_id = 0;
-          (CallData<GrpcppService, CallTraits<ServiceMethods>>::ListenAsync(
-               {service_data_, method_id++, service, service_methods}),
-           ...);
+          // a listener per queue, so that the RPCs of each method are
+          // distributed across all the queues
+          for (auto* queue : service_data_.settings.queues) {
+            std::size_t method_id = 0;
+            (CallData<GrpcppService, CallTraits<ServiceMethods>>::ListenAsync(
+                 {service_data_, method_id++, service, service_methods,
+                  *queue}),
+             ...);
+          }
         }} {}
 
   ~ServiceWorkerImpl() override {
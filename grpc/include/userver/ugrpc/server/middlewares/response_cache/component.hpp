@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file userver/ugrpc/server/middlewares/response_cache/component.hpp
+/// @brief @copybrief ugrpc::server::middlewares::response_cache::Component
+
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Server response cache middleware
+namespace ugrpc::server::middlewares::response_cache {
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Component for gRPC server caching of the responses of the
+/// idempotent unary methods
+///
+/// The responses are cached by the serialized request and the selected client
+/// metadata. A cache hit finishes the call with the cached response, the
+/// handler and the middlewares after this one are not called. Only the
+/// successful responses are cached.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// methods | dictionary of "full method name": "options", e.g. `package.Service/Method` | {}
+/// methods.*.ttl | lifetime of a cached response | 1s
+/// methods.*.size | maximum count of the cached responses of the method | 1000
+/// methods.*.metadata | client metadata keys that distinguish the responses | []
+/// max-response-size | the greater responses (in bytes) are not cached | 1048576
+
+// clang-format on
+
+class Component final : public MiddlewareComponentBase {
+ public:
+  static constexpr std::string_view kName = "grpc-server-response-cache";
+
+  Component(const components::ComponentConfig& config,
+            const components::ComponentContext& context);
+
+  ~Component() override;
+
+  std::shared_ptr<MiddlewareBase> GetMiddleware() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  // one cache is shared by all the services
+  std::shared_ptr<MiddlewareBase> middleware_;
+};
+
+}  // namespace ugrpc::server::middlewares::response_cache
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,10 @@
 /// @file userver/ugrpc/server/rpc.hpp
 /// @brief Classes representing an incoming RPC
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
 #include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/server_context.h>
 
@@ -12,6 +16,7 @@
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/span.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/impl/write_batching.hpp>
 #include <userver/ugrpc/server/exceptions.hpp>
 #include <userver/ugrpc/server/impl/async_methods.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
@@ -43,9 +48,26 @@ class CallAnyBase {
 
   tracing::Span& GetSpan() { return params_.call_span; }
 
+  /// @returns the arena that lives until the RPC is finished. The initial
+  /// request is allocated on it, and the responses may be allocated on it
+  /// with `google::protobuf::Arena::CreateMessage<Response>(&call.GetArena())`
+  /// to avoid the heap allocations of the nested fields.
+  google::protobuf::Arena& GetArena() { return params_.arena; }
+
   /// @cond
   // For internal use only
   ugrpc::impl::RpcStatisticsScope& Statistics(ugrpc::impl::InternalTag);
+
+  // For internal use only. Completes a unary RPC with a response of the
+  // matching type, returns false for the other kinds of RPCs
+  virtual bool FinishWithResponse(const google::protobuf::Message& response);
+
+  // For internal use only. The hook observes the response of a unary RPC
+  // right before it is sent
+  void SetResponseHook(
+      std::function<void(const google::protobuf::Message&)> hook) {
+    response_hook_ = std::move(hook);
+  }
   /// @endcond
 
  protected:
@@ -55,8 +77,13 @@ class CallAnyBase {
 
   void LogFinish(grpc::Status status) const;
 
+  void CallResponseHook(const google::protobuf::Message& response) const {
+    if (response_hook_) response_hook_(response);
+  }
+
  private:
   impl::CallParams params_;
+  std::function<void(const google::protobuf::Message&)> response_hook_;
 };
 
 /// @brief Controls a single request -> single response RPC
@@ -81,6 +108,11 @@ class UnaryCall final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void FinishWithError(const grpc::Status& status) override;
 
+  /// @cond
+  // For internal use only
+  bool FinishWithResponse(const google::protobuf::Message& response) override;
+  /// @endcond
+
   /// For internal use only
   UnaryCall(impl::CallParams&& call_params,
             impl::RawResponseWriter<Response>& stream);
@@ -157,6 +189,15 @@ class OutputStream final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Coalesce the writes of up to `batch_size` messages into a single
+  /// flush
+  ///
+  /// The messages are written with `grpc::WriteOptions::set_buffer_hint`, so
+  /// `Write` does not wait for each message to go to the wire. Every
+  /// `batch_size`-th message, `WriteAndFinish` and `Finish` flush the
+  /// buffered messages. The default of 1 disables the buffering.
+  void SetWriteBatchSize(std::size_t batch_size);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -195,6 +236,7 @@ class OutputStream final : public CallAnyBase {
 
   impl::RawWriter<Response>& stream_;
   State state_{State::kNew};
+  ugrpc::impl::WriteBatching write_batching_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -219,6 +261,15 @@ class BidirectionalStream : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Coalesce the writes of up to `batch_size` messages into a single
+  /// flush
+  ///
+  /// The messages are written with `grpc::WriteOptions::set_buffer_hint`, so
+  /// `Write` does not wait for each message to go to the wire. Every
+  /// `batch_size`-th message, `WriteAndFinish` and `Finish` flush the
+  /// buffered messages. The default of 1 disables the buffering.
+  void SetWriteBatchSize(std::size_t batch_size);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -257,6 +308,7 @@ class BidirectionalStream : public CallAnyBase {
 
   impl::RawReaderWriter<Request, Response>& stream_;
   State state_{State::kOpen};
+  ugrpc::impl::WriteBatching write_batching_;
 };
 
 // ========================== Implementation follows ==========================
@@ -279,12 +331,22 @@ void UnaryCall<Response>::Finish(const Response& response) {
   UINVARIANT(!is_finished_, "'Finish' called on a finished call");
   is_finished_ = true;
 
+  CallResponseHook(response);
   LogFinish(grpc::Status::OK);
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
   Statistics().OnExplicitFinish(grpc::StatusCode::OK);
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), grpc::Status::OK);
 }
 
+template <typename Response>
+bool UnaryCall<Response>::FinishWithResponse(
+    const google::protobuf::Message& response) {
+  const auto* typed_response = dynamic_cast<const Response*>(&response);
+  if (!typed_response) return false;
+  Finish(*typed_response);
+  return true;
+}
+
 template <typename Response>
 void UnaryCall<Response>::FinishWithError(const grpc::Status& status) {
   UINVARIANT(!is_finished_, "'FinishWithError' called on a finished call");
@@ -365,11 +427,19 @@ void OutputStream<Response>::Write(const Response& response) {
   // streams
   impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes by default, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  const auto write_options = write_batching_.NextWriteOptions();
 
+  const auto start = std::chrono::steady_clock::now();
   impl::Write(stream_, response, write_options, GetCallName());
+  Statistics().OnWrite(write_options.get_buffer_hint(),
+                       std::chrono::steady_clock::now() - start);
+}
+
+template <typename Response>
+void OutputStream<Response>::SetWriteBatchSize(std::size_t batch_size) {
+  write_batching_.SetBatchSize(batch_size);
 }
 
 template <typename Response>
@@ -441,10 +511,19 @@ template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(const Response& response) {
   UINVARIANT(state_ != State::kFinished, "'Write' called on a finished stream");
 
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes by default, optimize for ping-pong-style interaction
+  const auto write_options = write_batching_.NextWriteOptions();
 
+  const auto start = std::chrono::steady_clock::now();
   impl::Write(stream_, response, write_options, GetCallName());
+  Statistics().OnWrite(write_options.get_buffer_hint(),
+                       std::chrono::steady_clock::now() - start);
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::SetWriteBatchSize(
+    std::size_t batch_size) {
+  write_batching_.SetBatchSize(batch_size);
 }
 
 template <typename Request, typename Response>
@@ -3,10 +3,12 @@
 /// @file userver/ugrpc/server/server.hpp
 /// @brief @copybrief ugrpc::server::Server
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <unordered_map>
 
+#include <grpcpp/channel.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_builder.h>
 
@@ -43,6 +45,10 @@ struct ServerConfig final {
   /// Serve a web page with runtime info about gRPC connections
   bool enable_channelz{false};
 
+  /// Number of completion queues, each one is polled by its own thread.
+  /// Incoming RPCs are distributed across all the queues.
+  std::size_t completion_queue_count{1};
+
   /// 'access-tskv.log' logger
   logging::LoggerPtr access_tskv_logger{logging::MakeNullLogger()};
 };
@@ -76,7 +82,8 @@ class Server final {
   /// @note The ServerBuilder must not be stored and used outside of `setup`.
   void WithServerBuilder(SetupHook&& setup);
 
-  /// @returns the completion queue for clients
+  /// @returns the completion queue for clients, i.e. the first of the
+  /// server completion queues
   /// @note All RPCs are cancelled on 'Stop'. If you need to perform requests
   /// after the server has been closed, create an ugrpc::client::QueueHolder -
   /// usually no more than one instance per program.
@@ -90,6 +97,11 @@ class Server final {
   /// @note Only available after 'Start' has returned
   int GetPort() const noexcept;
 
+  /// @returns A channel calling the services of this server without network
+  /// and socket overhead, or `nullptr` if the server is not running
+  /// @note The calls are served while the server is running
+  std::shared_ptr<grpc::Channel> GetInProcessChannel() const;
+
   /// @brief Stop accepting requests. Also destroys server statistics and closes
   /// the associated CompletionQueue.
   /// @note Should be called at least once before the services are destroyed
@@ -31,6 +31,7 @@ struct ServiceDefaults;
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
+/// completion-queue-count | number of completion queues, each one is polled by a separate thread | 1
 /// service-defaults | default config values for gRPC services, see config schema | {}
 ///
 /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
@@ -7,11 +7,13 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/logging/level_serialization.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/impl/to_string.hpp>
+#include <userver/ugrpc/client/channels.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -80,6 +82,13 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
       value["native-log-level"].As<logging::Level>(config.native_log_level);
   config.channel_count =
       value["channel-count"].As<std::size_t>(config.channel_count);
+  config.load_balancing =
+      value["load-balancing"].As<LoadBalancingConfig>(config.load_balancing);
+  config.prewarm_channels =
+      value["prewarm-channels"].As<bool>(config.prewarm_channels);
+  config.prewarm_timeout =
+      value["prewarm-timeout"].As<std::chrono::milliseconds>(
+          config.prewarm_timeout);
 
   return config;
 }
@@ -97,10 +106,14 @@ ClientFactory::ClientFactory(ClientFactoryConfig&& config,
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? config.credentials
                          : grpc::InsecureChannelCredentials(),
-                     config.channel_args, config.channel_count),
+                     config.channel_args, config.channel_count,
+                     config.prewarm_channels),
       client_statistics_storage_(statistics_storage, "client"),
       config_source_(source),
-      testsuite_grpc_(testsuite_grpc) {
+      testsuite_grpc_(testsuite_grpc),
+      load_balancing_(config.load_balancing),
+      prewarm_channels_(config.prewarm_channels),
+      prewarm_timeout_(config.prewarm_timeout) {
   ugrpc::impl::SetupNativeLogging();
   ugrpc::impl::UpdateNativeLogLevel(config.native_log_level);
 }
@@ -109,9 +122,22 @@ impl::ChannelCache::Token ClientFactory::GetChannel(
     const std::string& endpoint) {
   // Spawn a blocking task creating a gRPC channel
   // This is third party code, no use of span inside it
-  return engine::AsyncNoSpan(channel_task_processor_,
-                             [&] { return channel_cache_.Get(endpoint); })
-      .Get();
+  auto token = engine::AsyncNoSpan(channel_task_processor_, [&] {
+                 return channel_cache_.Get(endpoint);
+               }).Get();
+
+  if (prewarm_channels_ && prewarm_timeout_.count() > 0) {
+    // Returns immediately if the channels of the endpoint are already ready
+    const bool is_ready = impl::TryWaitForConnected(
+        token, queue_, engine::Deadline::FromDuration(prewarm_timeout_),
+        channel_task_processor_);
+    if (!is_ready) {
+      LOG_WARNING() << "Channels to '" << endpoint << "' are not ready after "
+                    << prewarm_timeout_.count()
+                    << "ms of prewarm, they keep connecting in background";
+    }
+  }
+  return token;
 }
 
 }  // namespace ugrpc::client
@@ -95,6 +95,71 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    prewarm-channels:
+        type: boolean
+        description: |
+            connect the channels when the first client of an endpoint is
+            created instead of on the first call
+        defaultDescription: false
+    prewarm-timeout:
+        type: string
+        description: |
+            how long the creation of a client waits for the prewarmed channels
+            to become ready, 0 disables the wait
+        defaultDescription: 5s
+    load-balancing:
+        type: object
+        description: balancing of the calls between the channels of a client
+        additionalProperties: false
+        properties:
+            policy:
+                type: string
+                description: how a channel is picked for a call
+                defaultDescription: random
+                enum:
+                  - random
+                  - least-request
+            outlier-ejection:
+                type: object
+                description: temporary ejection of the failing or slow channels
+                additionalProperties: false
+                properties:
+                    enabled:
+                        type: boolean
+                        description: enables the ejection
+                        defaultDescription: true
+                    max-error-rate:
+                        type: number
+                        description: share of failed calls that ejects a channel
+                        defaultDescription: 0.5
+                    max-latency-factor:
+                        type: number
+                        description: |
+                            ejects a channel with the average latency greater
+                            than the average of all channels multiplied by
+                            this factor, 0 disables the check
+                        defaultDescription: 0
+                    min-requests:
+                        type: integer
+                        description: calls per interval required to eject
+                        defaultDescription: 20
+                        minimum: 1
+                    interval:
+                        type: string
+                        description: interval of the channels evaluation
+                        defaultDescription: 10s
+                    ejection-time:
+                        type: string
+                        description: |
+                            base ejection time, multiplied by the number of
+                            consecutive ejections of the channel
+                        defaultDescription: 30s
+                    max-ejection-percent:
+                        type: integer
+                        description: maximum percent of ejected channels
+                        defaultDescription: 50
+                        minimum: 0
+                        maximum: 100
     middlewares:
         type: array
         items:
@@ -54,6 +54,21 @@ void SetStatusDetailsForSpan(RpcData& data, grpc::Status& status,
   data.ResetSpan();
 }
 
+// The errors that are likely caused by the server or the connection rather
+// than by the request
+bool IsChannelFailure(grpc::StatusCode code) noexcept {
+  switch (code) {
+    case grpc::StatusCode::UNAVAILABLE:
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+    case grpc::StatusCode::INTERNAL:
+    case grpc::StatusCode::UNKNOWN:
+      return true;
+    default:
+      return false;
+  }
+}
+
 void SetErrorForSpan(RpcData& data, std::string&& message) {
   data.GetSpan().AddTag(tracing::kErrorFlag, true);
   data.GetSpan().AddTag(tracing::kErrorMessage, std::move(message));
@@ -93,7 +108,8 @@ RpcData::RpcData(impl::CallParams&& params)
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      channel_lease_(std::move(params.channel_lease)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_);
@@ -207,6 +223,10 @@ AsyncMethodInvocation& RpcData::GetAsyncMethodInvocation() noexcept {
 
 grpc::Status& RpcData::GetStatus() noexcept { return status_; }
 
+void RpcData::AccountChannelResult(bool is_failure) noexcept {
+  channel_lease_.Finish(is_failure);
+}
+
 RpcData::AsyncMethodInvocationGuard::AsyncMethodInvocationGuard(
     RpcData& data) noexcept
     : data_(data) {}
@@ -222,6 +242,7 @@ void CheckOk(RpcData& data, AsyncMethodInvocation::WaitStatus status,
   if (status == impl::AsyncMethodInvocation::WaitStatus::kError) {
     data.SetFinished();
     data.GetStatsScope().OnNetworkError();
+    data.AccountChannelResult(/*is_failure=*/true);
     SetErrorForSpan(data, fmt::format("Network error at '{}'", stage));
     throw RpcInterruptedError(data.GetCallName(), stage);
   } else if (status == impl::AsyncMethodInvocation::WaitStatus::kCancelled) {
@@ -246,6 +267,7 @@ void ProcessFinishResult(RpcData& data,
               "ok=false in async Finish method invocation is prohibited "
               "by gRPC docs, see grpc::CompletionQueue::Next");
   data.GetStatsScope().OnExplicitFinish(status.error_code());
+  data.AccountChannelResult(IsChannelFailure(status.error_code()));
 
   if (!status.ok()) {
     // extract error
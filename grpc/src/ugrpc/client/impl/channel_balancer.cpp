@@ -0,0 +1,205 @@
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+ChannelBalancer::Lease::Lease(Lease&& other) noexcept
+    : balancer_(std::move(other.balancer_)),
+      index_(other.index_),
+      start_(other.start_) {}
+
+ChannelBalancer::Lease& ChannelBalancer::Lease::operator=(
+    Lease&& other) noexcept {
+  if (this == &other) return *this;
+  Release(std::nullopt);
+  balancer_ = std::move(other.balancer_);
+  index_ = other.index_;
+  start_ = other.start_;
+  return *this;
+}
+
+ChannelBalancer::Lease::~Lease() { Release(std::nullopt); }
+
+void ChannelBalancer::Lease::Finish(bool is_failure) noexcept {
+  Release(is_failure);
+}
+
+void ChannelBalancer::Lease::Release(std::optional<bool> is_failure) noexcept {
+  if (!balancer_) return;
+  balancer_->Account(index_, Clock::now() - start_, is_failure);
+  balancer_.reset();
+}
+
+ChannelBalancer::ChannelBalancer(std::size_t channel_count,
+                                 const LoadBalancingConfig& config)
+    : config_(config),
+      channels_(channel_count),
+      next_evaluation_((Clock::now() + config.outlier_ejection.interval)
+                           .time_since_epoch()
+                           .count()) {
+  UASSERT(channel_count > 0);
+}
+
+bool ChannelBalancer::IsNeeded(std::size_t channel_count,
+                               const LoadBalancingConfig& config) noexcept {
+  return channel_count > 1 &&
+         (config.policy != LoadBalancingPolicy::kRandom ||
+          config.outlier_ejection.enabled);
+}
+
+std::size_t ChannelBalancer::Pick(Lease& lease) {
+  const auto now = Clock::now();
+  const auto now_rep = now.time_since_epoch().count();
+  if (config_.outlier_ejection.enabled) EvaluateIfNeeded(now_rep);
+
+  auto index = PickNotEjected(now_rep);
+  if (config_.policy == LoadBalancingPolicy::kLeastRequest) {
+    // the power of two choices: nearly as good as the least loaded channel of
+    // all without scanning all the channels
+    const auto other = PickNotEjected(now_rep);
+    if (channels_[other].in_flight.load(std::memory_order_relaxed) <
+        channels_[index].in_flight.load(std::memory_order_relaxed)) {
+      index = other;
+    }
+  }
+
+  channels_[index].in_flight.fetch_add(1, std::memory_order_relaxed);
+  lease.Release(std::nullopt);
+  lease.balancer_ = shared_from_this();
+  lease.index_ = index;
+  lease.start_ = now;
+  return index;
+}
+
+bool ChannelBalancer::IsEjected(std::size_t index) const noexcept {
+  UASSERT(index < channels_.size());
+  return IsEjected(channels_[index], Clock::now().time_since_epoch().count());
+}
+
+std::size_t ChannelBalancer::PickNotEjected(Clock::rep now) const {
+  const auto count = channels_.size();
+  auto index = utils::RandRange(count);
+  if (!config_.outlier_ejection.enabled) return index;
+
+  // a linear probe keeps the distribution over the remaining channels close to
+  // uniform, there is always a channel that is not ejected
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!IsEjected(channels_[index], now)) break;
+    index = (index + 1) % count;
+  }
+  return index;
+}
+
+bool ChannelBalancer::IsEjected(const ChannelState& channel,
+                                Clock::rep now) const noexcept {
+  return channel.ejected_until.load(std::memory_order_relaxed) > now;
+}
+
+void ChannelBalancer::Account(std::size_t index, Clock::duration latency,
+                              std::optional<bool> is_failure) noexcept {
+  auto& channel = channels_[index];
+  channel.in_flight.fetch_sub(1, std::memory_order_relaxed);
+  if (!is_failure || !config_.outlier_ejection.enabled) return;
+
+  channel.requests.fetch_add(1, std::memory_order_relaxed);
+  if (*is_failure) channel.failures.fetch_add(1, std::memory_order_relaxed);
+  channel.latency_sum_us.fetch_add(
+      std::chrono::duration_cast<std::chrono::microseconds>(latency).count(),
+      std::memory_order_relaxed);
+}
+
+void ChannelBalancer::EvaluateIfNeeded(Clock::rep now) {
+  if (now < next_evaluation_.load(std::memory_order_relaxed)) return;
+
+  std::unique_lock lock(evaluation_mutex_, std::try_to_lock);
+  // another task evaluates the channels right now
+  if (!lock.owns_lock()) return;
+  if (now < next_evaluation_.load(std::memory_order_relaxed)) return;
+
+  Evaluate(now);
+  next_evaluation_.store(
+      now + std::chrono::duration_cast<Clock::duration>(
+                config_.outlier_ejection.interval)
+                .count(),
+      std::memory_order_relaxed);
+}
+
+void ChannelBalancer::Evaluate(Clock::rep now) {
+  const auto& config = config_.outlier_ejection;
+  const auto count = channels_.size();
+
+  struct Interval {
+    std::uint64_t requests;
+    std::uint64_t failures;
+    std::uint64_t latency_sum_us;
+  };
+  utils::FixedArray<Interval> intervals(count);
+
+  std::uint64_t total_requests = 0;
+  std::uint64_t total_latency_us = 0;
+  std::size_t ejected = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& channel = channels_[i];
+    intervals[i] = {
+        channel.requests.exchange(0, std::memory_order_relaxed),
+        channel.failures.exchange(0, std::memory_order_relaxed),
+        channel.latency_sum_us.exchange(0, std::memory_order_relaxed),
+    };
+    total_requests += intervals[i].requests;
+    total_latency_us += intervals[i].latency_sum_us;
+    if (IsEjected(channel, now)) ++ejected;
+  }
+
+  const auto max_ejected = std::min(
+      count - 1,
+      static_cast<std::size_t>(static_cast<double>(count) *
+                               config.max_ejection_percent / 100.0));
+  const double average_latency_us =
+      total_requests ? static_cast<double>(total_latency_us) /
+                           static_cast<double>(total_requests)
+                     : 0;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& channel = channels_[i];
+    const auto& interval = intervals[i];
+    if (IsEjected(channel, now)) continue;
+
+    bool is_outlier = false;
+    if (interval.requests >= config.min_requests && interval.requests > 0) {
+      const auto requests = static_cast<double>(interval.requests);
+      const auto error_rate = static_cast<double>(interval.failures) / requests;
+      const auto latency_us =
+          static_cast<double>(interval.latency_sum_us) / requests;
+      is_outlier = error_rate > config.max_error_rate ||
+                   (config.max_latency_factor > 0 &&
+                    latency_us > average_latency_us * config.max_latency_factor);
+    }
+
+    if (!is_outlier) {
+      if (interval.requests >= config.min_requests) {
+        channel.consecutive_ejections = 0;
+      }
+      continue;
+    }
+    if (ejected >= max_ejected) continue;
+
+    ++channel.consecutive_ejections;
+    ++ejected;
+    const auto ejection_time =
+        std::chrono::duration_cast<Clock::duration>(config.ejection_time) *
+        channel.consecutive_ejections;
+    channel.ejected_until.store(now + ejection_time.count(),
+                                std::memory_order_relaxed);
+  }
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
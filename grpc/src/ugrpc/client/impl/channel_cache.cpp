@@ -14,6 +14,22 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+namespace {
+
+grpc::ChannelArguments MakeChannelArgs(
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count) {
+  auto result = channel_args;
+  // Channels with equal arguments share the subchannels (connections) of the
+  // global pool, the local pools give each channel its own HTTP/2 connections
+  // and thus its own limit of concurrent streams
+  if (channel_count > 1) {
+    result.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  }
+  return result;
+}
+
+}  // namespace
+
 ChannelCache::Token::Token(ChannelCache& cache, const std::string& endpoint,
                            CountedChannel& counted_channel) noexcept
     : cache_(&cache), endpoint_(&endpoint), counted_channel_(&counted_channel) {
@@ -58,21 +74,30 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
+    const grpc::ChannelArguments& channel_args, std::size_t count,
+    bool prewarm) {
   const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
   channels = utils::GenerateFixedArray(count, [&](std::size_t) {
     return grpc::CreateCustomChannel(endpoint_string, credentials,
                                      channel_args);
   });
   UASSERT(count > 0);
+
+  if (prewarm) {
+    // Starts the name resolution and the connection establishment without
+    // waiting for them
+    for (const auto& channel : channels) channel->GetState(true);
+  }
 }
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count,
+    bool prewarm)
     : credentials_(std::move(credentials)),
-      channel_args_(channel_args),
-      channel_count_(channel_count) {
+      channel_args_(MakeChannelArgs(channel_args, channel_count)),
+      channel_count_(channel_count),
+      prewarm_(prewarm) {
   UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
 }
 
@@ -81,7 +106,8 @@ ChannelCache::~ChannelCache() = default;
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   auto channels = channels_.Lock();
   const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_,
-                                             channel_args_, channel_count_);
+                                             channel_args_, channel_count_,
+                                             prewarm_);
   return {*this, it->first, it->second};
 }
 
@@ -0,0 +1,53 @@
+#include <userver/ugrpc/client/load_balancing.hpp>
+
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+LoadBalancingPolicy Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<LoadBalancingPolicy>) {
+  constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(LoadBalancingPolicy::kRandom, "random")
+        .Case(LoadBalancingPolicy::kLeastRequest, "least-request");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+OutlierEjectionConfig Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<OutlierEjectionConfig>) {
+  OutlierEjectionConfig config;
+  config.enabled = value["enabled"].As<bool>(true);
+  config.max_error_rate =
+      value["max-error-rate"].As<double>(config.max_error_rate);
+  config.max_latency_factor =
+      value["max-latency-factor"].As<double>(config.max_latency_factor);
+  config.min_requests =
+      value["min-requests"].As<std::size_t>(config.min_requests);
+  config.interval =
+      value["interval"].As<std::chrono::milliseconds>(config.interval);
+  config.ejection_time = value["ejection-time"].As<std::chrono::milliseconds>(
+      config.ejection_time);
+  config.max_ejection_percent =
+      value["max-ejection-percent"].As<double>(config.max_ejection_percent);
+  return config;
+}
+
+LoadBalancingConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<LoadBalancingConfig>) {
+  LoadBalancingConfig config;
+  config.policy = value["policy"].As<LoadBalancingPolicy>(config.policy);
+  if (!value["outlier-ejection"].IsMissing()) {
+    config.outlier_ejection =
+        value["outlier-ejection"].As<OutlierEjectionConfig>();
+  }
+  return config;
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
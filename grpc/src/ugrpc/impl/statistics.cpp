@@ -60,6 +60,14 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept {
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountWrite(
+    bool is_buffered, std::chrono::microseconds wait_time) noexcept {
+  ++writes_;
+  if (is_buffered) ++buffered_writes_;
+  write_wait_us_.Add(
+      utils::statistics::Rate{static_cast<std::uint64_t>(wait_time.count())});
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const MethodStatistics& stats) {
   writer["timings"] = stats.timings_;
@@ -114,6 +122,17 @@ void DumpMetric(utils::statistics::Writer& writer,
       AsRateAndGauge{stats.deadline_updated_.Load()};
   writer["cancelled-by-deadline-propagation"] =
       AsRateAndGauge{deadline_cancelled_value};
+
+  // only the streams write messages, the unary methods have no such metrics
+  const auto writes_value = stats.writes_.Load();
+  if (writes_value.value != 0) {
+    auto writes = writer["writes"];
+    writes["total"] = writes_value;
+    writes["buffered"] = stats.buffered_writes_.Load();
+    // the time spent waiting for the completions of the writes, the
+    // backpressure of the stream
+    writes["wait-us"] = stats.write_wait_us_.Load();
+  }
 }
 
 ServiceStatistics::~ServiceStatistics() = default;
@@ -43,6 +43,13 @@ void RpcStatisticsScope::OnCancelled() {
   finish_kind_ = std::max(finish_kind_, FinishKind::kCancelled);
 }
 
+void RpcStatisticsScope::OnWrite(
+    bool is_buffered, std::chrono::steady_clock::duration wait_time) {
+  statistics_.AccountWrite(
+      is_buffered,
+      std::chrono::duration_cast<std::chrono::microseconds>(wait_time));
+}
+
 void RpcStatisticsScope::AccountStatus() {
   switch (finish_kind_) {
     case FinishKind::kAutomatic:
@@ -0,0 +1,195 @@
+#include <userver/ugrpc/server/http_transcoding_handler.hpp>
+
+#include <fmt/format.h>
+#include <google/protobuf/descriptor.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <userver/components/component.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <ugrpc/server/impl/http_transcoding.hpp>
+#include <userver/ugrpc/impl/async_method_invocation.hpp>
+#include <userver/ugrpc/impl/deadline_timepoint.hpp>
+#include <userver/ugrpc/server/server.hpp>
+#include <userver/ugrpc/server/server_component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+namespace {
+
+namespace handlers = USERVER_NAMESPACE::server::handlers;
+
+using GenericStub = grpc::TemplatedGenericStub<google::protobuf::Message,
+                                               google::protobuf::Message>;
+
+std::vector<impl::HttpRoute> MakeRoutes(
+    const std::vector<std::string>& service_names) {
+  std::vector<impl::HttpRoute> routes;
+  for (const auto& name : service_names) {
+    const auto* service =
+        google::protobuf::DescriptorPool::generated_pool()->FindServiceByName(
+            name);
+    if (!service) {
+      throw std::runtime_error(
+          fmt::format("gRPC service '{}' is not linked into the binary", name));
+    }
+
+    auto service_routes = impl::MakeHttpRoutes(*service);
+    if (service_routes.empty()) {
+      LOG_WARNING() << "gRPC service '" << name
+                    << "' has no methods with google.api.http options";
+    }
+    for (auto& route : service_routes) routes.push_back(std::move(route));
+  }
+  return routes;
+}
+
+std::vector<std::string> MakeMetadataKeys(std::vector<std::string>&& headers) {
+  // gRPC metadata keys must be lowercase
+  for (auto& header : headers) header = utils::text::ToLower(header);
+  return std::move(headers);
+}
+
+std::string MakeErrorBody(const grpc::Status& status) {
+  formats::json::StringBuilder sb;
+  {
+    const formats::json::StringBuilder::ObjectGuard guard{sb};
+    sb.Key("code");
+    sb.WriteInt64(static_cast<std::int64_t>(status.error_code()));
+    sb.Key("message");
+    sb.WriteString(status.error_message());
+  }
+  return sb.GetString();
+}
+
+}  // namespace
+
+HttpTranscodingHandler::HttpTranscodingHandler(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : HttpHandlerBase(config, context),
+      server_(context.FindComponent<ServerComponent>().GetServer()),
+      routes_(MakeRoutes(config["services"].As<std::vector<std::string>>())),
+      forwarded_headers_(MakeMetadataKeys(
+          config["forwarded-headers"].As<std::vector<std::string>>({}))) {}
+
+HttpTranscodingHandler::~HttpTranscodingHandler() = default;
+
+std::string HttpTranscodingHandler::HandleRequestThrow(
+    const USERVER_NAMESPACE::server::http::HttpRequest& request,
+    USERVER_NAMESPACE::server::request::RequestContext&) const {
+  for (const auto& route : routes_) {
+    const auto path_bindings =
+        route.Match(request.GetMethodStr(), request.GetRequestPath());
+    if (path_bindings) return Call(route, request, *path_bindings);
+  }
+
+  throw handlers::ResourceNotFound(handlers::ExternalBody{
+      fmt::format("No gRPC method is bound to {} {}", request.GetMethodStr(),
+                  request.GetRequestPath())});
+}
+
+std::string HttpTranscodingHandler::Call(
+    const impl::HttpRoute& route,
+    const USERVER_NAMESPACE::server::http::HttpRequest& request,
+    const std::vector<std::pair<std::string, std::string>>& path_bindings)
+    const {
+  impl::HttpFieldBindings query_args;
+  for (const auto& name : request.ArgNames()) {
+    for (const auto& value : request.GetArgVector(name)) {
+      query_args.emplace_back(name, value);
+    }
+  }
+
+  std::unique_ptr<google::protobuf::Message> grpc_request;
+  try {
+    grpc_request =
+        route.MakeRequest(path_bindings, query_args, request.RequestBody());
+  } catch (const impl::HttpTranscodingError& ex) {
+    throw handlers::ClientError(handlers::ExternalBody{ex.what()});
+  }
+
+  auto& response = request.GetHttpResponse();
+  response.SetContentType(http::content_type::kApplicationJson);
+
+  auto channel = server_.GetInProcessChannel();
+  if (!channel) {
+    const grpc::Status status{grpc::StatusCode::UNAVAILABLE,
+                              "The gRPC server is not running"};
+    request.SetResponseStatus(impl::ToHttpStatus(status.error_code()));
+    return MakeErrorBody(status);
+  }
+
+  grpc::ClientContext context;
+  const auto deadline =
+      USERVER_NAMESPACE::server::request::GetTaskInheritedDeadline();
+  if (deadline.IsReachable()) context.set_deadline(deadline);
+  for (const auto& header : forwarded_headers_) {
+    if (request.HasHeader(header)) {
+      context.AddMetadata(header, request.GetHeader(header));
+    }
+  }
+
+  // The in-process transport has no sockets and HTTP/2 framing, the messages
+  // are serialized only to pass them between the call objects
+  GenericStub stub{std::move(channel)};
+  auto grpc_response = route.MakeResponse();
+  grpc::Status status;
+  ugrpc::impl::AsyncMethodInvocation finish;
+  const auto reader =
+      stub.PrepareUnaryCall(&context, route.GetCallName(), *grpc_request,
+                            &server_.GetCompletionQueue());
+  reader->StartCall();
+  reader->Finish(grpc_response.get(), &status, finish.GetTag());
+
+  using WaitStatus = ugrpc::impl::AsyncMethodInvocation::WaitStatus;
+  if (finish.Wait() == WaitStatus::kCancelled) {
+    context.TryCancel();
+    const engine::TaskCancellationBlocker blocker;
+    (void)finish.Wait();
+  }
+
+  if (!status.ok()) {
+    request.SetResponseStatus(impl::ToHttpStatus(status.error_code()));
+    return MakeErrorBody(status);
+  }
+  return route.MakeResponseBody(*grpc_response);
+}
+
+yaml_config::Schema HttpTranscodingHandler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: transcoding of HTTP/JSON requests to the unary gRPC methods
+additionalProperties: false
+properties:
+    services:
+        type: array
+        description: full names of the gRPC services to transcode
+        items:
+            type: string
+            description: gRPC service name, e.g. my.package.MyService
+    forwarded-headers:
+        type: array
+        description: HTTP headers passed to the gRPC calls as metadata
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: header name
+)");
+}
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,485 @@
+#include <ugrpc/server/impl/http_transcoding.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <fmt/format.h>
+#include <google/api/annotations.pb.h>
+#include <google/protobuf/util/json_util.h>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/http/parser/http_request_parse_args.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+[[noreturn]] void ThrowInvalidTemplate(std::string_view pattern,
+                                       std::string_view reason) {
+  throw std::runtime_error(
+      fmt::format("Invalid HTTP path template '{}': {}", pattern, reason));
+}
+
+const Message& GetPrototype(const google::protobuf::Descriptor& descriptor) {
+  const auto* prototype =
+      google::protobuf::MessageFactory::generated_factory()->GetPrototype(
+          &descriptor);
+  UINVARIANT(prototype, "A generated message is expected");
+  return *prototype;
+}
+
+std::pair<std::string, std::string> GetMethodAndPath(
+    const google::api::HttpRule& rule) {
+  using Rule = google::api::HttpRule;
+  switch (rule.pattern_case()) {
+    case Rule::kGet:
+      return {"GET", rule.get()};
+    case Rule::kPut:
+      return {"PUT", rule.put()};
+    case Rule::kPost:
+      return {"POST", rule.post()};
+    case Rule::kDelete:
+      return {"DELETE", rule.delete_()};
+    case Rule::kPatch:
+      return {"PATCH", rule.patch()};
+    case Rule::kCustom:
+      return {rule.custom().kind(), rule.custom().path()};
+    case Rule::PATTERN_NOT_SET:
+      break;
+  }
+  throw std::runtime_error(
+      fmt::format("No HTTP pattern in the rule for '{}'", rule.selector()));
+}
+
+// Both the proto field names and the JSON ones are accepted
+const FieldDescriptor* FindField(const google::protobuf::Descriptor& descriptor,
+                                 std::string_view name) {
+  const std::string name_string{name};
+  const auto* field = descriptor.FindFieldByName(name_string);
+  return field ? field : descriptor.FindFieldByCamelcaseName(name_string);
+}
+
+// Returns the message owning the last field of the path
+Message* FindFieldOwner(Message& message, std::string_view field_path,
+                        const FieldDescriptor*& field) {
+  auto* owner = &message;
+  while (true) {
+    const auto dot = field_path.find('.');
+    field = FindField(*owner->GetDescriptor(), field_path.substr(0, dot));
+    if (!field) return nullptr;
+    if (dot == std::string_view::npos) return owner;
+
+    if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE ||
+        field->is_repeated()) {
+      return nullptr;
+    }
+    owner = owner->GetReflection()->MutableMessage(owner, field);
+    field_path.remove_prefix(dot + 1);
+  }
+}
+
+template <typename T>
+T ParseNumber(const FieldDescriptor& field, const std::string& value) {
+  try {
+    return utils::FromString<T>(value);
+  } catch (const std::exception&) {
+    throw HttpTranscodingError(fmt::format(
+        "Invalid value '{}' of the field '{}'", value, field.name()));
+  }
+}
+
+bool ParseBool(const FieldDescriptor& field, const std::string& value) {
+  if (value == "true" || value == "1") return true;
+  if (value == "false" || value == "0") return false;
+  throw HttpTranscodingError(fmt::format(
+      "Invalid boolean value '{}' of the field '{}'", value, field.name()));
+}
+
+int ParseEnum(const FieldDescriptor& field, const std::string& value) {
+  if (const auto* enum_value = field.enum_type()->FindValueByName(value)) {
+    return enum_value->number();
+  }
+  return ParseNumber<int>(field, value);
+}
+
+template <typename T>
+using ReflectionSetter = void (Reflection::*)(Message*, const FieldDescriptor*,
+                                              T) const;
+
+template <typename T>
+void SetOrAdd(Message& message, const FieldDescriptor& field, T value,
+              ReflectionSetter<T> setter, ReflectionSetter<T> adder) {
+  const auto& reflection = *message.GetReflection();
+  (reflection.*(field.is_repeated() ? adder : setter))(&message, &field,
+                                                       std::move(value));
+}
+
+void SetField(Message& message, std::string_view field_path,
+              const std::string& value) {
+  const FieldDescriptor* field = nullptr;
+  auto* owner = FindFieldOwner(message, field_path, field);
+  if (!owner) {
+    throw HttpTranscodingError(
+        fmt::format("Unknown field '{}' of '{}'", field_path,
+                    message.GetDescriptor()->full_name()));
+  }
+
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      return SetOrAdd(*owner, *field, ParseNumber<std::int32_t>(*field, value),
+                      &Reflection::SetInt32, &Reflection::AddInt32);
+    case FieldDescriptor::CPPTYPE_INT64:
+      return SetOrAdd(*owner, *field, ParseNumber<std::int64_t>(*field, value),
+                      &Reflection::SetInt64, &Reflection::AddInt64);
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return SetOrAdd(*owner, *field,
+                      ParseNumber<std::uint32_t>(*field, value),
+                      &Reflection::SetUInt32, &Reflection::AddUInt32);
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return SetOrAdd(*owner, *field,
+                      ParseNumber<std::uint64_t>(*field, value),
+                      &Reflection::SetUInt64, &Reflection::AddUInt64);
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      return SetOrAdd(*owner, *field, ParseNumber<double>(*field, value),
+                      &Reflection::SetDouble, &Reflection::AddDouble);
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      return SetOrAdd(*owner, *field, ParseNumber<float>(*field, value),
+                      &Reflection::SetFloat, &Reflection::AddFloat);
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return SetOrAdd(*owner, *field, ParseBool(*field, value),
+                      &Reflection::SetBool, &Reflection::AddBool);
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return SetOrAdd(*owner, *field, ParseEnum(*field, value),
+                      &Reflection::SetEnumValue, &Reflection::AddEnumValue);
+    case FieldDescriptor::CPPTYPE_STRING:
+      // bytes are base64-encoded in URLs as in JSON
+      return SetOrAdd(*owner, *field,
+                      field->type() == FieldDescriptor::TYPE_BYTES
+                          ? crypto::base64::Base64Decode(value)
+                          : value,
+                      &Reflection::SetString, &Reflection::AddString);
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      break;
+  }
+  throw HttpTranscodingError(fmt::format(
+      "The message field '{}' can't be set from the URL", field_path));
+}
+
+void ParseJson(std::string_view json, Message& message) {
+  const auto status = google::protobuf::util::JsonStringToMessage(
+      {json.data(), json.size()}, &message,
+      google::protobuf::util::JsonParseOptions{});
+  if (!status.ok()) {
+    throw HttpTranscodingError(
+        fmt::format("Invalid request body: {}", status.ToString()));
+  }
+}
+
+void CheckFieldPath(const google::protobuf::Descriptor& descriptor,
+                    std::string_view field_path) {
+  // FindFieldOwner creates the submessages, so the prototype can't be used
+  auto message = std::unique_ptr<Message>(GetPrototype(descriptor).New());
+  const FieldDescriptor* field = nullptr;
+  if (!FindFieldOwner(*message, field_path, field)) {
+    throw std::runtime_error(fmt::format("Unknown field '{}' of '{}'",
+                                         field_path, descriptor.full_name()));
+  }
+}
+
+}  // namespace
+
+HttpPathTemplate::HttpPathTemplate(std::string_view pattern) {
+  if (pattern.empty() || pattern.front() != '/') {
+    ThrowInvalidTemplate(pattern, "must start with '/'");
+  }
+
+  // The verb follows the last segment, it may not be a part of a variable
+  auto segments_end = pattern.size();
+  const auto verb_pos = pattern.rfind(':');
+  if (verb_pos != std::string_view::npos &&
+      pattern.find_first_of("/}", verb_pos) == std::string_view::npos) {
+    verb_ = pattern.substr(verb_pos + 1);
+    if (verb_.empty()) ThrowInvalidTemplate(pattern, "empty verb");
+    segments_end = verb_pos;
+  }
+
+  std::size_t pos = 1;
+  const auto segments = pattern.substr(0, segments_end);
+  ParseSegments(segments, pos, /*in_variable=*/false);
+  if (pos != segments.size()) {
+    ThrowInvalidTemplate(pattern,
+                         fmt::format("unexpected '{}'", segments[pos]));
+  }
+
+  for (std::size_t i = 0; i + 1 < segments_.size(); ++i) {
+    if (segments_[i].type == SegmentType::kMulti) {
+      ThrowInvalidTemplate(pattern, "'**' is allowed in the last segment only");
+    }
+  }
+}
+
+void HttpPathTemplate::ParseSegments(std::string_view pattern,
+                                     std::size_t& pos, bool in_variable) {
+  while (true) {
+    if (pos < pattern.size() && pattern[pos] == '{') {
+      if (in_variable) ThrowInvalidTemplate(pattern, "nested variables");
+      ++pos;
+      const auto field_end = pattern.find_first_of("=}", pos);
+      if (field_end == std::string_view::npos || field_end == pos) {
+        ThrowInvalidTemplate(pattern, "invalid variable");
+      }
+
+      Variable variable{std::string{pattern.substr(pos, field_end - pos)},
+                        segments_.size(), 0};
+      pos = field_end;
+      if (pattern[pos] == '=') {
+        ++pos;
+        ParseSegments(pattern, pos, /*in_variable=*/true);
+        if (pos == pattern.size() || pattern[pos] != '}') {
+          ThrowInvalidTemplate(pattern, "unterminated variable");
+        }
+      } else {
+        segments_.push_back({SegmentType::kSingle, {}});
+      }
+      ++pos;
+      variable.end = segments_.size();
+      variables_.push_back(std::move(variable));
+    } else {
+      const auto end =
+          std::min(pattern.find_first_of(in_variable ? "/}" : "/", pos),
+                   pattern.size());
+      const auto token = pattern.substr(pos, end - pos);
+      if (token.empty()) ThrowInvalidTemplate(pattern, "empty segment");
+      if (token.find_first_of("{}=") != std::string_view::npos) {
+        ThrowInvalidTemplate(pattern,
+                             fmt::format("invalid segment '{}'", token));
+      }
+
+      if (token == "*") {
+        segments_.push_back({SegmentType::kSingle, {}});
+      } else if (token == "**") {
+        segments_.push_back({SegmentType::kMulti, {}});
+      } else {
+        segments_.push_back({SegmentType::kLiteral, std::string{token}});
+      }
+      pos = end;
+    }
+
+    if (pos == pattern.size() || pattern[pos] != '/') return;
+    ++pos;
+  }
+}
+
+std::vector<std::string_view> HttpPathTemplate::GetFieldPaths() const {
+  std::vector<std::string_view> result;
+  result.reserve(variables_.size());
+  for (const auto& variable : variables_) result.push_back(variable.field_path);
+  return result;
+}
+
+std::optional<HttpFieldBindings> HttpPathTemplate::Match(
+    std::string_view path) const {
+  if (!verb_.empty()) {
+    if (path.size() <= verb_.size() || !utils::text::EndsWith(path, verb_) ||
+        path[path.size() - verb_.size() - 1] != ':') {
+      return std::nullopt;
+    }
+    path.remove_suffix(verb_.size() + 1);
+  }
+  if (path.empty() || path.front() != '/') return std::nullopt;
+  path.remove_prefix(1);
+
+  std::vector<std::string_view> parts;
+  while (true) {
+    const auto slash = path.find('/');
+    parts.push_back(path.substr(0, slash));
+    if (slash == std::string_view::npos) break;
+    path.remove_prefix(slash + 1);
+  }
+
+  const bool has_multi =
+      !segments_.empty() && segments_.back().type == SegmentType::kMulti;
+  const auto fixed_segments = segments_.size() - (has_multi ? 1 : 0);
+  if (has_multi ? parts.size() < fixed_segments
+                : parts.size() != fixed_segments) {
+    return std::nullopt;
+  }
+
+  for (std::size_t i = 0; i < fixed_segments; ++i) {
+    const auto& segment = segments_[i];
+    if (segment.type == SegmentType::kLiteral
+            ? parts[i] != segment.literal
+            : parts[i].empty()) {
+      return std::nullopt;
+    }
+  }
+
+  HttpFieldBindings bindings;
+  bindings.reserve(variables_.size());
+  for (const auto& variable : variables_) {
+    const auto end =
+        variable.end == segments_.size() ? parts.size() : variable.end;
+    std::string value;
+    for (auto i = variable.begin; i < end; ++i) {
+      if (i != variable.begin) value += '/';
+      value += http::parser::UrlDecode(parts[i]);
+    }
+    bindings.emplace_back(variable.field_path, std::move(value));
+  }
+  return bindings;
+}
+
+HttpRoute::HttpRoute(const google::protobuf::MethodDescriptor& method,
+                     const google::api::HttpRule& rule)
+    : HttpRoute(method, rule, GetMethodAndPath(rule)) {}
+
+HttpRoute::HttpRoute(const google::protobuf::MethodDescriptor& method,
+                     const google::api::HttpRule& rule,
+                     std::pair<std::string, std::string>&& method_and_path)
+    : request_prototype_(GetPrototype(*method.input_type())),
+      response_prototype_(GetPrototype(*method.output_type())),
+      call_name_(fmt::format("/{}/{}", method.service()->full_name(),
+                             method.name())),
+      http_method_(std::move(method_and_path.first)),
+      path_(method_and_path.second),
+      body_(rule.body()),
+      response_body_(rule.response_body()) {
+  if (!body_.empty() && body_ != "*") {
+    CheckFieldPath(*method.input_type(), body_);
+  }
+  for (const auto field_path : path_.GetFieldPaths()) {
+    CheckFieldPath(*method.input_type(), field_path);
+  }
+  if (!response_body_.empty()) {
+    CheckFieldPath(*method.output_type(), response_body_);
+  }
+}
+
+std::optional<HttpFieldBindings> HttpRoute::Match(
+    std::string_view http_method, std::string_view path) const {
+  if (http_method != http_method_) return std::nullopt;
+  return path_.Match(path);
+}
+
+std::unique_ptr<google::protobuf::Message> HttpRoute::MakeRequest(
+    const HttpFieldBindings& path_bindings, const HttpFieldBindings& query_args,
+    std::string_view body) const {
+  auto request = std::unique_ptr<Message>(request_prototype_.New());
+
+  // JSON parsing resets the message, so it goes first
+  if (body_ == "*") {
+    if (!body.empty()) ParseJson(body, *request);
+  } else if (!body_.empty() && !body.empty()) {
+    const auto* field = request->GetDescriptor()->FindFieldByName(body_);
+    UASSERT(field);
+    ParseJson(fmt::format("{{\"{}\":{}}}", field->json_name(), body), *request);
+  }
+
+  for (const auto& [field_path, value] : path_bindings) {
+    SetField(*request, field_path, value);
+  }
+
+  // All the fields are taken from the body with `body: "*"`
+  if (body_ != "*") {
+    for (const auto& [field_path, value] : query_args) {
+      const bool is_bound_by_path =
+          std::any_of(path_bindings.begin(), path_bindings.end(),
+                      [&](const auto& binding) {
+                        return binding.first == field_path;
+                      });
+      if (!is_bound_by_path) SetField(*request, field_path, value);
+    }
+  }
+  return request;
+}
+
+std::unique_ptr<google::protobuf::Message> HttpRoute::MakeResponse() const {
+  return std::unique_ptr<Message>(response_prototype_.New());
+}
+
+std::string HttpRoute::MakeResponseBody(
+    const google::protobuf::Message& response) const {
+  std::string json;
+  const auto status = google::protobuf::util::MessageToJsonString(
+      response, &json, google::protobuf::util::JsonPrintOptions{});
+  UINVARIANT(status.ok(), "Failed to serialize the response to JSON: " +
+                              status.ToString());
+  if (response_body_.empty()) return json;
+
+  const auto* field = response.GetDescriptor()->FindFieldByName(response_body_);
+  UASSERT(field);
+  const auto value = formats::json::FromString(json)[field->json_name()];
+  return value.IsMissing() ? std::string{} : formats::json::ToString(value);
+}
+
+std::vector<HttpRoute> MakeHttpRoutes(
+    const google::protobuf::ServiceDescriptor& service) {
+  std::vector<HttpRoute> routes;
+  for (int i = 0; i < service.method_count(); ++i) {
+    const auto& method = *service.method(i);
+    const auto& options = method.options();
+    if (!options.HasExtension(google::api::http)) continue;
+    if (method.client_streaming() || method.server_streaming()) {
+      throw std::runtime_error(
+          fmt::format("HTTP transcoding of the streaming method '{}' is not "
+                      "supported",
+                      method.full_name()));
+    }
+
+    const auto& rule = options.GetExtension(google::api::http);
+    routes.emplace_back(method, rule);
+    for (const auto& additional_rule : rule.additional_bindings()) {
+      routes.emplace_back(method, additional_rule);
+    }
+  }
+  return routes;
+}
+
+USERVER_NAMESPACE::server::http::HttpStatus ToHttpStatus(
+    grpc::StatusCode code) noexcept {
+  using USERVER_NAMESPACE::server::http::HttpStatus;
+  switch (code) {
+    case grpc::StatusCode::OK:
+      return HttpStatus::kOk;
+    case grpc::StatusCode::CANCELLED:
+      return HttpStatus::kClientClosedRequest;
+    case grpc::StatusCode::INVALID_ARGUMENT:
+    case grpc::StatusCode::FAILED_PRECONDITION:
+    case grpc::StatusCode::OUT_OF_RANGE:
+      return HttpStatus::kBadRequest;
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+      return HttpStatus::kGatewayTimeout;
+    case grpc::StatusCode::NOT_FOUND:
+      return HttpStatus::kNotFound;
+    case grpc::StatusCode::ALREADY_EXISTS:
+    case grpc::StatusCode::ABORTED:
+      return HttpStatus::kConflict;
+    case grpc::StatusCode::PERMISSION_DENIED:
+      return HttpStatus::kForbidden;
+    case grpc::StatusCode::UNAUTHENTICATED:
+      return HttpStatus::kUnauthorized;
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+      return HttpStatus::kTooManyRequests;
+    case grpc::StatusCode::UNIMPLEMENTED:
+      return HttpStatus::kNotImplemented;
+    case grpc::StatusCode::UNAVAILABLE:
+      return HttpStatus::kServiceUnavailable;
+    default:
+      return HttpStatus::kInternalServerError;
+  }
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
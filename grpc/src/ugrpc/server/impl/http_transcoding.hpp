@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <google/api/http.pb.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <grpcpp/support/status.h>
+
+#include <userver/server/http/http_status.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// Field path and value pairs
+using HttpFieldBindings = std::vector<std::pair<std::string, std::string>>;
+
+/// Thrown on a malformed HTTP request that can't be transcoded to protobuf
+class HttpTranscodingError final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/// A `google.api.http` path template, e.g. `/v1/{name=shelves/*}/books:list`
+class HttpPathTemplate final {
+ public:
+  /// @throws std::runtime_error on an invalid template
+  explicit HttpPathTemplate(std::string_view pattern);
+
+  /// @returns the values of the variables if the URL path matches
+  std::optional<HttpFieldBindings> Match(std::string_view path) const;
+
+  /// @returns the field paths of the variables
+  std::vector<std::string_view> GetFieldPaths() const;
+
+ private:
+  enum class SegmentType {
+    kLiteral,
+    kSingle,  // '*'
+    kMulti,   // '**', the last segment only
+  };
+
+  struct Segment final {
+    SegmentType type;
+    std::string literal;
+  };
+
+  struct Variable final {
+    std::string field_path;
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  void ParseSegments(std::string_view pattern, std::size_t& pos,
+                     bool in_variable);
+
+  std::vector<Segment> segments_;
+  std::vector<Variable> variables_;
+  std::string verb_;
+};
+
+/// An HTTP binding of a unary gRPC method
+class HttpRoute final {
+ public:
+  /// @throws std::runtime_error on an invalid rule
+  HttpRoute(const google::protobuf::MethodDescriptor& method,
+            const google::api::HttpRule& rule);
+
+  /// @returns the bindings of the path variables if the request matches
+  std::optional<HttpFieldBindings> Match(std::string_view http_method,
+                                         std::string_view path) const;
+
+  /// Builds the gRPC request from the HTTP request body, the path variables
+  /// and the query arguments
+  /// @throws HttpTranscodingError
+  std::unique_ptr<google::protobuf::Message> MakeRequest(
+      const HttpFieldBindings& path_bindings,
+      const HttpFieldBindings& query_args, std::string_view body) const;
+
+  /// Creates an empty response message to receive the gRPC response into
+  std::unique_ptr<google::protobuf::Message> MakeResponse() const;
+
+  /// Serializes the gRPC response (or its `response_body` field) to JSON
+  std::string MakeResponseBody(const google::protobuf::Message& response) const;
+
+  /// @returns the gRPC method name in the `/package.Service/Method` form
+  const std::string& GetCallName() const noexcept { return call_name_; }
+
+ private:
+  HttpRoute(const google::protobuf::MethodDescriptor& method,
+            const google::api::HttpRule& rule,
+            std::pair<std::string, std::string>&& method_and_path);
+
+  const google::protobuf::Message& request_prototype_;
+  const google::protobuf::Message& response_prototype_;
+  std::string call_name_;
+  std::string http_method_;
+  HttpPathTemplate path_;
+  std::string body_;
+  std::string response_body_;
+};
+
+/// @returns the routes of the unary methods of `service` annotated with
+/// `google.api.http` options, including the additional bindings
+std::vector<HttpRoute> MakeHttpRoutes(
+    const google::protobuf::ServiceDescriptor& service);
+
+/// Maps gRPC status codes to HTTP statuses as in `google/rpc/code.proto`
+USERVER_NAMESPACE::server::http::HttpStatus ToHttpStatus(
+    grpc::StatusCode code) noexcept;
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
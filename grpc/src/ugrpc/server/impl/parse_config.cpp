@@ -88,6 +88,9 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
   config.native_log_level =
       value["native-log-level"].As<logging::Level>(logging::Level::kError);
   config.enable_channelz = value["enable-channelz"].As<bool>(false);
+  config.completion_queue_count =
+      value["completion-queue-count"].As<std::size_t>(
+          config.completion_queue_count);
 
   const auto logger_name = value["access-tskv-logger"];
   if (!logger_name.IsMissing()) {
@@ -0,0 +1,89 @@
+#include <userver/ugrpc/server/middlewares/response_cache/component.hpp>
+
+#include <ugrpc/server/middlewares/response_cache/middleware.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::response_cache {
+
+namespace {
+
+Settings ParseSettings(const components::ComponentConfig& config) {
+  Settings settings;
+  settings.max_response_size = config["max-response-size"].As<std::size_t>(
+      settings.max_response_size);
+
+  for (const auto& [call_name, value] : Items(config["methods"])) {
+    MethodSettings method;
+    method.call_name = call_name;
+    method.ttl = value["ttl"].As<std::chrono::milliseconds>(method.ttl);
+    method.size = value["size"].As<std::size_t>(method.size);
+    method.metadata =
+        value["metadata"].As<std::vector<std::string>>(method.metadata);
+    settings.methods.push_back(std::move(method));
+  }
+  return settings;
+}
+
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config,
+                     const components::ComponentContext& context)
+    : MiddlewareComponentBase(config, context),
+      middleware_(std::make_shared<Middleware>(ParseSettings(config))) {}
+
+Component::~Component() = default;
+
+std::shared_ptr<MiddlewareBase> Component::GetMiddleware() {
+  return middleware_;
+}
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<MiddlewareComponentBase>(R"(
+type: object
+description: gRPC service response cache middleware component
+additionalProperties: false
+properties:
+    methods:
+        type: object
+        description: |
+            cached methods by the full name of the method, e.g.
+            'package.Service/Method'. Only the idempotent unary methods
+            should be cached.
+        properties: {}
+        additionalProperties:
+            type: object
+            description: caching options of the method
+            additionalProperties: false
+            properties:
+                ttl:
+                    type: string
+                    description: lifetime of a cached response
+                    defaultDescription: 1s
+                size:
+                    type: integer
+                    description: maximum count of the cached responses
+                    defaultDescription: 1000
+                    minimum: 1
+                metadata:
+                    type: array
+                    description: |
+                        client metadata keys that distinguish the responses
+                        besides the request
+                    defaultDescription: '[]'
+                    items:
+                        type: string
+                        description: metadata key
+    max-response-size:
+        type: integer
+        description: the greater responses (in bytes) are not cached
+        defaultDescription: 1048576
+)");
+}
+
+}  // namespace ugrpc::server::middlewares::response_cache
+
+USERVER_NAMESPACE_END
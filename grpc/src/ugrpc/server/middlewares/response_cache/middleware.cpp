@@ -0,0 +1,104 @@
+#include "middleware.hpp"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::response_cache {
+
+namespace {
+
+constexpr std::size_t kCacheWays = 4;
+
+void AppendWithSize(std::string& key, std::string_view value) {
+  key += std::to_string(value.size());
+  key += ':';
+  key += value;
+}
+
+std::string MakeKey(const google::protobuf::Message& request,
+                    const grpc::ServerContext& context,
+                    const std::vector<std::string>& metadata_keys) {
+  std::string key;
+  const auto& metadata = context.client_metadata();
+  for (const auto& metadata_key : metadata_keys) {
+    const auto it = metadata.find(metadata_key);
+    if (it == metadata.end()) {
+      key += '-';
+    } else {
+      AppendWithSize(key, {it->second.data(), it->second.size()});
+    }
+  }
+
+  // the order of the map fields is not defined for the default serialization
+  google::protobuf::io::StringOutputStream stream(&key);
+  google::protobuf::io::CodedOutputStream coded_stream(&stream);
+  coded_stream.SetSerializationDeterministic(true);
+  request.SerializeToCodedStream(&coded_stream);
+  coded_stream.Trim();
+  return key;
+}
+
+}  // namespace
+
+Middleware::MethodCache::MethodCache(const MethodSettings& settings)
+    : settings(settings),
+      cache(kCacheWays, std::max<std::size_t>(
+                            (settings.size + kCacheWays - 1) / kCacheWays, 1)) {
+  cache.SetMaxLifetime(settings.ttl);
+}
+
+Middleware::Middleware(const Settings& settings)
+    : max_response_size_(settings.max_response_size) {
+  caches_.reserve(settings.methods.size());
+  for (const auto& method : settings.methods) {
+    caches_.push_back(std::make_unique<MethodCache>(method));
+  }
+}
+
+Middleware::~Middleware() = default;
+
+void Middleware::Handle(MiddlewareCallContext& context) const {
+  const auto* request = context.GetInitialRequest();
+  auto& call = context.GetCall();
+  auto* method_cache = request ? FindCache(call.GetCallName()) : nullptr;
+  if (!method_cache) {
+    context.Next();
+    return;
+  }
+
+  auto key = MakeKey(*request, call.GetContext(),
+                     method_cache->settings.metadata);
+  if (const auto response = method_cache->cache.GetOptionalNoUpdate(key)) {
+    if (call.FinishWithResponse(**response)) return;
+    UASSERT_MSG(false, "Response cache is only usable with unary methods");
+  }
+
+  call.SetResponseHook([this, method_cache, key = std::move(key)](
+                           const google::protobuf::Message& response) {
+    if (response.ByteSizeLong() > max_response_size_) return;
+    std::shared_ptr<google::protobuf::Message> copy(response.New());
+    copy->CopyFrom(response);
+    method_cache->cache.Put(key, std::move(copy));
+  });
+  context.Next();
+}
+
+Middleware::MethodCache* Middleware::FindCache(
+    std::string_view call_name) const {
+  // there are few cached methods, a linear search does not allocate a key
+  const auto it = std::find_if(
+      caches_.begin(), caches_.end(), [call_name](const auto& method_cache) {
+        return method_cache->settings.call_name == call_name;
+      });
+  return it == caches_.end() ? nullptr : it->get();
+}
+
+}  // namespace ugrpc::server::middlewares::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::response_cache {
+
+struct MethodSettings final {
+  /// Full name of the method, e.g. 'package.Service/Method'
+  std::string call_name;
+  std::chrono::milliseconds ttl{std::chrono::seconds{1}};
+  std::size_t size{1000};
+  /// Client metadata keys that are the part of the cache key besides the
+  /// request
+  std::vector<std::string> metadata;
+};
+
+struct Settings final {
+  std::vector<MethodSettings> methods;
+  /// The greater responses are not cached
+  std::size_t max_response_size{1024 * 1024};
+};
+
+/// Caches the responses of the idempotent unary methods by the serialized
+/// request and the selected metadata, a hit finishes the call with the cached
+/// response without calling the handler
+class Middleware final : public MiddlewareBase {
+ public:
+  explicit Middleware(const Settings& settings);
+  ~Middleware() override;
+
+  void Handle(MiddlewareCallContext& context) const override;
+
+ private:
+  using Response = std::shared_ptr<const google::protobuf::Message>;
+
+  struct MethodCache final {
+    explicit MethodCache(const MethodSettings& settings);
+
+    const MethodSettings settings;
+    cache::ExpirableLruCache<std::string, Response> cache;
+  };
+
+  MethodCache* FindCache(std::string_view call_name) const;
+
+  const std::size_t max_response_size_;
+  std::vector<std::unique_ptr<MethodCache>> caches_;
+};
+
+}  // namespace ugrpc::server::middlewares::response_cache
+
+USERVER_NAMESPACE_END
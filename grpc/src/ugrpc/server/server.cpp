@@ -85,6 +85,8 @@ class Server::Impl final {
 
   int GetPort() const noexcept;
 
+  std::shared_ptr<grpc::Channel> GetInProcessChannel() const;
+
   void Stop() noexcept;
 
   void StopDebug() noexcept;
@@ -104,8 +106,9 @@ class Server::Impl final {
   std::optional<grpc::ServerBuilder> server_builder_;
   std::optional<int> port_;
   std::vector<std::unique_ptr<impl::ServiceWorker>> service_workers_;
-  std::optional<impl::QueueHolder> queue_;
+  std::vector<std::unique_ptr<impl::QueueHolder>> queues_;
   std::unique_ptr<grpc::Server> server_;
+  std::shared_ptr<grpc::Channel> in_process_channel_;
   mutable engine::Mutex configuration_mutex_;
 
   ugrpc::impl::StatisticsStorage statistics_storage_;
@@ -131,7 +134,13 @@ Server::Impl::Impl(ServerConfig&& config,
   }
   server_builder_.emplace();
   ApplyChannelArgs(*server_builder_, config);
-  queue_.emplace(server_builder_->AddCompletionQueue());
+  UINVARIANT(config.completion_queue_count > 0,
+             "completion-queue-count must be positive");
+  queues_.reserve(config.completion_queue_count);
+  for (std::size_t i = 0; i < config.completion_queue_count; ++i) {
+    queues_.push_back(std::make_unique<impl::QueueHolder>(
+        server_builder_->AddCompletionQueue()));
+  }
   if (config.port) AddListeningPort(*config.port);
 }
 
@@ -162,8 +171,12 @@ void Server::Impl::AddService(ServiceBase& service, ServiceConfig&& config) {
   const std::lock_guard lock(configuration_mutex_);
   UASSERT(state_ == State::kConfiguration);
 
+  std::vector<grpc::ServerCompletionQueue*> queues;
+  queues.reserve(queues_.size());
+  for (const auto& queue : queues_) queues.push_back(&queue->GetQueue());
+
   service_workers_.push_back(service.MakeWorker(impl::ServiceSettings{
-      queue_->GetQueue(),
+      std::move(queues),
       config.task_processor,
       statistics_storage_,
       std::move(config.middlewares),
@@ -193,7 +206,7 @@ void Server::Impl::WithServerBuilder(SetupHook&& setup) {
 
 grpc::CompletionQueue& Server::Impl::GetCompletionQueue() noexcept {
   UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
-  return queue_->GetQueue();
+  return queues_.front()->GetQueue();
 }
 
 void Server::Impl::Start() {
@@ -216,19 +229,25 @@ int Server::Impl::GetPort() const noexcept {
   return *port_;
 }
 
+std::shared_ptr<grpc::Channel> Server::Impl::GetInProcessChannel() const {
+  std::lock_guard lock(configuration_mutex_);
+  return in_process_channel_;
+}
+
 void Server::Impl::Stop() noexcept {
   // Note 1: Stop must be idempotent, so that the 'Stop' invocation after a
   // 'Start' failure is optional.
   // Note 2: 'state_' remains 'kActive' while stopping, which allows clients to
-  // finish their requests using 'queue_'.
+  // finish their requests using 'queues_'.
 
   // Must shutdown server, then ServiceWorkers, then queues before anything else
   if (server_) {
     LOG_INFO() << "Stopping the gRPC server";
     server_->Shutdown();
   }
+  in_process_channel_.reset();
   service_workers_.clear();
-  queue_.reset();
+  queues_.clear();
   server_.reset();
 
   state_ = State::kStopped;
@@ -253,6 +272,7 @@ void Server::Impl::DoStart() {
   server_ = server_builder_->BuildAndStart();
   UINVARIANT(server_, "See grpcpp logs for details");
   server_builder_.reset();
+  in_process_channel_ = server_->InProcessChannel({});
 
   for (auto& worker : service_workers_) {
     worker->Start();
@@ -293,6 +313,10 @@ void Server::Start() { return impl_->Start(); }
 
 int Server::GetPort() const noexcept { return impl_->GetPort(); }
 
+std::shared_ptr<grpc::Channel> Server::GetInProcessChannel() const {
+  return impl_->GetInProcessChannel();
+}
+
 void Server::Stop() noexcept { return impl_->Stop(); }
 
 void Server::StopDebug() noexcept { return impl_->StopDebug(); }
@@ -71,6 +71,11 @@ properties:
     enable-channelz:
         type: boolean
         description: enable channelz
+    completion-queue-count:
+        type: integer
+        description: number of completion queues, each one is polled by a separate thread
+        defaultDescription: 1
+        minimum: 1
     service-defaults:
         type: object
         description: omitted options for service components will default to the corresponding option from here
@@ -346,4 +346,100 @@ UTEST_F(GrpcWriteAndFinish, BidirectionalStream) {
   EXPECT_FALSE(is.Read(in));
 }
 
+namespace {
+
+class BatchedWritesService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    call.SetWriteBatchSize(10);
+    sample::ugrpc::StreamGreetingResponse response;
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+}  // namespace
+
+using GrpcBatchedWrites = ugrpc::tests::ServiceFixture<BatchedWritesService>;
+
+UTEST_F(GrpcBatchedWrites, InputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_number(kNumber);
+  auto is = client.ReadMany(out);
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kNumber; ++i) {
+    ASSERT_TRUE(is.Read(in));
+    EXPECT_EQ(in.number(), i);
+  }
+  EXPECT_FALSE(is.Read(in));
+}
+
+UTEST_F(GrpcBatchedWrites, BidirectionalStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto bs = client.Chat();
+  bs.SetWriteBatchSize(10);
+
+  sample::ugrpc::StreamGreetingRequest out;
+  for (int i = 0; i < kNumber; ++i) {
+    out.set_number(i);
+    EXPECT_TRUE(bs.Write(out));
+  }
+  // flushes the buffered writes
+  EXPECT_TRUE(bs.WritesDone());
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kNumber; ++i) {
+    ASSERT_TRUE(bs.Read(in));
+    EXPECT_EQ(in.number(), i);
+  }
+  EXPECT_FALSE(bs.Read(in));
+}
+
+namespace {
+
+class ArenaService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    EXPECT_EQ(request.GetArena(), &call.GetArena());
+
+    auto* response =
+        google::protobuf::Arena::CreateMessage<sample::ugrpc::GreetingResponse>(
+            &call.GetArena());
+    // larger than the initial block of the arena
+    response->set_name("Hello " + request.name() + std::string(4096, '!'));
+    call.Finish(*response);
+  }
+};
+
+}  // namespace
+
+using GrpcArena = ugrpc::tests::ServiceFixture<ArenaService>;
+
+UTEST_F(GrpcArena, UnaryRPC) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest out;
+  out.set_name("userver");
+
+  sample::ugrpc::GreetingResponse in;
+  UEXPECT_NO_THROW(in = client.SayHello(out).Finish());
+  EXPECT_EQ(in.name(), "Hello userver" + std::string(4096, '!'));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::client::LoadBalancingConfig;
+using ugrpc::client::LoadBalancingPolicy;
+using ugrpc::client::impl::ChannelBalancer;
+
+LoadBalancingConfig MakeEjectionConfig() {
+  LoadBalancingConfig config;
+  config.outlier_ejection.enabled = true;
+  config.outlier_ejection.min_requests = 10;
+  config.outlier_ejection.interval = 100ms;
+  config.outlier_ejection.ejection_time = 10s;
+  return config;
+}
+
+}  // namespace
+
+TEST(ChannelBalancer, IsNeeded) {
+  LoadBalancingConfig config;
+  EXPECT_FALSE(ChannelBalancer::IsNeeded(4, config));
+
+  config.policy = LoadBalancingPolicy::kLeastRequest;
+  EXPECT_TRUE(ChannelBalancer::IsNeeded(4, config));
+  EXPECT_FALSE(ChannelBalancer::IsNeeded(1, config));
+
+  EXPECT_TRUE(ChannelBalancer::IsNeeded(4, MakeEjectionConfig()));
+}
+
+TEST(ChannelBalancer, LeastRequest) {
+  LoadBalancingConfig config;
+  config.policy = LoadBalancingPolicy::kLeastRequest;
+  const auto balancer = std::make_shared<ChannelBalancer>(2, config);
+
+  constexpr std::size_t kCalls = 1000;
+  std::vector<ChannelBalancer::Lease> leases(kCalls);
+  std::size_t first_channel_calls = 0;
+  for (auto& lease : leases) {
+    if (balancer->Pick(lease) == 0) ++first_channel_calls;
+  }
+
+  // the calls in flight are spread evenly
+  EXPECT_GT(first_channel_calls, kCalls / 2 - kCalls / 10);
+  EXPECT_LT(first_channel_calls, kCalls / 2 + kCalls / 10);
+}
+
+UTEST(ChannelBalancer, EjectsFailingChannel) {
+  const auto balancer =
+      std::make_shared<ChannelBalancer>(2, MakeEjectionConfig());
+
+  for (int i = 0; i < 100; ++i) {
+    ChannelBalancer::Lease lease;
+    const auto index = balancer->Pick(lease);
+    lease.Finish(/*is_failure=*/index == 0);
+  }
+  EXPECT_FALSE(balancer->IsEjected(0));
+
+  engine::SleepFor(150ms);
+  for (int i = 0; i < 20; ++i) {
+    ChannelBalancer::Lease lease;
+    EXPECT_EQ(balancer->Pick(lease), std::size_t{1});
+  }
+  EXPECT_TRUE(balancer->IsEjected(0));
+  EXPECT_FALSE(balancer->IsEjected(1));
+}
+
+UTEST(ChannelBalancer, KeepsChannelsAvailable) {
+  const auto balancer =
+      std::make_shared<ChannelBalancer>(2, MakeEjectionConfig());
+
+  for (int i = 0; i < 100; ++i) {
+    ChannelBalancer::Lease lease;
+    balancer->Pick(lease);
+    lease.Finish(/*is_failure=*/true);
+  }
+
+  engine::SleepFor(150ms);
+  ChannelBalancer::Lease lease;
+  balancer->Pick(lease);
+  // at most 50% of the channels are ejected
+  EXPECT_NE(balancer->IsEjected(0), balancer->IsEjected(1));
+}
+
+USERVER_NAMESPACE_END
@@ -96,6 +96,47 @@ UTEST_P_MT(GrpcChannels, TryWaitForConnected, 2) {
   server.Stop();
 }
 
+UTEST_P_MT(GrpcChannels, Prewarm, 2) {
+  utils::statistics::Storage statistics_storage;
+  dynamic_config::StorageMock config_storage{
+      dynamic_config::MakeDefaultStorage({})};
+
+  UnitTestServiceSimple service;
+  ugrpc::server::Server server(MakeServerConfig(), statistics_storage,
+                               config_storage.GetSource());
+  server.AddService(service, {engine::current_task::GetTaskProcessor(),
+                              ugrpc::server::Middlewares{}});
+  server.Start();
+
+  {
+    ugrpc::client::ClientFactoryConfig config;
+    config.channel_count = GetParam();
+    config.prewarm_channels = true;
+    config.prewarm_timeout = 5s;
+    ugrpc::client::QueueHolder client_queue;
+
+    testsuite::GrpcControl ts({}, false);
+    ugrpc::client::MiddlewareFactories mws;
+    ugrpc::client::ClientFactory client_factory(
+        std::move(config), engine::current_task::GetTaskProcessor(), mws,
+        client_queue.GetQueue(), statistics_storage, ts,
+        config_storage.GetSource());
+
+    auto client =
+        client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>(
+            "test", fmt::format("[::1]:{}", kPort));
+
+    // All the channels are connected before the first call
+    auto& token = ugrpc::client::impl::GetClientData(client).GetChannelToken();
+    ASSERT_EQ(token.GetChannelCount(), GetParam());
+    for (std::size_t i = 0; i < token.GetChannelCount(); ++i) {
+      EXPECT_EQ(token.GetChannel(i)->GetState(false), ::GRPC_CHANNEL_READY);
+    }
+  }
+
+  server.Stop();
+}
+
 INSTANTIATE_UTEST_SUITE_P(Basic, GrpcChannels,
                           ::testing::Values(std::size_t{1}, std::size_t{4}));
 
@@ -0,0 +1,82 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+#include <userver/ugrpc/client/client_factory.hpp>
+#include <userver/ugrpc/server/server.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kQueueCount = 4;
+constexpr std::size_t kCallCount = 100;
+
+class UnitTestServiceEcho final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+};
+
+}  // namespace
+
+UTEST_MT(GrpcServer, MultipleCompletionQueues, 4) {
+  utils::statistics::Storage statistics_storage;
+  dynamic_config::StorageMock config_storage{
+      dynamic_config::MakeDefaultStorage({})};
+
+  ugrpc::server::ServerConfig server_config;
+  server_config.port = 0;
+  server_config.completion_queue_count = kQueueCount;
+
+  UnitTestServiceEcho service;
+  ugrpc::server::Server server(std::move(server_config), statistics_storage,
+                               config_storage.GetSource());
+  server.AddService(service, {engine::current_task::GetTaskProcessor(),
+                              ugrpc::server::Middlewares{}});
+  server.Start();
+
+  {
+    testsuite::GrpcControl ts({}, false);
+    ugrpc::client::ClientFactory client_factory(
+        {}, engine::current_task::GetTaskProcessor(), {},
+        server.GetCompletionQueue(), statistics_storage, ts,
+        config_storage.GetSource());
+    auto client =
+        client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>(
+            "test", fmt::format("[::1]:{}", server.GetPort()));
+
+    // more concurrent calls than the listeners of a single queue
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kCallCount);
+    for (std::size_t i = 0; i < kCallCount; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&client, i] {
+        sample::ugrpc::GreetingRequest request;
+        request.set_name(std::to_string(i));
+        auto call = client.SayHello(std::move(request));
+        EXPECT_EQ(call.Finish().name(), "Hello " + std::to_string(i));
+      }));
+    }
+    for (auto& task : tasks) task.Get();
+  }
+
+  server.Stop();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,108 @@
+#include <ugrpc/server/impl/http_transcoding.hpp>
+
+#include <google/protobuf/descriptor.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <tests/messages.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::server::impl::HttpFieldBindings;
+using ugrpc::server::impl::HttpPathTemplate;
+using ugrpc::server::impl::HttpRoute;
+using ugrpc::server::impl::HttpTranscodingError;
+
+const google::protobuf::MethodDescriptor& GetMethod(const std::string& name) {
+  const auto* service =
+      google::protobuf::DescriptorPool::generated_pool()->FindServiceByName(
+          "sample.ugrpc.UnitTestService");
+  UINVARIANT(service, "The test service is not linked");
+  const auto* method = service->FindMethodByName(name);
+  UINVARIANT(method, "Unknown method");
+  return *method;
+}
+
+}  // namespace
+
+TEST(HttpPathTemplate, Match) {
+  const HttpPathTemplate path{"/v1/{name=shelves/*}/books/{book}:list"};
+  EXPECT_EQ(path.Match("/v1/shelves/s1/books/b%201:list"),
+            (HttpFieldBindings{{"name", "shelves/s1"}, {"book", "b 1"}}));
+  EXPECT_EQ(path.Match("/v1/shelves/s1/books/b1"), std::nullopt);
+  EXPECT_EQ(path.Match("/v1/racks/s1/books/b1:list"), std::nullopt);
+  EXPECT_EQ(path.Match("/v1/shelves/s1/books/:list"), std::nullopt);
+  EXPECT_EQ(path.Match("/v1/shelves/s1/books/b1/x:list"), std::nullopt);
+}
+
+TEST(HttpPathTemplate, MultiSegment) {
+  const HttpPathTemplate path{"/files/{path=**}"};
+  EXPECT_EQ(path.Match("/files/a/b/c"), (HttpFieldBindings{{"path", "a/b/c"}}));
+  EXPECT_EQ(path.Match("/files"), (HttpFieldBindings{{"path", ""}}));
+  EXPECT_EQ(path.Match("/other/a"), std::nullopt);
+}
+
+TEST(HttpPathTemplate, Invalid) {
+  EXPECT_THROW(HttpPathTemplate{"v1/books"}, std::runtime_error);
+  EXPECT_THROW(HttpPathTemplate{"/v1//books"}, std::runtime_error);
+  EXPECT_THROW(HttpPathTemplate{"/v1/{name"}, std::runtime_error);
+  EXPECT_THROW(HttpPathTemplate{"/v1/{a={b}}"}, std::runtime_error);
+  EXPECT_THROW(HttpPathTemplate{"/v1/**/books"}, std::runtime_error);
+  EXPECT_THROW(HttpPathTemplate{"/v1/books:"}, std::runtime_error);
+}
+
+TEST(HttpRoute, PathAndQuery) {
+  google::api::HttpRule rule;
+  rule.set_get("/v1/greetings/{name}");
+  const HttpRoute route{GetMethod("ReadMany"), rule};
+  EXPECT_EQ(route.GetCallName(), "/sample.ugrpc.UnitTestService/ReadMany");
+
+  const auto bindings = route.Match("GET", "/v1/greetings/userver");
+  ASSERT_TRUE(bindings);
+  EXPECT_EQ(route.Match("POST", "/v1/greetings/userver"), std::nullopt);
+
+  const auto request = route.MakeRequest(
+      *bindings, {{"number", "42"}, {"name", "ignored"}}, {});
+  sample::ugrpc::StreamGreetingRequest expected;
+  expected.set_name("userver");
+  expected.set_number(42);
+  EXPECT_EQ(request->SerializeAsString(), expected.SerializeAsString());
+
+  EXPECT_THROW(route.MakeRequest(*bindings, {{"number", "x"}}, {}),
+               HttpTranscodingError);
+  EXPECT_THROW(route.MakeRequest(*bindings, {{"unknown", "1"}}, {}),
+               HttpTranscodingError);
+}
+
+TEST(HttpRoute, Body) {
+  google::api::HttpRule rule;
+  rule.set_post("/v1/greetings/{name}");
+  rule.set_body("*");
+  rule.set_response_body("name");
+  const HttpRoute route{GetMethod("SayHello"), rule};
+
+  const auto bindings = route.Match("POST", "/v1/greetings/path");
+  ASSERT_TRUE(bindings);
+  const auto request = route.MakeRequest(*bindings, {{"name", "query"}},
+                                         R"({"name": "body"})");
+  EXPECT_EQ(static_cast<const sample::ugrpc::GreetingRequest&>(*request).name(),
+            "path");
+  EXPECT_THROW(route.MakeRequest(*bindings, {}, "{"), HttpTranscodingError);
+
+  sample::ugrpc::GreetingResponse response;
+  response.set_name("userver");
+  EXPECT_EQ(route.MakeResponseBody(response), R"("userver")");
+}
+
+TEST(HttpRoute, InvalidRule) {
+  google::api::HttpRule rule;
+  EXPECT_THROW((HttpRoute{GetMethod("SayHello"), rule}), std::runtime_error);
+
+  rule.set_get("/v1/greetings/{unknown}");
+  EXPECT_THROW((HttpRoute{GetMethod("SayHello"), rule}), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
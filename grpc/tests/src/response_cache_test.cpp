@@ -0,0 +1,87 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+
+#include <ugrpc/server/middlewares/response_cache/middleware.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class CountingService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    const auto calls = ++calls_;
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(request.name() + std::to_string(calls));
+    call.Finish(response);
+  }
+
+  int GetCalls() const { return calls_; }
+
+ private:
+  std::atomic<int> calls_{0};
+};
+
+ugrpc::server::middlewares::response_cache::Settings MakeSettings() {
+  ugrpc::server::middlewares::response_cache::MethodSettings method;
+  method.call_name = "sample.ugrpc.UnitTestService/SayHello";
+  method.ttl = std::chrono::seconds{10};
+  method.metadata = {"x-tenant"};
+  return {{method}, 1024};
+}
+
+class GrpcResponseCache : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcResponseCache() {
+    AddServerMiddleware(std::make_shared<
+                        ugrpc::server::middlewares::response_cache::Middleware>(
+        MakeSettings()));
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~GrpcResponseCache() override { StopServer(); }
+
+  std::string SayHello(const std::string& name, const std::string& tenant) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(name);
+    auto context = std::make_unique<grpc::ClientContext>();
+    context->AddMetadata("x-tenant", tenant);
+    return client.SayHello(request, std::move(context)).Finish().name();
+  }
+
+  CountingService& GetService() { return service_; }
+
+ private:
+  CountingService service_;
+};
+
+}  // namespace
+
+UTEST_F(GrpcResponseCache, CachesResponses) {
+  EXPECT_EQ(SayHello("a", "t1"), "a1");
+  EXPECT_EQ(SayHello("a", "t1"), "a1");
+  EXPECT_EQ(GetService().GetCalls(), 1);
+
+  EXPECT_EQ(SayHello("b", "t1"), "b2");
+  EXPECT_EQ(SayHello("a", "t2"), "a3");
+  EXPECT_EQ(SayHello("a", "t2"), "a3");
+  EXPECT_EQ(GetService().GetCalls(), 3);
+}
+
+UTEST_F(GrpcResponseCache, SkipsLargeResponses) {
+  const std::string name(2048, 'x');
+  EXPECT_EQ(SayHello(name, "t1"), name + "1");
+  EXPECT_EQ(SayHello(name, "t1"), name + "2");
+  EXPECT_EQ(GetService().GetCalls(), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,9 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,12 +14,15 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
+#include <userver/storages/mongo/prefetching_cursor.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
@@ -34,7 +40,43 @@ namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
-}
+std::size_t GetMongoCachePrefetchChunkSize(const ComponentConfig&);
+
+bool IsMongoCacheChangeStreamEnabled(const ComponentConfig&);
+
+/// Tails the change stream of the cache collection in background
+class MongoCacheChangeStream final {
+ public:
+  MongoCacheChangeStream(std::string cache_name,
+                         storages::mongo::Collection collection,
+                         bool is_secondary_preferred);
+  ~MongoCacheChangeStream();
+
+  /// @brief Opens a new change stream, drops the buffered changes
+  /// @note Must be called before reading the collection, so that no changes
+  /// are missed.
+  void Restart();
+
+  /// @returns the changed documents buffered since the previous call, nullopt
+  /// if the stream is lost and some changes might have been missed
+  std::optional<std::vector<formats::bson::Document>> ExtractChanges();
+
+ private:
+  struct State {
+    std::vector<formats::bson::Document> changes;
+    bool is_lost{true};
+  };
+
+  void Watch(storages::mongo::ChangeStream stream);
+
+  const std::string cache_name_;
+  const storages::mongo::Collection collection_;
+  const bool is_secondary_preferred_;
+  concurrent::Variable<State> state_;
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace impl
 
 // clang-format off
 
@@ -49,6 +91,14 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// prefetch-chunk-size | if non-zero, the documents are read by chunks of this size with the next chunk fetched in background while the current one is parsed, see storages::mongo::PrefetchingCursor | 0
+/// change-stream | apply the changes from the collection change stream on incremental updates instead of querying the collection, requires a replica set | false
+///
+/// With `change-stream` enabled the stream is tailed in background and the
+/// inserted, replaced and updated documents are applied on incremental updates.
+/// Deletions are ignored, the same as for polling. When the stream is lost,
+/// e.g. after a restart or a server error, it is reopened and the update falls
+/// back to polling or to a full update if the traits have no means of polling.
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -136,6 +186,14 @@ class MongoCache
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  void ProcessDocument(const formats::bson::Document& doc,
+                       cache::UpdateType type,
+                       typename MongoCacheTraits::DataType& new_cache,
+                       cache::UpdateStatisticsScope& stats_scope) const;
+
+  void ApplyChanges(const std::vector<formats::bson::Document>& changes,
+                    cache::UpdateStatisticsScope& stats_scope);
+
   typename MongoCacheTraits::ObjectType DeserializeObject(
       const formats::bson::Document& doc) const;
 
@@ -151,7 +209,9 @@ class MongoCache
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const std::size_t prefetch_chunk_size_;
   std::size_t cpu_relax_iterations_{0};
+  std::unique_ptr<impl::MongoCacheChangeStream> change_stream_;
 };
 
 template <class MongoCacheTraits>
@@ -169,13 +229,27 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      prefetch_chunk_size_(impl::GetMongoCachePrefetchChunkSize(config)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
-  if (CachingComponentBase<
-          typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
-          cache::AllowedUpdateTypes::kFullAndIncremental &&
+  const auto allowed_update_types = CachingComponentBase<
+      typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes();
+  if (impl::IsMongoCacheChangeStreamEnabled(config)) {
+    if (allowed_update_types == cache::AllowedUpdateTypes::kOnlyFull) {
+      throw std::logic_error(
+          "Change stream is requested in config for '" +
+          components::GetCurrentComponentName(config) +
+          "' cache, but incremental updates are disabled");
+    }
+    change_stream_ = std::make_unique<impl::MongoCacheChangeStream>(
+        std::string{kName}, *mongo_collection_,
+        MongoCacheTraits::kIsSecondaryPreferred);
+  }
+
+  if (allowed_update_types == cache::AllowedUpdateTypes::kFullAndIncremental &&
+      !change_stream_ &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
       !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
     throw std::logic_error(
@@ -206,6 +280,24 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  if (change_stream_) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (auto changes = change_stream_->ExtractChanges()) {
+        ApplyChanges(*changes, stats_scope);
+        return;
+      }
+      LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                    << " is lost, reopening";
+    }
+
+    change_stream_->Restart();
+    if constexpr (!mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
+                  !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+      // the missed changes cannot be polled
+      type = cache::UpdateType::kFull;
+    }
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -225,33 +317,21 @@ void MongoCache<MongoCacheTraits>::Update(
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
   std::size_t doc_count = 0;
 
-  for (const auto& doc : cursor) {
+  const auto process = [&](const formats::bson::Document& doc) {
     ++doc_count;
-
     relax.Relax();
-
-    stats_scope.IncreaseDocumentsReadCount(1);
-
-    try {
-      auto object = DeserializeObject(doc);
-      auto key = (object.*MongoCacheTraits::kKeyField);
-
-      if (type == cache::UpdateType::kIncremental ||
-          new_cache->count(key) == 0) {
-        (*new_cache)[key] = std::move(object);
-      } else {
-        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
-                            << MongoCacheTraits::kName << ", key=" << key;
-      }
-    } catch (const std::exception& e) {
-      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
-                          << MongoCacheTraits::kName << ", _id="
-                          << doc["_id"].template ConvertTo<std::string>()
-                          << ", what(): " << e;
-      stats_scope.IncreaseDocumentsParseFailures(1);
-
-      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    ProcessDocument(doc, type, *new_cache, stats_scope);
+  };
+
+  if (prefetch_chunk_size_) {
+    sm::PrefetchingCursor prefetching_cursor(std::move(cursor),
+                                             prefetch_chunk_size_);
+    for (auto chunk = prefetching_cursor.NextChunk(); !chunk.empty();
+         chunk = prefetching_cursor.NextChunk()) {
+      for (const auto& doc : chunk) process(doc);
     }
+  } else {
+    for (const auto& doc : cursor) process(doc);
   }
 
   const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
@@ -271,6 +351,59 @@ void MongoCache<MongoCacheTraits>::Update(
   stats_scope.Finish(size);
 }
 
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ApplyChanges(
+    const std::vector<formats::bson::Document>& changes,
+    cache::UpdateStatisticsScope& stats_scope) {
+  if (changes.empty()) {
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return;
+  }
+
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+
+  scope.Reset(kFetchAndParseStage);
+  for (const auto& doc : changes) {
+    ProcessDocument(doc, cache::UpdateType::kIncremental, *new_cache,
+                    stats_scope);
+  }
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ProcessDocument(
+    const formats::bson::Document& doc, cache::UpdateType type,
+    typename MongoCacheTraits::DataType& new_cache,
+    cache::UpdateStatisticsScope& stats_scope) const {
+  stats_scope.IncreaseDocumentsReadCount(1);
+
+  try {
+    auto object = DeserializeObject(doc);
+    auto key = (object.*MongoCacheTraits::kKeyField);
+
+    if (type == cache::UpdateType::kIncremental || new_cache.count(key) == 0) {
+      new_cache[key] = std::move(object);
+    } else {
+      LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                          << MongoCacheTraits::kName << ", key=" << key;
+    }
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                        << MongoCacheTraits::kName << ", _id="
+                        << doc["_id"].template ConvertTo<std::string>()
+                        << ", what(): " << e;
+    stats_scope.IncreaseDocumentsParseFailures(1);
+
+    if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+  }
+}
+
 template <class MongoCacheTraits>
 typename MongoCacheTraits::ObjectType
 MongoCache<MongoCacheTraits>::DeserializeObject(
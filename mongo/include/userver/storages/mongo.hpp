@@ -4,11 +4,14 @@
 /// @brief Include-all header for MongoDB client
 
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/bulk_writer.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/storages/mongo/pool.hpp>
+#include <userver/storages/mongo/prefetching_cursor.hpp>
 #include <userver/storages/mongo/write_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
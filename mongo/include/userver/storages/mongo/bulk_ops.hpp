@@ -10,6 +10,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace storages::mongo {
+class BulkWriter;
+}  // namespace storages::mongo
+
 namespace storages::mongo::operations {
 class Bulk;
 }  // namespace storages::mongo::operations
@@ -32,6 +36,7 @@ class InsertOne {
 
  private:
   friend class storages::mongo::operations::Bulk;
+  friend class storages::mongo::BulkWriter;
 
   class Impl;
   static constexpr std::size_t kSize = compiler::SelectSize()  //
@@ -57,6 +62,7 @@ class ReplaceOne {
 
  private:
   friend class storages::mongo::operations::Bulk;
+  friend class storages::mongo::BulkWriter;
 
   class Impl;
   static constexpr std::size_t kSize = compiler::SelectSize()  //
@@ -84,6 +90,7 @@ class Update {
 
  private:
   friend class storages::mongo::operations::Bulk;
+  friend class storages::mongo::BulkWriter;
 
   class Impl;
   static constexpr std::size_t kSize = compiler::SelectSize()  //
@@ -110,6 +117,7 @@ class Delete {
 
  private:
   friend class storages::mongo::operations::Bulk;
+  friend class storages::mongo::BulkWriter;
 
   class Impl;
   static constexpr std::size_t kSize = compiler::SelectSize()  //
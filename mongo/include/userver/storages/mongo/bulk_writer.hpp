@@ -0,0 +1,212 @@
+#pragma once
+
+/// @file userver/storages/mongo/bulk_writer.hpp
+/// @brief @copybrief storages::mongo::BulkWriter
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value_builder.hpp>
+#include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/bulk_ops.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/options.hpp>
+#include <userver/storages/mongo/write_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief Splits a large number of write operations into bulk batches and
+/// executes them over a single collection
+///
+/// A batch is sent once it reaches Settings::max_batch_operations operations
+/// or Settings::max_batch_bytes of documents. For
+/// operations::Bulk::Mode::kUnordered up to Settings::max_in_flight batches
+/// are executed concurrently, each over its own pool connection. For
+/// operations::Bulk::Mode::kOrdered batches are executed one after another,
+/// and nothing is executed after a batch that has failed with
+/// options::SuppressServerExceptions.
+///
+/// Finish() waits for all the batches and returns the combined WriteResult
+/// with the operation indices counted from the first appended operation.
+///
+/// Not thread-safe.
+class BulkWriter {
+ public:
+  struct Settings {
+    /// Maximum number of operations in a batch, `maxWriteBatchSize` by default
+    std::size_t max_batch_operations{100'000};
+
+    /// Maximum total size of the documents in a batch
+    std::size_t max_batch_bytes{16 * 1024 * 1024};
+
+    /// Maximum number of concurrently executed batches in unordered mode
+    std::size_t max_in_flight{4};
+  };
+
+  BulkWriter(Collection collection, operations::Bulk::Mode mode)
+      : BulkWriter(std::move(collection), mode, Settings{}) {}
+
+  BulkWriter(Collection collection, operations::Bulk::Mode mode,
+             Settings settings);
+
+  /// Cancels the batches in flight if Finish() was not called
+  ~BulkWriter();
+
+  BulkWriter(const BulkWriter&) = delete;
+  BulkWriter(BulkWriter&&);
+  BulkWriter& operator=(const BulkWriter&) = delete;
+  BulkWriter& operator=(BulkWriter&&) = delete;
+
+  /// @name Options applied to every batch
+  /// Must be set before the first operation is appended
+  /// @{
+  void SetOption(options::WriteConcern::Level);
+  void SetOption(const options::WriteConcern&);
+  void SetOption(options::SuppressServerExceptions);
+  /// @}
+
+  /// Inserts a single document
+  template <typename... Options>
+  void InsertOne(formats::bson::Document document, Options&&... options);
+
+  /// @brief Replaces a single matching document
+  /// @see options::Upsert
+  template <typename... Options>
+  void ReplaceOne(formats::bson::Document selector,
+                  formats::bson::Document replacement, Options&&... options);
+
+  /// @brief Updates a single matching document
+  /// @see options::Upsert
+  template <typename... Options>
+  void UpdateOne(formats::bson::Document selector,
+                 formats::bson::Document update, Options&&... options);
+
+  /// @brief Updates all matching documents
+  /// @see options::Upsert
+  template <typename... Options>
+  void UpdateMany(formats::bson::Document selector,
+                  formats::bson::Document update, Options&&... options);
+
+  /// Deletes a single matching document
+  template <typename... Options>
+  void DeleteOne(formats::bson::Document selector, Options&&... options);
+
+  /// Deletes all matching documents
+  template <typename... Options>
+  void DeleteMany(formats::bson::Document selector, Options&&... options);
+
+  /// @name Prepared sub-operation inserters
+  /// @{
+  void Append(const bulk_ops::InsertOne&);
+  void Append(const bulk_ops::ReplaceOne&);
+  void Append(const bulk_ops::Update&);
+  void Append(const bulk_ops::Delete&);
+  /// @}
+
+  /// @brief Executes the remaining operations and waits for all the batches
+  /// @returns the combined result of all the batches
+  /// @throws MongoException on the first failed batch unless
+  /// options::SuppressServerExceptions is set
+  WriteResult Finish();
+
+ private:
+  struct Batch {
+    std::size_t first_index;
+    engine::TaskWithResult<WriteResult> task;
+  };
+
+  operations::Bulk& PrepareBatch(std::size_t operation_bytes);
+  void Flush();
+  void WaitOldest();
+  void Collect(std::size_t first_index, const WriteResult& result);
+
+  Collection collection_;
+  operations::Bulk::Mode mode_;
+  Settings settings_;
+
+  std::optional<options::WriteConcern::Level> write_concern_level_;
+  std::optional<options::WriteConcern> write_concern_;
+  bool suppress_server_exceptions_{false};
+
+  std::optional<operations::Bulk> bulk_;
+  std::size_t bulk_first_index_{0};
+  std::size_t bulk_operations_{0};
+  std::size_t bulk_bytes_{0};
+  std::size_t operations_count_{0};
+  bool has_failed_batches_{false};
+  std::deque<Batch> in_flight_;
+
+  std::size_t inserted_count_{0};
+  std::size_t matched_count_{0};
+  std::size_t modified_count_{0};
+  std::size_t upserted_count_{0};
+  std::size_t deleted_count_{0};
+  formats::bson::ValueBuilder upserted_ids_;
+  formats::bson::ValueBuilder server_errors_;
+  formats::bson::ValueBuilder write_concern_errors_;
+};
+
+template <typename... Options>
+void BulkWriter::InsertOne(formats::bson::Document document,
+                           Options&&... options) {
+  bulk_ops::InsertOne insert_subop(std::move(document));
+  (insert_subop.SetOption(std::forward<Options>(options)), ...);
+  Append(insert_subop);
+}
+
+template <typename... Options>
+void BulkWriter::ReplaceOne(formats::bson::Document selector,
+                            formats::bson::Document replacement,
+                            Options&&... options) {
+  bulk_ops::ReplaceOne replace_subop(std::move(selector),
+                                     std::move(replacement));
+  (replace_subop.SetOption(std::forward<Options>(options)), ...);
+  Append(replace_subop);
+}
+
+template <typename... Options>
+void BulkWriter::UpdateOne(formats::bson::Document selector,
+                           formats::bson::Document update,
+                           Options&&... options) {
+  bulk_ops::Update update_subop(bulk_ops::Update::Mode::kSingle,
+                                std::move(selector), std::move(update));
+  (update_subop.SetOption(std::forward<Options>(options)), ...);
+  Append(update_subop);
+}
+
+template <typename... Options>
+void BulkWriter::UpdateMany(formats::bson::Document selector,
+                            formats::bson::Document update,
+                            Options&&... options) {
+  bulk_ops::Update update_subop(bulk_ops::Update::Mode::kMulti,
+                                std::move(selector), std::move(update));
+  (update_subop.SetOption(std::forward<Options>(options)), ...);
+  Append(update_subop);
+}
+
+template <typename... Options>
+void BulkWriter::DeleteOne(formats::bson::Document selector,
+                           Options&&... options) {
+  bulk_ops::Delete delete_subop(bulk_ops::Delete::Mode::kSingle,
+                                std::move(selector));
+  (delete_subop.SetOption(std::forward<Options>(options)), ...);
+  Append(delete_subop);
+}
+
+template <typename... Options>
+void BulkWriter::DeleteMany(formats::bson::Document selector,
+                            Options&&... options) {
+  bulk_ops::Delete delete_subop(bulk_ops::Delete::Mode::kMulti,
+                                std::move(selector));
+  (delete_subop.SetOption(std::forward<Options>(options)), ...);
+  Append(delete_subop);
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief MongoDB change stream, tails the changes of a collection
+///
+/// Occupies a pool connection while alive. Resumable errors are retried by
+/// the driver once, the stream is unusable after any error is thrown, use
+/// options::ResumeAfter with the last resume token to open a new one.
+///
+/// @see https://docs.mongodb.com/manual/changeStreams/
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Waits for the next change event up to options::MaxAwaitTime
+  /// @returns the change event, nullopt if there were no changes in time
+  /// @throws MongoException on errors
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last received
+  /// change or batch
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
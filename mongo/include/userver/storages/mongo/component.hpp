@@ -57,6 +57,7 @@ namespace components {
 /// idle_limit | limit for idle connections number | 64
 /// connecting_limit | limit for establishing connections number | 8
 /// local_threshold | latency window for instance selection | mongodb default
+/// balance_reads | pick the instance for non-primary reads by its latency and load | false
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// maintenance_period | pool maintenance period (idle connections pruning etc.) | 15s
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
@@ -130,6 +131,7 @@ inline constexpr bool kHasValidate<Mongo> = true;
 /// idle_limit | limit for idle connections number (per database) | 64
 /// connecting_limit | limit for establishing connections number (per database) | 8
 /// local_threshold | latency window for instance selection | mongodb default
+/// balance_reads | pick the instance for non-primary reads by its latency and load | false
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
@@ -22,6 +22,12 @@ class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
   void Acquire(std::chrono::milliseconds lock_ttl,
                const std::string& locker_id) override;
 
+  /// The fencing token is a counter in the lock document, incremented on
+  /// every acquisition
+  std::optional<dist_lock::FencingToken> AcquireWithFencingToken(
+      std::chrono::milliseconds lock_ttl,
+      const std::string& locker_id) override;
+
   void Release(const std::string& locker_id) override;
 
  private:
@@ -90,6 +90,7 @@ class Find {
   void SetOption(options::ReadConcern);
   void SetOption(options::Skip);
   void SetOption(options::Limit);
+  void SetOption(options::BatchSize);
   void SetOption(options::Projection);
   void SetOption(const options::Sort&);
   void SetOption(const options::Hint&);
@@ -334,6 +335,39 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// Opens a change stream over the collection changes
+class Watch {
+ public:
+  /// Watches all the changes
+  Watch();
+
+  /// @param pipeline an array of aggregation stages for the change events
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(options::ReadConcern);
+  void SetOption(options::BatchSize);
+  void SetOption(options::FullDocumentLookup);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 120;
+  static constexpr size_t kAlignment = 8;
+  // MAC_COMPAT: std::string size differs
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
@@ -151,6 +151,18 @@ class Limit {
   size_t value_;
 };
 
+/// @brief Specifies the number of documents to return in each server batch
+/// @note The value of `0` means the server default.
+class BatchSize {
+ public:
+  explicit BatchSize(size_t value) : value_(value) {}
+
+  size_t Value() const { return value_; }
+
+ private:
+  size_t value_;
+};
+
 /// @brief Selects fields to be returned
 /// @note `_id` field is always included by default, order might be significant
 /// @see
@@ -283,6 +295,37 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Makes the change stream return the current version of the whole
+/// document for updates
+/// @note The document may be missing if it was deleted since the update.
+class FullDocumentLookup {};
+
+/// @brief Starts the change stream after the change with this resume token
+/// @see ChangeStream::GetResumeToken
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Specifies the time for the server to wait for new changes before
+/// returning an empty change stream batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
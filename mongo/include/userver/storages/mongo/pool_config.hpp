@@ -65,6 +65,8 @@ struct PoolConfig final {
   size_t connecting_limit = kDefaultConnectingLimit;
   /// Instance selection latency window override
   std::optional<std::chrono::milliseconds> local_threshold{};
+  /// Whether to balance non-primary reads by server latency and load
+  bool balance_reads{false};
   /// Pool maintenance period
   std::chrono::milliseconds maintenance_period = kDefaultMaintenancePeriod;
 
@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file userver/storages/mongo/prefetching_cursor.hpp
+/// @brief @copybrief storages::mongo::PrefetchingCursor
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/cursor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief Reads the query results by chunks, fetching the next chunk in
+/// background while the current one is processed
+///
+/// The C driver requests the next batch from the server only when the current
+/// one is exhausted, so a plain Cursor waits for every `getMore` round trip.
+/// PrefetchingCursor iterates the cursor in a separate task, which overlaps
+/// these round trips and the copying of the documents with the processing of
+/// the previous chunk. Use options::BatchSize to control the size of the
+/// server batches, `chunk_size` should usually be its multiple.
+///
+/// Not thread-safe.
+class PrefetchingCursor {
+ public:
+  /// Starts fetching the first chunk of at most `chunk_size` documents
+  PrefetchingCursor(Cursor cursor, std::size_t chunk_size);
+
+  /// Cancels the prefetching in progress
+  ~PrefetchingCursor();
+
+  PrefetchingCursor(const PrefetchingCursor&) = delete;
+  PrefetchingCursor(PrefetchingCursor&&) = delete;
+  PrefetchingCursor& operator=(const PrefetchingCursor&) = delete;
+  PrefetchingCursor& operator=(PrefetchingCursor&&) = delete;
+
+  /// @brief Waits for the prefetched chunk and starts fetching the next one
+  /// @returns the next documents, an empty vector when there are no more
+  /// @throws MongoException on query errors
+  std::vector<formats::bson::Document> NextChunk();
+
+ private:
+  void StartPrefetch();
+
+  Cursor cursor_;
+  const std::size_t chunk_size_;
+  engine::TaskWithResult<std::vector<formats::bson::Document>> prefetch_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
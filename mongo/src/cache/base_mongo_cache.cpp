@@ -1,17 +1,121 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
+#include <utility>
+
 #include <userver/components/component_config.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace components::impl {
+namespace {
+
+// Limits the wait for changes, so that the stream notices cancellations
+constexpr std::chrono::seconds kChangeStreamMaxAwaitTime{1};
+
+}  // namespace
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(
     const ComponentConfig& config) {
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+std::size_t GetMongoCachePrefetchChunkSize(const ComponentConfig& config) {
+  return config["prefetch-chunk-size"].As<std::size_t>(0);
+}
+
+bool IsMongoCacheChangeStreamEnabled(const ComponentConfig& config) {
+  return config["change-stream"].As<bool>(false);
+}
+
+MongoCacheChangeStream::MongoCacheChangeStream(
+    std::string cache_name, storages::mongo::Collection collection,
+    bool is_secondary_preferred)
+    : cache_name_(std::move(cache_name)),
+      collection_(std::move(collection)),
+      is_secondary_preferred_(is_secondary_preferred) {}
+
+MongoCacheChangeStream::~MongoCacheChangeStream() {
+  if (task_.IsValid()) task_.SyncCancel();
+}
+
+void MongoCacheChangeStream::Restart() {
+  namespace sm = storages::mongo;
+
+  if (task_.IsValid()) task_.SyncCancel();
+  {
+    auto state = state_.Lock();
+    state->changes.clear();
+    state->is_lost = true;
+  }
+
+  std::optional<sm::ChangeStream> stream;
+  try {
+    // opened synchronously, the changes made after this call are not missed
+    const auto read_preference =
+        is_secondary_preferred_
+            ? sm::options::ReadPreference::kSecondaryPreferred
+            : sm::options::ReadPreference::kPrimary;
+    stream.emplace(collection_.Watch(
+        sm::options::FullDocumentLookup{},
+        sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime},
+        read_preference));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to open the change stream of cache " << cache_name_
+                << ": " << ex;
+    return;
+  }
+
+  {
+    auto state = state_.Lock();
+    state->is_lost = false;
+  }
+  task_ = utils::Async("mongo-cache-change-stream",
+                       [this, stream = std::move(*stream)]() mutable {
+                         Watch(std::move(stream));
+                       });
+}
+
+std::optional<std::vector<formats::bson::Document>>
+MongoCacheChangeStream::ExtractChanges() {
+  auto state = state_.Lock();
+  if (state->is_lost) return std::nullopt;
+  return std::exchange(state->changes, {});
+}
+
+void MongoCacheChangeStream::Watch(storages::mongo::ChangeStream stream) {
+  try {
+    while (!engine::current_task::ShouldCancel()) {
+      auto event = stream.Next();
+      if (!event) continue;
+
+      if ((*event)["operationType"].As<std::string>({}) == "invalidate") {
+        LOG_WARNING() << "Change stream of cache " << cache_name_
+                      << " has been invalidated";
+        break;
+      }
+
+      // Deletions are not tracked, also the document might have been deleted
+      // before the lookup
+      const auto full_document = (*event)["fullDocument"];
+      if (!full_document.IsDocument()) continue;
+
+      auto state = state_.Lock();
+      state->changes.emplace_back(full_document);
+    }
+  } catch (const std::exception& ex) {
+    if (engine::current_task::ShouldCancel()) return;
+    LOG_WARNING() << "Change stream of cache " << cache_name_
+                  << " has failed: " << ex;
+  }
+
+  auto state = state_.Lock();
+  state->is_lost = true;
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +126,19 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    prefetch-chunk-size:
+        type: integer
+        description: |
+            if non-zero, the documents are read by chunks of this size with
+            the next chunk fetched in background while the current one is parsed
+        defaultDescription: 0
+        minimum: 0
+    change-stream:
+        type: boolean
+        description: |
+            apply the changes from the collection change stream on incremental
+            updates instead of querying the collection
+        defaultDescription: false
 )";
 }
 
@@ -115,4 +115,21 @@ void bson_path_first_access(benchmark::State& state) {
 }
 BENCHMARK(bson_path_first_access);
 
+void bson_large_document_few_fields(benchmark::State& state) {
+  formats::bson::ValueBuilder builder(formats::common::Type::kObject);
+  for (int i = 0; i < state.range(0); ++i) {
+    builder["field_" + std::to_string(i)] = i;
+  }
+  const formats::bson::Document source = builder.ExtractValue();
+
+  for (auto _ : state) {
+    // shares the buffer, but not the parsed fields
+    const formats::bson::Document bson(source.GetBson());
+    const auto res = bson["field_0"].As<int>() + bson["field_1"].As<int>() +
+                     bson["field_2"].As<int>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(bson_large_document_few_fields)->RangeMultiplier(4)->Range(4, 1024);
+
 USERVER_NAMESPACE_END
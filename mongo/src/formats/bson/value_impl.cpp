@@ -1,5 +1,6 @@
 #include <formats/bson/value_impl.hpp>
 
+#include <algorithm>
 #include <cstring>
 
 #include <formats/bson/wrappers.hpp>
@@ -18,6 +19,23 @@ namespace {
 
 constexpr bson_value_t kDefaultBsonValue{BSON_TYPE_EOD, {}, {}};
 
+template <typename T>
+void AtomicSetOnce(std::atomic<T*>& value,
+                   std::unique_ptr<T>&& desired) noexcept {
+  // More than one thread may be reading the bson::Value, so rarely we may have
+  // more than one thread at this point.
+  //
+  // To avoid locking, we allow all of the threads to do the decoding, but only
+  // the first succeeds. Concurrent work with bson::Value is very rare, so we
+  // assume the overhead is rare and negligible because of that.
+
+  T* expected = nullptr;
+  if (value.compare_exchange_strong(expected, desired.get())) {
+    // clang-tidy complains on just `desired.release();`
+    [[maybe_unused]] auto* already_owned_by_value = desired.release();
+  }
+}
+
 void RelaxedSetParsedValue(std::atomic<ValueImpl::ParsedValue*>& parsed_value,
                            ValueImpl::ParsedValue&& value) {
   UASSERT(parsed_value.load(std::memory_order_relaxed) == nullptr);
@@ -29,18 +47,7 @@ void RelaxedSetParsedValue(std::atomic<ValueImpl::ParsedValue*>& parsed_value,
 void AtomicSetParsedValue(
     std::atomic<ValueImpl::ParsedValue*>& parsed_value,
     std::unique_ptr<ValueImpl::ParsedValue>&& desired) noexcept {
-  // More than one thread may be reading the bson::Value, so rarely we may have
-  // more than one thread at this point.
-  //
-  // To avoid locking, we allow all of the threads to do the decoding, but only
-  // the first succeeds. Concurrent work with bson::Value is very rare, so we
-  // assume the overhead is rare and negligible because of that.
-
-  ValueImpl::ParsedValue* expected = nullptr;
-  if (parsed_value.compare_exchange_strong(expected, desired.get())) {
-    // clang-tidy complains on just `desired.release();`
-    [[maybe_unused]] auto* already_owned_by_parsed_value = desired.release();
-  }
+  AtomicSetOnce(parsed_value, std::move(desired));
 }
 
 class DeepCopyVisitor {
@@ -174,7 +181,10 @@ class ValueImpl::EmplaceEnabler {};
 
 ValueImpl::ValueImpl() : bson_value_(kDefaultBsonValue) {}
 
-ValueImpl::~ValueImpl() { delete parsed_value_.load(); }
+ValueImpl::~ValueImpl() {
+  delete parsed_value_.load();
+  delete index_.load();
+}
 
 ValueImpl::ValueImpl(std::nullptr_t) : bson_value_(kDefaultBsonValue) {
   bson_value_.value_type = BSON_TYPE_NULL;
@@ -324,6 +334,8 @@ ValueImpl& ValueImpl::operator=(ValueImpl&& rhs) noexcept {
 
   delete parsed_value_.load();
   parsed_value_ = rhs.parsed_value_.exchange(nullptr);
+  delete index_.load();
+  index_ = rhs.index_.exchange(nullptr);
 
   duplicate_fields_policy_ = rhs.duplicate_fields_policy_;
   return *this;
@@ -357,6 +369,7 @@ bson_type_t ValueImpl::Type() const { return bson_value_.value_type; }
 void ValueImpl::SetDuplicateFieldsPolicy(Value::DuplicateFieldsPolicy policy) {
   if (duplicate_fields_policy_ != policy) {
     delete parsed_value_.exchange(nullptr);
+    delete index_.exchange(nullptr);
     duplicate_fields_policy_ = policy;
   }
 }
@@ -364,10 +377,20 @@ void ValueImpl::SetDuplicateFieldsPolicy(Value::DuplicateFieldsPolicy policy) {
 ValueImplPtr ValueImpl::operator[](const std::string& name) {
   if (!IsMissing() && !IsNull()) {
     CheckIsDocument();
-    EnsureParsed();
-    const auto& parsed_doc = std::get<ParsedDocument>(*parsed_value_.load());
-    auto it = parsed_doc.find(name);
-    if (it != parsed_doc.end()) return it->second;
+    const auto* parsed_ptr = parsed_value_.load();
+    if (!parsed_ptr) {
+      // read-only access to a raw document, do not parse all the fields
+      const auto* raw_value = FindRawField(name);
+      if (raw_value) {
+        return std::make_shared<ValueImpl>(EmplaceEnabler{}, storage_, path_,
+                                           *raw_value, duplicate_fields_policy_,
+                                           name);
+      }
+    } else {
+      const auto& parsed_doc = std::get<ParsedDocument>(*parsed_ptr);
+      auto it = parsed_doc.find(name);
+      if (it != parsed_doc.end()) return it->second;
+    }
   }
   return std::make_shared<ValueImpl>(EmplaceEnabler{}, nullptr, path_,
                                      kDefaultBsonValue,
@@ -389,8 +412,9 @@ bool ValueImpl::HasMember(const std::string& name) {
   if (IsMissing() || IsNull()) return false;
 
   CheckIsDocument();
-  EnsureParsed();
-  return std::get<ParsedDocument>(*parsed_value_.load()).count(name);
+  const auto* parsed_ptr = parsed_value_.load();
+  if (!parsed_ptr) return FindRawField(name) != nullptr;
+  return std::get<ParsedDocument>(*parsed_ptr).count(name);
 }
 
 ValueImplPtr ValueImpl::GetOrInsert(const std::string& key) {
@@ -675,6 +699,70 @@ void ValueImpl::EnsureParsed() {
   }
 }
 
+const bson_value_t* ValueImpl::FindRawField(std::string_view name) {
+  UASSERT(IsDocument());
+  UASSERT(!parsed_value_.load());
+
+  const auto& index = EnsureIndexed();
+  const auto it = std::lower_bound(
+      index.begin(), index.end(), name,
+      [](const IndexedField& field, std::string_view key) {
+        return field.key < key;
+      });
+  if (it == index.end() || it->key != name) return nullptr;
+  return &it->value;
+}
+
+const ValueImpl::DocumentIndex& ValueImpl::EnsureIndexed() {
+  const auto* index_ptr = index_.load();
+  if (index_ptr) return *index_ptr;
+
+  auto index = std::make_unique<DocumentIndex>();
+  ForEachValue(bson_value_.value.v_doc.data, bson_value_.value.v_doc.data_len,
+               path_, [this, &index](bson_iter_t* it) {
+                 std::string_view key(bson_iter_key(it), bson_iter_key_len(it));
+                 const bson_value_t* iter_value = bson_iter_value(it);
+                 if (!iter_value) {
+                   throw ParseException(
+                       fmt::format("malformed BSON element at {}.{}",
+                                   path_.ToStringView(), key));
+                 }
+                 index->push_back({key, *iter_value});
+               });
+
+  // stable sort keeps the duplicates in the document order
+  std::stable_sort(index->begin(), index->end(),
+                   [](const IndexedField& lhs, const IndexedField& rhs) {
+                     return lhs.key < rhs.key;
+                   });
+  const auto is_same_key = [](const IndexedField& lhs,
+                              const IndexedField& rhs) {
+    return lhs.key == rhs.key;
+  };
+  const auto duplicate =
+      std::adjacent_find(index->begin(), index->end(), is_same_key);
+  if (duplicate != index->end()) {
+    switch (duplicate_fields_policy_) {
+      case Value::DuplicateFieldsPolicy::kForbid:
+        throw ParseException(fmt::format("duplicate key '{}' at {}",
+                                         duplicate->key, path_.ToStringView()));
+      case Value::DuplicateFieldsPolicy::kUseFirst:
+        index->erase(std::unique(index->begin(), index->end(), is_same_key),
+                     index->end());
+        break;
+      case Value::DuplicateFieldsPolicy::kUseLast:
+        std::reverse(index->begin(), index->end());
+        index->erase(std::unique(index->begin(), index->end(), is_same_key),
+                     index->end());
+        std::reverse(index->begin(), index->end());
+        break;
+    }
+  }
+
+  AtomicSetOnce(index_, std::move(index));
+  return *index_.load();
+}
+
 void ValueImpl::SyncBsonValue() {
   // either primitive type or was never touched
   if (parsed_value_.load() == nullptr) return;
@@ -3,7 +3,9 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <string_view>
 #include <variant>
+#include <vector>
 
 #include <bson/bson.h>
 
@@ -21,6 +23,14 @@ class ValueImpl {
  public:
   enum class DocumentKind { kDocument, kArray };
 
+  /// Fields of a raw document sorted by key, allows to look them up without
+  /// creating the nodes for every field
+  struct IndexedField {
+    std::string_view key;
+    bson_value_t value;
+  };
+  using DocumentIndex = std::vector<IndexedField>;
+
   using Iterator = std::variant<ParsedArray::const_iterator,
                                 ParsedArray::const_reverse_iterator,
                                 ParsedDocument::const_iterator>;
@@ -90,6 +100,10 @@ class ValueImpl {
   void EnsureParsed();
   void SyncBsonValue();
 
+  /// @returns the raw document field, nullptr if it's missing;
+  /// the document must not be parsed
+  const bson_value_t* FindRawField(std::string_view name);
+
   const bson_value_t* GetNative() const { return &bson_value_; }
   const BsonHolder& GetBson() const { return std::get<BsonHolder>(storage_); }
 
@@ -114,10 +128,13 @@ class ValueImpl {
  private:
   friend class BsonBuilder;
 
+  const DocumentIndex& EnsureIndexed();
+
   Storage storage_;
   Path path_;
   bson_value_t bson_value_;
   std::atomic<ParsedValue*> parsed_value_{nullptr};
+  std::atomic<DocumentIndex*> index_{nullptr};
   Value::DuplicateFieldsPolicy duplicate_fields_policy_{
       Value::DuplicateFieldsPolicy::kForbid};
 };
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include <userver/formats/bson.hpp>
 #include <userver/utest/assert_macros.hpp>
 #include <userver/utest/literals.hpp>
@@ -234,6 +238,25 @@ TEST(BsonValue, DuplicateFieldsUseLast) {
   EXPECT_EQ("third", doc_use_last["a"].As<std::string>());
 }
 
+TEST(BsonValue, LookupBeforeAndAfterIteration) {
+  const fb::Document doc =
+      fb::MakeDoc("b", 2, "a", fb::MakeDoc("x", 1), "c", 3);
+  EXPECT_EQ(1, doc["a"]["x"].As<int>());
+  EXPECT_EQ("a.x", doc["a"]["x"].GetPath());
+  EXPECT_TRUE(doc.HasMember("c"));
+  EXPECT_FALSE(doc.HasMember("d"));
+  EXPECT_EQ("d", doc["d"].GetPath());
+
+  std::vector<std::string> keys;
+  for (auto it = doc.begin(); it != doc.end(); ++it) {
+    keys.push_back(it.GetName());
+  }
+  std::sort(keys.begin(), keys.end());
+  EXPECT_EQ(keys, (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(2, doc["b"].As<int>());
+  EXPECT_TRUE(doc["d"].IsMissing());
+}
+
 TEST(BsonValue, Items) {
   for ([[maybe_unused]] const auto& [key, value] : Items(kDoc)) {
   }
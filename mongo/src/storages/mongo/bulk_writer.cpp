@@ -0,0 +1,186 @@
+#include <userver/storages/mongo/bulk_writer.hpp>
+
+#include <string>
+
+#include <bson/bson.h>
+
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <storages/mongo/bulk_ops_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace {
+
+std::size_t GetSize(const formats::bson::Document& document) {
+  return document.GetBson()->len;
+}
+
+}  // namespace
+
+BulkWriter::BulkWriter(Collection collection, operations::Bulk::Mode mode,
+                       Settings settings)
+    : collection_(std::move(collection)),
+      mode_(mode),
+      settings_(settings),
+      upserted_ids_(formats::common::Type::kArray),
+      server_errors_(formats::common::Type::kArray),
+      write_concern_errors_(formats::common::Type::kArray) {
+  if (!settings_.max_batch_operations || !settings_.max_batch_bytes ||
+      !settings_.max_in_flight) {
+    throw InvalidQueryArgumentException(
+        "BulkWriter batch and in-flight limits must be positive");
+  }
+}
+
+BulkWriter::~BulkWriter() = default;
+
+BulkWriter::BulkWriter(BulkWriter&&) = default;
+
+void BulkWriter::SetOption(options::WriteConcern::Level level) {
+  UINVARIANT(!operations_count_,
+             "BulkWriter options must be set before the first operation");
+  write_concern_level_ = level;
+  write_concern_.reset();
+}
+
+void BulkWriter::SetOption(const options::WriteConcern& write_concern) {
+  UINVARIANT(!operations_count_,
+             "BulkWriter options must be set before the first operation");
+  write_concern_ = write_concern;
+  write_concern_level_.reset();
+}
+
+void BulkWriter::SetOption(options::SuppressServerExceptions) {
+  UINVARIANT(!operations_count_,
+             "BulkWriter options must be set before the first operation");
+  suppress_server_exceptions_ = true;
+}
+
+void BulkWriter::Append(const bulk_ops::InsertOne& insert_subop) {
+  PrepareBatch(GetSize(insert_subop.impl_->document)).Append(insert_subop);
+}
+
+void BulkWriter::Append(const bulk_ops::ReplaceOne& replace_subop) {
+  PrepareBatch(GetSize(replace_subop.impl_->selector) +
+               GetSize(replace_subop.impl_->replacement))
+      .Append(replace_subop);
+}
+
+void BulkWriter::Append(const bulk_ops::Update& update_subop) {
+  PrepareBatch(GetSize(update_subop.impl_->selector) +
+               GetSize(update_subop.impl_->update))
+      .Append(update_subop);
+}
+
+void BulkWriter::Append(const bulk_ops::Delete& delete_subop) {
+  PrepareBatch(GetSize(delete_subop.impl_->selector)).Append(delete_subop);
+}
+
+WriteResult BulkWriter::Finish() {
+  Flush();
+  while (!in_flight_.empty()) WaitOldest();
+
+  formats::bson::ValueBuilder result;
+  result["nInserted"] = inserted_count_;
+  result["nMatched"] = matched_count_;
+  result["nModified"] = modified_count_;
+  result["nUpserted"] = upserted_count_;
+  result["nRemoved"] = deleted_count_;
+  result["upserted"] = std::move(upserted_ids_);
+  result["writeErrors"] = std::move(server_errors_);
+  result["writeConcernErrors"] = std::move(write_concern_errors_);
+  return WriteResult{result.ExtractValue()};
+}
+
+operations::Bulk& BulkWriter::PrepareBatch(std::size_t operation_bytes) {
+  // An oversized operation goes to a batch of its own, the server rejects it
+  if (bulk_ && (bulk_operations_ >= settings_.max_batch_operations ||
+                bulk_bytes_ + operation_bytes > settings_.max_batch_bytes)) {
+    Flush();
+  }
+
+  if (!bulk_) {
+    bulk_.emplace(mode_);
+    if (write_concern_level_) bulk_->SetOption(*write_concern_level_);
+    if (write_concern_) bulk_->SetOption(*write_concern_);
+    if (suppress_server_exceptions_) {
+      bulk_->SetOption(options::SuppressServerExceptions{});
+    }
+    bulk_first_index_ = operations_count_;
+    bulk_operations_ = 0;
+    bulk_bytes_ = 0;
+  }
+
+  ++operations_count_;
+  ++bulk_operations_;
+  bulk_bytes_ += operation_bytes;
+  return *bulk_;
+}
+
+void BulkWriter::Flush() {
+  if (!bulk_) return;
+  auto bulk = std::move(*bulk_);
+  bulk_.reset();
+
+  if (mode_ == operations::Bulk::Mode::kOrdered) {
+    // Ordered bulk stops at the first error, so should the following batches
+    if (has_failed_batches_) return;
+    Collect(bulk_first_index_, collection_.Execute(std::move(bulk)));
+    return;
+  }
+
+  if (in_flight_.size() >= settings_.max_in_flight) WaitOldest();
+  auto task = utils::Async(
+      "mongo-bulk-writer",
+      [collection = collection_, bulk = std::move(bulk)]() mutable {
+        return collection.Execute(std::move(bulk));
+      });
+  in_flight_.push_back({bulk_first_index_, std::move(task)});
+}
+
+void BulkWriter::WaitOldest() {
+  UASSERT(!in_flight_.empty());
+  auto batch = std::move(in_flight_.front());
+  in_flight_.pop_front();
+  Collect(batch.first_index, batch.task.Get());
+}
+
+void BulkWriter::Collect(std::size_t first_index, const WriteResult& result) {
+  inserted_count_ += result.InsertedCount();
+  matched_count_ += result.MatchedCount();
+  modified_count_ += result.ModifiedCount();
+  upserted_count_ += result.UpsertedCount();
+  deleted_count_ += result.DeletedCount();
+
+  for (const auto& [index, id] : result.UpsertedIds()) {
+    formats::bson::ValueBuilder upserted;
+    upserted["index"] = first_index + index;
+    upserted["_id"] = id;
+    upserted_ids_.PushBack(std::move(upserted));
+  }
+
+  const auto server_errors = result.ServerErrors();
+  if (!server_errors.empty()) has_failed_batches_ = true;
+  for (const auto& [index, error] : server_errors) {
+    formats::bson::ValueBuilder server_error;
+    server_error["index"] = first_index + index;
+    server_error["code"] = error.Code();
+    server_error["errmsg"] = std::string{error.Message()};
+    server_errors_.PushBack(std::move(server_error));
+  }
+
+  for (const auto& error : result.WriteConcernErrors()) {
+    formats::bson::ValueBuilder write_concern_error;
+    write_concern_error["code"] = error.Code();
+    write_concern_error["errmsg"] = std::string{error.Message()};
+    write_concern_errors_.PushBack(std::move(write_concern_error));
+  }
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,118 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+class BulkWriter : public MongoPoolFixture {};
+
+const mongo::BulkWriter::Settings kSmallBatches{
+    /*max_batch_operations=*/3,
+    /*max_batch_bytes=*/1024,
+    /*max_in_flight=*/2,
+};
+
+}  // namespace
+
+UTEST_F(BulkWriter, Empty) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_empty");
+
+  mongo::BulkWriter writer(coll, mongo::operations::Bulk::Mode::kUnordered);
+  auto result = writer.Finish();
+
+  EXPECT_EQ(0, result.InsertedCount());
+  EXPECT_EQ(0, result.DeletedCount());
+  EXPECT_TRUE(result.UpsertedIds().empty());
+  EXPECT_TRUE(result.ServerErrors().empty());
+  EXPECT_TRUE(result.WriteConcernErrors().empty());
+}
+
+UTEST_F(BulkWriter, Unordered) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_unordered");
+
+  mongo::BulkWriter writer(coll, mongo::operations::Bulk::Mode::kUnordered,
+                           kSmallBatches);
+  writer.SetOption(mongo::options::SuppressServerExceptions{});
+  for (int i = 0; i < 10; ++i) writer.InsertOne(bson::MakeDoc("_id", i));
+  writer.InsertOne(bson::MakeDoc("_id", 4));
+  writer.UpdateOne(bson::MakeDoc("_id", 100),
+                   bson::MakeDoc("$set", bson::MakeDoc("x", 1)),
+                   mongo::options::Upsert{});
+  writer.UpdateMany(bson::MakeDoc("_id", bson::MakeDoc("$lt", 3)),
+                    bson::MakeDoc("$set", bson::MakeDoc("x", 1)));
+  writer.DeleteOne(bson::MakeDoc("_id", 5));
+  auto result = writer.Finish();
+
+  EXPECT_EQ(10, result.InsertedCount());
+  EXPECT_EQ(3, result.MatchedCount());
+  EXPECT_EQ(3, result.ModifiedCount());
+  EXPECT_EQ(1, result.UpsertedCount());
+  EXPECT_EQ(1, result.DeletedCount());
+
+  auto upserted_ids = result.UpsertedIds();
+  ASSERT_EQ(1, upserted_ids.size());
+  ASSERT_EQ(1, upserted_ids.count(11));
+
+  auto errors = result.ServerErrors();
+  ASSERT_EQ(1, errors.size());
+  ASSERT_EQ(1, errors.count(10));
+  EXPECT_EQ(11000, errors[10].Code());
+
+  EXPECT_EQ(10, coll.CountApprox());
+}
+
+UTEST_F(BulkWriter, Ordered) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_ordered");
+
+  {
+    mongo::BulkWriter writer(coll, mongo::operations::Bulk::Mode::kOrdered,
+                             kSmallBatches);
+    writer.SetOption(mongo::options::SuppressServerExceptions{});
+    writer.InsertOne(bson::MakeDoc("_id", 1));
+    writer.InsertOne(bson::MakeDoc("_id", 2));
+    writer.InsertOne(bson::MakeDoc("_id", 3));
+    writer.InsertOne(bson::MakeDoc("_id", 4));
+    writer.InsertOne(bson::MakeDoc("_id", 1));
+    writer.InsertOne(bson::MakeDoc("_id", 5));
+    writer.InsertOne(bson::MakeDoc("_id", 6));
+    auto result = writer.Finish();
+
+    EXPECT_EQ(4, result.InsertedCount());
+    auto errors = result.ServerErrors();
+    ASSERT_EQ(1, errors.size());
+    EXPECT_EQ(11000, errors[4].Code());
+    EXPECT_EQ(4, coll.CountApprox());
+  }
+  {
+    mongo::BulkWriter writer(coll, mongo::operations::Bulk::Mode::kOrdered,
+                             kSmallBatches);
+    for (int i = 0; i < 5; ++i) writer.InsertOne(bson::MakeDoc("_id", i));
+    UEXPECT_THROW(writer.Finish(), mongo::DuplicateKeyException);
+  }
+}
+
+UTEST_F(BulkWriter, BatchBytes) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_bytes");
+
+  mongo::BulkWriter writer(coll, mongo::operations::Bulk::Mode::kUnordered,
+                           kSmallBatches);
+  const std::string payload(400, 'x');
+  for (int i = 0; i < 5; ++i) {
+    writer.InsertOne(bson::MakeDoc("_id", i, "payload", payload));
+  }
+  // exceeds max_batch_bytes, goes to a batch of its own
+  writer.InsertOne(bson::MakeDoc("_id", 5, "payload", std::string(2048, 'x')));
+  auto result = writer.Finish();
+
+  EXPECT_EQ(6, result.InsertedCount());
+  EXPECT_EQ(6, coll.CountApprox());
+}
+
+USERVER_NAMESPACE_END
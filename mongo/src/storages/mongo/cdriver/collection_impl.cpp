@@ -15,6 +15,7 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -194,6 +195,8 @@ size_t CDriverCollectionImpl::Execute(
 
   auto options = operation.impl_->options;
   SetMaxServerTime(options, operation.impl_->max_server_time, context);
+  auto server_lease =
+      SelectServer(context, operation.impl_->read_prefs, options);
 
   MongoError error;
   stats::OperationStopwatch stopwatch(std::move(context.stats));
@@ -203,8 +206,8 @@ size_t CDriverCollectionImpl::Execute(
   if (operation.impl_->use_new_count) {
     count = mongoc_collection_count_documents(
         context.collection.get(), native_filter_bson_ptr,
-        impl::GetNative(operation.impl_->options),
-        operation.impl_->read_prefs.Get(), nullptr, error.GetNative());
+        impl::GetNative(options), operation.impl_->read_prefs.Get(), nullptr,
+        error.GetNative());
   } else {
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -213,8 +216,8 @@ size_t CDriverCollectionImpl::Execute(
     count = mongoc_collection_count_with_opts(
         context.collection.get(), MONGOC_QUERY_NONE, native_filter_bson_ptr,  //
         0, 0,  // skip and limit are set in options
-        impl::GetNative(operation.impl_->options),
-        operation.impl_->read_prefs.Get(), error.GetNative());
+        impl::GetNative(options), operation.impl_->read_prefs.Get(),
+        error.GetNative());
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
@@ -224,6 +227,7 @@ size_t CDriverCollectionImpl::Execute(
     error.Throw("Error counting documents");
   }
   stopwatch.AccountSuccess();
+  if (server_lease) server_lease->AccountSuccess();
   return count;
 }
 
@@ -233,17 +237,20 @@ size_t CDriverCollectionImpl::Execute(
 
   auto options = operation.impl_->options;
   SetMaxServerTime(options, operation.impl_->max_server_time, context);
+  auto server_lease =
+      SelectServer(context, operation.impl_->read_prefs, options);
 
   MongoError error;
   stats::OperationStopwatch stopwatch(std::move(context.stats));
   auto count = mongoc_collection_estimated_document_count(
-      context.collection.get(), impl::GetNative(operation.impl_->options),
+      context.collection.get(), impl::GetNative(options),
       operation.impl_->read_prefs.Get(), nullptr, error.GetNative());
   if (count < 0) {
     stopwatch.AccountError(error.GetKind());
     error.Throw("Error counting documents");
   }
   stopwatch.AccountSuccess();
+  if (server_lease) server_lease->AccountSuccess();
   return count;
 }
 
@@ -255,15 +262,20 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& operation) const {
   bool has_comment_option = operation.impl_->has_comment_option;
   if (!has_comment_option)
     SetLinkComment(impl::EnsureBuilder(options), has_comment_option);
+  auto server_lease =
+      SelectServer(context, operation.impl_->read_prefs, options);
 
   const bson_t* native_filter_bson_ptr =
       operation.impl_->filter.GetBson().get();
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_find_with_opts(
       context.collection.get(), native_filter_bson_ptr,
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
-  return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
+  // the cursor is primed with the first batch in constructor
+  Cursor cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
       std::move(context.stats)));
+  if (server_lease) server_lease->AccountSuccess();
+  return cursor;
 }
 
 WriteResult CDriverCollectionImpl::Execute(
@@ -518,15 +530,45 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
   bool has_comment_option = operation.impl_->has_comment_option;
   if (!has_comment_option)
     SetLinkComment(impl::EnsureBuilder(options), has_comment_option);
+  auto server_lease =
+      SelectServer(context, operation.impl_->read_prefs, options);
 
   auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
   const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_aggregate(
       context.collection.get(), MONGOC_QUERY_NONE, native_pipeline_bson_ptr,
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
-  return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
+  // the cursor is primed with the first batch in constructor
+  Cursor cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
       std::move(context.stats)));
+  if (server_lease) server_lease->AccountSuccess();
+  return cursor;
+}
+
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+  if (operation.impl_->read_prefs) {
+    mongoc_collection_set_read_prefs(context.collection.get(),
+                                     operation.impl_->read_prefs.Get());
+  }
+
+  MongoError error;
+  stats::OperationStopwatch stopwatch(context.stats);
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
+  impl::cdriver::ChangeStreamPtr stream(mongoc_collection_watch(
+      context.collection.get(), native_pipeline_bson_ptr,
+      impl::GetNative(operation.impl_->options)));
+  if (mongoc_change_stream_error_document(stream.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening the change stream");
+  }
+  stopwatch.AccountSuccess();
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(stream), std::move(context.stats)));
 }
 
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
@@ -592,6 +634,24 @@ RequestContext CDriverCollectionImpl::MakeRequestContext(
   };
 }
 
+std::optional<ServerBalancer::Lease> CDriverCollectionImpl::SelectServer(
+    const RequestContext& context, const ReadPrefsPtr& read_prefs,
+    std::optional<formats::bson::impl::BsonBuilder>& options) const {
+  // uasserted in ctor
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  const auto& pool = static_cast<const cdriver::CDriverPoolImpl&>(*pool_impl_);
+  const auto* balancer = pool.GetServerBalancer();
+  if (!balancer) return std::nullopt;
+
+  auto lease = balancer->Select(context.client.get(), read_prefs.Get());
+  if (lease) {
+    constexpr std::string_view kOptionName = "serverId";
+    impl::EnsureBuilder(options).Append(
+        kOptionName, static_cast<int64_t>(lease->ServerId()));
+  }
+  return lease;
+}
+
 template <typename Operation>
 RequestContext CDriverCollectionImpl::MakeRequestContext(
     std::string&& span_name, const Operation& operation) const {
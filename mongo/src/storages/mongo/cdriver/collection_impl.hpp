@@ -5,9 +5,11 @@
 #include <optional>
 
 #include <storages/mongo/cdriver/pool_impl.hpp>
+#include <storages/mongo/cdriver/server_balancer.hpp>
 #include <storages/mongo/collection_impl.hpp>
 #include <storages/mongo/stats.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/formats/bson/bson_builder.hpp>
 #include <userver/tracing/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -40,6 +42,7 @@ class CDriverCollectionImpl : public CollectionImpl {
   WriteResult Execute(const operations::FindAndRemove&) override;
   WriteResult Execute(operations::Bulk&&) override;
   Cursor Execute(const operations::Aggregate&) override;
+  ChangeStream Execute(const operations::Watch&) const override;
   void Execute(const operations::Drop&) override;
 
  private:
@@ -53,6 +56,11 @@ class CDriverCollectionImpl : public CollectionImpl {
   RequestContext MakeRequestContext(std::string&& span_name,
                                     const Operation& operation) const;
 
+  /// Pins the read to the server selected by the pool, if enabled
+  std::optional<ServerBalancer::Lease> SelectServer(
+      const RequestContext& context, const ReadPrefsPtr& read_prefs,
+      std::optional<formats::bson::impl::BsonBuilder>& options) const;
+
   PoolImplPtr pool_impl_;
   std::shared_ptr<stats::CollectionStatistics> statistics_;
 };
@@ -33,6 +33,9 @@ utils::impl::UserverExperiment kServerSelectionTimeoutExperiment{
 const std::string kMaintenanceTaskName = "mongo_maintenance";
 constexpr size_t kIdleConnectionDropRate = 1;
 
+// mongoc default for localThresholdMS
+constexpr std::chrono::milliseconds kDefaultLocalThreshold{15};
+
 int32_t CheckedDurationMs(const std::chrono::milliseconds& timeout,
                           const char* name) {
   auto timeout_ms = timeout.count();
@@ -189,6 +192,12 @@ CDriverPoolImpl::CDriverPoolImpl(std::string id, const std::string& uri_string,
 
   init_data_.ssl_opt = MakeSslOpt(uri_.get());
 
+  if (config.balance_reads) {
+    server_balancer_.emplace(
+        GetStatistics(),
+        config.local_threshold.value_or(kDefaultLocalThreshold));
+  }
+
   try {
     tracing::Span span("mongo_prepopulate");
     LOG_INFO() << "Creating " << config.initial_size << " mongo connections";
@@ -262,6 +271,10 @@ void CDriverPoolImpl::Ping() {
   ping_sw.AccountSuccess();
 }
 
+const ServerBalancer* CDriverPoolImpl::GetServerBalancer() const {
+  return server_balancer_ ? &*server_balancer_ : nullptr;
+}
+
 CDriverPoolImpl::BoundClientPtr CDriverPoolImpl::Acquire() {
   const stats::ConnectionWaitStopwatch conn_wait_sw(GetStatistics().pool);
   return {Pop(), ClientPusher(this)};
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include <mongoc/mongoc.h>
 #include <boost/lockfree/queue.hpp>
 
 #include <storages/mongo/cdriver/async_stream.hpp>
+#include <storages/mongo/cdriver/server_balancer.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
 #include <storages/mongo/dynamic_config.hpp>
 #include <storages/mongo/pool_impl.hpp>
@@ -54,6 +56,9 @@ class CDriverPoolImpl final : public PoolImpl {
   /// @throws CancelledException, PoolOverloadException
   BoundClientPtr Acquire();
 
+  /// @returns nullptr unless read balancing is enabled
+  const ServerBalancer* GetServerBalancer() const;
+
  private:
   mongoc_client_t* Pop();
   void Push(mongoc_client_t*) noexcept;
@@ -76,6 +81,7 @@ class CDriverPoolImpl final : public PoolImpl {
   engine::Semaphore in_use_semaphore_;
   engine::Semaphore connecting_semaphore_;
   boost::lockfree::queue<mongoc_client_t*> queue_;
+  std::optional<ServerBalancer> server_balancer_;
   utils::PeriodicTask maintenance_task_;
 };
 
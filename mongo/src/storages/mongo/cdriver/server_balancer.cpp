@@ -0,0 +1,188 @@
+#include <storages/mongo/cdriver/server_balancer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <bson/bson.h>
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+namespace {
+
+// The latency average follows the recent 8 operations or so
+constexpr std::int64_t kLatencyEwmaDivisor = 8;
+
+class ServerDescriptions final {
+ public:
+  explicit ServerDescriptions(const mongoc_client_t* client)
+      : descriptions_(mongoc_client_get_server_descriptions(client, &size_)) {}
+
+  ~ServerDescriptions() {
+    mongoc_server_descriptions_destroy_all(descriptions_, size_);
+  }
+
+  ServerDescriptions(const ServerDescriptions&) = delete;
+  ServerDescriptions& operator=(const ServerDescriptions&) = delete;
+
+  mongoc_server_description_t** begin() const { return descriptions_; }
+  mongoc_server_description_t** end() const { return descriptions_ + size_; }
+
+ private:
+  std::size_t size_{0};
+  mongoc_server_description_t** descriptions_;
+};
+
+bool IsSuitable(const mongoc_server_description_t* server,
+                mongoc_read_mode_t mode) {
+  const char* type = mongoc_server_description_type(server);
+  // all routers are equal for any read preference
+  if (!std::strcmp(type, "Mongos")) return true;
+  if (!std::strcmp(type, "RSSecondary")) return true;
+  return mode == MONGOC_READ_NEAREST && !std::strcmp(type, "RSPrimary");
+}
+
+struct Candidate {
+  const mongoc_server_description_t* server;
+  std::chrono::microseconds round_trip_time;
+};
+
+}  // namespace
+
+ServerBalancer::Lease::Lease(std::shared_ptr<stats::ServerStatistics> stats,
+                             uint32_t server_id)
+    : stats_(std::move(stats)),
+      server_id_(server_id),
+      start_(std::chrono::steady_clock::now()) {
+  UASSERT(stats_);
+  ++stats_->in_flight;
+}
+
+ServerBalancer::Lease::Lease(Lease&&) noexcept = default;
+
+ServerBalancer::Lease::~Lease() {
+  if (stats_) Account(/*is_error=*/true);
+}
+
+void ServerBalancer::Lease::AccountSuccess() noexcept {
+  Account(/*is_error=*/false);
+}
+
+void ServerBalancer::Lease::AccountError() noexcept {
+  Account(/*is_error=*/true);
+}
+
+void ServerBalancer::Lease::Account(bool is_error) noexcept {
+  const auto stats = std::exchange(stats_, nullptr);
+  if (!stats) return;
+
+  const auto elapsed = std::chrono::steady_clock::now() - start_;
+  --stats->in_flight;
+  ++stats->requests;
+  if (is_error) ++stats->errors;
+  stats->timings.GetCurrentCounter().Account(
+      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+
+  // Errors are usually timeouts or broken connections, make the server
+  // look slower for them
+  auto sample =
+      std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  if (is_error) sample *= 2;
+
+  // Concurrent updates may lose a sample, it does not matter for an average
+  const auto old_average = stats->latency_ewma_us.load();
+  stats->latency_ewma_us =
+      old_average > 0
+          ? old_average + (sample - old_average) / kLatencyEwmaDivisor
+          : std::max<std::int64_t>(sample, 1);
+}
+
+ServerBalancer::ServerBalancer(stats::PoolStatistics& pool_stats,
+                               std::chrono::milliseconds local_threshold)
+    : pool_stats_(pool_stats), local_threshold_(local_threshold) {}
+
+std::optional<ServerBalancer::Lease> ServerBalancer::Select(
+    mongoc_client_t* client, const mongoc_read_prefs_t* read_prefs) const {
+  UASSERT(client);
+  if (!read_prefs) return std::nullopt;
+
+  // Primary is the only candidate, while tag sets and staleness limits are
+  // left to the driver
+  const auto mode = mongoc_read_prefs_get_mode(read_prefs);
+  if (mode == MONGOC_READ_PRIMARY || mode == MONGOC_READ_PRIMARY_PREFERRED) {
+    return std::nullopt;
+  }
+  const bson_t* tags = mongoc_read_prefs_get_tags(read_prefs);
+  if ((tags && !bson_empty(tags)) ||
+      mongoc_read_prefs_get_max_staleness_seconds(read_prefs) !=
+          MONGOC_NO_MAX_STALENESS) {
+    return std::nullopt;
+  }
+
+  const ServerDescriptions servers(client);
+  boost::container::small_vector<Candidate, 8> candidates;
+  auto min_round_trip_time = std::chrono::microseconds::max();
+  for (const auto* server : servers) {
+    if (!IsSuitable(server, mode)) continue;
+
+    const auto round_trip_time_ms =
+        mongoc_server_description_round_trip_time(server);
+    if (round_trip_time_ms < 0) continue;  // not checked yet
+
+    const std::chrono::microseconds round_trip_time{
+        std::chrono::milliseconds{round_trip_time_ms}};
+    candidates.push_back({server, round_trip_time});
+    min_round_trip_time = std::min(min_round_trip_time, round_trip_time);
+  }
+
+  // Nothing to balance, e.g. the topology is not discovered yet or
+  // secondaryPreferred has to fall back to the primary
+  if (candidates.size() < 2) return std::nullopt;
+
+  const auto latency_window_end = min_round_trip_time + local_threshold_;
+  candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                  [&](const Candidate& candidate) {
+                                    return candidate.round_trip_time >
+                                           latency_window_end;
+                                  }),
+                   candidates.end());
+  if (candidates.size() < 2) return std::nullopt;
+
+  // Start from a random server for the ties to be broken evenly
+  const auto offset = utils::RandRange(candidates.size());
+  std::shared_ptr<stats::ServerStatistics> best_stats;
+  const mongoc_server_description_t* best_server = nullptr;
+  auto best_score = std::numeric_limits<std::int64_t>::max();
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    const auto& candidate = candidates[(offset + i) % candidates.size()];
+    auto server_stats =
+        pool_stats_
+            .servers[mongoc_server_description_host(candidate.server)
+                         ->host_and_port];
+
+    auto latency_us = server_stats->latency_ewma_us.load();
+    if (latency_us <= 0) latency_us = candidate.round_trip_time.count();
+    const auto score = (server_stats->in_flight.load() + 1) *
+                       std::max<std::int64_t>(latency_us, 1);
+    if (score < best_score) {
+      best_score = score;
+      best_server = candidate.server;
+      best_stats = std::move(server_stats);
+    }
+  }
+
+  UASSERT(best_server && best_stats);
+  return Lease(std::move(best_stats),
+               mongoc_server_description_id(best_server));
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <mongoc/mongoc.h>
+
+#include <storages/mongo/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+
+/// @brief Picks the server for non-primary reads by its load and latency
+///
+/// The C driver selects a random server within the latency window, which is
+/// based on the heartbeat round trip times only. This balancer scores every
+/// suitable server as (requests in flight + 1) * (operation latency average)
+/// and picks the one with the lowest score, so that slow or overloaded
+/// replicas receive fewer requests.
+class ServerBalancer final {
+ public:
+  /// Accounts an operation executed on the selected server
+  class Lease final {
+   public:
+    Lease(std::shared_ptr<stats::ServerStatistics> stats, uint32_t server_id);
+    Lease(Lease&&) noexcept;
+    Lease& operator=(Lease&&) = delete;
+
+    /// Accounts as failed if neither AccountSuccess() nor AccountError()
+    /// was called
+    ~Lease();
+
+    uint32_t ServerId() const { return server_id_; }
+
+    void AccountSuccess() noexcept;
+    void AccountError() noexcept;
+
+   private:
+    void Account(bool is_error) noexcept;
+
+    std::shared_ptr<stats::ServerStatistics> stats_;
+    uint32_t server_id_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  ServerBalancer(stats::PoolStatistics& pool_stats,
+                 std::chrono::milliseconds local_threshold);
+
+  /// @returns the lease for the selected server, nullopt to let the driver
+  /// select it itself
+  std::optional<Lease> Select(mongoc_client_t* client,
+                              const mongoc_read_prefs_t* read_prefs) const;
+
+ private:
+  stats::PoolStatistics& pool_stats_;
+  const std::chrono::microseconds local_threshold_;
+};
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
@@ -26,6 +26,14 @@ struct BulkOperationDeleter {
 using BulkOperationPtr =
     std::unique_ptr<mongoc_bulk_operation_t, BulkOperationDeleter>;
 
+struct ChangeStreamDeleter {
+  void operator()(mongoc_change_stream_t* stream) const noexcept {
+    mongoc_change_stream_destroy(stream);
+  }
+};
+using ChangeStreamPtr =
+    std::unique_ptr<mongoc_change_stream_t, ChangeStreamDeleter>;
+
 struct ClientDeleter {
   void operator()(mongoc_client_t* client) const noexcept {
     mongoc_client_destroy(client);
@@ -0,0 +1,88 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+class ChangeStream : public MongoPoolFixture {};
+
+const mongo::options::MaxAwaitTime kMaxAwaitTime{std::chrono::milliseconds{50}};
+
+std::vector<bson::Document> ReadEvents(mongo::ChangeStream& stream,
+                                       std::size_t count) {
+  std::vector<bson::Document> events;
+  for (int attempt = 0; events.size() < count && attempt < 100; ++attempt) {
+    auto event = stream.Next();
+    if (event) events.push_back(std::move(*event));
+  }
+  return events;
+}
+
+}  // namespace
+
+UTEST_F(ChangeStream, Changes) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_changes");
+
+  auto stream = coll.Watch(mongo::options::FullDocumentLookup{}, kMaxAwaitTime);
+  EXPECT_FALSE(stream.Next());
+
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+  coll.UpdateOne(bson::MakeDoc("_id", 1),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 2)));
+  coll.DeleteOne(bson::MakeDoc("_id", 1));
+
+  const auto events = ReadEvents(stream, 3);
+  ASSERT_EQ(3, events.size());
+  EXPECT_EQ("insert", events[0]["operationType"].As<std::string>());
+  EXPECT_EQ(1, events[0]["fullDocument"]["x"].As<int>());
+  EXPECT_EQ("update", events[1]["operationType"].As<std::string>());
+  EXPECT_EQ("delete", events[2]["operationType"].As<std::string>());
+  EXPECT_EQ(1, events[2]["documentKey"]["_id"].As<int>());
+  EXPECT_TRUE(stream.GetResumeToken());
+}
+
+UTEST_F(ChangeStream, Resume) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_resume");
+
+  auto stream = coll.Watch(kMaxAwaitTime);
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  coll.InsertOne(bson::MakeDoc("_id", 2));
+
+  const auto events = ReadEvents(stream, 1);
+  ASSERT_EQ(1, events.size());
+
+  auto resumed = coll.Watch(mongo::options::ResumeAfter{events[0]["_id"]},
+                            kMaxAwaitTime);
+  const auto resumed_events = ReadEvents(resumed, 1);
+  ASSERT_EQ(1, resumed_events.size());
+  EXPECT_EQ(2, resumed_events[0]["documentKey"]["_id"].As<int>());
+}
+
+UTEST_F(ChangeStream, Pipeline) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_pipeline");
+
+  mongo::operations::Watch watch_op(bson::MakeArray(
+      bson::MakeDoc("$match", bson::MakeDoc("operationType", "delete"))));
+  watch_op.SetOption(kMaxAwaitTime);
+  auto stream = coll.Execute(watch_op);
+
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  coll.DeleteOne(bson::MakeDoc("_id", 1));
+
+  const auto events = ReadEvents(stream, 1);
+  ASSERT_EQ(1, events.size());
+  EXPECT_EQ("delete", events[0]["operationType"].As<std::string>());
+}
+
+USERVER_NAMESPACE_END
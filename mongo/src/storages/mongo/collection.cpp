@@ -57,6 +57,10 @@ Cursor Collection::Execute(const operations::Aggregate& aggregate_op) {
   return impl_->Execute(aggregate_op);
 }
 
+ChangeStream Collection::Execute(const operations::Watch& watch_op) const {
+  return impl_->Execute(watch_op);
+}
+
 void Collection::Execute(const operations::Drop& drop_op) {
   return impl_->Execute(drop_op);
 }
@@ -163,6 +163,12 @@ properties:
         type: string
         description: latency window for instance selection
         defaultDescription: mongodb default
+    balance_reads:
+        type: boolean
+        description: |
+            pick the instance for non-primary reads by its latency and load
+            instead of a random one
+        defaultDescription: false
     max_replication_lag:
         type: string
         description: replication lag limit for usable secondaries, min. 90s
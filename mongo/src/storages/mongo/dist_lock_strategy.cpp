@@ -7,6 +7,7 @@
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/storages/mongo/exception.hpp>
+#include <userver/utils/datetime.hpp>
 
 #include <userver/formats/bson/serialize.hpp>
 
@@ -20,6 +21,7 @@ namespace fields {
 const std::string kId = "_id";
 const std::string kLockedTill = "t";
 const std::string kOwner = "o";
+const std::string kFencingToken = "f";
 
 }  // namespace fields
 
@@ -41,6 +43,12 @@ DistLockStrategy::DistLockStrategy(Collection collection, std::string lock_name,
 
 void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
                                const std::string& locker_id) {
+  AcquireWithFencingToken(lock_ttl, locker_id);
+}
+
+std::optional<dist_lock::FencingToken>
+DistLockStrategy::AcquireWithFencingToken(std::chrono::milliseconds lock_ttl,
+                                          const std::string& locker_id) {
   namespace bson = formats::bson;
 
   const auto now = utils::datetime::Now();
@@ -53,9 +61,11 @@ void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
       bson::MakeArray(
           bson::MakeDoc(fields::kLockedTill, bson::MakeDoc("$lte", now)),
           bson::MakeDoc(fields::kOwner, owner)));
-  auto update =
-      bson::MakeDoc("$set", bson::MakeDoc(fields::kLockedTill, expiration_time,
-                                          fields::kOwner, owner));
+  auto update = bson::MakeDoc(
+      "$set",
+      bson::MakeDoc(fields::kLockedTill, expiration_time, fields::kOwner,
+                    owner),
+      "$inc", bson::MakeDoc(fields::kFencingToken, dist_lock::FencingToken{1}));
 
   try {
     LOG_INFO() << "Owner " << owner << " try to acquire lock " << lock_name_;
@@ -66,6 +76,7 @@ void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
     if (!lock) {
       throw dist_lock::LockIsAcquiredByAnotherHostException();
     }
+    return (*lock)[fields::kFencingToken].As<dist_lock::FencingToken>();
   } catch (const DuplicateKeyException& exc) {
     LOG_INFO() << "Lock " << lock_name_
                << " has not been acqired because of key duplication";
@@ -82,16 +93,20 @@ void DistLockStrategy::Release(const std::string& locker_id) {
 
   const auto owner = MakeOwnerId(owner_prefix_, locker_id);
 
+  // The lock document is kept to preserve the fencing token counter
   auto query = bson::MakeDoc(fields::kId, lock_name_, fields::kOwner, owner);
-  size_t deleted_count = 0;
+  auto update = bson::MakeDoc(
+      "$set", bson::MakeDoc(fields::kLockedTill, utils::datetime::Now()));
+  size_t released_count = 0;
   try {
-    deleted_count = collection_.FindAndRemove(std::move(query)).DeletedCount();
+    released_count =
+        collection_.UpdateOne(std::move(query), update).MatchedCount();
   } catch (const std::exception& e) {
     LOG_WARNING() << "owner " << owner << " could not release a lock "
                   << lock_name_ << " because of mongo error: " << e.what();
     return;
   }
-  if (!deleted_count) {
+  if (!released_count) {
     LOG_WARNING() << "owner " << owner << " could not release a lock "
                   << lock_name_;
   }
@@ -71,6 +71,26 @@ UTEST_F(DistLockTest, Expire) {
                 dist_lock::LockIsAcquiredByAnotherHostException);
 }
 
+UTEST_F(DistLockTest, FencingToken) {
+  utils::datetime::MockNowSet(kMockTime);
+
+  auto collection = GetDefaultPool().GetCollection("test_fencing_token");
+  const std::string key = "key_fencing_token";
+  mongo::DistLockStrategy strategy1(collection, key, "owner1");
+  mongo::DistLockStrategy strategy2(collection, key, "owner2");
+
+  const auto first = strategy1.AcquireWithFencingToken(1s, {});
+  ASSERT_TRUE(first);
+  const auto prolonged = strategy1.AcquireWithFencingToken(1s, {});
+  ASSERT_TRUE(prolonged);
+  EXPECT_LT(*first, *prolonged);
+
+  UEXPECT_NO_THROW(strategy1.Release({}));
+  const auto second_owner = strategy2.AcquireWithFencingToken(1s, {});
+  ASSERT_TRUE(second_owner);
+  EXPECT_LT(*prolonged, *second_owner);
+}
+
 UTEST_F(DistLockTest, ReleaseAcquire) {
   utils::datetime::MockNowSet(kMockTime);
 
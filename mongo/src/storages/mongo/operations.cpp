@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -250,6 +251,14 @@ void Find::SetOption(options::Limit limit) {
   AppendLimit(impl::EnsureBuilder(impl_->options), limit);
 }
 
+void Find::SetOption(options::BatchSize batch_size) {
+  if (!batch_size.Value()) return;
+
+  static const std::string kOptionName = "batchSize";
+  AppendUint64Option(impl::EnsureBuilder(impl_->options), kOptionName,
+                     batch_size.Value());
+}
+
 void Find::SetOption(options::Projection projection) {
   const bson_t* projection_bson = projection.GetProjectionBson();
   if (bson_empty0(projection_bson)) return;
@@ -603,6 +612,63 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch() : Watch(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+  impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) {
+  impl_->read_prefs = MakeCDriverReadPrefs(mode);
+}
+
+void Watch::SetOption(options::ReadConcern level) {
+  AppendReadConcern(impl::EnsureBuilder(impl_->options), level);
+}
+
+void Watch::SetOption(options::BatchSize batch_size) {
+  if (!batch_size.Value()) return;
+
+  static const std::string kOptionName = "batchSize";
+  AppendUint64Option(impl::EnsureBuilder(impl_->options), kOptionName,
+                     batch_size.Value());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+  static const std::string kOptionName = "fullDocument";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, "updateLookup");
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  static const std::string kOptionName = "resumeAfter";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, resume_after.Value());
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  const auto value = max_await_time.Value().count();
+  if (value < 0) {
+    throw InvalidQueryArgumentException("Negative max await time: ")
+        << value << "ms";
+  }
+
+  static const std::string kOptionName = "maxAwaitTimeMS";
+  AppendUint64Option(impl::EnsureBuilder(impl_->options), kOptionName, value);
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
@@ -70,6 +70,7 @@ PoolConfig Parse(const yaml_config::YamlConfig& config,
       config["connecting_limit"].As<size_t>(result.connecting_limit);
   result.local_threshold =
       config["local_threshold"].As<std::optional<std::chrono::milliseconds>>();
+  result.balance_reads = config["balance_reads"].As<bool>(result.balance_reads);
   result.maintenance_period =
       config["maintenance_period"].As<std::chrono::milliseconds>(
           result.maintenance_period);
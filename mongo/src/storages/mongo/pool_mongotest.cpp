@@ -14,6 +14,7 @@
 #include <userver/formats/bson/inline.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/options.hpp>
 #include <userver/storages/mongo/pool.hpp>
 #include <userver/storages/mongo/pool_config.hpp>
 
@@ -96,4 +97,28 @@ UTEST_F(Pool, Limits) {
   UEXPECT_THROW(second_find.Get(), mongo::MongoException);
 }
 
+UTEST_F(Pool, BalanceReads) {
+  auto config = MakeTestPoolConfig();
+  config.balance_reads = true;
+  auto pool = MakePool({}, config);
+  auto coll = pool.GetCollection("balance_reads");
+
+  for (int i = 0; i < 10; ++i) coll.InsertOne(formats::bson::MakeDoc("_id", i));
+
+  // a single server is never pinned, the reads must work as usual anyway
+  for (const auto read_preference :
+       {mongo::options::ReadPreference::kPrimary,
+        mongo::options::ReadPreference::kSecondaryPreferred,
+        mongo::options::ReadPreference::kNearest}) {
+    EXPECT_EQ(10, coll.Count({}, read_preference));
+    EXPECT_EQ(10, coll.CountApprox(read_preference));
+
+    std::size_t found = 0;
+    for ([[maybe_unused]] const auto& doc : coll.Find({}, read_preference)) {
+      ++found;
+    }
+    EXPECT_EQ(10, found);
+  }
+}
+
 USERVER_NAMESPACE_END
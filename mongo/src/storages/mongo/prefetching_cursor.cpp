@@ -0,0 +1,46 @@
+#include <userver/storages/mongo/prefetching_cursor.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+PrefetchingCursor::PrefetchingCursor(Cursor cursor, std::size_t chunk_size)
+    : cursor_(std::move(cursor)), chunk_size_(chunk_size) {
+  UINVARIANT(chunk_size_ > 0, "Prefetch chunk size must be positive");
+  StartPrefetch();
+}
+
+PrefetchingCursor::~PrefetchingCursor() = default;
+
+std::vector<formats::bson::Document> PrefetchingCursor::NextChunk() {
+  if (!prefetch_.IsValid()) return {};
+
+  auto chunk = prefetch_.Get();
+  StartPrefetch();
+  return chunk;
+}
+
+void PrefetchingCursor::StartPrefetch() {
+  // The cursor is accessed by a single task at a time, the previous prefetch
+  // has already finished here
+  if (!cursor_.HasMore()) return;
+
+  prefetch_ = utils::Async("mongo-cursor-prefetch", [this] {
+    std::vector<formats::bson::Document> chunk;
+    chunk.reserve(chunk_size_);
+    for (auto it = cursor_.begin(); it != cursor_.end();) {
+      chunk.push_back(*it);
+      // may wait for the next server batch
+      ++it;
+      if (chunk.size() >= chunk_size_) break;
+    }
+    return chunk;
+  });
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+class PrefetchingCursor : public MongoPoolFixture {};
+}  // namespace
+
+UTEST_F(PrefetchingCursor, Empty) {
+  auto coll = GetDefaultPool().GetCollection("prefetching_cursor_empty");
+
+  mongo::PrefetchingCursor cursor(coll.Find({}), 10);
+  EXPECT_TRUE(cursor.NextChunk().empty());
+  EXPECT_TRUE(cursor.NextChunk().empty());
+}
+
+UTEST_F(PrefetchingCursor, Chunks) {
+  auto coll = GetDefaultPool().GetCollection("prefetching_cursor_chunks");
+  for (int i = 0; i < 25; ++i) coll.InsertOne(bson::MakeDoc("_id", i));
+
+  const mongo::options::Sort sort{{"_id", mongo::options::Sort::kAscending}};
+  mongo::PrefetchingCursor cursor(
+      coll.Find({}, mongo::options::BatchSize{4}, sort), 10);
+
+  int expected_id = 0;
+  std::vector<std::size_t> chunk_sizes;
+  for (auto chunk = cursor.NextChunk(); !chunk.empty();
+       chunk = cursor.NextChunk()) {
+    chunk_sizes.push_back(chunk.size());
+    for (const auto& doc : chunk) {
+      EXPECT_EQ(expected_id++, doc["_id"].As<int>());
+    }
+  }
+  EXPECT_EQ(25, expected_id);
+  EXPECT_EQ(chunk_sizes, (std::vector<std::size_t>{10, 10, 5}));
+  EXPECT_TRUE(cursor.NextChunk().empty());
+}
+
+UTEST_F(PrefetchingCursor, Abandoned) {
+  auto coll = GetDefaultPool().GetCollection("prefetching_cursor_abandoned");
+  for (int i = 0; i < 10; ++i) coll.InsertOne(bson::MakeDoc("_id", i));
+
+  mongo::PrefetchingCursor cursor(coll.Find({}, mongo::options::BatchSize{2}),
+                                  3);
+  EXPECT_EQ(3, cursor.NextChunk().size());
+}
+
+USERVER_NAMESPACE_END
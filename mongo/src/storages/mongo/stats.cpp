@@ -117,6 +117,8 @@ std::string_view ToString(OpType type) {
       return "count-approx";
     case Type::kFind:
       return "find";
+    case Type::kWatch:
+      return "watch";
     case Type::kInsertOne:
       return "insert-one";
     case Type::kInsertMany:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -74,6 +75,7 @@ enum class OpType {
   kCountApprox,
   kFind,
   kAggregate,
+  kWatch,
 
   kWriteMin,
   kInsertOne = kWriteMin,
@@ -116,11 +118,24 @@ struct PoolConnectStatistics {
   AggregatedTimingsPercentile queue_wait_timings_agg;
 };
 
+/// Reads balanced to a replica set member (or mongos) by the pool
+struct ServerStatistics final {
+  std::atomic<std::int64_t> in_flight{0};
+  /// Exponentially weighted moving average of the operation latency
+  std::atomic<std::int64_t> latency_ewma_us{0};
+
+  Counter requests;
+  Counter errors;
+  AggregatedTimingsPercentile timings;
+};
+
 struct PoolStatistics {
   PoolStatistics() : pool(utils::MakeSharedRef<PoolConnectStatistics>()) {}
 
   utils::SharedRef<PoolConnectStatistics> pool;
   rcu::RcuMap<std::string, CollectionStatistics> collections;
+  /// By `host:port`, filled only with read balancing enabled
+  rcu::RcuMap<std::string, ServerStatistics> servers;
   congestion_control::v2::Stats congestion_control;
 };
 
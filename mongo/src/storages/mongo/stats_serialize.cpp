@@ -154,6 +154,15 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["queue-wait-timings-1min"] = conn_stats.queue_wait_timings_agg;
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ServerStatistics& server_stats) {
+  writer["in-flight"] = server_stats.in_flight.load();
+  writer["latency-ewma-us"] = server_stats.latency_ewma_us.load();
+  writer["requests"] = server_stats.requests;
+  writer["errors"] = server_stats.errors;
+  writer["timings-1min"] = server_stats.timings;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolStatistics& pool_stats, StatsVerbosity verbosity) {
   writer["pool"] = *pool_stats.pool;
@@ -168,6 +177,12 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 
   writer["by-database"] = pool_overall;
+
+  for (const auto& [server, server_stats] : pool_stats.servers) {
+    UASSERT(server_stats);
+    writer["by-server"].ValueWithLabels(*server_stats,
+                                        {"mongo_server", server});
+  }
 }
 
 }  // namespace storages::mongo::stats
@@ -14,6 +14,9 @@ void DumpMetric(utils::statistics::Writer& writer,
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolConnectStatistics& conn_stats);
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ServerStatistics& server_stats);
+
 void DumpMetric(utils::statistics::Writer&, const PoolStatistics&,
                 StatsVerbosity);
 
@@ -3,9 +3,13 @@
 /// @file userver/storages/mysql/cluster.hpp
 /// @copybrief @copybrief storages::mysql::Cluster
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/components/component_fwd.hpp>
@@ -15,7 +19,9 @@
 #include <userver/storages/mysql/cluster_host_type.hpp>
 #include <userver/storages/mysql/command_result_set.hpp>
 #include <userver/storages/mysql/cursor_result_set.hpp>
+#include <userver/storages/mysql/execution_result.hpp>
 #include <userver/storages/mysql/impl/bind_helper.hpp>
+#include <userver/storages/mysql/impl/container_chunk.hpp>
 #include <userver/storages/mysql/options.hpp>
 #include <userver/storages/mysql/query.hpp>
 #include <userver/storages/mysql/statement_result_set.hpp>
@@ -188,6 +194,43 @@ class Cluster final {
                                        const Query& query,
                                        const Container& params) const;
 
+  /// @brief Executes a statement on a host of host_type with default deadline
+  /// in a chunked bulk-manner, see the overload taking CommandControl.
+  template <typename Container>
+  ExecutionResult ExecuteBulkChunked(ClusterHostType host_type,
+                                     const Query& query,
+                                     const Container& params,
+                                     BulkSettings settings = {}) const;
+
+  // clang-format off
+  /// @brief Executes a statement on a host of host_type with provided
+  /// CommandControl, filling placeholders of the statement with
+  /// Container::value_type in a bulk-manner, split into chunks of at most
+  /// `settings.max_chunk_rows` rows.
+  /// Up to `settings.max_concurrency` chunks are executed concurrently, each
+  /// on its own connection.
+  /// See @ref md_en_userver_mysql_supported_types for better understanding of
+  /// `Container::value_type` requirements.
+  ///
+  /// @note Requires MariaDB 10.2.6+ as a server
+  ///
+  /// @note Chunks are independent statements: the timeout of command_control
+  /// applies to each chunk separately, and a failure of one chunk doesn't
+  /// roll back the others.
+  ///
+  /// Returns the sum of rows affected by the chunks, `last_insert_id` is the
+  /// one of the first chunk.
+  ///
+  /// UINVARIANTs on params count mismatch, doesn't validate types.
+  /// UINVARIANTs on empty params container.
+  // clang-format on
+  template <typename Container>
+  ExecutionResult ExecuteBulkChunked(OptionalCommandControl command_control,
+                                     ClusterHostType host_type,
+                                     const Query& query,
+                                     const Container& params,
+                                     BulkSettings settings = {}) const;
+
   /// @brief Begin a transaction with default deadline.
   ///
   /// @note The deadline is transaction-wide, not just for Begin query itself.
@@ -271,6 +314,10 @@ class Cluster final {
                                impl::io::ParamsBinderBase& params,
                                std::optional<std::size_t> batch_size) const;
 
+  ExecutionResult DoExecuteChunked(
+      std::size_t chunks_count, std::size_t max_concurrency,
+      const std::function<ExecutionResult(std::size_t)>& execute_chunk) const;
+
   std::unique_ptr<infra::topology::TopologyBase> topology_;
 };
 
@@ -349,6 +396,47 @@ StatementResultSet Cluster::ExecuteBulkMapped(
                    params_binder, std::nullopt);
 }
 
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(ClusterHostType host_type,
+                                            const Query& query,
+                                            const Container& params,
+                                            BulkSettings settings) const {
+  return ExecuteBulkChunked(std::nullopt, host_type, query, params, settings);
+}
+
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(
+    OptionalCommandControl command_control, ClusterHostType host_type,
+    const Query& query, const Container& params, BulkSettings settings) const {
+  UINVARIANT(!params.empty(), "Empty params in bulk execution");
+  UINVARIANT(settings.max_chunk_rows > 0, "Chunk size should be positive");
+
+  using Chunk = impl::ContainerChunk<Container>;
+  std::vector<Chunk> chunks;
+  chunks.reserve((params.size() + settings.max_chunk_rows - 1) /
+                 settings.max_chunk_rows);
+
+  auto chunk_begin = params.begin();
+  for (std::size_t rows_left = params.size(); rows_left > 0;) {
+    const auto chunk_size = std::min(rows_left, settings.max_chunk_rows);
+    const auto chunk_end = std::next(chunk_begin, chunk_size);
+    chunks.emplace_back(chunk_begin, chunk_end, chunk_size);
+
+    chunk_begin = chunk_end;
+    rows_left -= chunk_size;
+  }
+
+  return DoExecuteChunked(
+      chunks.size(), settings.max_concurrency, [&](std::size_t chunk_index) {
+        auto params_binder =
+            impl::BindHelper::BindContainerAsParams(chunks[chunk_index]);
+
+        return DoExecute(command_control, host_type, query.GetStatement(),
+                         params_binder, std::nullopt)
+            .AsExecutionResult();
+      });
+}
+
 template <typename T, typename... Args>
 CursorResultSet<T> Cluster::GetCursor(ClusterHostType host_type,
                                       std::size_t batch_size,
@@ -30,6 +30,16 @@ class CursorResultSet final {
   template <typename RowCallback>
   void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
 
+  /// @brief Fetches all the rows from cursor and for each fetched batch of at
+  /// most `batch_size` rows executes batch_callback with `std::vector<T>&&`.
+  ///
+  /// Rows are parsed directly into the batch, so only a single batch is kept
+  /// in memory at a time. Usable for bulk consumers, e.g. cache updates, that
+  /// would rather process rows in chunks than one by one.
+  template <typename BatchCallback>
+  void ForEachBatch(BatchCallback&& batch_callback,
+                    engine::Deadline deadline) &&;
+
  private:
   StatementResultSet result_set_;
 };
@@ -50,6 +60,21 @@ template <typename RowCallback>
 void CursorResultSet<T>::ForEach(
     RowCallback&& row_callback,
     // TODO : think about separate deadline here
+    engine::Deadline deadline) && {
+  std::move(*this).ForEachBatch(
+      [&row_callback](std::vector<T>&& rows) {
+        for (auto&& row : rows) {
+          row_callback(std::move(row));
+        }
+      },
+      deadline);
+}
+
+template <typename T>
+template <typename BatchCallback>
+void CursorResultSet<T>::ForEachBatch(
+    BatchCallback&& batch_callback,
+    // TODO : think about separate deadline here
     [[maybe_unused]] engine::Deadline deadline) && {
   using IntermediateStorage = std::vector<T>;
 
@@ -62,8 +87,8 @@ void CursorResultSet<T>::ForEach(
 
     fetch.Reset(impl::tracing::kForEachScope);
     IntermediateStorage data{extractor.ExtractData()};
-    for (auto&& row : data) {
-      row_callback(std::move(row));
+    if (!data.empty()) {
+      batch_callback(std::move(data));
     }
   }
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+// A non-owning sized view of a contiguous range of a container, usable as a
+// Container for bulk insertion
+template <typename Container>
+class ContainerChunk final {
+ public:
+  using value_type = typename Container::value_type;
+  using const_iterator = typename Container::const_iterator;
+
+  ContainerChunk(const_iterator begin, const_iterator end, std::size_t size)
+      : begin_{begin}, end_{end}, size_{size} {}
+
+  const_iterator begin() const { return begin_; }
+  const_iterator end() const { return end_; }
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+ private:
+  const_iterator begin_;
+  const_iterator end_;
+  std::size_t size_;
+};
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
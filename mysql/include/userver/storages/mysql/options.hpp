@@ -3,6 +3,7 @@
 /// @file userver/storages/mysql/options.hpp
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +35,18 @@ struct CommandControl final {
 /// @brief storages::mysql::CommandControl that may not be set.
 using OptionalCommandControl = std::optional<CommandControl>;
 
+/// Controls how storages::mysql::Cluster::ExecuteBulkChunked splits and
+/// executes the params
+struct BulkSettings final {
+  /// Max amount of rows in a single bulk statement, should be small enough
+  /// for a statement to fit into the server `max_allowed_packet`.
+  std::size_t max_chunk_rows{1000};
+
+  /// Max amount of chunks executed concurrently, each one takes a separate
+  /// connection from the pool.
+  std::size_t max_concurrency{4};
+};
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
@@ -3,7 +3,10 @@
 #include <vector>
 
 #include <userver/components/component_config.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 #include <userver/storages/mysql/impl/tracing_tags.hpp>
 
@@ -114,6 +117,39 @@ StatementResultSet Cluster::DoExecute(
   return {std::move(connection), std::move(fetcher), std::move(span)};
 }
 
+ExecutionResult Cluster::DoExecuteChunked(
+    std::size_t chunks_count, std::size_t max_concurrency,
+    const std::function<ExecutionResult(std::size_t)>& execute_chunk) const {
+  UINVARIANT(max_concurrency > 0, "Chunks concurrency should be positive");
+
+  ExecutionResult result{};
+  std::vector<engine::TaskWithResult<ExecutionResult>> tasks;
+  tasks.reserve(chunks_count);
+
+  // Chunks are awaited in order, so the first one defines the last_insert_id
+  std::size_t chunks_done = 0;
+  const auto await_next_chunk = [&] {
+    const auto chunk_result = tasks[chunks_done].Get();
+    if (chunks_done == 0) {
+      result.last_insert_id = chunk_result.last_insert_id;
+    }
+    result.rows_affected += chunk_result.rows_affected;
+    ++chunks_done;
+  };
+
+  for (std::size_t i = 0; i < chunks_count; ++i) {
+    if (i - chunks_done >= max_concurrency) {
+      await_next_chunk();
+    }
+    tasks.push_back(utils::Async("mysql_bulk_chunk", execute_chunk, i));
+  }
+  while (chunks_done < chunks_count) {
+    await_next_chunk();
+  }
+
+  return result;
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
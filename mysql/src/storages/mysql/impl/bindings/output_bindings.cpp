@@ -615,6 +615,19 @@ void OutputBindings::ValidateAgainstStatement(MYSQL_STMT& statement) {
   }
 }
 
+OutputBindings::Shape OutputBindings::GetShape() const {
+  Shape shape;
+  shape.reserve(Size());
+  for (std::size_t i = 0; i < Size(); ++i) {
+    const auto& bind = binds_ptr_[i];
+    shape.push_back(static_cast<std::uint32_t>(bind.buffer_type) |
+                    (bind.is_unsigned ? 1u << 16 : 0u) |
+                    (bind.is_null != nullptr ? 1u << 17 : 0u));
+  }
+
+  return shape;
+}
+
 MYSQL_BIND& OutputBindings::GetBind(std::size_t pos) {
   UASSERT(pos < Size());
   auto& bind = binds_ptr_[pos];
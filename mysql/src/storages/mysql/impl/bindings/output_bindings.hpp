@@ -83,6 +83,12 @@ class OutputBindings : public NativeBindsHelper {
 
   void ValidateAgainstStatement(MYSQL_STMT& statement);
 
+  // Compact description of the binds types: binds of the same shape have to be
+  // validated against a statement only once
+  using Shape =
+      boost::container::small_vector<std::uint32_t, kOnStackBindsCount>;
+  Shape GetShape() const;
+
  private:
   MYSQL_BIND& GetBind(std::size_t pos);
 
@@ -1,5 +1,6 @@
 #include <storages/mysql/impl/statement.hpp>
 
+#include <algorithm>
 #include <utility>
 
 #include <fmt/format.h>
@@ -166,6 +167,8 @@ void Statement::Reset(engine::Deadline deadline) {
     if (connection_->GetServerInfo().server_type ==
         metadata::ServerInfo::Type::kMySQL) {
       PrepareStatement(native_statement_, deadline);
+      // metadata of a re-prepared statement is validated anew
+      validated_output_shape_.reset();
     }
     batch_size_.reset();
   }
@@ -262,6 +265,18 @@ Statement::NativeStatementPtr Statement::CreateStatement(
   return statement_ptr;
 }
 
+void Statement::ValidateOutputBindings(bindings::OutputBindings& binds) {
+  auto shape = binds.GetShape();
+  if (validated_output_shape_.has_value() &&
+      std::equal(shape.begin(), shape.end(), validated_output_shape_->begin(),
+                 validated_output_shape_->end())) {
+    return;
+  }
+
+  binds.ValidateAgainstStatement(*native_statement_);
+  validated_output_shape_.emplace(shape.begin(), shape.end());
+}
+
 void Statement::PrepareStatement(NativeStatementPtr& native_statement,
                                  engine::Deadline deadline) {
   native_statement.get_deleter().SetDeadline(deadline);
@@ -325,10 +340,10 @@ bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
     if (validate_binds) {
       // We validate binds even for empty results:
       // we don't want a query returning empty result to pass tests and then
-      // BOOM with actual data. Performance cost of this should be negligible,
-      // if any.
+      // BOOM with actual data. The statement remembers the validated binds, so
+      // repeated executions with the same result type don't pay for that.
       auto& binds = extractor.BindNextRow();
-      binds.ValidateAgainstStatement(*statement_->native_statement_);
+      statement_->ValidateOutputBindings(binds);
       extractor.RollbackLastRow();
     }
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <storages/mysql/impl/mariadb_include.hpp>
 
@@ -83,6 +84,7 @@ class Statement final {
   void Reset(engine::Deadline deadline);
 
   void UpdateParamsBindings(io::ParamsBinderBase& params);
+  void ValidateOutputBindings(bindings::OutputBindings& binds);
 
   class NativeStatementDeleter {
    public:
@@ -110,6 +112,10 @@ class Statement final {
   NativeStatementPtr native_statement_;
 
   std::optional<std::size_t> batch_size_;
+
+  // Validation fetches the result metadata from the driver, which is
+  // noticeable for point queries, so we remember what we've validated already.
+  std::optional<std::vector<std::uint32_t>> validated_output_shape_;
 };
 
 }  // namespace storages::mysql::impl
@@ -10,8 +10,9 @@ constexpr std::chrono::milliseconds kDefaultStatementDeleteTimeout{200};
 
 }
 
-StatementsCache::StatementsCache(Connection& connection, std::size_t capacity)
-    : connection_{connection}, cache_{capacity} {
+StatementsCache::StatementsCache(Connection& connection, std::size_t capacity,
+                                 infra::StatementsCacheStatistics& stats)
+    : connection_{connection}, stats_{stats}, cache_{capacity} {
   UASSERT(capacity > 0);
 }
 
@@ -29,8 +30,10 @@ Statement& StatementsCache::PrepareStatement(const std::string& statement,
                                              engine::Deadline deadline) {
   auto* statement_ptr = cache_.Get(statement);
   if (statement_ptr) {
+    ++stats_.hits;
     return *statement_ptr;
   }
+  ++stats_.misses;
 
   // key is not in cache, check if insertion will overflow and set destruction
   // deadline if it's the case
@@ -39,6 +42,7 @@ Statement& StatementsCache::PrepareStatement(const std::string& statement,
     UASSERT(statement_to_be_deleted);
 
     statement_to_be_deleted->SetDestructionDeadline(deadline);
+    ++stats_.evictions;
   }
 
   auto* added_statement =
@@ -72,7 +72,7 @@ Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
   try {
     auto connection_ptr = std::make_unique<impl::Connection>(
         resolver_, settings_.endpoint_info, settings_.auth_settings,
-        settings_.connection_settings, deadline);
+        settings_.connection_settings, stats_.statements_cache, deadline);
     monitor_.AccountSuccess();
 
     return connection_ptr;
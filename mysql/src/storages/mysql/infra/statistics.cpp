@@ -6,6 +6,13 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::infra {
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const StatementsCacheStatistics& stats) {
+  writer["hits"] = stats.hits;
+  writer["misses"] = stats.misses;
+  writer["evictions"] = stats.evictions;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolConnectionStatistics& stats) {
   writer["overload"] = stats.overload;
@@ -14,6 +21,8 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   writer["active"] = stats.created - stats.closed;
   writer["busy"] = stats.acquired - stats.released;
+
+  writer["statements_cache"] = stats.statements_cache;
 }
 
 }  // namespace storages::mysql::infra
@@ -10,14 +10,25 @@ namespace storages::mysql::infra {
 
 using Counter = utils::statistics::RelaxedCounter<std::uint64_t>;
 
+struct StatementsCacheStatistics final {
+  Counter hits{};
+  Counter misses{};
+  Counter evictions{};
+};
+
 struct PoolConnectionStatistics final {
   Counter overload{};
   Counter closed{};
   Counter created{};
   Counter acquired{};
   Counter released{};
+
+  StatementsCacheStatistics statements_cache{};
 };
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const StatementsCacheStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolConnectionStatistics& stats);
 
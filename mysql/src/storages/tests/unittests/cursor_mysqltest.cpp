@@ -47,6 +47,44 @@ UTEST(Cursor, Works) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, Batches) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 20;
+  constexpr std::size_t batch_size = 7;
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back(
+        {static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+
+    cluster->ExecuteDecompose(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        rows_to_insert.back());
+  }
+
+  std::vector<Row> db_rows;
+  db_rows.reserve(rows_count);
+  std::vector<std::size_t> batch_sizes;
+
+  cluster
+      ->GetCursor<Row>(
+          ClusterHostType::kPrimary, batch_size,
+          table.FormatWithTableName("SELECT Id, Value FROM {} ORDER BY Id"))
+      .ForEachBatch(
+          [&](std::vector<Row>&& rows) {
+            batch_sizes.push_back(rows.size());
+            db_rows.insert(db_rows.end(), std::make_move_iterator(rows.begin()),
+                           std::make_move_iterator(rows.end()));
+          },
+          cluster.GetDeadline());
+  EXPECT_EQ(db_rows, rows_to_insert);
+  EXPECT_EQ(batch_sizes, (std::vector<std::size_t>{7, 7, 6}));
+}
+
 // https://bugs.mysql.com/bug.php?id=109380
 UTEST(Cursor, StatementReuseWorks) {
   ClusterWrapper cluster{};
@@ -7,9 +7,11 @@
 
 #include <chrono>
 #include <map>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -17,6 +19,8 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/component.hpp>
@@ -26,6 +30,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -63,6 +68,23 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL, 0 to fetch all rows in one request | 1000
+/// full-update-parse-tasks | number of tasks that convert the rows of a full update concurrently with fetching the next chunks, 0 to convert in the updating task | 0
+///
+/// @section pg_cc_pipelined_full_update Pipelined full update
+///
+/// By default the updating task fetches a chunk of rows, converts it and
+/// inserts the values into the container, and only then fetches the next
+/// chunk. With a non-zero `full-update-parse-tasks` a full update runs as a
+/// pipeline: one task fetches the chunks through a portal, the specified
+/// number of tasks convert the rows to the `ValueType`, and the updating task
+/// inserts the values into the container. That speeds up the full updates of
+/// the big caches, including the first update that may block the startup.
+///
+/// The chunks are converted in no particular order, so if the query returns
+/// multiple rows with the same key, any of them may get into the cache.
+/// The option requires a non-zero `chunk-size` and does not affect the
+/// incremental updates. A custom CacheContainer may finish the building of
+/// its data, e.g. sort it, in OnWritesDone.
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -417,6 +439,15 @@ class PostgreCache final
                     cache::UpdateStatisticsScope& stats_scope,
                     tracing::ScopeTime& scope);
 
+  std::size_t FetchAndCachePipelined(
+      const storages::postgres::Query& query,
+      const storages::postgres::CommandControl& cmd_ctl,
+      const UpdatedFieldType& last_updated, CachedData& data_cache,
+      cache::UpdateStatisticsScope& stats_scope);
+  std::vector<ValueType> ParseResults(
+      storages::postgres::ResultSet res,
+      cache::UpdateStatisticsScope& stats_scope) const;
+
   static storages::postgres::Query GetAllQuery();
   static storages::postgres::Query GetDeltaQuery();
 
@@ -428,6 +459,7 @@ class PostgreCache final
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::size_t full_update_parse_tasks_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -447,7 +479,9 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      full_update_parse_tasks_{
+          config["full-update-parse-tasks"].As<size_t>(0)} {
   if (this->GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !kIncrementalUpdates) {
@@ -462,6 +496,11 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
         "config for '" +
         config.Name() + "' cache");
   }
+  if (full_update_parse_tasks_ > 0 && chunk_size_ == 0) {
+    throw std::logic_error(
+        "Pipelined full updates require a non-zero chunk-size in config for '" +
+        config.Name() + "' cache");
+  }
 
   const auto pg_alias = config["pgcomponent"].As<std::string>("");
   if (pg_alias.empty()) {
@@ -567,47 +606,53 @@ void PostgreCache<PostgreCachePolicy>::Update(
 
   scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
+  const pg::CommandControl cmd_ctl{timeout,
+                                   pg_cache::detail::kStatementTimeoutOff};
   size_t changes = 0;
-  // Iterate clusters
-  for (auto& cluster : clusters_) {
-    if (chunk_size_ > 0) {
-      auto trx = cluster->Begin(
-          kClusterHostTypeFlags, pg::Transaction::RO,
-          pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
-      auto portal =
-          trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-      while (portal) {
-        scope.Reset(std::string{pg_cache::detail::kFetchStage});
-        auto res = portal.Fetch(chunk_size_);
+  if (type == cache::UpdateType::kFull && full_update_parse_tasks_ > 0) {
+    changes = FetchAndCachePipelined(query, cmd_ctl,
+                                     GetLastUpdated(last_update, *data_cache),
+                                     data_cache, stats_scope);
+  } else {
+    // Iterate clusters
+    for (auto& cluster : clusters_) {
+      if (chunk_size_ > 0) {
+        auto trx =
+            cluster->Begin(kClusterHostTypeFlags, pg::Transaction::RO, cmd_ctl);
+        auto portal =
+            trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
+        while (portal) {
+          scope.Reset(std::string{pg_cache::detail::kFetchStage});
+          auto res = portal.Fetch(chunk_size_);
+          stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+          scope.Reset(std::string{pg_cache::detail::kParseStage});
+          CacheResults(res, data_cache, stats_scope, scope);
+          changes += res.Size();
+        }
+        trx.Commit();
+      } else {
+        bool has_parameter = query.Statement().find('$') != std::string::npos;
+        auto res =
+            has_parameter
+                ? cluster->Execute(kClusterHostTypeFlags, cmd_ctl, query,
+                                   GetLastUpdated(last_update, *data_cache))
+                : cluster->Execute(kClusterHostTypeFlags, cmd_ctl, query);
         stats_scope.IncreaseDocumentsReadCount(res.Size());
 
         scope.Reset(std::string{pg_cache::detail::kParseStage});
         CacheResults(res, data_cache, stats_scope, scope);
         changes += res.Size();
       }
-      trx.Commit();
-    } else {
-      bool has_parameter = query.Statement().find('$') != std::string::npos;
-      auto res = has_parameter
-                     ? cluster->Execute(
-                           kClusterHostTypeFlags,
-                           pg::CommandControl{
-                               timeout, pg_cache::detail::kStatementTimeoutOff},
-                           query, GetLastUpdated(last_update, *data_cache))
-                     : cluster->Execute(
-                           kClusterHostTypeFlags,
-                           pg::CommandControl{
-                               timeout, pg_cache::detail::kStatementTimeoutOff},
-                           query);
-      stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-      scope.Reset(std::string{pg_cache::detail::kParseStage});
-      CacheResults(res, data_cache, stats_scope, scope);
-      changes += res.Size();
     }
   }
 
   scope.Reset();
+  // the pipelined update is accounted as a fetch as a whole
+  stats_scope.AddFetchTime(
+      scope.ElapsedTotal(std::string{pg_cache::detail::kFetchStage}));
+  stats_scope.AddParseTime(
+      scope.ElapsedTotal(std::string{pg_cache::detail::kParseStage}));
 
   if constexpr (pg_cache::detail::kIsContainerCopiedByElement<DataType>) {
     if (old_size > 0) {
@@ -674,6 +719,103 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
   }
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchAndCachePipelined(
+    const storages::postgres::Query& query,
+    const storages::postgres::CommandControl& cmd_ctl,
+    const UpdatedFieldType& last_updated, CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope) {
+  namespace pg = storages::postgres;
+  // ResultSet is not default constructible
+  using ChunksQueue = concurrent::SpmcQueue<std::optional<pg::ResultSet>>;
+  using ValuesQueue = concurrent::NonFifoMpscQueue<std::vector<ValueType>>;
+
+  // Bounds the memory taken by the fetched and not yet inserted chunks
+  const auto chunks = ChunksQueue::Create(full_update_parse_tasks_);
+  const auto values = ValuesQueue::Create(full_update_parse_tasks_);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(full_update_parse_tasks_ + 1);
+  tasks.push_back(utils::Async(
+      "pg-cache-fetch", [this, &query, &cmd_ctl, &last_updated, &stats_scope,
+                         producer = chunks->GetProducer()] {
+        for (auto& cluster : clusters_) {
+          auto trx = cluster->Begin(kClusterHostTypeFlags, pg::Transaction::RO,
+                                    cmd_ctl);
+          auto portal = trx.MakePortal(query, last_updated);
+          while (portal) {
+            auto res = portal.Fetch(chunk_size_);
+            stats_scope.IncreaseDocumentsReadCount(res.Size());
+            // the consumers are gone only if the update has failed
+            if (!producer.Push(std::move(res))) return;
+          }
+          trx.Commit();
+        }
+      }));
+  for (std::size_t i = 0; i < full_update_parse_tasks_; ++i) {
+    tasks.push_back(utils::Async(
+        "pg-cache-parse", [this, &stats_scope,
+                           consumer = chunks->GetMultiConsumer(),
+                           producer = values->GetMultiProducer()] {
+          std::optional<pg::ResultSet> res;
+          while (consumer.Pop(res)) {
+            auto parsed = ParseResults(std::move(*res), stats_scope);
+            if (!producer.Push(std::move(parsed))) return;
+          }
+        }));
+  }
+
+  std::size_t changes = 0;
+  {
+    // Pop returns false when all the producing tasks have finished
+    const auto consumer = values->GetConsumer();
+    std::vector<ValueType> parsed;
+    utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+    while (consumer.Pop(parsed)) {
+      changes += parsed.size();
+      for (auto& value : parsed) {
+        relax.Relax();
+        try {
+          using pg_cache::detail::CacheInsertOrAssign;
+          CacheInsertOrAssign(*data_cache, std::move(value),
+                              PostgreCachePolicy::kKeyMember);
+        } catch (const std::exception& e) {
+          stats_scope.IncreaseDocumentsParseFailures(1);
+          LOG_ERROR() << "Error inserting data row in cache '" << kName
+                      << "': " << e.what();
+        }
+      }
+    }
+  }
+
+  // rethrows the fetch errors
+  for (auto& task : tasks) task.Get();
+  return changes;
+}
+
+template <typename PostgreCachePolicy>
+std::vector<typename PostgreCache<PostgreCachePolicy>::ValueType>
+PostgreCache<PostgreCachePolicy>::ParseResults(
+    storages::postgres::ResultSet res,
+    cache::UpdateStatisticsScope& stats_scope) const {
+  std::vector<ValueType> parsed;
+  parsed.reserve(res.Size());
+
+  auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
+  utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+  for (auto p = values.begin(); p != values.end(); ++p) {
+    relax.Relax();
+    try {
+      parsed.push_back(pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+    } catch (const std::exception& e) {
+      stats_scope.IncreaseDocumentsParseFailures(1);
+      LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                  << compiler::GetTypeName<ValueType>() << "': " << e.what();
+    }
+  }
+  return parsed;
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type,
@@ -3,6 +3,7 @@
 /// @file userver/storages/postgres/cluster.hpp
 /// @brief @copybrief storages::postgres::Cluster
 
+#include <functional>
 #include <memory>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -16,8 +17,10 @@
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/database.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -193,6 +196,64 @@ class Cluster {
   ResultSet Execute(ClusterHostTypeFlags flags,
                     OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
+
+  /// @brief Execute a read-only statement at a replica and, if there is no
+  /// result after the `hedging_settings` delay, at one more replica.
+  ///
+  /// The first successful result is returned and the other statement is
+  /// cancelled. If the first completed statement fails, the result of the
+  /// other one is awaited. The statement is executed without hedging if
+  /// there is a single replica or the hedging budget of the cluster is
+  /// exhausted, see HedgingSettings::max_hedged_ratio.
+  ///
+  /// @note You must specify only the replica roles from ClusterHostType here
+  ///
+  /// @warning The statement may be executed twice, so it must not modify
+  /// anything.
+  template <typename... Args>
+  ResultSet ExecuteHedged(ClusterHostTypeFlags, OptionalCommandControl,
+                          const HedgingSettings& hedging_settings,
+                          const Query& query, const Args&... args);
+
+  /// @brief Execute a read-only statement with stored arguments at a replica
+  /// and, if there is no result after the `hedging_settings` delay, at one
+  /// more replica.
+  ///
+  /// @see ExecuteHedged
+  ResultSet ExecuteHedged(ClusterHostTypeFlags flags,
+                          OptionalCommandControl statement_cmd_ctl,
+                          const HedgingSettings& hedging_settings,
+                          const Query& query, const ParameterStore& store);
+  /// @}
+
+  /// @name Batch of single-statement queries
+  /// @{
+
+  /// @brief Create a queue of statements that are sent at once to a host of
+  /// specified type, see storages::postgres::QueryQueue.
+  /// @note You must specify at least one role from ClusterHostType here
+  ///
+  /// @snippet storages/postgres/tests/query_queue_pgtest.cpp QueryQueue
+  QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags);
+
+  /// @brief Create a queue of statements with specified host selection rules
+  /// and command control settings for the whole batch.
+  /// @note You must specify at least one role from ClusterHostType here
+  QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags,
+                              OptionalCommandControl cmd_ctl);
+  /// @}
+
+  /// @name Asynchronous notifications
+  /// @{
+
+  /// @brief Subscribe to the notifications of the channel on the master
+  /// host, see storages::postgres::NotifyScope.
+  ///
+  /// The subscription holds a connection of the pool while it is alive.
+  ///
+  /// @snippet storages/postgres/tests/notify_pgtest.cpp Listen
+  NotifyScope Listen(std::string_view channel,
+                     OptionalCommandControl cmd_ctl = {});
   /// @}
 
   /// Replaces globally updated command control with a static user-provided one
@@ -224,6 +285,12 @@ class Cluster {
  private:
   detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  using HedgedStatement = std::function<ResultSet(detail::NonTransaction&)>;
+  ResultSet DoExecuteHedged(ClusterHostTypeFlags, OptionalCommandControl,
+                            const HedgingSettings& hedging_settings,
+                            const Query& query,
+                            const HedgedStatement& statement);
+
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
       OptionalCommandControl cmd_ctl) const;
@@ -249,6 +316,22 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
+template <typename... Args>
+ResultSet Cluster::ExecuteHedged(ClusterHostTypeFlags flags,
+                                 OptionalCommandControl statement_cmd_ctl,
+                                 const HedgingSettings& hedging_settings,
+                                 const Query& query, const Args&... args) {
+  if (!statement_cmd_ctl && query.GetName()) {
+    statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
+  }
+  statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  return DoExecuteHedged(
+      flags, statement_cmd_ctl, hedging_settings, query,
+      [&](detail::NonTransaction& ntrx) {
+        return ntrx.Execute(statement_cmd_ctl, query, args...);
+      });
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
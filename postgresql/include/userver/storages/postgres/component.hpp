@@ -124,11 +124,13 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query| false
 /// monitoring-dbalias      | name of the database for monitorings                      | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                      | 5000
+/// warmup-prepared-statements | count of the recently used statements prepared on new connections in advance | 0
 /// max_statement_metrics   | limit of exported metrics for named statements            | 0
 /// min_pool_size           | number of connections created initially                   | 4
 /// max_pool_size           | maximum number of created connections                     | 15
 /// max_queue_size          | maximum number of clients waiting for a connection        | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// spare_pool_size         | number of idle connections established in advance on top of the connections in use | 0
 /// connlimit_mode          | max_connections setup mode (manual or auto)               | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings | --
 
@@ -0,0 +1,216 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Binary COPY FROM STDIN / TO STDOUT
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Writer of the rows of `COPY ... FROM STDIN (FORMAT binary)`
+///
+/// Rows are encoded with the same io::BufferFormatter as the query
+/// parameters and are sent to the server in chunks. The copy is in flight
+/// until Finish() is called, the connection can't execute other queries
+/// meanwhile. A writer destroyed without Finish() aborts the copy.
+///
+/// Obtained via storages::postgres::Transaction::CopyFrom.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyFrom
+class CopyWriter {
+ public:
+  CopyWriter(detail::Connection* conn, const Query& query,
+             OptionalCommandControl cmd_ctl = {});
+
+  CopyWriter(CopyWriter&&) noexcept;
+  CopyWriter& operator=(CopyWriter&&) noexcept;
+
+  CopyWriter(const CopyWriter&) = delete;
+  CopyWriter& operator=(const CopyWriter&) = delete;
+
+  ~CopyWriter();
+
+  /// Write a row of the column values, in the order of the COPY columns
+  template <typename... Columns>
+  void Write(const Columns&... columns);
+
+  /// Write a row type: std::tuple, an aggregate or a type with Introspect()
+  template <typename Row>
+  void WriteRow(const Row& row);
+
+  /// Write every row type of the container
+  template <typename Container>
+  void WriteRows(const Container& rows);
+
+  /// Send the rest of the rows and wait for the command completion
+  /// @returns count of the copied rows as reported by the server
+  std::size_t Finish();
+
+  std::size_t RowsWrittenSoFar() const { return rows_; }
+
+ private:
+  template <typename T>
+  void WriteField(const T& value);
+
+  template <typename Tuple, std::size_t... Indices>
+  void WriteTuple(const Tuple& tuple, std::index_sequence<Indices...>);
+
+  void Swap(CopyWriter& other) noexcept;
+  void StartRow(std::size_t columns);
+  void EndRow();
+  void Flush();
+  const UserTypes& GetUserTypes() const;
+
+  detail::Connection* conn_{nullptr};
+  OptionalCommandControl cmd_ctl_;
+  std::string buffer_;
+  std::size_t rows_{0};
+};
+
+/// @brief Reader of the rows of `COPY ... TO STDOUT (FORMAT binary)`
+///
+/// Rows are decoded with the same io::BufferParser as the result sets. The
+/// binary COPY contains no type information, so the C++ types must exactly
+/// match the column types. The copy is in flight until the reader returns
+/// false, the connection can't execute other queries meanwhile. A connection
+/// with a partially read copy is closed after the transaction.
+///
+/// Obtained via storages::postgres::Transaction::CopyTo.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyTo
+class CopyReader {
+ public:
+  CopyReader(detail::Connection* conn, const Query& query,
+             OptionalCommandControl cmd_ctl = {});
+
+  CopyReader(CopyReader&&) noexcept;
+  CopyReader& operator=(CopyReader&&) noexcept;
+
+  CopyReader(const CopyReader&) = delete;
+  CopyReader& operator=(const CopyReader&) = delete;
+
+  ~CopyReader();
+
+  /// Read the next row into the column values
+  /// @returns false if there are no more rows
+  template <typename... Columns>
+  bool Read(Columns&... columns);
+
+  /// Read the next row into a row type: std::tuple, an aggregate or a type
+  /// with Introspect()
+  /// @returns false if there are no more rows
+  template <typename Row>
+  bool ReadRow(Row& row);
+
+  bool Done() const { return done_; }
+  std::size_t RowsReadSoFar() const { return rows_; }
+
+ private:
+  template <typename T>
+  void ReadField(T& value);
+
+  template <typename Tuple, std::size_t... Indices>
+  void ReadTuple(Tuple&& tuple, std::index_sequence<Indices...>);
+
+  void Swap(CopyReader& other) noexcept;
+  bool FetchRow(std::size_t columns);
+  void ReadHeader();
+  std::int16_t ReadFieldCount();
+
+  detail::Connection* conn_{nullptr};
+  OptionalCommandControl cmd_ctl_;
+  const io::TypeBufferCategory* categories_{nullptr};
+  std::string buffer_;
+  std::size_t position_{0};
+  std::size_t rows_{0};
+  bool header_read_{false};
+  bool done_{false};
+};
+
+template <typename... Columns>
+void CopyWriter::Write(const Columns&... columns) {
+  StartRow(sizeof...(Columns));
+  (WriteField(columns), ...);
+  EndRow();
+}
+
+template <typename Row>
+void CopyWriter::WriteRow(const Row& row) {
+  static_assert(io::traits::kIsRowType<Row>,
+                "Row type must be a std::tuple, an aggregate or a type with "
+                "Introspect()");
+  using RowType = io::RowType<Row>;
+  StartRow(RowType::size);
+  WriteTuple(RowType::GetTuple(row), typename RowType::IndexSequence{});
+  EndRow();
+}
+
+template <typename Container>
+void CopyWriter::WriteRows(const Container& rows) {
+  for (const auto& row : rows) {
+    WriteRow(row);
+  }
+}
+
+template <typename T>
+void CopyWriter::WriteField(const T& value) {
+  static_assert(io::traits::kIsMappedToPg<T>,
+                "Type doesn't have mapping to Postgres type");
+  io::WriteRawBinary(GetUserTypes(), buffer_, value);
+}
+
+template <typename Tuple, std::size_t... Indices>
+void CopyWriter::WriteTuple(const Tuple& tuple,
+                            std::index_sequence<Indices...>) {
+  (WriteField(std::get<Indices>(tuple)), ...);
+}
+
+template <typename... Columns>
+bool CopyReader::Read(Columns&... columns) {
+  if (!FetchRow(sizeof...(Columns))) return false;
+  (ReadField(columns), ...);
+  return true;
+}
+
+template <typename Row>
+bool CopyReader::ReadRow(Row& row) {
+  static_assert(io::traits::kIsRowType<Row>,
+                "Row type must be a std::tuple, an aggregate or a type with "
+                "Introspect()");
+  using RowType = io::RowType<Row>;
+  if (!FetchRow(RowType::size)) return false;
+  ReadTuple(RowType::GetTuple(row), typename RowType::IndexSequence{});
+  return true;
+}
+
+template <typename T>
+void CopyReader::ReadField(T& value) {
+  static_assert(io::traits::kHasParser<T>,
+                "Type doesn't have a parser from Postgres buffer");
+  io::FieldBuffer buffer{
+      false, io::traits::kTypeBufferCategory<T>, buffer_.size() - position_,
+      reinterpret_cast<const std::uint8_t*>(buffer_.data()) + position_};
+  position_ += buffer.ReadRaw(value, *categories_);
+}
+
+template <typename Tuple, std::size_t... Indices>
+void CopyReader::ReadTuple(Tuple&& tuple, std::index_sequence<Indices...>) {
+  (ReadField(std::get<Indices>(tuple)), ...);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -23,6 +23,11 @@ class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
   void Acquire(std::chrono::milliseconds lock_ttl,
                const std::string& locker_id) override;
 
+  /// The fencing token is the id of the acquiring transaction
+  std::optional<dist_lock::FencingToken> AcquireWithFencingToken(
+      std::chrono::milliseconds lock_ttl,
+      const std::string& locker_id) override;
+
   void Release(const std::string& locker_id) override;
 
   void UpdateCommandControl(CommandControl cc);
@@ -6,6 +6,7 @@
 /// @ingroup userver_postgres_parse_and_format
 
 #include <array>
+#include <cstring>
 #include <iterator>
 #include <set>
 #include <unordered_set>
@@ -145,6 +146,57 @@ inline bool ForceInitElementMapping() {
   }
 }
 
+/// Fixed-width element types that are parsed in bulk, without the per-element
+/// parser dispatch
+template <typename T>
+inline constexpr bool kIsBulkParsedElement =
+    std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+    std::is_same_v<T, Bigint> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double>;
+
+template <typename T>
+T ParseBulkElement(const std::uint8_t* data) {
+  using IntType = typename IntegralType<sizeof(T)>::type;
+  IntType int_value;
+  std::memcpy(&int_value, data, sizeof(T));
+  int_value = boost::endian::big_to_native(int_value);
+  if constexpr (std::is_same_v<T, IntType>) {
+    return int_value;
+  } else {
+    T value;
+    std::memcpy(&value, &int_value, sizeof(T));
+    return value;
+  }
+}
+
+/// Parses the leading elements that have exactly the width of T and consumes
+/// them from the buffer. Returns the count of the parsed elements, the rest
+/// of them (NULLs or elements of other width) are parsed in a generic way.
+template <typename T>
+std::size_t ReadBulkElements(FieldBuffer& buffer, std::size_t count,
+                             std::vector<T>& elements) {
+  constexpr std::size_t kElementSize = sizeof(Integer) + sizeof(T);
+  // each element is prefixed with its length, so the buffer is checked once
+  // for the case of all the elements being of the expected width
+  if (buffer.length / kElementSize < count) return 0;
+
+  elements.resize(count);
+  const auto* data = buffer.buffer;
+  std::size_t parsed = 0;
+  for (; parsed < count; ++parsed, data += kElementSize) {
+    if (ParseBulkElement<Integer>(data) != static_cast<Integer>(sizeof(T))) {
+      break;
+    }
+    elements[parsed] = ParseBulkElement<T>(data + sizeof(Integer));
+  }
+  elements.resize(parsed);
+
+  const auto consumed = parsed * kElementSize;
+  buffer.buffer += consumed;
+  buffer.length -= consumed;
+  return parsed;
+}
+
 template <typename Container>
 struct ArrayBinaryParser : BufferParserBase<Container> {
   using BaseType = BufferParserBase<Container>;
@@ -269,6 +321,20 @@ struct ArrayBinaryParser : BufferParserBase<Container> {
     }
   }
 
+  template <typename T>
+  std::enable_if_t<kIsBulkParsedElement<T>> ReadDimension(
+      FieldBuffer& buffer, DimensionConstIterator dim,
+      BufferCategory elem_category, const TypeBufferCategory& categories,
+      std::vector<T>& elem) {
+    elem.clear();
+    elem.reserve(*dim);
+    for (auto i = ReadBulkElements(buffer, *dim, elem); i < *dim; ++i) {
+      T val;
+      buffer.ReadRaw(val, categories, elem_category);
+      elem.push_back(val);
+    }
+  }
+
   void ReadDimension(FieldBuffer& buffer, DimensionConstIterator dim,
                      BufferCategory elem_category,
                      const TypeBufferCategory& categories,
@@ -0,0 +1,63 @@
+#pragma once
+
+/// @file userver/storages/postgres/notify.hpp
+/// @brief Asynchronous notifications
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Asynchronous notification sent by NOTIFY or pg_notify
+struct Notification {
+  /// Name of the channel the notification was sent to
+  std::string channel;
+  /// Payload of the notification, absent if empty
+  std::optional<std::string> payload;
+};
+
+/// @brief RAII subscription to the notifications of a channel.
+///
+/// The subscription holds a dedicated connection from the pool, the
+/// connection is returned to the pool on the scope destruction after
+/// UNLISTEN. The notifications of the channel that arrive while the scope is
+/// alive are queued by the connection until they are taken by WaitNotify().
+///
+/// Obtained via storages::postgres::Cluster::Listen.
+///
+/// @snippet storages/postgres/tests/notify_pgtest.cpp Listen
+class NotifyScope final {
+ public:
+  NotifyScope(detail::ConnectionPtr conn, std::string_view channel,
+              OptionalCommandControl cmd_ctl);
+
+  NotifyScope(NotifyScope&&) noexcept;
+  NotifyScope& operator=(NotifyScope&&) noexcept;
+
+  NotifyScope(const NotifyScope&) = delete;
+  NotifyScope& operator=(const NotifyScope&) = delete;
+
+  ~NotifyScope();
+
+  /// @brief Wait for the next notification of the channel
+  /// @throws ConnectionTimeoutError if no notification arrives until the
+  /// deadline
+  /// @throws ConnectionInterrupted if the current task is cancelled
+  Notification WaitNotify(engine::Deadline deadline);
+
+ private:
+  detail::ConnectionPtr conn_;
+  std::string channel_;
+  OptionalCommandControl cmd_ctl_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -152,6 +152,23 @@ OptionalCommandControl GetHandlerOptionalCommandControl(
 OptionalCommandControl GetQueryOptionalCommandControl(
     const CommandControlByQueryMap& map, const std::string& query_name);
 
+/// Settings of storages::postgres::Cluster::ExecuteHedged
+struct HedgingSettings final {
+  /// Delay after which the statement is sent to one more replica if there is
+  /// still no result from the first one
+  std::chrono::milliseconds delay{50};
+
+  /// If set, the delay is this percentile (e.g. 95) of the recent timings of
+  /// the named statement on the first replica, and `delay` is used for the
+  /// unnamed statements and until there are any timings.
+  /// @see StatementMetricsSettings
+  std::optional<double> delay_percentile;
+
+  /// Max ratio of the duplicate statements to all the hedged ones of the
+  /// cluster, limits the extra load on the replicas when all of them are slow
+  double max_hedged_ratio{0.1};
+};
+
 struct TopologySettings {
   std::chrono::milliseconds max_replication_lag{0};
 };
@@ -168,6 +185,9 @@ static constexpr size_t kDefaultPoolMaxQueueSize = 200;
 /// Default limit for concurrent establishing connections number
 static constexpr size_t kDefaultConnectingLimit = 0;
 
+/// Default number of idle connections established in advance
+static constexpr size_t kDefaultPoolSpareSize = 0;
+
 /// @brief PostgreSQL connection pool options
 ///
 /// Dynamic option @ref POSTGRES_CONNECTION_POOL_SETTINGS
@@ -184,10 +204,16 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Number of idle connections that are established in advance on top of
+  /// the connections in use, so that a growth of load does not wait for new
+  /// connections to be opened. Limited by max_size.
+  size_t spare_size{kDefaultPoolSpareSize};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           spare_size == rhs.spare_size;
   }
 };
 
@@ -235,6 +261,10 @@ struct ConnectionSettings {
   /// This many connection errors in 15 seconds block new connections opening
   size_t recent_errors_threshold = 2;
 
+  /// This many of the most recently used prepared statements of the pool are
+  /// prepared on the new connections before they are used (0 - disabled)
+  size_t warmup_prepared_statements = 0;
+
   /// Helps keep track of the changes in settings
   SettingsVersion version{0U};
 
@@ -244,7 +274,8 @@ struct ConnectionSettings {
            ignore_unused_query_params == rhs.ignore_unused_query_params &&
            max_prepared_cache_size == rhs.max_prepared_cache_size &&
            pipeline_mode == rhs.pipeline_mode &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           warmup_prepared_statements == rhs.warmup_prepared_statements;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
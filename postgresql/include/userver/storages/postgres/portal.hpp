@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -46,6 +47,30 @@ class Portal {
 
   explicit operator bool() const { return !Done(); }
 
+  /// @brief Fetch the rest of the rows by chunks of `n_rows` rows and pass
+  /// each chunk as a `const ResultSet&` to `func`.
+  ///
+  /// A chunk is released before fetching the next one, so the memory used by
+  /// the result is bounded by the chunk size.
+  /// @returns count of the fetched rows
+  template <typename Func>
+  std::size_t ForEachChunk(std::uint32_t n_rows, Func&& func);
+
+  /// @brief Fetch the rest of the rows by chunks of `n_rows` rows and append
+  /// them to the container, like ResultSet::AsContainer.
+  ///
+  /// Only a single chunk of the result is held along with the container,
+  /// unlike ResultSet::AsContainer that needs the whole result.
+  ///
+  /// @snippet storages/postgres/tests/portal_pgtest.cpp FetchAllInto
+  template <typename Container>
+  void FetchAllInto(Container& container, std::uint32_t n_rows);
+
+  /// @brief Fetch the rest of the rows by chunks of `n_rows` rows and append
+  /// them to the container as row types, like ResultSet::AsContainer(RowTag).
+  template <typename Container>
+  void FetchAllInto(Container& container, std::uint32_t n_rows, RowTag);
+
  private:
   static constexpr std::size_t kImplSize = 88;
   static constexpr std::size_t kImplAlign = 8;
@@ -54,6 +79,38 @@ class Portal {
   USERVER_NAMESPACE::utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
 
+template <typename Func>
+std::size_t Portal::ForEachChunk(std::uint32_t n_rows, Func&& func) {
+  const auto fetched_before = FetchedSoFar();
+  while (!Done()) {
+    const auto chunk = Fetch(n_rows);
+    if (chunk.IsEmpty()) break;
+    func(chunk);
+  }
+  return FetchedSoFar() - fetched_before;
+}
+
+template <typename Container>
+void Portal::FetchAllInto(Container& container, std::uint32_t n_rows) {
+  detail::AssertSaneTypeToDeserialize<Container>();
+  using ValueType = typename Container::value_type;
+  ForEachChunk(n_rows, [&container](const ResultSet& chunk) {
+    auto rows = chunk.AsSetOf<ValueType>();
+    std::copy(rows.begin(), rows.end(), io::traits::Inserter(container));
+  });
+}
+
+template <typename Container>
+void Portal::FetchAllInto(Container& container, std::uint32_t n_rows,
+                          RowTag) {
+  detail::AssertSaneTypeToDeserialize<Container>();
+  using ValueType = typename Container::value_type;
+  ForEachChunk(n_rows, [&container](const ResultSet& chunk) {
+    auto rows = chunk.AsSetOf<ValueType>(kRowTag);
+    std::copy(rows.begin(), rows.end(), io::traits::Inserter(container));
+  });
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -32,7 +32,15 @@
 /// - Query result extraction to C++ types;
 /// - Binary protocol usage for communication;
 /// - Portals for effective background cache updates;
-/// - Queries pipelining;
+/// - Binary `COPY FROM STDIN` / `COPY TO STDOUT` for the bulk imports and
+///   exports, see storages::postgres::Transaction::CopyFrom and
+///   storages::postgres::Transaction::CopyTo;
+/// - Queries pipelining, several statements in a roundtrip via
+///   storages::postgres::QueryQueue;
+/// - Short-living cache of the read-only queries results,
+///   storages::postgres::ResultCache;
+/// - Asynchronous notifications via LISTEN/NOTIFY, see
+///   storages::postgres::Cluster::Listen;
 /// - Mapping PostgreSQL user types to C++ types.
 ///
 /// @section toc More information
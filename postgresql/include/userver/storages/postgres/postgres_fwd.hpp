@@ -23,6 +23,7 @@ using ClusterPtr = std::shared_ptr<Cluster>;
 namespace detail {
 class Connection;
 class ConnectionImpl;
+class StatementTimer;
 class ConnectionPtr;
 using ConnectionCallback = std::function<void(Connection*)>;
 
@@ -0,0 +1,90 @@
+#pragma once
+
+/// @file userver/storages/postgres/query_queue.hpp
+/// @brief @copybrief storages::postgres::QueryQueue
+
+#include <vector>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief A queue of independent statements that are sent to the database at
+/// once.
+///
+/// The statements are executed in a single connection outside of a
+/// transaction. When the connection is in pipeline mode (see PipelineMode),
+/// all the statements are sent without waiting for the results of each other,
+/// so the queue costs a single roundtrip (plus a roundtrip per statement that
+/// is not prepared yet). Such statements are executed by the server in an
+/// implicit transaction, a failed statement aborts the rest of them.
+/// Otherwise the statements are executed one by one, each in its own
+/// auto-commit transaction.
+///
+/// The connection is held by the queue until it is destroyed, so the
+/// queue should be short-living.
+///
+/// Obtained via storages::postgres::Cluster::CreateQueryQueue.
+///
+/// @snippet storages/postgres/tests/query_queue_pgtest.cpp QueryQueue
+class QueryQueue final {
+ public:
+  QueryQueue(detail::ConnectionPtr&& conn, OptionalCommandControl cmd_ctl,
+             detail::SteadyClock::time_point start_time =
+                 detail::SteadyClock::now());
+
+  QueryQueue(QueryQueue&&) noexcept;
+  QueryQueue& operator=(QueryQueue&&) noexcept;
+
+  QueryQueue(const QueryQueue&) = delete;
+  QueryQueue& operator=(const QueryQueue&) = delete;
+
+  ~QueryQueue();
+
+  /// Reserve the space for `size` statements
+  void Reserve(std::size_t size);
+
+  /// Add a statement with arbitrary parameters to the queue. The parameters
+  /// are serialized immediately.
+  template <typename... Args>
+  void Push(const Query& query, const Args&... args);
+
+  /// Returns the count of the statements pushed since the last Collect()
+  std::size_t Size() const { return queries_.size(); }
+
+  /// @brief Execute all the statements of the queue.
+  ///
+  /// Command control of the queue applies to the whole batch.
+  /// @returns a result set per statement, in the order of pushing
+  /// @throws the exception of the first failed statement, the statements
+  /// after it are not executed
+  std::vector<ResultSet> Collect();
+
+ private:
+  const UserTypes& GetConnectionUserTypes() const;
+
+  detail::ConnectionPtr conn_;
+  OptionalCommandControl cmd_ctl_;
+  std::vector<Query> queries_;
+  std::vector<detail::DynamicQueryParameters> params_;
+};
+
+template <typename... Args>
+void QueryQueue::Push(const Query& query, const Args&... args) {
+  detail::DynamicQueryParameters params;
+  params.Write(GetConnectionUserTypes(), args...);
+  queries_.push_back(query);
+  params_.push_back(std::move(params));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#pragma once
+
+/// @file userver/storages/postgres/result_cache.hpp
+/// @brief @copybrief storages::postgres::ResultCache
+
+#include <chrono>
+#include <string>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/storages/postgres/cluster_types.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief storages::postgres::ResultCache options
+struct ResultCacheSettings final {
+  /// Count of the cache ways, accesses to a way are serialized
+  std::size_t ways{16};
+
+  /// Maximum count of the cached results in a way
+  std::size_t way_size{64};
+
+  /// Time during which a cached result is returned without querying the
+  /// database
+  std::chrono::milliseconds lifetime{std::chrono::seconds{1}};
+};
+
+/// @brief Cache of the read-only queries results.
+///
+/// The results are keyed by the query name (by the statement for the unnamed
+/// queries) and by the values of the arguments. Concurrent cache misses of
+/// the same key are coalesced into a single database query.
+///
+/// The cached results are not invalidated when the data changes, so the cache
+/// suits the queries that tolerate the data staleness for the `lifetime`,
+/// e.g. the dictionaries. Call Invalidate() to drop all the results.
+///
+/// As in storages::postgres::ParameterStore, only the built-in types are
+/// supported as the arguments.
+///
+/// @snippet storages/postgres/tests/cluster_pgtest.cpp ResultCache
+class ResultCache final {
+ public:
+  ResultCache(ClusterPtr cluster, const ResultCacheSettings& settings);
+
+  ResultCache(const ResultCache&) = delete;
+  ResultCache& operator=(const ResultCache&) = delete;
+
+  ~ResultCache();
+
+  /// @brief Return the cached result of the statement or execute it at host
+  /// of specified type.
+  template <typename... Args>
+  ResultSet Execute(ClusterHostTypeFlags flags, const Query& query,
+                    const Args&... args);
+
+  /// @brief Return the cached result of the statement with stored arguments
+  /// or execute it at host of specified type.
+  ResultSet Execute(ClusterHostTypeFlags flags, const Query& query,
+                    ParameterStore&& store);
+
+  /// Drop all the cached results
+  void Invalidate();
+
+  /// Apply the new settings, the count of ways is not changed
+  void SetSettings(const ResultCacheSettings& settings);
+
+  /// @cond
+  const cache::impl::ExpirableLruCacheStatistics& GetStatistics() const;
+  /// @endcond
+
+ private:
+  ClusterPtr cluster_;
+  cache::ExpirableLruCache<std::string, ResultSet> cache_;
+};
+
+/// @brief ResultCache statistics support for utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const ResultCache& cache);
+
+template <typename... Args>
+ResultSet ResultCache::Execute(ClusterHostTypeFlags flags, const Query& query,
+                               const Args&... args) {
+  ParameterStore store;
+  (store.PushBack(args), ...);
+  return Execute(flags, query, std::move(store));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
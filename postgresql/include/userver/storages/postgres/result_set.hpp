@@ -671,6 +671,7 @@ class ResultSet {
   template <typename T, typename Tag>
   friend class TypedResultSet;
   friend class ConnectionImpl;
+  friend class detail::StatementTimer;
 
   std::shared_ptr<detail::ResultWrapper> pimpl_;
 };
@@ -9,6 +9,7 @@
 #include <userver/storages/postgres/detail/time_types.hpp>
 
 #include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
@@ -19,6 +20,36 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+/// @brief Statistics of the executions of a named statement
+struct StatementStatistics {
+  /// Latencies of the successful executions in milliseconds
+  using LatencyHistogram =
+      USERVER_NAMESPACE::utils::statistics::HdrHistogram<60'000, 2>;
+
+  /// Number of successful executions
+  std::uint64_t executed{0};
+  /// Number of failed executions
+  std::uint64_t errors{0};
+  /// Number of executions that had to parse (prepare) the statement
+  std::uint64_t parsed{0};
+  /// Number of rows returned
+  std::uint64_t rows{0};
+  /// Total size of the results received, in bytes
+  std::uint64_t result_bytes{0};
+  /// Latencies of the successful executions
+  LatencyHistogram timings;
+
+  StatementStatistics& Add(const StatementStatistics& other) {
+    executed += other.executed;
+    errors += other.errors;
+    parsed += other.parsed;
+    rows += other.rows;
+    result_bytes += other.result_bytes;
+    timings.Add(other.timings);
+    return *this;
+  }
+};
+
 /// @brief Template transaction statistics storage
 template <typename Counter, typename PercentileAccumulator>
 struct TransactionStatistics {
@@ -32,6 +63,10 @@ struct TransactionStatistics {
   Counter out_of_trx_total = 0;
   /// Number of parsed queries
   Counter parse_total = 0;
+  /// Number of queries found in prepared statements cache
+  Counter prepared_hit_total = 0;
+  /// Number of statements prepared on new connections in advance
+  Counter prepared_warmup_total = 0;
   /// Number of query executions
   Counter execute_total = 0;
   /// Total number of replies
@@ -167,6 +202,9 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.rollback_total = stats.transaction.rollback_total;
     transaction.out_of_trx_total = stats.transaction.out_of_trx_total;
     transaction.parse_total = stats.transaction.parse_total;
+    transaction.prepared_hit_total = stats.transaction.prepared_hit_total;
+    transaction.prepared_warmup_total =
+        stats.transaction.prepared_warmup_total;
     transaction.execute_total = stats.transaction.execute_total;
     transaction.reply_total = stats.transaction.reply_total;
     transaction.portal_bind_total = stats.transaction.portal_bind_total;
@@ -208,7 +246,18 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     return *this;
   }
 
+  InstanceStatisticsNonatomic& Add(
+      const std::unordered_map<std::string, StatementStatistics>& statements) {
+    for (const auto& [name, stats] : statements) {
+      const auto [it, inserted] = statement_stats.try_emplace(name, stats);
+      if (!inserted) it->second.Add(stats);
+    }
+
+    return *this;
+  }
+
   std::unordered_map<std::string, Percentile> statement_timings;
+  std::unordered_map<std::string, StatementStatistics> statement_stats;
 };
 
 /// @brief Instance statistics with description
@@ -231,6 +280,10 @@ struct ClusterStatistics {
   std::vector<InstanceStatsDescriptor> unknown;
 };
 
+/// @brief StatementStatistics values support for utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const StatementStatistics& stats);
+
 // InstanceStatisticsNonatomic values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const InstanceStatisticsNonatomic& stats);
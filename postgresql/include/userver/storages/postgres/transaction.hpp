@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -101,6 +102,15 @@ namespace storages::postgres {
 /// trx.Commit();
 /// @endcode
 ///
+/// @par Several independent queries
+///
+/// Independent single queries may be sent to the server at once with
+/// storages::postgres::QueryQueue to save the roundtrips. It requires the
+/// pipeline mode (see PipelineMode), otherwise the queries are executed one by
+/// one.
+///
+/// @snippet storages/postgres/tests/query_queue_pgtest.cpp QueryQueue
+///
 /// @see Transaction
 /// @see ResultSet
 ///
@@ -288,6 +298,48 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement, the rows are
+  /// sent with the returned storages::postgres::CopyWriter.
+  ///
+  /// Much faster than INSERT for the bulk imports. The transaction can't
+  /// execute other statements until CopyWriter::Finish() is called.
+  CopyWriter CopyFrom(const Query& query) {
+    return CopyFrom(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement with
+  /// per-statement command control. The network timeout is applied to each
+  /// chunk of the sent data.
+  CopyWriter CopyFrom(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query);
+
+  /// Copy the row types of the container with
+  /// `COPY ... FROM STDIN (FORMAT binary)`
+  /// @returns count of the copied rows
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyRowsFrom
+  template <typename Container>
+  std::size_t CopyRowsFrom(const Query& query, const Container& rows) {
+    auto writer = CopyFrom(query);
+    writer.WriteRows(rows);
+    return writer.Finish();
+  }
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement, the rows are
+  /// received with the returned storages::postgres::CopyReader.
+  ///
+  /// The transaction can't execute other statements until all the rows are
+  /// read.
+  CopyReader CopyTo(const Query& query) {
+    return CopyTo(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement with
+  /// per-statement command control. The network timeout is applied to each
+  /// received row.
+  CopyReader CopyTo(OptionalCommandControl statement_cmd_ctl,
+                    const Query& query);
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -28,6 +28,11 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-parse-tasks:
+        type: integer
+        description: number of tasks that convert the rows of a full update concurrently with fetching the next chunks, 0 to convert in the updating task
+        defaultDescription: 0
+        minimum: 0
     pgcomponent:
         type: string
         description: PostgreSQL component name
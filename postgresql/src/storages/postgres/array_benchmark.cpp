@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/tests/test_buffers.hpp>
+#include <userver/storages/postgres/io/array_types.hpp>
+#include <userver/storages/postgres/io/floating_point_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+namespace io = pg::io;
+using namespace pg::bench;
+
+const pg::UserTypes types;
+
+template <typename T>
+void PgArrayBinaryParse(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<T> src;
+  src.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    src.push_back(static_cast<T>(i));
+  }
+
+  pg::test::Buffer buffer;
+  io::WriteBuffer(types, buffer, src);
+  const auto fb =
+      pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kArrayBuffer);
+  const io::TypeBufferCategory categories;
+
+  std::vector<T> tgt;
+  for (auto _ : state) {
+    io::ReadBuffer(fb, tgt, categories);
+    benchmark::DoNotOptimize(tgt);
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_TEMPLATE(PgArrayBinaryParse, std::int32_t)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(PgArrayBinaryParse, std::int64_t)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(PgArrayBinaryParse, double)->Range(8, 8 << 10);
+
+BENCHMARK_DEFINE_F(PgConnection, Float8ArrayResult)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto size = state.range(0);
+    for (auto _ : state) {
+      auto res = GetConnection().Execute(
+          "select array_agg(i::float8) from generate_series(1, $1) i", size);
+      auto values = res.AsSingleRow<std::vector<double>>();
+      benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, Float8ArrayResult)->Range(8, 8 << 10);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
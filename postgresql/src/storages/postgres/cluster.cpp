@@ -85,6 +85,20 @@ void Cluster::SetStatementMetricsSettings(
   pimpl_->SetStatementMetricsSettings(settings);
 }
 
+QueryQueue Cluster::CreateQueryQueue(ClusterHostTypeFlags flags) {
+  return CreateQueryQueue(flags, OptionalCommandControl{});
+}
+
+QueryQueue Cluster::CreateQueryQueue(ClusterHostTypeFlags flags,
+                                     OptionalCommandControl cmd_ctl) {
+  return pimpl_->CreateQueryQueue(flags, GetHandlersCmdCtl(cmd_ctl));
+}
+
+NotifyScope Cluster::Listen(std::string_view channel,
+                            OptionalCommandControl cmd_ctl) {
+  return pimpl_->Listen(channel, GetHandlersCmdCtl(cmd_ctl));
+}
+
 detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
                                       OptionalCommandControl cmd_ctl) {
   return pimpl_->Start(flags, cmd_ctl);
@@ -116,6 +130,31 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+ResultSet Cluster::ExecuteHedged(ClusterHostTypeFlags flags,
+                                 OptionalCommandControl statement_cmd_ctl,
+                                 const HedgingSettings& hedging_settings,
+                                 const Query& query,
+                                 const ParameterStore& store) {
+  if (!statement_cmd_ctl && query.GetName()) {
+    statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
+  }
+  statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  return DoExecuteHedged(
+      flags, statement_cmd_ctl, hedging_settings, query,
+      [&](detail::NonTransaction& ntrx) {
+        return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
+      });
+}
+
+ResultSet Cluster::DoExecuteHedged(ClusterHostTypeFlags flags,
+                                   OptionalCommandControl statement_cmd_ctl,
+                                   const HedgingSettings& hedging_settings,
+                                   const Query& query,
+                                   const HedgedStatement& statement) {
+  return pimpl_->ExecuteHedged(flags, statement_cmd_ctl, hedging_settings,
+                               query, statement);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
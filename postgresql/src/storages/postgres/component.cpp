@@ -259,6 +259,10 @@ properties:
         type: integer
         description: prepared statements cache size limit
         defaultDescription: 5000
+    warmup-prepared-statements:
+        type: integer
+        description: count of the recently used statements prepared on new connections in advance
+        defaultDescription: 0
     max_statement_metrics:
         type: integer
         description: limit of exported metrics for named statements
@@ -300,6 +304,10 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    spare_pool_size:
+        type: integer
+        description: number of idle connections established in advance on top of the connections in use
+        defaultDescription: 0
     connlimit_mode:
         type: string
         enum:
@@ -0,0 +1,225 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kSignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr std::size_t kHeaderSize =
+    kSignature.size() + sizeof(Integer) + sizeof(Integer);
+constexpr Smallint kTrailer = -1;
+
+// COPY data is sent by chunks of at least kFlushSize bytes
+constexpr std::size_t kFlushSize = 64 * 1024;
+
+constexpr const char* kAbortMessage = "COPY is aborted by the client";
+
+template <typename T>
+T ReadIntegral(const std::string& data, std::size_t& position) {
+  io::FieldBuffer buffer{
+      false, io::BufferCategory::kPlainBuffer, data.size() - position,
+      reinterpret_cast<const std::uint8_t*>(data.data()) + position};
+  T value{};
+  position += buffer.Read(value, io::BufferCategory::kPlainBuffer);
+  return value;
+}
+
+}  // namespace
+
+CopyWriter::CopyWriter(detail::Connection* conn, const Query& query,
+                       OptionalCommandControl cmd_ctl)
+    : conn_{conn}, cmd_ctl_{std::move(cmd_ctl)} {
+  UASSERT(conn_);
+  if (!cmd_ctl_) {
+    cmd_ctl_ = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->CopyStart(query, detail::Connection::CopyDirection::kIn, cmd_ctl_);
+
+  buffer_.reserve(kFlushSize + kFlushSize / 4);
+  buffer_.append(kSignature);
+  // flags and header extension length
+  io::WriteBuffer(GetUserTypes(), buffer_, Integer{0});
+  io::WriteBuffer(GetUserTypes(), buffer_, Integer{0});
+}
+
+CopyWriter::CopyWriter(CopyWriter&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      cmd_ctl_{std::move(other.cmd_ctl_)},
+      buffer_{std::move(other.buffer_)},
+      rows_{other.rows_} {}
+
+CopyWriter& CopyWriter::operator=(CopyWriter&& other) noexcept {
+  CopyWriter{std::move(other)}.Swap(*this);
+  return *this;
+}
+
+CopyWriter::~CopyWriter() {
+  if (!conn_) return;
+
+  LOG_WARNING() << "CopyWriter is destroyed without Finish(), COPY is aborted";
+  try {
+    conn_->CopyPutEnd(kAbortMessage, cmd_ctl_);
+  } catch (const QueryCancelled&) {
+    // expected result of the aborted COPY
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Exception when aborting COPY in destructor: " << e;
+  }
+}
+
+std::size_t CopyWriter::Finish() {
+  if (!conn_) {
+    throw LogicError{"COPY is already finished"};
+  }
+
+  io::WriteBuffer(GetUserTypes(), buffer_, kTrailer);
+  Flush();
+  auto* conn = std::exchange(conn_, nullptr);
+  return conn->CopyPutEnd(nullptr, cmd_ctl_).RowsAffected();
+}
+
+void CopyWriter::Swap(CopyWriter& other) noexcept {
+  using std::swap;
+  swap(conn_, other.conn_);
+  swap(cmd_ctl_, other.cmd_ctl_);
+  swap(buffer_, other.buffer_);
+  swap(rows_, other.rows_);
+}
+
+void CopyWriter::StartRow(std::size_t columns) {
+  if (!conn_) {
+    throw LogicError{"COPY is already finished"};
+  }
+  io::WriteBuffer(GetUserTypes(), buffer_, static_cast<Smallint>(columns));
+}
+
+void CopyWriter::EndRow() {
+  ++rows_;
+  if (buffer_.size() >= kFlushSize) {
+    Flush();
+  }
+}
+
+void CopyWriter::Flush() {
+  if (buffer_.empty()) return;
+  conn_->CopyPutData(buffer_, cmd_ctl_);
+  buffer_.clear();
+}
+
+const UserTypes& CopyWriter::GetUserTypes() const {
+  return conn_->GetUserTypes();
+}
+
+CopyReader::CopyReader(detail::Connection* conn, const Query& query,
+                       OptionalCommandControl cmd_ctl)
+    : conn_{conn},
+      cmd_ctl_{std::move(cmd_ctl)},
+      categories_{&conn_->GetUserTypes().GetTypeBufferCategories()} {
+  UASSERT(conn_);
+  if (!cmd_ctl_) {
+    cmd_ctl_ = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->CopyStart(query, detail::Connection::CopyDirection::kOut, cmd_ctl_);
+}
+
+CopyReader::CopyReader(CopyReader&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      cmd_ctl_{std::move(other.cmd_ctl_)},
+      categories_{other.categories_},
+      buffer_{std::move(other.buffer_)},
+      position_{other.position_},
+      rows_{other.rows_},
+      header_read_{other.header_read_},
+      done_{std::exchange(other.done_, true)} {}
+
+CopyReader& CopyReader::operator=(CopyReader&& other) noexcept {
+  CopyReader{std::move(other)}.Swap(*this);
+  return *this;
+}
+
+CopyReader::~CopyReader() {
+  if (conn_ && !done_) {
+    // there is no way to stop COPY TO STDOUT except for reading all the data
+    LOG_WARNING() << "CopyReader is destroyed before reading all the rows, "
+                     "the connection will be closed";
+    conn_->MarkAsBroken();
+  }
+}
+
+void CopyReader::Swap(CopyReader& other) noexcept {
+  using std::swap;
+  swap(conn_, other.conn_);
+  swap(cmd_ctl_, other.cmd_ctl_);
+  swap(categories_, other.categories_);
+  swap(buffer_, other.buffer_);
+  swap(position_, other.position_);
+  swap(rows_, other.rows_);
+  swap(header_read_, other.header_read_);
+  swap(done_, other.done_);
+}
+
+bool CopyReader::FetchRow(std::size_t columns) {
+  if (done_) return false;
+
+  const auto field_count = ReadFieldCount();
+  if (field_count == kTrailer) {
+    buffer_.clear();
+    // the trailer is the last data, this call consumes the command result
+    if (conn_->CopyGetData(buffer_, cmd_ctl_)) {
+      throw InvalidBinaryBuffer{"COPY data after the trailer"};
+    }
+    done_ = true;
+    return false;
+  }
+  if (field_count < 0 || static_cast<std::size_t>(field_count) != columns) {
+    throw FieldTupleMismatch(field_count, columns);
+  }
+
+  ++rows_;
+  return true;
+}
+
+void CopyReader::ReadHeader() {
+  if (buffer_.size() - position_ < kHeaderSize ||
+      std::string_view{buffer_}.substr(position_, kSignature.size()) !=
+          kSignature) {
+    throw InvalidBinaryBuffer{"COPY data has no binary format signature"};
+  }
+  position_ += kSignature.size();
+  // flags, the only one defined is the OIDs presence which is not supported
+  const auto flags = ReadIntegral<Integer>(buffer_, position_);
+  if (flags != 0) {
+    throw InvalidBinaryBuffer{"COPY data with OIDs is not supported"};
+  }
+  const auto extension_length = ReadIntegral<Integer>(buffer_, position_);
+  if (extension_length < 0 ||
+      buffer_.size() - position_ < static_cast<std::size_t>(extension_length)) {
+    throw InvalidBinaryBuffer{"Invalid COPY header extension length"};
+  }
+  position_ += extension_length;
+  header_read_ = true;
+}
+
+std::int16_t CopyReader::ReadFieldCount() {
+  // the server sends a message per row, the header shares the first one
+  while (position_ == buffer_.size()) {
+    buffer_.clear();
+    position_ = 0;
+    if (!conn_->CopyGetData(buffer_, cmd_ctl_)) {
+      done_ = true;
+      throw InvalidBinaryBuffer{"COPY data has no trailer"};
+    }
+    if (!header_read_) ReadHeader();
+  }
+  return ReadIntegral<Smallint>(buffer_, position_);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
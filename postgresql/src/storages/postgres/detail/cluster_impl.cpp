@@ -1,11 +1,16 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
@@ -23,6 +28,10 @@ namespace {
 USERVER_NAMESPACE::utils::impl::UserverExperiment kConnlimitAutoExperiment(
     "pg-connlimit-auto");
 
+constexpr std::int64_t kHedgingBudgetPerStatement = 1000;
+// Allows a short burst of the duplicate statements
+constexpr std::int64_t kMaxHedgingBudget = 10 * kHedgingBudgetPerStatement;
+
 ClusterHostType Fallback(ClusterHostType ht) {
   switch (ht) {
     case ClusterHostType::kMaster:
@@ -34,15 +43,17 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kLeastLoaded:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
   UINVARIANT(false, "Unexpected cluster host type");
 }
 
-size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
-                      ClusterHostTypeFlags flags,
-                      std::atomic<uint32_t>& rr_host_idx) {
+size_t SelectDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    ClusterHostTypeFlags flags, std::atomic<uint32_t>& rr_host_idx,
+    const std::vector<std::shared_ptr<ConnectionPool>>& pools) {
   UASSERT(!indices.empty());
   if (indices.empty()) {
     throw ClusterError("Cannot select host from an empty list");
@@ -57,6 +68,16 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
       idx_pos =
           rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
     }
+  } else if (strategy_flags == ClusterHostType::kLeastLoaded) {
+    // indices are ordered by RTT, the first of the least loaded is the nearest
+    auto min_load = pools[indices[0]]->GetLoadApprox();
+    for (size_t pos = 1; pos < indices.size() && min_load > 0; ++pos) {
+      const auto load = pools[indices[pos]]->GetLoadApprox();
+      if (load < min_load) {
+        min_load = load;
+        idx_pos = pos;
+      }
+    }
   } else if (strategy_flags != ClusterHostType::kNearest) {
     throw LogicError(
         fmt::format("Invalid strategy requested: {}, ensure only one is used",
@@ -149,6 +170,9 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->master.stats.Add(host_pools_[dsn_index]
                                         ->GetStatementTimingsStorage()
                                         .GetTimingsPercentiles());
+    cluster_stats->master.stats.Add(host_pools_[dsn_index]
+                                        ->GetStatementTimingsStorage()
+                                        .GetStatementsStatistics());
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -166,6 +190,9 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->sync_slave.stats.Add(host_pools_[dsn_index]
                                             ->GetStatementTimingsStorage()
                                             .GetTimingsPercentiles());
+    cluster_stats->sync_slave.stats.Add(host_pools_[dsn_index]
+                                            ->GetStatementTimingsStorage()
+                                            .GetStatementsStatistics());
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -187,6 +214,9 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
       slave_desc.stats.Add(host_pools_[dsn_index]
                                ->GetStatementTimingsStorage()
                                .GetTimingsPercentiles());
+      slave_desc.stats.Add(host_pools_[dsn_index]
+                               ->GetStatementTimingsStorage()
+                               .GetStatementsStatistics());
       is_host_pool_seen[dsn_index] = 1;
     }
   }
@@ -201,6 +231,8 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     desc.stats.Add(host_pools_[i]->GetStatistics(), dsn_stats[i]);
     desc.stats.Add(
         host_pools_[i]->GetStatementTimingsStorage().GetTimingsPercentiles());
+    desc.stats.Add(
+        host_pools_[i]->GetStatementTimingsStorage().GetStatementsStatistics());
 
     cluster_stats->unknown.push_back(std::move(desc));
   }
@@ -208,6 +240,39 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
   return cluster_stats;
 }
 
+std::chrono::milliseconds ClusterImpl::GetHedgingDelay(
+    const HedgingSettings& settings, const Query& query,
+    const ConnectionPool& pool) const {
+  if (!settings.delay_percentile || !query.GetName()) return settings.delay;
+
+  const auto percentile =
+      pool.GetStatementTimingsStorage().GetTimingsPercentile(
+          query.GetName()->GetUnderlying(), *settings.delay_percentile);
+  return percentile.value_or(settings.delay);
+}
+
+void ClusterImpl::AccountHedgedStatement(
+    const HedgingSettings& settings) noexcept {
+  const auto income = static_cast<std::int64_t>(settings.max_hedged_ratio *
+                                                kHedgingBudgetPerStatement);
+  auto budget = hedging_budget_.load();
+  while (budget < kMaxHedgingBudget) {
+    const auto new_budget = std::min(budget + income, kMaxHedgingBudget);
+    if (hedging_budget_.compare_exchange_weak(budget, new_budget)) return;
+  }
+}
+
+bool ClusterImpl::TryAcquireHedgingBudget() noexcept {
+  auto budget = hedging_budget_.load();
+  while (budget >= kHedgingBudgetPerStatement) {
+    if (hedging_budget_.compare_exchange_weak(
+            budget, budget - kHedgingBudgetPerStatement)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     ClusterHostTypeFlags flags) {
   LOG_TRACE() << "Looking for pool: " << flags;
@@ -227,7 +292,8 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_,
+                               host_pools_);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -249,7 +315,8 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_,
+                               host_pools_);
   }
 
   UASSERT(dsn_index < host_pools_.size());
@@ -284,6 +351,95 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
   return FindPool(flags)->Start(cmd_ctl);
 }
 
+ResultSet ClusterImpl::ExecuteHedged(ClusterHostTypeFlags flags,
+                                     OptionalCommandControl cmd_ctl,
+                                     const HedgingSettings& settings,
+                                     const Query& query,
+                                     const HedgedStatement& statement) {
+  const auto role_flags = flags & kClusterHostRolesMask;
+  if (!role_flags || (role_flags & ClusterHostType::kMaster)) {
+    throw LogicError(
+        "Only the replica roles may be specified for a hedged statement");
+  }
+  if (settings.max_hedged_ratio < 0 || settings.max_hedged_ratio > 1) {
+    throw LogicError("HedgingSettings::max_hedged_ratio should be in [0, 1]");
+  }
+  LOG_TRACE() << "Requested hedged statement on " << flags;
+  AccountHedgedStatement(settings);
+
+  topology::TopologyBase::DsnIndices dsn_indices;
+  {
+    const auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
+    const auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
+    const auto it = dsn_indices_by_type->find(host_role);
+    if (it != dsn_indices_by_type->end()) dsn_indices = it->second;
+  }
+  if (dsn_indices.size() < 2) {
+    // Nothing to hedge with, the fallbacks are the same as for Start()
+    auto ntrx = Start(flags, cmd_ctl);
+    return statement(ntrx);
+  }
+
+  const auto start_attempt = [&](ConnectionPool& pool) {
+    return USERVER_NAMESPACE::utils::Async(
+        "pg_execute_hedged", [&pool, &cmd_ctl, &statement] {
+          auto ntrx = pool.Start(cmd_ctl);
+          return statement(ntrx);
+        });
+  };
+
+  const auto first_index =
+      SelectDsnIndex(dsn_indices, flags, rr_host_idx_, host_pools_);
+  auto& first_pool = *host_pools_[first_index];
+  auto first = start_attempt(first_pool);
+  if (engine::WaitAnyFor(GetHedgingDelay(settings, query, first_pool),
+                         first) ||
+      engine::current_task::ShouldCancel() || !TryAcquireHedgingBudget()) {
+    return first.Get();
+  }
+
+  dsn_indices.erase(
+      std::find(dsn_indices.begin(), dsn_indices.end(), first_index));
+  const auto second_index =
+      SelectDsnIndex(dsn_indices, flags, rr_host_idx_, host_pools_);
+  LOG_DEBUG() << "No result of the statement from the host #" << first_index
+              << ", hedging with the host #" << second_index;
+  auto second = start_attempt(*host_pools_[second_index]);
+
+  const auto completed = engine::WaitAny(first, second);
+  // Throws on the task cancellation
+  if (!completed) return first.Get();
+
+  // The cancelled statement leaves its connection busy, and the pool cleans
+  // it up with a cancel request in background
+  auto& winner = (*completed == 0 ? first : second);
+  auto& other = (*completed == 0 ? second : first);
+  try {
+    auto result = winner.Get();
+    other.RequestCancel();
+    return result;
+  } catch (const std::exception&) {
+    if (engine::current_task::ShouldCancel()) throw;
+    return other.Get();
+  }
+}
+
+QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags,
+                                         OptionalCommandControl cmd_ctl) {
+  if (!(flags & kClusterHostRolesMask)) {
+    throw LogicError("Host role must be specified for a query queue");
+  }
+  LOG_TRACE() << "Requested query queue on " << flags;
+  return FindPool(flags)->CreateQueryQueue(cmd_ctl);
+}
+
+NotifyScope ClusterImpl::Listen(std::string_view channel,
+                                OptionalCommandControl cmd_ctl) {
+  LOG_TRACE() << "Requested listening to channel '" << channel << "'";
+  // replicas do not support LISTEN
+  return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
+}
+
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
                                            DefaultCommandControlSource source) {
   default_cmd_ctls_.UpdateDefaultCmdCtl(cmd_ctl, source);
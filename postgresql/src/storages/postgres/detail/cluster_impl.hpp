@@ -1,6 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -18,7 +21,10 @@
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -46,6 +52,15 @@ class ClusterImpl {
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  using HedgedStatement = std::function<ResultSet(NonTransaction&)>;
+  ResultSet ExecuteHedged(ClusterHostTypeFlags, OptionalCommandControl,
+                          const HedgingSettings&, const Query& query,
+                          const HedgedStatement& statement);
+
+  QueryQueue CreateQueryQueue(ClusterHostTypeFlags, OptionalCommandControl);
+
+  NotifyScope Listen(std::string_view channel, OptionalCommandControl);
+
   void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
   CommandControl GetDefaultCommandControl() const;
 
@@ -76,12 +91,20 @@ class ClusterImpl {
 
   ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
 
+  std::chrono::milliseconds GetHedgingDelay(const HedgingSettings&,
+                                            const Query& query,
+                                            const ConnectionPool& pool) const;
+  void AccountHedgedStatement(const HedgingSettings&) noexcept;
+  bool TryAcquireHedgingBudget() noexcept;
+
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
   std::unique_ptr<topology::TopologyBase> topology_;
   engine::TaskProcessor& bg_task_processor_;
   std::vector<ConnectionPoolPtr> host_pools_;
   std::atomic<uint32_t> rr_host_idx_;
+  // In the thousandths of a duplicate statement
+  std::atomic<std::int64_t> hedging_budget_{0};
   dynamic_config::Source config_source_;
   ConnlimitWatchdog connlimit_watchdog_;
 };
@@ -89,6 +89,10 @@ Connection::Statistics Connection::GetStatsAndReset() {
   return pimpl_->GetStatsAndReset();
 }
 
+const Connection::Statistics& Connection::GetStatistics() const {
+  return pimpl_->GetStatistics();
+}
+
 void Connection::Begin(const TransactionOptions& options,
                        SteadyClock::time_point trx_start_time,
                        OptionalCommandControl trx_cmd_ctl) {
@@ -121,6 +125,13 @@ ResultSet Connection::Execute(CommandControl statement_cmd_ctl,
                  OptionalCommandControl{statement_cmd_ctl});
 }
 
+std::vector<ResultSet> Connection::ExecuteBatch(
+    const std::vector<Query>& queries,
+    const std::vector<detail::QueryParameters>& params,
+    OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecuteBatch(queries, params, std::move(statement_cmd_ctl));
+}
+
 Connection::StatementId Connection::PortalBind(
     const std::string& statement, const std::string& portal_name,
     const detail::QueryParameters& params,
@@ -137,6 +148,40 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+void Connection::CopyStart(const Query& query, CopyDirection direction,
+                           OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyStart(query, direction, std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyPutData(std::string_view data,
+                             OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyPutData(data, std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::CopyPutEnd(const char* error_message,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->CopyPutEnd(error_message, std::move(statement_cmd_ctl));
+}
+
+bool Connection::CopyGetData(std::string& buffer,
+                             OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->CopyGetData(buffer, std::move(statement_cmd_ctl));
+}
+
+void Connection::Listen(std::string_view channel,
+                        OptionalCommandControl cmd_ctl) {
+  pimpl_->Listen(channel, std::move(cmd_ctl));
+}
+
+void Connection::Unlisten(std::string_view channel,
+                          OptionalCommandControl cmd_ctl) {
+  pimpl_->Unlisten(channel, std::move(cmd_ctl));
+}
+
+Notification Connection::WaitNotify(engine::Deadline deadline) {
+  return pimpl_->WaitNotify(deadline);
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
@@ -156,6 +201,16 @@ const UserTypes& Connection::GetUserTypes() const {
   return pimpl_->GetUserTypes();
 }
 
+Connection::PreparedStatementHints Connection::GetPreparedStatements(
+    std::size_t limit) const {
+  return pimpl_->GetPreparedStatements(limit);
+}
+
+std::size_t Connection::PrepareStatements(
+    const PreparedStatementHints& statements, engine::Deadline deadline) {
+  return pimpl_->PrepareStatements(statements, deadline);
+}
+
 TimeoutDuration Connection::GetIdleDuration() const {
   return pimpl_->GetIdleDuration();
 }
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -17,6 +18,7 @@
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/result_set.hpp>
@@ -50,11 +52,25 @@ class Connection {
                   //!< finished
   };
 
+  enum class CopyDirection {
+    kIn,   //!< COPY ... FROM STDIN
+    kOut,  //!< COPY ... TO STDOUT
+  };
+
   /// Strong typedef for IDs assigned to prepared statements
   using StatementId =
       USERVER_NAMESPACE::utils::StrongTypedef<struct StatementIdTag,
                                               std::size_t>;
 
+  /// Statement prepared on a connection, that may be prepared on other
+  /// connections in advance
+  struct PreparedStatementHint {
+    StatementId id;
+    std::string statement;
+    std::vector<Oid> param_types;
+  };
+  using PreparedStatementHints = std::vector<PreparedStatementHint>;
+
   /// @brief Statistics storage
   /// @note Should be reset after every transaction execution
   struct Statistics {
@@ -79,6 +95,8 @@ class Connection {
     SmallCounter out_of_trx : 1;
     /// Number of parsed queries
     Counter parse_total{0};
+    /// Number of queries found in prepared statements cache
+    Counter prepared_hit_total{0};
     /// Number of query executions (calls to `Execute`)
     Counter execute_total{0};
     /// Total number of replies
@@ -177,6 +195,9 @@ class Connection {
   /// @note May only be called when connection is not in transaction
   Statistics GetStatsAndReset();
 
+  /// @brief Statistics accumulated since the last GetStatsAndReset()
+  const Statistics& GetStatistics() const;
+
   //@{
   /// Begin a transaction in Postgres with specific start time point
   /// Suspends coroutine for execution
@@ -224,6 +245,14 @@ class Connection {
   ResultSet Execute(CommandControl statement_cmd_ctl, const Query& query,
                     const ParameterStore& store);
 
+  /// @brief Execute several statements at once.
+  /// In pipeline mode the statements are sent without waiting for the results
+  /// of each other, otherwise they are executed one by one.
+  std::vector<ResultSet> ExecuteBatch(
+      const std::vector<Query>& queries,
+      const std::vector<detail::QueryParameters>& params,
+      OptionalCommandControl statement_cmd_ctl);
+
   StatementId PortalBind(const std::string& statement,
                          const std::string& portal_name,
                          const detail::QueryParameters& params,
@@ -231,6 +260,26 @@ class Connection {
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
 
+  /// @brief Send COPY query and wait for the server to enter the COPY state
+  void CopyStart(const Query& query, CopyDirection direction,
+                 OptionalCommandControl);
+  /// @brief Send a chunk of COPY ... FROM STDIN data
+  void CopyPutData(std::string_view data, OptionalCommandControl);
+  /// @brief Finish COPY ... FROM STDIN and wait for the command result.
+  /// A non-null error message aborts the COPY.
+  ResultSet CopyPutEnd(const char* error_message, OptionalCommandControl);
+  /// @brief Append a row of COPY ... TO STDOUT data to the buffer. Returns
+  /// false and checks the command result when there are no more rows.
+  bool CopyGetData(std::string& buffer, OptionalCommandControl);
+
+  /// @brief Subscribe to the notifications of the channel
+  void Listen(std::string_view channel, OptionalCommandControl);
+  /// @brief Unsubscribe from the notifications of the channel, drops the
+  /// notifications received so far
+  void Unlisten(std::string_view channel, OptionalCommandControl);
+  /// @brief Wait for a notification of the subscribed channels
+  Notification WaitNotify(engine::Deadline deadline);
+
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
   /// If there is a transaction in progress - roll it back.
@@ -258,6 +307,13 @@ class Connection {
   const UserTypes& GetUserTypes() const;
   //@}
 
+  /// Get up to `limit` of the most recently used prepared statements
+  PreparedStatementHints GetPreparedStatements(std::size_t limit) const;
+  /// Prepare the statements in advance, statements that fail to prepare are
+  /// skipped. Returns count of the statements prepared.
+  std::size_t PrepareStatements(const PreparedStatementHints& statements,
+                                engine::Deadline deadline);
+
   /// Get duration since last network operation
   TimeoutDuration GetIdleDuration() const;
   /// Ping the connection.
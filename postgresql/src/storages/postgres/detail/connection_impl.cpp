@@ -1,9 +1,12 @@
 #include <storages/postgres/detail/connection_impl.hpp>
 
+#include <algorithm>
+
 #include <boost/functional/hash.hpp>
 
 #include <userver/error_injection/hook.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/testsuite/perf_counters.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
@@ -22,10 +25,27 @@ namespace {
 
 const char* const kStatementTimeoutParameter = "statement_timeout";
 
+constexpr std::string_view kQueriesPerfCounter = "postgresql-queries";
+
 // we hope lc_messages is en_US, we don't control it anyway
 const std::string kBadCachedPlanErrorMessage =
     "cached plan must not change result type";
 
+// Parameters of a statement that is prepared without execution
+class ParamTypesHolder {
+ public:
+  explicit ParamTypesHolder(const std::vector<Oid>& types) : types_{types} {}
+
+  std::size_t Size() const { return types_.size(); }
+  const char* const* ParamBuffers() const { return nullptr; }
+  const Oid* ParamTypesBuffer() const { return types_.data(); }
+  const int* ParamLengthsBuffer() const { return nullptr; }
+  const int* ParamFormatsBuffer() const { return nullptr; }
+
+ private:
+  const std::vector<Oid>& types_;
+};
+
 std::size_t QueryHash(const std::string& statement,
                       const QueryParameters& params) {
   auto res = params.TypeHash();
@@ -37,6 +57,7 @@ class CountExecute {
  public:
   CountExecute(Connection::Statistics& stats) : stats_(stats) {
     ++stats_.execute_total;
+    testsuite::AccountPerfCounter(kQueriesPerfCounter);
     exec_begin_time = SteadyClock::now();
   }
 
@@ -60,6 +81,38 @@ class CountExecute {
   SteadyClock::time_point exec_begin_time;
 };
 
+class CountBatch {
+ public:
+  CountBatch(Connection::Statistics& stats, std::size_t size)
+      : stats_(stats), size_(size) {
+    stats_.execute_total += size_;
+    testsuite::AccountPerfCounter(kQueriesPerfCounter, size_);
+    exec_begin_time = SteadyClock::now();
+  }
+
+  ~CountBatch() {
+    auto now = SteadyClock::now();
+    if (!completed_) {
+      stats_.error_execute_total += size_;
+    }
+    stats_.sum_query_duration += now - exec_begin_time;
+    stats_.last_execute_finish = now;
+  }
+
+  void AccountResult(std::vector<ResultSet>& results) {
+    for (const auto& result : results) {
+      if (result.FieldCount()) ++stats_.reply_total;
+    }
+    completed_ = true;
+  }
+
+ private:
+  Connection::Statistics& stats_;
+  const std::size_t size_;
+  bool completed_{false};
+  SteadyClock::time_point exec_begin_time;
+};
+
 class CountPortalBind {
  public:
   CountPortalBind(Connection::Statistics& stats) : stats_(stats) {
@@ -77,6 +130,22 @@ class CountPortalBind {
   bool completed_{false};
 };
 
+class CountCopyEnd {
+ public:
+  CountCopyEnd(Connection::Statistics& stats) : stats_(stats) {}
+
+  ~CountCopyEnd() {
+    if (!completed_) ++stats_.error_execute_total;
+    stats_.last_execute_finish = SteadyClock::now();
+  }
+
+  void AccountResult(ResultSet&) { completed_ = true; }
+
+ private:
+  Connection::Statistics& stats_;
+  bool completed_{false};
+};
+
 struct TrackTrxEnd {
   TrackTrxEnd(Connection::Statistics& stats) : stats_(stats) {}
   ~TrackTrxEnd() { stats_.trx_end_time = SteadyClock::now(); }
@@ -355,6 +424,78 @@ ResultSet ConnectionImpl::ExecuteCommand(
   return ExecuteCommand(query, params, deadline);
 }
 
+std::vector<ResultSet> ConnectionImpl::ExecuteBatch(
+    const std::vector<Query>& queries, const std::vector<QueryParameters>& params,
+    OptionalCommandControl statement_cmd_ctl) {
+  UASSERT(queries.size() == params.size());
+  CheckBusy();
+  if (queries.empty()) return {};
+
+  const auto deadline = MakeStatementDeadline(statement_cmd_ctl);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+
+  const bool use_prepared = settings_.prepared_statements !=
+                            ConnectionSettings::kNoPreparedStatements;
+  // Statements of a batch are prepared before sending, they must not evict
+  // each other from the cache
+  if (!IsPipelineActive() ||
+      (use_prepared && queries.size() > settings_.max_prepared_cache_size)) {
+    std::vector<ResultSet> results;
+    results.reserve(queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      results.push_back(ExecuteCommand(queries[i], params[i], deadline));
+    }
+    return results;
+  }
+
+  DiscardOldPreparedStatements(deadline);
+  CheckDeadlineReached(deadline);
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span);
+  auto scope = span.CreateScopeTime();
+  TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  CountBatch count_batch(stats_, queries.size());
+
+  std::vector<const PreparedStatementInfo*> prepared_infos;
+  if (use_prepared) {
+    prepared_infos.reserve(queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      const auto& statement = queries[i].Statement();
+      if (settings_.ignore_unused_query_params ==
+          ConnectionSettings::kCheckUnused) {
+        CheckQueryParameters(statement, params[i]);
+      }
+      prepared_infos.push_back(
+          &PrepareStatement(statement, params[i], deadline, span, scope));
+    }
+  }
+
+  scope.Reset(scopes::kExec);
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    if (use_prepared) {
+      conn_wrapper_.SendPreparedQuery(prepared_infos[i]->statement_name,
+                                      params[i], scope);
+    } else {
+      conn_wrapper_.SendQuery(queries[i].Statement(), params[i], scope);
+    }
+  }
+
+  const auto statement =
+      "batch of " + std::to_string(queries.size()) + " statements";
+  return HandleWaitErrors(statement, network_timeout, span, [&] {
+    auto results =
+        conn_wrapper_.WaitPipelineResults(queries.size(), deadline, scope);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      SetBufferCategories(
+          results[i], use_prepared ? &prepared_infos[i]->description : nullptr);
+    }
+    count_batch.AccountResult(results);
+    return results;
+  });
+}
+
 void ConnectionImpl::Begin(const TransactionOptions& options,
                            SteadyClock::time_point trx_start_time,
                            OptionalCommandControl trx_cmd_ctl) {
@@ -492,6 +633,78 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+void ConnectionImpl::CopyStart(const Query& query,
+                               Connection::CopyDirection direction,
+                               OptionalCommandControl statement_cmd_ctl) {
+  if (IsPipelineActive()) {
+    throw LogicError{"COPY is not supported in pipeline mode"};
+  }
+
+  CheckBusy();
+  auto deadline = MakeStatementDeadline(statement_cmd_ctl);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+
+  auto span = MakeQuerySpan(query);
+  CheckDeadlineReached(deadline);
+  auto scope = span.CreateScopeTime();
+  ++stats_.execute_total;
+  testsuite::AccountPerfCounter(kQueriesPerfCounter);
+  copy_statement_ = query.Statement();
+  try {
+    conn_wrapper_.SendQuery(copy_statement_, scope);
+    conn_wrapper_.WaitCopyStart(direction, deadline, scope);
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+}
+
+void ConnectionImpl::CopyPutData(std::string_view data,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  conn_wrapper_.PutCopyData(data, MakeStatementDeadline(statement_cmd_ctl));
+}
+
+ResultSet ConnectionImpl::CopyPutEnd(const char* error_message,
+                                     OptionalCommandControl statement_cmd_ctl) {
+  const auto deadline = MakeStatementDeadline(statement_cmd_ctl);
+  conn_wrapper_.PutCopyEnd(error_message, deadline);
+  return WaitCopyResult(deadline, statement_cmd_ctl
+                                      ? statement_cmd_ctl->execute
+                                      : CurrentExecuteTimeout());
+}
+
+bool ConnectionImpl::CopyGetData(std::string& buffer,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  const auto deadline = MakeStatementDeadline(statement_cmd_ctl);
+  if (conn_wrapper_.GetCopyData(buffer, deadline)) return true;
+
+  WaitCopyResult(deadline, statement_cmd_ctl ? statement_cmd_ctl->execute
+                                             : CurrentExecuteTimeout());
+  return false;
+}
+
+void ConnectionImpl::Listen(std::string_view channel,
+                            OptionalCommandControl cmd_ctl) {
+  const auto quoted_channel = conn_wrapper_.EscapeIdentifier(channel);
+  ExecuteCommandNoPrepare("LISTEN " + quoted_channel,
+                          MakeStatementDeadline(cmd_ctl));
+}
+
+void ConnectionImpl::Unlisten(std::string_view channel,
+                              OptionalCommandControl cmd_ctl) {
+  const auto quoted_channel = conn_wrapper_.EscapeIdentifier(channel);
+  ExecuteCommandNoPrepare("UNLISTEN " + quoted_channel,
+                          MakeStatementDeadline(cmd_ctl));
+  // the connection may be reused, the pending notifications are of no use
+  conn_wrapper_.DiscardNotifications();
+}
+
+Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
+  CheckBusy();
+  return conn_wrapper_.WaitNotify(deadline);
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -551,6 +764,58 @@ const UserTypes& ConnectionImpl::GetUserTypes() const { return db_types_; }
 
 void ConnectionImpl::LoadUserTypes() { LoadUserTypes(MakeCurrentDeadline()); }
 
+Connection::PreparedStatementHints ConnectionImpl::GetPreparedStatements(
+    std::size_t limit) const {
+  Connection::PreparedStatementHints statements;
+  const auto size = prepared_.GetSize();
+  const auto skip = size > limit ? size - limit : 0;
+  statements.reserve(size - skip);
+  std::size_t index = 0;
+  // statements are visited from the least recently used one
+  prepared_.VisitAll([&statements, &index, skip](
+                         const Connection::StatementId&,
+                         const PreparedStatementInfo& info) {
+    if (index++ < skip) return;
+    statements.push_back({info.id, info.statement, info.param_types});
+  });
+  std::reverse(statements.begin(), statements.end());
+  return statements;
+}
+
+std::size_t ConnectionImpl::PrepareStatements(
+    const Connection::PreparedStatementHints& statements,
+    engine::Deadline deadline) {
+  if (settings_.prepared_statements ==
+      ConnectionSettings::kNoPreparedStatements) {
+    return 0;
+  }
+
+  tracing::Span span{scopes::kPrepare};
+  auto scope = span.CreateScopeTime();
+  std::size_t prepared = 0;
+  for (const auto& hint : statements) {
+    // do not evict the statements that are already prepared
+    if (prepared_.GetSize() >= settings_.max_prepared_cache_size ||
+        deadline.IsReached()) {
+      break;
+    }
+    if (prepared_.Get(hint.id)) continue;
+
+    ParamTypesHolder holder{hint.param_types};
+    const QueryParameters params{holder};
+    try {
+      PrepareStatement(hint.statement, params, deadline, span, scope);
+      ++prepared;
+    } catch (const Error& e) {
+      if (!IsConnected() || IsBroken()) throw;
+      // e.g. the statement uses a temporary table of another session
+      LOG_LIMITED_WARNING() << "Failed to prepare statement `"
+                            << hint.statement << "` in advance: " << e;
+    }
+  }
+  return prepared;
+}
+
 TimeoutDuration ConnectionImpl::GetIdleDuration() const {
   return conn_wrapper_.GetIdleDuration();
 }
@@ -594,6 +859,23 @@ engine::Deadline ConnectionImpl::MakeCurrentDeadline() const {
   return testsuite_pg_ctl_.MakeExecuteDeadline(CurrentExecuteTimeout());
 }
 
+engine::Deadline ConnectionImpl::MakeStatementDeadline(
+    const OptionalCommandControl& statement_cmd_ctl) const {
+  return testsuite_pg_ctl_.MakeExecuteDeadline(
+      statement_cmd_ctl ? statement_cmd_ctl->execute : CurrentExecuteTimeout());
+}
+
+ResultSet ConnectionImpl::WaitCopyResult(engine::Deadline deadline,
+                                         TimeoutDuration network_timeout) {
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span);
+  span.AddTag(tracing::kDatabaseStatement, copy_statement_);
+  auto scope = span.CreateScopeTime();
+  CountCopyEnd count_copy_end(stats_);
+  return WaitResult(copy_statement_, deadline, network_timeout,
+                    count_copy_end, span, scope, nullptr);
+}
+
 void ConnectionImpl::SetTransactionCommandControl(CommandControl cmd_ctl) {
   if (!IsInTransaction()) {
     throw NotInTransaction{
@@ -661,6 +943,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
   auto* statement_info = prepared_.Get(query_id);
   if (statement_info) {
     LOG_TRACE() << "Query " << statement << " is already prepared.";
+    ++stats_.prepared_hit_total;
     return *statement_info;
   } else {
     if (prepared_.GetSize() >= settings_.max_prepared_cache_size) {
@@ -674,7 +957,9 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
     conn_wrapper_.SendPrepare(statement_name, statement, params, scope);
     // Mark the statement prepared as soon as the send works correctly
     prepared_.Put(query_id,
-                  {query_id, statement, statement_name, ResultSet{nullptr}});
+                  {query_id, statement, statement_name, ResultSet{nullptr},
+                   std::vector<Oid>(params.ParamTypesBuffer(),
+                                    params.ParamTypesBuffer() + params.Size())});
     try {
       conn_wrapper_.WaitResult(deadline, scope);
     } catch (const DuplicatePreparedStatement& e) {
@@ -855,6 +1140,15 @@ void ConnectionImpl::FillBufferCategories(ResultSet& res) {
   }
 }
 
+void ConnectionImpl::SetBufferCategories(ResultSet& res,
+                                         const ResultSet* description_ptr) {
+  if (description_ptr && !description_ptr->IsEmpty()) {
+    res.SetBufferCategoriesFrom(*description_ptr);
+  } else if (!res.IsEmpty()) {
+    FillBufferCategories(res);
+  }
+}
+
 template <typename Counter>
 ResultSet ConnectionImpl::WaitResult(const std::string& statement,
                                      engine::Deadline deadline,
@@ -862,15 +1156,20 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
                                      Counter& counter, tracing::Span& span,
                                      tracing::ScopeTime& scope,
                                      const ResultSet* description_ptr) {
-  try {
+  return HandleWaitErrors(statement, network_timeout, span, [&] {
     auto res = conn_wrapper_.WaitResult(deadline, scope);
-    if (description_ptr && !description_ptr->IsEmpty()) {
-      res.SetBufferCategoriesFrom(*description_ptr);
-    } else if (!res.IsEmpty()) {
-      FillBufferCategories(res);
-    }
+    SetBufferCategories(res, description_ptr);
     counter.AccountResult(res);
     return res;
+  });
+}
+
+template <typename Wait>
+std::invoke_result_t<Wait&> ConnectionImpl::HandleWaitErrors(
+    const std::string& statement, TimeoutDuration network_timeout,
+    tracing::Span& span, Wait&& wait) {
+  try {
+    return wait();
   } catch (const InvalidSqlStatementName& e) {
     LOG_LIMITED_ERROR()
         << "Looks like your pg_bouncer is not in 'session' mode. "
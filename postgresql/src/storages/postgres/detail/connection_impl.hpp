@@ -4,7 +4,9 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/cache/lru_map.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -63,11 +65,17 @@ class ConnectionImpl {
       const std::optional<Query::Name>& query_name) const;
 
   Connection::Statistics GetStatsAndReset();
+  const Connection::Statistics& GetStatistics() const { return stats_; }
 
   ResultSet ExecuteCommand(const Query& query,
                            const detail::QueryParameters& params,
                            OptionalCommandControl statement_cmd_ctl);
 
+  std::vector<ResultSet> ExecuteBatch(
+      const std::vector<Query>& queries,
+      const std::vector<detail::QueryParameters>& params,
+      OptionalCommandControl statement_cmd_ctl);
+
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
              OptionalCommandControl trx_cmd_ctl = {});
@@ -86,6 +94,19 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  void CopyStart(const Query& query, Connection::CopyDirection direction,
+                 OptionalCommandControl statement_cmd_ctl);
+  void CopyPutData(std::string_view data,
+                   OptionalCommandControl statement_cmd_ctl);
+  ResultSet CopyPutEnd(const char* error_message,
+                       OptionalCommandControl statement_cmd_ctl);
+  bool CopyGetData(std::string& buffer,
+                   OptionalCommandControl statement_cmd_ctl);
+
+  void Listen(std::string_view channel, OptionalCommandControl cmd_ctl);
+  void Unlisten(std::string_view channel, OptionalCommandControl cmd_ctl);
+  Notification WaitNotify(engine::Deadline deadline);
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -95,6 +116,12 @@ class ConnectionImpl {
   const UserTypes& GetUserTypes() const;
   void LoadUserTypes();
 
+  Connection::PreparedStatementHints GetPreparedStatements(
+      std::size_t limit) const;
+  std::size_t PrepareStatements(
+      const Connection::PreparedStatementHints& statements,
+      engine::Deadline deadline);
+
   TimeoutDuration GetIdleDuration() const;
   TimeoutDuration GetStatementTimeout() const;
 
@@ -107,6 +134,7 @@ class ConnectionImpl {
     std::string statement;
     std::string statement_name;
     ResultSet description{nullptr};
+    std::vector<Oid> param_types;
   };
 
   using PreparedStatements =
@@ -118,6 +146,10 @@ class ConnectionImpl {
   void CheckDeadlineReached(const engine::Deadline& deadline);
   tracing::Span MakeQuerySpan(const Query& query) const;
   engine::Deadline MakeCurrentDeadline() const;
+  engine::Deadline MakeStatementDeadline(
+      const OptionalCommandControl& statement_cmd_ctl) const;
+  ResultSet WaitCopyResult(engine::Deadline deadline,
+                           TimeoutDuration network_timeout);
 
   void SetTransactionCommandControl(CommandControl cmd_ctl);
 
@@ -162,6 +194,7 @@ class ConnectionImpl {
 
   void LoadUserTypes(engine::Deadline deadline);
   void FillBufferCategories(ResultSet& res);
+  void SetBufferCategories(ResultSet& res, const ResultSet* description_ptr);
 
   template <typename Counter>
   ResultSet WaitResult(const std::string& statement, engine::Deadline deadline,
@@ -169,6 +202,11 @@ class ConnectionImpl {
                        tracing::Span& span, tracing::ScopeTime& scope,
                        const ResultSet* description_ptr);
 
+  template <typename Wait>
+  std::invoke_result_t<Wait&> HandleWaitErrors(const std::string& statement,
+                        TimeoutDuration network_timeout, tracing::Span& span,
+                        Wait&& wait);
+
   void Cancel();
 
   const std::string uuid_;
@@ -186,6 +224,8 @@ class ConnectionImpl {
   testsuite::PostgresControl testsuite_pg_ctl_;
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
+  // statement of the COPY in flight, for logging
+  std::string copy_statement_;
   const error_injection::Settings ei_settings_;
 };
 
@@ -30,7 +30,7 @@ ResultSet NonTransaction::DoExecute(const Query& query,
                                     OptionalCommandControl statement_cmd_ctl) {
   StatementTimer timer{query, conn_};
   auto res = conn_->Execute(query, params, statement_cmd_ctl);
-  timer.Account();
+  timer.Account(res);
   return res;
 }
 
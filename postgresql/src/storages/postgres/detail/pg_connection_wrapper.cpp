@@ -526,6 +526,205 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
   return MakeResult(std::move(handle));
 }
 
+std::vector<ResultSet> PGConnectionWrapper::WaitPipelineResults(
+    std::size_t count, Deadline deadline, tracing::ScopeTime& scope) {
+  UASSERT(IsPipelineActive());
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  // results of a query are terminated by a null result, the last query
+  // results are the ones of the queries sent before the sync
+  std::vector<ResultHandle> handles;
+  handles.reserve(count);
+  auto null_res_counter{0};
+#if LIBPQ_HAS_PIPELINING
+  while (is_syncing_pipeline_ && PQstatus(conn_) != CONNECTION_BAD) {
+    auto handle = MakeResultHandle(nullptr);
+    while (auto* pg_res = ReadResult(deadline)) {
+      null_res_counter = 0;
+      auto next_handle = MakeResultHandle(pg_res);
+      if (PQresultStatus(next_handle.get()) == PGRES_PIPELINE_SYNC) {
+        is_syncing_pipeline_ = false;
+        continue;
+      }
+      if (handle) {
+        PGCW_LOG_LIMITED_INFO()
+            << "Query returned several result sets, a result set is discarded";
+      }
+      handle = std::move(next_handle);
+    }
+    if (handle) {
+      handles.push_back(std::move(handle));
+    } else if (++null_res_counter > 2) {
+      // Same issue as with WaitResult
+      MarkAsBroken();
+      is_syncing_pipeline_ = false;
+    }
+  }
+#endif
+
+  if (handles.size() > count) {
+    // results of the commands that were sent without waiting, e.g. BEGIN
+    handles.erase(handles.begin(),
+                  handles.end() - static_cast<std::ptrdiff_t>(count));
+  }
+  std::vector<ResultSet> results;
+  results.reserve(count);
+  for (auto& handle : handles) {
+    results.push_back(MakeResult(std::move(handle)));
+  }
+  if (results.size() != count) {
+    throw RuntimeError{"Pipeline returned " + std::to_string(results.size()) +
+                       " results instead of " + std::to_string(count)};
+  }
+  return results;
+}
+
+void PGConnectionWrapper::WaitCopyStart(Connection::CopyDirection direction,
+                                        Deadline deadline,
+                                        tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  const auto expected =
+      direction == Connection::CopyDirection::kIn ? PGRES_COPY_IN : PGRES_COPY_OUT;
+  auto handle = MakeResultHandle(ReadResult(deadline));
+  const auto status =
+      handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+  if (status == expected) {
+    return;
+  }
+  if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT ||
+      status == PGRES_COPY_BOTH) {
+    // libpq stays in COPY state, there is no way to leave it gracefully
+    MarkAsBroken();
+    throw LogicError{"Unexpected COPY direction"};
+  }
+
+  // not a COPY query, read the rest of the results and report an error if any
+  while (auto* pg_res = ReadResult(deadline)) {
+    handle = MakeResultHandle(pg_res);
+  }
+  MakeResult(std::move(handle));
+  throw LogicError{"The query is not a COPY query"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  while (true) {
+    const int put_res = PQputCopyData(conn_, data.data(), data.size());
+    if (put_res > 0) break;
+    if (put_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQputCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    // libpq buffer is full, wait for the socket to send it
+    if (!WaitSocketWriteable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while copying data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while sending COPY data to PostgreSQL connection socket";
+      throw ConnectionTimeoutError("Timed out while copying data");
+    }
+  }
+  UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message,
+                                     Deadline deadline) {
+  while (true) {
+    const int put_res = PQputCopyEnd(conn_, error_message);
+    if (put_res > 0) break;
+    if (put_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQputCopyEnd execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    if (!WaitSocketWriteable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while finishing copy");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while finishing COPY to PostgreSQL connection socket";
+      throw ConnectionTimeoutError("Timed out while finishing copy");
+    }
+  }
+  UpdateLastUse();
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& buffer, Deadline deadline) {
+  while (true) {
+    char* row = nullptr;
+    const int length = PQgetCopyData(conn_, &row, 1);
+    if (length > 0) {
+      buffer.append(row, length);
+      PQfreemem(row);
+      UpdateLastUse();
+      return true;
+    }
+    if (length == -1) return false;
+    if (length < -1) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQgetCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+
+    // no complete row yet
+    HandleSocketPostClose();
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while copying data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while reading COPY data from PostgreSQL connection "
+             "socket";
+      throw ConnectionTimeoutError("Timed out while copying data");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+  }
+}
+
+Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
+  PGnotify* pg_notify = nullptr;
+  while (!(pg_notify = PQnotifies(conn_))) {
+    HandleSocketPostClose();
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted(
+            "Task cancelled while waiting for notification");
+      }
+      throw ConnectionTimeoutError("Timed out while waiting for notification");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+
+  const std::unique_ptr<PGnotify, decltype(&PQfreemem)> holder{pg_notify,
+                                                                &PQfreemem};
+  Notification notification{pg_notify->relname, std::nullopt};
+  if (pg_notify->extra && *pg_notify->extra) {
+    notification.payload.emplace(pg_notify->extra);
+  }
+  return notification;
+}
+
+void PGConnectionWrapper::DiscardNotifications() {
+  while (auto* pg_notify = PQnotifies(conn_)) {
+    PQfreemem(pg_notify);
+  }
+}
+
+std::string PGConnectionWrapper::EscapeIdentifier(std::string_view identifier) {
+  const std::unique_ptr<char, decltype(&PQfreemem)> escaped{
+      PQescapeIdentifier(conn_, identifier.data(), identifier.size()),
+      &PQfreemem};
+  if (!escaped) {
+    throw CommandError(std::string{"PQescapeIdentifier execution error: "} +
+                       PQerrorMessage(conn_));
+  }
+  return escaped.get();
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -16,6 +17,7 @@
 #include <storages/postgres/detail/result_wrapper.hpp>
 #include <userver/engine/semaphore.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -103,6 +105,39 @@ class PGConnectionWrapper {
   /// Will return result or throw an exception
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&);
 
+  /// @brief Wait for the results of the queries sent in pipeline mode.
+  /// Returns a result per query in the order of sending. All the results are
+  /// read before throwing an exception for the first failed query.
+  std::vector<ResultSet> WaitPipelineResults(std::size_t count,
+                                             Deadline deadline,
+                                             tracing::ScopeTime&);
+
+  /// @brief Wait for the server to enter the COPY state of the sent query.
+  /// Throws if the query is not a COPY in the expected direction.
+  void WaitCopyStart(Connection::CopyDirection direction, Deadline deadline,
+                     tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, the result of the COPY command should
+  /// be read with WaitResult. A non-null error message aborts the COPY.
+  void PutCopyEnd(const char* error_message, Deadline deadline);
+
+  /// @brief Wrapper for PQgetCopyData, appends a row to the buffer.
+  /// Returns false when the COPY is done, the result of the COPY command
+  /// should be read with WaitResult then.
+  bool GetCopyData(std::string& buffer, Deadline deadline);
+
+  /// @brief Wait for an asynchronous notification, including the ones
+  /// received while waiting for the commands results
+  Notification WaitNotify(Deadline deadline);
+  /// @brief Drop the notifications received so far
+  void DiscardNotifications();
+
+  /// @brief Wrapper for PQescapeIdentifier
+  std::string EscapeIdentifier(std::string_view identifier);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline);
   /// Consume all input discarding all result sets
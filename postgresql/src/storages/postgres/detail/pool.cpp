@@ -1,5 +1,8 @@
 #include <storages/postgres/detail/pool.hpp>
 
+#include <algorithm>
+#include <unordered_set>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
@@ -36,6 +39,7 @@ constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
 constexpr std::chrono::seconds kConnectingTimeout{2};
+constexpr std::chrono::seconds kWarmupTimeout{2};
 constexpr auto kPendingConnectsMax{1};
 
 // Max idle connections that can be dropped in one run of maintenance task
@@ -149,14 +153,16 @@ void ConnectionPool::Init(InitMode mode) {
     throw InvalidConfig(
         "PostgreSQL pool max size is less than requested initial size");
   }
+  // spare connections are warmed up along with the minimal ones
+  const auto initial_size = std::min(
+      settings->max_size, std::max(settings->min_size, settings->spare_size));
 
   LOG_INFO() << (mode == InitMode::kAsync ? "Asynchronously" : "Synchronously")
              << " initializing PostgreSQL connection pool, creating up to "
-             << settings->min_size << " connections to "
-             << DsnCutPassword(dsn_);
+             << initial_size << " connections to " << DsnCutPassword(dsn_);
 
   if (mode == InitMode::kAsync) {
-    for (std::size_t i = 0; i < settings->min_size; ++i) {
+    for (std::size_t i = 0; i < initial_size; ++i) {
       connect_task_storage_.Detach(
           Connect(engine::SemaphoreLock{size_semaphore_, std::try_to_lock}));
     }
@@ -166,8 +172,8 @@ void ConnectionPool::Init(InitMode mode) {
   }
 
   std::vector<engine::TaskWithResult<bool>> tasks;
-  tasks.reserve(settings->min_size);
-  for (std::size_t i = 0; i < settings->min_size; ++i) {
+  tasks.reserve(initial_size);
+  for (std::size_t i = 0; i < initial_size; ++i) {
     tasks.push_back(
         Connect(engine::SemaphoreLock{size_semaphore_, std::try_to_lock}));
   }
@@ -208,6 +214,7 @@ ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
 
   ++stats_.connection.used;
   connection->UpdateDefaultCommandControl();
+  CheckSpareConnections();
   return connection;
 }
 
@@ -222,6 +229,7 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.rollback_total += conn_stats.rollback_total;
   stats_.transaction.out_of_trx_total += conn_stats.out_of_trx;
   stats_.transaction.parse_total += conn_stats.parse_total;
+  stats_.transaction.prepared_hit_total += conn_stats.prepared_hit_total;
   stats_.transaction.execute_total += conn_stats.execute_total;
   stats_.transaction.reply_total += conn_stats.reply_total;
   stats_.transaction.portal_bind_total += conn_stats.portal_bind_total;
@@ -260,7 +268,11 @@ void ConnectionPool::Release(Connection* connection) {
 
   // Grab stats only if connection is not in transaction
   if (!connection->IsInTransaction()) {
-    AccountConnectionStats(connection->GetStatsAndReset());
+    const auto conn_stats = connection->GetStatsAndReset();
+    AccountConnectionStats(conn_stats);
+    if (conn_stats.parse_total > 0) {
+      UpdateHotStatements(*connection);
+    }
   }
 
   if (!connection->IsConnected() || connection->IsBroken()) {
@@ -288,6 +300,11 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
   return stats_;
 }
 
+std::size_t ConnectionPool::GetLoadApprox() const {
+  return stats_.connection.used.Load() +
+         wait_count_.load(std::memory_order_relaxed);
+}
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl) {
   const auto trx_start_time = detail::SteadyClock::now();
@@ -307,6 +324,24 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
   return NonTransaction{std::move(conn), start_time};
 }
 
+QueryQueue ConnectionPool::CreateQueryQueue(OptionalCommandControl cmd_ctl) {
+  const auto start_time = detail::SteadyClock::now();
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+  auto conn = Acquire(deadline);
+  UASSERT(conn);
+  return QueryQueue{std::move(conn), std::move(cmd_ctl), start_time};
+}
+
+NotifyScope ConnectionPool::Listen(std::string_view channel,
+                                   OptionalCommandControl cmd_ctl) {
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+  auto conn = Acquire(deadline);
+  UASSERT(conn);
+  return NotifyScope{std::move(conn), channel, std::move(cmd_ctl)};
+}
+
 TimeoutDuration ConnectionPool::GetExecuteTimeout(
     OptionalCommandControl cmd_ctl) const {
   if (cmd_ctl) return cmd_ctl->execute;
@@ -416,6 +451,13 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
   }
   LOG_TRACE() << "PostgreSQL connection created";
 
+  PrepareHotStatements(*connection);
+  if (!connection->IsConnected() || connection->IsBroken()) {
+    ++stats_.connection.error_total;
+    DeleteConnection(connection.release());
+    return false;
+  }
+
   // Clean up the statistics and not account it
   [[maybe_unused]] const auto& stats = connection->GetStatsAndReset();
 
@@ -449,6 +491,68 @@ void ConnectionPool::CheckMinPoolSizeUnderflow() {
   }
 }
 
+void ConnectionPool::CheckSpareConnections() {
+  auto settings = settings_.Read();
+  if (settings->spare_size == 0) return;
+
+  // connections being established are already accounted in the pool size
+  const auto count = size_semaphore_.UsedApprox();
+  const std::size_t used = stats_.connection.used.Load();
+  if (count >= used + settings->spare_size) return;
+
+  auto conn_settings = conn_settings_.Read();
+  if (recent_conn_errors_.GetStatsForPeriod(kRecentErrorPeriod, true) >=
+      conn_settings->recent_errors_threshold) {
+    LOG_DEBUG() << "Too many connection errors in recent period";
+    return;
+  }
+  // spare connections never wait for a free pool slot
+  engine::SemaphoreLock size_lock{size_semaphore_, std::try_to_lock};
+  if (size_lock) {
+    LOG_DEBUG() << "Spare connections count is less than spare_size ("
+                << count - std::min(count, used) << " < "
+                << settings->spare_size << "). Create new connection.";
+    connect_task_storage_.Detach(Connect(std::move(size_lock)));
+  }
+}
+
+void ConnectionPool::UpdateHotStatements(const Connection& connection) {
+  auto conn_settings = conn_settings_.Read();
+  const auto limit = conn_settings->warmup_prepared_statements;
+  if (limit == 0) return;
+
+  auto statements = connection.GetPreparedStatements(limit);
+  std::unordered_set<std::size_t> ids;
+  for (const auto& statement : statements) {
+    ids.insert(statement.id.GetUnderlying());
+  }
+
+  auto writer = hot_statements_.StartWrite();
+  // statements of the connection go first, followed by the ones known before
+  for (auto& statement : *writer) {
+    if (statements.size() >= limit) break;
+    if (ids.insert(statement.id.GetUnderlying()).second) {
+      statements.push_back(std::move(statement));
+    }
+  }
+  *writer = std::move(statements);
+  writer.Commit();
+}
+
+void ConnectionPool::PrepareHotStatements(Connection& connection) {
+  if (connection.GetSettings().warmup_prepared_statements == 0) return;
+
+  const auto statements = hot_statements_.Read();
+  if (statements->empty()) return;
+  try {
+    stats_.transaction.prepared_warmup_total += connection.PrepareStatements(
+        *statements, engine::Deadline::FromDuration(kWarmupTimeout));
+  } catch (const Error& e) {
+    LOG_LIMITED_WARNING() << "Failed to prepare statements in advance for `"
+                          << DsnCutPassword(dsn_) << "`: " << e;
+  }
+}
+
 void ConnectionPool::Push(Connection* connection) {
   if (connection->IsInAbortedPipeline()) {
     // TODO : this is us investigating issues with pipelining,
@@ -609,6 +713,9 @@ void ConnectionPool::MaintainConnections() {
   auto count = size_semaphore_.UsedApprox();
   auto drop_left = kIdleDropLimit;
   auto settings = settings_.Read();
+  const auto keep_size = std::max(
+      settings->min_size,
+      std::size_t{stats_.connection.used.Load()} + settings->spare_size);
   while (count > 0 && stale_connection) {
     try {
       auto deleter = [this](Connection* c) { DeleteConnection(c); };
@@ -620,7 +727,7 @@ void ConnectionPool::MaintainConnections() {
         break;
       }
       stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-      if (count > settings->min_size && drop_left > 0) {
+      if (count > keep_size && drop_left > 0) {
         --drop_left;
         --stats_.connection.used;
         LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_)
@@ -646,6 +753,7 @@ void ConnectionPool::MaintainConnections() {
 
   // Check and maintain minimum count of connections
   CheckMinPoolSizeUnderflow();
+  CheckSpareConnections();
 }
 
 void ConnectionPool::StartMaintainTask() {
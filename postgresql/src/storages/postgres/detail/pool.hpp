@@ -26,7 +26,9 @@
 #include <userver/congestion_control/controllers/linear.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -71,11 +73,22 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   void Release(Connection* connection);
 
   const InstanceStatistics& GetStatistics() const;
+
+  /// Count of the connections in use and the requests waiting for a
+  /// connection
+  std::size_t GetLoadApprox() const;
+
   [[nodiscard]] Transaction Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl = {});
 
   [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+  [[nodiscard]] QueryQueue CreateQueryQueue(
+      OptionalCommandControl cmd_ctl = {});
+
+  [[nodiscard]] NotifyScope Listen(std::string_view channel,
+                                   OptionalCommandControl cmd_ctl = {});
+
   CommandControl GetDefaultCommandControl() const;
 
   void SetSettings(const PoolSettings& settings);
@@ -104,6 +117,10 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   void TryCreateConnectionAsync();
   void CheckMinPoolSizeUnderflow();
+  void CheckSpareConnections();
+
+  void UpdateHotStatements(const Connection& connection);
+  void PrepareHotStatements(Connection& connection);
 
   void Push(Connection* connection);
   Connection* Pop(engine::Deadline);
@@ -148,6 +165,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementTimingsStorage sts_;
+  // most recently prepared statements, to be prepared on new connections
+  rcu::Variable<Connection::PreparedStatementHints> hot_statements_;
   dynamic_config::Source config_source_;
 
   // Congestion control stuff
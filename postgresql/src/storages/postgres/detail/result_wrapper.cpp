@@ -129,6 +129,10 @@ ExecStatusType ResultWrapper::GetStatus() const {
 
 std::size_t ResultWrapper::RowCount() const { return PQntuples(handle_.get()); }
 
+std::size_t ResultWrapper::GetMemorySize() const {
+  return PQresultMemorySize(handle_.get());
+}
+
 std::size_t ResultWrapper::FieldCount() const {
   return PQnfields(handle_.get());
 }
@@ -40,6 +40,8 @@ class ResultWrapper {
   }
   std::string CommandStatus() const;
   std::size_t RowsAffected() const;
+  /// Memory occupied by the result, approximately the received data size
+  std::size_t GetMemorySize() const;
 
   std::size_t IndexOfName(const std::string& name) const;
 
@@ -1,8 +1,12 @@
 #include "statement_timer.hpp"
 
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/result_wrapper.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -10,21 +14,49 @@ namespace storages::postgres::detail {
 
 StatementTimer::StatementTimer(const Query& query, const ConnectionPtr& conn)
     : query_{query},
+      conn_{conn},
       sts_{conn.GetStatementTimingsStorage()},
-      start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {}
+      start_{IsEnabled() ? Now() : SteadyClock::time_point{}},
+      parse_total_{IsEnabled() ? conn->GetStatistics().parse_total : 0} {}
+
+StatementTimer::~StatementTimer() {
+  if (accounted_ || !IsEnabled()) return;
+
+  StatementTimingsStorage::Execution execution;
+  execution.parsed = WasParsed();
+  execution.failed = true;
+  try {
+    sts_->Account(query_.GetName()->GetUnderlying(), execution);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to account statement error: " << e;
+  }
+}
 
-void StatementTimer::Account() {
-  if (sts_ == nullptr || !query_.GetName().has_value()) return;
+void StatementTimer::Account(const ResultSet& result) {
+  accounted_ = true;
+  if (!IsEnabled()) return;
 
-  const auto duration_ms =
+  StatementTimingsStorage::Execution execution;
+  execution.duration_ms =
       std::chrono::duration_cast<std::chrono::milliseconds>(Now() - start_)
           .count();
+  execution.rows = result.Size();
+  execution.result_bytes = result.pimpl_->GetMemorySize();
+  execution.parsed = WasParsed();
 
-  sts_->Account(query_.GetName()->GetUnderlying(), duration_ms);
+  sts_->Account(query_.GetName()->GetUnderlying(), execution);
 }
 
 SteadyClock::time_point StatementTimer::Now() { return SteadyClock::now(); }
 
+bool StatementTimer::IsEnabled() const {
+  return sts_ != nullptr && query_.GetName().has_value();
+}
+
+bool StatementTimer::WasParsed() const {
+  return conn_ && conn_->GetStatistics().parse_total != parse_total_;
+}
+
 }  // namespace storages::postgres::detail
 
 USERVER_NAMESPACE_END
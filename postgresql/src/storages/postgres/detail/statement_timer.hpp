@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <userver/storages/postgres/detail/time_types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -7,6 +9,7 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::postgres {
 
 class Query;
+class ResultSet;
 
 namespace detail {
 
@@ -16,16 +19,27 @@ class StatementTimingsStorage;
 class StatementTimer final {
  public:
   StatementTimer(const Query& query, const ConnectionPtr& conn);
+  /// Accounts a failed execution if the successful one was not accounted
+  ~StatementTimer();
+
+  StatementTimer(const StatementTimer&) = delete;
+  StatementTimer& operator=(const StatementTimer&) = delete;
 
-  void Account();
+  void Account(const ResultSet& result);
 
  private:
   static SteadyClock::time_point Now();
 
+  bool IsEnabled() const;
+  bool WasParsed() const;
+
   const Query& query_;
+  const ConnectionPtr& conn_;
   const StatementTimingsStorage* sts_;
 
   const SteadyClock::time_point start_;
+  const std::size_t parse_total_;
+  bool accounted_{false};
 };
 
 }  // namespace detail
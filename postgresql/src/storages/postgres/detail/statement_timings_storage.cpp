@@ -28,13 +28,13 @@ StatementTimingsStorage::~StatementTimingsStorage() {
 }
 
 void StatementTimingsStorage::Account(const std::string& statement_name,
-                                      std::size_t duration_ms) const {
+                                      const Execution& execution) const {
   if (!IsEnabled()) return;
 
   const auto producer = data_.events_queue->GetProducer();
 
   [[maybe_unused]] const auto success = producer.PushNoblock(
-      std::make_unique<StatementEvent>(statement_name, duration_ms));
+      std::make_unique<StatementEvent>(statement_name, execution));
 }
 
 std::unordered_map<std::string, StatementTimingsStorage::Percentile>
@@ -49,9 +49,42 @@ StatementTimingsStorage::GetTimingsPercentiles() const {
 
   timings.VisitAll(
       [&result](const std::string& key,
-                const std::unique_ptr<StatementTimingsStorage::RecentPeriod>&
-                    recent_period) {
-        result.emplace(key, recent_period->GetStatsForPeriod());
+                const std::unique_ptr<StatementData>& statement_data) {
+        result.emplace(key, statement_data->timings.GetStatsForPeriod());
+      });
+
+  return result;
+}
+
+std::optional<std::chrono::milliseconds>
+StatementTimingsStorage::GetTimingsPercentile(const std::string& statement_name,
+                                              double percent) const {
+  if (!IsEnabled()) return std::nullopt;
+
+  // The lookup bumps the statement in the LRU
+  auto locked_ptr = data_.timings->UniqueLock();
+  const auto* statement_data = locked_ptr->Get(statement_name);
+  if (!statement_data) return std::nullopt;
+
+  const auto timings = (*statement_data)->timings.GetStatsForPeriod();
+  if (timings.Count() == 0) return std::nullopt;
+  return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
+std::unordered_map<std::string, StatementStatistics>
+StatementTimingsStorage::GetStatementsStatistics() const {
+  if (!IsEnabled()) return {};
+
+  auto locked_ptr = data_.timings->SharedLock();
+  const auto& timings = *locked_ptr;
+
+  std::unordered_map<std::string, StatementStatistics> result;
+  result.reserve(timings.GetSize());
+
+  timings.VisitAll(
+      [&result](const std::string& key,
+                const std::unique_ptr<StatementData>& statement_data) {
+        result.emplace(key, statement_data->stats);
       });
 
   return result;
@@ -100,18 +133,30 @@ void StatementTimingsStorage::ProcessEvents() {
 
 void StatementTimingsStorage::AccountEvent(EventPtr event_ptr) const {
   const auto& name = event_ptr->statement_name;
-  const auto duration = event_ptr->duration_ms;
+  const auto& execution = event_ptr->execution;
 
   auto locked_ptr = data_.timings->UniqueLock();
   auto& data = *locked_ptr;
 
-  auto* timing_ptr = data.Get(name);
-  if (!timing_ptr) {
-    data.Put(name, std::make_unique<RecentPeriod>());
-    timing_ptr = data.Get(name);
+  auto* statement_ptr = data.Get(name);
+  if (!statement_ptr) {
+    data.Put(name, std::make_unique<StatementData>());
+    statement_ptr = data.Get(name);
+  }
+  UASSERT(statement_ptr);
+  auto& statement_data = **statement_ptr;
+
+  auto& stats = statement_data.stats;
+  if (execution.parsed) ++stats.parsed;
+  if (execution.failed) {
+    ++stats.errors;
+    return;
   }
-  UASSERT(timing_ptr);
-  (*timing_ptr)->GetCurrentCounter().Account(duration);
+  ++stats.executed;
+  stats.rows += execution.rows;
+  stats.result_bytes += execution.result_bytes;
+  stats.timings.Account(execution.duration_ms);
+  statement_data.timings.GetCurrentCounter().Account(execution.duration_ms);
 }
 
 StatementTimingsStorage::StorageData StatementTimingsStorage::CreateStorageData(
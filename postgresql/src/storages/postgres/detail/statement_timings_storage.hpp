@@ -11,6 +11,8 @@
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
+#include <chrono>
+#include <optional>
 #include <unordered_map>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,11 +26,27 @@ class StatementTimingsStorage final {
   StatementTimingsStorage(const StatementMetricsSettings& settings);
   ~StatementTimingsStorage();
 
+  /// Execution of a named statement
+  struct Execution final {
+    std::size_t duration_ms{0};
+    std::size_t rows{0};
+    std::size_t result_bytes{0};
+    bool parsed{false};
+    bool failed{false};
+  };
+
   void Account(const std::string& statement_name,
-               std::size_t duration_ms) const;
+               const Execution& execution) const;
 
   std::unordered_map<std::string, Percentile> GetTimingsPercentiles() const;
 
+  /// The `percent` percentile of the recent timings of the statement, if any
+  std::optional<std::chrono::milliseconds> GetTimingsPercentile(
+      const std::string& statement_name, double percent) const;
+
+  std::unordered_map<std::string, StatementStatistics>
+  GetStatementsStatistics() const;
+
   void SetSettings(const StatementMetricsSettings& settings);
 
   // For testing purposes, don't use directly
@@ -36,11 +54,12 @@ class StatementTimingsStorage final {
 
  private:
   struct StatementEvent final {
-    StatementEvent(const std::string& statement_name_, size_t duration_)
-        : statement_name{statement_name_}, duration_ms{duration_} {}
+    StatementEvent(const std::string& statement_name_,
+                   const Execution& execution_)
+        : statement_name{statement_name_}, execution{execution_} {}
 
     std::string statement_name;
-    std::size_t duration_ms;
+    Execution execution;
   };
   using EventPtr = std::unique_ptr<StatementEvent>;
 
@@ -48,9 +67,13 @@ class StatementTimingsStorage final {
   using RecentPeriod =
       USERVER_NAMESPACE::utils::statistics::RecentPeriod<Percentile,
                                                          Percentile>;
+  struct StatementData final {
+    RecentPeriod timings;
+    StatementStatistics stats;
+  };
   using StorageType =
       USERVER_NAMESPACE::cache::LruMap<std::string,
-                                       std::unique_ptr<RecentPeriod>>;
+                                       std::unique_ptr<StatementData>>;
   using Storage =
       USERVER_NAMESPACE::concurrent::Variable<StorageType, engine::SharedMutex>;
 
@@ -15,6 +15,8 @@ namespace {
 // key - $1
 // owner - $2
 // timeout in seconds - $3
+// Transaction ids only grow, so the id of the successful acquisition
+// serves as the fencing token.
 std::string MakeAcquireQuery(const std::string& table) {
   static constexpr auto kAcquireQueryFmt = R"(
     INSERT INTO {} AS t (key, owner, expiration_time) VALUES
@@ -22,7 +24,7 @@ std::string MakeAcquireQuery(const std::string& table) {
     ON CONFLICT (key) DO UPDATE
     SET owner = $2, expiration_time = current_timestamp + make_interval(secs => $3)
     WHERE (t.owner = $2) OR
-    (t.expiration_time <= current_timestamp) RETURNING 1;
+    (t.expiration_time <= current_timestamp) RETURNING txid_current();
 )";
   return fmt::format(FMT_COMPILE(kAcquireQueryFmt), table);
 }
@@ -63,6 +65,12 @@ void DistLockStrategy::UpdateCommandControl(CommandControl cc) {
 
 void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
                                const std::string& locker_id) {
+  AcquireWithFencingToken(lock_ttl, locker_id);
+}
+
+std::optional<dist_lock::FencingToken>
+DistLockStrategy::AcquireWithFencingToken(std::chrono::milliseconds lock_ttl,
+                                          const std::string& locker_id) {
   double timeout_seconds = lock_ttl.count() / 1000.0;
   auto cc_ptr = cc_.Read();
   auto result = cluster_->Execute(
@@ -70,6 +78,7 @@ void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
       MakeOwnerId(owner_prefix_, locker_id), timeout_seconds);
 
   if (result.IsEmpty()) throw dist_lock::LockIsAcquiredByAnotherHostException();
+  return result.AsSingleRow<dist_lock::FencingToken>();
 }
 
 void DistLockStrategy::Release(const std::string& locker_id) {
@@ -1,8 +1,10 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <vector>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/portal.hpp>
 
 #include <storages/postgres/util_benchmark.hpp>
 
@@ -53,6 +55,38 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
   });
 }
 
+constexpr std::int64_t kResultRows = 100'000;
+constexpr std::uint32_t kChunkRows = 10'000;
+constexpr const char* kResultQuery = "select generate_series(1::bigint, $1)";
+
+BENCHMARK_F(PgConnection, Int64ResultAsContainer)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    for (auto _ : state) {
+      auto res = GetConnection().Execute(kResultQuery, kResultRows);
+      auto values = res.AsContainer<std::vector<std::int64_t>>();
+      benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * kResultRows);
+  });
+}
+
+BENCHMARK_F(PgConnection, Int64PortalFetchAllInto)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    pg::detail::StaticQueryParameters<1> params;
+    params.Write(GetConnection().GetUserTypes(), kResultRows);
+    GetConnection().Begin({}, pg::detail::SteadyClock::now());
+    for (auto _ : state) {
+      pg::Portal portal{&GetConnection(), kResultQuery,
+                        pg::detail::QueryParameters{params}};
+      std::vector<std::int64_t> values;
+      portal.FetchAllInto(values, kChunkRows);
+      benchmark::DoNotOptimize(values);
+    }
+    GetConnection().Rollback();
+    state.SetItemsProcessed(state.iterations() * kResultRows);
+  });
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#include <userver/storages/postgres/notify.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+NotifyScope::NotifyScope(detail::ConnectionPtr conn, std::string_view channel,
+                         OptionalCommandControl cmd_ctl)
+    : conn_{std::move(conn)}, channel_{channel}, cmd_ctl_{std::move(cmd_ctl)} {
+  conn_->Listen(channel_, cmd_ctl_);
+}
+
+NotifyScope::NotifyScope(NotifyScope&&) noexcept = default;
+
+NotifyScope& NotifyScope::operator=(NotifyScope&&) noexcept = default;
+
+NotifyScope::~NotifyScope() {
+  if (!conn_) return;
+  try {
+    conn_->Unlisten(channel_, cmd_ctl_);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to unlisten channel '" << channel_ << "': " << e;
+  }
+}
+
+Notification NotifyScope::WaitNotify(engine::Deadline deadline) {
+  if (!conn_) {
+    throw LogicError{"NotifyScope has no connection"};
+  }
+  return conn_->WaitNotify(deadline);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
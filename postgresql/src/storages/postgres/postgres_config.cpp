@@ -64,6 +64,9 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
   settings.recent_errors_threshold =
       config["recent-errors-threshold"].template As<size_t>(
           settings.recent_errors_threshold);
+  settings.warmup_prepared_statements =
+      config["warmup-prepared-statements"].template As<size_t>(
+          settings.warmup_prepared_statements);
   return settings;
 }
 
@@ -92,6 +95,8 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.spare_size =
+      config["spare_pool_size"].template As<size_t>(result.spare_size);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
@@ -0,0 +1,55 @@
+#include <userver/storages/postgres/query_queue.hpp>
+
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+QueryQueue::QueryQueue(detail::ConnectionPtr&& conn,
+                       OptionalCommandControl cmd_ctl,
+                       detail::SteadyClock::time_point start_time)
+    : conn_{std::move(conn)}, cmd_ctl_{std::move(cmd_ctl)} {
+  conn_->Start(start_time);
+}
+
+QueryQueue::QueryQueue(QueryQueue&&) noexcept = default;
+
+QueryQueue& QueryQueue::operator=(QueryQueue&&) noexcept = default;
+
+QueryQueue::~QueryQueue() {
+  if (conn_) conn_->Finish();
+}
+
+void QueryQueue::Reserve(std::size_t size) {
+  queries_.reserve(size);
+  params_.reserve(size);
+}
+
+std::vector<ResultSet> QueryQueue::Collect() {
+  if (!conn_) {
+    throw LogicError{"QueryQueue has no connection"};
+  }
+
+  std::vector<detail::QueryParameters> params;
+  params.reserve(params_.size());
+  for (auto& query_params : params_) {
+    params.emplace_back(query_params);
+  }
+
+  // the queue is emptied even if the execution fails
+  const auto queries = std::exchange(queries_, {});
+  const auto params_holder = std::exchange(params_, {});
+  return conn_->ExecuteBatch(queries, params, cmd_ctl_);
+}
+
+const UserTypes& QueryQueue::GetConnectionUserTypes() const {
+  return conn_->GetUserTypes();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
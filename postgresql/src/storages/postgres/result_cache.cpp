@@ -0,0 +1,79 @@
+#include <userver/storages/postgres/result_cache.hpp>
+
+#include <memory>
+
+#include <userver/storages/postgres/cluster.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+template <typename T>
+void AppendRaw(std::string& key, const T& value) {
+  key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string MakeKey(const Query& query, const ParameterStore& store) {
+  const auto& name = query.GetName();
+  std::string key = name ? name->GetUnderlying() : query.Statement();
+  // separates the name from the parameters
+  key.push_back('\0');
+
+  const auto& params = store.GetInternalData();
+  for (std::size_t i = 0; i < params.Size(); ++i) {
+    AppendRaw(key, params.ParamTypesBuffer()[i]);
+    const auto* buffer = params.ParamBuffers()[i];
+    const int length = buffer ? params.ParamLengthsBuffer()[i] : -1;
+    AppendRaw(key, length);
+    if (length > 0) key.append(buffer, length);
+  }
+  return key;
+}
+
+}  // namespace
+
+ResultCache::ResultCache(ClusterPtr cluster,
+                         const ResultCacheSettings& settings)
+    : cluster_{std::move(cluster)}, cache_{settings.ways, settings.way_size} {
+  UASSERT(cluster_);
+  cache_.SetMaxLifetime(settings.lifetime);
+}
+
+ResultCache::~ResultCache() = default;
+
+ResultSet ResultCache::Execute(ClusterHostTypeFlags flags, const Query& query,
+                               ParameterStore&& store) {
+  auto key = MakeKey(query, store);
+  // The update may run in a separate task that outlives the caller, so it
+  // owns everything it uses
+  return cache_.Get(
+      key, [cluster = cluster_, flags, query,
+            store = std::make_shared<const ParameterStore>(std::move(store))](
+               const std::string&) {
+        return cluster->Execute(flags, query, *store);
+      });
+}
+
+void ResultCache::Invalidate() { cache_.Invalidate(); }
+
+void ResultCache::SetSettings(const ResultCacheSettings& settings) {
+  cache_.SetWaySize(settings.way_size);
+  cache_.SetMaxLifetime(settings.lifetime);
+}
+
+const cache::impl::ExpirableLruCacheStatistics& ResultCache::GetStatistics()
+    const {
+  return cache_.GetStatistics();
+}
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const ResultCache& cache) {
+  writer = cache.GetStatistics();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
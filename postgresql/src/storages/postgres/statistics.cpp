@@ -4,6 +4,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const StatementStatistics& stats) {
+  writer["executed"] = stats.executed;
+  writer["errors"] = stats.errors;
+  writer["parsed"] = stats.parsed;
+  writer["rows"] = stats.rows;
+  writer["result-bytes"] = stats.result_bytes;
+  writer["timings"] = stats.timings;
+}
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const InstanceStatisticsNonatomic& stats) {
   if (auto conn = writer["connections"]) {
@@ -32,6 +42,8 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   }
   if (auto query = writer["queries"]) {
     query["parsed"] = stats.transaction.parse_total;
+    query["prepared-cache-hits"] = stats.transaction.prepared_hit_total;
+    query["prepared-in-advance"] = stats.transaction.prepared_warmup_total;
     query["portals-bound"] = stats.transaction.portal_bind_total;
     query["executed"] = stats.transaction.execute_total;
     query["replies"] = stats.transaction.reply_total;
@@ -63,6 +75,12 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
       timings.ValueWithLabels(percentile, {"postgresql_query", name});
     }
   }
+  if (!stats.statement_stats.empty()) {
+    auto statements = writer["statements"];
+    for (const auto& [name, statement_stats] : stats.statement_stats) {
+      statements.ValueWithLabels(statement_stats, {"postgresql_query", name});
+    }
+  }
 }
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -645,6 +645,50 @@ TEST(PostgreIO, ArraysUnorderedSet) {
   }
 }
 
+TEST(PostgreIO, ArraysFixedWidth) {
+  const pg::io::TypeBufferCategory categories = GetTestTypeCategories();
+  {
+    const std::vector<double> src{1.5, -2.25, 0, 1e300};
+    pg::test::Buffer buffer;
+    UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, src));
+    auto fb =
+        pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kArrayBuffer);
+    std::vector<double> tgt{42};
+    UEXPECT_NO_THROW(io::ReadBuffer(fb, tgt, categories));
+    EXPECT_EQ(src, tgt);
+  }
+  {
+    const std::vector<std::vector<std::int64_t>> src{{1, 2}, {-3, 4}};
+    pg::test::Buffer buffer;
+    UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, src));
+    auto fb =
+        pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kArrayBuffer);
+    std::vector<std::vector<std::int64_t>> tgt;
+    UEXPECT_NO_THROW(io::ReadBuffer(fb, tgt, categories));
+    EXPECT_EQ(src, tgt);
+  }
+  {
+    // elements of other width are parsed as usual
+    const std::vector<std::int64_t> src{1, -2, 3};
+    pg::test::Buffer buffer;
+    UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, src));
+    auto fb =
+        pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kArrayBuffer);
+    std::vector<std::int32_t> tgt;
+    UEXPECT_NO_THROW(io::ReadBuffer(fb, tgt, categories));
+    EXPECT_EQ((std::vector<std::int32_t>{1, -2, 3}), tgt);
+  }
+  {
+    const static_test::one_dim_vector src{1, std::nullopt, 3};
+    pg::test::Buffer buffer;
+    UEXPECT_NO_THROW(io::WriteBuffer(types, buffer, src));
+    auto fb =
+        pg::test::MakeFieldBuffer(buffer, io::BufferCategory::kArrayBuffer);
+    std::vector<int> tgt;
+    UEXPECT_THROW(io::ReadBuffer(fb, tgt, categories), pg::TypeCannotBeNull);
+  }
+}
+
 UTEST_P(PostgreConnection, ArrayRoundtrip) {
   CheckConnection(GetConn());
   pg::ResultSet res{nullptr};
@@ -10,6 +10,7 @@
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/result_cache.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -59,6 +60,26 @@ pg::Cluster CreateCluster(
                      {kTestCmdCtl, {}, {}}, {}, {}, testsuite_tasks, source, 0);
 }
 
+pg::ClusterPtr CreateClusterPtr(const pg::DsnList& dsns,
+                                engine::TaskProcessor& bg_task_processor,
+                                size_t max_size,
+                                testsuite::TestsuiteTasks& testsuite_tasks) {
+  auto source = dynamic_config::GetDefaultSource();
+  return std::make_shared<pg::Cluster>(
+      dsns, nullptr, bg_task_processor,
+      pg::ClusterSettings{{},
+                          {utest::kMaxTestWaitTime},
+                          {0, max_size, max_size},
+                          kCachePreparedStatements,
+                          storages::postgres::InitMode::kAsync,
+                          "",
+                          {},
+                          {}},
+      pg::DefaultCommandControls{kTestCmdCtl, {}, {}},
+      testsuite::PostgresControl{}, error_injection::Settings{},
+      testsuite_tasks, source, 0);
+}
+
 }  // namespace
 
 class PostgreCluster : public PostgreSQLBase {};
@@ -159,6 +180,10 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
       cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
                      pg::ClusterHostType::kNearest},
                     pg::Transaction::RW));
+  CheckRwTransaction(
+      cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
+                     pg::ClusterHostType::kLeastLoaded},
+                    pg::Transaction::RW));
 
   UEXPECT_THROW(
       cluster.Begin(
@@ -188,6 +213,9 @@ UTEST_F(PostgreCluster, ClusterSlaveRO) {
   CheckRoTransaction(cluster.Begin(
       {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest},
       pg::Transaction::RO));
+  CheckRoTransaction(cluster.Begin(
+      {pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RO));
 
   UEXPECT_THROW(cluster.Begin({pg::ClusterHostType::kSlave,
                                pg::ClusterHostType::kRoundRobin,
@@ -230,6 +258,10 @@ UTEST_F(PostgreCluster, ClusterAnyRO) {
       cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster,
                      pg::ClusterHostType::kNearest},
                     pg::Transaction::RO));
+  CheckRoTransaction(
+      cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster,
+                     pg::ClusterHostType::kLeastLoaded},
+                    pg::Transaction::RO));
 
   UEXPECT_THROW(
       cluster.Begin(
@@ -262,6 +294,35 @@ UTEST_F(PostgreCluster, SingleQuery) {
   EXPECT_EQ(1, res.Size());
 }
 
+UTEST_F(PostgreCluster, ExecuteHedged) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+  const pg::HedgingSettings settings{std::chrono::milliseconds{10},
+                                     95.0, 0.5};
+
+  UEXPECT_THROW(cluster.ExecuteHedged({}, {}, settings, "select 1"),
+                pg::LogicError);
+  UEXPECT_THROW(cluster.ExecuteHedged(pg::ClusterHostType::kMaster, {},
+                                      settings, "select 1"),
+                pg::LogicError);
+  UEXPECT_THROW(
+      cluster.ExecuteHedged(pg::ClusterHostType::kSlave, {},
+                            pg::HedgingSettings{{}, {}, 2.0}, "select 1"),
+      pg::LogicError);
+
+  // There is nothing to hedge with, so the hosts are the ones of Execute()
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = cluster.ExecuteHedged(pg::ClusterHostType::kSlave, {},
+                                               settings, "select $1", 1));
+  EXPECT_EQ(1, res.AsSingleRow<int>());
+  UEXPECT_NO_THROW(
+      res = cluster.ExecuteHedged(pg::ClusterHostType::kSyncSlave, kTestCmdCtl,
+                                  settings, "select $1",
+                                  pg::ParameterStore{}.PushBack(2)));
+  EXPECT_EQ(2, res.AsSingleRow<int>());
+}
+
 UTEST_F(PostgreCluster, HostSelectionSingleQuery) {
   testsuite::TestsuiteTasks testsuite_tasks{true};
   auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
@@ -399,4 +460,36 @@ UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStoreMove) {
   }
 }
 
+UTEST_F(PostgreCluster, ResultCache) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateClusterPtr(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                                  testsuite_tasks);
+
+  /// [ResultCache]
+  pg::ResultCache cache{cluster, {1, 16, std::chrono::minutes{1}}};
+  const pg::Query kSelectRandom{"SELECT random(), $1::text",
+                                pg::Query::Name{"select_random"}};
+  auto res = cache.Execute(pg::ClusterHostType::kMaster, kSelectRandom,
+                           std::string{"key"});
+  /// [ResultCache]
+  const auto value = res.Front()[0].As<double>();
+
+  res = cache.Execute(pg::ClusterHostType::kMaster, kSelectRandom,
+                      std::string{"key"});
+  EXPECT_EQ(value, res.Front()[0].As<double>());
+  EXPECT_EQ(1, cache.GetStatistics().total.hits.load());
+  EXPECT_EQ(1, cache.GetStatistics().total.misses.load());
+
+  // another value of the argument is another key
+  res = cache.Execute(pg::ClusterHostType::kMaster, kSelectRandom,
+                      std::string{"other"});
+  EXPECT_EQ("other", res.Front()[1].As<std::string>());
+  EXPECT_EQ(2, cache.GetStatistics().total.misses.load());
+
+  cache.Invalidate();
+  cache.Execute(pg::ClusterHostType::kMaster, kSelectRandom,
+                std::string{"key"});
+  EXPECT_EQ(3, cache.GetStatistics().total.misses.load());
+}
+
 USERVER_NAMESPACE_END
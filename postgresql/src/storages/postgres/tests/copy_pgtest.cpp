@@ -0,0 +1,150 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr std::size_t kRowsCount = 10'000;
+
+/// [CopyRowsFrom]
+struct Item final {
+  pg::Bigint id{};
+  std::string name;
+  std::optional<double> score;
+  std::vector<std::string> tags;
+};
+
+std::size_t ImportItems(pg::Transaction& trx, const std::vector<Item>& items) {
+  return trx.CopyRowsFrom(
+      "COPY copy_test(id, name, score, tags) FROM STDIN (FORMAT binary)",
+      items);
+}
+/// [CopyRowsFrom]
+
+std::vector<Item> MakeItems(std::size_t count) {
+  std::vector<Item> items;
+  items.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    items.push_back({static_cast<pg::Bigint>(i), "item " + std::to_string(i),
+                     i % 3 ? std::optional<double>{i * 0.5} : std::nullopt,
+                     {"tag", std::to_string(i % 7)}});
+  }
+  return items;
+}
+
+bool Equal(const Item& lhs, const Item& rhs) {
+  return lhs.id == rhs.id && lhs.name == rhs.name && lhs.score == rhs.score &&
+         lhs.tags == rhs.tags;
+}
+
+void CreateTable(pg::detail::ConnectionPtr& conn) {
+  conn->Execute(
+      "create temporary table copy_test("
+      "id bigint, name text, score double precision, tags text[])");
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyRowsFromAndTo) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+
+  const auto items = MakeItems(kRowsCount);
+
+  pg::Transaction trx{std::move(GetConn())};
+  EXPECT_EQ(ImportItems(trx, items), kRowsCount);
+
+  /// [CopyTo]
+  auto reader = trx.CopyTo(
+      "COPY (SELECT id, name, score, tags FROM copy_test ORDER BY id) "
+      "TO STDOUT (FORMAT binary)");
+  std::vector<Item> copied;
+  Item item;
+  while (reader.ReadRow(item)) {
+    copied.push_back(std::move(item));
+  }
+  /// [CopyTo]
+  EXPECT_TRUE(reader.Done());
+  EXPECT_EQ(reader.RowsReadSoFar(), kRowsCount);
+
+  ASSERT_EQ(copied.size(), items.size());
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    ASSERT_TRUE(Equal(copied[i], items[i])) << "row " << i;
+  }
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyFromColumns) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+
+  /// [CopyFrom]
+  auto writer =
+      trx.CopyFrom("COPY copy_test(id, name) FROM STDIN (FORMAT binary)");
+  for (pg::Bigint id = 0; id < 100; ++id) {
+    writer.Write(id, std::to_string(id));
+  }
+  const auto copied = writer.Finish();
+  /// [CopyFrom]
+  EXPECT_EQ(copied, 100);
+  UEXPECT_THROW(writer.Finish(), pg::LogicError);
+
+  auto res = trx.Execute("SELECT count(*), sum(id)::bigint FROM copy_test");
+  EXPECT_EQ(res[0][0].As<pg::Bigint>(), 100);
+  EXPECT_EQ(res[0][1].As<pg::Bigint>(), 4950);
+
+  // empty result
+  auto reader =
+      trx.CopyTo("COPY (SELECT id FROM copy_test WHERE id < 0) TO STDOUT "
+                 "(FORMAT binary)");
+  pg::Bigint id{};
+  EXPECT_FALSE(reader.Read(id));
+  EXPECT_TRUE(reader.Done());
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyAbort) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+
+  {
+    auto writer = pg::CopyWriter{
+        GetConn().get(), "COPY copy_test(id) FROM STDIN (FORMAT binary)"};
+    writer.Write(pg::Bigint{1});
+    // destroyed without Finish()
+  }
+  const auto res = GetConn()->Execute("SELECT count(*) FROM copy_test");
+  EXPECT_EQ(res.Front().As<pg::Bigint>(), 0);
+
+  UEXPECT_THROW(pg::CopyWriter(GetConn().get(), "SELECT 1"), pg::LogicError);
+  UEXPECT_THROW(pg::CopyReader(GetConn().get(),
+                               "COPY copy_test FROM STDIN (FORMAT binary)"),
+                pg::LogicError);
+  EXPECT_TRUE(GetConn()->IsBroken());
+}
+
+UTEST_P(PostgreConnection, CopyFromWrongTypes) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+
+  auto writer = pg::CopyWriter{
+      GetConn().get(), "COPY copy_test(id) FROM STDIN (FORMAT binary)"};
+  // int4 instead of int8
+  writer.Write(pg::Integer{1});
+  UEXPECT_THROW(writer.Finish(), pg::Error);
+}
+
+USERVER_NAMESPACE_END
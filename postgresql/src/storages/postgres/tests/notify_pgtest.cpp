@@ -0,0 +1,55 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/notify.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr std::chrono::milliseconds kShortTimeout{50};
+
+}  // namespace
+
+UTEST_P(PostgreConnection, NotifyReceive) {
+  CheckConnection(GetConn());
+  auto sender = MakeConnection(GetDsnFromEnv(), GetTaskProcessor(), GetParam());
+  CheckConnection(sender);
+
+  /// [Listen]
+  pg::NotifyScope scope{std::move(GetConn()), "test channel",
+                        pg::OptionalCommandControl{}};
+  sender->Execute("SELECT pg_notify('test channel', 'payload')");
+  sender->Execute("NOTIFY \"test channel\"");
+
+  auto notification = scope.WaitNotify(MakeDeadline());
+  EXPECT_EQ(notification.channel, "test channel");
+  EXPECT_EQ(notification.payload, "payload");
+  /// [Listen]
+
+  notification = scope.WaitNotify(MakeDeadline());
+  EXPECT_EQ(notification.channel, "test channel");
+  EXPECT_FALSE(notification.payload);
+}
+
+UTEST_P(PostgreConnection, NotifyTimeout) {
+  CheckConnection(GetConn());
+  auto sender = MakeConnection(GetDsnFromEnv(), GetTaskProcessor(), GetParam());
+  CheckConnection(sender);
+
+  pg::NotifyScope scope{std::move(GetConn()), "test_channel",
+                        pg::OptionalCommandControl{}};
+  sender->Execute("NOTIFY other_channel");
+  UEXPECT_THROW(
+      scope.WaitNotify(engine::Deadline::FromDuration(kShortTimeout)),
+      pg::ConnectionTimeoutError);
+
+  // the scope is usable after the timeout
+  sender->Execute("NOTIFY test_channel, 'after timeout'");
+  const auto notification = scope.WaitNotify(MakeDeadline());
+  EXPECT_EQ(notification.payload, "after timeout");
+}
+
+USERVER_NAMESPACE_END
@@ -234,6 +234,69 @@ UTEST_P(PostgrePool, MinPool) {
   EXPECT_EQ(0, stats.connection.error_total);
 }
 
+UTEST_P(PostgrePool, SparePool) {
+  pg::PoolSettings settings{1, 5, 10};
+  settings.spare_size = 2;
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), settings,
+      kCachePreparedStatements, {}, GetTestCmdCtls(),
+      testsuite::PostgresControl{}, error_injection::Settings{}, {},
+      dynamic_config::GetDefaultSource());
+  const auto& stats = pool->GetStatistics();
+  if (GetParam() == pg::InitMode::kSync) {
+    EXPECT_EQ(2, stats.connection.open_total);
+  }
+
+  // spare connections are opened on top of the used ones
+  auto conn = pool->Acquire(MakeDeadline());
+  while (pool->GetStatistics().connection.open_total < 3) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  auto conn2 = pool->Acquire(MakeDeadline());
+  while (pool->GetStatistics().connection.open_total < 4) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  CheckConnection(std::move(conn));
+  CheckConnection(std::move(conn2));
+
+  const auto& final_stats = pool->GetStatistics();
+  if (GetParam() == pg::InitMode::kSync) {
+    EXPECT_EQ(4, final_stats.connection.open_total);
+  }
+  EXPECT_EQ(0, final_stats.connection.error_total);
+}
+
+UTEST_P(PostgrePool, WarmupPreparedStatements) {
+  auto conn_settings = kCachePreparedStatements;
+  conn_settings.warmup_prepared_statements = 10;
+  // the statements are only known after the first connection is used
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", pg::InitMode::kSync,
+      {1, 2, 10}, conn_settings, {}, GetTestCmdCtls(),
+      testsuite::PostgresControl{}, error_injection::Settings{}, {},
+      dynamic_config::GetDefaultSource());
+
+  {
+    auto conn = pool->Acquire(MakeDeadline());
+    conn->Execute("select $1::integer", 1);
+    conn->Execute("select $1::text", std::string{"text"});
+  }
+  {
+    // a new connection is opened as the first one is in use
+    auto conn = pool->Acquire(MakeDeadline());
+    auto conn2 = pool->Acquire(MakeDeadline());
+
+    const auto& stats = pool->GetStatistics();
+    EXPECT_EQ(2, stats.connection.open_total);
+    EXPECT_EQ(2, stats.transaction.prepared_warmup_total);
+
+    conn->Execute("select $1::integer", 2);
+    conn2->Execute("select $1::integer", 2);
+  }
+  EXPECT_EQ(2, pool->GetStatistics().transaction.parse_total);
+  EXPECT_EQ(2, pool->GetStatistics().transaction.prepared_hit_total);
+}
+
 UTEST_P(PostgrePool, ConnectionCleanup) {
   auto pool = pg::detail::ConnectionPool::Create(
       GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 1, 10},
@@ -129,6 +129,51 @@ UTEST_F(PostgrePoolStats, RunSingleTransaction) {
   EXPECT_NE(stats.find(statement_name), stats.end());
 }
 
+UTEST_F(PostgrePoolStats, StatementStatistics) {
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kAsync, {1, 10, 10},
+      kCachePreparedStatements, {10}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+
+  const std::string statement_name = "statement_name";
+  const auto query = pg::Query{"select generate_series(1, $1)",
+                               pg::Query::Name{statement_name}};
+  const std::string error_name = "error_name";
+  const auto error_query =
+      pg::Query{"select 1 / $1", pg::Query::Name{error_name}};
+
+  {
+    auto trx = pool->Begin(pg::TransactionOptions{});
+    UEXPECT_NO_THROW(trx.Execute(query, 2));
+    UEXPECT_NO_THROW(trx.Execute(query, 3));
+    trx.Commit();
+  }
+  {
+    auto trx = pool->Begin(pg::TransactionOptions{});
+    UEXPECT_THROW(trx.Execute(error_query, 0), pg::DataException);
+  }
+
+  pool->GetStatementTimingsStorage().WaitForExhaustion();
+  const auto stats =
+      pool->GetStatementTimingsStorage().GetStatementsStatistics();
+
+  const auto it = stats.find(statement_name);
+  ASSERT_NE(it, stats.end());
+  EXPECT_EQ(it->second.executed, 2);
+  EXPECT_EQ(it->second.errors, 0);
+  EXPECT_EQ(it->second.parsed, 1);
+  EXPECT_EQ(it->second.rows, 5);
+  EXPECT_GT(it->second.result_bytes, 0);
+  EXPECT_EQ(it->second.timings.Count(), 2);
+
+  const auto error_it = stats.find(error_name);
+  ASSERT_NE(error_it, stats.end());
+  EXPECT_EQ(error_it->second.executed, 0);
+  EXPECT_EQ(error_it->second.errors, 1);
+  EXPECT_EQ(error_it->second.timings.Count(), 0);
+}
+
 UTEST_F(PostgrePoolStats, RunTransactions) {
   auto pool = pg::detail::ConnectionPool::Create(
       GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
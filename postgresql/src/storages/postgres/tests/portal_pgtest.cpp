@@ -289,6 +289,48 @@ UTEST_P(PostgreConnection, PortalParallel) {
   EXPECT_EQ(second.FetchedSoFar(), kIterations);
 }
 
+UTEST_P(PostgreConnection, PortalFetchAllInto) {
+  constexpr int kRows = 1000;
+  constexpr std::uint32_t kChunkRows = 300;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+
+  /// [FetchAllInto]
+  std::vector<std::tuple<int, std::string>> rows;
+  trx.MakePortal("SELECT i, i::text FROM generate_series(1, $1) i", kRows)
+      .FetchAllInto(rows, kChunkRows, pg::kRowTag);
+  /// [FetchAllInto]
+  ASSERT_EQ(rows.size(), kRows);
+  for (int i = 0; i < kRows; ++i) {
+    EXPECT_EQ(std::get<0>(rows[i]), i + 1);
+    EXPECT_EQ(std::get<1>(rows[i]), std::to_string(i + 1));
+  }
+
+  std::vector<int> values;
+  auto portal = trx.MakePortal("SELECT generate_series(1, $1)", kRows);
+  portal.FetchAllInto(values, kChunkRows);
+  EXPECT_EQ(values.size(), kRows);
+  EXPECT_EQ(values.back(), kRows);
+  EXPECT_EQ(portal.FetchedSoFar(), kRows);
+  EXPECT_TRUE(portal.Done());
+
+  // the rows count is a multiple of the chunk size
+  std::size_t chunks = 0;
+  auto chunked = trx.MakePortal("SELECT generate_series(1, $1)", kRows);
+  EXPECT_EQ(chunked.ForEachChunk(100,
+                                 [&chunks](const pg::ResultSet& chunk) {
+                                   EXPECT_EQ(chunk.Size(), 100);
+                                   ++chunks;
+                                 }),
+            kRows);
+  EXPECT_EQ(chunks, 10);
+  EXPECT_TRUE(chunked.Done());
+
+  trx.Commit();
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+UTEST_P(PostgreConnection, QueryQueueCollect) {
+  CheckConnection(GetConn());
+  pg::QueryQueue queue{std::move(GetConn()), pg::OptionalCommandControl{}};
+
+  /// [QueryQueue]
+  queue.Push("SELECT $1::integer", 1);
+  queue.Push("SELECT $1::text, $2::bigint", std::string{"two"},
+             std::int64_t{2});
+  queue.Push("SELECT generate_series(1, $1)", 3);
+  auto results = queue.Collect();
+  /// [QueryQueue]
+  EXPECT_EQ(queue.Size(), 0);
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0].AsSingleRow<int>(), 1);
+  const auto [text, number] =
+      results[1].AsSingleRow<std::tuple<std::string, std::int64_t>>();
+  EXPECT_EQ(text, "two");
+  EXPECT_EQ(number, 2);
+  EXPECT_EQ(results[2].Size(), 3);
+
+  // the queue is reusable, prepared statements are taken from the cache
+  queue.Push("SELECT $1::integer", 42);
+  queue.Push("SELECT 'no params'");
+  results = queue.Collect();
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0].AsSingleRow<int>(), 42);
+  EXPECT_EQ(results[1].AsSingleRow<std::string>(), "no params");
+
+  EXPECT_TRUE(queue.Collect().empty());
+}
+
+UTEST_P(PostgreConnection, QueryQueueError) {
+  CheckConnection(GetConn());
+  pg::QueryQueue queue{std::move(GetConn()), pg::OptionalCommandControl{}};
+
+  queue.Push("SELECT 1");
+  queue.Push("SELECT 1 / $1", 0);
+  queue.Push("SELECT 3");
+  UEXPECT_THROW(queue.Collect(), pg::DataException);
+
+  // the connection is usable after the error
+  queue.Push("SELECT 4");
+  const auto results = queue.Collect();
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0].AsSingleRow<int>(), 4);
+}
+
+USERVER_NAMESPACE_END
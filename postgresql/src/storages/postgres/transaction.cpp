@@ -70,7 +70,7 @@ ResultSet Transaction::DoExecute(const Query& query,
 
   detail::StatementTimer timer{query, conn_};
   auto res = conn_->Execute(query, params, std::move(statement_cmd_ctl));
-  timer.Account();
+  timer.Account(res);
   return res;
 }
 
@@ -95,6 +95,26 @@ Portal Transaction::MakePortal(const PortalName& portal_name,
                 std::move(statement_cmd_ctl)};
 }
 
+CopyWriter Transaction::CopyFrom(OptionalCommandControl statement_cmd_ctl,
+                                 const Query& query) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyFrom called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return CopyWriter{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+CopyReader Transaction::CopyTo(OptionalCommandControl statement_cmd_ctl,
+                               const Query& query) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyTo called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return CopyReader{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
 void Transaction::SetParameter(const std::string& param_name,
                                const std::string& value) {
   if (!conn_) {
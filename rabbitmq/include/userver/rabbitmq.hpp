@@ -5,6 +5,7 @@
 /// that are required for working with RabbitMQ userver component.
 
 #include <userver/urabbitmq/admin_channel.hpp>
+#include <userver/urabbitmq/batch_consumer_base.hpp>
 #include <userver/urabbitmq/broker_interface.hpp>
 #include <userver/urabbitmq/channel.hpp>
 #include <userver/urabbitmq/client.hpp>
@@ -39,8 +40,8 @@
 /// - For configuration see components::RabbitMQ
 /// - For cluster operations see urabbitmq::Client, urabbitmq::AdminChannel,
 ///   urabbitmq::Channel, urabbitmq::ReliableChannel
-/// - For consumers support see urabbitmq::ConsumerBase and
-///   urabbitmq::ConsumerComponentBase
+/// - For consumers support see urabbitmq::ConsumerBase,
+///   urabbitmq::BatchConsumerBase and urabbitmq::ConsumerComponentBase
 ///
 /// ----------
 ///
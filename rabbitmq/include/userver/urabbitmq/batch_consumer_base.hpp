@@ -0,0 +1,82 @@
+#pragma once
+
+/// @file userver/urabbitmq/batch_consumer_base.hpp
+/// @brief Base class for your batch consumers.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/utils/periodic_task.hpp>
+
+#include <userver/urabbitmq/consumer_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+class Client;
+class ConsumerBaseImpl;
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base class for your batch consumers.
+/// You should derive from it and override `ProcessBatch` method, which gets
+/// called with up to `max_batch_size` messages at once.
+///
+/// Unlike `ConsumerBase`, which dispatches a task and acknowledges every
+/// message separately, batches are processed one after another by a single
+/// task and are acknowledged with a single `multiple` ack. This suits
+/// consumers that write into batch-oriented storages.
+///
+/// Library takes care of handling start failures and runtime failures
+/// (connection breakage/broker node downtime etc.) and will try it's best to
+/// restart the consumer.
+///
+/// @note Since messages are delivered asynchronously in the background you
+/// must call `Stop` before derived class is destroyed, otherwise a race is
+/// possible, when `ProcessBatch` is called concurrently with
+/// derived class destructor, which is UB.
+///
+/// @note Library guarantees `at least once` delivery, hence some deduplication
+/// might be needed ou your side.
+class BatchConsumerBase {
+ public:
+  BatchConsumerBase(std::shared_ptr<Client> client,
+                    const BatchConsumerSettings& settings);
+  virtual ~BatchConsumerBase();
+
+  /// @brief Start consuming messages from the broker.
+  /// Calling this method on running consumer has no effect.
+  ///
+  /// Should not throw, in case of initial setup failure library will restart
+  /// the consumer in the background.
+  void Start();
+
+  /// @brief Stop consuming messages from the broker.
+  /// Calling this method on stopped consumer has no effect.
+  ///
+  /// @note You must call this method before your derived class is destroyed,
+  /// otherwise it's UB.
+  void Stop();
+
+ protected:
+  /// @brief Override this method in derived class and implement
+  /// batch handling logic.
+  ///
+  /// If this method returns successfully all the messages of the batch would
+  /// be acked (best effort) to the broker, if this method throws all of them
+  /// would be requeued.
+  virtual void ProcessBatch(std::vector<std::string> messages) = 0;
+
+ private:
+  std::shared_ptr<Client> client_;
+  const BatchConsumerSettings settings_;
+
+  std::unique_ptr<ConsumerBaseImpl> impl_;
+  utils::PeriodicTask monitor_{};
+};
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
@@ -15,6 +15,10 @@ namespace urabbitmq {
 
 class ConnectionPtr;
 
+namespace impl {
+class ResponseAwaiter;
+}
+
 /// @brief Publisher interface for the broker.
 /// You may use this class to publish your messages.
 ///
@@ -45,6 +49,25 @@ class Channel final : IChannelInterface {
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
 
+/// @brief Pending broker confirmation of a message published with
+/// `ReliableChannel::PublishPipelined`.
+///
+/// Should be waited for and must not outlive the channel it came from.
+class PublishConfirmation final {
+ public:
+  PublishConfirmation(impl::ResponseAwaiter&& awaiter);
+  ~PublishConfirmation();
+
+  PublishConfirmation(PublishConfirmation&& other) noexcept;
+
+  /// @brief Wait for the broker to confirm the message.
+  /// Throws if the message was rejected or the deadline was reached.
+  void Wait(engine::Deadline deadline);
+
+ private:
+  utils::FastPimpl<impl::ResponseAwaiter, 64, 8> impl_;
+};
+
 /// @brief Reliable publisher interface for the broker.
 /// You may use this class to reliably publish your messages
 /// (publisher-confirms).
@@ -74,6 +97,19 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @brief Publish a message to an exchange without waiting for
+  /// the broker confirmation.
+  ///
+  /// Up to `max_unconfirmed_publishes` messages may await confirmation at
+  /// once, publishing waits for the older ones to be confirmed when there
+  /// are more. The broker confirms many messages with a single ack, so this
+  /// is a lot faster than calling `PublishReliable` in a loop.
+  ///
+  /// @snippet tests/publish_consume_rmqtest.cpp  Sample pipelined publish
+  [[nodiscard]] PublishConfirmation PublishPipelined(
+      const Exchange& exchange, const std::string& routing_key,
+      const std::string& message, MessageType type, engine::Deadline deadline);
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
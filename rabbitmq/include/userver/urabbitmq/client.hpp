@@ -18,6 +18,7 @@ USERVER_NAMESPACE_BEGIN
 namespace urabbitmq {
 
 class ConsumerBase;
+class BatchConsumerBase;
 class ClientImpl;
 
 /// @ingroup userver_clients
@@ -112,6 +113,7 @@ class Client : public std::enable_shared_from_this<Client>,
 
  private:
   friend class ConsumerBase;
+  friend class BatchConsumerBase;
   utils::FastPimpl<ClientImpl, 232, 8> impl_;
 };
 
@@ -3,6 +3,7 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
+#include <chrono>
 #include <cstddef>
 
 #include <userver/urabbitmq/typedefs.hpp>
@@ -26,6 +27,21 @@ struct ConsumerSettings final {
   std::uint16_t prefetch_count;
 };
 
+/// @brief Batch consumer settings struct
+struct BatchConsumerSettings final {
+  /// A queue to consume from
+  Queue queue;
+
+  /// Limit for messages in a batch.
+  /// The consumer requests twice as many unacked messages from the broker,
+  /// so that the next batch is being accumulated while the current one is
+  /// processed
+  std::uint16_t max_batch_size;
+
+  /// A batch is dispatched once it waited this long, even if it isn't full
+  std::chrono::milliseconds max_batch_delay{100};
+};
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
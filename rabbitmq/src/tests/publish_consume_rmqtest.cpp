@@ -75,6 +75,39 @@ class ThrowingConsumer final : public urabbitmq::ConsumerBase {
   engine::ConditionVariable cond_;
 };
 
+class BatchConsumer final : public urabbitmq::BatchConsumerBase {
+ public:
+  using urabbitmq::BatchConsumerBase::BatchConsumerBase;
+  ~BatchConsumer() override { Stop(); }
+
+  void ProcessBatch(std::vector<std::string> messages) override {
+    const auto batch_size = messages.size();
+    {
+      auto locked = batch_sizes_.Lock();
+      locked->push_back(batch_size);
+    }
+
+    if ((consumed_ += batch_size) >= expected_consumed_) {
+      event_.Send();
+    }
+  }
+
+  void ExpectConsume(size_t count) { expected_consumed_ = count; }
+
+  std::vector<size_t> Wait() {
+    [[maybe_unused]] auto res = event_.WaitForEventFor(utest::kMaxTestWaitTime);
+
+    auto locked = batch_sizes_.Lock();
+    return *locked;
+  }
+
+ private:
+  concurrent::Variable<std::vector<size_t>> batch_sizes_;
+  std::atomic<size_t> expected_consumed_{0};
+  std::atomic<size_t> consumed_{0};
+  engine::SingleConsumerEvent event_;
+};
+
 }  // namespace
 
 UTEST(Consumer, CreateOnInvalidQueueWorks) {
@@ -133,6 +166,62 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, PipelinedPublishWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  const size_t messages_count = 1000;
+  {
+    /// [Sample pipelined publish]
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+
+    std::vector<urabbitmq::PublishConfirmation> confirmations;
+    confirmations.reserve(messages_count);
+    for (size_t i = 0; i < messages_count; ++i) {
+      confirmations.push_back(channel.PublishPipelined(
+          client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+          urabbitmq::MessageType::kTransient, client.GetDeadline()));
+    }
+    for (auto& confirmation : confirmations) {
+      confirmation.Wait(client.GetDeadline());
+    }
+    /// [Sample pipelined publish]
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  EXPECT_EQ(consumer.Wait().size(), messages_count);
+}
+
+UTEST(Consumer, BatchesWork) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+
+  const size_t messages_count = 250;
+  for (size_t i = 0; i < messages_count; ++i) {
+    client->PublishReliable(
+        client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+        urabbitmq::MessageType::kTransient, client.GetDeadline());
+  }
+
+  urabbitmq::BatchConsumerSettings settings{client.GetQueue(), 100};
+  settings.max_batch_delay = std::chrono::milliseconds{50};
+  BatchConsumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  const auto batch_sizes = consumer.Wait();
+  size_t consumed = 0;
+  for (const auto batch_size : batch_sizes) {
+    EXPECT_LE(batch_size, 100);
+    consumed += batch_size;
+  }
+  EXPECT_EQ(consumed, messages_count);
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
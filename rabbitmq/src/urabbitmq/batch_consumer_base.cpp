@@ -0,0 +1,89 @@
+#include <userver/urabbitmq/batch_consumer_base.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/urabbitmq/client.hpp>
+
+#include <urabbitmq/client_impl.hpp>
+#include <urabbitmq/consumer_base_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+namespace {
+
+constexpr std::chrono::milliseconds kConnectionAcquisitionTimeout{1000};
+constexpr std::chrono::seconds kMonitorInterval{1};
+
+template <typename OnBatch>
+std::unique_ptr<ConsumerBaseImpl> CreateAndStartConsumerImpl(
+    ClientImpl& client_impl, const BatchConsumerSettings& settings,
+    OnBatch&& on_batch) {
+  auto impl = std::make_unique<ConsumerBaseImpl>(
+      client_impl.GetConnection(
+          engine::Deadline::FromDuration(kConnectionAcquisitionTimeout)),
+      settings);
+  impl->StartBatched(std::forward<OnBatch>(on_batch));
+
+  return impl;
+}
+
+}  // namespace
+
+BatchConsumerBase::BatchConsumerBase(std::shared_ptr<Client> client,
+                                     const BatchConsumerSettings& settings)
+    : client_{std::move(client)}, settings_{settings}, impl_{nullptr} {
+  UASSERT(client_);
+  UINVARIANT(settings_.max_batch_size > 0, "max_batch_size is set to zero");
+}
+
+BatchConsumerBase::~BatchConsumerBase() {
+  UASSERT_MSG(impl_ == nullptr,
+              "You should call `Stop` before derived class is destroyed");
+  Stop();
+}
+
+void BatchConsumerBase::Start() {
+  if (monitor_.IsRunning()) {
+    return;
+  }
+
+  const auto on_batch = [this](std::vector<std::string> messages) {
+    ProcessBatch(std::move(messages));
+  };
+
+  try {
+    impl_ = CreateAndStartConsumerImpl(*client_->impl_, settings_, on_batch);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to start a batch consumer: '" << ex.what()
+                  << "'; will try to start again";
+  }
+
+  monitor_.Start(
+      fmt::format("{}_batch_consumer_monitor", settings_.queue.GetUnderlying()),
+      {kMonitorInterval}, [this, on_batch] {
+        if (impl_ == nullptr || impl_->IsBroken()) {
+          LOG_WARNING() << "Batch consumer for queue '"
+                        << settings_.queue.GetUnderlying()
+                        << "' is broken, trying to restart";
+          try {
+            impl_.reset();
+            impl_ = CreateAndStartConsumerImpl(*client_->impl_, settings_,
+                                               on_batch);
+            LOG_INFO() << "Restarted successfully";
+          } catch (const std::exception& ex) {
+            LOG_WARNING() << "Failed to restart a batch consumer: '"
+                          << ex.what() << "'; will try to restart again";
+          }
+        }
+      });
+}
+
+void BatchConsumerBase::Stop() {
+  monitor_.Stop();
+  impl_.reset();
+}
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <urabbitmq/connection_helper.hpp>
 #include <urabbitmq/connection_ptr.hpp>
+#include <urabbitmq/impl/response_awaiter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +21,18 @@ void Channel::Publish(const Exchange& exchange, const std::string& routing_key,
                             deadline);
 }
 
+PublishConfirmation::PublishConfirmation(impl::ResponseAwaiter&& awaiter)
+    : impl_{std::move(awaiter)} {}
+
+PublishConfirmation::~PublishConfirmation() = default;
+
+PublishConfirmation::PublishConfirmation(PublishConfirmation&& other) noexcept =
+    default;
+
+void PublishConfirmation::Wait(engine::Deadline deadline) {
+  impl_->Wait(deadline);
+}
+
 ReliableChannel::ReliableChannel(ConnectionPtr&& channel)
     : impl_{std::move(channel)} {}
 
@@ -37,6 +50,13 @@ void ReliableChannel::PublishReliable(const Exchange& exchange,
       .Wait(deadline);
 }
 
+PublishConfirmation ReliableChannel::PublishPipelined(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::string& message, MessageType type, engine::Deadline deadline) {
+  return ConnectionHelper::PublishPipelined(*impl_, exchange, routing_key,
+                                            message, type, deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -71,6 +71,17 @@ impl::ResponseAwaiter ConnectionHelper::PublishReliable(
   });
 }
 
+impl::ResponseAwaiter ConnectionHelper::PublishPipelined(
+    const ConnectionPtr& connection, const Exchange& exchange,
+    const std::string& routing_key, const std::string& message,
+    MessageType type, engine::Deadline deadline) {
+  // Many confirmations are awaited at once and in any order, so the span
+  // only covers sending the message and is not attached to the awaiter
+  tracing::Span span{"pipelined_publish"};
+  return connection->GetReliableChannel().PublishPipelined(
+      exchange, routing_key, message, type, deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -52,6 +52,11 @@ class ConnectionHelper final {
       const std::string& routing_key, const std::string& message,
       MessageType type, engine::Deadline deadline);
 
+  [[nodiscard]] static impl::ResponseAwaiter PublishPipelined(
+      const ConnectionPtr& connection, const Exchange& exchange,
+      const std::string& routing_key, const std::string& message,
+      MessageType type, engine::Deadline deadline);
+
  private:
   template <typename Func>
   static impl::ResponseAwaiter WithSpan(const char* name, Func&& fn) {
@@ -1,10 +1,13 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 
 #include <fmt/format.h>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
@@ -22,6 +25,12 @@ namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
 
+// The next batch is accumulated while the current one is being processed
+uint16_t GetBatchPrefetchCount(uint16_t max_batch_size) {
+  return static_cast<uint16_t>(std::min<size_t>(
+      size_t{max_batch_size} * 2, std::numeric_limits<uint16_t>::max()));
+}
+
 }  // namespace
 
 ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
@@ -36,14 +45,50 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
   connection_ptr_.Adopt();
 }
 
+ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
+                                   const BatchConsumerSettings& settings)
+    : dispatcher_{engine::current_task::GetTaskProcessor()},
+      queue_name_{settings.queue.GetUnderlying()},
+      prefetch_count_{GetBatchPrefetchCount(settings.max_batch_size)},
+      connection_ptr_{std::move(connection)},
+      channel_{connection_ptr_->GetChannel()},
+      max_batch_size_{settings.max_batch_size},
+      max_batch_delay_{settings.max_batch_delay} {
+  UASSERT(max_batch_size_ > 0);
+  connection_ptr_.Adopt();
+}
+
 ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
 
 void ConsumerBaseImpl::Start(DispatchCallback cb) {
+  dispatch_callback_ = std::move(cb);
+
+  DoStart([this](const AMQP::Message& message, uint64_t delivery_tag) {
+    OnMessage(message, delivery_tag);
+  });
+}
+
+void ConsumerBaseImpl::StartBatched(BatchDispatchCallback cb) {
+  UASSERT(max_batch_size_ > 0);
+  batch_dispatch_callback_ = std::move(cb);
+
+  // Batches are processed strictly one after another, otherwise acking
+  // the last message of a batch with `multiple` could ack the messages of
+  // a batch still in progress
+  bts_->Detach(engine::AsyncNoSpan(dispatcher_, [this] {
+    RunBatchDispatcher();
+  }));
+
+  DoStart([this](const AMQP::Message& message, uint64_t delivery_tag) {
+    OnBatchMessage(message, delivery_tag);
+  });
+}
+
+void ConsumerBaseImpl::DoStart(
+    std::function<void(const AMQP::Message&, uint64_t)> message_cb) {
   const auto start_deadline = engine::Deadline::FromDuration(kStartTimeout);
   channel_.SetQos(prefetch_count_, start_deadline);
 
-  dispatch_callback_ = std::move(cb);
-
   LOG_INFO() << "Starting a consumer for '" << queue_name_ << "' queue";
 
   channel_.SetupConsumer(
@@ -57,11 +102,12 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
         }
       },
       // message callback
-      [this](const AMQP::Message& message, uint64_t delivery_tag, bool) {
+      [this, message_cb = std::move(message_cb)](const AMQP::Message& message,
+                                                 uint64_t delivery_tag, bool) {
         // We received a message but won't ack it, so it will be requeued
         // at some point
         if (!stopped_) {
-          OnMessage(message, delivery_tag);
+          message_cb(message, delivery_tag);
         }
       },
       start_deadline);
@@ -129,6 +175,84 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::OnBatchMessage(const AMQP::Message& message,
+                                      uint64_t delivery_tag) {
+  auto pending = pending_.Lock();
+  pending->push_back(
+      {std::string{message.body(), message.bodySize()}, delivery_tag});
+  if (pending->size() >= max_batch_size_) {
+    batch_ready_.Send();
+  }
+}
+
+void ConsumerBaseImpl::RunBatchDispatcher() {
+  while (!engine::current_task::ShouldCancel()) {
+    // Either the batch is full or it waited long enough
+    [[maybe_unused]] const auto is_full =
+        batch_ready_.WaitForEventFor(max_batch_delay_);
+
+    auto batch = TakeBatch();
+    if (!batch.empty()) {
+      DispatchBatch(std::move(batch));
+    }
+  }
+}
+
+std::vector<ConsumerBaseImpl::PendingMessage> ConsumerBaseImpl::TakeBatch() {
+  auto pending = pending_.Lock();
+  if (pending->size() <= max_batch_size_) {
+    return std::exchange(*pending, {});
+  }
+
+  std::vector<PendingMessage> batch{
+      std::make_move_iterator(pending->begin()),
+      std::make_move_iterator(pending->begin() + max_batch_size_)};
+  pending->erase(pending->begin(), pending->begin() + max_batch_size_);
+  if (pending->size() >= max_batch_size_) {
+    batch_ready_.Send();
+  }
+
+  return batch;
+}
+
+void ConsumerBaseImpl::DispatchBatch(std::vector<PendingMessage>&& batch) {
+  UASSERT(!batch.empty());
+  tracing::Span span{fmt::format("consume_batch_{}_{}", queue_name_,
+                                 consumer_tag_.value_or("ctag:unknown"))};
+
+  // Delivery tags grow monotonically within a channel
+  const auto last_delivery_tag = batch.back().delivery_tag;
+  const auto batch_size = batch.size();
+
+  std::vector<std::string> messages;
+  messages.reserve(batch_size);
+  for (auto& pending : batch) {
+    messages.push_back(std::move(pending.data));
+  }
+
+  bool success = false;
+  try {
+    batch_dispatch_callback_(std::move(messages));
+    success = true;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to process the consumed batch, " << ex.what()
+                << "; would requeue";
+  }
+
+  try {
+    if (success) {
+      channel_.AckMultiple(last_delivery_tag, {});
+      channel_.AccountMessagesConsumed(batch_size);
+    } else {
+      channel_.RejectMultiple(last_delivery_tag, true, {});
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING()
+        << "Failed to " << (success ? "ack" : "requeue")
+        << " the batch, it will be requeued by RabbitMQ at some point";
+  }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
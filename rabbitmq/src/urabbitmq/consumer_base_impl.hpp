@@ -1,8 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <userver/concurrent/background_task_storage_fwd.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
@@ -23,16 +29,34 @@ class ConsumerBaseImpl final {
  public:
   ConsumerBaseImpl(ConnectionPtr&& connection,
                    const ConsumerSettings& settings);
+  ConsumerBaseImpl(ConnectionPtr&& connection,
+                   const BatchConsumerSettings& settings);
   ~ConsumerBaseImpl();
 
   using DispatchCallback = std::function<void(std::string message)>;
+  using BatchDispatchCallback =
+      std::function<void(std::vector<std::string> messages)>;
 
   void Start(DispatchCallback cb);
 
+  void StartBatched(BatchDispatchCallback cb);
+
   bool IsBroken() const;
 
  private:
+  struct PendingMessage final {
+    std::string data;
+    uint64_t delivery_tag;
+  };
+
+  void DoStart(
+      std::function<void(const AMQP::Message&, uint64_t)> message_cb);
+
   void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  void OnBatchMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  void RunBatchDispatcher();
+  std::vector<PendingMessage> TakeBatch();
+  void DispatchBatch(std::vector<PendingMessage>&& batch);
   void Stop();
 
   engine::TaskProcessor& dispatcher_;
@@ -46,6 +70,14 @@ class ConsumerBaseImpl final {
 
   DispatchCallback dispatch_callback_;
 
+  const size_t max_batch_size_{0};
+  const std::chrono::milliseconds max_batch_delay_{};
+  BatchDispatchCallback batch_dispatch_callback_;
+
+  // Filled from the event loop thread, hence the std::mutex
+  concurrent::Variable<std::vector<PendingMessage>, std::mutex> pending_;
+  engine::SingleConsumerEvent batch_ready_;
+
   std::atomic<bool> stopped_{false};
 
   // Underlying channel errored, just restart the consumer
@@ -1,5 +1,6 @@
 #include "amqp_channel.hpp"
 
+#include <memory>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
@@ -70,6 +71,24 @@ AMQP::Table CreateHeaders() {
   return headers;
 }
 
+// Accounts the publish as confirmed once both the ack and the error callbacks
+// are gone, which also covers the channel being destroyed without a response
+class UnconfirmedPublishGuard final {
+ public:
+  explicit UnconfirmedPublishGuard(statistics::ConnectionStatistics& stats)
+      : stats_{stats} {
+    stats_.AccountPublishUnconfirmed();
+  }
+
+  ~UnconfirmedPublishGuard() { stats_.AccountPublishConfirmationReceived(); }
+
+  UnconfirmedPublishGuard(const UnconfirmedPublishGuard&) = delete;
+  UnconfirmedPublishGuard& operator=(const UnconfirmedPublishGuard&) = delete;
+
+ private:
+  statistics::ConnectionStatistics& stats_;
+};
+
 }  // namespace
 
 AmqpChannel::AmqpChannel(AmqpConnection& conn) : conn_{conn} {}
@@ -177,6 +196,20 @@ void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
   channel->reject(delivery_tag, requeue ? AMQP::requeue : 0);
 }
 
+void AmqpChannel::AckMultiple(uint64_t delivery_tag,
+                              engine::Deadline deadline) {
+  // No way to acknowledge success, no way to handle synchronous errors
+  auto channel = conn_.GetChannel(deadline);
+  channel->ack(delivery_tag, AMQP::multiple);
+}
+
+void AmqpChannel::RejectMultiple(uint64_t delivery_tag, bool requeue,
+                                 engine::Deadline deadline) {
+  // No way to acknowledge success, no way to handle synchronous errors
+  auto channel = conn_.GetChannel(deadline);
+  channel->reject(delivery_tag, AMQP::multiple | (requeue ? AMQP::requeue : 0));
+}
+
 void AmqpChannel::SetQos(uint16_t prefetch_count, engine::Deadline deadline) {
   auto deferred = DeferredWrapper::Create();
 
@@ -213,6 +246,10 @@ void AmqpChannel::AccountMessageConsumed() {
   conn_.GetStatistics().AccountMessageConsumed();
 }
 
+void AmqpChannel::AccountMessagesConsumed(size_t count) {
+  conn_.GetStatistics().AccountMessagesConsumed(count);
+}
+
 AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn) : conn_{conn} {}
 
 AmqpReliableChannel::~AmqpReliableChannel() = default;
@@ -222,28 +259,46 @@ ResponseAwaiter AmqpReliableChannel::Publish(const Exchange& exchange,
                                              const std::string& message,
                                              MessageType type,
                                              engine::Deadline deadline) {
-  AMQP::Envelope envelope{message.data(), message.size()};
-  envelope.setPersistent(type == MessageType::kPersistent);
-  envelope.setHeaders(CreateHeaders());
-
   auto awaiter = conn_.GetAwaiter(deadline);
+  DoPublish(awaiter, exchange, routing_key, message, type, deadline);
 
-  {
-    auto reliable = conn_.GetReliableChannel(deadline);
-
-    reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
-        .onAck([this, deferred = awaiter.GetWrapper()] {
-          AccountMessagePublished();
-          deferred->Ok();
-        })
-        .onError([deferred = awaiter.GetWrapper()](const char* error) {
-          deferred->Fail(error);
-        });
-  }
+  return awaiter;
+}
+
+ResponseAwaiter AmqpReliableChannel::PublishPipelined(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::string& message, MessageType type, engine::Deadline deadline) {
+  auto awaiter = conn_.GetPublishAwaiter(deadline);
+  DoPublish(awaiter, exchange, routing_key, message, type, deadline);
 
   return awaiter;
 }
 
+void AmqpReliableChannel::DoPublish(const ResponseAwaiter& awaiter,
+                                    const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const std::string& message,
+                                    MessageType type,
+                                    engine::Deadline deadline) {
+  AMQP::Envelope envelope{message.data(), message.size()};
+  envelope.setPersistent(type == MessageType::kPersistent);
+  envelope.setHeaders(CreateHeaders());
+
+  auto reliable = conn_.GetReliableChannel(deadline);
+  auto guard = std::make_shared<UnconfirmedPublishGuard>(conn_.GetStatistics());
+
+  // AMQP::Reliable resolves all the publishes covered by a `multiple` ack at
+  // once, so a window of unconfirmed publishes costs no extra round trips
+  reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
+      .onAck([this, guard, deferred = awaiter.GetWrapper()] {
+        AccountMessagePublished();
+        deferred->Ok();
+      })
+      .onError([guard, deferred = awaiter.GetWrapper()](const char* error) {
+        deferred->Fail(error);
+      });
+}
+
 void AmqpReliableChannel::AccountMessagePublished() {
   conn_.GetStatistics().AccountMessagePublished();
 }
@@ -58,6 +58,13 @@ class AmqpChannel final {
 
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
+  // Acknowledges all the messages up to and including the delivery_tag
+  void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
+  // Rejects all the messages up to and including the delivery_tag
+  void RejectMultiple(uint64_t delivery_tag, bool requeue,
+                      engine::Deadline deadline);
+
   void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
 
   using ErrorCb = std::function<void(const char*)>;
@@ -71,6 +78,7 @@ class AmqpChannel final {
 
  private:
   void AccountMessageConsumed();
+  void AccountMessagesConsumed(size_t count);
 
   friend class urabbitmq::ConsumerBaseImpl;
 
@@ -87,7 +95,18 @@ class AmqpReliableChannel final {
                           const std::string& message, MessageType type,
                           engine::Deadline deadline);
 
+  // Same as Publish, but limited by the unconfirmed publishes count instead
+  // of the in-flight requests count
+  ResponseAwaiter PublishPipelined(const Exchange& exchange,
+                                   const std::string& routing_key,
+                                   const std::string& message, MessageType type,
+                                   engine::Deadline deadline);
+
  private:
+  void DoPublish(const ResponseAwaiter& awaiter, const Exchange& exchange,
+                 const std::string& routing_key, const std::string& message,
+                 MessageType type, engine::Deadline deadline);
+
   void AccountMessagePublished();
 
   AmqpConnection& conn_;
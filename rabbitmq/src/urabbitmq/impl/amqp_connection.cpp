@@ -39,12 +39,14 @@ ConnectionLock::ConnectionLock(ConnectionLock&& other) noexcept
 
 AmqpConnection::AmqpConnection(AmqpConnectionHandler& handler,
                                size_t max_in_flight_requests,
+                               size_t max_unconfirmed_publishes,
                                engine::Deadline deadline)
     : handler_{handler},
       conn_{CreateConnection(handler_, deadline)},
       channel_{CreateChannel(deadline)},
       reliable_channel_{CreateChannel(deadline)},
-      waiters_sema_{max_in_flight_requests} {
+      waiters_sema_{max_in_flight_requests},
+      publishes_sema_{max_unconfirmed_publishes} {
   handler_.OnConnectionCreated(this, deadline);
 
   try {
@@ -94,6 +96,16 @@ ResponseAwaiter AmqpConnection::GetAwaiter(engine::Deadline deadline) {
   return ResponseAwaiter{std::move(lock)};
 }
 
+ResponseAwaiter AmqpConnection::GetPublishAwaiter(engine::Deadline deadline) {
+  engine::SemaphoreLock lock{publishes_sema_, deadline};
+  if (!lock.OwnsLock()) {
+    throw std::runtime_error{
+        "Failed to await publish confirmations within specified deadline"};
+  }
+
+  return ResponseAwaiter{std::move(lock)};
+}
+
 ConnectionLock AmqpConnection::Lock(engine::Deadline deadline) {
   return {mutex_, deadline};
 }
@@ -50,7 +50,7 @@ class LockedChannelProxy final {
 class AmqpConnection final {
  public:
   AmqpConnection(AmqpConnectionHandler& handler, size_t max_in_flight_requests,
-                 engine::Deadline deadline);
+                 size_t max_unconfirmed_publishes, engine::Deadline deadline);
   ~AmqpConnection();
 
   AMQP::Connection& GetNative();
@@ -67,6 +67,9 @@ class AmqpConnection final {
 
   ResponseAwaiter GetAwaiter(engine::Deadline deadline);
 
+  // Same as GetAwaiter, but limited by the unconfirmed publishes count
+  ResponseAwaiter GetPublishAwaiter(engine::Deadline deadline);
+
  private:
   friend class AmqpConnectionLocker;
   [[nodiscard]] ConnectionLock Lock(engine::Deadline deadline);
@@ -100,6 +103,7 @@ class AmqpConnection final {
   // of ack/nack in parallel.
   engine::Mutex mutex_{};
   engine::Semaphore waiters_sema_;
+  engine::Semaphore publishes_sema_;
 };
 
 class AmqpConnectionLocker final {
@@ -26,6 +26,18 @@ void ConnectionStatistics::AccountMessagePublished() { ++messages_published_; }
 
 void ConnectionStatistics::AccountMessageConsumed() { ++messages_consumed_; }
 
+void ConnectionStatistics::AccountMessagesConsumed(size_t count) {
+  messages_consumed_ += count;
+}
+
+void ConnectionStatistics::AccountPublishUnconfirmed() {
+  ++unconfirmed_publishes_;
+}
+
+void ConnectionStatistics::AccountPublishConfirmationReceived() noexcept {
+  --unconfirmed_publishes_;
+}
+
 ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
   Frozen result{};
   result.connections_created = connections_created_.Load();
@@ -34,6 +46,7 @@ ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
   result.bytes_read = bytes_read_.Load();
   result.messages_published = messages_published_.Load();
   result.messages_consumed = messages_consumed_.Load();
+  result.unconfirmed_publishes = unconfirmed_publishes_.Load();
 
   return result;
 }
@@ -46,6 +59,7 @@ ConnectionStatistics::Frozen& ConnectionStatistics::Frozen::operator+=(
   bytes_read += other.bytes_read;
   messages_published += other.messages_published;
   messages_consumed += other.messages_consumed;
+  unconfirmed_publishes += other.unconfirmed_publishes;
 
   return *this;
 }
@@ -58,6 +72,7 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["bytes_read"] = value.bytes_read;
   writer["messages_published"] = value.messages_published;
   writer["messages_consumed"] = value.messages_consumed;
+  writer["unconfirmed_publishes"] = value.unconfirmed_publishes;
 }
 
 }  // namespace urabbitmq::statistics
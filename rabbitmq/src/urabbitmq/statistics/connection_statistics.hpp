@@ -19,6 +19,10 @@ class ConnectionStatistics final {
 
   void AccountMessagePublished();
   void AccountMessageConsumed();
+  void AccountMessagesConsumed(size_t count);
+
+  void AccountPublishUnconfirmed();
+  void AccountPublishConfirmationReceived() noexcept;
 
   struct Frozen final {
     Frozen& operator+=(const Frozen& other);
@@ -31,6 +35,8 @@ class ConnectionStatistics final {
 
     size_t messages_published{0};
     size_t messages_consumed{0};
+
+    size_t unconfirmed_publishes{0};
   };
   Frozen Get() const;
 
@@ -43,6 +49,9 @@ class ConnectionStatistics final {
 
   utils::statistics::RelaxedCounter<size_t> messages_published_{0};
   utils::statistics::RelaxedCounter<size_t> messages_consumed_{0};
+
+  // a gauge of reliable publishes awaiting the broker confirmation
+  utils::statistics::RelaxedCounter<size_t> unconfirmed_publishes_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
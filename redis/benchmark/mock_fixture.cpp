@@ -0,0 +1,52 @@
+#include "mock_fixture.hpp"
+
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+constexpr std::size_t kMainWorkerThreads = 16;
+constexpr std::size_t kSentinelCount = 1;
+constexpr std::size_t kRedisThreadPoolSize = 3;
+
+constexpr std::size_t kValueSize = 64;
+
+}  // namespace
+
+void MockRedis::RunStandalone(std::size_t shard_count,
+                              std::function<void()> payload) {
+  engine::RunStandalone(kMainWorkerThreads, [&] {
+    servers_ = std::make_unique<SentinelShardTest>(
+        kSentinelCount, shard_count, 0, 0, kRedisThreadPoolSize);
+
+    const std::string value(kValueSize, 'x');
+    RegisterReply("GET", USERVER_NAMESPACE::redis::ReplyData{value});
+    RegisterReply("SET",
+                  USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK"));
+
+    client_ = std::make_shared<storages::redis::ClientImpl>(
+        servers_->SentinelClientPtr());
+
+    payload();
+
+    client_.reset();
+    servers_.reset();
+  });
+}
+
+void MockRedis::RegisterReply(
+    const std::string& command,
+    const USERVER_NAMESPACE::redis::ReplyData& reply_data) {
+  for (auto* servers : {&servers_->Masters(), &servers_->Slaves()}) {
+    for (auto& server : *servers) {
+      server->RegisterHandlerWithConstReply(command, reply_data);
+    }
+  }
+}
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <storages/redis/client_impl.hpp>
+#include <storages/redis/impl/server_common_sentinel_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+/// Runs the client against the mock redis servers: a sentinel and a master
+/// with a replica for each shard. The servers reply to GET, SET and MGET with
+/// the constant replies.
+class MockRedis : public benchmark::Fixture {
+ protected:
+  ClientPtr GetClient() const noexcept { return client_; };
+  SentinelShardTest& GetServers() const noexcept { return *servers_; };
+
+  void RunStandalone(std::size_t shard_count, std::function<void()> payload);
+
+  /// Makes all the masters and the replicas reply to the command
+  void RegisterReply(const std::string& command,
+                     const USERVER_NAMESPACE::redis::ReplyData& reply_data);
+
+ private:
+  std::unique_ptr<SentinelShardTest> servers_;
+  ClientPtr client_;
+};
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
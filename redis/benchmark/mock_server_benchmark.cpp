@@ -0,0 +1,139 @@
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/rand.hpp>
+
+#include "mock_fixture.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+constexpr std::size_t kKeysCount = 1000;
+
+std::string RandomKey() {
+  return "key" + std::to_string(utils::RandRange(kKeysCount));
+}
+
+// Each of the `concurrency` tasks makes `requests_per_task` sequential
+// requests, so that the requests of the tasks are interleaved in the driver
+void RunConcurrently(benchmark::State& state, std::size_t concurrency,
+                     std::size_t requests_per_task,
+                     const std::function<void()>& request) {
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(concurrency);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < concurrency; ++i) {
+      tasks.push_back(utils::Async("bench", [&] {
+        for (std::size_t j = 0; j < requests_per_task; ++j) request();
+      }));
+    }
+    engine::WaitAllChecked(tasks);
+    tasks.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * concurrency *
+                          requests_per_task);
+}
+
+}  // namespace
+
+// Submission of the commands by many tasks and waiting for the replies
+BENCHMARK_DEFINE_F(MockRedis, ConcurrentGet)(benchmark::State& state) {
+  RunStandalone(1, [this, &state] {
+    const CommandControl cc{};
+    RunConcurrently(state, state.range(0), 16,
+                    [&] { GetClient()->Get(RandomKey(), cc).Get(); });
+  });
+}
+
+BENCHMARK_REGISTER_F(MockRedis, ConcurrentGet)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+
+// Parsing of the replies of the arrays of the `range(0)` strings of
+// `range(1)` bytes
+BENCHMARK_DEFINE_F(MockRedis, MgetReplyParsing)(benchmark::State& state) {
+  RunStandalone(1, [this, &state] {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    USERVER_NAMESPACE::redis::ReplyData::Array values(
+        size, USERVER_NAMESPACE::redis::ReplyData{
+                  std::string(state.range(1), 'x')});
+    RegisterReply("MGET", USERVER_NAMESPACE::redis::ReplyData{
+                              std::move(values)});
+
+    std::vector<std::string> keys;
+    keys.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      keys.push_back("key" + std::to_string(i));
+    }
+
+    const CommandControl cc{};
+    for (auto _ : state) {
+      auto reply = GetClient()->Mget(keys, cc).Get();
+      benchmark::DoNotOptimize(reply);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+  });
+}
+
+BENCHMARK_REGISTER_F(MockRedis, MgetReplyParsing)
+    ->Args({10, 64})
+    ->Args({100, 64})
+    ->Args({1000, 64})
+    ->Args({100, 4096})
+    ->UseRealTime();
+
+// Latency and throughput of a task that keeps `range(0)` commands in flight
+BENCHMARK_DEFINE_F(MockRedis, PipelinedSet)(benchmark::State& state) {
+  RunStandalone(1, [this, &state] {
+    const CommandControl cc{};
+    const std::string value(64, 'x');
+    std::deque<RequestSet> requests;
+    for (auto i = 0; i < state.range(0); ++i) {
+      requests.push_back(GetClient()->Set(RandomKey(), value, cc));
+    }
+
+    for (auto _ : state) {
+      requests.front().Get();
+      requests.pop_front();
+      requests.push_back(GetClient()->Set(RandomKey(), value, cc));
+    }
+
+    for (; !requests.empty(); requests.pop_front()) requests.front().Get();
+    state.SetItemsProcessed(state.iterations());
+  });
+}
+
+BENCHMARK_REGISTER_F(MockRedis, PipelinedSet)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+
+// Routing of the commands of concurrent tasks to the `range(0)` shards
+BENCHMARK_DEFINE_F(MockRedis, ShardedGet)(benchmark::State& state) {
+  RunStandalone(state.range(0), [this, &state] {
+    const CommandControl cc{};
+    RunConcurrently(state, 64, 16,
+                    [&] { GetClient()->Get(RandomKey(), cc).Get(); });
+  });
+}
+
+BENCHMARK_REGISTER_F(MockRedis, ShardedGet)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
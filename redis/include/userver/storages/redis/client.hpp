@@ -248,6 +248,22 @@ class Client {
       std::vector<std::pair<std::string, std::string>> key_values,
       const CommandControl& command_control) = 0;
 
+  /// @brief MGET of the keys of arbitrary shards.
+  ///
+  /// The keys are grouped by shard (by hash slot in the cluster mode), the
+  /// groups are requested in parallel. Waits for all the subrequests, the
+  /// failed ones are reported in the reply instead of throwing.
+  virtual MgetAcrossShardsReply MgetAcrossShards(
+      std::vector<std::string> keys, const CommandControl& command_control) = 0;
+
+  /// @brief MSET of the keys of arbitrary shards.
+  ///
+  /// Same as MgetAcrossShards, the key-values of a failed subrequest may be
+  /// set partially.
+  virtual MsetAcrossShardsReply MsetAcrossShards(
+      std::vector<std::pair<std::string, std::string>> key_values,
+      const CommandControl& command_control) = 0;
+
   virtual TransactionPtr Multi() = 0;
 
   virtual TransactionPtr Multi(Transaction::CheckShards check_shards) = 0;
@@ -357,6 +373,39 @@ class Client {
   virtual RequestType Type(std::string key,
                            const CommandControl& command_control) = 0;
 
+  /// @brief Append an entry with an automatically generated id to a stream.
+  /// @returns id of the added entry
+  virtual RequestXadd Xadd(
+      std::string key, std::vector<std::pair<std::string, std::string>> fields,
+      const CommandControl& command_control) = 0;
+
+  /// @brief Acknowledge the processed entries of a consumer group.
+  /// @returns count of the acknowledged entries
+  virtual RequestXack Xack(std::string key, std::string group,
+                           std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  /// @brief Transfer the ownership of the entries that are pending for more
+  /// than `min_idle_time` starting from `start` to the `consumer`.
+  /// @note Requires Redis 6.2+
+  virtual RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start, size_t count,
+      const CommandControl& command_control) = 0;
+
+  /// @brief Create a consumer group starting at `id` of the stream, the stream
+  /// is created if it does not exist.
+  virtual RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) = 0;
+
+  /// @brief Read up to `count` entries of the stream as the `consumer` of the
+  /// `group`. Pass ">" as `id` to get the new entries or an explicit id to
+  /// get the entries pending for the consumer. The read is not blocking.
+  virtual RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer,
+      std::string id, size_t count, const CommandControl& command_control) = 0;
+
   virtual RequestZadd Zadd(std::string key, double score, std::string member,
                            const CommandControl& command_control) = 0;
 
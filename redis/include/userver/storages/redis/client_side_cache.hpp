@@ -0,0 +1,95 @@
+#pragma once
+
+/// @file userver/storages/redis/client_side_cache.hpp
+/// @brief @copybrief storages::redis::ClientSideCache
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_options.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief storages::redis::ClientSideCache options
+struct ClientSideCacheSettings final {
+  /// Count of the cache ways, accesses to a way are serialized
+  std::size_t ways{16};
+
+  /// Maximum count of the cached values in a way
+  std::size_t way_size{1024};
+
+  /// Time during which a cached value is returned without querying Redis
+  std::chrono::milliseconds lifetime{std::chrono::seconds{10}};
+
+  /// Prefixes of the keys to cache, an empty prefix caches all the keys
+  std::vector<std::string> prefixes;
+};
+
+/// @brief In-process cache of the values of the rarely changing keys.
+///
+/// Get() of a key that starts with one of the configured prefixes returns the
+/// cached value (or the absence of the value) for the `lifetime`, other keys
+/// are always read from Redis. Concurrent cache misses of the same key are
+/// coalesced into a single GET.
+///
+/// When a SubscribeClient is passed, the cache subscribes to the keyspace
+/// notifications of the prefixes and drops the values of the changed keys.
+/// The notifications must be enabled on the server, e.g.
+/// `notify-keyspace-events KA`. The notifications are not guaranteed to be
+/// delivered, so the `lifetime` bounds the staleness of the values anyways.
+///
+/// @snippet storages/redis/client_side_cache_redistest.cpp ClientSideCache
+class ClientSideCache final {
+ public:
+  ClientSideCache(std::shared_ptr<Client> client,
+                  std::shared_ptr<SubscribeClient> subscribe_client,
+                  const ClientSideCacheSettings& settings);
+
+  ClientSideCache(const ClientSideCache&) = delete;
+  ClientSideCache& operator=(const ClientSideCache&) = delete;
+
+  ~ClientSideCache();
+
+  /// @brief Return the value of the key, from the cache if the key is cached
+  std::optional<std::string> Get(std::string key,
+                                 const CommandControl& command_control);
+
+  /// Returns true if the key starts with one of the cached prefixes
+  bool IsCached(std::string_view key) const;
+
+  /// Drop the cached value of the key
+  void Invalidate(const std::string& key);
+
+  /// Drop all the cached values
+  void InvalidateAll();
+
+  /// @cond
+  const cache::impl::ExpirableLruCacheStatistics& GetStatistics() const;
+  /// @endcond
+
+ private:
+  void OnKeyspaceEvent(const std::string& channel);
+
+  std::shared_ptr<Client> client_;
+  const std::vector<std::string> prefixes_;
+  cache::ExpirableLruCache<std::string, std::optional<std::string>> cache_;
+  std::vector<SubscriptionToken> subscriptions_;
+};
+
+/// @brief ClientSideCache statistics support for utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const ClientSideCache& cache);
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
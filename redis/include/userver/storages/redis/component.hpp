@@ -29,6 +29,7 @@ namespace storages {}
 /// Redis client
 namespace storages::redis {
 class Client;
+class HotKeys;
 class SubscribeClient;
 class SubscribeClientImpl;
 }  // namespace storages::redis
@@ -60,8 +61,13 @@ namespace components {
 /// groups | array of redis clusters to work with excluding subscribers | -
 /// groups.[].config_name | key name in secdist with options for this cluster | -
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
-/// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
+/// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardJumpConsistentHash, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].hot_keys.sample_rate | each sample_rate-th command key is accounted by the hot keys detector, 0 disables the detector | 0
+/// groups.[].hot_keys.top_size | count of the hottest keys that are tracked and exported in `redis.hot_keys` metrics | 16
+/// groups.[].hot_keys.window | hotness of the keys is estimated over the windows of this duration | 10s
+/// groups.[].hot_keys.hot_threshold | estimated count of the commands per window that makes a key hot | 1000
+/// groups.[].hot_keys.cache_lifetime | lifetime of the locally cached GET values of the hot keys, 0 disables the cache | 0
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -122,6 +128,8 @@ class Redis : public LoggableComponentBase {
   std::unordered_map<std::string, std::shared_ptr<redis::Sentinel>> sentinels_;
   std::unordered_map<std::string, std::shared_ptr<storages::redis::Client>>
       clients_;
+  std::unordered_map<std::string, std::shared_ptr<storages::redis::HotKeys>>
+      hot_keys_;
   std::unordered_map<std::string,
                      std::shared_ptr<storages::redis::SubscribeClientImpl>>
       subscribe_clients_;
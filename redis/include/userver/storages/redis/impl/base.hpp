@@ -178,6 +178,10 @@ struct CommandControl {
 
     /// Send requests to 'best_dc_count' Redis instances with the min ping
     kNearestServerPing,
+
+    /// Send requests to the instance with the least product of the running
+    /// commands count and the average latency of the recent replies
+    kLeastLoaded,
   };
 
   /// Timeout for a single attempt to execute command
@@ -245,11 +249,15 @@ struct CommandsBufferingSettings {
   bool buffering_enabled{false};
   size_t commands_buffering_threshold{0};
   std::chrono::microseconds watch_command_timer_interval{0};
+  /// Maximum count of the commands sent at a single event loop iteration,
+  /// 0 means unlimited
+  size_t max_batch_size{0};
 
   constexpr bool operator==(const CommandsBufferingSettings& o) const {
     return buffering_enabled == o.buffering_enabled &&
            commands_buffering_threshold == o.commands_buffering_threshold &&
-           watch_command_timer_interval == o.watch_command_timer_interval;
+           watch_command_timer_interval == o.watch_command_timer_interval &&
+           max_batch_size == o.max_batch_size;
   }
 };
 
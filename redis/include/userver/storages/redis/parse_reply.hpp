@@ -71,6 +71,10 @@ std::vector<GeoPoint> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<GeoPoint>>);
 
+std::vector<StreamEntry> ParseReplyDataArray(
+    ReplyData&& array_data, const std::string& request_description,
+    To<std::vector<StreamEntry>>);
+
 std::string Parse(ReplyData&& reply_data,
                   const std::string& request_description, To<std::string>);
 
@@ -119,6 +123,18 @@ std::unordered_map<std::string, std::string> Parse(
     ReplyData&& reply_data, const std::string& request_description,
     To<std::unordered_map<std::string, std::string>>);
 
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>);
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>);
+
+XreadgroupReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XreadgroupReply>);
+
 ReplyData Parse(ReplyData&& reply_data, const std::string& request_description,
                 To<ReplyData>);
 
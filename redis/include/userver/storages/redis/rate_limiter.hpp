@@ -0,0 +1,120 @@
+#pragma once
+
+/// @file userver/storages/redis/rate_limiter.hpp
+/// @brief @copybrief storages::redis::RateLimiter
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_options.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief storages::redis::RateLimiter options
+struct RateLimiterSettings final {
+  /// Maximum count of the obtained tokens of a key in a window, fleet-wide
+  std::int64_t limit{100};
+
+  /// Duration of a window, the windows of all the instances are aligned
+  std::chrono::milliseconds window{std::chrono::seconds{1}};
+
+  /// Prefix of the Redis keys with the counters
+  std::string key_prefix{"rate-limit:"};
+};
+
+/// @brief Fleet-wide per-key rate limiter that keeps the counters in Redis.
+///
+/// Obtain() does not query Redis: the tokens obtained by the instance are
+/// counted locally and sent by Sync() with a single script call per key,
+/// which also returns the fleet-wide counts. Sync() is meant to be called
+/// every few tens of milliseconds, e.g. by
+/// storages::redis::RateLimiterComponent.
+///
+/// The counts of the current and the previous fixed windows are combined into
+/// an estimate of a sliding window: the previous window is weighted by its
+/// part still covered by the sliding one. The limit may be exceeded by the
+/// tokens obtained by the other instances since the last Sync(). While Redis
+/// is unavailable, the instance enforces the limit on its own tokens of the
+/// sliding window, and the unsent tokens of the windows before the previous
+/// one are dropped.
+///
+/// @snippet storages/redis/rate_limiter_redistest.cpp RateLimiter
+class RateLimiter final {
+ public:
+  RateLimiter(std::shared_ptr<Client> client, RateLimiterSettings settings);
+
+  RateLimiter(const RateLimiter&) = delete;
+  RateLimiter& operator=(const RateLimiter&) = delete;
+
+  ~RateLimiter();
+
+  /// @returns true if the token of the key was obtained
+  [[nodiscard]] bool Obtain(const std::string& key);
+
+  /// @brief Sends the locally obtained tokens and updates the fleet-wide
+  /// counts, forgets the keys that were not used for a window
+  void Sync(const CommandControl& command_control);
+
+  /// @cond
+  struct Statistics final {
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::uint64_t>
+        obtained;
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::uint64_t>
+        rejected;
+    USERVER_NAMESPACE::utils::statistics::RelaxedCounter<std::uint64_t>
+        sync_errors;
+  };
+
+  const Statistics& GetStatistics() const noexcept { return statistics_; }
+  /// @endcond
+
+ private:
+  struct KeyState final {
+    // Makes the unsent tokens of `pending_window` belong to `new_window`
+    void AdvancePending(std::int64_t new_window) noexcept;
+
+    // Guards the fields below, the critical sections never suspend
+    std::mutex mutex;
+
+    // Index of the window of the fleet-wide counts
+    std::int64_t window{-1};
+    std::int64_t current{0};
+    std::int64_t previous{0};
+
+    // Obtained and not sent yet in the `pending_window` and the one before it
+    std::int64_t pending_window{-1};
+    std::int64_t pending_current{0};
+    std::int64_t pending_previous{0};
+
+    std::int64_t last_used_window{0};
+    // Set by Sync() right before the state is removed from the map
+    bool erased{false};
+  };
+
+  std::shared_ptr<KeyState> ReplaceErasedState(
+      const std::string& key, const std::shared_ptr<KeyState>& erased);
+
+  std::string MakeRedisKey(const std::string& key, std::int64_t window) const;
+
+  std::shared_ptr<Client> client_;
+  const RateLimiterSettings settings_;
+  rcu::RcuMap<std::string, KeyState> states_;
+  Statistics statistics_;
+};
+
+/// @brief RateLimiter statistics support for utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const RateLimiter& rate_limiter);
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
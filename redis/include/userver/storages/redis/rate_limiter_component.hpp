@@ -0,0 +1,79 @@
+#pragma once
+
+/// @file userver/storages/redis/rate_limiter_component.hpp
+/// @brief @copybrief storages::redis::RateLimiterComponent
+
+#include <memory>
+#include <string_view>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/storages/redis/rate_limiter.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+// clang-format off
+/// @ingroup userver_components
+///
+/// @brief Component that owns a storages::redis::RateLimiter and syncs its
+/// counters with Redis every `sync_interval`.
+///
+/// Register it under different names for the different quotas. The
+/// `key_prefix` must be the same on all the instances sharing a quota.
+///
+/// ## Static options:
+/// Name          | Description | Default value
+/// ------------- | ----------- | -------------
+/// redis_name    | Name of the components::Redis to use | redis
+/// db            | Name of the redis database in components::Redis | -
+/// limit         | Fleet-wide count of the tokens of a key in a window | -
+/// window        | Duration of a window | 1s
+/// sync_interval | Interval of sending the local counts to Redis | 100ms
+/// key_prefix    | Prefix of the Redis keys with the counters | rate-limit:
+///
+/// ## Static configuration example:
+///
+/// ```
+///    redis-rate-limiter:
+///        db: ratelimits
+///        limit: 1000
+///        window: 1s
+///        key_prefix: "clients-rps:"
+/// ```
+// clang-format on
+class RateLimiterComponent final : public components::LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of storages::redis::RateLimiterComponent
+  static constexpr std::string_view kName = "redis-rate-limiter";
+
+  RateLimiterComponent(const components::ComponentConfig& config,
+                       const components::ComponentContext& context);
+  ~RateLimiterComponent() override;
+
+  RateLimiter& GetRateLimiter() noexcept { return *rate_limiter_; }
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  void OnAllComponentsAreStopping() override;
+
+  std::unique_ptr<RateLimiter> rate_limiter_;
+  USERVER_NAMESPACE::utils::PeriodicTask sync_task_;
+  USERVER_NAMESPACE::utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace storages::redis
+
+namespace components {
+
+template <>
+inline constexpr bool kHasValidate<storages::redis::RateLimiterComponent> =
+    true;
+
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -78,6 +80,22 @@ struct MemberScore final {
   bool operator!=(const MemberScore& rhs) const { return !(*this == rhs); }
 };
 
+/// Reply of storages::redis::Client::MgetAcrossShards
+struct MgetAcrossShardsReply final {
+  /// Values in the order of the requested keys, std::nullopt for the missing
+  /// keys and for the keys of the failed subrequests
+  std::vector<std::optional<std::string>> values;
+
+  /// Sorted indices of the keys whose subrequests failed
+  std::vector<size_t> failed_keys;
+};
+
+/// Reply of storages::redis::Client::MsetAcrossShards
+struct MsetAcrossShardsReply final {
+  /// Sorted indices of the key-values whose subrequests failed
+  std::vector<size_t> failed_keys;
+};
+
 enum class PersistReply { kKeyOrTimeoutNotFound, kTimeoutRemoved };
 
 template <ScanTag>
@@ -109,8 +127,36 @@ enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
 
+/// Entry of a redis stream
+struct StreamEntry final {
+  std::string id;
+
+  /// Field-value pairs of the entry, empty for the entries that were deleted
+  /// from the stream while being pending
+  std::vector<std::pair<std::string, std::string>> fields;
+};
+
 using TtlReply = USERVER_NAMESPACE::redis::TtlReply;
 
+/// Reply of storages::redis::Client::Xautoclaim
+struct XautoclaimReply final {
+  /// The id to start the next claim from, "0-0" when the whole pending
+  /// entries list was scanned
+  std::string next_id;
+
+  /// Entries claimed by the consumer
+  std::vector<StreamEntry> entries;
+};
+
+/// Reply of storages::redis::Client::XgroupCreate
+enum class XgroupCreateReply { kCreated, kGroupExists };
+
+/// Reply of storages::redis::Client::Xreadgroup
+struct XreadgroupReply final {
+  /// Entries delivered to the consumer, empty if there are no new entries
+  std::vector<StreamEntry> entries;
+};
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,119 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer_component_base.hpp
+/// @brief @copybrief storages::redis::StreamConsumerComponentBase
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+// clang-format off
+/// @ingroup userver_base_classes
+///
+/// @brief Base component for the consumers of a redis stream.
+///
+/// You should derive from it and override `Process` method, which gets called
+/// for each entry read by the consumer group. The consumer is automatically
+/// started after all components are loaded and stopped before all components
+/// are beginning to stop.
+///
+/// The entries are read in batches of up to `batch_size`. The processed
+/// entries of a batch are acknowledged by a single XACK, which is awaited
+/// only before acknowledging the next batch, so its roundtrip overlaps with
+/// the processing of the next batch.
+///
+/// The entries that were not acknowledged in `reclaim_min_idle` (e.g. a
+/// consumer instance died or `Process` threw) are reclaimed with XAUTOCLAIM,
+/// which requires Redis 6.2+.
+///
+/// The reads are not blocking as the connections to the redis instance are
+/// shared with the other requests, an empty read is followed by a
+/// `poll_interval` pause.
+///
+/// @note Library guarantees `at least once` delivery, hence some deduplication
+/// might be needed on your side.
+///
+/// ## Static options:
+/// Name             | Description | Default value
+/// ---------------- | ----------- | -------------
+/// redis_name       | Name of the components::Redis to use | redis
+/// db               | Name of the redis database in components::Redis | -
+/// stream           | Key of the stream to consume | -
+/// group            | Consumer group, it is created if missing | -
+/// consumer         | Name of the consumer in the group, should be unique per instance | -
+/// batch_size       | Maximum count of entries read at once | 100
+/// poll_interval    | Pause after reading no entries | 100ms
+/// reclaim_min_idle | Time after which an unacknowledged entry is reclaimed | 60s
+/// reclaim_interval | Interval of searching for the entries to reclaim | 10s
+///
+/// ## Static configuration example:
+///
+/// ```
+///    orders-consumer:
+///        db: orders
+///        stream: orders-stream
+///        group: orders-processors
+///        consumer: orders-processor-1
+///        batch_size: 500
+/// ```
+// clang-format on
+class StreamConsumerComponentBase : public components::LoggableComponentBase {
+ public:
+  StreamConsumerComponentBase(const components::ComponentConfig& config,
+                              const components::ComponentContext& context);
+  ~StreamConsumerComponentBase() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  void OnAllComponentsLoaded() final;
+
+  void OnAllComponentsAreStopping() final;
+
+  /// @brief Override this method in derived class and implement entry
+  /// handling logic.
+  ///
+  /// If this method returns successfully the entry is acknowledged (best
+  /// effort), if this method throws the entry is left pending and is
+  /// delivered again after `reclaim_min_idle`.
+  virtual void Process(StreamEntry entry) = 0;
+
+ private:
+  void Run();
+  std::vector<StreamEntry> ReadBatch(
+      std::chrono::steady_clock::time_point& next_reclaim,
+      std::string& reclaim_start);
+
+  ClientPtr client_;
+  const std::string stream_;
+  const std::string group_;
+  const std::string consumer_;
+  const size_t batch_size_;
+  const std::chrono::milliseconds poll_interval_;
+  const std::chrono::milliseconds reclaim_min_idle_;
+  const std::chrono::milliseconds reclaim_interval_;
+
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::redis
+
+namespace components {
+
+template <>
+inline constexpr bool
+    kHasValidate<storages::redis::StreamConsumerComponentBase> = true;
+
+}
+
+USERVER_NAMESPACE_END
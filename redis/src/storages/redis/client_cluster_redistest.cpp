@@ -124,6 +124,36 @@ UTEST_F(RedisClusterClientTest, MgetCrossSlot) {
   }
 }
 
+UTEST_F(RedisClusterClientTest, MgetAcrossShards) {
+  auto client = GetClient();
+
+  const size_t kNumKeys = 50;
+  const int add = 100;
+
+  std::vector<std::pair<std::string, std::string>> key_values;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    key_values.emplace_back(MakeKey(i), std::to_string(add + i));
+  }
+  const auto set_reply = client->MsetAcrossShards(key_values, kDefaultCc);
+  EXPECT_TRUE(set_reply.failed_keys.empty());
+
+  // the keys belong to different slots of the same and of different shards
+  std::vector<std::string> keys;
+  for (size_t i = kNumKeys; i > 0; --i) keys.push_back(MakeKey(i - 1));
+  const auto reply = client->MgetAcrossShards(keys, kDefaultCc);
+  EXPECT_TRUE(reply.failed_keys.empty());
+  ASSERT_EQ(reply.values.size(), kNumKeys);
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    ASSERT_TRUE(reply.values[i]);
+    EXPECT_EQ(*reply.values[i], std::to_string(add + kNumKeys - i - 1));
+  }
+
+  for (const auto& key : keys) {
+    auto req = client->Del(key, kDefaultCc);
+    EXPECT_EQ(req.Get(), 1);
+  }
+}
+
 UTEST_F(RedisClusterClientTest, Transaction) {
   auto client = GetClient();
   auto transaction = client->Multi();
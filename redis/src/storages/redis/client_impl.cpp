@@ -1,9 +1,15 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
+#include "hot_keys.hpp"
 #include "request_impl.hpp"
 #include "transaction_impl.hpp"
 
@@ -36,8 +42,10 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
 
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-    std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    std::optional<size_t> force_shard_idx, std::shared_ptr<HotKeys> hot_keys)
+    : redis_client_(std::move(sentinel)),
+      force_shard_idx_(force_shard_idx),
+      hot_keys_(std::move(hot_keys)) {}
 
 void ClientImpl::WaitConnectedOnce(
     USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
@@ -55,7 +63,7 @@ const std::string& ClientImpl::GetAnyKeyForShard(size_t shard_idx) const {
 }
 
 std::shared_ptr<Client> ClientImpl::GetClientForShard(size_t shard_idx) {
-  return std::make_shared<ClientImpl>(redis_client_, shard_idx);
+  return std::make_shared<ClientImpl>(redis_client_, shard_idx, hot_keys_);
 }
 
 std::optional<size_t> ClientImpl::GetForcedShardIdx() const {
@@ -272,6 +280,25 @@ RequestGeosearch ClientImpl::Geosearch(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (hot_keys_ && hot_keys_->IsCacheEnabled() && hot_keys_->IsHot(key)) {
+    if (auto cached = hot_keys_->GetCached(key)) {
+      return CreateDummyRequest<RequestGet>(std::make_shared<Reply>(
+          "get", *cached ? ReplyData{std::move(**cached)}
+                         : ReplyData::CreateNil()));
+    }
+
+    auto request = MakeRequest(CmdArgs{"get", key}, shard, false,
+                               GetCommandControl(command_control));
+    return RequestGet{
+        std::make_unique<ObservedRequestDataImpl<RequestGet::Reply,
+                                                 RequestGet::Reply>>(
+            std::move(request),
+            [hot_keys = hot_keys_, key = std::move(key)](
+                const RequestGet::Reply& reply) {
+              hot_keys->PutCached(key, reply);
+            })};
+  }
+
   return CreateRequest<RequestGet>(
       MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
                   GetCommandControl(command_control)));
@@ -541,6 +568,80 @@ RequestMset ClientImpl::Mset(
                   GetCommandControl(command_control)));
 }
 
+MgetAcrossShardsReply ClientImpl::MgetAcrossShards(
+    std::vector<std::string> keys, const CommandControl& command_control) {
+  const auto groups = GroupKeysBySlots(
+      keys.size(), [&keys](size_t idx) -> const auto& { return keys[idx]; },
+      command_control);
+
+  // the requests are sent on creation, so all the groups are in flight at once
+  std::vector<RequestMget> requests;
+  requests.reserve(groups.size());
+  for (const auto& group : groups) {
+    std::vector<std::string> group_keys;
+    group_keys.reserve(group.size());
+    for (const auto idx : group) group_keys.push_back(std::move(keys[idx]));
+    requests.push_back(Mget(std::move(group_keys), command_control));
+  }
+
+  MgetAcrossShardsReply reply;
+  reply.values.resize(keys.size());
+  for (size_t i = 0; i < groups.size(); ++i) {
+    const auto& group = groups[i];
+    try {
+      auto values = requests[i].Get();
+      UASSERT(values.size() == group.size());
+      for (size_t j = 0; j < group.size(); ++j) {
+        reply.values[group[j]] = std::move(values[j]);
+      }
+    } catch (const USERVER_NAMESPACE::redis::Exception& ex) {
+      LOG_WARNING() << "MGET of " << group.size()
+                    << " keys failed: " << ex.what();
+      reply.failed_keys.insert(reply.failed_keys.end(), group.begin(),
+                               group.end());
+    }
+  }
+  std::sort(reply.failed_keys.begin(), reply.failed_keys.end());
+  return reply;
+}
+
+MsetAcrossShardsReply ClientImpl::MsetAcrossShards(
+    std::vector<std::pair<std::string, std::string>> key_values,
+    const CommandControl& command_control) {
+  const auto groups = GroupKeysBySlots(
+      key_values.size(),
+      [&key_values](size_t idx) -> const auto& {
+        return key_values[idx].first;
+      },
+      command_control);
+
+  std::vector<RequestMset> requests;
+  requests.reserve(groups.size());
+  for (const auto& group : groups) {
+    std::vector<std::pair<std::string, std::string>> group_key_values;
+    group_key_values.reserve(group.size());
+    for (const auto idx : group) {
+      group_key_values.push_back(std::move(key_values[idx]));
+    }
+    requests.push_back(Mset(std::move(group_key_values), command_control));
+  }
+
+  MsetAcrossShardsReply reply;
+  for (size_t i = 0; i < groups.size(); ++i) {
+    const auto& group = groups[i];
+    try {
+      requests[i].Get();
+    } catch (const USERVER_NAMESPACE::redis::Exception& ex) {
+      LOG_WARNING() << "MSET of " << group.size()
+                    << " keys failed: " << ex.what();
+      reply.failed_keys.insert(reply.failed_keys.end(), group.begin(),
+                               group.end());
+    }
+  }
+  std::sort(reply.failed_keys.begin(), reply.failed_keys.end());
+  return reply;
+}
+
 TransactionPtr ClientImpl::Multi() {
   return std::make_unique<TransactionImpl>(shared_from_this());
 }
@@ -828,6 +929,58 @@ RequestType ClientImpl::Type(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestXadd ClientImpl::Xadd(
+    std::string key, std::vector<std::pair<std::string, std::string>> fields,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXadd>(
+      MakeRequest(CmdArgs{"xadd", std::move(key), "*", std::move(fields)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXack ClientImpl::Xack(std::string key, std::string group,
+                             std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  if (ids.empty())
+    return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXack>(MakeRequest(
+      CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)}, shard,
+      true, GetCommandControl(command_control)));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key, std::string group, std::string consumer,
+    std::chrono::milliseconds min_idle_time, std::string start, size_t count,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXautoclaim>(MakeRequest(
+      CmdArgs{"xautoclaim", std::move(key), std::move(group),
+              std::move(consumer), min_idle_time.count(), std::move(start),
+              "COUNT", count},
+      shard, true, GetCommandControl(command_control)));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key, std::string group, std::string id,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXgroupCreate>(
+      MakeRequest(CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group),
+                          std::move(id), "MKSTREAM"},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key, std::string group, std::string consumer, std::string id,
+    size_t count, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXreadgroup>(MakeRequest(
+      CmdArgs{"xreadgroup", "GROUP", std::move(group), std::move(consumer),
+              "COUNT", count, "STREAMS", std::move(key), std::move(id)},
+      shard, true, GetCommandControl(command_control)));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -1086,6 +1239,7 @@ size_t ClientImpl::GetPublishShard(PubShard policy) {
 
 size_t ClientImpl::ShardByKey(const std::string& key,
                               const CommandControl& cc) const {
+  if (hot_keys_) hot_keys_->Account(key);
   if (force_shard_idx_) {
     if (cc.force_shard_idx && *cc.force_shard_idx != *force_shard_idx_)
       throw USERVER_NAMESPACE::redis::InvalidArgumentException(
@@ -1098,6 +1252,24 @@ size_t ClientImpl::ShardByKey(const std::string& key,
   return ShardByKey(key);
 }
 
+template <typename Func>
+std::vector<std::vector<size_t>> ClientImpl::GroupKeysBySlots(
+    size_t keys_count, Func&& get_key, const CommandControl& cc) const {
+  // the keys of a hash slot always belong to the same shard
+  const bool by_slots = redis_client_->IsInClusterMode();
+  std::vector<std::vector<size_t>> groups;
+  std::unordered_map<size_t, size_t> group_indices;
+  for (size_t idx = 0; idx < keys_count; ++idx) {
+    const auto& key = get_key(idx);
+    const auto group_key = by_slots ? USERVER_NAMESPACE::redis::HashSlot(key)
+                                    : ShardByKey(key, cc);
+    const auto [it, inserted] = group_indices.emplace(group_key, groups.size());
+    if (inserted) groups.emplace_back();
+    groups[it->second].push_back(idx);
+  }
+  return groups;
+}
+
 void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
   DoCheckShard(shard, force_shard_idx_);
   DoCheckShard(shard, cc.force_shard_idx);
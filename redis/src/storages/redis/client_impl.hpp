@@ -23,6 +23,7 @@ class Sentinel;
 
 namespace storages::redis {
 
+class HotKeys;
 class TransactionImpl;
 
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
@@ -31,7 +32,8 @@ class ClientImpl final : public Client,
  public:
   explicit ClientImpl(
       std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-      std::optional<size_t> force_shard_idx = std::nullopt);
+      std::optional<size_t> force_shard_idx = std::nullopt,
+      std::shared_ptr<HotKeys> hot_keys = nullptr);
 
   void WaitConnectedOnce(
       USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) override;
@@ -220,6 +222,14 @@ class ClientImpl final : public Client,
   RequestMset Mset(std::vector<std::pair<std::string, std::string>> key_values,
                    const CommandControl& command_control) override;
 
+  MgetAcrossShardsReply MgetAcrossShards(
+      std::vector<std::string> keys,
+      const CommandControl& command_control) override;
+
+  MsetAcrossShardsReply MsetAcrossShards(
+      std::vector<std::pair<std::string, std::string>> key_values,
+      const CommandControl& command_control) override;
+
   TransactionPtr Multi() override;
 
   TransactionPtr Multi(Transaction::CheckShards check_shards) override;
@@ -333,6 +343,29 @@ class ClientImpl final : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXadd Xadd(std::string key,
+                   std::vector<std::pair<std::string, std::string>> fields,
+                   const CommandControl& command_control) override;
+
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(std::string key, std::string group,
+                               std::string consumer,
+                               std::chrono::milliseconds min_idle_time,
+                               std::string start, size_t count,
+                               const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(std::string key, std::string group,
+                               std::string consumer, std::string id,
+                               size_t count,
+                               const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -456,6 +489,12 @@ class ClientImpl final : public Client,
     return requests;
   }
 
+  // Groups the indices of the keys by shard (by hash slot in the cluster
+  // mode), so that the keys of a group fit into a single multi-key command
+  template <typename Func>
+  std::vector<std::vector<size_t>> GroupKeysBySlots(
+      size_t keys_count, Func&& get_key, const CommandControl& cc) const;
+
   CommandControl GetCommandControl(const CommandControl& cc) const;
 
   size_t GetPublishShard(PubShard policy);
@@ -467,6 +506,7 @@ class ClientImpl final : public Client,
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
   std::atomic<int> publish_shard_{0};
   const std::optional<size_t> force_shard_idx_;
+  const std::shared_ptr<HotKeys> hot_keys_;
 };
 
 }  // namespace storages::redis
@@ -102,6 +102,65 @@ UTEST_F(RedisClientTest, Mget) {
   EXPECT_EQ(*result[1], "bar");
 }
 
+UTEST_F(RedisClientTest, MgetMsetAcrossShards) {
+  auto client = GetClient();
+
+  const auto set_reply = client->MsetAcrossShards(
+      {{"key0", "foo"}, {"{tag}key1", "bar"}, {"{tag}key2", "baz"}}, {});
+  EXPECT_TRUE(set_reply.failed_keys.empty());
+
+  const auto reply = client->MgetAcrossShards(
+      {"{tag}key2", "missing", "key0", "{tag}key1"}, {});
+  EXPECT_TRUE(reply.failed_keys.empty());
+  ASSERT_EQ(reply.values.size(), 4);
+  EXPECT_EQ(reply.values[0], "baz");
+  EXPECT_EQ(reply.values[1], std::nullopt);
+  EXPECT_EQ(reply.values[2], "foo");
+  EXPECT_EQ(reply.values[3], "bar");
+}
+
+UTEST_F(RedisClientTest, StreamConsumerGroup) {
+  Version since{6, 2, 0};
+  if (!CheckVersion(since))
+    GTEST_SKIP() << SkipMsgByVersion("Xautoclaim", since);
+
+  auto client = GetClient();
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {}).Get(),
+            storages::redis::XgroupCreateReply::kCreated);
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {}).Get(),
+            storages::redis::XgroupCreateReply::kGroupExists);
+
+  EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer1", ">", 10, {})
+                  .Get()
+                  .entries.empty());
+
+  const auto id1 = client->Xadd("stream", {{"f1", "v1"}}, {}).Get();
+  const auto id2 =
+      client->Xadd("stream", {{"f2", "v2"}, {"f3", "v3"}}, {}).Get();
+
+  auto read =
+      client->Xreadgroup("stream", "group", "consumer1", ">", 10, {}).Get();
+  ASSERT_EQ(read.entries.size(), 2);
+  EXPECT_EQ(read.entries[0].id, id1);
+  EXPECT_EQ(read.entries[0].fields,
+            (std::vector<std::pair<std::string, std::string>>{{"f1", "v1"}}));
+  EXPECT_EQ(read.entries[1].id, id2);
+  EXPECT_EQ(read.entries[1].fields.size(), 2);
+
+  // the unacknowledged entry is claimed by another consumer
+  EXPECT_EQ(client->Xack("stream", "group", {id1}, {}).Get(), 1);
+  auto claim = client
+                   ->Xautoclaim("stream", "group", "consumer2",
+                                std::chrono::milliseconds{0}, "0-0", 10, {})
+                   .Get();
+  EXPECT_EQ(claim.next_id, "0-0");
+  ASSERT_EQ(claim.entries.size(), 1);
+  EXPECT_EQ(claim.entries[0].id, id2);
+
+  EXPECT_EQ(client->Xack("stream", "group", {id1, id2}, {}).Get(), 1);
+  EXPECT_EQ(client->Xack("stream", "group", {}, {}).Get(), 0);
+}
+
 UTEST_F(RedisClientTest, Unlink) {
   auto client = GetClient();
   client->Set("key0", "foo", {}).Get();
@@ -0,0 +1,118 @@
+#include <userver/storages/redis/client_side_cache.hpp>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::string_view kKeyspaceChannelPrefix = "__keyspace@";
+constexpr std::string_view kKeyspaceChannelDbEnd = "__:";
+
+// Keyspace notifications of all the databases for the keys with the prefix
+std::string MakeKeyspacePattern(std::string_view prefix) {
+  std::string pattern{kKeyspaceChannelPrefix};
+  pattern += '*';
+  pattern += kKeyspaceChannelDbEnd;
+  for (const char c : prefix) {
+    if (c == '*' || c == '?' || c == '[' || c == ']' || c == '\\') {
+      pattern += '\\';
+    }
+    pattern += c;
+  }
+  pattern += '*';
+  return pattern;
+}
+
+// `__keyspace@<db>__:<key>` -> `<key>`
+std::optional<std::string> ParseKeyspaceChannel(std::string_view channel) {
+  if (channel.substr(0, kKeyspaceChannelPrefix.size()) !=
+      kKeyspaceChannelPrefix) {
+    return std::nullopt;
+  }
+  const auto pos =
+      channel.find(kKeyspaceChannelDbEnd, kKeyspaceChannelPrefix.size());
+  if (pos == std::string_view::npos) return std::nullopt;
+  return std::string{channel.substr(pos + kKeyspaceChannelDbEnd.size())};
+}
+
+}  // namespace
+
+ClientSideCache::ClientSideCache(
+    std::shared_ptr<Client> client,
+    std::shared_ptr<SubscribeClient> subscribe_client,
+    const ClientSideCacheSettings& settings)
+    : client_{std::move(client)},
+      prefixes_{settings.prefixes},
+      cache_{settings.ways, settings.way_size} {
+  UASSERT(client_);
+  cache_.SetMaxLifetime(settings.lifetime);
+
+  if (!subscribe_client) return;
+  subscriptions_.reserve(prefixes_.size());
+  for (const auto& prefix : prefixes_) {
+    subscriptions_.push_back(subscribe_client->Psubscribe(
+        MakeKeyspacePattern(prefix),
+        [this](const std::string&, const std::string& channel,
+               const std::string&) { OnKeyspaceEvent(channel); }));
+  }
+}
+
+ClientSideCache::~ClientSideCache() {
+  for (auto& subscription : subscriptions_) subscription.Unsubscribe();
+}
+
+std::optional<std::string> ClientSideCache::Get(
+    std::string key, const CommandControl& command_control) {
+  if (!IsCached(key)) {
+    return client_->Get(std::move(key), command_control).Get();
+  }
+
+  // The update may run in a separate task that outlives the caller, so it
+  // owns everything it uses
+  return cache_.Get(key, [client = client_, command_control](
+                             const std::string& key) {
+    return client->Get(key, command_control).Get();
+  });
+}
+
+bool ClientSideCache::IsCached(std::string_view key) const {
+  for (const auto& prefix : prefixes_) {
+    if (key.substr(0, prefix.size()) == prefix) return true;
+  }
+  return false;
+}
+
+void ClientSideCache::Invalidate(const std::string& key) {
+  cache_.InvalidateByKey(key);
+}
+
+void ClientSideCache::InvalidateAll() { cache_.Invalidate(); }
+
+const cache::impl::ExpirableLruCacheStatistics& ClientSideCache::GetStatistics()
+    const {
+  return cache_.GetStatistics();
+}
+
+void ClientSideCache::OnKeyspaceEvent(const std::string& channel) {
+  auto key = ParseKeyspaceChannel(channel);
+  if (!key) {
+    LOG_LIMITED_WARNING() << "Unexpected keyspace channel " << channel;
+    return;
+  }
+  Invalidate(*key);
+}
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const ClientSideCache& cache) {
+  writer = cache.GetStatistics();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
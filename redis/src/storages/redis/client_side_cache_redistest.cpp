@@ -0,0 +1,81 @@
+#include <storages/redis/client_redistest.hpp>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/client_side_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::seconds kMaxWait{15};
+
+storages::redis::ClientSideCacheSettings MakeSettings() {
+  storages::redis::ClientSideCacheSettings settings;
+  settings.lifetime = std::chrono::hours{1};
+  settings.prefixes = {"cached:"};
+  return settings;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, ClientSideCache) {
+  auto client = GetClient();
+  client->Set("cached:key", "1", {}).Get();
+  client->Set("other_key", "1", {}).Get();
+
+  /// [ClientSideCache]
+  storages::redis::ClientSideCache cache{client, nullptr, MakeSettings()};
+  EXPECT_EQ(cache.Get("cached:key", {}), "1");
+
+  client->Set("cached:key", "2", {}).Get();
+  // the value is cached until the invalidation or the lifetime end
+  EXPECT_EQ(cache.Get("cached:key", {}), "1");
+  cache.Invalidate("cached:key");
+  EXPECT_EQ(cache.Get("cached:key", {}), "2");
+  /// [ClientSideCache]
+
+  // the absence of the value is cached as well
+  EXPECT_EQ(cache.Get("cached:missing", {}), std::nullopt);
+  client->Set("cached:missing", "3", {}).Get();
+  EXPECT_EQ(cache.Get("cached:missing", {}), std::nullopt);
+  cache.InvalidateAll();
+  EXPECT_EQ(cache.Get("cached:missing", {}), "3");
+
+  // the other keys are not cached
+  EXPECT_FALSE(cache.IsCached("other_key"));
+  EXPECT_EQ(cache.Get("other_key", {}), "1");
+  client->Set("other_key", "2", {}).Get();
+  EXPECT_EQ(cache.Get("other_key", {}), "2");
+}
+
+UTEST_F(RedisClientTest, ClientSideCacheKeyspaceInvalidation) {
+  auto reply = GetSentinel()
+                   ->MakeRequest({"config", "set", "notify-keyspace-events",
+                                  "KA"},
+                                 "none", true)
+                   .Get();
+  ASSERT_TRUE(reply->IsOk());
+
+  auto client = GetClient();
+  client->Set("cached:key", "0", {}).Get();
+
+  storages::redis::ClientSideCache cache{client, GetSubscribeClient(),
+                                         MakeSettings()};
+  EXPECT_EQ(cache.Get("cached:key", {}), "0");
+
+  // the subscription is established asynchronously, so the key is updated
+  // until the invalidation arrives
+  const auto deadline = engine::Deadline::FromDuration(kMaxWait);
+  for (int i = 1; !deadline.IsReached(); ++i) {
+    const auto value = std::to_string(i);
+    client->Set("cached:key", value, {}).Get();
+    engine::SleepFor(std::chrono::milliseconds{100});
+    if (cache.Get("cached:key", {}) == value) break;
+  }
+  EXPECT_FALSE(deadline.IsReached())
+      << "Keyspace notification was not received for " << kMaxWait.count()
+      << " seconds";
+}
+
+USERVER_NAMESPACE_END
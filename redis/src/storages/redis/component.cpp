@@ -28,6 +28,7 @@
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
 #include "client_impl.hpp"
+#include "hot_keys.hpp"
 #include "redis_secdist.hpp"
 #include "subscribe_client_impl.hpp"
 
@@ -69,6 +70,7 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  storages::redis::HotKeysSettings hot_keys;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -79,6 +81,8 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.hot_keys = value["hot_keys"].As<storages::redis::HotKeysSettings>(
+      storages::redis::HotKeysSettings{});
   return config;
 }
 
@@ -194,8 +198,14 @@ void Redis::Connect(const ComponentConfig& config,
         cc, testsuite_redis_control, dns_resolver);
     if (sentinel) {
       sentinels_.emplace(redis_group.db, sentinel);
-      const auto& client =
-          std::make_shared<storages::redis::ClientImpl>(sentinel);
+      std::shared_ptr<storages::redis::HotKeys> hot_keys;
+      if (redis_group.hot_keys.sample_rate > 0) {
+        hot_keys =
+            std::make_shared<storages::redis::HotKeys>(redis_group.hot_keys);
+        hot_keys_.emplace(redis_group.db, hot_keys);
+      }
+      const auto& client = std::make_shared<storages::redis::ClientImpl>(
+          sentinel, std::nullopt, std::move(hot_keys));
       clients_.emplace(redis_group.db, client);
     } else {
       LOG_WARNING() << "skip redis client for " << redis_group.db;
@@ -252,6 +262,9 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
     writer.ValueWithLabels(redis->GetStatistics(*settings),
                            {"redis_database", name});
   }
+  for (const auto& [name, hot_keys] : hot_keys_) {
+    writer["hot_keys"].ValueWithLabels(*hot_keys, {"redis_database", name});
+  }
   auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
   DumpThreadPoolMetric(threads_writer, *thread_pools_->GetRedisThreadPool());
   DumpThreadPoolMetric(threads_writer, thread_pools_->GetSentinelThreadPool());
@@ -341,17 +354,44 @@ properties:
                     description: name to refer to the cluster in components::Redis::GetClient()
                 sharding_strategy:
                     type: string
-                    description: one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver
+                    description: one of RedisCluster, KeyShardCrc32, KeyShardJumpConsistentHash, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver
                     defaultDescription: "KeyShardTaximeterCrc32"
                     enum:
                       - RedisCluster
                       - KeyShardCrc32
+                      - KeyShardJumpConsistentHash
                       - KeyShardTaximeterCrc32
                       - KeyShardGpsStorageDriver
                 allow_reads_from_master:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                hot_keys:
+                    type: object
+                    description: client side detector of the hot keys
+                    additionalProperties: false
+                    properties:
+                        sample_rate:
+                            type: integer
+                            description: each sample_rate-th command key is accounted, 0 disables the detector
+                            defaultDescription: 0
+                        top_size:
+                            type: integer
+                            description: count of the hottest keys that are tracked and exported
+                            defaultDescription: 16
+                            minimum: 1
+                        window:
+                            type: string
+                            description: hotness of the keys is estimated over the windows of this duration
+                            defaultDescription: 10s
+                        hot_threshold:
+                            type: integer
+                            description: estimated count of the commands per window that makes a key hot
+                            defaultDescription: 1000
+                        cache_lifetime:
+                            type: string
+                            description: lifetime of the locally cached GET values of the hot keys, 0 disables the cache
+                            defaultDescription: 0
     subscribe_groups:
         type: array
         description: array of redis clusters to work with in subscribe mode
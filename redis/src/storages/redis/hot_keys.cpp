@@ -0,0 +1,166 @@
+#include "hot_keys.hpp"
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::size_t kCacheWays = 4;
+
+}  // namespace
+
+HotKeysSettings Parse(const yaml_config::YamlConfig& value,
+                      formats::parse::To<HotKeysSettings>) {
+  HotKeysSettings settings;
+  settings.sample_rate = value["sample_rate"].As<std::size_t>(0);
+  settings.top_size = value["top_size"].As<std::size_t>(settings.top_size);
+  settings.window =
+      value["window"].As<std::chrono::milliseconds>(settings.window);
+  settings.hot_threshold =
+      value["hot_threshold"].As<std::size_t>(settings.hot_threshold);
+  settings.cache_lifetime =
+      value["cache_lifetime"].As<std::chrono::milliseconds>(
+          settings.cache_lifetime);
+  return settings;
+}
+
+SpaceSavingSketch::SpaceSavingSketch(std::size_t capacity)
+    : capacity_(capacity) {
+  UASSERT(capacity_ > 0);
+  counters_.reserve(capacity_);
+}
+
+void SpaceSavingSketch::Account(const std::string& key) {
+  const auto it = counters_.find(key);
+  if (it != counters_.end()) {
+    ++it->second.count;
+    return;
+  }
+
+  if (counters_.size() < capacity_) {
+    counters_.emplace(key, Estimate{1, 0});
+    return;
+  }
+
+  // The capacity is small, a linear search is cheaper than maintaining the
+  // order of the counters on each increment
+  const auto min_it = std::min_element(
+      counters_.begin(), counters_.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.count < rhs.second.count;
+      });
+  const auto min_count = min_it->second.count;
+  counters_.erase(min_it);
+  counters_.emplace(key, Estimate{min_count + 1, min_count});
+}
+
+std::vector<SpaceSavingSketch::Counter> SpaceSavingSketch::GetTop() const {
+  std::vector<Counter> result;
+  result.reserve(counters_.size());
+  for (const auto& [key, estimate] : counters_) {
+    result.push_back({key, estimate.count, estimate.error});
+  }
+  std::sort(result.begin(), result.end(),
+            [](const Counter& lhs, const Counter& rhs) {
+              return lhs.count > rhs.count;
+            });
+  return result;
+}
+
+void SpaceSavingSketch::Clear() { counters_.clear(); }
+
+HotKeys::HotKeys(const HotKeysSettings& settings)
+    : settings_(settings),
+      current_window_(settings.top_size),
+      window_end_(std::chrono::steady_clock::now() + settings.window) {
+  UASSERT(settings_.sample_rate > 0);
+  if (settings_.cache_lifetime.count() > 0) {
+    cache_.emplace(kCacheWays, settings_.top_size);
+    cache_->SetMaxLifetime(settings_.cache_lifetime);
+  }
+}
+
+void HotKeys::Account(const std::string& key) {
+  if (commands_.fetch_add(1, std::memory_order_relaxed) %
+          settings_.sample_rate !=
+      0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  RotateWindowIfNeeded(std::chrono::steady_clock::now());
+  current_window_.Account(key);
+}
+
+bool HotKeys::IsHot(const std::string& key) const {
+  const auto hot_keys = hot_keys_.Read();
+  return hot_keys->count(key) != 0;
+}
+
+std::optional<std::optional<std::string>> HotKeys::GetCached(
+    const std::string& key) {
+  if (!cache_) return std::nullopt;
+  return cache_->GetOptionalNoUpdate(key);
+}
+
+void HotKeys::PutCached(const std::string& key,
+                        const std::optional<std::string>& value) {
+  if (cache_) cache_->Put(key, value);
+}
+
+std::vector<SpaceSavingSketch::Counter> HotKeys::GetTop() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  RotateWindowIfNeeded(std::chrono::steady_clock::now());
+  return previous_top_;
+}
+
+const cache::impl::ExpirableLruCacheStatistics* HotKeys::GetCacheStatistics()
+    const {
+  return cache_ ? &cache_->GetStatistics() : nullptr;
+}
+
+void HotKeys::RotateWindowIfNeeded(
+    std::chrono::steady_clock::time_point now) const {
+  if (now < window_end_) return;
+
+  previous_top_.clear();
+  // The window is outdated if there were no commands for a whole window
+  if (now < window_end_ + settings_.window) {
+    previous_top_ = current_window_.GetTop();
+    for (auto& counter : previous_top_) {
+      counter.count *= settings_.sample_rate;
+      counter.error *= settings_.sample_rate;
+    }
+  }
+  current_window_.Clear();
+  window_end_ = now + settings_.window;
+
+  std::unordered_set<std::string> hot_keys;
+  for (const auto& counter : previous_top_) {
+    // the guaranteed count is used to avoid caching the evicted cold keys
+    if (counter.count - counter.error >= settings_.hot_threshold) {
+      hot_keys.insert(counter.key);
+    }
+  }
+  hot_keys_.Assign(std::move(hot_keys));
+}
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const HotKeys& hot_keys) {
+  auto keys_writer = writer["commands"];
+  for (const auto& counter : hot_keys.GetTop()) {
+    keys_writer.ValueWithLabels(counter.count, {"redis_key", counter.key});
+  }
+  if (const auto* cache_statistics = hot_keys.GetCacheStatistics()) {
+    writer["cache"] = *cache_statistics;
+  }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct HotKeysSettings final {
+  /// Each `sample_rate`-th command key is accounted, 0 disables the detector
+  std::size_t sample_rate{0};
+
+  /// Count of the hottest keys that are tracked and exported
+  std::size_t top_size{16};
+
+  /// Hotness of the keys is estimated over the windows of this duration
+  std::chrono::milliseconds window{std::chrono::seconds{10}};
+
+  /// Estimated count of the commands per window that makes a key hot
+  std::size_t hot_threshold{1000};
+
+  /// Lifetime of the locally cached GET values of the hot keys, zero
+  /// disables the cache
+  std::chrono::milliseconds cache_lifetime{0};
+};
+
+HotKeysSettings Parse(const yaml_config::YamlConfig& value,
+                      formats::parse::To<HotKeysSettings>);
+
+/// Space-Saving sketch of the most frequent keys: keeps `capacity` counters,
+/// a new key replaces the key with the least count and inherits its count as
+/// the error. Any key that is more frequent than 1/capacity of all the keys is
+/// guaranteed to be tracked.
+class SpaceSavingSketch final {
+ public:
+  struct Counter {
+    std::string key;
+    std::uint64_t count{0};
+    /// Upper bound of the overestimation of the count
+    std::uint64_t error{0};
+  };
+
+  explicit SpaceSavingSketch(std::size_t capacity);
+
+  void Account(const std::string& key);
+
+  /// Returns the counters sorted by the count in the descending order
+  std::vector<Counter> GetTop() const;
+
+  void Clear();
+
+ private:
+  struct Estimate {
+    std::uint64_t count{0};
+    std::uint64_t error{0};
+  };
+
+  const std::size_t capacity_;
+  std::unordered_map<std::string, Estimate> counters_;
+};
+
+/// Client side detector of the hot keys of a redis database with an optional
+/// short-living cache of GET values of the hot keys
+class HotKeys final {
+ public:
+  explicit HotKeys(const HotKeysSettings& settings);
+
+  /// Samples the key of a command
+  void Account(const std::string& key);
+
+  bool IsCacheEnabled() const { return cache_.has_value(); }
+
+  /// Returns true if the key was hot in the previous window
+  bool IsHot(const std::string& key) const;
+
+  /// Returns the cached GET value of a hot key if any
+  std::optional<std::optional<std::string>> GetCached(const std::string& key);
+
+  void PutCached(const std::string& key,
+                 const std::optional<std::string>& value);
+
+  /// Returns the hottest keys of the previous window with the estimated
+  /// counts of the commands
+  std::vector<SpaceSavingSketch::Counter> GetTop() const;
+
+  /// @cond
+  const cache::impl::ExpirableLruCacheStatistics* GetCacheStatistics() const;
+  /// @endcond
+
+ private:
+  void RotateWindowIfNeeded(std::chrono::steady_clock::time_point now) const;
+
+  const HotKeysSettings settings_;
+  std::atomic<std::uint64_t> commands_{0};
+
+  mutable std::mutex mutex_;
+  mutable SpaceSavingSketch current_window_;
+  mutable std::chrono::steady_clock::time_point window_end_;
+  mutable std::vector<SpaceSavingSketch::Counter> previous_top_;
+  mutable rcu::Variable<std::unordered_set<std::string>> hot_keys_;
+
+  std::optional<cache::ExpirableLruCache<std::string,
+                                         std::optional<std::string>>>
+      cache_;
+};
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const HotKeys& hot_keys);
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <storages/redis/hot_keys.hpp>
+
+#include <string>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::HotKeys;
+using storages::redis::HotKeysSettings;
+using storages::redis::SpaceSavingSketch;
+
+}  // namespace
+
+TEST(SpaceSavingSketch, TracksFrequentKeys) {
+  SpaceSavingSketch sketch{2};
+  for (int i = 0; i < 100; ++i) {
+    sketch.Account("hot");
+    sketch.Account("hot");
+    sketch.Account("cold" + std::to_string(i));
+  }
+
+  const auto top = sketch.GetTop();
+  ASSERT_EQ(top.size(), 2);
+  EXPECT_EQ(top[0].key, "hot");
+  EXPECT_EQ(top[0].count, 200);
+  EXPECT_EQ(top[0].error, 0);
+  EXPECT_EQ(top[1].key, "cold99");
+  EXPECT_EQ(top[1].count, 100);
+  EXPECT_EQ(top[1].error, 99);
+
+  sketch.Clear();
+  EXPECT_TRUE(sketch.GetTop().empty());
+}
+
+UTEST(HotKeys, PreviousWindow) {
+  HotKeysSettings settings;
+  settings.sample_rate = 1;
+  settings.top_size = 4;
+  settings.window = std::chrono::milliseconds{200};
+  settings.hot_threshold = 10;
+  HotKeys hot_keys{settings};
+
+  for (int i = 0; i < 20; ++i) hot_keys.Account("hot");
+  hot_keys.Account("cold");
+  EXPECT_TRUE(hot_keys.GetTop().empty());
+  EXPECT_FALSE(hot_keys.IsHot("hot"));
+
+  engine::SleepFor(std::chrono::milliseconds{250});
+  const auto top = hot_keys.GetTop();
+  ASSERT_EQ(top.size(), 2);
+  EXPECT_EQ(top[0].key, "hot");
+  EXPECT_EQ(top[0].count, 20);
+  EXPECT_TRUE(hot_keys.IsHot("hot"));
+  EXPECT_FALSE(hot_keys.IsHot("cold"));
+  EXPECT_FALSE(hot_keys.IsCacheEnabled());
+}
+
+UTEST(HotKeys, Cache) {
+  HotKeysSettings settings;
+  settings.sample_rate = 1;
+  settings.cache_lifetime = std::chrono::seconds{10};
+  HotKeys hot_keys{settings};
+  ASSERT_TRUE(hot_keys.IsCacheEnabled());
+
+  EXPECT_EQ(hot_keys.GetCached("key"), std::nullopt);
+  hot_keys.PutCached("key", "value");
+  hot_keys.PutCached("missing", std::nullopt);
+  EXPECT_EQ(hot_keys.GetCached("key"), std::optional<std::string>{"value"});
+  const auto missing = hot_keys.GetCached("missing");
+  ASSERT_TRUE(missing.has_value());
+  EXPECT_EQ(*missing, std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -219,6 +219,8 @@ CommandControl::Strategy StrategyFromString(const std::string& strategy) {
     return redis::CommandControl::Strategy::kLocalDcConductor;
   } else if (strategy == "nearest_server_ping") {
     return redis::CommandControl::Strategy::kNearestServerPing;
+  } else if (strategy == "least_loaded") {
+    return redis::CommandControl::Strategy::kLeastLoaded;
   } else {
     throw std::runtime_error(
         "Unknown strategy for redis::CommandControl::Strategy (" + strategy +
@@ -2,7 +2,6 @@
 
 #include <fmt/format.h>
 #include <atomic>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/rcu/rcu.hpp>
@@ -15,6 +14,7 @@
 #include <engine/ev/watcher/async_watcher.hpp>
 #include <engine/ev/watcher/periodic_watcher.hpp>
 #include <storages/redis/impl/cluster_topology.hpp>
+#include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/redis_connection_holder.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
@@ -30,15 +30,6 @@ bool CheckQuorum(size_t requests_sent, size_t responses_parsed) {
   return responses_parsed >= quorum;
 }
 
-size_t HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
   static const auto kUnknownShard = std::string("");
   size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -51,6 +51,8 @@ bool ClusterShard::AsyncCommand(CommandPtr command) {
   const auto with_masters =
       !read_only || command->control.allow_reads_from_master;
   const auto with_replicas = read_only;
+  const auto least_loaded =
+      command->control.strategy == CommandControl::Strategy::kLeastLoaded;
   const auto& available_servers = GetAvailableServers(
       master_, replicas_, command->control, with_masters, with_replicas);
 
@@ -59,7 +61,7 @@ bool ClusterShard::AsyncCommand(CommandPtr command) {
   RedisPtr instance;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
     const size_t skip_idx = (attempt == 0) ? command->instance_idx : -1;
-    instance = GetInstance(available_servers, skip_idx);
+    instance = GetInstance(available_servers, skip_idx, least_loaded);
     if (!instance) {
       continue;
     }
@@ -158,6 +160,7 @@ std::vector<std::shared_ptr<Redis>> ClusterShard::GetAvailableServers(
   switch (command_control.strategy) {
     case CommandControl::Strategy::kEveryDc:
     case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kLeastLoaded:
       break;
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing: {
@@ -169,7 +172,8 @@ std::vector<std::shared_ptr<Redis>> ClusterShard::GetAvailableServers(
 }
 
 ClusterShard::RedisPtr ClusterShard::GetInstance(
-    const std::vector<RedisPtr>& instances, size_t skip_idx) {
+    const std::vector<RedisPtr>& instances, size_t skip_idx,
+    bool least_loaded) {
   RedisPtr ret;
   const auto size = instances.size();
   const auto cur = ++current_;
@@ -184,7 +188,7 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
         (cur_inst->GetState() == Redis::State::kConnected) &&
         !cur_inst->IsSyncing() &&
         (!ret || ret->IsDestroying() ||
-         cur_inst->GetRunningCommands() < ret->GetRunningCommands())) {
+         IsLessLoaded(*cur_inst, *ret, least_loaded))) {
       ret = cur_inst;
     }
   }
@@ -59,7 +59,8 @@ class ClusterShard {
       const std::vector<RedisConnectionPtr>& replicas,
       const CommandControl& command_control, bool with_masters,
       bool with_slaves);
-  RedisPtr GetInstance(const std::vector<RedisPtr>& instances, size_t skip_idx);
+  RedisPtr GetInstance(const std::vector<RedisPtr>& instances, size_t skip_idx,
+                       bool least_loaded);
   bool IsMasterReady() const;
   bool IsReplicaReady() const;
 
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 #include <boost/algorithm/string/split.hpp>
@@ -52,6 +53,15 @@ void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len) {
   *key_len = end - start - 1;
 }
 
+size_t HashSlot(const std::string& key) {
+  size_t start = 0;
+  size_t len = 0;
+  GetRedisKey(key, &start, &len);
+  return std::for_each(key.data() + start, key.data() + start + len,
+                       boost::crc_optimal<16, 0x1021>())() &
+         0x3fff;
+}
+
 KeyShardTaximeterCrc32::KeyShardTaximeterCrc32(size_t shard_count)
     : shard_count_(shard_count),
       converter_(kRawKeyEncoding, kTaximeterCrcKeyEncoding) {}
@@ -67,6 +77,32 @@ size_t KeyShardCrc32::ShardByKey(const std::string& key) const {
          shard_count_;
 }
 
+size_t KeyShardJumpConsistentHash::ShardByKey(const std::string& key) const {
+  UASSERT(shard_count_ > 0);
+  size_t start = 0;
+  size_t len = 0;
+  GetRedisKey(key, &start, &len);
+
+  const std::uint32_t crc = std::for_each(key.data() + start,
+                                          key.data() + start + len,
+                                          boost::crc_32_type())();
+  // spread 32 bits of CRC over 64 bits consumed by the generator below
+  std::uint64_t state = crc * 0x9E3779B97F4A7C15ULL;
+
+  std::int64_t bucket = -1;
+  std::int64_t next = 0;
+  const auto shard_count = static_cast<std::int64_t>(shard_count_);
+  while (next < shard_count) {
+    bucket = next;
+    state = state * 2862933555777941757ULL + 1;
+    next = static_cast<std::int64_t>(
+        static_cast<double>(bucket + 1) *
+        (static_cast<double>(1LL << 31) /
+         static_cast<double>((state >> 33) + 1)));
+  }
+  return static_cast<size_t>(bucket);
+}
+
 bool KeyShardTaximeterCrc32::NeedConvertEncoding(const std::string& key,
                                                  size_t start, size_t len) {
   for (size_t i = 0; i < len; i++)
@@ -118,6 +154,8 @@ std::unique_ptr<redis::KeyShard> KeyShardFactory::operator()(size_t nshards) {
     return std::make_unique<redis::KeyShardTaximeterCrc32>(nshards);
   if (type_ == KeyShardCrc32::kName)
     return std::make_unique<redis::KeyShardCrc32>(nshards);
+  if (type_ == KeyShardJumpConsistentHash::kName)
+    return std::make_unique<redis::KeyShardJumpConsistentHash>(nshards);
   if (type_ == kRedisCluster) return nullptr;
 
   return std::make_unique<redis::KeyShardTaximeterCrc32>(nshards);
@@ -29,6 +29,22 @@ class KeyShardCrc32 : public KeyShard {
   size_t shard_count_ = 0;
 };
 
+/// Jump consistent hash (https://arxiv.org/abs/1406.2294) of CRC32 of the
+/// key: on appending a shard to the end of the shards list only ~1/N of the
+/// keys move, all of them to the new shard.
+class KeyShardJumpConsistentHash : public KeyShard {
+ public:
+  KeyShardJumpConsistentHash(size_t shard_count) : shard_count_(shard_count) {}
+
+  static constexpr char kName[] = "KeyShardJumpConsistentHash";
+
+  size_t ShardByKey(const std::string& key) const override;
+  bool IsGenerateKeysForShardsEnabled() const override { return true; }
+
+ private:
+  size_t shard_count_ = 0;
+};
+
 class KeyShardTaximeterCrc32 : public KeyShard {
  public:
   KeyShardTaximeterCrc32(size_t shard_count);
@@ -58,6 +74,9 @@ class KeyShardGpsStorageDriver : public redis::KeyShard {
 
 inline constexpr char kRedisCluster[] = "RedisCluster";
 
+// Returns the redis cluster hash slot of the key
+size_t HashSlot(const std::string& key);
+
 bool IsClusterStrategy(const std::string& type);
 
 }  // namespace redis
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -82,4 +83,35 @@ TEST(KeyShardTaximeterCrc32, Multithreads) {
   EXPECT_EQ(kCount, counts[key_shard.ShardByKey(kKey)]);
 }
 
+TEST(KeyShardJumpConsistentHash, AddShard) {
+  const redis::KeyShardJumpConsistentHash key_shard(kShards);
+  const redis::KeyShardJumpConsistentHash key_shard_added(kShards + 1);
+
+  std::vector<size_t> counts(kShards, 0);
+  size_t moved = 0;
+  for (size_t i = 0; i < kCount; ++i) {
+    const auto key = "key" + std::to_string(i);
+    const auto shard = key_shard.ShardByKey(key);
+    ASSERT_LT(shard, kShards);
+    ++counts[shard];
+
+    const auto shard_added = key_shard_added.ShardByKey(key);
+    if (shard_added != shard) {
+      // keys only move to the new shard
+      EXPECT_EQ(shard_added, kShards);
+      ++moved;
+    }
+  }
+
+  for (const auto count : counts) {
+    EXPECT_GT(count, kCount / kShards / 2);
+    EXPECT_LT(count, kCount / kShards * 2);
+  }
+  EXPECT_GT(moved, kCount / (kShards + 1) / 2);
+  EXPECT_LT(moved, kCount / (kShards + 1) * 2);
+
+  // hash tags are respected
+  EXPECT_EQ(key_shard.ShardByKey("{tag}a"), key_shard.ShardByKey("{tag}b"));
+}
+
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <iterator>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -25,6 +26,7 @@
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_objects.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -36,6 +38,7 @@ namespace {
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
 const size_t kMissedPingStreakThresholdDefault = 3;
+const double kMinLatencyEstimateMs = 0.1;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
 // instead of sending PING commands which are not supported by hiredis in
@@ -180,6 +183,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                            int revents) noexcept;
   static void CommandLoopOnTimer(struct ev_loop* loop, ev_timer* w,
                                  int revents) noexcept;
+  static void OnSendRestCommands(struct ev_loop* loop, ev_async* w,
+                                 int revents) noexcept;
   static void OnRedisReply(redisAsyncContext* c, void* r,
                            void* privdata) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
@@ -273,6 +278,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   ev_timer info_timer_{};
   ev_timer watch_command_timer_{};
   ev_async watch_command_{};
+  ev_async send_rest_commands_{};
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
   std::atomic_bool enable_replication_monitoring_ = false;
   std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
@@ -356,6 +362,17 @@ std::chrono::milliseconds Redis::GetPingLatency() const {
   return impl_->GetPingLatency();
 }
 
+double Redis::GetLoadEstimate() const {
+  return EstimateLoad(
+      GetRunningCommands(),
+      GetStatistics().latency_ewma_ms.load(std::memory_order_relaxed));
+}
+
+double EstimateLoad(size_t running_commands, double latency_ewma_ms) {
+  const auto latency_ms = std::max(latency_ewma_ms, kMinLatencyEstimateMs);
+  return static_cast<double>(running_commands + 1) * latency_ms;
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -406,6 +423,10 @@ void Redis::RedisImpl::Attach() {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_async_init(&watch_command_, OnNewCommand);
 
+  send_rest_commands_.data = this;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_async_init(&send_rest_commands_, OnSendRestCommands);
+
   watch_command_timer_.data = this;
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_timer_init(&watch_command_timer_, CommandLoopOnTimer, 0.0, 0.0);
@@ -425,6 +446,7 @@ void Redis::RedisImpl::Detach() {
   if (!attached_) return;
 
   ev_thread_control_.Stop(watch_command_);
+  ev_thread_control_.Stop(send_rest_commands_);
   ev_thread_control_.Stop(watch_command_timer_);
   ev_thread_control_.Stop(ping_timer_);
   ev_thread_control_.Stop(info_timer_);
@@ -469,6 +491,8 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
     context_ = nullptr;
     return false;
   }
+  // the replies are built so that ReplyData takes the strings over
+  context_->c.reader->fn = &GetReplyObjectFunctions();
 
   ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
     bool err = false;
@@ -835,6 +859,7 @@ void Redis::RedisImpl::SetState(State state) {
   if (state == State::kConnected) {
     ev_thread_control_.RunInEvLoopBlocking([this] {
       ev_thread_control_.Start(watch_command_);
+      ev_thread_control_.Start(send_rest_commands_);
       ev_thread_control_.Start(ping_timer_);
       ev_thread_control_.Start(info_timer_);
     });
@@ -911,19 +936,49 @@ void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w,
   }
 }
 
+void Redis::RedisImpl::OnSendRestCommands(struct ev_loop*, ev_async* w,
+                                          int) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(w->data);
+  UASSERT(impl != nullptr);
+  try {
+    impl->CommandLoopImpl();
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "CommandLoopImpl() failed: " << ex;
+  }
+}
+
 void Redis::RedisImpl::CommandLoopImpl() {
   if (WatchCommandTimerEnabled(*commands_buffering_settings_.Get())) {
     if (std::exchange(watch_command_timer_started_, false)) {
       ev_thread_control_.Stop(watch_command_timer_);
     }
   }
+  const auto max_batch_size =
+      commands_buffering_settings_.Get()->max_batch_size;
   std::deque<CommandPtr> commands;
+  bool has_more_commands = false;
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
-    commands_size_ -= commands_.size();
-    std::swap(commands_, commands);
+    if (!max_batch_size || commands_.size() <= max_batch_size) {
+      std::swap(commands_, commands);
+    } else {
+      const auto batch_end = commands_.begin() + max_batch_size;
+      commands.assign(std::make_move_iterator(commands_.begin()),
+                      std::make_move_iterator(batch_end));
+      commands_.erase(commands_.begin(), batch_end);
+      has_more_commands = true;
+    }
+    commands_size_ -= commands.size();
   }
+  // the rest of the commands are sent at the next event loop iteration,
+  // bypassing the buffering timer that has already expired for them
+  if (has_more_commands) ev_thread_control_.Send(send_rest_commands_);
+
   LOG_TRACE() << "commands size=" << commands.size();
+  if (commands.empty()) return;
+  // hiredis buffers the commands until the event loop writes them to the
+  // socket, so the whole batch is sent at once
+  statistics_.AccountBatchSent(commands.size());
   for (auto& command : commands) {
     ProcessCommand(command);
   }
@@ -1115,9 +1170,10 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   ev_thread_control_.Stop(data->second->timer);
   pcommand = data->second.get();
 
-  auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply,
+  auto reply = std::make_shared<Reply>(pcommand->cmd, nullptr,
                                        NativeToReplyStatus(status),
                                        errstr ? errstr : "");
+  reply->data = TakeReplyData(redis_reply);
 
   // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
   // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -40,6 +40,9 @@ class Redis {
   bool AsyncCommand(const CommandPtr& command);
   size_t GetRunningCommands() const;
   std::chrono::milliseconds GetPingLatency() const;
+  // Running commands count multiplied by the average latency of the recent
+  // replies, used by CommandControl::Strategy::kLeastLoaded
+  double GetLoadEstimate() const;
   bool IsDestroying() const;
   std::string GetServerHost() const;
   uint16_t GetServerPort() const;
@@ -65,6 +68,21 @@ class Redis {
   std::shared_ptr<RedisImpl> impl_;
 };
 
+// Running commands count multiplied by the average latency of the recent
+// replies, an instance without replies yet is not considered free of load
+double EstimateLoad(size_t running_commands, double latency_ewma_ms);
+
+// Whether the instance choice of a shard prefers `candidate` over `current`:
+// by the load estimate for CommandControl::Strategy::kLeastLoaded and by the
+// running commands count otherwise
+template <typename Instance>
+bool IsLessLoaded(const Instance& candidate, const Instance& current,
+                  bool least_loaded) {
+  return least_loaded
+             ? candidate.GetLoadEstimate() < current.GetLoadEstimate()
+             : candidate.GetRunningCommands() < current.GetRunningCommands();
+}
+
 template <typename Rep, typename Period>
 double ToEvDuration(const std::chrono::duration<Rep, Period>& duration) {
   return std::chrono::duration_cast<std::chrono::duration<double>>(duration)
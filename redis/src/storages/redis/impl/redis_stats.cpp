@@ -15,6 +15,9 @@ namespace redis {
 
 namespace {
 
+// weight of the previous value in the replies latency EWMA
+constexpr double kLatencyEwmaExp = 0.8;
+
 const std::string_view kCommandTypes[] = {
     "append",
     "auth",
@@ -130,6 +133,10 @@ void Statistics::AccountCommandSent(const CommandPtr& cmd) {
   }
 }
 
+void Statistics::AccountBatchSent(size_t commands_count) {
+  batch_size_percentile.GetCurrentCounter().Account(commands_count);
+}
+
 void Statistics::AccountReplyReceived(const ReplyPtr& reply,
                                       const CommandPtr& cmd) {
   reply_size_percentile.GetCurrentCounter().Account(reply->data.GetSize());
@@ -138,6 +145,12 @@ void Statistics::AccountReplyReceived(const ReplyPtr& reply,
   auto ms =
       std::chrono::duration_cast<std::chrono::milliseconds>(delta).count();
   timings_percentile.GetCurrentCounter().Account(ms);
+  const auto delta_ms =
+      std::chrono::duration<double, std::milli>(delta).count();
+  latency_ewma_ms.store(
+      latency_ewma_ms.load(std::memory_order_relaxed) * kLatencyEwmaExp +
+          delta_ms * (1 - kLatencyEwmaExp),
+      std::memory_order_relaxed);
   auto command_timings = command_timings_percentile.find(cmd->GetName());
   if (command_timings != command_timings_percentile.end()) {
     command_timings->second.GetCurrentCounter().Account(ms);
@@ -168,6 +181,7 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   if (stats.settings.request_sizes_enabled) {
     writer["request_sizes"] = stats.request_size_percentile;
+    writer["batch_sizes"] = stats.batch_size_percentile;
   }
   if (stats.settings.reply_sizes_enabled) {
     writer["reply_sizes"] = stats.reply_size_percentile;
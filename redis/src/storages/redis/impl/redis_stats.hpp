@@ -32,6 +32,7 @@ class Statistics {
 
   void AccountStateChanged(RedisState new_state);
   void AccountCommandSent(const CommandPtr& cmd);
+  void AccountBatchSent(size_t commands_count);
   void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
   void AccountPing(std::chrono::milliseconds ping);
   void AccountError(ReplyStatus code);
@@ -46,9 +47,12 @@ class Statistics {
   std::atomic<std::chrono::milliseconds> session_start_time{};
   RecentPeriod request_size_percentile;
   RecentPeriod reply_size_percentile;
+  RecentPeriod batch_size_percentile;
   RecentPeriod timings_percentile;
   std::unordered_map<std::string_view, RecentPeriod> command_timings_percentile;
   std::atomic_llong last_ping_ms{};
+  // written by the ev thread only
+  std::atomic<double> latency_ewma_ms{0.0};
   std::atomic_bool is_syncing = false;
   std::atomic_size_t offset_from_master_bytes = 0;
 
@@ -65,6 +69,7 @@ struct InstanceStatistics {
         request_size_percentile(
             other.request_size_percentile.GetStatsForPeriod()),
         reply_size_percentile(other.reply_size_percentile.GetStatsForPeriod()),
+        batch_size_percentile(other.batch_size_percentile.GetStatsForPeriod()),
         timings_percentile(other.timings_percentile.GetStatsForPeriod()),
         last_ping_ms(other.last_ping_ms.load(std::memory_order_relaxed)),
         is_syncing(other.is_syncing.load(std::memory_order_relaxed)),
@@ -86,6 +91,7 @@ struct InstanceStatistics {
     reconnects += other.reconnects;
     request_size_percentile.Add(other.request_size_percentile);
     reply_size_percentile.Add(other.reply_size_percentile);
+    batch_size_percentile.Add(other.batch_size_percentile);
     timings_percentile.Add(other.timings_percentile);
 
     for (size_t i = 0; i < error_count.size(); i++)
@@ -101,6 +107,7 @@ struct InstanceStatistics {
   std::chrono::milliseconds session_start_time;
   Statistics::Percentile request_size_percentile;
   Statistics::Percentile reply_size_percentile;
+  Statistics::Percentile batch_size_percentile;
   Statistics::Percentile timings_percentile;
   std::unordered_map<std::string, Statistics::Percentile>
       command_timings_percentile;
@@ -0,0 +1,167 @@
+#include <storages/redis/impl/reply_objects.hpp>
+
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+namespace {
+
+#if HIREDIS_MAJOR >= 1
+using ElementsCount = size_t;
+#else
+using ElementsCount = int;
+#endif
+
+struct ReplyObject final {
+  // must be the first member, hiredis treats the objects as redisReply
+  redisReply reply{};
+  std::string str;
+  std::vector<redisReply*> elements;
+
+  ~ReplyObject();
+};
+
+static_assert(std::is_standard_layout_v<ReplyObject>);
+
+ReplyObject* FromReply(redisReply* reply) {
+  // the first member of a standard layout object shares its address
+  return reinterpret_cast<ReplyObject*>(reply);
+}
+
+ReplyObject::~ReplyObject() {
+  for (auto* element : elements) delete FromReply(element);
+}
+
+// hiredis reports the out of memory error when nullptr is returned
+template <typename Fill>
+void* CreateObject(const redisReadTask* task, Fill&& fill) noexcept {
+  try {
+    auto object = std::make_unique<ReplyObject>();
+    object->reply.type = task->type;
+    fill(*object);
+    if (task->parent) {
+      auto* parent = FromReply(static_cast<redisReply*>(task->parent->obj));
+      UASSERT(static_cast<size_t>(task->idx) < parent->elements.size());
+      parent->elements[task->idx] = &object->reply;
+    }
+    return &object.release()->reply;
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) {
+  return CreateObject(task, [str, len](ReplyObject& object) {
+    object.str.assign(str, len);
+    object.reply.str = object.str.data();
+    object.reply.len = len;
+  });
+}
+
+void* CreateArray(const redisReadTask* task, ElementsCount elements) {
+  return CreateObject(task, [elements](ReplyObject& object) {
+    // the children are attached by index, the storage is never reallocated
+    object.elements.resize(elements, nullptr);
+    object.reply.element = object.elements.data();
+    object.reply.elements = elements;
+  });
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) {
+  return CreateObject(
+      task, [value](ReplyObject& object) { object.reply.integer = value; });
+}
+
+void* CreateNil(const redisReadTask* task) {
+  return CreateObject(task, [](ReplyObject&) {});
+}
+
+#if HIREDIS_MAJOR >= 1
+// RESP3 is not requested, such replies are kept as the unknown ones
+void* CreateDouble(const redisReadTask* task, double value, char* str,
+                   size_t len) {
+  return CreateObject(task, [value, str, len](ReplyObject& object) {
+    object.str.assign(str, len);
+    object.reply.str = object.str.data();
+    object.reply.len = len;
+    object.reply.dval = value;
+  });
+}
+
+void* CreateBool(const redisReadTask* task, int value) {
+  return CreateObject(
+      task, [value](ReplyObject& object) { object.reply.integer = value; });
+}
+#endif
+
+void FreeObject(void* reply) {
+  delete FromReply(static_cast<redisReply*>(reply));
+}
+
+redisReplyObjectFunctions MakeReplyObjectFunctions() {
+  redisReplyObjectFunctions functions{};
+  functions.createString = &CreateString;
+  functions.createArray = &CreateArray;
+  functions.createInteger = &CreateInteger;
+  functions.createNil = &CreateNil;
+#if HIREDIS_MAJOR >= 1
+  functions.createDouble = &CreateDouble;
+  functions.createBool = &CreateBool;
+#endif
+  functions.freeObject = &FreeObject;
+  return functions;
+}
+
+std::string TakeString(ReplyObject& object) {
+  object.reply.str = nullptr;
+  object.reply.len = 0;
+  return std::move(object.str);
+}
+
+}  // namespace
+
+redisReplyObjectFunctions& GetReplyObjectFunctions() {
+  static auto functions = MakeReplyObjectFunctions();
+  return functions;
+}
+
+ReplyData TakeReplyData(redisReply* reply) {
+  if (!reply) return ReplyData{static_cast<const redisReply*>(nullptr)};
+
+  auto& object = *FromReply(reply);
+  switch (reply->type) {
+    case REDIS_REPLY_STRING:
+      return ReplyData{TakeString(object)};
+    case REDIS_REPLY_ARRAY: {
+      ReplyData::Array array;
+      array.reserve(object.elements.size());
+      for (auto* element : object.elements) {
+        array.push_back(TakeReplyData(element));
+      }
+      return ReplyData{std::move(array)};
+    }
+    case REDIS_REPLY_INTEGER:
+      return ReplyData::CreateInteger(reply->integer);
+    case REDIS_REPLY_NIL:
+      return ReplyData::CreateNil();
+    case REDIS_REPLY_STATUS:
+      return ReplyData::CreateStatus(TakeString(object));
+    case REDIS_REPLY_ERROR:
+      return ReplyData::CreateError(TakeString(object));
+    default:
+      return ReplyData{static_cast<const redisReply*>(nullptr)};
+  }
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+struct redisReply;
+struct redisReplyObjectFunctions;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+// hiredis reply object functions that keep the strings of the replies in
+// std::string, so that TakeReplyData() moves them into ReplyData instead of
+// copying. The objects are redisReply compatible, hiredis reads them as such.
+redisReplyObjectFunctions& GetReplyObjectFunctions();
+
+// Moves the data out of the reply created by GetReplyObjectFunctions(),
+// the reply is still to be freed by hiredis.
+ReplyData TakeReplyData(redisReply* reply);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <storages/redis/impl/reply_objects.hpp>
+
+#include <memory>
+#include <string_view>
+
+#include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+redis::ReplyData Parse(std::string_view resp) {
+  auto& functions = redis::GetReplyObjectFunctions();
+  const std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader{
+      redisReaderCreateWithFunctions(&functions), &redisReaderFree};
+  EXPECT_EQ(redisReaderFeed(reader.get(), resp.data(), resp.size()),
+            REDIS_OK);
+
+  void* reply = nullptr;
+  EXPECT_EQ(redisReaderGetReply(reader.get(), &reply), REDIS_OK);
+  EXPECT_NE(reply, nullptr);
+  auto data = redis::TakeReplyData(static_cast<redisReply*>(reply));
+  functions.freeObject(reply);
+  return data;
+}
+
+}  // namespace
+
+TEST(ReplyObjects, Scalars) {
+  EXPECT_EQ(Parse("$5\r\nvalue\r\n").GetString(), "value");
+  EXPECT_EQ(Parse("$0\r\n\r\n").GetString(), "");
+  EXPECT_EQ(Parse(":-9000000000\r\n").GetInt(), -9000000000);
+  EXPECT_TRUE(Parse("$-1\r\n").IsNil());
+  EXPECT_EQ(Parse("+OK\r\n").GetStatus(), "OK");
+  EXPECT_EQ(Parse("-ERR wrong type\r\n").GetError(), "ERR wrong type");
+}
+
+TEST(ReplyObjects, NestedArrays) {
+  const std::string long_value(100'000, 'x');
+  const auto data =
+      Parse("*3\r\n$3\r\nkey\r\n*2\r\n:1\r\n$-1\r\n$100000\r\n" + long_value +
+            "\r\n");
+
+  ASSERT_TRUE(data.IsArray());
+  ASSERT_EQ(data.GetSize(), 3);
+  EXPECT_EQ(data[0].GetString(), "key");
+  ASSERT_TRUE(data[1].IsArray());
+  ASSERT_EQ(data[1].GetSize(), 2);
+  EXPECT_EQ(data[1][0].GetInt(), 1);
+  EXPECT_TRUE(data[1][1].IsNil());
+  EXPECT_EQ(data[2].GetString(), long_value);
+}
+
+TEST(ReplyObjects, PartialFeeds) {
+  auto& functions = redis::GetReplyObjectFunctions();
+  const std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader{
+      redisReaderCreateWithFunctions(&functions), &redisReaderFree};
+
+  const std::string_view resp = "*2\r\n$5\r\nfirst\r\n$6\r\nsecond\r\n";
+  void* reply = nullptr;
+  for (const char c : resp) {
+    ASSERT_EQ(reply, nullptr);
+    ASSERT_EQ(redisReaderFeed(reader.get(), &c, 1), REDIS_OK);
+    ASSERT_EQ(redisReaderGetReply(reader.get(), &reply), REDIS_OK);
+  }
+  ASSERT_NE(reply, nullptr);
+
+  const auto data = redis::TakeReplyData(static_cast<redisReply*>(reply));
+  functions.freeObject(reply);
+  ASSERT_EQ(data.GetSize(), 2);
+  EXPECT_EQ(data[0].GetString(), "first");
+  EXPECT_EQ(data[1].GetString(), "second");
+}
+
+USERVER_NAMESPACE_END
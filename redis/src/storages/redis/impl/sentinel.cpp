@@ -12,6 +12,7 @@
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/exception.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
+#include <userver/testsuite/perf_counters.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
@@ -225,6 +226,7 @@ void Sentinel::AsyncCommand(CommandPtr command, bool master, size_t shard) {
           " != " + std::to_string(*command->control.force_shard_idx) + ')');
   }
   CheckShardIdx(shard);
+  testsuite::AccountPerfCounter("redis-commands", command->args.args.size());
   try {
     impl_->AsyncCommand(
         {command, master, shard, std::chrono::steady_clock::now()},
@@ -250,6 +252,7 @@ void Sentinel::AsyncCommand(CommandPtr command, const std::string& key,
   }
 
   CheckShardIdx(shard);
+  testsuite::AccountPerfCounter("redis-commands", command->args.args.size());
   try {
     impl_->AsyncCommand(
         {command, master, shard, std::chrono::steady_clock::now()},
@@ -302,6 +305,8 @@ void Sentinel::CheckShardIdx(size_t shard_idx, size_t shard_count) {
                                    " >= " + std::to_string(shard_count) + ')');
 }
 
+bool Sentinel::IsInClusterMode() const { return impl_->IsInClusterMode(); }
+
 const std::string& Sentinel::GetAnyKeyForShard(size_t shard_idx) const {
   return impl_->GetAnyKeyForShard(shard_idx);
 }
@@ -116,6 +116,7 @@ class Sentinel {
   size_t ShardsCount() const;
   void CheckShardIdx(size_t shard_idx) const;
   static void CheckShardIdx(size_t shard_idx, size_t shard_count);
+  bool IsInClusterMode() const;
 
   // Returns a non-empty key of the minimum length consisting of lowercase
   // letters for a given shard.
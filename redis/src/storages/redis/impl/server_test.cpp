@@ -1,5 +1,6 @@
 #include "mock_server_test.hpp"
 
+#include <atomic>
 #include <thread>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -152,6 +153,43 @@ TEST(Redis, PingFail) {
   PeriodicWait([&] { return !IsConnected(*redis); });
 }
 
+TEST(Redis, MaxBatchSize) {
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto get_handler = server.RegisterNilReplyHandler("GET");
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  redis::RedisCreationSettings redis_settings;
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              redis_settings);
+  redis::CommandsBufferingSettings buffering_settings;
+  buffering_settings.buffering_enabled = true;
+  buffering_settings.commands_buffering_threshold = 5;
+  // only the threshold may flush the commands during the test
+  buffering_settings.watch_command_timer_interval = std::chrono::minutes{1};
+  buffering_settings.max_batch_size = 2;
+  redis->SetCommandsBufferingSettings(buffering_settings);
+  redis->Connect({kLocalhost}, server.GetPort(), redis::Password(""));
+
+  EXPECT_TRUE(ping_handler->WaitForFirstReply(kSmallPeriod));
+  PeriodicWait([&] { return IsConnected(*redis); });
+
+  std::atomic<int> replies{0};
+  for (int i = 0; i < 5; ++i) {
+    redis->AsyncCommand(redis::PrepareCommand(
+        {"GET", "123"},
+        [&replies](const redis::CommandPtr&, redis::ReplyPtr) { ++replies; }));
+  }
+
+  // the commands above the batch size do not wait for the buffering timer
+  PeriodicWait([&] { return replies == 5; });
+  using Duration = redis::Statistics::RecentPeriod::Duration;
+  const auto batch_sizes =
+      redis->GetStatistics().batch_size_percentile.GetStatsForPeriod(
+          Duration::min(), /*with_current_epoch=*/true);
+  EXPECT_EQ(2, batch_sizes.GetPercentile(100));
+}
+
 class RedisDisconnectingReplies : public ::testing::TestWithParam<const char*> {
 };
 
@@ -123,7 +123,8 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 
   switch (command_control.strategy) {
     case CommandControl::Strategy::kEveryDc:
-    case CommandControl::Strategy::kDefault: {
+    case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kLeastLoaded: {
       std::vector<unsigned char> result(instances_.size(), 0);
       for (size_t i = 0; i < instances_.size(); i++) {
         result[i] =
@@ -179,7 +180,7 @@ std::vector<unsigned char> Shard::GetNearestServersPing(
 std::shared_ptr<Redis> Shard::GetInstance(
     const std::vector<unsigned char>& available_servers,
     bool may_fallback_to_any, size_t skip_idx, bool read_only,
-    size_t* pinstance_idx) {
+    bool least_loaded, size_t* pinstance_idx) {
   std::shared_ptr<Redis> instance;
 
   auto end = instances_.size();
@@ -197,7 +198,7 @@ std::shared_ptr<Redis> Shard::GetInstance(
         (cur_inst->GetState() == Redis::State::kConnected) &&
         !cur_inst->IsSyncing() &&
         (!instance || instance->IsDestroying() ||
-         cur_inst->GetRunningCommands() < instance->GetRunningCommands())) {
+         IsLessLoaded(*cur_inst, *instance, least_loaded))) {
       if (pinstance_idx) *pinstance_idx = instance_idx;
       instance = cur_inst;
     }
@@ -232,6 +233,8 @@ bool Shard::AsyncCommand(CommandPtr command) {
       !command->read_only || command->control.allow_reads_from_master,
       command->read_only);
 
+  const auto least_loaded =
+      command->control.strategy == CommandControl::Strategy::kLeastLoaded;
   auto max_attempts = instances_.size() + 1;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
     size_t skip_idx = (attempt == 0) ? command->instance_idx : -1;
@@ -245,7 +248,7 @@ bool Shard::AsyncCommand(CommandPtr command) {
         attempt != 0 && command->control.force_server_id.IsAny();
 
     instance = GetInstance(available_servers, may_fallback_to_any, skip_idx,
-                           command->read_only, &idx);
+                           command->read_only, least_loaded, &idx);
     command->instance_idx = idx;
 
     if (instance) {
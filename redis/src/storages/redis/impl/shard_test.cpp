@@ -0,0 +1,61 @@
+#include <storages/redis/impl/redis.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct FakeInstance {
+  std::size_t running_commands;
+  double latency_ewma_ms;
+
+  std::size_t GetRunningCommands() const { return running_commands; }
+  double GetLoadEstimate() const {
+    return redis::EstimateLoad(running_commands, latency_ewma_ms);
+  }
+};
+
+// The choice of Shard::GetInstance() and ClusterShard::GetInstance() among
+// the connected instances
+std::size_t Choose(const std::vector<FakeInstance>& instances,
+                   bool least_loaded) {
+  std::size_t chosen = 0;
+  for (std::size_t i = 1; i < instances.size(); ++i) {
+    if (redis::IsLessLoaded(instances[i], instances[chosen], least_loaded)) {
+      chosen = i;
+    }
+  }
+  return chosen;
+}
+
+}  // namespace
+
+TEST(ShardLeastLoaded, PrefersFasterInstance) {
+  // the first one has fewer commands in flight, but replies 10 times slower
+  const std::vector<FakeInstance> instances{{2, 50.0}, {4, 5.0}, {8, 5.0}};
+
+  EXPECT_EQ(Choose(instances, /*least_loaded=*/true), 1);
+  EXPECT_EQ(Choose(instances, /*least_loaded=*/false), 0);
+}
+
+TEST(ShardLeastLoaded, EqualLatency) {
+  const std::vector<FakeInstance> instances{{3, 1.0}, {1, 1.0}, {2, 1.0}};
+
+  EXPECT_EQ(Choose(instances, /*least_loaded=*/true), 1);
+  EXPECT_EQ(Choose(instances, /*least_loaded=*/false), 1);
+}
+
+TEST(ShardLeastLoaded, NoRepliesYet) {
+  // an instance without the latency estimate is not free of load
+  EXPECT_GT(redis::EstimateLoad(0, 0.0), 0.0);
+  EXPECT_LT(redis::EstimateLoad(1, 0.0), redis::EstimateLoad(5, 0.0));
+
+  const std::vector<FakeInstance> instances{{5, 0.0}, {1, 0.0}};
+  EXPECT_EQ(Choose(instances, /*least_loaded=*/true), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/storages/redis/parse_reply.hpp>
 
+#include <iterator>
+
 #include <userver/storages/redis/reply.hpp>
 #include <userver/utils/from_string.hpp>
 
@@ -10,6 +12,7 @@ namespace {
 
 const std::string kOk{"OK"};
 const std::string kPong{"PONG"};
+const std::string kBusyGroup{"BUSYGROUP"};
 
 std::string ExtractStringElem(ReplyData& array_data, size_t elem_idx,
                               const std::string& request_description) {
@@ -65,6 +68,29 @@ Point ParsePointArray(const redis::ReplyData& elem,
   }
 }
 
+StreamEntry ParseStreamEntry(ReplyData& entry_data,
+                             const std::string& request_description) {
+  entry_data.ExpectArray(request_description);
+  auto& entry = entry_data.GetArray();
+  if (entry.size() != 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 2 elements in stream entry, got " +
+        entry_data.ToDebugString());
+  }
+
+  StreamEntry result;
+  result.id = ExtractStringElem(entry_data, 0, request_description);
+  // fields are nil for the pending entries that were deleted from the stream
+  if (!entry[1].IsNil()) {
+    entry[1].ExpectArray(request_description);
+    result.fields = ParseReplyDataArray(
+        std::move(entry[1]), request_description,
+        To<std::vector<std::pair<std::string, std::string>>>{});
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace impl {
@@ -227,6 +253,21 @@ std::vector<GeoPoint> ParseReplyDataArray(
   return result;
 }
 
+std::vector<StreamEntry> ParseReplyDataArray(
+    ReplyData&& array_data, const std::string& request_description,
+    To<std::vector<StreamEntry>>) {
+  auto& array = array_data.GetArray();
+  std::vector<StreamEntry> result;
+  result.reserve(array.size());
+
+  for (auto& elem : array) {
+    // Redis 6.2 XAUTOCLAIM returns nil in place of the deleted entries
+    if (elem.IsNil()) continue;
+    result.push_back(ParseStreamEntry(elem, request_description));
+  }
+  return result;
+}
+
 std::string Parse(ReplyData&& reply_data,
                   const std::string& request_description, To<std::string>) {
   reply_data.ExpectString(request_description);
@@ -379,6 +420,63 @@ std::unordered_map<std::string, std::string> Parse(
   return result;
 }
 
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>) {
+  reply_data.ExpectArray(request_description);
+  auto& array = reply_data.GetArray();
+  // Redis 7.0 appends the ids of the deleted entries as the third element
+  if (array.size() < 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected at least 2 elements in array, got " +
+        reply_data.ToDebugString());
+  }
+
+  XautoclaimReply result;
+  result.next_id = ExtractStringElem(reply_data, 0, request_description);
+  result.entries = Parse(std::move(array[1]), request_description,
+                         To<std::vector<StreamEntry>>{});
+  return result;
+}
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>) {
+  if (reply_data.IsError() &&
+      !reply_data.GetError().compare(0, kBusyGroup.size(), kBusyGroup)) {
+    return XgroupCreateReply::kGroupExists;
+  }
+  reply_data.ExpectStatusEqualTo(kOk, request_description);
+  return XgroupCreateReply::kCreated;
+}
+
+XreadgroupReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XreadgroupReply>) {
+  XreadgroupReply result;
+  if (reply_data.IsNil()) return result;
+
+  // [[stream, [entry...]]...], a single stream is requested
+  reply_data.ExpectArray(request_description);
+  for (auto& stream : reply_data.GetArray()) {
+    stream.ExpectArray(request_description);
+    auto& stream_array = stream.GetArray();
+    if (stream_array.size() != 2) {
+      throw USERVER_NAMESPACE::redis::ParseReplyException(
+          "Unexpected reply to '" + request_description +
+          "'. Expected 2 elements in stream reply, got " +
+          stream.ToDebugString());
+    }
+    auto entries = Parse(std::move(stream_array[1]), request_description,
+                         To<std::vector<StreamEntry>>{});
+    result.entries.insert(result.entries.end(),
+                          std::make_move_iterator(entries.begin()),
+                          std::make_move_iterator(entries.end()));
+  }
+  return result;
+}
+
 ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) {
   return std::move(reply_data);
 }
@@ -86,6 +86,46 @@ UTEST_P_MT(RedisPubsubTestBasic, SimplePsubscribe, 2) {
   token.Unsubscribe();
 }
 
+UTEST_P_MT(RedisPubsubTestBasic, SharedSubscription, 2) {
+  const std::string test_data = "something_else";
+  const std::string test_channel = "interior";
+
+  engine::SingleConsumerEvent first_success;
+  engine::SingleConsumerEvent second_success;
+
+  auto make_callback = [&](engine::SingleConsumerEvent& success) {
+    return [&](const std::string& channel, const std::string& data) {
+      if (channel == test_channel && data == test_data) {
+        success.Send();
+      }
+    };
+  };
+
+  auto sender = utils::CriticalAsync("sender", [&]() {
+    while (!engine::current_task::ShouldCancel()) {
+      GetClient()->Publish(test_channel, test_data, {});
+      engine::InterruptibleSleepFor(std::chrono::seconds{1});
+    }
+  });
+
+  redis::CommandControl cc{GetParam()};
+  auto first_token = GetSubscribeClient()->Subscribe(
+      test_channel, make_callback(first_success), cc);
+  auto second_token = GetSubscribeClient()->Subscribe(
+      test_channel, make_callback(second_success), cc);
+
+  std::chrono::seconds deadwait{15};
+  EXPECT_TRUE(first_success.WaitForEventFor(deadwait));
+  EXPECT_TRUE(second_success.WaitForEventFor(deadwait));
+
+  // the redis subscription is kept while there are local subscribers
+  first_token.Unsubscribe();
+  EXPECT_TRUE(second_success.WaitForEventFor(deadwait));
+
+  sender.RequestCancel();
+  second_token.Unsubscribe();
+}
+
 namespace {
 
 std::vector<redis::CommandControl> BuildTestData() {
@@ -0,0 +1,219 @@
+#include <userver/storages/redis/rate_limiter.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Adds the tokens to the counters of the current and the previous windows,
+// returns the counts of them
+const std::string kSyncScript = R"(
+local function add(key, tokens)
+  local count = redis.call('incrby', key, tokens)
+  if count == tonumber(tokens) then
+    redis.call('pexpire', key, ARGV[3])
+  end
+  return count
+end
+local current = add(KEYS[1], ARGV[1])
+local previous = redis.call('get', KEYS[2]) or '0'
+if tonumber(ARGV[2]) > 0 then
+  previous = add(KEYS[2], ARGV[2])
+end
+return {tostring(current), tostring(previous)}
+)";
+
+struct WindowPosition final {
+  std::int64_t index;
+  std::int64_t elapsed_ms;
+};
+
+WindowPosition GetWindowPosition(std::chrono::milliseconds window) {
+  const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          utils::datetime::Now().time_since_epoch())
+                          .count();
+  return {now_ms / window.count(), now_ms % window.count()};
+}
+
+}  // namespace
+
+RateLimiter::RateLimiter(std::shared_ptr<Client> client,
+                         RateLimiterSettings settings)
+    : client_(std::move(client)), settings_(std::move(settings)) {
+  UINVARIANT(client_, "No redis client");
+  UINVARIANT(settings_.window.count() > 0, "The window must be positive");
+  UINVARIANT(settings_.limit >= 0, "The limit must be non-negative");
+}
+
+RateLimiter::~RateLimiter() = default;
+
+void RateLimiter::KeyState::AdvancePending(std::int64_t new_window) noexcept {
+  if (pending_window == new_window) return;
+  pending_previous = pending_window + 1 == new_window ? pending_current : 0;
+  pending_current = 0;
+  pending_window = new_window;
+}
+
+bool RateLimiter::Obtain(const std::string& key) {
+  const auto position = GetWindowPosition(settings_.window);
+
+  auto state = states_.Get(key);
+  if (!state) state = states_.TryEmplace(key).value;
+  std::unique_lock lock(state->mutex);
+  while (state->erased) {
+    lock.unlock();
+    state = ReplaceErasedState(key, state);
+    lock = std::unique_lock(state->mutex);
+  }
+
+  auto current = state->current;
+  auto previous = state->previous;
+  if (state->window != position.index) {
+    // Not synced since the window start, the current window becomes previous
+    previous = state->window + 1 == position.index ? current : 0;
+    current = 0;
+  }
+  state->AdvancePending(position.index);
+
+  const auto window_ms = settings_.window.count();
+  const auto previous_weight =
+      static_cast<double>(window_ms - position.elapsed_ms) / window_ms;
+  const auto estimate =
+      static_cast<double>(previous + state->pending_previous) *
+          previous_weight +
+      static_cast<double>(current + state->pending_current);
+  if (estimate >= settings_.limit) {
+    lock.unlock();
+    ++statistics_.rejected;
+    return false;
+  }
+
+  ++state->pending_current;
+  state->last_used_window = position.index;
+  lock.unlock();
+  ++statistics_.obtained;
+  return true;
+}
+
+void RateLimiter::Sync(const CommandControl& command_control) {
+  const auto window = GetWindowPosition(settings_.window).index;
+  const auto expire_ms = std::to_string(2 * settings_.window.count());
+
+  struct Flush final {
+    std::shared_ptr<KeyState> state;
+    std::int64_t sent_current;
+    std::int64_t sent_previous;
+    RequestEval<std::vector<std::string>> request;
+  };
+  std::vector<Flush> flushes;
+  std::vector<std::pair<std::string, std::shared_ptr<KeyState>>> unused;
+
+  for (const auto& [key, state] : states_) {
+    std::int64_t sent_current = 0;
+    std::int64_t sent_previous = 0;
+    {
+      const std::lock_guard lock(state->mutex);
+      state->AdvancePending(window);
+      if (state->last_used_window + 1 < window &&
+          state->pending_current == 0 && state->pending_previous == 0) {
+        // The concurrent Obtain() replaces the erased state
+        state->erased = true;
+        unused.emplace_back(key, state);
+        continue;
+      }
+      sent_current = std::exchange(state->pending_current, 0);
+      sent_previous = std::exchange(state->pending_previous, 0);
+    }
+
+    flushes.push_back(
+        {state, sent_current, sent_previous,
+         client_->Eval<std::vector<std::string>>(
+             kSyncScript,
+             {MakeRedisKey(key, window), MakeRedisKey(key, window - 1)},
+             {std::to_string(sent_current), std::to_string(sent_previous),
+              expire_ms},
+             command_control)});
+  }
+
+  if (!unused.empty()) {
+    auto map = states_.StartWrite();
+    for (const auto& [key, state] : unused) {
+      const auto it = map->find(key);
+      if (it != map->end() && it->second == state) map->erase(it);
+    }
+    map.Commit();
+  }
+
+  for (auto& flush : flushes) {
+    try {
+      const auto counts = flush.request.Get();
+      if (counts.size() != 2) {
+        throw std::runtime_error(
+            fmt::format("Unexpected count of values: {}", counts.size()));
+      }
+      const auto current = utils::FromString<std::int64_t>(counts[0]);
+      const auto previous = utils::FromString<std::int64_t>(counts[1]);
+
+      const std::lock_guard lock(flush.state->mutex);
+      flush.state->current = current;
+      flush.state->previous = previous;
+      flush.state->window = window;
+    } catch (const std::exception& ex) {
+      {
+        // The tokens are sent with the next sync while they are in the
+        // sliding window
+        const std::lock_guard lock(flush.state->mutex);
+        auto& state = *flush.state;
+        if (state.pending_window == window) {
+          state.pending_current += flush.sent_current;
+          state.pending_previous += flush.sent_previous;
+        } else if (state.pending_window == window + 1) {
+          state.pending_previous += flush.sent_current;
+        }
+      }
+      ++statistics_.sync_errors;
+      LOG_LIMITED_WARNING() << "Failed to sync the rate limit counters: "
+                            << ex;
+    }
+  }
+}
+
+std::shared_ptr<RateLimiter::KeyState> RateLimiter::ReplaceErasedState(
+    const std::string& key, const std::shared_ptr<KeyState>& erased) {
+  auto map = states_.StartWrite();
+  auto& state = (*map)[key];
+  if (!state || state == erased) state = std::make_shared<KeyState>();
+  auto result = state;
+  map.Commit();
+  return result;
+}
+
+std::string RateLimiter::MakeRedisKey(const std::string& key,
+                                      std::int64_t window) const {
+  // the hash tag keeps the windows of a key on the same shard
+  return fmt::format("{}{{{}}}:{}", settings_.key_prefix, key, window);
+}
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const RateLimiter& rate_limiter) {
+  const auto& statistics = rate_limiter.GetStatistics();
+  writer["obtained"] = statistics.obtained;
+  writer["rejected"] = statistics.rejected;
+  writer["sync-errors"] = statistics.sync_errors;
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#include <userver/storages/redis/rate_limiter_component.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+RateLimiterSettings ParseSettings(const components::ComponentConfig& config) {
+  RateLimiterSettings settings;
+  settings.limit = config["limit"].As<std::int64_t>();
+  settings.window =
+      config["window"].As<std::chrono::milliseconds>(settings.window);
+  settings.key_prefix =
+      config["key_prefix"].As<std::string>(settings.key_prefix);
+  return settings;
+}
+
+ClientPtr FindClient(const components::ComponentConfig& config,
+                     const components::ComponentContext& context) {
+  const auto redis_name = config["redis_name"].As<std::string>(
+      std::string{components::Redis::kName});
+  return context.FindComponent<components::Redis>(redis_name)
+      .GetClient(config["db"].As<std::string>());
+}
+
+}  // namespace
+
+RateLimiterComponent::RateLimiterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : components::LoggableComponentBase{config, context},
+      rate_limiter_{std::make_unique<RateLimiter>(FindClient(config, context),
+                                                  ParseSettings(config))} {
+  const USERVER_NAMESPACE::utils::PeriodicTask::Settings sync_settings{
+      config["sync_interval"].As<std::chrono::milliseconds>(
+          std::chrono::milliseconds{100}),
+      {},
+      logging::Level::kDebug};
+  sync_task_.Start("redis_rate_limiter_sync/" + config.Name(), sync_settings,
+                   [this] { rate_limiter_->Sync(CommandControl{}); });
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter(
+              "redis.rate-limiter",
+              [this](USERVER_NAMESPACE::utils::statistics::Writer& writer) {
+                writer = *rate_limiter_;
+              },
+              {{"rate_limiter", config.Name()}});
+}
+
+RateLimiterComponent::~RateLimiterComponent() = default;
+
+void RateLimiterComponent::OnAllComponentsAreStopping() {
+  statistics_holder_.Unregister();
+  sync_task_.Stop();
+}
+
+yaml_config::Schema RateLimiterComponent::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: Redis fleet-wide rate limiter component
+additionalProperties: false
+properties:
+    redis_name:
+        type: string
+        description: name of the components::Redis to use
+        defaultDescription: redis
+    db:
+        type: string
+        description: name of the redis database in components::Redis
+    limit:
+        type: integer
+        description: fleet-wide count of the tokens of a key in a window
+        minimum: 0
+    window:
+        type: string
+        description: duration of a window
+        defaultDescription: 1s
+    sync_interval:
+        type: string
+        description: interval of sending the local counts to Redis
+        defaultDescription: 100ms
+    key_prefix:
+        type: string
+        description: prefix of the Redis keys with the counters
+        defaultDescription: "rate-limit:"
+)");
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,77 @@
+#include <storages/redis/client_redistest.hpp>
+
+#include <chrono>
+
+#include <userver/storages/redis/rate_limiter.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::seconds kWindow{3600};
+
+storages::redis::RateLimiterSettings MakeSettings() {
+  storages::redis::RateLimiterSettings settings;
+  settings.limit = 10;
+  settings.window = kWindow;
+  return settings;
+}
+
+std::size_t ObtainAll(storages::redis::RateLimiter& rate_limiter,
+                      const std::string& key) {
+  std::size_t obtained = 0;
+  while (rate_limiter.Obtain(key)) ++obtained;
+  return obtained;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, RateLimiter) {
+  // the start of a window
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{} +
+                              kWindow * 500'000);
+  auto client = GetClient();
+
+  /// [RateLimiter]
+  // Instances of a service share the limit of a key
+  storages::redis::RateLimiter first{client, MakeSettings()};
+  storages::redis::RateLimiter second{client, MakeSettings()};
+
+  // Until the first sync an instance knows only about its own tokens
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_TRUE(first.Obtain("client"));
+    EXPECT_TRUE(second.Obtain("client"));
+  }
+
+  first.Sync({});
+  second.Sync({});
+  first.Sync({});
+  EXPECT_FALSE(first.Obtain("client"));
+  EXPECT_FALSE(second.Obtain("client"));
+  /// [RateLimiter]
+
+  EXPECT_TRUE(first.Obtain("other-client"));
+  EXPECT_EQ(first.GetStatistics().sync_errors.Load(), 0);
+  utils::datetime::MockNowUnset();
+}
+
+UTEST_F(RedisClientTest, RateLimiterSlidingWindow) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{} +
+                              kWindow * 500'000);
+  storages::redis::RateLimiter rate_limiter{GetClient(), MakeSettings()};
+  EXPECT_EQ(ObtainAll(rate_limiter, "client"), 10);
+  rate_limiter.Sync({});
+
+  // a half of the previous window counts
+  utils::datetime::MockSleep(kWindow + kWindow / 2);
+  EXPECT_EQ(ObtainAll(rate_limiter, "client"), 5);
+  rate_limiter.Sync({});
+  EXPECT_FALSE(rate_limiter.Obtain("client"));
+
+  utils::datetime::MockSleep(kWindow * 3);
+  EXPECT_EQ(ObtainAll(rate_limiter, "client"), 10);
+  utils::datetime::MockNowUnset();
+}
+
+USERVER_NAMESPACE_END
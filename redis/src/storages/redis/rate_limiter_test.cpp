@@ -0,0 +1,59 @@
+#include <userver/storages/redis/rate_limiter.hpp>
+
+#include <chrono>
+
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::seconds kWindow{3600};
+
+std::size_t ObtainAll(storages::redis::RateLimiter& rate_limiter,
+                      const std::string& key) {
+  std::size_t obtained = 0;
+  while (rate_limiter.Obtain(key)) ++obtained;
+  return obtained;
+}
+
+}  // namespace
+
+UTEST(RateLimiter, RedisUnavailable) {
+  using storages::redis::RequestEvalCommon;
+
+  auto client = std::make_shared<storages::redis::GMockClient>();
+  EXPECT_CALL(*client, EvalCommon)
+      .WillRepeatedly([](auto&&...) {
+        return storages::redis::CreateMockRequestTimeout<RequestEvalCommon>();
+      });
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{} +
+                              kWindow * 500'000);
+  storages::redis::RateLimiterSettings settings;
+  settings.limit = 10;
+  settings.window = kWindow;
+  storages::redis::RateLimiter rate_limiter{client, settings};
+
+  EXPECT_EQ(ObtainAll(rate_limiter, "client"), 10);
+  rate_limiter.Sync({});
+  EXPECT_FALSE(rate_limiter.Obtain("client"));
+
+  // The unsent tokens are still in the sliding window
+  utils::datetime::MockSleep(kWindow + kWindow / 2);
+  rate_limiter.Sync({});
+  EXPECT_EQ(ObtainAll(rate_limiter, "client"), 5);
+
+  // ...and are dropped when they leave it, the unused key is forgotten
+  utils::datetime::MockSleep(kWindow * 2);
+  rate_limiter.Sync({});
+  EXPECT_EQ(ObtainAll(rate_limiter, "client"), 10);
+
+  EXPECT_EQ(rate_limiter.GetStatistics().sync_errors.Load(), 2);
+  utils::datetime::MockNowUnset();
+}
+
+USERVER_NAMESPACE_END
@@ -92,6 +92,7 @@ USERVER_NAMESPACE::redis::CommandsBufferingSettings Parse(
       elem["commands_buffering_threshold"].As<size_t>(0);
   result.watch_command_timer_interval = std::chrono::microseconds(
       elem["watch_command_timer_interval_us"].As<size_t>());
+  result.max_batch_size = elem["max_batch_size"].As<size_t>(0);
   return result;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -123,6 +124,31 @@ class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
   ReplyPtr reply_;
 };
 
+// Passes the parsed reply to the callback before returning it
+template <typename Result, typename ReplyType>
+class ObservedRequestDataImpl final : public RequestDataBase<ReplyType> {
+ public:
+  using OnReplyCb = std::function<void(const ReplyType&)>;
+
+  ObservedRequestDataImpl(USERVER_NAMESPACE::redis::Request&& request,
+                          OnReplyCb on_reply)
+      : request_data_(std::move(request)), on_reply_(std::move(on_reply)) {}
+
+  void Wait() override { request_data_.Wait(); }
+
+  ReplyType Get(const std::string& request_description) override {
+    auto reply = request_data_.Get(request_description);
+    on_reply_(reply);
+    return reply;
+  }
+
+  ReplyPtr GetRaw() override { return request_data_.GetRaw(); }
+
+ private:
+  RequestDataImpl<Result, ReplyType> request_data_;
+  OnReplyCb on_reply_;
+};
+
 template <ScanTag scan_tag>
 class RequestScanData final : public RequestScanDataBase<scan_tag> {
  public:
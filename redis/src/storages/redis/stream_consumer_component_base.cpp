@@ -0,0 +1,209 @@
+#include <userver/storages/redis/stream_consumer_component_base.hpp>
+
+#include <optional>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// the whole pending entries list was scanned
+const std::string kReclaimDone{"0-0"};
+
+const std::string kNewEntries{">"};
+
+void WaitAck(std::optional<RequestXack>& ack, const std::string& stream) {
+  if (!ack) return;
+  try {
+    ack->Get();
+  } catch (const std::exception& ex) {
+    // the entries will be reclaimed and processed again
+    LOG_WARNING() << "Failed to acknowledge the entries of '" << stream
+                  << "' stream: " << ex;
+  }
+  ack.reset();
+}
+
+}  // namespace
+
+StreamConsumerComponentBase::StreamConsumerComponentBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : components::LoggableComponentBase{config, context},
+      client_{context
+                  .FindComponent<components::Redis>(
+                      config["redis_name"].As<std::string>(
+                          std::string{components::Redis::kName}))
+                  .GetClient(config["db"].As<std::string>())},
+      stream_{config["stream"].As<std::string>()},
+      group_{config["group"].As<std::string>()},
+      consumer_{config["consumer"].As<std::string>()},
+      batch_size_{config["batch_size"].As<size_t>(100)},
+      poll_interval_{config["poll_interval"].As<std::chrono::milliseconds>(
+          std::chrono::milliseconds{100})},
+      reclaim_min_idle_{
+          config["reclaim_min_idle"].As<std::chrono::milliseconds>(
+              std::chrono::seconds{60})},
+      reclaim_interval_{
+          config["reclaim_interval"].As<std::chrono::milliseconds>(
+              std::chrono::seconds{10})} {
+  UINVARIANT(batch_size_ > 0, "batch_size is set to zero");
+}
+
+StreamConsumerComponentBase::~StreamConsumerComponentBase() = default;
+
+void StreamConsumerComponentBase::OnAllComponentsLoaded() {
+  task_ = utils::CriticalAsync("redis_stream_consumer/" + stream_,
+                               [this] { Run(); });
+}
+
+void StreamConsumerComponentBase::OnAllComponentsAreStopping() {
+  if (task_.IsValid()) task_.SyncCancel();
+}
+
+void StreamConsumerComponentBase::Run() {
+  const CommandControl cc{};
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      const auto reply = client_->XgroupCreate(stream_, group_, "$", cc).Get();
+      if (reply == XgroupCreateReply::kCreated) {
+        LOG_INFO() << "Created '" << group_ << "' group of '" << stream_
+                   << "' stream";
+      }
+      break;
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to create '" << group_ << "' group of '"
+                  << stream_ << "' stream: " << ex;
+      engine::InterruptibleSleepFor(poll_interval_);
+    }
+  }
+
+  std::optional<RequestXack> pending_ack;
+  auto next_reclaim = std::chrono::steady_clock::now();
+  std::string reclaim_start = kReclaimDone;
+
+  while (!engine::current_task::ShouldCancel()) {
+    std::vector<StreamEntry> entries;
+    try {
+      entries = ReadBatch(next_reclaim, reclaim_start);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to read '" << stream_ << "' stream: " << ex;
+    }
+
+    if (entries.empty()) {
+      WaitAck(pending_ack, stream_);
+      engine::InterruptibleSleepFor(poll_interval_);
+      continue;
+    }
+
+    tracing::Span span{"redis_stream_consume/" + stream_};
+    std::vector<std::string> processed_ids;
+    processed_ids.reserve(entries.size());
+    for (auto& entry : entries) {
+      auto id = entry.id;
+      try {
+        Process(std::move(entry));
+        processed_ids.push_back(std::move(id));
+      } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to process '" << id << "' entry of '" << stream_
+                    << "' stream: " << ex << "; would reclaim";
+      }
+      if (engine::current_task::ShouldCancel()) break;
+    }
+
+    WaitAck(pending_ack, stream_);
+    pending_ack.emplace(
+        client_->Xack(stream_, group_, std::move(processed_ids), cc));
+  }
+
+  // the last acknowledgement should not be lost on shutdown
+  engine::TaskCancellationBlocker block_cancel;
+  WaitAck(pending_ack, stream_);
+}
+
+std::vector<StreamEntry> StreamConsumerComponentBase::ReadBatch(
+    std::chrono::steady_clock::time_point& next_reclaim,
+    std::string& reclaim_start) {
+  const CommandControl cc{};
+  if (std::chrono::steady_clock::now() >= next_reclaim) {
+    auto reply = client_
+                     ->Xautoclaim(stream_, group_, consumer_,
+                                  reclaim_min_idle_, reclaim_start,
+                                  batch_size_, cc)
+                     .Get();
+    reclaim_start = std::move(reply.next_id);
+    if (reclaim_start == kReclaimDone) {
+      next_reclaim = std::chrono::steady_clock::now() + reclaim_interval_;
+    }
+    if (!reply.entries.empty()) {
+      LOG_INFO() << "Reclaimed " << reply.entries.size() << " entries of '"
+                 << stream_ << "' stream";
+      return std::move(reply.entries);
+    }
+  }
+
+  return client_->Xreadgroup(stream_, group_, consumer_, kNewEntries,
+                             batch_size_, cc)
+      .Get()
+      .entries;
+}
+
+yaml_config::Schema StreamConsumerComponentBase::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: Redis stream consumer component
+additionalProperties: false
+properties:
+    redis_name:
+        type: string
+        description: name of the components::Redis to use
+        defaultDescription: redis
+    db:
+        type: string
+        description: name of the redis database in components::Redis
+    stream:
+        type: string
+        description: key of the stream to consume
+    group:
+        type: string
+        description: consumer group, it is created if missing
+    consumer:
+        type: string
+        description: name of the consumer in the group
+    batch_size:
+        type: integer
+        description: maximum count of entries read at once
+        defaultDescription: 100
+        minimum: 1
+    poll_interval:
+        type: string
+        description: pause after reading no entries
+        defaultDescription: 100ms
+    reclaim_min_idle:
+        type: string
+        description: time after which an unacknowledged entry is reclaimed
+        defaultDescription: 60s
+    reclaim_interval:
+        type: string
+        description: interval of searching for the entries to reclaim
+        defaultDescription: 10s
+)");
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -18,16 +18,16 @@ SubscriptionToken SubscribeClientImpl::Subscribe(
     std::string channel, SubscriptionToken::OnMessageCb on_message_cb,
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return {std::make_unique<SubscriptionTokenImpl>(
-      *redis_client_, std::move(channel), std::move(on_message_cb),
-      command_control)};
+      channel_fanouts_, *redis_client_, std::move(channel),
+      std::move(on_message_cb), command_control)};
 }
 
 SubscriptionToken SubscribeClientImpl::Psubscribe(
     std::string pattern, SubscriptionToken::OnPmessageCb on_pmessage_cb,
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return {std::make_unique<PsubscriptionTokenImpl>(
-      *redis_client_, std::move(pattern), std::move(on_pmessage_cb),
-      command_control)};
+      pattern_fanouts_, *redis_client_, std::move(pattern),
+      std::move(on_pmessage_cb), command_control)};
 }
 
 void SubscribeClientImpl::WaitConnectedOnce(
@@ -9,6 +9,8 @@
 #include <userver/storages/redis/subscribe_client.hpp>
 #include <userver/storages/redis/subscription_token.hpp>
 
+#include "subscription_queue.hpp"
+
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
@@ -29,6 +31,10 @@ namespace storages::redis {
 /// Some messages may be lost (it's a redis limitation).
 /// @note The first callback execution can happen before `Subscribe()` or
 /// `Psubscribe()` return as it happens in a separate task.
+/// @note All the subscriptions of the client to the same channel (or pattern)
+/// share a single redis subscription, a message is delivered to them without
+/// copying. The subscription is made with the `command_control` of the first
+/// of them.
 class SubscribeClientImpl final : public SubscribeClient {
  public:
   explicit SubscribeClientImpl(
@@ -51,6 +57,8 @@ class SubscribeClientImpl final : public SubscribeClient {
 
  private:
   std::shared_ptr<USERVER_NAMESPACE::redis::SubscribeSentinel> redis_client_;
+  SubscriptionFanoutMap<ChannelSubscriptionQueueItem> channel_fanouts_;
+  SubscriptionFanoutMap<PatternSubscriptionQueueItem> pattern_fanouts_;
 };
 
 }  // namespace storages::redis
@@ -1,22 +1,117 @@
 #include "subscription_queue.hpp"
 
+#include <algorithm>
+#include <type_traits>
+
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+template <typename Item>
+SubscriptionFanout<Item>::~SubscriptionFanout() {
+  token_.Unsubscribe();
+}
+
+template <typename Item>
+void SubscriptionFanout<Item>::Subscribe(
+    USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+    const std::string& channel,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
+  if constexpr (std::is_same_v<Item, ChannelSubscriptionQueueItem>) {
+    token_ = subscribe_sentinel.Subscribe(
+        channel,
+        [this](const std::string& channel, const std::string& message) {
+          // the only copy of the message for all the subscribers
+          Push(Item{std::make_shared<const std::string>(message)}, channel);
+        },
+        command_control);
+  } else {
+    token_ = subscribe_sentinel.Psubscribe(
+        channel,
+        [this](const std::string& pattern, const std::string& channel,
+               const std::string& message) {
+          Push(Item{std::make_shared<const typename Item::Message>(
+                   typename Item::Message{channel, message})},
+               pattern);
+        },
+        command_control);
+  }
+}
+
+template <typename Item>
+void SubscriptionFanout<Item>::Add(SubscriptionQueue<Item>& queue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  queues_.push_back(&queue);
+}
+
+template <typename Item>
+void SubscriptionFanout<Item>::Remove(SubscriptionQueue<Item>& queue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = std::find(queues_.begin(), queues_.end(), &queue);
+  UASSERT(it != queues_.end());
+  if (it != queues_.end()) queues_.erase(it);
+}
+
+template <typename Item>
+void SubscriptionFanout<Item>::Push(const Item& item,
+                                    const std::string& channel) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto* queue : queues_) {
+    if (!queue->PushMessage(item)) {
+      // Use SubscriptionQueue::SetMaxLength() or
+      // SubscriptionToken::SetMaxQueueLength() if limit is too low
+      LOG_ERROR() << "failed to push message from '" << channel
+                  << "' into subscription queue due to overflow (max length="
+                  << queue->GetMaxLength() << ')';
+    }
+  }
+}
+
+template <typename Item>
+std::shared_ptr<SubscriptionFanout<Item>>
+SubscriptionFanoutMap<Item>::Subscribe(
+    SubscriptionQueue<Item>& queue,
+    USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+    const std::string& channel,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& weak_fanout = fanouts_[channel];
+  auto fanout = weak_fanout.lock();
+  if (fanout) {
+    fanout->Add(queue);
+    return fanout;
+  }
+
+  for (auto it = fanouts_.begin(); it != fanouts_.end();) {
+    if (it->second.expired() && it->first != channel) {
+      it = fanouts_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // the queue is added first not to miss the first messages
+  fanout = std::make_shared<SubscriptionFanout<Item>>();
+  fanout->Add(queue);
+  fanout->Subscribe(subscribe_sentinel, channel, command_control);
+  fanouts_[channel] = fanout;
+  return fanout;
+}
+
 template <typename Item>
 SubscriptionQueue<Item>::SubscriptionQueue(
+    SubscriptionFanoutMap<Item>& fanouts,
     USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
     std::string channel,
     const USERVER_NAMESPACE::redis::CommandControl& command_control)
     : queue_(Queue::Create()),
       producer_(queue_->GetProducer()),
       consumer_(queue_->GetConsumer()),
-      token_(std::make_unique<USERVER_NAMESPACE::redis::SubscriptionToken>(
-          GetSubscriptionToken(subscribe_sentinel, std::move(channel),
-                               command_control))) {}
+      fanout_(fanouts.Subscribe(*this, subscribe_sentinel, channel,
+                                command_control)) {}
 
 template <typename Item>
 SubscriptionQueue<Item>::~SubscriptionQueue() {
@@ -29,64 +124,39 @@ void SubscriptionQueue<Item>::SetMaxLength(size_t length) {
 }
 
 template <typename Item>
-bool SubscriptionQueue<Item>::PopMessage(Item& msg_ptr) {
-  return consumer_.Pop(msg_ptr);
+size_t SubscriptionQueue<Item>::GetMaxLength() const {
+  return queue_->GetSoftMaxSize();
 }
 
 template <typename Item>
-void SubscriptionQueue<Item>::Unsubscribe() {
-  token_->Unsubscribe();
+bool SubscriptionQueue<Item>::PopMessages(std::vector<Item>& batch) {
+  batch.clear();
+  Item item;
+  if (!consumer_.Pop(item)) return false;
+  batch.push_back(std::move(item));
+  while (batch.size() < kMaxBatchSize && consumer_.PopNoblock(item)) {
+    batch.push_back(std::move(item));
+  }
+  return true;
 }
 
 template <typename Item>
-template <typename T>
-std::enable_if_t<std::is_same<T, ChannelSubscriptionQueueItem>::value,
-                 USERVER_NAMESPACE::redis::SubscriptionToken>
-SubscriptionQueue<Item>::GetSubscriptionToken(
-    USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
-    std::string channel,
-    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
-  return subscribe_sentinel.Subscribe(
-      channel,
-      [this](const std::string& channel, const std::string& message) {
-        if (!producer_.PushNoblock(Item(message))) {
-          // Use SubscriptionQueue::SetMaxLength() or
-          // SubscriptionToken::SetMaxQueueLength() if limit is too low
-          LOG_ERROR()
-              << "failed to push message '" << message << "' from channel '"
-              << channel
-              << "' into subscription queue due to overflow (max length="
-              << queue_->GetSoftMaxSize() << ')';
-        }
-      },
-      command_control);
+bool SubscriptionQueue<Item>::PushMessage(Item item) {
+  return producer_.PushNoblock(std::move(item));
 }
 
 template <typename Item>
-template <typename T>
-std::enable_if_t<std::is_same<T, PatternSubscriptionQueueItem>::value,
-                 USERVER_NAMESPACE::redis::SubscriptionToken>
-SubscriptionQueue<Item>::GetSubscriptionToken(
-    USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
-    std::string pattern,
-    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
-  return subscribe_sentinel.Psubscribe(
-      pattern,
-      [this](const std::string& pattern, const std::string& channel,
-             const std::string& message) {
-        if (!producer_.PushNoblock(Item(channel, message))) {
-          // Use SubscriptionQueue::SetMaxLength() or
-          // SubscriptionToken::SetMaxQueueLength() if limit is too low
-          LOG_ERROR()
-              << "failed to push pmessage '" << message << "' from channel '"
-              << channel << "' from pattern '" << pattern
-              << "' into subscription queue due to overflow (max length="
-              << queue_->GetSoftMaxSize() << ')';
-        }
-      },
-      command_control);
+void SubscriptionQueue<Item>::Unsubscribe() {
+  if (!fanout_) return;
+  fanout_->Remove(*this);
+  // the last subscriber of the channel unsubscribes the fanout
+  fanout_.reset();
 }
 
+template class SubscriptionFanout<ChannelSubscriptionQueueItem>;
+template class SubscriptionFanout<PatternSubscriptionQueueItem>;
+template class SubscriptionFanoutMap<ChannelSubscriptionQueueItem>;
+template class SubscriptionFanoutMap<PatternSubscriptionQueueItem>;
 template class SubscriptionQueue<ChannelSubscriptionQueueItem>;
 template class SubscriptionQueue<PatternSubscriptionQueueItem>;
 
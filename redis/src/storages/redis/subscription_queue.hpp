@@ -1,7 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -10,27 +13,84 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+// The message is shared by all the local subscribers of the channel
 struct ChannelSubscriptionQueueItem {
-  std::string message;
+  std::shared_ptr<const std::string> message;
 
   ChannelSubscriptionQueueItem() = default;
-  explicit ChannelSubscriptionQueueItem(std::string message)
+  explicit ChannelSubscriptionQueueItem(
+      std::shared_ptr<const std::string> message)
       : message(std::move(message)) {}
 };
 
 struct PatternSubscriptionQueueItem {
-  std::string channel;
-  std::string message;
+  struct Message {
+    std::string channel;
+    std::string message;
+  };
+
+  std::shared_ptr<const Message> message;
 
   PatternSubscriptionQueueItem() = default;
-  PatternSubscriptionQueueItem(std::string channel, std::string message)
-      : channel(std::move(channel)), message(std::move(message)) {}
+  explicit PatternSubscriptionQueueItem(std::shared_ptr<const Message> message)
+      : message(std::move(message)) {}
+};
+
+template <typename Item>
+class SubscriptionQueue;
+
+/// A single redis subscription to a channel (or a pattern) that delivers each
+/// message to all the local subscription queues of the channel without
+/// copying it
+template <typename Item>
+class SubscriptionFanout final {
+ public:
+  SubscriptionFanout() = default;
+  ~SubscriptionFanout();
+
+  SubscriptionFanout(const SubscriptionFanout&) = delete;
+  SubscriptionFanout& operator=(const SubscriptionFanout&) = delete;
+
+  void Subscribe(
+      USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+      const std::string& channel,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+
+  void Add(SubscriptionQueue<Item>& queue);
+  void Remove(SubscriptionQueue<Item>& queue);
+
+ private:
+  void Push(const Item& item, const std::string& channel);
+
+  std::mutex mutex_;
+  std::vector<SubscriptionQueue<Item>*> queues_;
+  USERVER_NAMESPACE::redis::SubscriptionToken token_;
+};
+
+/// Fanouts by the channel (or the pattern), a fanout lives while there are
+/// local subscribers of its channel
+template <typename Item>
+class SubscriptionFanoutMap final {
+ public:
+  /// Adds the queue to the fanout of the channel, the fanout is subscribed
+  /// with the `command_control` if there were no subscribers of the channel
+  std::shared_ptr<SubscriptionFanout<Item>> Subscribe(
+      SubscriptionQueue<Item>& queue,
+      USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+      const std::string& channel,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<SubscriptionFanout<Item>>>
+      fanouts_;
 };
 
 template <typename Item>
 class SubscriptionQueue {
  public:
   SubscriptionQueue(
+      SubscriptionFanoutMap<Item>& fanouts,
       USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
       std::string channel,
       const USERVER_NAMESPACE::redis::CommandControl& command_control);
@@ -41,38 +101,34 @@ class SubscriptionQueue {
 
   void SetMaxLength(size_t length);
 
-  bool PopMessage(Item& msg_ptr);
+  size_t GetMaxLength() const;
 
-  void Unsubscribe();
+  /// Waits for a message and takes it along with up to `kMaxBatchSize - 1`
+  /// already queued messages
+  bool PopMessages(std::vector<Item>& batch);
 
- private:
-  template <typename T = Item>
-  std::enable_if_t<std::is_same<T, ChannelSubscriptionQueueItem>::value,
-                   USERVER_NAMESPACE::redis::SubscriptionToken>
-  GetSubscriptionToken(
-      USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
-      std::string channel,
-      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+  bool PushMessage(Item item);
 
-  template <typename T = Item>
-  std::enable_if_t<std::is_same<T, PatternSubscriptionQueueItem>::value,
-                   USERVER_NAMESPACE::redis::SubscriptionToken>
-  GetSubscriptionToken(
-      USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
-      std::string pattern,
-      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+  void Unsubscribe();
 
+  static constexpr size_t kMaxBatchSize = 64;
+
+ private:
   // Messages could come out-of-order due to Redis limitations. Non FIFO is fine
   using Queue = concurrent::NonFifoMpscQueue<Item>;
 
   std::shared_ptr<Queue> queue_;
   typename Queue::Producer producer_;
   typename Queue::Consumer consumer_;
-  std::unique_ptr<USERVER_NAMESPACE::redis::SubscriptionToken> token_;
+  std::shared_ptr<SubscriptionFanout<Item>> fanout_;
 };
 
 extern template class SubscriptionQueue<ChannelSubscriptionQueueItem>;
 extern template class SubscriptionQueue<PatternSubscriptionQueueItem>;
+extern template class SubscriptionFanout<ChannelSubscriptionQueueItem>;
+extern template class SubscriptionFanout<PatternSubscriptionQueueItem>;
+extern template class SubscriptionFanoutMap<ChannelSubscriptionQueueItem>;
+extern template class SubscriptionFanoutMap<PatternSubscriptionQueueItem>;
 
 }  // namespace storages::redis
 
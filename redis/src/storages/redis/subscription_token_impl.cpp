@@ -1,6 +1,7 @@
 #include "subscription_token_impl.hpp"
 
 #include <stdexcept>
+#include <vector>
 
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/tracing/span.hpp>
@@ -17,11 +18,12 @@ constexpr std::string_view kProcessRedisSubscriptionMessage =
 }  // namespace
 
 SubscriptionTokenImpl::SubscriptionTokenImpl(
+    SubscriptionFanoutMap<ChannelSubscriptionQueueItem>& fanouts,
     USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
     std::string channel, OnMessageCb on_message_cb,
     const USERVER_NAMESPACE::redis::CommandControl& command_control)
     : channel_(std::move(channel)),
-      queue_(subscribe_sentinel, channel_, command_control),
+      queue_(fanouts, subscribe_sentinel, channel_, command_control),
       on_message_cb_(std::move(on_message_cb)),
       subscriber_task_(
           utils::CriticalAsync("redis-channel-subscriber-" + channel_,
@@ -39,19 +41,22 @@ void SubscriptionTokenImpl::Unsubscribe() {
 }
 
 void SubscriptionTokenImpl::ProcessMessages() {
-  ChannelSubscriptionQueueItem msg;
-  while (queue_.PopMessage(msg)) {
+  std::vector<ChannelSubscriptionQueueItem> batch;
+  batch.reserve(decltype(queue_)::kMaxBatchSize);
+  while (queue_.PopMessages(batch)) {
     tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_message_cb_) on_message_cb_(channel_, msg.message);
+    if (!on_message_cb_) continue;
+    for (const auto& msg : batch) on_message_cb_(channel_, *msg.message);
   }
 }
 
 PsubscriptionTokenImpl::PsubscriptionTokenImpl(
+    SubscriptionFanoutMap<PatternSubscriptionQueueItem>& fanouts,
     USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
     std::string pattern, OnPmessageCb on_pmessage_cb,
     const USERVER_NAMESPACE::redis::CommandControl& command_control)
     : pattern_(std::move(pattern)),
-      queue_(subscribe_sentinel, pattern_, command_control),
+      queue_(fanouts, subscribe_sentinel, pattern_, command_control),
       on_pmessage_cb_(std::move(on_pmessage_cb)),
       subscriber_task_(
           utils::CriticalAsync("redis-pattern-subscriber-" + pattern_,
@@ -69,10 +74,14 @@ void PsubscriptionTokenImpl::Unsubscribe() {
 }
 
 void PsubscriptionTokenImpl::ProcessMessages() {
-  PatternSubscriptionQueueItem msg;
-  while (queue_.PopMessage(msg)) {
+  std::vector<PatternSubscriptionQueueItem> batch;
+  batch.reserve(decltype(queue_)::kMaxBatchSize);
+  while (queue_.PopMessages(batch)) {
     tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
+    if (!on_pmessage_cb_) continue;
+    for (const auto& msg : batch) {
+      on_pmessage_cb_(pattern_, msg.message->channel, msg.message->message);
+    }
   }
 }
 
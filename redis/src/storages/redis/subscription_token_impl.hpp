@@ -16,6 +16,7 @@ class SubscriptionTokenImpl final : public impl::SubscriptionTokenImplBase {
   using OnMessageCb = SubscriptionToken::OnMessageCb;
 
   SubscriptionTokenImpl(
+      SubscriptionFanoutMap<ChannelSubscriptionQueueItem>& fanouts,
       USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
       std::string channel, OnMessageCb on_message_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control);
@@ -40,6 +41,7 @@ class PsubscriptionTokenImpl final : public impl::SubscriptionTokenImplBase {
   using OnPmessageCb = SubscriptionToken::OnPmessageCb;
 
   PsubscriptionTokenImpl(
+      SubscriptionFanoutMap<PatternSubscriptionQueueItem>& fanouts,
       USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
       std::string pattern, OnPmessageCb on_pmessage_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control);
@@ -221,6 +221,14 @@ class MockClientBase : public Client,
   RequestMset Mset(std::vector<std::pair<std::string, std::string>> key_values,
                    const CommandControl& command_control) override;
 
+  MgetAcrossShardsReply MgetAcrossShards(
+      std::vector<std::string> keys,
+      const CommandControl& command_control) override;
+
+  MsetAcrossShardsReply MsetAcrossShards(
+      std::vector<std::pair<std::string, std::string>> key_values,
+      const CommandControl& command_control) override;
+
   RequestPersist Persist(std::string key,
                          const CommandControl& command_control) override;
 
@@ -325,6 +333,29 @@ class MockClientBase : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXadd Xadd(std::string key,
+                   std::vector<std::pair<std::string, std::string>> fields,
+                   const CommandControl& command_control) override;
+
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(std::string key, std::string group,
+                               std::string consumer,
+                               std::chrono::milliseconds min_idle_time,
+                               std::string start, size_t count,
+                               const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(std::string key, std::string group,
+                               std::string consumer, std::string id,
+                               size_t count,
+                               const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -380,6 +380,20 @@ RequestMset MockClientBase::Mset(
   return RequestMset{nullptr};
 }
 
+MgetAcrossShardsReply MockClientBase::MgetAcrossShards(
+    std::vector<std::string> /*keys*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return {};
+}
+
+MsetAcrossShardsReply MockClientBase::MsetAcrossShards(
+    std::vector<std::pair<std::string, std::string>> /*key_values*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return {};
+}
+
 RequestPersist MockClientBase::Persist(
     std::string /*key*/, const CommandControl& /*command_control*/) {
   UASSERT_MSG(false, "redis method not mocked");
@@ -590,6 +604,44 @@ RequestType MockClientBase::Type(std::string /*key*/,
   return RequestType{nullptr};
 }
 
+RequestXadd MockClientBase::Xadd(
+    std::string /*key*/,
+    std::vector<std::pair<std::string, std::string>> /*fields*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXadd{nullptr};
+}
+
+RequestXack MockClientBase::Xack(std::string /*key*/, std::string /*group*/,
+                                 std::vector<std::string> /*ids*/,
+                                 const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXack{nullptr};
+}
+
+RequestXautoclaim MockClientBase::Xautoclaim(
+    std::string /*key*/, std::string /*group*/, std::string /*consumer*/,
+    std::chrono::milliseconds /*min_idle_time*/, std::string /*start*/,
+    size_t /*count*/, const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXautoclaim{nullptr};
+}
+
+RequestXgroupCreate MockClientBase::XgroupCreate(
+    std::string /*key*/, std::string /*group*/, std::string /*id*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXgroupCreate{nullptr};
+}
+
+RequestXreadgroup MockClientBase::Xreadgroup(
+    std::string /*key*/, std::string /*group*/, std::string /*consumer*/,
+    std::string /*id*/, size_t /*count*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXreadgroup{nullptr};
+}
+
 RequestZadd MockClientBase::Zadd(std::string /*key*/, double /*score*/,
                                  std::string /*member*/,
                                  const CommandControl& /*command_control*/) {
@@ -40,6 +40,36 @@ class FbsSumEcho final
 }  // namespace samples::fbs_handle
 /// [Flatbuf service sample - component]
 
+/// [Flatbuf service sample - view component]
+#include <userver/server/handlers/http_handler_flatbuf_view_base.hpp>
+
+namespace samples::fbs_handle {
+
+class FbsSumEchoView final
+    : public server::handlers::HttpHandlerFlatbufViewBase<fbs::SampleRequest,
+                                                          fbs::SampleResponse> {
+ public:
+  static constexpr std::string_view kName = "handler-fbs-view-sample";
+
+  FbsSumEchoView(const components::ComponentConfig& config,
+                 const components::ComponentContext& context)
+      : HttpHandlerFlatbufViewBase(config, context) {}
+
+  flatbuffers::Offset<fbs::SampleResponse> HandleRequestFlatbufThrow(
+      const server::http::HttpRequest& /*request*/,
+      const fbs::SampleRequest& fbs_request,
+      flatbuffers::FlatBufferBuilder& builder,
+      server::request::RequestContext&) const override {
+    // Nested objects are created before the table that refers to them
+    const auto echo = builder.CreateString(fbs_request.data());
+    return fbs::CreateSampleResponse(
+        builder, fbs_request.arg1() + fbs_request.arg2(), echo);
+  }
+};
+
+}  // namespace samples::fbs_handle
+/// [Flatbuf service sample - view component]
+
 namespace samples::fbs_request {
 
 /// [Flatbuf service sample - http component]
@@ -108,6 +138,7 @@ void FbsRequest::KeepRequesting() const {
 int main(int argc, char* argv[]) {
   auto component_list = components::MinimalServerComponentList()        //
                             .Append<samples::fbs_handle::FbsSumEcho>()  //
+                            .Append<samples::fbs_handle::FbsSumEchoView>()  //
 
                             .Append<clients::dns::Component>()            //
                             .Append<components::HttpClient>()             //
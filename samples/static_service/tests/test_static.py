@@ -27,3 +27,34 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_file_range(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'index.html'
+    content = file.open().read().encode()
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=1-4'},
+    )
+    assert response.status == 206
+    assert response.headers['Accept-Ranges'] == 'bytes'
+    assert response.headers['Content-Range'] == f'bytes 1-4/{len(content)}'
+    assert response.content == content[1:5]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=-3'},
+    )
+    assert response.status == 206
+    assert response.content == content[-3:]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': f'bytes={len(content)}-'},
+    )
+    assert response.status == 416
+    assert response.headers['Content-Range'] == f'bytes */{len(content)}'
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=0-1,3-4'},
+    )
+    assert response.status == 200
+    assert response.content == content
@@ -566,6 +566,12 @@ class AiohttpClient(service_client.AiohttpClient):
             'metrics_portability', prefix=prefix,
         )
 
+    async def perf_counters(
+            self, *, reset: bool = False,
+    ) -> typing.Dict[str, int]:
+        response = await self._testsuite_action('perf_counters', reset=reset)
+        return response['counters']
+
     async def list_tasks(self) -> typing.List[str]:
         response = await self._do_testsuite_action('tasks_list')
         async with response:
@@ -828,6 +834,21 @@ class Client(ClientWrapper):
         """
         return await self._client.metrics_portability(prefix=prefix)
 
+    async def perf_counters(
+            self, *, reset: bool = False,
+    ) -> typing.Dict[str, int]:
+        """
+        Returns the performance counters accounted since the last reset, e.g.
+        `postgresql-queries`, `redis-commands`, `tasks-created` and
+        `allocations`. The counters are process-wide, so the background
+        activity of the service is also accounted.
+
+        @param reset zero the counters after reading them
+
+        @sa @ref testsuite::AccountPerfCounter
+        """
+        return await self._client.perf_counters(reset=reset)
+
     def list_tasks(self) -> typing.List[str]:
         return self._client.list_tasks()
 
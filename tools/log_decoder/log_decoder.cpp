@@ -0,0 +1,129 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <userver/logging/impl/binary_format.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+namespace binary = logging::impl::binary;
+
+struct Config {
+  std::string format = "tskv";
+  std::vector<std::string> files;
+};
+
+Config ParseConfig(int argc, char** argv) {
+  namespace po = boost::program_options;
+
+  Config config;
+  po::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "format,f", po::value(&config.format)->default_value(config.format),
+      "output format (tskv, json)")(
+      "input", po::value(&config.files),
+      "binary log files to decode (stdin by default)");
+
+  po::positional_options_description positional;
+  positional.add("input", -1);
+
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                  .options(desc)
+                  .positional(positional)
+                  .run(),
+              vm);
+    po::notify(vm);
+  } catch (const std::exception& ex) {
+    std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+    exit(1);
+  }
+
+  if (vm.count("help")) {
+    std::cout << "Converts the logs written with the 'binary' format\n\n"
+              << desc << std::endl;
+    exit(0);
+  }
+
+  if (config.format != "tskv" && config.format != "json") {
+    std::cerr << "Unknown output format '" << config.format << "'\n";
+    exit(1);
+  }
+
+  return config;
+}
+
+// Reads the next record into `buffer` without parsing its body
+bool ReadRecord(std::istream& input, std::string& buffer) {
+  buffer.clear();
+
+  const auto magic = input.get();
+  if (magic == std::istream::traits_type::eof()) return false;
+  buffer.push_back(static_cast<char>(magic));
+
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < binary::kMaxVarintSize; ++i) {
+    const auto byte = input.get();
+    if (byte == std::istream::traits_type::eof()) break;
+    buffer.push_back(static_cast<char>(byte));
+
+    size |= static_cast<std::size_t>(byte & 0x7F) << (7 * i);
+    if ((byte & 0x80) == 0) break;
+  }
+
+  // Malformed sizes are reported by binary::ParseRecord
+  if (size > binary::kMaxPaddedValue) return true;
+
+  const auto header_size = buffer.size();
+  buffer.resize(header_size + size);
+  input.read(buffer.data() + header_size, size);
+  buffer.resize(header_size + input.gcount());
+
+  if (input.peek() == '\n') input.get();
+  return true;
+}
+
+void Decode(std::istream& input, const Config& config) {
+  std::string buffer;
+  while (ReadRecord(input, buffer)) {
+    std::string_view record_data = buffer;
+    const auto record = binary::ParseRecord(record_data);
+    if (!record) continue;
+
+    std::cout << (config.format == "json" ? binary::ToJson(*record)
+                                          : binary::ToTskv(*record))
+              << '\n';
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const Config config = ParseConfig(argc, argv);
+
+  try {
+    if (config.files.empty()) {
+      Decode(std::cin, config);
+    }
+    for (const auto& file : config.files) {
+      std::ifstream input(file, std::ios::binary);
+      if (!input) {
+        std::cerr << "Cannot open '" << file << "'\n";
+        return 1;
+      }
+      Decode(input, config);
+    }
+  } catch (const std::exception& ex) {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Count-min sketch with 4-bit counters that estimates the popularity of keys.
+///
+/// After 10 * capacity increments all the counters are halved, so the
+/// estimation reflects the recent history only.
+template <typename T, typename Hash = std::hash<T>>
+class FrequencySketch final {
+ public:
+  static constexpr std::uint8_t kMaxFrequency = 15;
+
+  explicit FrequencySketch(std::size_t capacity, const Hash& hash = Hash())
+      : hash_(hash) {
+    SetCapacity(capacity);
+  }
+
+  /// Resizes the table, all the collected frequencies are lost
+  void SetCapacity(std::size_t capacity);
+
+  void Increment(const T& key);
+
+  std::uint8_t Estimate(const T& key) const;
+
+  void Clear() noexcept;
+
+ private:
+  static constexpr std::size_t kDepth = 4;
+  static constexpr std::uint64_t kResetMask = 0x7777777777777777ULL;
+
+  struct Position final {
+    std::size_t word;
+    unsigned shift;
+  };
+
+  Position GetPosition(std::uint64_t hash, std::size_t row) const noexcept;
+  void Reset() noexcept;
+
+  Hash hash_;
+  std::vector<std::uint64_t> table_;
+  std::size_t sample_size_{0};
+  std::size_t additions_{0};
+};
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::SetCapacity(std::size_t capacity) {
+  // 16 counters per word, ~4 words per key across the rows
+  std::size_t words = 1;
+  while (words < capacity) words *= 2;
+
+  table_.assign(words, 0);
+  sample_size_ = 10 * std::max<std::size_t>(capacity, 1);
+  additions_ = 0;
+}
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::Increment(const T& key) {
+  const std::uint64_t hash = hash_(key);
+
+  bool incremented = false;
+  for (std::size_t row = 0; row < kDepth; ++row) {
+    const auto [word, shift] = GetPosition(hash, row);
+    if (((table_[word] >> shift) & 0xF) != kMaxFrequency) {
+      table_[word] += std::uint64_t{1} << shift;
+      incremented = true;
+    }
+  }
+
+  if (incremented && ++additions_ >= sample_size_) Reset();
+}
+
+template <typename T, typename Hash>
+std::uint8_t FrequencySketch<T, Hash>::Estimate(const T& key) const {
+  const std::uint64_t hash = hash_(key);
+
+  std::uint8_t result = kMaxFrequency;
+  for (std::size_t row = 0; row < kDepth; ++row) {
+    const auto [word, shift] = GetPosition(hash, row);
+    result = std::min(result,
+                      static_cast<std::uint8_t>((table_[word] >> shift) & 0xF));
+  }
+  return result;
+}
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::Clear() noexcept {
+  std::fill(table_.begin(), table_.end(), 0);
+  additions_ = 0;
+}
+
+template <typename T, typename Hash>
+auto FrequencySketch<T, Hash>::GetPosition(std::uint64_t hash,
+                                           std::size_t row) const noexcept
+    -> Position {
+  // Each row uses its own multiplier, so that the keys colliding in one row
+  // are unlikely to collide in the others. The multipliers are odd.
+  static constexpr std::uint64_t kSeeds[kDepth] = {
+      0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+      0xD6E8FEB86659FD93ULL};
+  const std::uint64_t mixed = (hash + row) * kSeeds[row];
+
+  // table_.size() is a power of two
+  const auto word = static_cast<std::size_t>(mixed >> 32) & (table_.size() - 1);
+  // every row has its own 4 counters in each word
+  const auto counter = row * 4 + static_cast<unsigned>((mixed >> 8) & 3);
+  return {word, static_cast<unsigned>(counter * 4)};
+}
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::Reset() noexcept {
+  for (auto& word : table_) word = (word >> 1) & kResetMask;
+  additions_ /= 2;
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <userver/cache/impl/frequency_sketch.hpp>
+#include <userver/cache/impl/lru.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// W-TinyLFU: a small LRU window in front of the segmented LRU main part.
+///
+/// New keys get into the window. The key evicted from the window is admitted
+/// to the main part only if it was requested more frequently than the key that
+/// the main part would evict for it, according to the FrequencySketch. So a
+/// scan or a burst of the one-hit wonders evicts only the window, and the hot
+/// keys stay in the main part.
+///
+/// The window takes 1% of the capacity, the protected segment takes 80% of the
+/// main part. Capacities below 2 are rounded up to 2.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class TinyLfuBase final {
+ public:
+  using NodeType = std::unique_ptr<LruNode<T, U>>;
+
+  explicit TinyLfuBase(std::size_t max_size, const Hash& hash = Hash(),
+                       const Equal& equal = Equal());
+
+  TinyLfuBase(TinyLfuBase&& other) noexcept = default;
+  TinyLfuBase& operator=(TinyLfuBase&& other) noexcept = default;
+
+  TinyLfuBase(const TinyLfuBase&) = delete;
+  TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+  /// @returns true if key is a new one
+  bool Put(const T& key, U value);
+
+  U* Get(const T& key);
+
+  void Erase(const T& key);
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  std::size_t GetSize() const;
+
+  std::size_t GetCapacity() const;
+
+  /// Count of the keys that were evicted from the window and were not admitted
+  /// to the main part
+  std::size_t GetAdmissionRejects() const noexcept;
+
+ private:
+  void UpdateLimits(std::size_t max_size);
+  std::size_t GetMainSize() const;
+  void Admit(NodeType&& candidate);
+  void EvictFromMain();
+
+  std::size_t window_max_size_{1};
+  std::size_t main_max_size_{1};
+  std::size_t protected_max_size_{0};
+
+  LruBase<T, U, Hash, Equal> window_;
+  // capacity of the probation segment is not limited by itself, only the
+  // whole main part is limited by main_max_size_
+  LruBase<T, U, Hash, Equal> probation_;
+  LruBase<T, U, Hash, Equal> protected_;
+  FrequencySketch<T, Hash> sketch_;
+  std::size_t admission_rejects_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(std::size_t max_size,
+                                            const Hash& hash,
+                                            const Equal& equal)
+    : window_(1, hash, equal),
+      probation_(1, hash, equal),
+      protected_(1, hash, equal),
+      sketch_(max_size, hash) {
+  UpdateLimits(max_size);
+  window_.SetMaxSize(window_max_size_);
+  probation_.SetMaxSize(main_max_size_);
+  protected_.SetMaxSize(std::max<std::size_t>(protected_max_size_, 1));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  auto* const existing = Get(key);
+  if (existing) {
+    *existing = std::move(value);
+    return false;
+  }
+
+  if (window_.GetSize() < window_max_size_) {
+    window_.Put(key, std::move(value));
+    return true;
+  }
+
+  auto candidate = window_.ExtractLeastUsedNode();
+  window_.Put(key, std::move(value));
+  Admit(std::move(candidate));
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Get(const T& key) {
+  sketch_.Increment(key);
+
+  if (auto* const value = window_.Get(key)) return value;
+  if (auto* const value = protected_.Get(key)) return value;
+
+  auto node = probation_.ExtractNode(key);
+  if (!node) return nullptr;
+
+  if (protected_max_size_ == 0) return &probation_.InsertNode(std::move(node));
+  if (protected_.GetSize() >= protected_max_size_) {
+    probation_.InsertNode(protected_.ExtractLeastUsedNode());
+  }
+  return &protected_.InsertNode(std::move(node));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+  window_.Erase(key);
+  probation_.Erase(key);
+  protected_.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  const auto old_capacity = GetCapacity();
+  UpdateLimits(new_max_size);
+  // keep the collected frequencies on reconfigurations with the same size
+  if (GetCapacity() == old_capacity) return;
+
+  while (GetMainSize() > main_max_size_) EvictFromMain();
+  while (protected_.GetSize() > protected_max_size_) {
+    probation_.InsertNode(protected_.ExtractLeastUsedNode());
+  }
+  while (window_.GetSize() > window_max_size_) {
+    Admit(window_.ExtractLeastUsedNode());
+  }
+
+  // the sizes are within the limits, so the calls below only resize buckets
+  window_.SetMaxSize(window_max_size_);
+  probation_.SetMaxSize(main_max_size_);
+  protected_.SetMaxSize(std::max<std::size_t>(protected_max_size_, 1));
+  sketch_.SetCapacity(window_max_size_ + main_max_size_);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+  window_.Clear();
+  probation_.Clear();
+  protected_.Clear();
+  sketch_.Clear();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetSize() const {
+  return window_.GetSize() + GetMainSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetCapacity() const {
+  return window_max_size_ + main_max_size_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetAdmissionRejects()
+    const noexcept {
+  return admission_rejects_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::UpdateLimits(std::size_t max_size) {
+  UASSERT(max_size > 0);
+  max_size = std::max<std::size_t>(max_size, 2);
+
+  window_max_size_ = std::max<std::size_t>(max_size / 100, 1);
+  main_max_size_ = max_size - window_max_size_;
+  // at least one element is left for the probation segment
+  protected_max_size_ = std::min(main_max_size_ * 8 / 10, main_max_size_ - 1);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetMainSize() const {
+  return probation_.GetSize() + protected_.GetSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Admit(NodeType&& candidate) {
+  UASSERT(candidate);
+  if (GetMainSize() >= main_max_size_) {
+    // probation is never empty here, as protected_max_size_ < main_max_size_
+    const T* victim = probation_.GetLeastUsedKey();
+    UASSERT(victim);
+    if (sketch_.Estimate(candidate->GetKey()) <= sketch_.Estimate(*victim)) {
+      ++admission_rejects_;
+      return;
+    }
+    EvictFromMain();
+  }
+  probation_.InsertNode(std::move(candidate));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::EvictFromMain() {
+  if (probation_.GetSize() != 0) {
+    probation_.ExtractLeastUsedNode();
+  } else {
+    protected_.ExtractLeastUsedNode();
+  }
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,493 @@
+#pragma once
+
+/// @file userver/cache/persistent_hash_map.hpp
+/// @brief @copybrief cache::PersistentHashMap
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map with the structural sharing: a copy of the map takes O(1)
+/// and shares all of the elements with the original, a modification of the
+/// copy allocates only the O(log(size)) nodes on the path to the changed
+/// element.
+///
+/// Suits the caches with the incremental updates, see
+/// @ref md_en_userver_caches: the update copies the current data, applies the
+/// changes to the copy and publishes it without copying the whole map. For the
+/// components::PostgreCache use it as the `CacheContainer` of the policy.
+///
+/// The map is a hash array mapped trie. The elements are immutable, the
+/// iterators and the pointers to the elements are invalidated by any
+/// modification of the map, unless the elements are still shared with another
+/// copy of the map. Thread safety matches the Standard Library thread safety,
+/// and the different copies of a map may be used concurrently.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class PersistentHashMap final {
+  struct Node;
+  struct Leaf;
+  struct Branch;
+  using NodePtr = std::shared_ptr<const Node>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+
+  class const_iterator;
+  using iterator = const_iterator;
+
+  explicit PersistentHashMap(const Hash& hash = Hash(),
+                             const Equal& equal = Equal())
+      : hash_(hash), equal_(equal) {}
+
+  /// Takes O(1), the copies share the elements
+  PersistentHashMap(const PersistentHashMap&) = default;
+  PersistentHashMap& operator=(const PersistentHashMap&) = default;
+
+  PersistentHashMap(PersistentHashMap&& other) noexcept
+      : root_(std::move(other.root_)),
+        size_(std::exchange(other.size_, 0)),
+        hash_(std::move(other.hash_)),
+        equal_(std::move(other.equal_)) {}
+
+  PersistentHashMap& operator=(PersistentHashMap&& other) noexcept {
+    root_ = std::move(other.root_);
+    size_ = std::exchange(other.size_, 0);
+    hash_ = std::move(other.hash_);
+    equal_ = std::move(other.equal_);
+    return *this;
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const_iterator begin() const { return const_iterator{root_.get()}; }
+  const_iterator end() const noexcept { return {}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  /// @returns the value of the key, or nullptr if there is no such key
+  const Value* FindOrNullptr(const Key& key) const;
+
+  /// @brief Inserts the element or replaces the value of an existing key.
+  /// @returns true if the key is a new one
+  template <typename V>
+  bool insert_or_assign(Key key, V&& value);
+
+  /// @brief Inserts the element if there is no such key.
+  /// @returns true if the element was inserted
+  bool insert(value_type value);
+
+  /// @returns the number of the removed elements, 0 or 1
+  size_type erase(const Key& key);
+
+  void clear() noexcept {
+    root_.reset();
+    size_ = 0;
+  }
+
+ private:
+  static constexpr std::size_t kBits = 5;
+  static constexpr std::size_t kMask = (1 << kBits) - 1;
+  static constexpr std::size_t kHashBits = sizeof(std::size_t) * 8;
+  static constexpr std::size_t kMaxDepth = (kHashBits + kBits - 1) / kBits;
+
+  struct Node {
+    explicit Node(bool is_leaf) : is_leaf(is_leaf) {}
+    const bool is_leaf;
+  };
+
+  // The elements with equal hashes are chained
+  struct Leaf final : Node {
+    template <typename... Args>
+    Leaf(std::size_t hash, std::shared_ptr<const Leaf> collision,
+         Args&&... args)
+        : Node(true),
+          hash(hash),
+          value(std::forward<Args>(args)...),
+          collision(std::move(collision)) {}
+
+    const std::size_t hash;
+    const value_type value;
+    const std::shared_ptr<const Leaf> collision;
+  };
+
+  struct Branch final : Node {
+    Branch() : Node(false) {}
+
+    std::uint32_t bitmap{0};
+    std::vector<NodePtr> children;
+  };
+
+  static const Leaf& AsLeaf(const Node& node) {
+    UASSERT(node.is_leaf);
+    return static_cast<const Leaf&>(node);
+  }
+
+  static const Branch& AsBranch(const Node& node) {
+    UASSERT(!node.is_leaf);
+    return static_cast<const Branch&>(node);
+  }
+
+  static std::uint32_t GetBit(std::size_t hash, std::size_t shift) {
+    return std::uint32_t{1} << ((hash >> shift) & kMask);
+  }
+
+  static std::size_t GetPosition(std::uint32_t bitmap, std::uint32_t bit) {
+    return __builtin_popcount(bitmap & (bit - 1));
+  }
+
+  template <typename... Args>
+  NodePtr DoInsert(const NodePtr& node, std::size_t hash, std::size_t shift,
+                   bool replace, bool& is_inserted, const Key& key,
+                   Args&&... args) const;
+
+  template <typename... Args>
+  NodePtr InsertIntoChain(const std::shared_ptr<const Leaf>& chain,
+                          bool replace, bool& is_inserted, const Key& key,
+                          Args&&... args) const;
+
+  NodePtr DoErase(const NodePtr& node, std::size_t hash, std::size_t shift,
+                  const Key& key) const;
+
+  std::shared_ptr<const Leaf> EraseFromChain(
+      const std::shared_ptr<const Leaf>& leaf, const Key& key) const;
+
+  static NodePtr MergeLeaves(NodePtr lhs, std::size_t lhs_hash, NodePtr rhs,
+                             std::size_t rhs_hash, std::size_t shift);
+
+  NodePtr root_;
+  size_type size_{0};
+  Hash hash_;
+  Equal equal_;
+};
+
+/// Forward iterator over the elements of cache::PersistentHashMap in an
+/// unspecified order
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentHashMap<Key, Value, Hash, Equal>::const_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = PersistentHashMap::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  const_iterator() noexcept = default;
+
+  reference operator*() const {
+    UASSERT(leaf_);
+    return leaf_->value;
+  }
+  pointer operator->() const { return &**this; }
+
+  const_iterator& operator++() {
+    Advance();
+    return *this;
+  }
+  const_iterator operator++(int) {
+    auto copy = *this;
+    Advance();
+    return copy;
+  }
+
+  bool operator==(const const_iterator& other) const noexcept {
+    return leaf_ == other.leaf_;
+  }
+  bool operator!=(const const_iterator& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  friend class PersistentHashMap;
+
+  explicit const_iterator(const Node* root) {
+    if (root) Descend(*root);
+  }
+
+  void Descend(const Node& node) {
+    const auto* current = &node;
+    while (!current->is_leaf) {
+      const auto& branch = AsBranch(*current);
+      UASSERT(depth_ < path_.size());
+      path_[depth_++] = {&branch, 0};
+      current = branch.children.front().get();
+    }
+    leaf_ = &AsLeaf(*current);
+  }
+
+  void Advance() {
+    UASSERT(leaf_);
+    if (leaf_->collision) {
+      leaf_ = leaf_->collision.get();
+      return;
+    }
+
+    while (depth_ > 0) {
+      auto& [branch, position] = path_[depth_ - 1];
+      if (++position < branch->children.size()) {
+        Descend(*branch->children[position]);
+        return;
+      }
+      --depth_;
+    }
+    leaf_ = nullptr;
+  }
+
+  std::array<std::pair<const Branch*, std::size_t>, kMaxDepth> path_{};
+  std::size_t depth_{0};
+  const Leaf* leaf_{nullptr};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::find(const Key& key) const
+    -> const_iterator {
+  const auto hash = hash_(key);
+  const_iterator it;
+  const auto* node = root_.get();
+  for (std::size_t shift = 0; node; shift += kBits) {
+    if (node->is_leaf) {
+      for (const auto* leaf = &AsLeaf(*node); leaf;
+           leaf = leaf->collision.get()) {
+        if (leaf->hash == hash && equal_(leaf->value.first, key)) {
+          it.leaf_ = leaf;
+          return it;
+        }
+      }
+      return end();
+    }
+
+    const auto& branch = AsBranch(*node);
+    const auto bit = GetBit(hash, shift);
+    if (!(branch.bitmap & bit)) return end();
+    const auto position = GetPosition(branch.bitmap, bit);
+    it.path_[it.depth_++] = {&branch, position};
+    node = branch.children[position].get();
+  }
+  return end();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* PersistentHashMap<Key, Value, Hash, Equal>::FindOrNullptr(
+    const Key& key) const {
+  const auto it = find(key);
+  return it == end() ? nullptr : &it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename V>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert_or_assign(Key key,
+                                                                  V&& value) {
+  bool is_inserted = false;
+  const auto hash = hash_(key);
+  root_ = DoInsert(root_, hash, 0, true, is_inserted, key, std::move(key),
+                   std::forward<V>(value));
+  if (is_inserted) ++size_;
+  return is_inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert(value_type value) {
+  bool is_inserted = false;
+  const auto hash = hash_(value.first);
+  const Key& key = value.first;
+  auto root = DoInsert(root_, hash, 0, false, is_inserted, key,
+                       std::move(value));
+  if (is_inserted) {
+    root_ = std::move(root);
+    ++size_;
+  }
+  return is_inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::erase(const Key& key)
+    -> size_type {
+  auto root = DoErase(root_, hash_(key), 0, key);
+  if (root == root_) return 0;
+  root_ = std::move(root);
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename... Args>
+auto PersistentHashMap<Key, Value, Hash, Equal>::DoInsert(
+    const NodePtr& node, std::size_t hash, std::size_t shift, bool replace,
+    bool& is_inserted, const Key& key, Args&&... args) const -> NodePtr {
+  if (!node) {
+    is_inserted = true;
+    return std::make_shared<const Leaf>(hash, nullptr,
+                                        std::forward<Args>(args)...);
+  }
+
+  if (node->is_leaf) {
+    auto leaf = std::static_pointer_cast<const Leaf>(node);
+    if (leaf->hash == hash) {
+      return InsertIntoChain(leaf, replace, is_inserted, key,
+                             std::forward<Args>(args)...);
+    }
+    is_inserted = true;
+    return MergeLeaves(node, leaf->hash,
+                       std::make_shared<const Leaf>(
+                           hash, nullptr, std::forward<Args>(args)...),
+                       hash, shift);
+  }
+
+  const auto& branch = AsBranch(*node);
+  const auto bit = GetBit(hash, shift);
+  const auto position = GetPosition(branch.bitmap, bit);
+  if (branch.bitmap & bit) {
+    auto child = DoInsert(branch.children[position], hash, shift + kBits,
+                          replace, is_inserted, key,
+                          std::forward<Args>(args)...);
+    if (child == branch.children[position]) return node;
+    auto result = std::make_shared<Branch>(branch);
+    result->children[position] = std::move(child);
+    return result;
+  }
+
+  is_inserted = true;
+  auto result = std::make_shared<Branch>(branch);
+  result->bitmap |= bit;
+  result->children.insert(
+      result->children.begin() + position,
+      std::make_shared<const Leaf>(hash, nullptr, std::forward<Args>(args)...));
+  return result;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename... Args>
+auto PersistentHashMap<Key, Value, Hash, Equal>::InsertIntoChain(
+    const std::shared_ptr<const Leaf>& chain, bool replace, bool& is_inserted,
+    const Key& key, Args&&... args) const -> NodePtr {
+  std::vector<const Leaf*> prefix;
+  const Leaf* found = nullptr;
+  for (const auto* leaf = chain.get(); leaf; leaf = leaf->collision.get()) {
+    if (equal_(leaf->value.first, key)) {
+      found = leaf;
+      break;
+    }
+    prefix.push_back(leaf);
+  }
+
+  if (!found) {
+    // A new key goes to the head of the chain, the rest of it is shared
+    is_inserted = true;
+    return std::make_shared<const Leaf>(chain->hash, chain,
+                                        std::forward<Args>(args)...);
+  }
+  if (!replace) return chain;
+
+  auto result = std::make_shared<const Leaf>(found->hash, found->collision,
+                                             std::forward<Args>(args)...);
+  for (auto it = prefix.rbegin(); it != prefix.rend(); ++it) {
+    result = std::make_shared<const Leaf>((*it)->hash, std::move(result),
+                                          (*it)->value);
+  }
+  return result;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::DoErase(
+    const NodePtr& node, std::size_t hash, std::size_t shift,
+    const Key& key) const -> NodePtr {
+  if (!node) return node;
+
+  if (node->is_leaf) {
+    auto leaf = std::static_pointer_cast<const Leaf>(node);
+    if (leaf->hash != hash) return node;
+    auto chain = EraseFromChain(leaf, key);
+    // Keeps the node if the key is not found
+    if (chain == leaf) return node;
+    return chain;
+  }
+
+  const auto& branch = AsBranch(*node);
+  const auto bit = GetBit(hash, shift);
+  if (!(branch.bitmap & bit)) return node;
+  const auto position = GetPosition(branch.bitmap, bit);
+
+  auto child = DoErase(branch.children[position], hash, shift + kBits, key);
+  if (child == branch.children[position]) return node;
+
+  if (!child) {
+    if (branch.children.size() == 1) return nullptr;
+    if (branch.children.size() == 2) {
+      // The leaves do not need a branch of their own
+      const auto& other = branch.children[1 - position];
+      if (other->is_leaf) return other;
+    }
+    auto result = std::make_shared<Branch>(branch);
+    result->bitmap &= ~bit;
+    result->children.erase(result->children.begin() + position);
+    return result;
+  }
+
+  if (branch.children.size() == 1 && child->is_leaf) return child;
+  auto result = std::make_shared<Branch>(branch);
+  result->children[position] = std::move(child);
+  return result;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::EraseFromChain(
+    const std::shared_ptr<const Leaf>& leaf, const Key& key) const
+    -> std::shared_ptr<const Leaf> {
+  if (!leaf) return leaf;
+  if (equal_(leaf->value.first, key)) return leaf->collision;
+
+  auto collision = EraseFromChain(leaf->collision, key);
+  if (collision == leaf->collision) return leaf;
+  return std::make_shared<const Leaf>(leaf->hash, std::move(collision),
+                                      leaf->value);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::MergeLeaves(
+    NodePtr lhs, std::size_t lhs_hash, NodePtr rhs, std::size_t rhs_hash,
+    std::size_t shift) -> NodePtr {
+  UASSERT(lhs_hash != rhs_hash);
+  UASSERT(shift < kHashBits);
+
+  auto result = std::make_shared<Branch>();
+  const auto lhs_bit = GetBit(lhs_hash, shift);
+  const auto rhs_bit = GetBit(rhs_hash, shift);
+  if (lhs_bit == rhs_bit) {
+    result->bitmap = lhs_bit;
+    result->children.push_back(MergeLeaves(std::move(lhs), lhs_hash,
+                                           std::move(rhs), rhs_hash,
+                                           shift + kBits));
+  } else {
+    result->bitmap = lhs_bit | rhs_bit;
+    if (lhs_bit > rhs_bit) std::swap(lhs, rhs);
+    result->children.push_back(std::move(lhs));
+    result->children.push_back(std::move(rhs));
+  }
+  return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 /// @file userver/crypto/hash.hpp
 /// @brief @copybrief crypto::hash
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -98,6 +100,70 @@ std::string Md5(std::string_view data,
                 OutputEncoding encoding = OutputEncoding::kHex);
 
 }  // namespace weak
+
+namespace impl {
+struct HasherAlgorithm;
+}  // namespace impl
+
+/// @brief Base class for the incremental hash calculation
+///
+/// Unlike the functions above, the hasher may be fed the message by parts and
+/// may be reused for several messages, so the algorithm state (and the HMAC
+/// key schedule) is set up only once.
+///
+/// A moved-from hasher may only be destroyed or assigned to.
+class Hasher {
+ public:
+  Hasher(Hasher&&) noexcept;
+  Hasher& operator=(Hasher&&) noexcept;
+  ~Hasher();
+
+  /// @brief Appends data to the hashed message
+  /// @throws CryptoException internal library exception
+  void Update(std::string_view data);
+
+  /// @brief Returns the hash of the data passed to Update() since the
+  /// construction or the previous Final() call, resets the hasher to start a
+  /// new message
+  /// @param encoding result could be returned as binary string or encoded
+  /// @throws CryptoException internal library exception
+  std::string Final(OutputEncoding encoding = OutputEncoding::kHex);
+
+ protected:
+  explicit Hasher(std::unique_ptr<impl::HasherAlgorithm>&& algorithm);
+
+ private:
+  std::unique_ptr<impl::HasherAlgorithm> algorithm_;
+};
+
+/// @brief Incremental SHA-256 calculation
+class Sha256Hasher final : public Hasher {
+ public:
+  Sha256Hasher();
+};
+
+/// @brief Incremental SHA-512 calculation
+class Sha512Hasher final : public Hasher {
+ public:
+  Sha512Hasher();
+};
+
+/// @brief Incremental HMAC (using SHA-256 hash) calculation
+class HmacSha256Hasher final : public Hasher {
+ public:
+  /// @param key HMAC key
+  /// @throws CryptoException internal library exception
+  explicit HmacSha256Hasher(std::string_view key);
+};
+
+/// @brief Incremental HMAC (using SHA-512 hash) calculation
+class HmacSha512Hasher final : public Hasher {
+ public:
+  /// @param key HMAC key
+  /// @throws CryptoException internal library exception
+  explicit HmacSha512Hasher(std::string_view key);
+};
+
 }  // namespace crypto::hash
 
 USERVER_NAMESPACE_END
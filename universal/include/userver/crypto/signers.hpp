@@ -66,6 +66,9 @@ using SignerHs512 = HmacShaSigner<DigestSize::k512>;
 template <DsaType type, DigestSize bits>
 class DsaSigner final : public Signer {
  public:
+  /// Constructor from private key
+  explicit DsaSigner(PrivateKey privkey);
+
   /// Constructor from a PEM-encoded private key and an optional passphrase
   explicit DsaSigner(const std::string& privkey,
                      const std::string& password = {});
@@ -80,6 +83,7 @@ class DsaSigner final : public Signer {
 
  private:
   PrivateKey pkey_;
+  std::shared_ptr<const EVP_MD_CTX> initialized_ctx_;
 };
 
 /// @name Outputs RSASSA signature using SHA-2 and PKCS1 padding.
@@ -86,6 +86,7 @@ class DsaVerifier final : public Verifier {
 
  private:
   PublicKey pkey_;
+  std::shared_ptr<const EVP_MD_CTX> initialized_ctx_;
 };
 
 /// @name Verifies RSASSA signature using SHA-2 and PKCS1 padding.
@@ -19,10 +19,12 @@
 
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iosfwd>
 #include <istream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <optional>
@@ -125,6 +127,14 @@ template <typename RoundPolicy>
 constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
   if (divisor == 0) throw DivisionByZeroError();
 
+  // The common case of a small product avoids the slow 128-bit division, the
+  // rounding of prod / divisor is equal to the rounding of the remainder below
+  int64_t prod64{};
+  if (!__builtin_mul_overflow(value1, value2, &prod64) &&
+      prod64 > kMinInt64 / 2 && prod64 < kMaxInt64 / 2) {
+    return Div<RoundPolicy>(prod64, divisor);
+  }
+
 #if __x86_64__ || __ppc64__ || __aarch64__
   using LongInt = __int128_t;
   static_assert(sizeof(void*) == 8);
@@ -814,6 +824,86 @@ constexpr T decimal_cast(Decimal<OldPrec, OldRound> arg) {
 
 namespace impl {
 
+template <typename Range>
+using RangeElement =
+    std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>;
+
+// The values are split into the high and the low 32-bit halves, the sums of
+// the halves cannot overflow for 2^31 values. The loop has no branches and
+// no signed shifts, which lets the compiler vectorize it.
+template <int Prec, typename RoundPolicy>
+int64_t SumUnbiased(const Decimal<Prec, RoundPolicy>* values,
+                    std::size_t size) {
+  constexpr std::size_t kBlockSize = std::size_t{1} << 31;
+  constexpr uint64_t kLowMask = 0xffffffff;
+
+  int64_t result = 0;
+  for (std::size_t begin = 0; begin < size; begin += kBlockSize) {
+    const std::size_t end =
+        size - begin < kBlockSize ? size : begin + kBlockSize;
+
+    uint64_t high_sum = 0;
+    uint64_t low_sum = 0;
+    uint64_t negative_count = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+      const auto bits = static_cast<uint64_t>(values[i].AsUnbiased());
+      high_sum += bits >> 32;
+      low_sum += bits & kLowMask;
+      negative_count += bits >> 63;
+    }
+
+    // the high half of a negative value is 2^32 less than its bits
+    int64_t signed_high_sum = static_cast<int64_t>(high_sum) -
+                              static_cast<int64_t>(negative_count << 32) +
+                              static_cast<int64_t>(low_sum >> 32);
+    int64_t block_sum{};
+    if (__builtin_mul_overflow(signed_high_sum, int64_t{1} << 32,
+                               &block_sum) ||
+        __builtin_add_overflow(block_sum,
+                               static_cast<int64_t>(low_sum & kLowMask),
+                               &block_sum) ||
+        __builtin_add_overflow(result, block_sum, &result)) {
+      throw OutOfBoundsError();
+    }
+  }
+  return result;
+}
+
+}  // namespace impl
+
+/// @brief Sums a contiguous range of `Decimal`s, e.g. a `std::vector`
+///
+/// Faster than adding the values one by one. Only the total is checked for
+/// overflow, intermediate sums may be out of bounds.
+///
+/// @throw decimal64::OutOfBoundsError if the sum does not fit in the `Decimal`
+template <typename Range>
+auto Sum(const Range& values) {
+  using Dec = std::remove_const_t<impl::RangeElement<const Range>>;
+  static_assert(kIsDecimal<Dec>, "Sum expects a contiguous range of Decimal");
+  return Dec::FromUnbiased(
+      impl::SumUnbiased(std::data(values), std::size(values)));
+}
+
+/// @brief Multiplies each of the `Decimal`s of a contiguous range by `factor`
+/// in place, rounding according to their `RoundPolicy`
+///
+/// `factor` may be a `Decimal` or an integer.
+///
+/// @throw decimal64::OutOfBoundsError on overflow, the preceding values are
+/// already scaled in that case
+template <typename Range, typename Factor>
+void Scale(Range&& values, Factor factor) {
+  using Dec = impl::RangeElement<Range>;
+  static_assert(kIsDecimal<std::remove_const_t<Dec>> && !std::is_const_v<Dec>,
+                "Scale expects a mutable contiguous range of Decimal");
+  Dec* const data = std::data(values);
+  const std::size_t size = std::size(values);
+  for (std::size_t i = 0; i < size; ++i) data[i] *= factor;
+}
+
+namespace impl {
+
 // FromUnpacked<Decimal<4>>(12, 34) -> 12.0034
 // FromUnpacked<Decimal<4>>(-12, -34) -> -12.0034
 // FromUnpacked<Decimal<4>>(0, -34) -> -0.0034
@@ -1182,6 +1272,47 @@ template <typename CharSequence>
           is_negative, error, static_cast<uint32_t>(position)};
 }
 
+// Parses the common "-?\d+(\.\d+)?" inputs that need no rounding in a
+// single pass, nullopt means that Parse must be used to get the result or
+// the error
+template <int Prec, typename RoundPolicy>
+constexpr std::optional<Decimal<Prec, RoundPolicy>> ParseFast(
+    std::string_view input) {
+  const auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+
+  std::size_t pos = 0;
+  const bool is_negative = !input.empty() && input[0] == '-';
+  if (is_negative) ++pos;
+
+  int64_t before = 0;
+  const auto before_begin = pos;
+  while (pos < input.size() && is_digit(input[pos]) &&
+         pos - before_begin < kMaxDecimalDigits) {
+    before = 10 * before + (input[pos] - '0');
+    ++pos;
+  }
+  if (pos == before_begin || before >= kMaxInt64 / kPow10<Prec>) return {};
+
+  int64_t after = 0;
+  int after_digit_count = 0;
+  if (pos < input.size() && input[pos] == '.') {
+    ++pos;
+    while (pos < input.size() && is_digit(input[pos]) &&
+           after_digit_count < Prec) {
+      after = 10 * after + (input[pos] - '0');
+      ++after_digit_count;
+      ++pos;
+    }
+    if (after_digit_count == 0) return {};
+  }
+  if (pos != input.size()) return {};
+
+  const int64_t result =
+      before * kPow10<Prec> + after * Pow10(Prec - after_digit_count);
+  return Decimal<Prec, RoundPolicy>::FromUnbiased(is_negative ? -result
+                                                              : result);
+}
+
 template <int Prec, typename RoundPolicy>
 struct ParseResult {
   Decimal<Prec, RoundPolicy> decimal;
@@ -1233,6 +1364,11 @@ std::string ToString(int64_t before, int64_t after, int precision,
 
 template <int Prec, typename RoundPolicy>
 constexpr Decimal<Prec, RoundPolicy>::Decimal(std::string_view value) {
+  if (const auto fast_result = impl::ParseFast<Prec, RoundPolicy>(value)) {
+    *this = *fast_result;
+    return;
+  }
+
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(value), impl::ParseOptions::kNone);
 
@@ -1377,6 +1513,9 @@ std::enable_if_t<formats::common::kIsFormatValue<Value>,
                  Decimal<Prec, RoundPolicy>>
 Parse(const Value& value, formats::parse::To<Decimal<Prec, RoundPolicy>>) {
   const std::string input = value.template As<std::string>();
+  if (const auto fast_result = impl::ParseFast<Prec, RoundPolicy>(input)) {
+    return *fast_result;
+  }
 
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(std::string_view{input}),
@@ -0,0 +1,118 @@
+#pragma once
+
+/// @file userver/formats/json/compact_value.hpp
+/// @brief @copybrief formats::json::CompactValue
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/formats/serialize/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+class CompactBuilder;
+}  // namespace impl
+
+/// @brief Thread safe dictionary of the interned object keys, that may be
+/// shared by many formats::json::CompactValue
+///
+/// The dictionary only grows, so share it between the values with the same
+/// set of keys, e.g. between the entries of a cache.
+class CompactKeyDictionary final {
+ public:
+  CompactKeyDictionary();
+  CompactKeyDictionary(const CompactKeyDictionary&) = delete;
+  CompactKeyDictionary& operator=(const CompactKeyDictionary&) = delete;
+  ~CompactKeyDictionary();
+
+  /// @returns count of the distinct keys
+  std::size_t GetSize() const;
+
+ private:
+  friend class impl::CompactBuilder;
+
+  // The returned string is never moved or destroyed before the dictionary
+  const std::string& Intern(std::string_view key);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @ingroup userver_containers userver_formats
+///
+/// @brief Compact immutable representation of JSON for the long-living data,
+/// e.g. for the caches of JSON documents.
+///
+/// All the nodes are stored in a single flat array of 16 bytes per node, all
+/// string values are stored in a single buffer, and the object keys are
+/// interned into a formats::json::CompactKeyDictionary.
+///
+/// Convert to formats::json::Value with `ValueBuilder{compact}.ExtractValue()`,
+/// from formats::json::Value with `value.As<CompactValue>()`. Writing with
+/// formats::json::StringBuilder and dumping do not build the intermediate
+/// formats::json::Value.
+class CompactValue final {
+ public:
+  /// Constructs a null value
+  CompactValue();
+
+  /// Compacts the value, keys go to the own dictionary of the value
+  explicit CompactValue(const Value& value);
+
+  /// Compacts the value, keys go to the shared dictionary
+  CompactValue(const Value& value,
+               std::shared_ptr<CompactKeyDictionary> dictionary);
+
+  CompactValue(const CompactValue&) = default;
+  CompactValue(CompactValue&&) noexcept = default;
+  CompactValue& operator=(const CompactValue&) = default;
+  CompactValue& operator=(CompactValue&&) noexcept = default;
+  ~CompactValue();
+
+  /// @brief Parses JSON string directly into the compact representation
+  /// @throws formats::json::ParseException on invalid JSON
+  static CompactValue FromString(
+      std::string_view json,
+      std::shared_ptr<CompactKeyDictionary> dictionary = {});
+
+  bool IsNull() const noexcept;
+
+  /// @returns the count of bytes owned by the value, excluding the shared
+  /// dictionary
+  std::size_t GetMemoryUsage() const noexcept;
+
+ private:
+  struct Data;
+
+  explicit CompactValue(std::shared_ptr<const Data> data);
+
+  Value ToValue() const;
+
+  // Passes the SAX events of the value to the rapidjson handler
+  template <typename Handler>
+  void Accept(Handler& handler) const;
+
+  std::shared_ptr<const Data> data_;
+
+  friend class StringBuilder;
+  friend class impl::CompactBuilder;
+  friend Value Serialize(const CompactValue&, formats::serialize::To<Value>);
+};
+
+/// @returns JSON string of the value
+std::string ToString(const CompactValue& value);
+
+Value Serialize(const CompactValue& value, formats::serialize::To<Value>);
+
+CompactValue Parse(const Value& value, formats::parse::To<CompactValue>);
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -41,6 +41,9 @@ class MutableValueWrapper {
 
   void OnMembersChange();
 
+  // The allocator of the root value
+  Allocator& GetAllocator();
+
  private:
   struct JsonPath;
   struct Impl;
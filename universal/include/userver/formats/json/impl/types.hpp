@@ -25,11 +25,13 @@ using formats::common::Type;
 class Value;
 
 namespace impl {
+class Allocator;
+
 // rapidjson integration
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator,
-                                              ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, Allocator>;
+using Document =
+    ::rapidjson::GenericDocument<UTF8, Allocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
  public:
@@ -40,6 +42,10 @@ class VersionedValuePtr final {
   template <typename... Args>
   static VersionedValuePtr Create(Args&&... args);
 
+  // Creates a null value, the nodes of which are allocated from an arena
+  // owned by the root
+  static VersionedValuePtr CreateWithArena();
+
   VersionedValuePtr(const VersionedValuePtr&) = default;
   VersionedValuePtr(VersionedValuePtr&&) = default;
   VersionedValuePtr& operator=(const VersionedValuePtr&) = default;
@@ -61,6 +67,9 @@ class VersionedValuePtr final {
   size_t Version() const;
   void BumpVersion();
 
+  // The allocator for the nodes of the value
+  Allocator& GetAllocator();
+
  private:
   struct Data;
 
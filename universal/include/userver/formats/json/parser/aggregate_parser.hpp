@@ -0,0 +1,201 @@
+#pragma once
+
+/// @file userver/formats/json/parser/aggregate_parser.hpp
+/// @brief @copybrief formats::json::parser::AggregateParser
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/json/parser/default_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+namespace impl {
+
+// Parser that skips any JSON value
+class SkipParser final : public BaseParser {
+ public:
+  void Reset() { level_ = 0; }
+
+  BaseParser& GetParser() { return *this; }
+
+ protected:
+  void Null() override { MaybePopSelf(); }
+  void Bool(bool) override { MaybePopSelf(); }
+  void Int64(int64_t) override { MaybePopSelf(); }
+  void Uint64(uint64_t) override { MaybePopSelf(); }
+  void Double(double) override { MaybePopSelf(); }
+  void String(std::string_view) override { MaybePopSelf(); }
+  void StartObject() override { ++level_; }
+  void Key(std::string_view) override {}
+  void EndObject() override {
+    --level_;
+    MaybePopSelf();
+  }
+  void StartArray() override { ++level_; }
+  void EndArray() override {
+    --level_;
+    MaybePopSelf();
+  }
+
+  std::string Expected() const override { return "value"; }
+
+  std::string GetPathItem() const override { return {}; }
+
+ private:
+  void MaybePopSelf() {
+    if (level_ == 0) parser_state_->PopMe(*this);
+  }
+
+  std::size_t level_{0};
+};
+
+}  // namespace impl
+
+/// @brief SAX parser for the aggregate structs, owns the parsers of the fields
+///
+/// The JSON names of the fields are returned by a `GetJsonFieldNames` function
+/// in the namespace of the type, in the order of the fields:
+///
+/// ~~~~~~~~~~~~~~{.cpp}
+/// struct Item {
+///   std::int64_t id;
+///   std::string title;
+///   std::optional<std::vector<std::string>> tags;
+/// };
+///
+/// constexpr auto GetJsonFieldNames(formats::parse::To<Item>) {
+///   return std::array<std::string_view, 3>{"id", "title", "tags"};
+/// }
+/// ~~~~~~~~~~~~~~
+///
+/// The fields are parsed with formats::json::parser::DefaultParser. All the
+/// fields are required, except for the std::optional ones. Unknown fields are
+/// skipped.
+
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  static constexpr std::size_t kFieldsCount = boost::pfr::tuple_size_v<T>;
+
+  AggregateParser()
+      : sinks_(MakeSinks(std::make_index_sequence<kFieldsCount>{})) {
+    const auto names = GetJsonFieldNames(formats::parse::To<T>{});
+    static_assert(std::tuple_size_v<decltype(names)> == kFieldsCount,
+                  "GetJsonFieldNames must return a name for each field");
+    for (std::size_t i = 0; i < kFieldsCount; ++i) names_[i] = names[i];
+  }
+
+  AggregateParser(const AggregateParser&) = delete;
+  AggregateParser& operator=(const AggregateParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    seen_ = {};
+    result_ = T{};
+  }
+
+ protected:
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("object");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    key_ = key;
+    for (std::size_t i = 0; i < kFieldsCount; ++i) {
+      if (names_[i] == key) {
+        seen_[i] = true;
+        PushField(i, std::make_index_sequence<kFieldsCount>{});
+        return;
+      }
+    }
+
+    skip_parser_.Reset();
+    this->parser_state_->PushParser(skip_parser_);
+  }
+
+  void EndObject() override {
+    CheckRequired(std::make_index_sequence<kFieldsCount>{});
+    this->SetResult(std::move(result_));
+  }
+
+  std::string Expected() const override { return "object"; }
+
+  std::string GetPathItem() const override { return key_; }
+
+ private:
+  template <std::size_t Index>
+  using Field = boost::pfr::tuple_element_t<Index, T>;
+
+  template <std::size_t... Indices>
+  auto MakeSinks(std::index_sequence<Indices...>) {
+    return typename Fields::Sinks{
+        SubscriberSink<Field<Indices>>{boost::pfr::get<Indices>(result_)}...};
+  }
+
+  template <std::size_t... Indices>
+  void PushField(std::size_t index, std::index_sequence<Indices...>) {
+    ((Indices == index ? PushParser(std::get<Indices>(parsers_),
+                                    std::get<Indices>(sinks_))
+                       : void()),
+     ...);
+  }
+
+  template <typename Parser, typename Sink>
+  void PushParser(Parser& parser, Sink& sink) {
+    parser.Reset();
+    parser.Subscribe(sink);
+    this->parser_state_->PushParser(parser.GetParser());
+  }
+
+  template <std::size_t... Indices>
+  void CheckRequired(std::index_sequence<Indices...>) {
+    ((meta::kIsOptional<Field<Indices>> || seen_[Indices]
+          ? void()
+          : throw InternalParseError("Missing required field '" +
+                                     std::string(names_[Indices]) + "'")),
+     ...);
+  }
+
+  template <typename Sequence>
+  struct Storage;
+
+  template <std::size_t... Indices>
+  struct Storage<std::index_sequence<Indices...>> {
+    using Sinks = std::tuple<SubscriberSink<Field<Indices>>...>;
+    using Parsers = std::tuple<DefaultParser<Field<Indices>>...>;
+  };
+
+  using Fields = Storage<std::make_index_sequence<kFieldsCount>>;
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  T result_{};
+  std::array<std::string_view, kFieldsCount> names_{};
+  std::array<bool, kFieldsCount> seen_{};
+  typename Fields::Sinks sinks_;
+  typename Fields::Parsers parsers_;
+  impl::SkipParser skip_parser_;
+  std::string key_;
+  State state_{State::kStart};
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
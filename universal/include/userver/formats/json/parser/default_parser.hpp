@@ -0,0 +1,177 @@
+#pragma once
+
+/// @file userver/formats/json/parser/default_parser.hpp
+/// @brief formats::json::parser::DefaultParser - ready made SAX parsers for
+/// the common types
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/map_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/optional_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/json/parser/variant_parser.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+template <typename T>
+class AggregateParser;
+
+namespace impl {
+
+// Proxy parser that owns the parser of the items of a container
+template <typename Parser, typename ItemParser>
+class ParserWithItem final {
+ public:
+  using ResultType = typename Parser::ResultType;
+
+  ParserWithItem() : parser_(item_parser_) {}
+
+  ParserWithItem(const ParserWithItem&) = delete;
+  ParserWithItem& operator=(const ParserWithItem&) = delete;
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return parser_.GetParser(); }
+
+ private:
+  ItemParser item_parser_;
+  Parser parser_;
+};
+
+template <typename T, typename = void>
+struct DefaultParser final {
+  static_assert(std::is_aggregate_v<T> && !meta::kIsRange<T>,
+                "There is no default SAX parser for the type. Write a "
+                "TypedParser or include "
+                "<userver/formats/json/parser/aggregate_parser.hpp> for "
+                "aggregates");
+
+  using Type = AggregateParser<T>;
+};
+
+template <typename T>
+using DefaultParserType = typename DefaultParser<T>::Type;
+
+template <>
+struct DefaultParser<bool> final {
+  using Type = BoolParser;
+};
+
+template <>
+struct DefaultParser<std::int32_t> final {
+  using Type = Int32Parser;
+};
+
+template <>
+struct DefaultParser<std::int64_t> final {
+  using Type = Int64Parser;
+};
+
+template <>
+struct DefaultParser<double> final {
+  using Type = DoubleParser;
+};
+
+template <>
+struct DefaultParser<float> final {
+  using Type = FloatParser;
+};
+
+template <>
+struct DefaultParser<std::string> final {
+  using Type = StringParser;
+};
+
+template <>
+struct DefaultParser<formats::json::Value> final {
+  using Type = JsonValueParser;
+};
+
+template <typename T>
+struct DefaultParser<std::vector<T>> final {
+  using Type = ParserWithItem<ArrayParser<T, DefaultParserType<T>>,
+                              DefaultParserType<T>>;
+};
+
+template <typename T>
+struct DefaultParser<std::set<T>> final {
+  using Type = ParserWithItem<ArrayParser<T, DefaultParserType<T>, std::set<T>>,
+                              DefaultParserType<T>>;
+};
+
+template <typename T>
+struct DefaultParser<std::unordered_set<T>> final {
+  using Type = ParserWithItem<
+      ArrayParser<T, DefaultParserType<T>, std::unordered_set<T>>,
+      DefaultParserType<T>>;
+};
+
+template <typename T>
+struct DefaultParser<std::map<std::string, T>> final {
+  using Type = ParserWithItem<
+      MapParser<std::map<std::string, T>, DefaultParserType<T>>,
+      DefaultParserType<T>>;
+};
+
+template <typename T>
+struct DefaultParser<std::unordered_map<std::string, T>> final {
+  using Type = ParserWithItem<
+      MapParser<std::unordered_map<std::string, T>, DefaultParserType<T>>,
+      DefaultParserType<T>>;
+};
+
+template <typename T>
+struct DefaultParser<std::optional<T>> final {
+  using Type = ParserWithItem<OptionalParser<T, DefaultParserType<T>>,
+                              DefaultParserType<T>>;
+};
+
+template <typename... Types>
+struct DefaultParser<std::variant<Types...>> final {
+  using Type = VariantParser<DefaultParserType<Types>...>;
+};
+
+}  // namespace impl
+
+/// @brief SAX parser of the type T, that owns all of its subparsers
+///
+/// Available for bool, std::int32_t, std::int64_t, double, float, std::string,
+/// formats::json::Value, std::vector, std::set, std::unordered_set,
+/// std::map and std::unordered_map with std::string keys, std::optional,
+/// std::variant and for the aggregates (see
+/// formats::json::parser::AggregateParser).
+template <typename T>
+using DefaultParser = impl::DefaultParserType<T>;
+
+/// Parses the input with formats::json::parser::DefaultParser<T>
+template <typename T>
+T ParseToType(std::string_view input) {
+  return ParseToType<T, DefaultParser<T>>(input);
+}
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <optional>
+
+#include <userver/formats/json/parser/typed_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+/// Parser for null or value -> std::optional
+template <typename Item, typename ItemParser>
+class OptionalParser final : public TypedParser<std::optional<Item>>,
+                             public Subscriber<Item> {
+ public:
+  explicit OptionalParser(ItemParser& item_parser)
+      : item_parser_(item_parser) {
+    this->item_parser_.Subscribe(*this);
+  }
+
+ protected:
+  void Null() override { this->SetResult(std::nullopt); }
+
+  void Bool(bool b) override {
+    PushParser();
+    Parser().Bool(b);
+  }
+  void Int64(int64_t i) override {
+    PushParser();
+    Parser().Int64(i);
+  }
+  void Uint64(uint64_t i) override {
+    PushParser();
+    Parser().Uint64(i);
+  }
+  void Double(double d) override {
+    PushParser();
+    Parser().Double(d);
+  }
+  void String(std::string_view sw) override {
+    PushParser();
+    Parser().String(sw);
+  }
+  void StartObject() override {
+    PushParser();
+    Parser().StartObject();
+  }
+  void StartArray() override {
+    PushParser();
+    Parser().StartArray();
+  }
+
+  std::string Expected() const override { return "null or value"; }
+
+  std::string GetPathItem() const override { return {}; }
+
+ private:
+  void PushParser() {
+    this->item_parser_.Reset();
+    this->parser_state_->PushParser(item_parser_.GetParser());
+  }
+
+  void OnSend(Item&& item) override {
+    this->SetResult(std::optional<Item>{std::move(item)});
+  }
+
+  BaseParser& Parser() { return item_parser_.GetParser(); }
+
+  ItemParser& item_parser_;
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <userver/formats/json/parser/aggregate_parser.hpp>
 #include <userver/formats/json/parser/array_parser.hpp>
 #include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/default_parser.hpp>
 #include <userver/formats/json/parser/int_parser.hpp>
 #include <userver/formats/json/parser/map_parser.hpp>
 #include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/optional_parser.hpp>
 #include <userver/formats/json/parser/parser_json.hpp>
 #include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/variant_parser.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include <userver/utils/fast_pimpl.hpp>
@@ -26,6 +27,13 @@ class ParserState final {
 
   void PopMe(BaseParser& parser);
 
+  /// Returns the count of parsers on the stack
+  std::size_t GetStackSize() const;
+
+  /// Pops the parsers until `size` of them remain on the stack. Used by the
+  /// parsers that try several subparsers on the same token.
+  void PopUntil(std::size_t size);
+
   [[noreturn]] void ThrowError(const std::string& err_msg);
 
  private:
@@ -163,7 +163,7 @@ T ParseToType(std::string_view input) {
   parser.Subscribe(sink);
 
   ParserState state;
-  state.PushParser(parser);
+  state.PushParser(parser.GetParser());
   state.ProcessInput(input);
 
   return result;
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include <userver/formats/json/parser/typed_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+namespace impl {
+
+template <template <std::size_t> class Item, typename Sequence>
+struct IndexedTuple;
+
+template <template <std::size_t> class Item, std::size_t... Indices>
+struct IndexedTuple<Item, std::index_sequence<Indices...>> {
+  using Type = std::tuple<Item<Indices>...>;
+};
+
+}  // namespace impl
+
+/// @brief Parser for std::variant. Owns the parsers of the alternatives.
+///
+/// The first alternative that accepts the first token of the value is chosen,
+/// e.g. std::variant<std::int64_t, std::string> is parsed from both `1` and
+/// `"1"`. Alternatives that accept the same tokens (e.g. two objects) are not
+/// distinguished, the first one wins.
+template <typename... ItemParsers>
+class VariantParser final
+    : public TypedParser<std::variant<typename ItemParsers::ResultType...>> {
+ public:
+  using Variant = std::variant<typename ItemParsers::ResultType...>;
+
+  VariantParser()
+      : subscribers_(MakeSubscribers(
+            std::make_index_sequence<sizeof...(ItemParsers)>{})) {
+    SubscribeAll(std::make_index_sequence<sizeof...(ItemParsers)>{});
+  }
+
+  VariantParser(const VariantParser&) = delete;
+  VariantParser& operator=(const VariantParser&) = delete;
+
+  void Reset() override {
+    trying_ = false;
+    result_.reset();
+  }
+
+ protected:
+  void Null() override {
+    Try("null", [](BaseParser& parser) { parser.Null(); });
+  }
+  void Bool(bool b) override {
+    Try("bool", [b](BaseParser& parser) { parser.Bool(b); });
+  }
+  void Int64(int64_t i) override {
+    Try("integer", [i](BaseParser& parser) { parser.Int64(i); });
+  }
+  void Uint64(uint64_t i) override {
+    Try("integer", [i](BaseParser& parser) { parser.Uint64(i); });
+  }
+  void Double(double d) override {
+    Try("double", [d](BaseParser& parser) { parser.Double(d); });
+  }
+  void String(std::string_view sw) override {
+    Try("string", [sw](BaseParser& parser) { parser.String(sw); });
+  }
+  void StartObject() override {
+    Try("object", [](BaseParser& parser) { parser.StartObject(); });
+  }
+  void StartArray() override {
+    Try("array", [](BaseParser& parser) { parser.StartArray(); });
+  }
+
+  std::string Expected() const override {
+    return "one of the variant alternatives";
+  }
+
+  std::string GetPathItem() const override { return {}; }
+
+ private:
+  template <std::size_t Index>
+  class AlternativeSubscriber final
+      : public Subscriber<std::variant_alternative_t<Index, Variant>> {
+   public:
+    explicit AlternativeSubscriber(VariantParser& parser) : parser_(parser) {}
+
+    void OnSend(std::variant_alternative_t<Index, Variant>&& value) override {
+      parser_.OnAlternative(Variant{std::in_place_index<Index>,
+                                    std::move(value)});
+    }
+
+   private:
+    VariantParser& parser_;
+  };
+
+  template <std::size_t... Indices>
+  auto MakeSubscribers(std::index_sequence<Indices...>) {
+    return std::tuple<AlternativeSubscriber<Indices>...>{
+        AlternativeSubscriber<Indices>{*this}...};
+  }
+
+  template <std::size_t... Indices>
+  void SubscribeAll(std::index_sequence<Indices...>) {
+    (std::get<Indices>(parsers_).Subscribe(std::get<Indices>(subscribers_)),
+     ...);
+  }
+
+  template <typename Token>
+  void Try(std::string_view what, const Token& token) {
+    trying_ = true;
+    const bool accepted = std::apply(
+        [this, &token](auto&... parsers) {
+          return (TryAlternative(parsers, token) || ...);
+        },
+        parsers_);
+    trying_ = false;
+
+    if (!accepted) this->Throw(std::string(what));
+
+    // A scalar alternative has finished on its first token
+    if (result_) this->SetResult(std::move(*result_));
+  }
+
+  template <typename ItemParser, typename Token>
+  bool TryAlternative(ItemParser& item_parser, const Token& token) {
+    const auto stack_size = this->parser_state_->GetStackSize();
+    item_parser.Reset();
+    this->parser_state_->PushParser(item_parser.GetParser());
+    try {
+      token(item_parser.GetParser());
+      return true;
+    } catch (const InternalParseError&) {
+      this->parser_state_->PopUntil(stack_size);
+      return false;
+    }
+  }
+
+  void OnAlternative(Variant&& value) {
+    if (trying_) {
+      result_.emplace(std::move(value));
+    } else {
+      this->SetResult(std::move(value));
+    }
+  }
+
+  using Subscribers = typename impl::IndexedTuple<
+      AlternativeSubscriber,
+      std::index_sequence_for<ItemParsers...>>::Type;
+
+  std::tuple<ItemParsers...> parsers_;
+  Subscribers subscribers_;
+  std::optional<Variant> result_;
+  bool trying_{false};
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json {
 
+class CompactValue;
+
 // clang-format off
 
 /// @ingroup userver_containers userver_formats userver_formats_serialize_sax
@@ -82,6 +84,8 @@ class StringBuilder final : public serialize::SaxStream {
 
   void WriteValue(const Value& value);
 
+  void WriteValue(const CompactValue& value);
+
  private:
   struct Impl;
   utils::FastPimpl<Impl, 112, 8> impl_;
@@ -98,10 +102,22 @@ void WriteToStream(double value, StringBuilder& sw);
 void WriteToStream(const char* value, StringBuilder& sw);
 void WriteToStream(std::string_view value, StringBuilder& sw);
 void WriteToStream(const formats::json::Value& value, StringBuilder& sw);
+void WriteToStream(const CompactValue& value, StringBuilder& sw);
 void WriteToStream(const std::string& value, StringBuilder& sw);
 
 void WriteToStream(std::chrono::system_clock::time_point tp, StringBuilder& sw);
 
+/// @brief Serializes the value to JSON string via WriteToStream, without
+/// building an intermediate formats::json::Value
+///
+/// WriteToStream for the type must be visible at the point of call.
+template <typename T>
+std::string ToStringViaSax(const T& value) {
+  StringBuilder sw;
+  WriteToStream(value, sw);
+  return sw.GetString();
+}
+
 }  // namespace formats::json
 
 USERVER_NAMESPACE_END
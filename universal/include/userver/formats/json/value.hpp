@@ -267,6 +267,7 @@ class Value final {
   friend class Iterator;
   friend class ValueBuilder;
   friend class StringBuilder;
+  friend class CompactValue;
   friend class impl::InlineObjectBuilder;
   friend class impl::InlineArrayBuilder;
   friend class impl::MutableValueWrapper;
@@ -4,7 +4,10 @@
 /// @brief @copybrief formats::json::ValueBuilder
 
 #include <chrono>
+#include <cstdint>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include <userver/formats/common/meta.hpp>
@@ -17,6 +20,27 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json {
 
+/// @brief Tag for the formats::json::ValueBuilder constructor, that allocates
+/// the nodes of the value from an arena
+struct ArenaTag final {
+  explicit constexpr ArenaTag() noexcept = default;
+};
+
+/// @brief The formats::json::ArenaTag value
+inline constexpr ArenaTag kArena{};
+
+namespace impl {
+
+template <typename T>
+inline constexpr bool kIsScalar =
+    std::is_same_v<T, bool> || std::is_same_v<T, int> ||
+    std::is_same_v<T, unsigned int> || std::is_same_v<T, std::int64_t> ||
+    std::is_same_v<T, std::uint64_t> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double> || std::is_same_v<T, std::string> ||
+    std::is_same_v<T, std::string_view> || std::is_same_v<T, const char*>;
+
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_containers userver_formats
@@ -55,6 +79,19 @@ class ValueBuilder final {
   /// Constructs a valueBuilder that holds default value for provided `type`.
   ValueBuilder(Type type);
 
+  /// @brief Constructs a ValueBuilder that holds default value for provided
+  /// `type` and allocates the nodes of the value from a monotonic arena.
+  ///
+  /// The arena is released at once along with the last formats::json::Value
+  /// that references the built value, so building a large value takes a few
+  /// allocations instead of allocations per each string, array and object.
+  /// The memory of the removed or overwritten nodes is not reused until then,
+  /// so prefer the arena for the values that are built once, e.g. responses.
+  ///
+  /// Moving the root builder or the extracted value into a new root keeps the
+  /// arena, while putting it into another value copies the nodes.
+  ValueBuilder(ArenaTag, Type type = Type::kObject);
+
   /// @brief Transfers the `ValueBuilder` object
   /// @see formats::common::TransferTag for the transfer semantics
   ValueBuilder(common::TransferTag, ValueBuilder&&) noexcept;
@@ -85,6 +122,27 @@ class ValueBuilder final {
   template <typename T>
   ValueBuilder(const T& t) : ValueBuilder(DoSerialize(t)) {}
 
+  /// @brief Assigns the scalar in place, without a temporary ValueBuilder.
+  /// The strings are allocated by the allocator of the root value.
+  template <typename T>
+  std::enable_if_t<impl::kIsScalar<T>, ValueBuilder&> operator=(const T& t) {
+    if constexpr (std::is_same_v<T, std::string> ||
+                  std::is_same_v<T, const char*>) {
+      AssignScalar(std::string_view{t});
+    } else {
+      AssignScalar(t);
+    }
+    return *this;
+  }
+
+  /// @brief Assigns the string literal in place, without a temporary
+  /// ValueBuilder.
+  template <std::size_t N>
+  ValueBuilder& operator=(const char (&str)[N]) {
+    AssignScalar(std::string_view{str});
+    return *this;
+  }
+
   /// @brief Access member by key for modification.
   /// @throw `TypeMismatchException` if not object or null value.
   ValueBuilder operator[](std::string key);
@@ -181,8 +239,18 @@ class ValueBuilder final {
 
   explicit ValueBuilder(impl::MutableValueWrapper) noexcept;
 
-  static void Copy(impl::Value& to, const ValueBuilder& from);
-  static void Move(impl::Value& to, ValueBuilder&& from);
+  impl::Value& PrepareAssignment();
+  void AssignScalar(bool t);
+  void AssignScalar(int t);
+  void AssignScalar(unsigned int t);
+  void AssignScalar(std::int64_t t);
+  void AssignScalar(std::uint64_t t);
+  void AssignScalar(float t);
+  void AssignScalar(double t);
+  void AssignScalar(std::string_view t);
+
+  void Copy(impl::Value& to, const ValueBuilder& from);
+  void Move(impl::Value& to, ValueBuilder&& from);
 
   impl::Value& AddMember(std::string_view key, CheckMemberExists);
 
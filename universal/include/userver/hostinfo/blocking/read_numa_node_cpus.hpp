@@ -0,0 +1,21 @@
+#pragma once
+
+/// @file userver/hostinfo/blocking/read_numa_node_cpus.hpp
+/// @brief @copybrief hostinfo::blocking::ReadNumaNodeCpus
+
+#include <cstddef>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::blocking {
+
+/// @brief Reads the list of CPUs that belong to the NUMA node from
+/// `/sys/devices/system/node/node<N>/cpulist`.
+/// @throw `std::runtime_error` if the file cannot be read or parsed.
+/// @warning This is a blocking function.
+std::vector<std::size_t> ReadNumaNodeCpus(std::size_t numa_node);
+
+}  // namespace hostinfo::blocking
+
+USERVER_NAMESPACE_END
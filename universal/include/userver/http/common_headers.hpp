@@ -125,6 +125,7 @@ inline constexpr PredefinedHeader kCookie{"Cookie"};
 inline constexpr PredefinedHeader kXYaRequestId{"X-YaRequestId"};
 inline constexpr PredefinedHeader kXYaTraceId{"X-YaTraceId"};
 inline constexpr PredefinedHeader kXYaSpanId{"X-YaSpanId"};
+inline constexpr PredefinedHeader kXYaSampled{"X-YaSampled"};
 inline constexpr PredefinedHeader kXRequestId{"X-RequestId"};
 inline constexpr PredefinedHeader kXBackendServer{"X-Backend-Server"};
 inline constexpr PredefinedHeader kXTaxiEnvoyProxyDstVhost{
@@ -167,6 +168,7 @@ inline constexpr std::string_view kMaxPendingResponses{
     "too-many-pending-responses"};
 inline constexpr std::string_view kGlobal{"global-ratelimit"};
 inline constexpr std::string_view kInFlight{"max-requests-in-flight"};
+inline constexpr std::string_view kQueueTime{"queue-time-limit"};
 }  // namespace ratelimit_reason
 /// @}
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 
@@ -18,18 +20,71 @@ namespace impl {
 // P.S. The hasher is "unsafe" in hash-flood sense.
 struct UnsafeConstexprHasher final {
   constexpr std::size_t operator()(std::string_view str) const noexcept {
+    return Hash<ConstexprLoader>(str);
+  }
+
+  // Same as operator(), but loads the data word-at-a-time, which compilers
+  // can't do for the constexpr loader. Not usable at compile time.
+  std::size_t HashAtRuntime(std::string_view str) const noexcept {
+    return Hash<RuntimeLoader>(str);
+  }
+
+ private:
+  // Although lowercase and uppercase ASCII are indeed 32 (0x20) apart,
+  // this approach makes for instance '[' and '{' equivalent too,
+  // which is obviously broken and is easily exploitable.
+  // However, for expected input (lower/upper-case ASCII letters + dashes)
+  // this just works, and against malicious
+  // input we defend by falling back to case-insensitive SipHash.
+  static constexpr std::uint64_t kDeliberatelyBrokenLowercaseMask =
+      0x2020202020202020UL;
+
+  struct ConstexprLoader final {
+    static constexpr std::uint64_t Load8(const char* data) noexcept {
+      return LoadN(data, 8);
+    }
+
+    static constexpr std::uint64_t LoadN(const char* data,
+                                         std::size_t n) noexcept {
+      std::uint64_t result = kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n));
+      for (std::size_t i = 0; i < n; ++i) {
+        const std::uint8_t c = data[i];
+        result |= static_cast<std::uint64_t>(c) << (8 * i);
+      }
+      return result;
+    }
+  };
+
+  struct RuntimeLoader final {
+    // NOTE: implies LE, as the constexpr loader does.
+    static std::uint64_t Load8(const char* data) noexcept {
+      std::uint64_t result{};
+      std::memcpy(&result, data, 8);
+      return result | kDeliberatelyBrokenLowercaseMask;
+    }
+
+    static std::uint64_t LoadN(const char* data, std::size_t n) noexcept {
+      std::uint64_t result{};
+      std::memcpy(&result, data, n);
+      return result | (kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n)));
+    }
+  };
+
+  template <typename Loader>
+  constexpr std::size_t Hash(std::string_view str) const noexcept {
     constexpr std::uint64_t mul = (0xc6a4a793UL << 32UL) + 0x5bd1e995UL;
 
     std::uint64_t hash = seed_ ^ (str.size() * mul);
     while (str.size() >= 8) {
-      const std::uint64_t data = ShiftMix(Load8(str.data()) * mul) * mul;
+      const std::uint64_t data =
+          ShiftMix(Loader::Load8(str.data()) * mul) * mul;
       hash ^= data;
       hash *= mul;
 
       str = str.substr(8);
     }
     if (!str.empty()) {
-      const std::uint64_t data = LoadN(str.data(), str.size());
+      const std::uint64_t data = Loader::LoadN(str.data(), str.size());
       hash ^= data;
       hash *= mul;
     }
@@ -39,34 +94,10 @@ struct UnsafeConstexprHasher final {
     return hash;
   }
 
- private:
   static constexpr inline std::uint64_t ShiftMix(std::uint64_t v) noexcept {
     return v ^ (v >> 47);
   }
 
-  static constexpr inline std::uint64_t Load8(const char* data) noexcept {
-    return LoadN(data, 8);
-  }
-
-  static constexpr inline std::uint64_t LoadN(const char* data,
-                                              std::size_t n) noexcept {
-    // Although lowercase and uppercase ASCII are indeed 32 (0x20) apart,
-    // this approach makes for instance '[' and '{' equivalent too,
-    // which is obviously broken and is easily exploitable.
-    // However, for expected input (lower/upper-case ASCII letters + dashes)
-    // this just works, and against malicious
-    // input we defend by falling back to case-insensitive SipHash.
-    constexpr std::uint64_t kDeliberatelyBrokenLowercaseMask =
-        0x2020202020202020UL;
-
-    std::uint64_t result = kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n));
-    for (std::size_t i = 0; i < n; ++i) {
-      const std::uint8_t c = data[i];
-      result |= static_cast<std::uint64_t>(c) << (8 * i);
-    }
-    return result;
-  }
-
   // Seed is chosen in such a way that 16 (presumably) most common userver
   // headers don't collide within default size of HeaderMap (32),
   // and that all headers used in userver itself don't collide within minimal
@@ -21,6 +21,10 @@ UrlDecode(std::string_view range);
 /// @brief Encode as URL
 std::string UrlEncode(std::string_view input_string);
 
+/// @brief Encode as URL and append the result to `result`, the same as
+/// UrlEncode but allows reusing the buffer
+void UrlEncodeTo(std::string_view input_string, std::string& result);
+
 using Args = std::unordered_map<std::string, std::string, utils::StrCaseHash>;
 using MultiArgs = std::multimap<std::string, std::string>;
 
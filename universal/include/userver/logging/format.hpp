@@ -10,7 +10,10 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 /// Log formats
-enum class Format { kTskv, kLtsv, kRaw };
+///
+/// `kBinary` is a compact length-prefixed format that is written without
+/// escaping, use the `log_decoder` tool to convert it to TSKV or JSON.
+enum class Format { kTskv, kLtsv, kRaw, kBinary };
 
 /// Parse Format enum from string
 Format FormatFromString(std::string_view format_str);
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Encoding and decoding of the logging::Format::kBinary records
+namespace logging::impl::binary {
+
+// A record is laid out as follows, all the integers are LEB128 varints:
+//
+//   record := kRecordMagic padded_varint(body size) body '\n'
+//   body   := varint(microseconds since epoch) byte(level) field*
+//   field  := varint(key id) [varint(key size) key] varint(value size) value
+//
+// Key id 0 means that the key follows inline, other ids refer to the well
+// known keys (see FindWellKnownKey). Keys and values are written without
+// escaping. The trailing '\n' is appended by the sinks and is optional for
+// the decoder.
+inline constexpr char kRecordMagic = '\xB1';
+
+// The size of a varint with the value reserved before the value is known
+inline constexpr std::size_t kPaddedVarintSize = 4;
+inline constexpr std::size_t kMaxPaddedValue = (std::size_t{1} << 28) - 1;
+
+inline constexpr std::size_t kMaxVarintSize = 10;
+
+/// @returns the id of a well known key or 0
+std::uint64_t FindWellKnownKey(std::string_view key) noexcept;
+
+/// @returns the well known key with the id or std::nullopt
+std::optional<std::string_view> FindWellKnownKey(std::uint64_t id) noexcept;
+
+constexpr std::size_t GetVarintSize(std::uint64_t value) noexcept {
+  std::size_t size = 1;
+  for (; value >= 0x80; value >>= 7) ++size;
+  return size;
+}
+
+/// Writes the varint into `out`, which must have room for kMaxVarintSize
+/// bytes, returns the count of written bytes
+inline std::size_t WriteVarint(char* out, std::uint64_t value) noexcept {
+  std::size_t size = 0;
+  for (; value >= 0x80; value >>= 7) {
+    out[size++] = static_cast<char>((value & 0x7F) | 0x80);
+  }
+  out[size++] = static_cast<char>(value);
+  return size;
+}
+
+/// Writes the varint padded to exactly kPaddedVarintSize bytes, `value` must
+/// not exceed kMaxPaddedValue
+inline void WritePaddedVarint(char* out, std::uint64_t value) noexcept {
+  for (std::size_t i = 0; i + 1 < kPaddedVarintSize; ++i, value >>= 7) {
+    out[i] = static_cast<char>((value & 0x7F) | 0x80);
+  }
+  out[kPaddedVarintSize - 1] = static_cast<char>(value);
+}
+
+struct Field final {
+  std::string_view key;
+  std::string_view value;
+};
+
+struct Record final {
+  std::chrono::system_clock::time_point timestamp;
+  Level level{Level::kNone};
+  // Point into the parsed input or to the static storage
+  std::vector<Field> fields;
+};
+
+/// @brief Parses the record at the beginning of `input` and removes it from
+/// `input`.
+/// @returns std::nullopt if `input` is empty
+/// @throws std::runtime_error if the input is malformed or truncated
+std::optional<Record> ParseRecord(std::string_view& input);
+
+/// Formats the record as the logging::Format::kTskv logger would, with the
+/// timestamp in the local time zone
+std::string ToTskv(const Record& record);
+
+/// Formats the record as a single line JSON object
+std::string ToJson(const Record& record);
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
@@ -78,21 +78,13 @@ USERVER_IMPL_CONSTEVAL TagKey::TagKey(const StringType& escaped_key)
 
 template <typename T>
 void TagWriter::PutTag(TagKey key, const T& value) {
-  lh_.Put(utils::encoding::kTskvPairsSeparator);
-  lh_.Put(key.GetEscapedKey());
-  lh_.PutKeyValueSeparator();
+  lh_.PutTagKey(key.GetEscapedKey());
   lh_ << value;
 }
 
 template <typename T>
 void TagWriter::PutTag(RuntimeTagKey key, const T& value) {
-  lh_.Put(utils::encoding::kTskvPairsSeparator);
-  {
-    const logging::LogHelper::EncodingGuard guard{
-        lh_, logging::LogHelper::Encode::kKeyReplacePeriod};
-    lh_.Put(key.GetUnescapedKey());
-  }
-  lh_.PutKeyValueSeparator();
+  lh_.PutRuntimeTagKey(key.GetUnescapedKey());
   lh_ << value;
 }
 
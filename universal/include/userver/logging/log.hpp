@@ -135,8 +135,8 @@ class StaticLogEntry final {
 
  private:
   static constexpr std::size_t kContentSize =
-      compiler::SelectSize().For64Bit(40).For32Bit(24);
-  alignas(void*) std::byte content[kContentSize];
+      compiler::SelectSize().For64Bit(56).For32Bit(40);
+  alignas(std::uint64_t) std::byte content[kContentSize];
 };
 
 template <class NameHolder, int Line>
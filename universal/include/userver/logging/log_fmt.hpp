@@ -0,0 +1,125 @@
+#pragma once
+
+/// @file userver/logging/log_fmt.hpp
+/// @brief Logging macros that format the message text with the compile time
+/// checked and compiled {fmt} format strings
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <fmt/compile.h>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+// Terminates the format arguments to avoid the non-standard ##__VA_ARGS__
+struct FormatArgsEnd final {};
+
+// Refers to the temporaries of the full logging expression
+template <typename Format, typename... Args>
+struct FormattedText final {
+  const Format& format;
+  std::tuple<const Args&...> args;
+};
+
+template <typename Format, typename... Args>
+FormattedText<Format, Args...> MakeFormattedText(const Format& format,
+                                                 const Args&... args) noexcept {
+  return {format, {args...}};
+}
+
+template <typename Format, typename... Args, std::size_t... Indices>
+void FormatTextTo(fmt::appender out, const FormattedText<Format, Args...>& text,
+                  std::index_sequence<Indices...>) {
+  fmt::format_to(out, text.format, std::get<Indices>(text.args)...);
+}
+
+template <typename Format, typename... Args>
+LogHelper& operator<<(LogHelper& lh,
+                      const FormattedText<Format, Args...>& text) noexcept {
+  static_assert(sizeof...(Args) != 0);
+  using Text = FormattedText<Format, Args...>;
+
+  lh.PutFormatted(
+      [](const void* context, void* appender) {
+        // The last argument is FormatArgsEnd
+        FormatTextTo(*static_cast<fmt::appender*>(appender),
+                     *static_cast<const Text*>(context),
+                     std::make_index_sequence<sizeof...(Args) - 1>{});
+      },
+      &text);
+  return lh;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_LOG_FMT_TEXT(format, ...)                         \
+  USERVER_NAMESPACE::logging::impl::MakeFormattedText(FMT_COMPILE(format), \
+                                                      __VA_ARGS__)
+
+/// @brief If lvl matches the verbosity of the `logger` then formats the text
+/// with the {fmt} format string and the arguments and logs it.
+///
+/// The format string must be a string literal, it is checked and compiled
+/// at compile time. The arguments are not evaluated if the message is not
+/// logged. More text and tags could be appended to the message with `<<`.
+///
+/// @code
+/// LOG_FMT_TO(logger, logging::Level::kInfo, "user {} did {}", id, action);
+/// @endcode
+/// @hideinitializer
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_FMT_TO(logger, lvl, ...)     \
+  LOG_TO(logger, lvl) << USERVER_IMPL_LOG_FMT_TEXT( \
+      __VA_ARGS__, USERVER_NAMESPACE::logging::impl::FormatArgsEnd{})
+
+/// @brief Same as LOG_FMT_TO, but logs to the default logger and respects the
+/// dynamic debug logging, just like LOG does
+/// @hideinitializer
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_FMT(lvl, ...)                  \
+  LOG(lvl) << USERVER_IMPL_LOG_FMT_TEXT( \
+      __VA_ARGS__, USERVER_NAMESPACE::logging::impl::FormatArgsEnd{})
+
+/// @brief Formats a message with LOG_FMT and logs it to the default logger if
+/// its level is below or equal to logging::Level::kTrace
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_TRACE_FMT(...) \
+  LOG_FMT(USERVER_NAMESPACE::logging::Level::kTrace, __VA_ARGS__)
+
+/// @brief Formats a message with LOG_FMT and logs it to the default logger if
+/// its level is below or equal to logging::Level::kDebug
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_DEBUG_FMT(...) \
+  LOG_FMT(USERVER_NAMESPACE::logging::Level::kDebug, __VA_ARGS__)
+
+/// @brief Formats a message with LOG_FMT and logs it to the default logger if
+/// its level is below or equal to logging::Level::kInfo
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_INFO_FMT(...) \
+  LOG_FMT(USERVER_NAMESPACE::logging::Level::kInfo, __VA_ARGS__)
+
+/// @brief Formats a message with LOG_FMT and logs it to the default logger if
+/// its level is below or equal to logging::Level::kWarning
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_WARNING_FMT(...) \
+  LOG_FMT(USERVER_NAMESPACE::logging::Level::kWarning, __VA_ARGS__)
+
+/// @brief Formats a message with LOG_FMT and logs it to the default logger if
+/// its level is below or equal to logging::Level::kError
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_ERROR_FMT(...) \
+  LOG_FMT(USERVER_NAMESPACE::logging::Level::kError, __VA_ARGS__)
+
+/// @brief Formats a message with LOG_FMT and logs it to the default logger if
+/// its level is below or equal to logging::Level::kCritical
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define LOG_CRITICAL_FMT(...) \
+  LOG_FMT(USERVER_NAMESPACE::logging::Level::kCritical, __VA_ARGS__)
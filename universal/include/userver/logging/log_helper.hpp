@@ -163,6 +163,11 @@ class LogHelper final {
   // TODO(TAXICOMMON-6951) refactor this function into something that never
   //  produces garbage logs.
   impl::TagWriter GetTagWriterAfterText(InternalTag);
+
+  // `format(context, appender)` appends the text to the `fmt::appender*`.
+  // For internal use only, see LOG_FMT!
+  using FormatFunction = void (*)(const void* context, void* appender);
+  void PutFormatted(FormatFunction format, const void* context) noexcept;
   /// @endcond
 
  private:
@@ -180,7 +185,8 @@ class LogHelper final {
   void InternalLoggingError(std::string_view message) noexcept;
 
   void OpenTextTag();
-  void PutKeyValueSeparator();
+  void PutTagKey(std::string_view escaped_key);
+  void PutRuntimeTagKey(std::string_view unescaped_key);
   impl::TagWriter GetTagWriter();
 
   void PutFloatingPoint(float value);
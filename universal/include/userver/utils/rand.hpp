@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <random>
 
@@ -69,6 +70,13 @@ T RandRange(T to_exclusive) {
 /// @warning Don't use `Rand() % N`, use `RandRange` instead
 uint32_t Rand();
 
+/// @brief Fills the buffer with random bytes
+///
+/// Uses a separate thread-local generator that is several times faster than
+/// DefaultRandom(), e.g. for the ids of tracing spans.
+/// @note The used random generator is not cryptographically secure
+void RandFill(void* buffer, std::size_t size);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
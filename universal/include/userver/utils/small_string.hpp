@@ -3,10 +3,12 @@
 /// @file userver/utils/small_string.hpp
 /// @brief @copybrief utils::SmallString
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <boost/container/small_vector.hpp>
 
@@ -29,10 +31,10 @@ class SmallString final {
   SmallString() = default;
 
   /// @brief Create a string from another one.
-  explicit SmallString(const SmallString<N>&) = default;
+  SmallString(const SmallString<N>&) = default;
 
   /// @brief Create a string from another one.
-  explicit SmallString(SmallString<N>&&) noexcept = default;
+  SmallString(SmallString<N>&&) noexcept = default;
 
   /// @brief Create a string from std::string_view.
   explicit SmallString(std::string_view sv);
@@ -86,6 +88,10 @@ class SmallString final {
   /// fill new chars with %c.
   void resize(std::size_t n, char c);
 
+  /// @brief Resize the string. If its length is increased, the new chars are
+  /// left uninitialized and must be overwritten, e.g. through data().
+  void resize_uninitialized(std::size_t n);
+
   /// @brief Get current capacity.
   std::size_t capacity() const noexcept;
 
@@ -116,6 +122,28 @@ class SmallString final {
   /// @brief Remove the last character from the string.
   void pop_back();
 
+  /// @brief Append the characters to the string.
+  SmallString& append(std::string_view sv);
+
+  /// @brief Append %n copies of %c to the string.
+  SmallString& append(std::size_t n, char c);
+
+  /// @brief Append the characters to the string.
+  SmallString& operator+=(std::string_view sv);
+
+  /// @brief Append a character to the string.
+  SmallString& operator+=(char c);
+
+  /// @brief Insert the characters before %pos.
+  SmallString& insert(std::size_t pos, std::string_view sv);
+
+  /// @brief Remove up to %count characters starting from %pos.
+  SmallString& erase(std::size_t pos = 0,
+                     std::size_t count = std::string_view::npos);
+
+  /// @brief Get a copy of the data as std::string.
+  std::string str() const;
+
  private:
   boost::container::small_vector<char, N> data_;
 };
@@ -150,11 +178,41 @@ bool operator==(const SmallString<N>& str1, const SmallString<N>& str2) {
   return std::string_view{str1} == std::string_view{str2};
 }
 
+template <std::size_t N>
+bool operator!=(const SmallString<N>& str, std::string_view sv) {
+  return !(str == sv);
+}
+
+template <std::size_t N>
+bool operator!=(std::string_view sv, const SmallString<N>& str) {
+  return !(str == sv);
+}
+
 template <std::size_t N>
 bool operator!=(const SmallString<N>& str1, const SmallString<N>& str2) {
   return !(str1 == str2);
 }
 
+template <std::size_t N>
+bool operator<(const SmallString<N>& str1, const SmallString<N>& str2) {
+  return std::string_view{str1} < std::string_view{str2};
+}
+
+template <std::size_t N>
+bool operator>(const SmallString<N>& str1, const SmallString<N>& str2) {
+  return str2 < str1;
+}
+
+template <std::size_t N>
+bool operator<=(const SmallString<N>& str1, const SmallString<N>& str2) {
+  return !(str2 < str1);
+}
+
+template <std::size_t N>
+bool operator>=(const SmallString<N>& str1, const SmallString<N>& str2) {
+  return !(str1 < str2);
+}
+
 template <std::size_t N>
 const char& SmallString<N>::operator[](std::size_t pos) const {
   return data_[pos];
@@ -252,6 +310,54 @@ void SmallString<N>::resize(std::size_t n, char c) {
   data_.resize(n, c);
 }
 
+template <std::size_t N>
+void SmallString<N>::resize_uninitialized(std::size_t n) {
+  data_.resize(n, boost::container::default_init);
+}
+
+template <std::size_t N>
+SmallString<N>& SmallString<N>::append(std::string_view sv) {
+  data_.insert(data_.end(), sv.begin(), sv.end());
+  return *this;
+}
+
+template <std::size_t N>
+SmallString<N>& SmallString<N>::append(std::size_t n, char c) {
+  data_.insert(data_.end(), n, c);
+  return *this;
+}
+
+template <std::size_t N>
+SmallString<N>& SmallString<N>::operator+=(std::string_view sv) {
+  return append(sv);
+}
+
+template <std::size_t N>
+SmallString<N>& SmallString<N>::operator+=(char c) {
+  data_.push_back(c);
+  return *this;
+}
+
+template <std::size_t N>
+SmallString<N>& SmallString<N>::insert(std::size_t pos, std::string_view sv) {
+  if (size() < pos) throw std::out_of_range("insert");
+  data_.insert(data_.begin() + pos, sv.begin(), sv.end());
+  return *this;
+}
+
+template <std::size_t N>
+SmallString<N>& SmallString<N>::erase(std::size_t pos, std::size_t count) {
+  if (size() < pos) throw std::out_of_range("erase");
+  const auto first = data_.begin() + pos;
+  data_.erase(first, first + std::min(count, size() - pos));
+  return *this;
+}
+
+template <std::size_t N>
+std::string SmallString<N>::str() const {
+  return std::string{data_.data(), data_.size()};
+}
+
 template <std::size_t N>
 std::size_t SmallString<N>::capacity() const noexcept {
   return data_.capacity();
@@ -262,6 +368,11 @@ void SmallString<N>::reserve(std::size_t n) {
   return data_.reserve(n);
 }
 
+template <std::size_t N>
+void SmallString<N>::clear() noexcept {
+  data_.clear();
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
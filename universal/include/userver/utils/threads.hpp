@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
@@ -10,6 +13,10 @@ void SetCurrentThreadIdleScheduling();
 
 void SetCurrentThreadLowPriorityScheduling();
 
+/// Restricts the current thread to run only on the specified CPUs. Does nothing
+/// on platforms without thread affinity support.
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -13,6 +13,9 @@ namespace utils {
 /// @ingroup userver_concurrency
 ///
 /// Thread safe ratelimiter
+///
+/// @see utils::ShardedTokenBucket for the ratelimiters that are hit by each
+/// request from all the threads
 class TokenBucket final {
  public:
   using TimePoint = std::chrono::steady_clock::time_point;
@@ -94,7 +97,9 @@ class TokenBucket final {
   std::atomic<size_t> max_size_;
   std::atomic<size_t> token_refill_amount_;
   std::atomic<Duration> token_refill_interval_;
-  std::atomic<size_t> tokens_;
+
+  // Modified by each Obtain, kept apart from the settings read by all threads
+  alignas(64) std::atomic<size_t> tokens_;
   std::atomic<TimePoint> last_update_;
 };
 
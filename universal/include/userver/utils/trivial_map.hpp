@@ -3,7 +3,9 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -325,22 +327,30 @@ class SwitchBySecond final {
   SearchState<Second, First> state_;
 };
 
-template <typename First, typename Second>
+// Count is the number of Case statements, it is encoded in the type to allow
+// building the sorted search tables of a fixed size
+template <typename First, typename Second, std::size_t Count>
 class SwitchTypesDetected final {
  public:
   using first_type = First;
   using second_type = Second;
+  static constexpr std::size_t kCount = Count;
 
-  constexpr SwitchTypesDetected& Case(First, Second) noexcept { return *this; }
+  constexpr auto Case(First, Second) noexcept {
+    return SwitchTypesDetected<First, Second, Count + 1>{};
+  }
 };
 
-template <typename First>
-class SwitchTypesDetected<First, void> final {
+template <typename First, std::size_t Count>
+class SwitchTypesDetected<First, void, Count> final {
  public:
   using first_type = First;
   using second_type = void;
+  static constexpr std::size_t kCount = Count;
 
-  constexpr SwitchTypesDetected& Case(First) noexcept { return *this; }
+  constexpr auto Case(First) noexcept {
+    return SwitchTypesDetected<First, void, Count + 1>{};
+  }
 };
 
 class SwitchTypesDetector final {
@@ -355,7 +365,7 @@ class SwitchTypesDetector final {
     using second_type =
         std::conditional_t<std::is_convertible_v<Second, std::string_view>,
                            std::string_view, Second>;
-    return SwitchTypesDetected<first_type, second_type>{};
+    return SwitchTypesDetected<first_type, second_type, 1>{};
   }
 
   template <typename First>
@@ -363,7 +373,7 @@ class SwitchTypesDetector final {
     using first_type =
         std::conditional_t<std::is_convertible_v<First, std::string_view>,
                            std::string_view, First>;
-    return SwitchTypesDetected<first_type, void>{};
+    return SwitchTypesDetected<first_type, void, 1>{};
   }
 };
 
@@ -457,6 +467,263 @@ class CaseSecondDescriber final {
   std::string description_{};
 };
 
+template <typename BuilderFunc>
+using DetectedSwitchTypes =
+    std::invoke_result_t<const BuilderFunc&, SwitchTypesDetector>;
+
+// Up to this count of Case statements the linear search is used, the
+// compilers optimize it into a switch
+inline constexpr std::size_t kMaxLinearSearchSize = 32;
+
+template <typename T>
+inline constexpr bool kIsSortedSearchable =
+    std::is_same_v<T, std::string_view> || std::is_enum_v<T> ||
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>);
+
+template <typename T>
+constexpr std::uint64_t ToUnsignedKey(T value) noexcept {
+  if constexpr (std::is_enum_v<T>) {
+    return static_cast<std::uint64_t>(
+        static_cast<std::underlying_type_t<T>>(value));
+  } else {
+    return static_cast<std::uint64_t>(value);
+  }
+}
+
+// Strings are ordered by size first, so that most of the comparisons do not
+// look into the contents
+template <typename T>
+constexpr bool SortedSearchLess(T x, T y) noexcept {
+  if constexpr (std::is_same_v<T, std::string_view>) {
+    return x.size() != y.size() ? x.size() < y.size() : x < y;
+  } else {
+    return x < y;
+  }
+}
+
+// Maps the key to its position among the Case statements
+template <typename Key, std::size_t Size, typename Enabled = void>
+class SortedKeys final {
+ public:
+  constexpr explicit SortedKeys(const std::array<Key, Size>&) noexcept {}
+
+  constexpr std::size_t Find(Key) const noexcept { return kInvalidSize; }
+};
+
+template <typename Key, std::size_t Size>
+class SortedKeys<Key, Size, std::enable_if_t<kIsSortedSearchable<Key>>>
+    final {
+ public:
+  constexpr explicit SortedKeys(const std::array<Key, Size>& keys) noexcept
+      : keys_(keys) {
+    for (std::size_t i = 0; i < Size; ++i) positions_[i] = i;
+
+    // Insertion sort is stable, so the first matching Case wins, the same as
+    // for the linear search
+    for (std::size_t i = 1; i < Size; ++i) {
+      const auto key = keys_[i];
+      const auto position = positions_[i];
+      std::size_t j = i;
+      for (; j > 0 && SortedSearchLess(key, keys_[j - 1]); --j) {
+        keys_[j] = keys_[j - 1];
+        positions_[j] = positions_[j - 1];
+      }
+      keys_[j] = key;
+      positions_[j] = position;
+    }
+
+    if constexpr (!std::is_same_v<Key, std::string_view>) {
+      is_dense_ = true;
+      for (std::size_t i = 0; i < Size; ++i) {
+        if (ToUnsignedKey(keys_[i]) - ToUnsignedKey(keys_[0]) != i) {
+          is_dense_ = false;
+          break;
+        }
+      }
+    }
+  }
+
+  constexpr std::size_t Find(Key key) const noexcept {
+    if constexpr (!std::is_same_v<Key, std::string_view>) {
+      if (is_dense_) {
+        // The keys are consecutive, e.g. all the enumerators of an enum
+        const auto index = ToUnsignedKey(key) - ToUnsignedKey(keys_[0]);
+        return index < Size ? positions_[index] : kInvalidSize;
+      }
+    }
+
+    std::size_t first = 0;
+    std::size_t count = Size;
+    while (count > 0) {
+      const auto step = count / 2;
+      if (SortedSearchLess(keys_[first + step], key)) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first < Size && keys_[first] == key ? positions_[first]
+                                               : kInvalidSize;
+  }
+
+ private:
+  std::array<Key, Size> keys_{};
+  std::array<std::size_t, Size> positions_{};
+  bool is_dense_{false};
+};
+
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+ public:
+  constexpr CaseCollector& Case(First first, Second second) noexcept {
+    UASSERT(size_ < Size);
+    firsts_[size_] = first;
+    seconds_[size_] = second;
+    ++size_;
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetFirsts() const noexcept {
+    UASSERT(size_ == Size);
+    return firsts_;
+  }
+
+  constexpr const std::array<Second, Size>& GetSeconds() const noexcept {
+    UASSERT(size_ == Size);
+    return seconds_;
+  }
+
+ private:
+  std::array<First, Size> firsts_{};
+  std::array<Second, Size> seconds_{};
+  std::size_t size_{0};
+};
+
+template <typename First, std::size_t Size>
+class CaseCollector<First, void, Size> final {
+ public:
+  constexpr CaseCollector& Case(First first) noexcept {
+    UASSERT(size_ < Size);
+    firsts_[size_] = first;
+    ++size_;
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetFirsts() const noexcept {
+    UASSERT(size_ == Size);
+    return firsts_;
+  }
+
+ private:
+  std::array<First, Size> firsts_{};
+  std::size_t size_{0};
+};
+
+template <typename BuilderFunc>
+constexpr bool UseSortedSearch() noexcept {
+  using Types = DetectedSwitchTypes<BuilderFunc>;
+  using First = typename Types::first_type;
+  using Second = typename Types::second_type;
+  if constexpr (std::is_void_v<Second>) {
+    return Types::kCount > kMaxLinearSearchSize && kIsSortedSearchable<First>;
+  } else {
+    return Types::kCount > kMaxLinearSearchSize &&
+           (kIsSortedSearchable<First> || kIsSortedSearchable<Second>) &&
+           std::is_default_constructible_v<First> &&
+           std::is_default_constructible_v<Second>;
+  }
+}
+
+// Search tables for utils::TrivialBiMap with many Case statements, built at
+// compile time for constexpr maps
+template <typename BuilderFunc, typename Enabled = void>
+class BiMapSortedTables {
+ public:
+  static constexpr bool kSortedByFirst = false;
+  static constexpr bool kSortedBySecond = false;
+
+  constexpr explicit BiMapSortedTables(const BuilderFunc&) noexcept {}
+};
+
+template <typename BuilderFunc>
+class BiMapSortedTables<
+    BuilderFunc,
+    std::enable_if_t<UseSortedSearch<BuilderFunc>() &&
+                     !std::is_void_v<typename DetectedSwitchTypes<
+                         BuilderFunc>::second_type>>> {
+  using Types = DetectedSwitchTypes<BuilderFunc>;
+  using First = typename Types::first_type;
+  using Second = typename Types::second_type;
+  static constexpr std::size_t kSize = Types::kCount;
+  using Cases = CaseCollector<First, Second, kSize>;
+
+ public:
+  static constexpr bool kSortedByFirst = kIsSortedSearchable<First>;
+  static constexpr bool kSortedBySecond = kIsSortedSearchable<Second>;
+
+  constexpr explicit BiMapSortedTables(const BuilderFunc& func) noexcept
+      : BiMapSortedTables(func([]() { return Cases{}; })) {}
+
+  constexpr std::optional<Second> FindByFirst(First value) const noexcept {
+    const auto position = by_first_.Find(value);
+    if (position == kInvalidSize) return std::nullopt;
+    return seconds_[position];
+  }
+
+  constexpr std::optional<First> FindBySecond(Second value) const noexcept {
+    const auto position = by_second_.Find(value);
+    if (position == kInvalidSize) return std::nullopt;
+    return firsts_[position];
+  }
+
+ private:
+  constexpr explicit BiMapSortedTables(const Cases& cases) noexcept
+      : firsts_(cases.GetFirsts()),
+        seconds_(cases.GetSeconds()),
+        by_first_(firsts_),
+        by_second_(seconds_) {}
+
+  std::array<First, kSize> firsts_;
+  std::array<Second, kSize> seconds_;
+  SortedKeys<First, kSize> by_first_;
+  SortedKeys<Second, kSize> by_second_;
+};
+
+// Search table for utils::TrivialSet with many Case statements
+template <typename BuilderFunc, typename Enabled = void>
+class SetSortedTable {
+ public:
+  static constexpr bool kSorted = false;
+
+  constexpr explicit SetSortedTable(const BuilderFunc&) noexcept {}
+};
+
+template <typename BuilderFunc>
+class SetSortedTable<
+    BuilderFunc,
+    std::enable_if_t<UseSortedSearch<BuilderFunc>() &&
+                     std::is_void_v<typename DetectedSwitchTypes<
+                         BuilderFunc>::second_type>>> {
+  using Types = DetectedSwitchTypes<BuilderFunc>;
+  using First = typename Types::first_type;
+  static constexpr std::size_t kSize = Types::kCount;
+  using Cases = CaseCollector<First, void, kSize>;
+
+ public:
+  static constexpr bool kSorted = true;
+
+  constexpr explicit SetSortedTable(const BuilderFunc& func) noexcept
+      : keys_(func([]() { return Cases{}; }).GetFirsts()) {}
+
+  constexpr bool Contains(First value) const noexcept {
+    return keys_.Find(value) != kInvalidSize;
+  }
+
+ private:
+  SortedKeys<First, kSize> keys_;
+};
+
 }  // namespace impl
 
 /// @ingroup userver_containers
@@ -479,13 +746,18 @@ class CaseSecondDescriber final {
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// For maps with more than 32 Case statements, the lookups by string, integral
+/// or enum values use compile-time sorted tables: a binary search, or an O(1)
+/// lookup if the values are consecutive (e.g. all the enumerators of an enum).
+/// Case insensitive lookups remain linear.
+///
 /// @snippet shared/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// For a single value Case statements see @ref utils::TrivialSet.
 template <typename BuilderFunc>
-class TrivialBiMap final {
-  using TypesPair =
-      std::invoke_result_t<const BuilderFunc&, impl::SwitchTypesDetector>;
+class TrivialBiMap final : private impl::BiMapSortedTables<BuilderFunc> {
+  using TypesPair = impl::DetectedSwitchTypes<BuilderFunc>;
+  using SortedTables = impl::BiMapSortedTables<BuilderFunc>;
 
  public:
   using First = typename TypesPair::first_type;
@@ -497,7 +769,8 @@ class TrivialBiMap final {
   using MappedTypeFor =
       std::conditional_t<std::is_convertible_v<T, First>, Second, First>;
 
-  constexpr TrivialBiMap(BuilderFunc&& func) noexcept : func_(std::move(func)) {
+  constexpr TrivialBiMap(BuilderFunc&& func) noexcept
+      : SortedTables(func), func_(std::move(func)) {
     static_assert(std::is_empty_v<BuilderFunc>,
                   "Mapping function should not capture variables");
     static_assert(std::is_trivially_copyable_v<First>,
@@ -510,15 +783,25 @@ class TrivialBiMap final {
   }
 
   constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchByFirst<First, Second>{value}; })
-        .Extract();
+    if constexpr (SortedTables::kSortedByFirst) {
+      return SortedTables::FindByFirst(value);
+    } else {
+      return func_([value]() {
+               return impl::SwitchByFirst<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchBySecond<First, Second>{value}; })
-        .Extract();
+    if constexpr (SortedTables::kSortedBySecond) {
+      return SortedTables::FindBySecond(value);
+    } else {
+      return func_([value]() {
+               return impl::SwitchBySecond<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   template <class T>
@@ -615,15 +898,16 @@ class TrivialBiMap final {
 /// For a two-value Case statements or efficiency notes
 /// see @ref utils::TrivialBimap.
 template <typename BuilderFunc>
-class TrivialSet final {
-  using TypesPair =
-      std::invoke_result_t<const BuilderFunc&, impl::SwitchTypesDetector>;
+class TrivialSet final : private impl::SetSortedTable<BuilderFunc> {
+  using TypesPair = impl::DetectedSwitchTypes<BuilderFunc>;
+  using SortedTable = impl::SetSortedTable<BuilderFunc>;
 
  public:
   using First = typename TypesPair::first_type;
   using Second = typename TypesPair::second_type;
 
-  constexpr TrivialSet(BuilderFunc&& func) noexcept : func_(std::move(func)) {
+  constexpr TrivialSet(BuilderFunc&& func) noexcept
+      : SortedTable(func), func_(std::move(func)) {
     static_assert(std::is_empty_v<BuilderFunc>,
                   "Mapping function should not capture variables");
     static_assert(std::is_trivially_copyable_v<First>,
@@ -633,9 +917,14 @@ class TrivialSet final {
   }
 
   constexpr bool Contains(First value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchByFirst<First, Second>{value}; })
-        .Extract();
+    if constexpr (SortedTable::kSorted) {
+      return SortedTable::Contains(value);
+    } else {
+      return func_([value]() {
+               return impl::SwitchByFirst<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   constexpr bool ContainsICase(std::string_view value) const noexcept {
@@ -669,7 +958,8 @@ class TrivialSet final {
 /// string, or if `value` is not contained in `map`.
 /// @see @ref md_en_userver_formats
 template <typename ExceptionType = void, typename Value, typename BuilderFunc>
-auto ParseFromValueString(const Value& value, TrivialBiMap<BuilderFunc> map) {
+auto ParseFromValueString(const Value& value,
+                          const TrivialBiMap<BuilderFunc>& map) {
   if constexpr (!std::is_void_v<ExceptionType>) {
     if (!value.IsString()) {
       throw ExceptionType(fmt::format(
@@ -696,7 +986,8 @@ namespace impl {
 // contained in `map`, then crashes the service in Debug builds, or throws
 // utils::InvariantError in Release builds.
 template <typename Enum, typename BuilderFunc>
-std::string_view EnumToStringView(Enum value, TrivialBiMap<BuilderFunc> map) {
+std::string_view EnumToStringView(Enum value,
+                                  const TrivialBiMap<BuilderFunc>& map) {
   static_assert(std::is_enum_v<Enum>);
   if (const auto string = map.TryFind(value)) return *string;
 
@@ -3,15 +3,23 @@
 /// @file utils/uuid4.hpp
 /// @brief @copybrief utils::generators::GenerateUuid
 
+#include <cstddef>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::generators {
 
+/// Length of the UUID string, without dashes
+inline constexpr std::size_t kUuidLength = 32;
+
 /// @brief Generate a UUID string
 std::string GenerateUuid();
 
+/// @brief Generate a UUID string into the buffer of at least kUuidLength
+/// chars, without allocations. No terminating zero is written.
+void GenerateUuidInto(char* buffer);
+
 }  // namespace utils::generators
 
 USERVER_NAMESPACE_END
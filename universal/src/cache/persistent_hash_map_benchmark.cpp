@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+
+#include <userver/cache/persistent_hash_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr unsigned kChangesCount = 100;
+
+template <typename Map>
+Map FillMap(unsigned elements_count) {
+  Map map;
+  for (unsigned i = 0; i < elements_count; ++i) {
+    map.insert_or_assign(i, i);
+  }
+  return map;
+}
+
+// Copies the data and applies a delta, as an incremental cache update does
+template <typename Map>
+void IncrementalUpdate(benchmark::State& state) {
+  const auto map = FillMap<Map>(state.range(0));
+  unsigned key = 0;
+  for (auto _ : state) {
+    auto copy = map;
+    for (unsigned i = 0; i < kChangesCount; ++i) {
+      copy.insert_or_assign(key++ % state.range(0), i);
+    }
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+}  // namespace
+
+void PersistentHashMapIncrementalUpdate(benchmark::State& state) {
+  IncrementalUpdate<cache::PersistentHashMap<unsigned, unsigned>>(state);
+}
+BENCHMARK(PersistentHashMapIncrementalUpdate)->Range(1 << 10, 1 << 20);
+
+void UnorderedMapIncrementalUpdate(benchmark::State& state) {
+  IncrementalUpdate<std::unordered_map<unsigned, unsigned>>(state);
+}
+BENCHMARK(UnorderedMapIncrementalUpdate)->Range(1 << 10, 1 << 20);
+
+void PersistentHashMapFind(benchmark::State& state) {
+  const auto map =
+      FillMap<cache::PersistentHashMap<unsigned, unsigned>>(state.range(0));
+  unsigned key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.FindOrNullptr(key++ % state.range(0)));
+  }
+}
+BENCHMARK(PersistentHashMapFind)->Range(1 << 10, 1 << 20);
+
+USERVER_NAMESPACE_END
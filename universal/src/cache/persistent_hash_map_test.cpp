@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include <userver/cache/persistent_hash_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentHashMap<int, std::string>;
+
+// Makes all the keys that are equal modulo 10 collide
+struct CollidingHash {
+  std::size_t operator()(int key) const { return key % 10; }
+};
+
+template <typename M>
+std::map<int, std::string> ToStdMap(const M& map) {
+  std::map<int, std::string> result;
+  for (const auto& [key, value] : map) result.emplace(key, value);
+  return result;
+}
+
+}  // namespace
+
+TEST(PersistentHashMap, Empty) {
+  const Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.FindOrNullptr(1), nullptr);
+}
+
+TEST(PersistentHashMap, InsertFindErase) {
+  Map map;
+  EXPECT_TRUE(map.insert_or_assign(1, "a"));
+  EXPECT_TRUE(map.insert({2, "b"}));
+  EXPECT_FALSE(map.insert({2, "c"}));
+  EXPECT_FALSE(map.insert_or_assign(1, "d"));
+
+  EXPECT_EQ(map.size(), 2);
+  ASSERT_NE(map.FindOrNullptr(1), nullptr);
+  EXPECT_EQ(*map.FindOrNullptr(1), "d");
+  EXPECT_EQ(map.find(2)->second, "b");
+  EXPECT_FALSE(map.contains(3));
+
+  EXPECT_EQ(map.erase(3), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_FALSE(map.contains(1));
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentHashMap, Iteration) {
+  Map map;
+  std::map<int, std::string> expected;
+  for (int i = 0; i < 10000; ++i) {
+    map.insert_or_assign(i, std::to_string(i));
+    expected.emplace(i, std::to_string(i));
+  }
+  EXPECT_EQ(map.size(), expected.size());
+  EXPECT_EQ(ToStdMap(map), expected);
+
+  for (int i = 0; i < 10000; i += 2) {
+    EXPECT_EQ(map.erase(i), 1);
+    expected.erase(i);
+  }
+  EXPECT_EQ(map.size(), expected.size());
+  EXPECT_EQ(ToStdMap(map), expected);
+}
+
+TEST(PersistentHashMap, CopiesAreIndependent) {
+  Map original;
+  for (int i = 0; i < 1000; ++i) original.insert_or_assign(i, "old");
+
+  auto copy = original;
+  copy.insert_or_assign(1, "new");
+  copy.insert_or_assign(1000, "new");
+  copy.erase(2);
+
+  EXPECT_EQ(original.size(), 1000);
+  EXPECT_EQ(*original.FindOrNullptr(1), "old");
+  EXPECT_FALSE(original.contains(1000));
+  EXPECT_TRUE(original.contains(2));
+
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(*copy.FindOrNullptr(1), "new");
+  EXPECT_EQ(*copy.FindOrNullptr(1000), "new");
+  EXPECT_FALSE(copy.contains(2));
+}
+
+TEST(PersistentHashMap, SharesUnchangedElements) {
+  Map original;
+  for (int i = 0; i < 1000; ++i) original.insert_or_assign(i, "value");
+
+  auto copy = original;
+  copy.insert_or_assign(1, "new");
+  EXPECT_EQ(original.FindOrNullptr(2), copy.FindOrNullptr(2));
+  EXPECT_NE(original.FindOrNullptr(1), copy.FindOrNullptr(1));
+}
+
+TEST(PersistentHashMap, Collisions) {
+  cache::PersistentHashMap<int, std::string, CollidingHash> map;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(map.insert_or_assign(i, std::to_string(i)));
+  }
+  EXPECT_FALSE(map.insert_or_assign(42, "replaced"));
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_EQ(*map.FindOrNullptr(42), "replaced");
+  EXPECT_EQ(*map.FindOrNullptr(43), "43");
+
+  const auto copy = map;
+  for (int i = 0; i < 100; i += 3) EXPECT_EQ(map.erase(i), 1);
+  EXPECT_EQ(map.size(), 66);
+  EXPECT_FALSE(map.contains(42));
+  EXPECT_EQ(*map.FindOrNullptr(43), "43");
+  EXPECT_EQ(ToStdMap(map).size(), 66);
+
+  EXPECT_EQ(copy.size(), 100);
+  EXPECT_EQ(*copy.FindOrNullptr(42), "replaced");
+}
+
+TEST(PersistentHashMap, Move) {
+  Map map;
+  map.insert_or_assign(1, "a");
+
+  auto moved = std::move(map);
+  EXPECT_EQ(moved.size(), 1);
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+USERVER_NAMESPACE_END
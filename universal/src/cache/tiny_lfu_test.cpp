@@ -0,0 +1,119 @@
+#include <userver/cache/impl/tiny_lfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/impl/frequency_sketch.hpp>
+#include <userver/cache/impl/lru.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TinyLfu = cache::impl::TinyLfuBase<std::size_t, std::size_t>;
+
+constexpr std::size_t kCacheSize = 1000;
+constexpr std::size_t kHotKeysCount = 500;
+
+template <typename Cache>
+void Touch(Cache& cache, std::size_t key) {
+  if (!cache.Get(key)) cache.Put(key, key);
+}
+
+template <typename Cache>
+std::size_t CountHotKeysAfterScan(Cache& cache) {
+  for (std::size_t i = 0; i < 10; ++i) {
+    for (std::size_t key = 0; key < kHotKeysCount; ++key) Touch(cache, key);
+  }
+
+  // keys that are requested only once, as in a batch job
+  for (std::size_t key = kHotKeysCount; key < kHotKeysCount + kCacheSize * 10;
+       ++key) {
+    Touch(cache, key);
+  }
+
+  std::size_t hits = 0;
+  for (std::size_t key = 0; key < kHotKeysCount; ++key) {
+    if (cache.Get(key)) ++hits;
+  }
+  return hits;
+}
+
+}  // namespace
+
+TEST(FrequencySketch, Estimate) {
+  cache::impl::FrequencySketch<std::string> sketch(100);
+  EXPECT_EQ(sketch.Estimate("key"), 0);
+
+  for (int i = 0; i < 5; ++i) sketch.Increment("key");
+  EXPECT_EQ(sketch.Estimate("key"), 5);
+  EXPECT_EQ(sketch.Estimate("other-key"), 0);
+
+  for (int i = 0; i < 100; ++i) sketch.Increment("key");
+  EXPECT_EQ(sketch.Estimate("key"), sketch.kMaxFrequency);
+
+  sketch.Clear();
+  EXPECT_EQ(sketch.Estimate("key"), 0);
+}
+
+TEST(FrequencySketch, Aging) {
+  cache::impl::FrequencySketch<std::size_t> sketch(10);
+  for (int i = 0; i < 8; ++i) sketch.Increment(0);
+
+  // 10 * capacity increments halve all the counters
+  for (std::size_t key = 1; key < 100; ++key) sketch.Increment(key);
+  EXPECT_LE(sketch.Estimate(0), 4);
+}
+
+TEST(TinyLfuBase, PutGetErase) {
+  TinyLfu cache(10);
+  EXPECT_TRUE(cache.Put(1, 1));
+  EXPECT_FALSE(cache.Put(1, 2));
+  EXPECT_EQ(*cache.Get(1), 2);
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  for (std::size_t i = 2; i <= 10; ++i) cache.Put(i, i);
+  EXPECT_EQ(cache.GetSize(), 10);
+  EXPECT_EQ(cache.GetCapacity(), 10);
+
+  cache.Erase(1);
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_EQ(cache.GetSize(), 9);
+
+  std::size_t visited = 0;
+  cache.VisitAll([&visited](std::size_t key, std::size_t value) {
+    EXPECT_EQ(key, value);
+    ++visited;
+  });
+  EXPECT_EQ(visited, 9);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+TEST(TinyLfuBase, SizeLimit) {
+  TinyLfu cache(kCacheSize);
+  for (std::size_t i = 0; i < kCacheSize * 3; ++i) {
+    Touch(cache, i % (kCacheSize * 2));
+    ASSERT_LE(cache.GetSize(), kCacheSize);
+  }
+
+  cache.SetMaxSize(10);
+  EXPECT_LE(cache.GetSize(), 10);
+  EXPECT_EQ(cache.GetCapacity(), 10);
+
+  cache.SetMaxSize(1);
+  EXPECT_LE(cache.GetSize(), 2);
+}
+
+TEST(TinyLfuBase, ScanResistance) {
+  TinyLfu tiny_lfu(kCacheSize);
+  EXPECT_GT(CountHotKeysAfterScan(tiny_lfu), kHotKeysCount * 9 / 10);
+  EXPECT_GT(tiny_lfu.GetAdmissionRejects(), kCacheSize);
+
+  cache::impl::LruBase<std::size_t, std::size_t> lru(kCacheSize, {}, {});
+  EXPECT_EQ(CountHotKeysAfterScan(lru), 0);
+}
+
+USERVER_NAMESPACE_END
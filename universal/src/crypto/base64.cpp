@@ -17,6 +17,7 @@ namespace {
 template <typename Base64Encoder>
 std::string Base64Encode(std::string_view data, Pad pad) {
   std::string response;
+  response.reserve((data.size() + 2) / 3 * 4);
   try {
     Base64Encoder encoder(new CryptoPP::StringSink(response));
     CryptoPP::AlgorithmParameters params =
@@ -34,6 +35,7 @@ std::string Base64Encode(std::string_view data, Pad pad) {
 template <typename Base64Decoder>
 std::string Base64Decode(std::string_view data) {
   std::string response;
+  response.reserve(data.size() / 4 * 3 + 2);
   try {
     Base64Decoder decoder(new CryptoPP::StringSink(response));
     decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/base64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void crypto_base64_encode(benchmark::State& state) {
+  const std::string data(state.range(0), '\xab');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Encode(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void crypto_base64_decode(benchmark::State& state) {
+  const auto encoded =
+      crypto::base64::Base64Encode(std::string(state.range(0), '\xab'));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Decode(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+}  // namespace
+
+BENCHMARK(crypto_base64_encode)->RangeMultiplier(8)->Range(16, 16 << 10);
+BENCHMARK(crypto_base64_decode)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+USERVER_NAMESPACE_END
@@ -1,17 +1,19 @@
 #include <userver/crypto/hash.hpp>
 
 #include <array>
+#include <utility>
 
 #include <cryptopp/base64.h>
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 #include <cryptopp/blake2.h>
 #endif
 #include <cryptopp/filters.h>
-#include <cryptopp/hex.h>
 #include <cryptopp/hmac.h>
 #include <cryptopp/sha.h>
 
 #include <userver/crypto/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/encoding/hex.hpp>
 
 #include <cryptopp/md5.h>
 
@@ -41,8 +43,9 @@ std::string EncodeArray(const byte* ptr, size_t length,
       break;
     }
     case crypto::hash::OutputEncoding::kBase16: {
-      CryptoPP::HexEncoder encoder(new CryptoPP::StringSink(response), false);
-      encoder.PutMessageEnd(ptr, length);
+      utils::encoding::ToHex(
+          std::string_view(reinterpret_cast<const char*>(ptr), length),
+          response);
       break;
     }
     case crypto::hash::OutputEncoding::kBase64: {
@@ -55,28 +58,21 @@ std::string EncodeArray(const byte* ptr, size_t length,
   return response;
 }
 
-std::string EncodeString(std::string_view data,
-                         crypto::hash::OutputEncoding encoding) {
-  return EncodeArray(reinterpret_cast<const byte*>(data.data()), data.size(),
-                     encoding);
-}
-
 template <typename HashAlgorithm>
 std::string CalculateHmac(std::string_view key, std::string_view data,
                           crypto::hash::OutputEncoding encoding) {
-  std::string mac;
-
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+  std::array<byte, HashAlgorithm::DIGESTSIZE> digest;
   try {
     CryptoPP::HMAC<HashAlgorithm> hmac(
         reinterpret_cast<const byte*>(key.data()), key.size());
-    CryptoPP::StringSource ss_key(
-        reinterpret_cast<const byte*>(data.data()), data.size(), true,
-        new CryptoPP::HashFilter(hmac, new CryptoPP::StringSink(mac)));
+    hmac.CalculateDigest(
+        digest.data(), reinterpret_cast<const byte*>(data.data()), data.size());
   } catch (const CryptoPP::Exception& exc) {
     throw crypto::CryptoException(exc.what());
   }
 
-  return EncodeString(mac, encoding);
+  return EncodeArray(digest.data(), digest.size(), encoding);
 }
 
 template <typename HashAlgorithm>
@@ -99,6 +95,106 @@ std::string CalculateHash(std::string_view data,
 
 namespace crypto::hash {
 
+namespace impl {
+
+struct HasherAlgorithm {
+  virtual ~HasherAlgorithm() = default;
+
+  virtual CryptoPP::HashTransformation& Get() noexcept = 0;
+};
+
+}  // namespace impl
+
+namespace {
+
+// The largest digest of the algorithms used by the hashers
+constexpr std::size_t kMaxDigestSize = CryptoPP::SHA512::DIGESTSIZE;
+
+template <typename HashAlgorithm>
+class HasherAlgorithmImpl final : public impl::HasherAlgorithm {
+ public:
+  static_assert(HashAlgorithm::DIGESTSIZE <= kMaxDigestSize);
+
+  template <typename... Args>
+  explicit HasherAlgorithmImpl(Args&&... args)
+      : algorithm_(std::forward<Args>(args)...) {}
+
+  CryptoPP::HashTransformation& Get() noexcept override { return algorithm_; }
+
+ private:
+  HashAlgorithm algorithm_;
+};
+
+template <typename HashAlgorithm>
+std::unique_ptr<impl::HasherAlgorithm> MakeHasherAlgorithm() {
+  return std::make_unique<HasherAlgorithmImpl<HashAlgorithm>>();
+}
+
+template <typename HashAlgorithm>
+std::unique_ptr<impl::HasherAlgorithm> MakeHmacHasherAlgorithm(
+    std::string_view key) {
+  try {
+    return std::make_unique<
+        HasherAlgorithmImpl<CryptoPP::HMAC<HashAlgorithm>>>(
+        reinterpret_cast<const byte*>(key.data()), key.size());
+  } catch (const CryptoPP::Exception& exc) {
+    throw crypto::CryptoException(exc.what());
+  }
+}
+
+}  // namespace
+
+Hasher::Hasher(std::unique_ptr<impl::HasherAlgorithm>&& algorithm)
+    : algorithm_(std::move(algorithm)) {
+  UASSERT(algorithm_);
+}
+
+Hasher::Hasher(Hasher&&) noexcept = default;
+
+Hasher& Hasher::operator=(Hasher&&) noexcept = default;
+
+Hasher::~Hasher() = default;
+
+void Hasher::Update(std::string_view data) {
+  UASSERT_MSG(algorithm_, "Update() on a moved-from hasher");
+  try {
+    algorithm_->Get().Update(reinterpret_cast<const byte*>(data.data()),
+                             data.size());
+  } catch (const CryptoPP::Exception& exc) {
+    throw crypto::CryptoException(exc.what());
+  }
+}
+
+std::string Hasher::Final(OutputEncoding encoding) {
+  UASSERT_MSG(algorithm_, "Final() on a moved-from hasher");
+  auto& transformation = algorithm_->Get();
+  const auto digest_size = transformation.DigestSize();
+  UASSERT(digest_size <= kMaxDigestSize);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+  std::array<byte, kMaxDigestSize> digest;
+  try {
+    // restarts the algorithm, keeping the HMAC key
+    transformation.Final(digest.data());
+  } catch (const CryptoPP::Exception& exc) {
+    throw crypto::CryptoException(exc.what());
+  }
+
+  return EncodeArray(digest.data(), digest_size, encoding);
+}
+
+Sha256Hasher::Sha256Hasher()
+    : Hasher(MakeHasherAlgorithm<CryptoPP::SHA256>()) {}
+
+Sha512Hasher::Sha512Hasher()
+    : Hasher(MakeHasherAlgorithm<CryptoPP::SHA512>()) {}
+
+HmacSha256Hasher::HmacSha256Hasher(std::string_view key)
+    : Hasher(MakeHmacHasherAlgorithm<CryptoPP::SHA256>(key)) {}
+
+HmacSha512Hasher::HmacSha512Hasher(std::string_view key)
+    : Hasher(MakeHmacHasherAlgorithm<CryptoPP::SHA512>(key)) {}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 std::string Blake2b128(std::string_view data, OutputEncoding encoding) {
   return CalculateHash<AlgoBlake2b128>(data, encoding);
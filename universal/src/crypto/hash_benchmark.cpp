@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kKey = "0123456789abcdef0123456789abcdef";
+
+void crypto_hmac_sha256(benchmark::State& state) {
+  const std::string body(state.range(0), 'x');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::hash::HmacSha256(kKey, body));
+  }
+  state.SetBytesProcessed(state.iterations() * body.size());
+}
+
+void crypto_hmac_sha256_hasher(benchmark::State& state) {
+  const std::string body(state.range(0), 'x');
+  crypto::hash::HmacSha256Hasher hasher{kKey};
+  for (auto _ : state) {
+    hasher.Update(body);
+    benchmark::DoNotOptimize(hasher.Final());
+  }
+  state.SetBytesProcessed(state.iterations() * body.size());
+}
+
+void crypto_sha256_hasher_chunks(benchmark::State& state) {
+  const std::string chunk(state.range(0), 'x');
+  crypto::hash::Sha256Hasher hasher;
+  for (auto _ : state) {
+    for (int i = 0; i < 16; ++i) hasher.Update(chunk);
+    benchmark::DoNotOptimize(hasher.Final());
+  }
+  state.SetBytesProcessed(state.iterations() * chunk.size() * 16);
+}
+
+}  // namespace
+
+BENCHMARK(crypto_hmac_sha256)->RangeMultiplier(8)->Range(16, 16 << 10);
+BENCHMARK(crypto_hmac_sha256_hasher)->RangeMultiplier(8)->Range(16, 16 << 10);
+BENCHMARK(crypto_sha256_hasher_chunks)->RangeMultiplier(8)->Range(16, 1 << 10);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <utility>
+
 #include <userver/crypto/hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -94,6 +96,44 @@ TEST(Crypto, Hmac) {
                                crypto::hash::OutputEncoding::kHex));
 }
 
+TEST(Crypto, Hasher) {
+  crypto::hash::Sha256Hasher hasher;
+  EXPECT_EQ(crypto::hash::Sha256({}), hasher.Final());
+
+  hasher.Update("te");
+  hasher.Update("");
+  hasher.Update("st\n");
+  EXPECT_EQ(crypto::hash::Sha256("test\n"), hasher.Final());
+
+  // Final() starts a new message
+  hasher.Update("test");
+  EXPECT_EQ(crypto::hash::Sha256("test", crypto::hash::OutputEncoding::kBase64),
+            hasher.Final(crypto::hash::OutputEncoding::kBase64));
+
+  crypto::hash::Sha512Hasher sha512;
+  sha512.Update("test");
+  EXPECT_EQ(crypto::hash::Sha512("test", crypto::hash::OutputEncoding::kBinary),
+            sha512.Final(crypto::hash::OutputEncoding::kBinary));
+}
+
+TEST(Crypto, HmacHasher) {
+  crypto::hash::HmacSha256Hasher hasher{"test"};
+  hasher.Update("t");
+  hasher.Update("est");
+  EXPECT_EQ("88cd2108b5347d973cf39cdf9053d7dd42704876d8c9a9bd8e2d168259d3ddf7",
+            hasher.Final());
+
+  // the key is kept for the next message
+  hasher.Update("another message");
+  EXPECT_EQ(crypto::hash::HmacSha256("test", "another message"),
+            hasher.Final());
+
+  crypto::hash::HmacSha512Hasher sha512{"secret"};
+  crypto::hash::HmacSha512Hasher moved = std::move(sha512);
+  moved.Update("test");
+  EXPECT_EQ(crypto::hash::HmacSha512("secret", "test"), moved.Final());
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 TEST(Crypto, Blake2b128) {
   EXPECT_EQ("e9a804b2e527fd3601d2ffc0bb023cd6",
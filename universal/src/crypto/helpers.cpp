@@ -45,6 +45,14 @@ int CurveNidByDigestSize(DigestSize bits) {
   UINVARIANT(false, "Unexpected DigestSize");
 }
 
+void FreeEvpMdCtx(EVP_MD_CTX* ctx) noexcept {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+  EVP_MD_CTX_free(ctx);
+#else
+  EVP_MD_CTX_destroy(ctx);
+#endif
+}
+
 }  // namespace
 std::string FormatSslError(std::string message) {
   bool first = true;
@@ -82,18 +90,16 @@ EvpMdCtx::EvpMdCtx()
 }
 
 EvpMdCtx::~EvpMdCtx() {
-  if (ctx_) {
-#if OPENSSL_VERSION_NUMBER >= 0x010100000L
-    EVP_MD_CTX_free(ctx_);
-#else
-    EVP_MD_CTX_destroy(ctx_);
-#endif
-  }
+  if (ctx_) FreeEvpMdCtx(ctx_);
 }
 
 EvpMdCtx::EvpMdCtx(EvpMdCtx&& other) noexcept
     : ctx_(std::exchange(other.ctx_, nullptr)) {}
 
+std::shared_ptr<const EVP_MD_CTX> EvpMdCtx::ToShared() && {
+  return {std::exchange(ctx_, nullptr), &FreeEvpMdCtx};
+}
+
 decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits) {
   switch (bits) {
     case DigestSize::k160:
@@ -26,6 +26,10 @@ class EvpMdCtx {
 
   EVP_MD_CTX* Get() { return ctx_; }
 
+  /// Converts the initialized context into a template for the per-call
+  /// contexts, which may be concurrently copied from by EVP_MD_CTX_copy_ex
+  std::shared_ptr<const EVP_MD_CTX> ToShared() &&;
+
  private:
   EVP_MD_CTX* ctx_;
 };
@@ -378,4 +378,20 @@ TEST(Crypto, SignaturePs512) {
                    {}, TestFlags::kSkipDigestOps);
 }
 
+TEST(Crypto, SignatureFromPrivateKey) {
+  const auto private_key = crypto::PrivateKey::LoadFromString(rsa2048_priv_key);
+  const auto public_key = crypto::PublicKey::LoadFromString(rsa2048_pub_key);
+  TestDsaSignature(crypto::SignerRs256{private_key},
+                   crypto::VerifierRs256{public_key},
+                   crypto::VerifierRs256{rsa2048_pub_key_invalid}, "test",
+                   crypto::hash::Sha256("test"), crypto::hash::Sha512("test"));
+
+  // copies of the signer share the initialized context
+  const crypto::SignerPs256 signer{private_key};
+  const auto signer_copy = signer;
+  const crypto::VerifierPs256 verifier{public_key};
+  EXPECT_NO_THROW(verifier.Verify({"test"}, signer.Sign({"test"})));
+  EXPECT_NO_THROW(verifier.Verify({"test"}, signer_copy.Sign({"te", "st"})));
+}
+
 USERVER_NAMESPACE_END
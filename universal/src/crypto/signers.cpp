@@ -152,10 +152,9 @@ template class HmacShaSigner<DigestSize::k512>;
 ///
 
 template <DsaType type, DigestSize bits>
-DsaSigner<type, bits>::DsaSigner(const std::string& key,
-                                 const std::string& password)
+DsaSigner<type, bits>::DsaSigner(PrivateKey privkey)
     : Signer(EnumValueToString(type) + EnumValueToString(bits)),
-      pkey_(PrivateKey::LoadFromString(key, password)) {
+      pkey_(std::move(privkey)) {
   impl::Openssl::Init();
 
   if constexpr (type == DsaType::kEc) {
@@ -170,11 +169,9 @@ DsaSigner<type, bits>::DsaSigner(const std::string& key,
       throw SignError("Non-RSA key supplied for " + Name() + " signer");
     }
   }
-}
 
-template <DsaType type, DigestSize bits>
-std::string DsaSigner<type, bits>::Sign(
-    std::initializer_list<std::string_view> data) const {
+  // Initialization with the key is much more expensive than copying an
+  // already initialized context, so it is done once
   EvpMdCtx ctx;
   EVP_PKEY_CTX* pkey_ctx = nullptr;  // non-owning
   if (1 != EVP_DigestSignInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
@@ -186,6 +183,22 @@ std::string DsaSigner<type, bits>::Sign(
     SetupJwaRsaPssPadding(pkey_ctx, bits);
   }
 
+  initialized_ctx_ = std::move(ctx).ToShared();
+}
+
+template <DsaType type, DigestSize bits>
+DsaSigner<type, bits>::DsaSigner(const std::string& key,
+                                 const std::string& password)
+    : DsaSigner{PrivateKey::LoadFromString(key, password)} {}
+
+template <DsaType type, DigestSize bits>
+std::string DsaSigner<type, bits>::Sign(
+    std::initializer_list<std::string_view> data) const {
+  EvpMdCtx ctx;
+  if (1 != EVP_MD_CTX_copy_ex(ctx.Get(), initialized_ctx_.get())) {
+    throw SignError(FormatSslError("Failed to sign: EVP_MD_CTX_copy_ex"));
+  }
+
   for (const auto& part : data) {
     if (1 != EVP_DigestSignUpdate(ctx.Get(), part.data(), part.size())) {
       throw SignError(FormatSslError("Failed to sign: EVP_DigestSignUpdate"));
@@ -170,6 +170,22 @@ DsaVerifier<type, bits>::DsaVerifier(PublicKey pubkey)
                               " verifier");
     }
   }
+
+  // Initialization with the key is much more expensive than copying an
+  // already initialized context, so it is done once
+  EvpMdCtx ctx;
+  EVP_PKEY_CTX* pkey_ctx = nullptr;
+  if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
+                                nullptr, pkey_.GetNative())) {
+    throw VerificationError(
+        FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
+  }
+
+  if constexpr (type == DsaType::kRsaPss) {
+    SetupJwaRsaPssPadding(pkey_ctx, bits);
+  }
+
+  initialized_ctx_ = std::move(ctx).ToShared();
 }
 
 template <DsaType type, DigestSize bits>
@@ -181,15 +197,9 @@ void DsaVerifier<type, bits>::Verify(
     std::initializer_list<std::string_view> data,
     std::string_view raw_signature) const {
   EvpMdCtx ctx;
-  EVP_PKEY_CTX* pkey_ctx = nullptr;
-  if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
-                                nullptr, pkey_.GetNative())) {
+  if (1 != EVP_MD_CTX_copy_ex(ctx.Get(), initialized_ctx_.get())) {
     throw VerificationError(
-        FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
-  }
-
-  if constexpr (type == DsaType::kRsaPss) {
-    SetupJwaRsaPssPadding(pkey_ctx, bits);
+        FormatSslError("Failed to verify: EVP_MD_CTX_copy_ex"));
   }
 
   for (const auto& part : data) {
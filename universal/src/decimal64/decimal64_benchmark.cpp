@@ -0,0 +1,73 @@
+#include <userver/decimal64/decimal64.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4>;
+
+std::vector<Money> MakeValues(std::size_t size) {
+  std::vector<Money> values;
+  values.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    values.push_back(Money::FromUnbiased(
+        static_cast<int64_t>(utils::RandRange(2'000'000'000)) - 1'000'000'000));
+  }
+  return values;
+}
+
+}  // namespace
+
+void decimal64_parse(benchmark::State& state) {
+  std::vector<std::string> strings;
+  for (const auto value : MakeValues(1024)) {
+    strings.push_back(decimal64::ToString(value));
+  }
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Money{strings[i++ % strings.size()]});
+  }
+}
+BENCHMARK(decimal64_parse);
+
+void decimal64_sum_loop(benchmark::State& state) {
+  const auto values = MakeValues(state.range(0));
+  for (auto _ : state) {
+    Money sum{0};
+    for (const auto value : values) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_sum_loop)->Range(16, 16 << 10);
+
+void decimal64_sum(benchmark::State& state) {
+  const auto values = MakeValues(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::Sum(values));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_sum)->Range(16, 16 << 10);
+
+void decimal64_scale(benchmark::State& state) {
+  const auto values = MakeValues(state.range(0));
+  const Money factor{"1.0001"};
+  for (auto _ : state) {
+    auto scaled = values;
+    decimal64::Scale(scaled, factor);
+    benchmark::DoNotOptimize(scaled.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_scale)->Range(16, 16 << 10);
+
+USERVER_NAMESPACE_END
@@ -79,6 +79,27 @@ TEST(Decimal64, ConstructFromString) {
   EXPECT_THROW(Dec4{"-1 .0"}, decimal64::ParseError);
 }
 
+TEST(Decimal64, ConstructFromStringLimits) {
+  EXPECT_EQ(Dec4{"922337203685476.9999"}.AsUnbiased(),
+            922337203685476'9999LL);
+  EXPECT_EQ(Dec4{"-922337203685476.9999"}.AsUnbiased(),
+            -922337203685476'9999LL);
+  EXPECT_THROW(Dec4{"922337203685477"}, decimal64::ParseError);
+  EXPECT_THROW(Dec4{"-922337203685477.0"}, decimal64::ParseError);
+
+  EXPECT_EQ(Dec4{"0.0001"}.AsUnbiased(), 1);
+  EXPECT_EQ(Dec4{"-0.0001"}.AsUnbiased(), -1);
+  EXPECT_EQ(Dec4{"1.2000"}.AsUnbiased(), 1'2000);
+  EXPECT_THROW(Dec4{"1.20000"}, decimal64::ParseError);
+  EXPECT_THROW(Dec4{"1.00001"}, decimal64::ParseError);
+  EXPECT_THROW(Dec4{"-"}, decimal64::ParseError);
+  EXPECT_THROW(Dec4{""}, decimal64::ParseError);
+
+  EXPECT_EQ(decimal64::Decimal<0>{"42"}.AsUnbiased(), 42);
+  EXPECT_THROW(decimal64::Decimal<0>{"42.0"}, decimal64::ParseError);
+  EXPECT_THROW(decimal64::Decimal<0>{"42.5"}, decimal64::ParseError);
+}
+
 // NOLINTNEXTLINE(readability-function-size)
 TEST(Decimal64, FromStringPermissive) {
   EXPECT_EQ(Dec4::FromStringPermissive("1234.5678"), Dec4{"1234.5678"});
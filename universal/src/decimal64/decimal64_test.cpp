@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -171,6 +172,69 @@ TEST(Decimal64, Overflow) {
                decimal64::OutOfBoundsError);
 }
 
+TEST(Decimal64, Sum) {
+  const std::vector<Dec4> values{Dec4{"1.5"}, Dec4{"-0.25"}, Dec4{"1000"},
+                                 Dec4{"-0.0001"}};
+  EXPECT_EQ(decimal64::Sum(values), Dec4{"1001.2499"});
+  EXPECT_EQ(decimal64::Sum(std::vector<Dec4>{}), Dec4{0});
+
+  const Dec2 array[] = {Dec2{"0.01"}, Dec2{"0.02"}};
+  static_assert(std::is_same_v<decltype(decimal64::Sum(array)), Dec2>);
+  EXPECT_EQ(decimal64::Sum(array), Dec2{"0.03"});
+
+  std::vector<Dec4> many(1000, Dec4{"-12345.6789"});
+  many.push_back(Dec4{"12345678.9"});
+  EXPECT_EQ(decimal64::Sum(many), Dec4{0});
+}
+
+TEST(Decimal64, SumOverflow) {
+  const auto max_decimal =
+      Dec4::FromUnbiased(std::numeric_limits<int64_t>::max());
+  const auto min_decimal =
+      Dec4::FromUnbiased(std::numeric_limits<int64_t>::min());
+
+  EXPECT_EQ(decimal64::Sum(std::vector{max_decimal}), max_decimal);
+  EXPECT_EQ(decimal64::Sum(std::vector{min_decimal}), min_decimal);
+  EXPECT_THROW(decimal64::Sum(std::vector{max_decimal, Dec4::FromUnbiased(1)}),
+               decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::Sum(std::vector{min_decimal, Dec4::FromUnbiased(-1)}),
+               decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::Sum(std::vector{min_decimal, min_decimal}),
+               decimal64::OutOfBoundsError);
+
+  // only the total must fit
+  EXPECT_EQ(decimal64::Sum(std::vector{max_decimal, max_decimal, min_decimal,
+                                       Dec4::FromUnbiased(1)}),
+            max_decimal);
+}
+
+TEST(Decimal64, Scale) {
+  std::vector<Dec4> values{Dec4{"1.5"}, Dec4{"-0.25"}, Dec4{"0.0003"}};
+  decimal64::Scale(values, Dec2{"0.5"});
+  EXPECT_EQ(values, (std::vector<Dec4>{Dec4{"0.75"}, Dec4{"-0.125"},
+                                       Dec4{"0.0002"}}));
+
+  decimal64::Scale(values, 4);
+  EXPECT_EQ(values, (std::vector<Dec4>{Dec4{"3"}, Dec4{"-0.5"},
+                                       Dec4{"0.0008"}}));
+
+  std::vector<Dec4> huge{Dec4{1}, Dec4{"500000000000000"}};
+  EXPECT_THROW(decimal64::Scale(huge, Dec4{2}), decimal64::OutOfBoundsError);
+  EXPECT_EQ(huge[0], Dec4{2});
+}
+
+TYPED_TEST(Decimal64Round, MultiplicationLargeProduct) {
+  using Dec = typename TestFixture::Dec;
+
+  // the products of the unbiased values do not fit in int64_t
+  const Dec big{"123456789.1234"};
+  EXPECT_EQ(big * Dec{1}, big);
+  EXPECT_EQ(big * Dec{-1}, -big);
+  EXPECT_EQ(big * Dec{"0.5"}, Dec{"61728394.5617"});
+  EXPECT_EQ(big * Dec{"1000"}, Dec{"123456789123.4"});
+  EXPECT_EQ(big * Dec{"7.5"} / Dec{"7.5"}, big);
+}
+
 TEST(Decimal64, DivisionByZero) {
   EXPECT_THROW(Dec4{1} / Dec4{0}, decimal64::DivisionByZeroError);
   EXPECT_THROW(Dec4{1} / Dec4::FromStringPermissive("0.00001"),
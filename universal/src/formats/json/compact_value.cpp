@@ -0,0 +1,305 @@
+#include <userver/formats/json/compact_value.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
+
+#include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/compact_value_impl.hpp>
+#include <formats/json/impl/types_impl.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+// Collects the SAX events into CompactValue::Data
+class CompactBuilder final {
+ public:
+  using Data = CompactValue::Data;
+
+  CompactBuilder(Data& data, CompactKeyDictionary& dictionary,
+                 std::shared_ptr<CompactKeyDictionary> dictionary_holder)
+      : data_(data), dictionary_(dictionary) {
+    data_.dictionary = std::move(dictionary_holder);
+  }
+
+  bool Null() {
+    Add(CompactType::kNull);
+    return true;
+  }
+
+  bool Bool(bool b) {
+    Add(CompactType::kBool).b = b;
+    return true;
+  }
+
+  bool Int(int i) { return Int64(i); }
+
+  bool Uint(unsigned u) { return Uint64(u); }
+
+  bool Int64(std::int64_t i) {
+    Add(CompactType::kInt64).i64 = i;
+    return true;
+  }
+
+  bool Uint64(std::uint64_t u) {
+    Add(CompactType::kUint64).u64 = u;
+    return true;
+  }
+
+  bool Double(double d) {
+    Add(CompactType::kDouble).d = d;
+    return true;
+  }
+
+  bool RawNumber(const char*, rapidjson::SizeType, bool) {
+    UINVARIANT(false, "Raw numbers are not expected");
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool = false) {
+    if (data_.strings.size() + length > kMaxStringsSize) {
+      throw Exception("JSON strings are too large for CompactValue");
+    }
+    auto& node = Add(CompactType::kString);
+    node.string = {static_cast<std::uint32_t>(data_.strings.size()), length};
+    data_.strings.append(str, length);
+    return true;
+  }
+
+  bool StartObject() {
+    StartContainer(CompactType::kObject);
+    return true;
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool = false) {
+    const std::string_view key{str, length};
+    auto it = key_indices_.find(key);
+    if (it == key_indices_.end()) {
+      const auto& interned = dictionary_.Intern(key);
+      data_.keys.push_back(&interned);
+      it = key_indices_
+               .emplace(interned,
+                        static_cast<std::uint32_t>(data_.keys.size() - 1))
+               .first;
+    }
+
+    pending_key_ = it->second;
+    stack_.back().keys.push_back(pending_key_);
+    return true;
+  }
+
+  bool EndObject(rapidjson::SizeType = 0) {
+    auto& keys = stack_.back().keys;
+    std::sort(keys.begin(), keys.end());
+    const auto duplicate = std::adjacent_find(keys.begin(), keys.end());
+    if (duplicate != keys.end()) {
+      throw ParseException("Duplicate key: " + *data_.keys[*duplicate]);
+    }
+    EndContainer();
+    return true;
+  }
+
+  bool StartArray() {
+    StartContainer(CompactType::kArray);
+    return true;
+  }
+
+  bool EndArray(rapidjson::SizeType = 0) {
+    EndContainer();
+    return true;
+  }
+
+  void Finish() {
+    UASSERT(stack_.empty());
+    data_.nodes.shrink_to_fit();
+    data_.strings.shrink_to_fit();
+    data_.keys.shrink_to_fit();
+  }
+
+ private:
+  static constexpr std::size_t kMaxStringsSize =
+      std::numeric_limits<std::uint32_t>::max();
+
+  struct Frame final {
+    std::size_t node_index;
+    std::uint32_t size{0};
+    // used for the duplicate keys check
+    boost::container::small_vector<std::uint32_t, 8> keys{};
+  };
+
+  CompactNode& Add(CompactType type) {
+    CompactNode node{};
+    node.type = static_cast<std::uint32_t>(type);
+    if (!stack_.empty()) {
+      auto& parent = stack_.back();
+      if (parent.size == kCompactMaxSize) {
+        throw Exception("JSON container is too large for CompactValue");
+      }
+      ++parent.size;
+
+      const auto& parent_node = data_.nodes[parent.node_index];
+      if (parent_node.GetType() == CompactType::kObject) {
+        node.key = pending_key_;
+      }
+    }
+    return data_.nodes.emplace_back(node);
+  }
+
+  void StartContainer(CompactType type) {
+    Add(type);
+    stack_.push_back({data_.nodes.size() - 1});
+  }
+
+  void EndContainer() {
+    data_.nodes[stack_.back().node_index].size = stack_.back().size;
+    stack_.pop_back();
+  }
+
+  Data& data_;
+  CompactKeyDictionary& dictionary_;
+  std::unordered_map<std::string_view, std::uint32_t> key_indices_;
+  std::vector<Frame> stack_;
+  std::uint32_t pending_key_{0};
+};
+
+}  // namespace impl
+
+namespace {
+
+impl::Allocator g_allocator;
+
+std::shared_ptr<CompactKeyDictionary> EnsureDictionary(
+    std::shared_ptr<CompactKeyDictionary> dictionary) {
+  if (!dictionary) return std::make_shared<CompactKeyDictionary>();
+  return dictionary;
+}
+
+}  // namespace
+
+struct CompactKeyDictionary::Impl final {
+  mutable std::mutex mutex;
+  // values own the keys, the views point to them
+  std::unordered_map<std::string_view, std::unique_ptr<std::string>> keys;
+};
+
+CompactKeyDictionary::CompactKeyDictionary() : impl_(std::make_unique<Impl>()) {}
+
+CompactKeyDictionary::~CompactKeyDictionary() = default;
+
+std::size_t CompactKeyDictionary::GetSize() const {
+  std::lock_guard lock{impl_->mutex};
+  return impl_->keys.size();
+}
+
+const std::string& CompactKeyDictionary::Intern(std::string_view key) {
+  std::lock_guard lock{impl_->mutex};
+  auto it = impl_->keys.find(key);
+  if (it == impl_->keys.end()) {
+    auto interned = std::make_unique<std::string>(key);
+    const std::string_view view{*interned};
+    it = impl_->keys.emplace(view, std::move(interned)).first;
+  }
+  return *it->second;
+}
+
+CompactValue::CompactValue() = default;
+
+CompactValue::CompactValue(const Value& value)
+    : CompactValue(value, std::make_shared<CompactKeyDictionary>()) {}
+
+CompactValue::CompactValue(const Value& value,
+                           std::shared_ptr<CompactKeyDictionary> dictionary) {
+  value.CheckNotMissing();
+  if (value.IsNull()) return;
+
+  dictionary = EnsureDictionary(std::move(dictionary));
+  auto data = std::make_shared<Data>();
+  impl::CompactBuilder builder{*data, *dictionary, dictionary};
+  AcceptNoRecursion(value.GetNative(), builder);
+  builder.Finish();
+  data_ = std::move(data);
+}
+
+CompactValue::CompactValue(std::shared_ptr<const Data> data)
+    : data_(std::move(data)) {}
+
+CompactValue::~CompactValue() = default;
+
+CompactValue CompactValue::FromString(
+    std::string_view json, std::shared_ptr<CompactKeyDictionary> dictionary) {
+  if (json.empty()) {
+    throw ParseException("JSON document is empty");
+  }
+
+  dictionary = EnsureDictionary(std::move(dictionary));
+  auto data = std::make_shared<Data>();
+  impl::CompactBuilder builder{*data, *dictionary, dictionary};
+
+  rapidjson::Reader reader;
+  rapidjson::MemoryStream stream{json.data(), json.size()};
+  const auto ok = reader.Parse<rapidjson::kParseDefaultFlags |
+                               rapidjson::kParseIterativeFlag |
+                               rapidjson::kParseFullPrecisionFlag>(stream,
+                                                                   builder);
+  if (!ok) {
+    throw ParseException(fmt::format("JSON parse error at offset {}: {}",
+                                     ok.Offset(),
+                                     rapidjson::GetParseError_En(ok.Code())));
+  }
+  builder.Finish();
+
+  if (data->nodes.size() == 1 &&
+      data->nodes.front().GetType() == impl::CompactType::kNull) {
+    return {};
+  }
+  return CompactValue{std::move(data)};
+}
+
+bool CompactValue::IsNull() const noexcept { return !data_; }
+
+std::size_t CompactValue::GetMemoryUsage() const noexcept {
+  if (!data_) return 0;
+
+  return sizeof(Data) + data_->nodes.capacity() * sizeof(impl::CompactNode) +
+         data_->strings.capacity() +
+         data_->keys.capacity() * sizeof(const std::string*);
+}
+
+std::string ToString(const CompactValue& value) {
+  StringBuilder sb;
+  sb.WriteValue(value);
+  return sb.GetString();
+}
+
+Value CompactValue::ToValue() const {
+  impl::Document document{&g_allocator};
+  Accept(document);
+
+  auto generator = [](const auto&) { return true; };
+  document.Populate(generator);
+
+  return Value{impl::VersionedValuePtr::Create(std::move(document))};
+}
+
+Value Serialize(const CompactValue& value, formats::serialize::To<Value>) {
+  return value.ToValue();
+}
+
+CompactValue Parse(const Value& value, formats::parse::To<CompactValue>) {
+  return CompactValue{value};
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/compact_value.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kJson = R"({
+  "id": 42,
+  "neg": -1,
+  "big": 18446744073709551615,
+  "pi": 3.14,
+  "ok": true,
+  "nothing": null,
+  "name": "compact",
+  "tags": ["a", "b", []],
+  "nested": {"empty": {}, "items": [{"id": 1}, {"id": 2}]}
+})";
+
+}  // namespace
+
+TEST(FormatsJsonCompactValue, Roundtrip) {
+  const auto json = formats::json::FromString(kJson);
+  const auto compact = json.As<formats::json::CompactValue>();
+  EXPECT_FALSE(compact.IsNull());
+
+  const auto restored = formats::json::ValueBuilder{compact}.ExtractValue();
+  EXPECT_EQ(restored, json);
+  EXPECT_EQ(formats::json::ToString(compact), formats::json::ToString(json));
+}
+
+TEST(FormatsJsonCompactValue, FromString) {
+  const auto compact = formats::json::CompactValue::FromString(kJson);
+  const auto restored = formats::json::ValueBuilder{compact}.ExtractValue();
+  EXPECT_EQ(restored, formats::json::FromString(kJson));
+  EXPECT_GT(compact.GetMemoryUsage(), 0);
+}
+
+TEST(FormatsJsonCompactValue, Scalars) {
+  for (const std::string_view json : {"1", "\"str\"", "[]", "{}", "false"}) {
+    const auto compact = formats::json::CompactValue::FromString(json);
+    EXPECT_EQ(formats::json::ToString(compact), json);
+  }
+}
+
+TEST(FormatsJsonCompactValue, Null) {
+  const formats::json::CompactValue compact;
+  EXPECT_TRUE(compact.IsNull());
+  EXPECT_EQ(compact.GetMemoryUsage(), 0);
+  EXPECT_EQ(formats::json::ToString(compact), "null");
+  EXPECT_TRUE(formats::json::CompactValue::FromString("null").IsNull());
+
+  const auto restored = formats::json::ValueBuilder{compact}.ExtractValue();
+  EXPECT_TRUE(restored.IsNull());
+}
+
+TEST(FormatsJsonCompactValue, Errors) {
+  using formats::json::CompactValue;
+  EXPECT_THROW(CompactValue::FromString(""), formats::json::ParseException);
+  EXPECT_THROW(CompactValue::FromString("{"), formats::json::ParseException);
+  EXPECT_THROW(CompactValue::FromString(R"({"a": 1, "a": 2})"),
+               formats::json::ParseException);
+
+  const auto json = formats::json::FromString("{}");
+  EXPECT_THROW(CompactValue{json["missing"]},
+               formats::json::MemberMissingException);
+}
+
+TEST(FormatsJsonCompactValue, SharedDictionary) {
+  auto dictionary = std::make_shared<formats::json::CompactKeyDictionary>();
+
+  const auto first = formats::json::CompactValue::FromString(
+      R"({"id": 1, "name": "first"})", dictionary);
+  EXPECT_EQ(dictionary->GetSize(), 2);
+
+  const auto second = formats::json::CompactValue{
+      formats::json::FromString(R"({"id": 2, "title": "second"})"),
+      dictionary};
+  EXPECT_EQ(dictionary->GetSize(), 3);
+
+  EXPECT_EQ(formats::json::ToString(first), R"({"id":1,"name":"first"})");
+  EXPECT_EQ(formats::json::ToString(second), R"({"id":2,"title":"second"})");
+}
+
+TEST(FormatsJsonCompactValue, StringBuilder) {
+  const auto compact =
+      formats::json::CompactValue::FromString(R"({"a": [1, {"b": null}]})");
+
+  formats::json::StringBuilder sb;
+  {
+    formats::json::StringBuilder::ObjectGuard guard{sb};
+    sb.Key("value");
+    WriteToStream(compact, sb);
+    sb.Key("after");
+    sb.WriteBool(true);
+  }
+  EXPECT_EQ(sb.GetString(), R"({"value":{"a":[1,{"b":null}]},"after":true})");
+}
+
+USERVER_NAMESPACE_END
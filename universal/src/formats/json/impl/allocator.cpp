@@ -0,0 +1,163 @@
+#include <formats/json/impl/allocator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <rapidjson/rapidjson.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+constexpr std::size_t kFirstChunkSize = 4 * 1024;
+// The same as the default chunk of rapidjson::MemoryPoolAllocator
+constexpr std::size_t kMaxChunkSize = 64 * 1024;
+
+enum class BlockSource : std::uint64_t {
+  kHeap = 1,
+  kArena = 2,
+};
+
+struct BlockHeader final {
+  BlockSource source;
+};
+
+constexpr std::size_t kHeaderSize = RAPIDJSON_ALIGN(sizeof(BlockHeader));
+
+BlockHeader& GetHeader(void* ptr) noexcept {
+  return *reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) -
+                                         kHeaderSize);
+}
+
+void* MarkBlock(void* block, BlockSource source) noexcept {
+  static_cast<BlockHeader*>(block)->source = source;
+  return static_cast<char*>(block) + kHeaderSize;
+}
+
+}  // namespace
+
+struct Arena::Chunk final {
+  Chunk* next;
+  std::size_t capacity;
+  std::size_t used;
+
+  char* Data() noexcept {
+    return reinterpret_cast<char*>(this) + RAPIDJSON_ALIGN(sizeof(Chunk));
+  }
+};
+
+Arena::~Arena() {
+  while (chunks_) {
+    auto* next = chunks_->next;
+    std::free(chunks_);
+    chunks_ = next;
+  }
+}
+
+void* Arena::Allocate(std::size_t size) {
+  size = RAPIDJSON_ALIGN(size);
+  if (!chunks_ || chunks_->capacity - chunks_->used < size) AddChunk(size);
+
+  void* block = chunks_->Data() + chunks_->used;
+  chunks_->used += size;
+  return block;
+}
+
+bool Arena::TryExtend(void* block, std::size_t old_size,
+                      std::size_t new_size) noexcept {
+  if (!chunks_) return false;
+
+  old_size = RAPIDJSON_ALIGN(old_size);
+  new_size = RAPIDJSON_ALIGN(new_size);
+  if (new_size <= old_size) return true;
+
+  auto* chunk_end = chunks_->Data() + chunks_->used;
+  if (static_cast<char*>(block) + old_size != chunk_end ||
+      chunks_->capacity - chunks_->used < new_size - old_size) {
+    return false;
+  }
+
+  chunks_->used += new_size - old_size;
+  return true;
+}
+
+void Arena::AddChunk(std::size_t min_size) {
+  if (next_chunk_size_ == 0) next_chunk_size_ = kFirstChunkSize;
+  const auto capacity = std::max(next_chunk_size_, min_size);
+
+  auto* chunk = static_cast<Chunk*>(
+      std::malloc(RAPIDJSON_ALIGN(sizeof(Chunk)) + capacity));
+  if (!chunk) throw std::bad_alloc();
+
+  chunk->next = chunks_;
+  chunk->capacity = capacity;
+  chunk->used = 0;
+  chunks_ = chunk;
+  next_chunk_size_ = std::min(next_chunk_size_ * 2, kMaxChunkSize);
+}
+
+void* Allocator::Malloc(std::size_t size) {
+  // The same as rapidjson::CrtAllocator
+  if (size == 0) return nullptr;
+
+  if (arena_) {
+    return MarkBlock(arena_->Allocate(kHeaderSize + size),
+                     BlockSource::kArena);
+  }
+
+  auto* block = std::malloc(kHeaderSize + size);
+  if (!block) return nullptr;
+  return MarkBlock(block, BlockSource::kHeap);
+}
+
+void* Allocator::Realloc(void* original_ptr, std::size_t original_size,
+                         std::size_t new_size) {
+  if (!original_ptr) return Malloc(new_size);
+  if (new_size == 0) {
+    Free(original_ptr);
+    return nullptr;
+  }
+
+  const auto source = GetHeader(original_ptr).source;
+  UASSERT(source == BlockSource::kHeap || source == BlockSource::kArena);
+
+  if (!arena_ && source == BlockSource::kHeap) {
+    auto* block =
+        std::realloc(&GetHeader(original_ptr), kHeaderSize + new_size);
+    if (!block) return nullptr;
+    return static_cast<char*>(block) + kHeaderSize;
+  }
+
+  if (arena_ && source == BlockSource::kArena &&
+      arena_->TryExtend(&GetHeader(original_ptr), kHeaderSize + original_size,
+                        kHeaderSize + new_size)) {
+    return original_ptr;
+  }
+
+  auto* new_ptr = Malloc(new_size);
+  if (!new_ptr) return nullptr;
+  std::memcpy(new_ptr, original_ptr, std::min(original_size, new_size));
+  Free(original_ptr);
+  return new_ptr;
+}
+
+void Allocator::Free(void* ptr) noexcept {
+  if (!ptr) return;
+
+  auto& header = GetHeader(ptr);
+  UASSERT(header.source == BlockSource::kHeap ||
+          header.source == BlockSource::kArena);
+  // The arena blocks are released along with the arena
+  if (header.source == BlockSource::kHeap) std::free(&header);
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+// Monotonic memory resource. The blocks are never freed one by one, all the
+// memory is released at once in the destructor. Not thread-safe.
+class Arena final {
+ public:
+  Arena() noexcept = default;
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  ~Arena();
+
+  // Returns a block of at least `size` bytes aligned as RAPIDJSON_ALIGN
+  void* Allocate(std::size_t size);
+
+  // Grows the block in place if it is the last allocated one and the chunk has
+  // enough space
+  bool TryExtend(void* block, std::size_t old_size,
+                 std::size_t new_size) noexcept;
+
+ private:
+  struct Chunk;
+
+  void AddChunk(std::size_t min_size);
+
+  // The current chunk is the head of the list
+  Chunk* chunks_{nullptr};
+  std::size_t next_chunk_size_{0};
+};
+
+// rapidjson allocator of all the JSON values. The blocks are taken from the
+// heap or, if the allocator is constructed with an arena, from the arena.
+//
+// rapidjson frees the blocks with the static Free(), so each block starts with
+// a header that tells whether the block should be returned to the heap.
+class Allocator final {
+ public:
+  static constexpr bool kNeedFree = true;
+
+  Allocator() noexcept = default;
+  explicit Allocator(Arena& arena) noexcept : arena_(&arena) {}
+
+  void* Malloc(std::size_t size);
+  void* Realloc(void* original_ptr, std::size_t original_size,
+                std::size_t new_size);
+  static void Free(void* ptr) noexcept;
+
+  // The values allocated from an arena must not outlive the root value, that
+  // owns the arena
+  bool HasArena() const noexcept { return arena_ != nullptr; }
+
+  bool operator==(const Allocator& other) const noexcept {
+    return arena_ == other.arena_;
+  }
+  bool operator!=(const Allocator& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  Arena* arena_{nullptr};
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/formats/json/compact_value.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+enum class CompactType : std::uint32_t {
+  kNull,
+  kBool,
+  kInt64,
+  kUint64,
+  kDouble,
+  kString,
+  kArray,
+  kObject,
+};
+
+// Nodes are stored in pre-order, the children of an array or object follow
+// it. 16 bytes per node.
+struct CompactNode final {
+  struct StringRef final {
+    std::uint32_t offset;
+    std::uint32_t length;
+  };
+
+  CompactType GetType() const { return static_cast<CompactType>(type); }
+
+  // CompactType
+  std::uint32_t type : 3;
+  // count of the children of an array or object
+  std::uint32_t size : 29;
+  // index in CompactValue::Data::keys, if the parent is an object
+  std::uint32_t key;
+
+  union {
+    bool b;
+    std::int64_t i64;
+    std::uint64_t u64;
+    double d;
+    StringRef string;
+  };
+};
+
+static_assert(sizeof(CompactNode) == 16);
+
+inline constexpr std::uint32_t kCompactMaxSize = (1u << 29) - 1;
+
+}  // namespace impl
+
+struct CompactValue::Data final {
+  std::vector<impl::CompactNode> nodes;
+  // all the string values of the nodes
+  std::string strings;
+  // distinct keys of the value, owned by the dictionary
+  std::vector<const std::string*> keys;
+  std::shared_ptr<CompactKeyDictionary> dictionary;
+};
+
+template <typename Handler>
+void CompactValue::Accept(Handler& handler) const {
+  using impl::CompactType;
+
+  if (!data_) {
+    handler.Null();
+    return;
+  }
+
+  struct Frame final {
+    bool is_object;
+    std::uint32_t size;
+    std::uint32_t left;
+  };
+  boost::container::small_vector<Frame, 16> stack;
+
+  const auto& data = *data_;
+  for (const auto& node : data.nodes) {
+    if (!stack.empty() && stack.back().is_object) {
+      const auto& key = *data.keys[node.key];
+      handler.Key(key.data(), key.size(), true);
+    }
+
+    switch (node.GetType()) {
+      case CompactType::kNull:
+        handler.Null();
+        break;
+      case CompactType::kBool:
+        handler.Bool(node.b);
+        break;
+      case CompactType::kInt64:
+        handler.Int64(node.i64);
+        break;
+      case CompactType::kUint64:
+        handler.Uint64(node.u64);
+        break;
+      case CompactType::kDouble:
+        handler.Double(node.d);
+        break;
+      case CompactType::kString:
+        handler.String(data.strings.data() + node.string.offset,
+                       node.string.length, true);
+        break;
+      case CompactType::kArray:
+        handler.StartArray();
+        stack.push_back({false, node.size, node.size});
+        break;
+      case CompactType::kObject:
+        handler.StartObject();
+        stack.push_back({true, node.size, node.size});
+        break;
+    }
+
+    const bool is_container = node.GetType() == CompactType::kArray ||
+                              node.GetType() == CompactType::kObject;
+    if (is_container && node.size != 0) continue;
+
+    // the node is complete, close the containers that are complete too
+    if (is_container) {
+      if (stack.back().is_object) {
+        handler.EndObject(0);
+      } else {
+        handler.EndArray(0);
+      }
+      stack.pop_back();
+    }
+    while (!stack.empty() && --stack.back().left == 0) {
+      if (stack.back().is_object) {
+        handler.EndObject(stack.back().size);
+      } else {
+        handler.EndArray(stack.back().size);
+      }
+      stack.pop_back();
+    }
+  }
+
+  UASSERT(stack.empty());
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
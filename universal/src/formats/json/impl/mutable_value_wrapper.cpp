@@ -9,6 +9,7 @@
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <formats/json/impl/allocator.hpp>
 #include <formats/json/impl/exttypes.hpp>
 #include <userver/formats/common/path.hpp>
 
@@ -116,6 +117,10 @@ void MutableValueWrapper::OnMembersChange() {
   impl_->current_version = impl_->value.root_.Version();
 }
 
+Allocator& MutableValueWrapper::GetAllocator() {
+  return impl_->value.root_.GetAllocator();
+}
+
 void MutableValueWrapper::EnsureCurrent() const {
   if (impl_->value.root_.Version() == impl_->current_version) {
     return;
@@ -6,17 +6,28 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json::impl {
 
+namespace {
+Allocator g_allocator;
+}  // namespace
+
 VersionedValuePtr::Data::Data(Document&& doc)
     : Data(static_cast<Value&&>(doc)) {
   static_assert(
       // NOLINTNEXTLINE(misc-redundant-expression)
-      std::is_same_v<::rapidjson::CrtAllocator, Value::AllocatorType> &&
-          std::is_same_v<::rapidjson::CrtAllocator, Document::AllocatorType>,
-      "Both Document and Value must use CrtAllocator for the fast move");
+      std::is_same_v<Allocator, Value::AllocatorType> &&
+          std::is_same_v<Allocator, Document::AllocatorType>,
+      "Both Document and Value must use the same allocator for the fast move");
 }
 
+VersionedValuePtr::Data::Data(WithArena)
+    : arena(std::make_unique<Arena>()), allocator(*arena) {}
+
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
 
+VersionedValuePtr VersionedValuePtr::CreateWithArena() {
+  return VersionedValuePtr{std::make_shared<Data>(Data::WithArena{})};
+}
+
 VersionedValuePtr::VersionedValuePtr(std::shared_ptr<Data>&& data) noexcept
     : data_(std::move(data)) {}
 
@@ -52,6 +63,10 @@ size_t VersionedValuePtr::Version() const {
 
 void VersionedValuePtr::BumpVersion() { ++data_->version; }
 
+Allocator& VersionedValuePtr::GetAllocator() {
+  return data_ ? data_->allocator : g_allocator;
+}
+
 }  // namespace formats::json::impl
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -11,6 +13,8 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json::impl {
 
 struct VersionedValuePtr::Data {
+  struct WithArena {};
+
   template <typename... Args>
   explicit Data(Args&&... args) : native(std::forward<Args>(args)...) {}
 
@@ -18,8 +22,15 @@ struct VersionedValuePtr::Data {
   // https://github.com/Tencent/rapidjson/issues/387
   explicit Data(Document&&);
 
+  explicit Data(WithArena);
+
   ~Data();
 
+  // owns the memory of the nodes if the value is built with an arena,
+  // must outlive the native value
+  std::unique_ptr<Arena> arena;
+  Allocator allocator;
+
   // native rapidjson value
   Value native;
 
@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
+#include <string_view>
+
 #include <fmt/format.h>
 
 #include <userver/formats/json/parser/parser.hpp>
@@ -97,4 +100,128 @@ void JsonParseValueSax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
+namespace {
+
+struct Item {
+  std::int64_t id{};
+  std::string title;
+  std::vector<std::string> tags;
+};
+
+constexpr auto GetJsonFieldNames(formats::parse::To<Item>) {
+  return std::array<std::string_view, 3>{"id", "title", "tags"};
+}
+
+Item Parse(const formats::json::Value& value, formats::parse::To<Item>) {
+  return {value["id"].As<std::int64_t>(), value["title"].As<std::string>(),
+          value["tags"].As<std::vector<std::string>>()};
+}
+
+// The parser is written the way the codegen would write it
+class ItemParser final : public formats::json::parser::TypedParser<Item> {
+ public:
+  void Reset() override { result_ = {}; }
+
+ protected:
+  void StartObject() override {}
+
+  void Key(std::string_view key) override {
+    key_ = key;
+    if (key == "id") {
+      Push(id_parser_, id_sink_);
+    } else if (key == "title") {
+      Push(title_parser_, title_sink_);
+    } else if (key == "tags") {
+      Push(tags_parser_, tags_sink_);
+    } else {
+      throw formats::json::parser::InternalParseError("Unknown field '" +
+                                                      key_ + "'");
+    }
+  }
+
+  void EndObject() override { SetResult(std::move(result_)); }
+
+  std::string Expected() const override { return "object"; }
+
+  std::string GetPathItem() const override { return key_; }
+
+ private:
+  template <typename Parser, typename Sink>
+  void Push(Parser& parser, Sink& sink) {
+    parser.Reset();
+    parser.Subscribe(sink);
+    parser_state_->PushParser(parser.GetParser());
+  }
+
+  Item result_;
+  std::string key_;
+
+  formats::json::parser::Int64Parser id_parser_;
+  formats::json::parser::SubscriberSink<std::int64_t> id_sink_{result_.id};
+
+  formats::json::parser::StringParser title_parser_;
+  formats::json::parser::SubscriberSink<std::string> title_sink_{
+      result_.title};
+
+  formats::json::parser::StringParser tag_parser_;
+  formats::json::parser::ArrayParser<std::string,
+                                     formats::json::parser::StringParser>
+      tags_parser_{tag_parser_};
+  formats::json::parser::SubscriberSink<std::vector<std::string>> tags_sink_{
+      result_.tags};
+};
+
+std::string BuildItems(size_t len) {
+  std::string r = "[";
+  for (size_t i = 0; i < len; i++) {
+    if (i > 0) r += ',';
+    r += fmt::format(
+        R"({{"id": {}, "title": "title of the item, that does not fit the )"
+        R"(short string", "tags": ["first tag", "second tag"]}})",
+        i);
+  }
+  r += ']';
+  return r;
+}
+
+}  // namespace
+
+void JsonParseStructDom(benchmark::State& state) {
+  const auto input = BuildItems(state.range(0));
+  for (auto _ : state) {
+    const auto res = formats::json::FromString(input).As<std::vector<Item>>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseStructDom)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonParseStructSax(benchmark::State& state) {
+  const auto input = BuildItems(state.range(0));
+  for (auto _ : state) {
+    std::vector<Item> result;
+    formats::json::parser::SubscriberSink<std::vector<Item>> sink(result);
+
+    ItemParser item_parser;
+    formats::json::parser::ArrayParser<Item, ItemParser> parser(item_parser);
+    parser.Reset();
+    parser.Subscribe(sink);
+
+    formats::json::parser::ParserState state;
+    state.PushParser(parser);
+    state.ProcessInput(input);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(JsonParseStructSax)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonParseStructSaxDefault(benchmark::State& state) {
+  const auto input = BuildItems(state.range(0));
+  for (auto _ : state) {
+    const auto res =
+        formats::json::parser::ParseToType<std::vector<Item>>(input);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseStructSaxDefault)->RangeMultiplier(8)->Range(1, 4096);
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,5 @@
 #include <userver/formats/json/parser/parser_json.hpp>
 
-#include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
 
 #include <formats/json/impl/types_impl.hpp>
@@ -10,7 +9,7 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json::parser {
 
 namespace {
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 }  // namespace
 
 struct JsonValueParser::Impl {
@@ -133,6 +133,14 @@ void ParserState::PopMe([[maybe_unused]] BaseParser& parser) {
   impl_->stack.pop_back();
 }
 
+std::size_t ParserState::GetStackSize() const { return impl_->stack.size(); }
+
+void ParserState::PopUntil(std::size_t size) {
+  UASSERT(size <= impl_->stack.size());
+
+  impl_->stack.erase(impl_->stack.begin() + size, impl_->stack.end());
+}
+
 }  // namespace formats::json::parser
 
 USERVER_NAMESPACE_END
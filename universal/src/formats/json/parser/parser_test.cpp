@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <map>
+#include <optional>
+#include <string_view>
 #include <unordered_map>
+#include <variant>
+#include <vector>
 
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
@@ -369,4 +375,91 @@ TEST(JsonStringParser, BomSymbol) {
   EXPECT_EQ(value_str, value_sax);
 }
 
+TEST(JsonStringParser, DefaultOptional) {
+  EXPECT_EQ(fjp::ParseToType<std::optional<int>>("null"), std::nullopt);
+  EXPECT_EQ(fjp::ParseToType<std::optional<int>>("5"), 5);
+  EXPECT_EQ(fjp::ParseToType<std::optional<std::vector<int>>>("[1, 2]"),
+            (std::vector<int>{1, 2}));
+}
+
+TEST(JsonStringParser, DefaultContainers) {
+  using Map = std::unordered_map<std::string, std::vector<std::int64_t>>;
+  EXPECT_EQ(fjp::ParseToType<Map>(R"({"a": [1, 2], "b": []})"),
+            (Map{{"a", {1, 2}}, {"b", {}}}));
+
+  EXPECT_EQ(fjp::ParseToType<std::vector<std::string>>(R"(["a", "b"])"),
+            (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(JsonStringParser, DefaultVariant) {
+  using Variant = std::variant<std::int64_t, std::string>;
+  EXPECT_EQ(fjp::ParseToType<Variant>("1"), Variant{1});
+  EXPECT_EQ(fjp::ParseToType<Variant>(R"("1")"), Variant{"1"});
+  EXPECT_THROW_TEXT(fjp::ParseToType<Variant>("true"), fjp::ParseError,
+                    "Parse error at pos 4, path '': one of the variant "
+                    "alternatives was expected, but bool found, the latest "
+                    "token was true");
+
+  using Containers =
+      std::variant<std::vector<int>, std::map<std::string, int>>;
+  EXPECT_EQ(fjp::ParseToType<Containers>("[1]"),
+            Containers{std::vector<int>{1}});
+  EXPECT_EQ(fjp::ParseToType<Containers>(R"({"a": 1})"),
+            Containers{(std::map<std::string, int>{{"a", 1}})});
+}
+
+namespace {
+
+struct Nested final {
+  int value{0};
+};
+
+struct Aggregate final {
+  std::int64_t id{0};
+  std::string title;
+  std::optional<std::vector<std::string>> tags;
+  std::optional<Nested> nested;
+};
+
+constexpr auto GetJsonFieldNames(formats::parse::To<Nested>) {
+  return std::array<std::string_view, 1>{"value"};
+}
+
+constexpr auto GetJsonFieldNames(formats::parse::To<Aggregate>) {
+  return std::array<std::string_view, 4>{"id", "title", "tags", "nested"};
+}
+
+}  // namespace
+
+TEST(JsonStringParser, Aggregate) {
+  const auto result = fjp::ParseToType<Aggregate>(
+      R"({"id": 1, "unknown": {"a": [1, {"b": 2}]}, "title": "t",)"
+      R"( "nested": {"value": 2}})");
+  EXPECT_EQ(result.id, 1);
+  EXPECT_EQ(result.title, "t");
+  EXPECT_EQ(result.tags, std::nullopt);
+  ASSERT_TRUE(result.nested);
+  EXPECT_EQ(result.nested->value, 2);
+
+  const auto items = fjp::ParseToType<std::vector<Aggregate>>(
+      R"([{"id": 1, "title": "a", "tags": ["x"]}, {"id": 2, "title": "b"}])");
+  ASSERT_EQ(items.size(), 2);
+  EXPECT_EQ(items[0].tags, (std::vector<std::string>{"x"}));
+  EXPECT_EQ(items[1].id, 2);
+  EXPECT_EQ(items[1].tags, std::nullopt);
+}
+
+TEST(JsonStringParser, AggregateErrors) {
+  EXPECT_THROW_TEXT(fjp::ParseToType<Aggregate>("{}"), fjp::ParseError,
+                    "Parse error at pos 1, path '': Missing required field "
+                    "'id'");
+
+  EXPECT_THROW_TEXT(
+      fjp::ParseToType<Aggregate>(
+          R"({"id": 1, "title": "t", "nested": {"value": "x"}})"),
+      fjp::ParseError,
+      "Parse error at pos 47, path 'nested.value': integer was expected, "
+      "but string found, the latest token was : \"x\"");
+}
+
 USERVER_NAMESPACE_END
@@ -1,10 +1,10 @@
 #include <gtest/gtest.h>
 
-#include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
 
 #include <userver/formats/json/value_builder.hpp>
 
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 // These tests ensure that array/object members are internally stored in plain
@@ -14,7 +14,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace {
-::rapidjson::CrtAllocator g_allocator;
+formats::json::impl::Allocator g_allocator;
 }  // namespace
 
 // Ensure contiguous allocation in rapidjson arrays
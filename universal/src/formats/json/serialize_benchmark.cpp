@@ -1,11 +1,13 @@
 #include <string_view>
 
 #include <benchmark/benchmark.h>
+#include <fmt/format.h>
 #include <rapidjson/document.h>
 
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -1169,6 +1171,70 @@ void DeepWidthJson(benchmark::State& state) {
   }
 }
 
+// response-like json: an array of objects with several strings each
+formats::json::Value BuildResponse(formats::json::ValueBuilder builder,
+                                   std::size_t size) {
+  auto items = builder["items"];
+  items.Resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    auto item = items[i];
+    item["id"] = static_cast<std::int64_t>(i);
+    item["title"] = "title of the item that does not fit the short string";
+    item["description"] = "description of the item, that is longer than 21";
+    auto tags = item["tags"];
+    for (std::size_t j = 0; j < 4; ++j) {
+      tags.PushBack("tag of the item that does not fit the short string");
+    }
+  }
+  return builder.ExtractValue();
+}
+
+void BuildJson(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    auto json = BuildResponse(formats::json::ValueBuilder{}, size);
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+void BuildJsonWithArena(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    auto json = BuildResponse(
+        formats::json::ValueBuilder{formats::json::kArena}, size);
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+// response-like json of `size` items, about 250 bytes each. The pretty printed
+// one has the members on separate lines, indented with spaces.
+std::string MakeLargeJson(std::size_t size, bool pretty) {
+  const std::string_view open_indent = pretty ? "\n    " : "";
+  const std::string_view member_indent = pretty ? "\n      " : "";
+
+  std::string result = "{\"items\":[";
+  for (std::size_t i = 0; i < size; ++i) {
+    if (i != 0) result += ',';
+    result += fmt::format(
+        "{0}{{{1}\"id\":{2},{1}\"title\":\"title of the item {2}, that does "
+        "not fit the short string\",{1}\"description\":\"description of the "
+        "item, that is longer than 21\",{1}\"price\":{2}.25,{1}\"tags\":"
+        "[\"first tag\",\"second tag\",\"third tag\"]{0}}}",
+        open_indent, member_indent, i);
+  }
+  result += "]}";
+  return result;
+}
+
+void ParseLargeJson(benchmark::State& state) {
+  const auto doc = MakeLargeJson(state.range(0), state.range(1));
+  for (auto _ : state) {
+    auto json = formats::json::FromString(doc);
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * doc.size());
+}
+
 BENCHMARK(SmallJson);
 
 BENCHMARK(MiddleJson);
@@ -1179,6 +1245,13 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+BENCHMARK(ParseLargeJson)
+    ->ArgsProduct({{1 << 10, 1 << 12, 1 << 14}, {false, true}});
+
+BENCHMARK(BuildJson)->RangeMultiplier(8)->Range(1, 4096);
+
+BENCHMARK(BuildJsonWithArena)->RangeMultiplier(8)->Range(1, 4096);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 
 #include <formats/common/validations.hpp>
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/compact_value_impl.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/datetime.hpp>
@@ -67,6 +68,10 @@ void StringBuilder::WriteValue(const formats::json::Value& value) {
   formats::json::AcceptNoRecursion(value.GetNative(), impl_->writer);
 }
 
+void StringBuilder::WriteValue(const CompactValue& value) {
+  value.Accept(impl_->writer);
+}
+
 void WriteToStream(bool value, StringBuilder& sw) { sw.WriteBool(value); }
 
 void WriteToStream(long long value, StringBuilder& sw) { sw.WriteInt64(value); }
@@ -99,6 +104,10 @@ void WriteToStream(const formats::json::Value& value, StringBuilder& sw) {
   sw.WriteValue(value);
 }
 
+void WriteToStream(const CompactValue& value, StringBuilder& sw) {
+  sw.WriteValue(value);
+}
+
 void WriteToStream(const std::string& value, StringBuilder& sw) {
   WriteToStream(std::string_view{value}, sw);
 }
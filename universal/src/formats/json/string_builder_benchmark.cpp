@@ -1,7 +1,13 @@
 #include <benchmark/benchmark.h>
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -73,4 +79,85 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+namespace {
+
+// A response-like struct as it comes from the codegen
+struct Item {
+  std::int64_t id{};
+  std::string title;
+  std::optional<double> price;
+  std::vector<std::string> tags;
+};
+
+struct Response {
+  std::vector<Item> items;
+};
+
+Value Serialize(const Item& item, formats::serialize::To<Value>) {
+  ValueBuilder builder;
+  builder["id"] = item.id;
+  builder["title"] = item.title;
+  if (item.price) builder["price"] = *item.price;
+  builder["tags"] = item.tags;
+  return builder.ExtractValue();
+}
+
+Value Serialize(const Response& response, formats::serialize::To<Value>) {
+  ValueBuilder builder;
+  builder["items"] = response.items;
+  return builder.ExtractValue();
+}
+
+void WriteToStream(const Item& item, StringBuilder& sw) {
+  StringBuilder::ObjectGuard guard{sw};
+  sw.Key("id");
+  WriteToStream(item.id, sw);
+  sw.Key("title");
+  WriteToStream(item.title, sw);
+  if (item.price) {
+    sw.Key("price");
+    WriteToStream(*item.price, sw);
+  }
+  sw.Key("tags");
+  WriteToStream(item.tags, sw);
+}
+
+void WriteToStream(const Response& response, StringBuilder& sw) {
+  StringBuilder::ObjectGuard guard{sw};
+  sw.Key("items");
+  WriteToStream(response.items, sw);
+}
+
+Response MakeResponse(std::size_t size) {
+  Response response;
+  for (std::size_t i = 0; i < size; ++i) {
+    response.items.push_back(
+        {static_cast<std::int64_t>(i),
+         "title of the item, that does not fit the short string",
+         (i % 2) ? std::optional<double>{} : 12.5,
+         {"first tag", "second tag"}});
+  }
+  return response;
+}
+
+}  // namespace
+
+void JsonSerializeStructDom(benchmark::State& state) {
+  const auto response = MakeResponse(state.range(0));
+  for (auto _ : state) {
+    const auto res = ToString(ValueBuilder{response}.ExtractValue());
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonSerializeStructDom)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonSerializeStructSax(benchmark::State& state) {
+  const auto response = MakeResponse(state.range(0));
+  for (auto _ : state) {
+    const auto res = ToStringViaSax(response);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonSerializeStructSax)->RangeMultiplier(8)->Range(1, 4096);
+
 USERVER_NAMESPACE_END
@@ -206,6 +206,17 @@ TEST(JsonStringBuilder, Second) {
   EXPECT_EQ(sw.GetString(), "42");
 }
 
+TEST(JsonStringBuilder, ToStringViaSax) {
+  testing::Response200 response{"type", {{}, {}}};
+  EXPECT_EQ(formats::json::ToStringViaSax(response),
+            R"({"object_no_mapping_type":"type",)"
+            R"("echoObjectWithMapping":[{},{}]})");
+
+  EXPECT_EQ(formats::json::ToStringViaSax(std::vector<int>{1, 2}), "[1,2]");
+  EXPECT_EQ(formats::json::ToStringViaSax(std::optional<std::string>{}),
+            "null");
+}
+
 TEST(JsonStringBuilder, EmptyOptional) {
   StringBuilder sw;
   WriteToStream(std::optional<int>{}, sw);
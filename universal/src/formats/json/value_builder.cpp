@@ -1,6 +1,5 @@
 #include <userver/formats/json/value_builder.hpp>
 
-#include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -34,19 +33,29 @@ rapidjson::Type ToNativeType(Type type) {
   }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 }  // namespace
 
 ValueBuilder::ValueBuilder(Type type)
     : value_(impl::VersionedValuePtr::Create(ToNativeType(type))) {}
 
+ValueBuilder::ValueBuilder(ArenaTag, Type type)
+    : value_(impl::VersionedValuePtr::CreateWithArena()) {
+  value_->GetNative() = impl::Value{ToNativeType(type)};
+}
+
 ValueBuilder::ValueBuilder(const ValueBuilder& other) {
   Copy(value_->GetNative(), other);
 }
 
 // NOLINTNEXTLINE(performance-noexcept-move-constructor)
 ValueBuilder::ValueBuilder(ValueBuilder&& other) {
+  if (other.value_->IsRoot() && other.value_.GetAllocator().HasArena()) {
+    // the arena is taken along with the value instead of copying the nodes
+    value_ = std::exchange(other.value_, impl::MutableValueWrapper{});
+    return;
+  }
   Move(value_->GetNative(), std::move(other));
 }
 
@@ -112,6 +121,16 @@ ValueBuilder::ValueBuilder(const formats::json::Value& other) {
 }
 
 ValueBuilder::ValueBuilder(formats::json::Value&& other) {
+  if (other.root_.GetAllocator().HasArena()) {
+    // The nodes must not outlive the arena of the other's root
+    if (other.IsUniqueReference() && other.IsRoot()) {
+      value_ = impl::MutableValueWrapper{std::exchange(other.root_, {})};
+    } else {
+      value_->GetNative().CopyFrom(other.GetNative(), g_allocator);
+    }
+    return;
+  }
+
   // As we have new native object created,
   // we fill it with the other's native object.
   if (other.IsUniqueReference())
@@ -199,7 +218,7 @@ void ValueBuilder::Resize(std::size_t size) {
   const auto old_capacity = native.Capacity();
 
   if (size > old_capacity) {
-    native.Reserve(size, g_allocator);
+    native.Reserve(size, value_.GetAllocator());
     if (old_capacity) {
       value_.OnMembersChange();
     }
@@ -208,7 +227,7 @@ void ValueBuilder::Resize(std::size_t size) {
     native.PopBack();
   }
   for (size_t curr_size = native.Size(); curr_size < size; ++curr_size) {
-    native.PushBack(impl::Value{}, g_allocator);
+    native.PushBack(impl::Value{}, value_.GetAllocator());
   }
 }
 
@@ -222,13 +241,13 @@ void ValueBuilder::PushBack(ValueBuilder&& bld) {
   // notify wrapper when elements capacity (and thus location) changes
   const auto checked_push_back = [this, &native](auto&& value) {
     const auto old_capacity = native.Capacity();
-    native.PushBack(value, g_allocator);
+    native.PushBack(value, value_.GetAllocator());
     if (old_capacity && old_capacity != native.Capacity()) {
       value_.OnMembersChange();
     }
   };
 
-  if (bld.value_->IsRoot()) {
+  if (bld.value_->IsRoot() && !bld.value_.GetAllocator().HasArena()) {
     // PushBack is moving value via RawAssign
     checked_push_back(bld.value_->GetNative());
   } else {
@@ -246,17 +265,58 @@ formats::json::Value ValueBuilder::ExtractValue() {
 }
 
 void ValueBuilder::Copy(impl::Value& to, const ValueBuilder& from) {
-  to.CopyFrom(from.value_->GetNative(), g_allocator);
+  to.CopyFrom(from.value_->GetNative(), value_.GetAllocator());
 }
 
 void ValueBuilder::Move(impl::Value& to, ValueBuilder&& from) {
-  if (from.value_->IsRoot()) {
+  // The nodes allocated from an arena must not outlive the root of `from`
+  if (from.value_->IsRoot() && !from.value_.GetAllocator().HasArena()) {
     to = std::move(from.value_->GetNative());
   } else {
     Copy(to, from);
   }
 }
 
+impl::Value& ValueBuilder::PrepareAssignment() {
+  // The same as for the assignment of a ValueBuilder
+  if ((value_->IsArray() || value_->IsObject()) && value_->GetSize() != 0) {
+    value_.OnMembersChange();
+  }
+  return value_->GetNative();
+}
+
+void ValueBuilder::AssignScalar(bool t) { PrepareAssignment().SetBool(t); }
+
+void ValueBuilder::AssignScalar(int t) { PrepareAssignment().SetInt(t); }
+
+void ValueBuilder::AssignScalar(unsigned int t) {
+  PrepareAssignment().SetUint(t);
+}
+
+void ValueBuilder::AssignScalar(std::int64_t t) {
+  PrepareAssignment().SetInt64(t);
+}
+
+void ValueBuilder::AssignScalar(std::uint64_t t) {
+  PrepareAssignment().SetUint64(t);
+}
+
+void ValueBuilder::AssignScalar(float t) {
+  const auto value = formats::common::ValidateFloat<Exception>(t);
+  PrepareAssignment().SetFloat(value);
+}
+
+void ValueBuilder::AssignScalar(double t) {
+  const auto value = formats::common::ValidateFloat<Exception>(t);
+  PrepareAssignment().SetDouble(value);
+}
+
+void ValueBuilder::AssignScalar(std::string_view t) {
+  auto& native = PrepareAssignment();
+  native.SetString(rapidjson::StringRef(t.data(), t.size()),
+                   value_.GetAllocator());
+}
+
 impl::Value& ValueBuilder::AddMember(std::string_view key,
                                      CheckMemberExists check_exists) {
   value_->CheckObjectOrNull();
@@ -273,8 +333,9 @@ impl::Value& ValueBuilder::AddMember(std::string_view key,
 
   // notify wrapper when members capacity (and thus location) changes
   const auto old_capacity = native.MemberCapacity();
-  native.AddMember(impl::Value(key.data(), key.size(), g_allocator),
-                   impl::Value{}, g_allocator);
+  auto& allocator = value_.GetAllocator();
+  native.AddMember(impl::Value(key.data(), key.size(), allocator),
+                   impl::Value{}, allocator);
   if (old_capacity && old_capacity != native.MemberCapacity()) {
     value_.OnMembersChange();
   }
@@ -97,6 +97,69 @@ TEST(JsonValueBuilder, ValueNull) {
   ASSERT_EQ(json_def.As<std::optional<std::string>>(), std::nullopt);
 }
 
+namespace {
+
+const std::string kLongString(100, 'a');
+
+formats::json::Value BuildLargeValue(formats::json::ValueBuilder builder) {
+  for (int i = 0; i < 100; ++i) {
+    auto item = builder["item_with_a_long_enough_key_" + std::to_string(i)];
+    item["id"] = i;
+    item["name"] = kLongString;
+    for (int j = 0; j < 10; ++j) item["tags"].PushBack(kLongString);
+  }
+  builder.Remove("item_with_a_long_enough_key_1");
+  builder["item_with_a_long_enough_key_2"] = kLongString;
+  return builder.ExtractValue();
+}
+
+}  // namespace
+
+TEST(JsonValueBuilder, Arena) {
+  const auto json = BuildLargeValue(
+      formats::json::ValueBuilder{formats::json::kArena});
+  const auto expected = BuildLargeValue(formats::json::ValueBuilder{});
+
+  EXPECT_EQ(json, expected);
+  EXPECT_EQ(json["item_with_a_long_enough_key_0"]["tags"][9].As<std::string>(),
+            kLongString);
+}
+
+TEST(JsonValueBuilder, ArenaMoveOut) {
+  formats::json::ValueBuilder builder;
+  {
+    formats::json::ValueBuilder arena_builder{formats::json::kArena};
+    arena_builder["key"] = kLongString;
+    builder["moved"] = std::move(arena_builder);
+
+    formats::json::ValueBuilder element{formats::json::kArena,
+                                        formats::json::Type::kArray};
+    element.PushBack(kLongString);
+    builder["array"].PushBack(std::move(element));
+  }
+  const auto json = builder.ExtractValue();
+
+  EXPECT_EQ(json["moved"]["key"].As<std::string>(), kLongString);
+  EXPECT_EQ(json["array"][0][0].As<std::string>(), kLongString);
+}
+
+TEST(JsonValueBuilder, ArenaMoveRoot) {
+  formats::json::ValueBuilder arena_builder{formats::json::kArena};
+  arena_builder["key"] = kLongString;
+
+  formats::json::ValueBuilder moved{std::move(arena_builder)};
+  moved["other"] = kLongString;
+  auto json = moved.ExtractValue();
+
+  formats::json::ValueBuilder from_value{std::move(json)};
+  from_value["third"] = kLongString;
+  const auto result = from_value.ExtractValue();
+
+  EXPECT_EQ(result["key"].As<std::string>(), kLongString);
+  EXPECT_EQ(result["other"].As<std::string>(), kLongString);
+  EXPECT_EQ(result["third"].As<std::string>(), kLongString);
+}
+
 /// [Sample Customization formats::json::ValueBuilder usage]
 namespace my_namespace {
 
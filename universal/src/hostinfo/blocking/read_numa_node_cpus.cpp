@@ -0,0 +1,39 @@
+#include <userver/hostinfo/blocking/read_numa_node_cpus.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <hostinfo/cpu_list.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::blocking {
+
+std::vector<std::size_t> ReadNumaNodeCpus(std::size_t numa_node) {
+  const auto path =
+      fmt::format("/sys/devices/system/node/node{}/cpulist", numa_node);
+  std::ifstream ifs(path);
+  if (!ifs) {
+    throw std::runtime_error(fmt::format(
+        "Failed to open file '{}' for reading the CPUs of NUMA node {}", path,
+        numa_node));
+  }
+
+  std::ostringstream content;
+  content << ifs.rdbuf();
+
+  auto cpus = impl::ParseCpuList(content.str());
+  if (cpus.empty()) {
+    throw std::runtime_error(
+        fmt::format("NUMA node {} has no CPUs according to '{}'", numa_node,
+                    path));
+  }
+  return cpus;
+}
+
+}  // namespace hostinfo::blocking
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#include <hostinfo/cpu_list.hpp>
+
+#include <charconv>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::impl {
+
+namespace {
+
+std::size_t ParseCpu(std::string_view cpu_list, std::string_view cpu) {
+  std::size_t result = 0;
+  const auto* const end = cpu.data() + cpu.size();
+  const auto [ptr, ec] = std::from_chars(cpu.data(), end, result);
+  if (cpu.empty() || ec != std::errc{} || ptr != end) {
+    throw std::runtime_error(
+        fmt::format("Invalid CPU '{}' in CPU list '{}'", cpu, cpu_list));
+  }
+  return result;
+}
+
+}  // namespace
+
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+  while (!cpu_list.empty() &&
+         (cpu_list.back() == '\n' || cpu_list.back() == ' ')) {
+    cpu_list.remove_suffix(1);
+  }
+
+  std::vector<std::size_t> result;
+  std::string_view rest = cpu_list;
+  while (!rest.empty()) {
+    const auto comma_pos = rest.find(',');
+    const auto range = rest.substr(0, comma_pos);
+    rest = (comma_pos == std::string_view::npos) ? std::string_view{}
+                                                 : rest.substr(comma_pos + 1);
+
+    const auto dash_pos = range.find('-');
+    if (dash_pos == std::string_view::npos) {
+      result.push_back(ParseCpu(cpu_list, range));
+      continue;
+    }
+
+    const auto first = ParseCpu(cpu_list, range.substr(0, dash_pos));
+    const auto last = ParseCpu(cpu_list, range.substr(dash_pos + 1));
+    if (first > last) {
+      throw std::runtime_error(fmt::format(
+          "Invalid CPU range '{}' in CPU list '{}'", range, cpu_list));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+  }
+
+  return result;
+}
+
+}  // namespace hostinfo::impl
+
+USERVER_NAMESPACE_END
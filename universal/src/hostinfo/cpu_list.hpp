@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::impl {
+
+/// Parses the Linux CPU list format (for example "0-3,8,10-11").
+/// @throw `std::runtime_error` on invalid input.
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+}  // namespace hostinfo::impl
+
+USERVER_NAMESPACE_END
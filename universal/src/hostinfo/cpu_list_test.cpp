@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+
+#include <hostinfo/cpu_list.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using Cpus = std::vector<std::size_t>;
+
+TEST(ParseCpuList, Basic) {
+  EXPECT_EQ(hostinfo::impl::ParseCpuList("0"), Cpus({0}));
+  EXPECT_EQ(hostinfo::impl::ParseCpuList("0-3"), Cpus({0, 1, 2, 3}));
+  EXPECT_EQ(hostinfo::impl::ParseCpuList("0-1,4,6-7\n"), Cpus({0, 1, 4, 6, 7}));
+  EXPECT_TRUE(hostinfo::impl::ParseCpuList("\n").empty());
+}
+
+TEST(ParseCpuList, Invalid) {
+  EXPECT_THROW(hostinfo::impl::ParseCpuList("a"), std::runtime_error);
+  EXPECT_THROW(hostinfo::impl::ParseCpuList("3-1"), std::runtime_error);
+  EXPECT_THROW(hostinfo::impl::ParseCpuList("1,,2"), std::runtime_error);
+  EXPECT_THROW(hostinfo::impl::ParseCpuList("1-"), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -187,9 +187,17 @@ MaybeOwnedKey::MaybeOwnedKey(const PredefinedHeader& key)
     : MaybeOwnedKey{std::string_view{key}} {}
 MaybeOwnedKey::MaybeOwnedKey(std::string_view key)
     : key_{key}, key_str_if_exists_{nullptr} {}
+MaybeOwnedKey::MaybeOwnedKey(std::string_view key,
+                             Traits::HeaderIndex header_index)
+    : key_{key}, key_str_if_exists_{nullptr}, header_index_{header_index} {}
 
 std::string_view MaybeOwnedKey::GetValue() const { return key_; }
 
+Traits::HeaderIndex MaybeOwnedKey::GetHeaderIndex() const {
+  return header_index_ ? *header_index_
+                       : impl::GetHeaderIndexForInsertion(key_);
+}
+
 std::string MaybeOwnedKey::ExtractValue() && {
   if (key_str_if_exists_) {
     UASSERT(key_ == *key_str_if_exists_);
@@ -362,18 +370,17 @@ Traits::HashValue Map::HashKey(const PredefinedHeader& header) const noexcept {
   return MaskHash(danger_.HashKey(header));
 }
 
-Traits::HeaderIndex Map::InsertEntry(std::string&& key, std::string&& value) {
-  // we could potentially restructure the code a bit, so instead of hashing
-  // and then at some point looking for index here,
-  // we look for index first, and if it's found - that means we already know the
-  // hash (the header name is known upfront, thus the hash is known as well).
-  // Clobbers interface/implementation a bit, and
-  // we're not sure if its worth it, since default hash is decently fast anyway.
-  const auto header_index = impl::GetHeaderIndexForInsertion(key);
+Traits::HeaderIndex Map::GetHeaderIndexForInsertion(
+    const PredefinedHeader& header) noexcept {
+  // unknown headers have different indexes for lookup and insertion, see
+  // impl::GetHeaderIndexForInsertion
+  return header.header_index == impl::kNoHeaderIndexLookup
+             ? impl::kNoHeaderIndexInsertion
+             : header.header_index;
+}
 
+void Map::InsertEntry(std::string&& key, std::string&& value) {
   entries_.emplace_back(std::move(key), std::move(value));
-
-  return header_index;
 }
 
 Map::ConstIterator Map::Find(std::string_view key) const noexcept {
@@ -454,7 +461,9 @@ Map::Iterator Map::InsertOrModify(
 Map::Iterator Map::InsertOrModify(
     const PredefinedHeader& header, std::string&& value,
     InsertOrModifyOccupiedAction occupied_action) {
-  return DoInsertOrModify(MaybeOwnedKey{header}, HashKey(header),
+  return DoInsertOrModify(
+      MaybeOwnedKey{header.name, GetHeaderIndexForInsertion(header)},
+      HashKey(header),
                           std::move(value), occupied_action);
 }
 
@@ -494,9 +503,10 @@ Map::Iterator Map::DoInsertOrModify(
 
   const auto perform_robinhood =
       [this, hash](std::size_t dist, std::size_t positions_idx,
-                   std::string&& key, std::string&& value) {
+                   Traits::HeaderIndex header_index, std::string&& key,
+                   std::string&& value) {
         const auto entries_index = entries_.size();
-        const auto header_index = InsertEntry(std::move(key), std::move(value));
+        InsertEntry(std::move(key), std::move(value));
 
         const auto num_displaced = DoRobinhoodAtPosition(
             positions_idx, Pos{entries_index, hash, header_index});
@@ -509,9 +519,10 @@ Map::Iterator Map::DoInsertOrModify(
 
   const auto perform_vacant = [this, hash](
                                   std::size_t dist, std::size_t positions_idx,
+                                  Traits::HeaderIndex header_index,
                                   std::string&& key, std::string&& value) {
     const auto index = entries_.size();
-    const auto header_index = InsertEntry(std::move(key), std::move(value));
+    InsertEntry(std::move(key), std::move(value));
     positions_[positions_idx] = Pos{index, hash, header_index};
 
     if (dist >= kForwardShiftThreshold) {
@@ -528,8 +539,9 @@ Map::Iterator Map::DoInsertOrModify(
           mask_, positions_[positions_idx].GetHash(), positions_idx);
 
       if (dist > their_dist) {
-        perform_robinhood(dist, positions_idx, std::move(key).ExtractValue(),
-                          std::move(value));
+        const auto header_index = key.GetHeaderIndex();
+        perform_robinhood(dist, positions_idx, header_index,
+                          std::move(key).ExtractValue(), std::move(value));
 
         return ProbingAction::kStop;
       } else if (positions_[positions_idx].GetHash() == hash &&
@@ -544,8 +556,9 @@ Map::Iterator Map::DoInsertOrModify(
         return ProbingAction::kStop;
       }
     } else {
-      perform_vacant(dist, positions_idx, std::move(key).ExtractValue(),
-                     std::move(value));
+      const auto header_index = key.GetHeaderIndex();
+      perform_vacant(dist, positions_idx, header_index,
+                     std::move(key).ExtractValue(), std::move(value));
 
       return ProbingAction::kStop;
     }
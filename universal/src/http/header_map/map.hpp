@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
@@ -46,14 +47,20 @@ class MaybeOwnedKey final {
   explicit MaybeOwnedKey(std::string& key);
   explicit MaybeOwnedKey(const PredefinedHeader& key);
   explicit MaybeOwnedKey(std::string_view key);
+  MaybeOwnedKey(std::string_view key, Traits::HeaderIndex header_index);
 
   std::string_view GetValue() const;
 
+  // The index to store for the key on insertion
+  Traits::HeaderIndex GetHeaderIndex() const;
+
   std::string ExtractValue() &&;
 
  private:
   std::string_view key_;
   std::string* key_str_if_exists_;
+  // Set for the PredefinedHeader keys, which know their index upfront
+  std::optional<Traits::HeaderIndex> header_index_;
 };
 
 class Map final {
@@ -116,7 +123,9 @@ class Map final {
   Traits::HashValue HashKey(std::string_view key) const noexcept;
   Traits::HashValue HashKey(const PredefinedHeader& header) const noexcept;
 
-  Traits::HeaderIndex InsertEntry(std::string&& key, std::string&& value);
+  static Traits::HeaderIndex GetHeaderIndexForInsertion(
+      const PredefinedHeader& header) noexcept;
+  void InsertEntry(std::string&& key, std::string&& value);
   std::size_t DoRobinhoodAtPosition(std::size_t idx, Pos old_pos);
 
   struct FindResult final {
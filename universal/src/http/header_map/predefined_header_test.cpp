@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <string>
+#include <string_view>
+
 #include <fmt/format.h>
 
 #include <userver/http/common_headers.hpp>
@@ -29,6 +32,19 @@ TEST(HeaderMapHasher, SameAtCompileTimeAndRuntime) {
   EXPECT_EQ(compile_time_hash, runtime_hash);
 }
 
+TEST(HeaderMapHasher, RuntimeHashMatchesConstexprHash) {
+  const impl::UnsafeConstexprHasher hasher{};
+  const std::string alphabet = "Content-Type_X-YaTaxi-Client-TimeoutMs{}[]";
+  for (std::size_t length = 0; length <= alphabet.size(); ++length) {
+    const std::string_view key{alphabet.data(), length};
+    EXPECT_EQ(hasher.HashAtRuntime(key), hasher(key)) << key;
+  }
+
+  constexpr auto kConstexprHash = impl::UnsafeConstexprHasher{}(
+      std::string_view{kXYaTaxiClientTimeoutMs});
+  EXPECT_EQ(hasher.HashAtRuntime("x-yataxi-client-timeoutms"), kConstexprHash);
+}
+
 TEST(PredefinedHeader, IsFormattable) {
   constexpr auto header = kXRequestApplication;
 
@@ -1,8 +1,11 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
+#include <cctype>
 #include <string>
 #include <vector>
 
+#include <userver/http/common_headers.hpp>
 #include <userver/http/header_map.hpp>
 
 #include <userver/internal/http/header_map_tests_helper.hpp>
@@ -159,4 +162,82 @@ void HeaderMapEraseBenchmark(benchmark::State& state) {
 }
 BENCHMARK(HeaderMapEraseBenchmark);
 
+namespace {
+
+// Header names of a typical request as they come from the parser
+const std::vector<std::string> kTypicalRequestHeaders{
+    "Host",
+    "User-Agent",
+    "Accept",
+    "Accept-Encoding",
+    "Content-Type",
+    "Content-Length",
+    "X-YaRequestId",
+    "X-YaTraceId",
+    "X-YaSpanId",
+    "Cookie",
+    "X-Forwarded-For",
+    "X-YaTaxi-Client-TimeoutMs",
+};
+
+http::headers::HeaderMap MakeTypicalRequestHeaders() {
+  http::headers::HeaderMap map{};
+  for (const auto& header : kTypicalRequestHeaders) {
+    map.emplace(header, "1");
+  }
+  return map;
+}
+
+}  // namespace
+
+void HeaderMapInsertBenchmark(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(MakeTypicalRequestHeaders());
+  }
+}
+BENCHMARK(HeaderMapInsertBenchmark);
+
+void HeaderMapFindBenchmark(benchmark::State& state) {
+  const auto map = MakeTypicalRequestHeaders();
+  // Handlers usually look the headers up in a different case
+  std::vector<std::string> keys;
+  for (const auto& header : kTypicalRequestHeaders) {
+    std::string key = header;
+    for (auto& c : key) c = std::tolower(static_cast<unsigned char>(c));
+    keys.push_back(std::move(key));
+  }
+
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(map.find(key));
+    }
+  }
+}
+BENCHMARK(HeaderMapFindBenchmark);
+
+void HeaderMapFindPredefinedBenchmark(benchmark::State& state) {
+  const auto map = MakeTypicalRequestHeaders();
+  constexpr std::array kKeys{
+      http::headers::kHost,
+      http::headers::kUserAgent,
+      http::headers::kAccept,
+      http::headers::kAcceptEncoding,
+      http::headers::kContentType,
+      http::headers::kContentLength,
+      http::headers::kXYaRequestId,
+      http::headers::kXYaTraceId,
+      http::headers::kXYaSpanId,
+      http::headers::kCookie,
+      http::headers::kXBackendServer,
+      http::headers::kXYaTaxiClientTimeoutMs,
+  };
+
+  for (auto _ : state) {
+    for (const auto& key : kKeys) {
+      benchmark::DoNotOptimize(map.find(key));
+    }
+  }
+}
+BENCHMARK(HeaderMapFindPredefinedBenchmark);
+
 USERVER_NAMESPACE_END
@@ -27,6 +27,8 @@ std::string UrlDecode(std::string_view url) {
   }
 
   std::string res;
+  // The decoded string is never longer than the encoded one
+  res.reserve(url.size());
   for (const char* ptr = data; ptr < data_end; ++ptr) {
     if (*ptr == '%') {
       if (ptr + 2 < data_end &&
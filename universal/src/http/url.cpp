@@ -1,6 +1,7 @@
 #include <userver/http/url.hpp>
 
 #include <array>
+#include <string_view>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -10,38 +11,43 @@ namespace {
 
 const std::string_view kSchemaSeparator = "://";
 
+constexpr std::array<bool, 256> MakeUnreservedChars() noexcept {
+  std::array<bool, 256> unreserved{};
+  for (unsigned char c = '0'; c <= '9'; ++c) unreserved[c] = true;
+  for (unsigned char c = 'a'; c <= 'z'; ++c) unreserved[c] = true;
+  for (unsigned char c = 'A'; c <= 'Z'; ++c) unreserved[c] = true;
+  for (unsigned char c : std::string_view{"-_.!~*()'"}) unreserved[c] = true;
+  return unreserved;
+}
+
+// Chars that are not percent-encoded
+constexpr auto kUnreservedChars = MakeUnreservedChars();
+
+constexpr std::string_view kUpperXDigits = "0123456789ABCDEF";
+
+}  // namespace
+
 void UrlEncodeTo(std::string_view input_string, std::string& result) {
-  for (char symbol : input_string) {
-    if (isalnum(symbol)) {
-      result.append(1, symbol);
-      continue;
-    }
-    switch (symbol) {
-      case '-':
-      case '_':
-      case '.':
-      case '!':
-      case '~':
-      case '*':
-      case '(':
-      case ')':
-      case '\'':
-        result.append(1, symbol);
-        break;
-      default:
-        std::array<char, 3> bytes = {'%', 0, 0};
-        bytes[1] = (symbol & 0xF0) / 16;
-        bytes[1] += (bytes[1] > 9) ? 'A' - 10 : '0';
-        bytes[2] = symbol & 0x0F;
-        bytes[2] += (bytes[2] > 9) ? 'A' - 10 : '0';
-        result.append(bytes.data(), bytes.size());
-        break;
+  const auto* first = input_string.data();
+  const auto* const last = first + input_string.size();
+  while (first != last) {
+    // unreserved chars are copied by runs
+    const auto* run_end = first;
+    while (run_end != last &&
+           kUnreservedChars[static_cast<unsigned char>(*run_end)]) {
+      ++run_end;
     }
+    result.append(first, run_end);
+    if (run_end == last) break;
+
+    const auto symbol = static_cast<unsigned char>(*run_end);
+    const std::array<char, 3> bytes = {'%', kUpperXDigits[symbol >> 4],
+                                       kUpperXDigits[symbol & 0x0F]};
+    result.append(bytes.data(), bytes.size());
+    first = run_end + 1;
   }
 }
 
-}  // namespace
-
 std::string UrlEncode(std::string_view input_string) {
   std::string result;
   result.reserve(3 * input_string.size());
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+
 #include <userver/http/url.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -40,4 +42,35 @@ void make_query(benchmark::State& state) {
 }
 BENCHMARK(make_query)->RangeMultiplier(2)->Range(1, 256);
 
+std::string GenerateQueryValue(std::size_t size) {
+  std::string value;
+  value.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    // mostly unreserved chars with some that need escaping
+    value.push_back(i % 7 == 0 ? ' ' : static_cast<char>('a' + i % 26));
+  }
+  return value;
+}
+
+void url_encode(benchmark::State& state) {
+  const auto value = GenerateQueryValue(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(http::UrlEncode(value));
+  }
+  state.SetBytesProcessed(state.iterations() * value.size());
+}
+BENCHMARK(url_encode)->RangeMultiplier(8)->Range(8, 32 << 10);
+
+void url_encode_to(benchmark::State& state) {
+  const auto value = GenerateQueryValue(state.range(0));
+  std::string result;
+  for (auto _ : state) {
+    result.clear();
+    http::UrlEncodeTo(value, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * value.size());
+}
+BENCHMARK(url_encode_to)->RangeMultiplier(8)->Range(8, 32 << 10);
+
 USERVER_NAMESPACE_END
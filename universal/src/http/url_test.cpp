@@ -21,6 +21,21 @@ TEST(UrlEncode, Special) {
   EXPECT_EQ("Text%20with%20spaces%2C%3F%26%3D", UrlEncode(str));
 }
 
+TEST(UrlEncode, Unreserved) {
+  constexpr std::string_view str = "-_.!~*()'";
+  EXPECT_EQ(str, UrlEncode(str));
+  constexpr std::string_view binary{"\xD0\xAF\0\x7F\xFF", 5};
+  EXPECT_EQ("%D0%AF%00%7F%FF", UrlEncode(binary));
+}
+
+TEST(UrlEncode, To) {
+  std::string result = "prefix=";
+  http::UrlEncodeTo("a b", result);
+  http::UrlEncodeTo("", result);
+  http::UrlEncodeTo("/c", result);
+  EXPECT_EQ("prefix=a%20b%2Fc", result);
+}
+
 TEST(UrlDecode, Empty) { EXPECT_EQ("", UrlDecode("")); }
 
 TEST(UrlDecode, Latin) {
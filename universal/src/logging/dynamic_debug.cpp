@@ -1,5 +1,6 @@
 #include "dynamic_debug.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 #include <fmt/format.h>
@@ -29,19 +30,9 @@ LogEntryContentSet& GetAllLocations() noexcept {
       fmt::format("dynamic-debug-log: no logging in '{}'", location));
 }
 
-}  // namespace
-
-bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-  const auto cmp = std::strcmp(x.path, y.path);
-  return cmp < 0 || (cmp == 0 && x.line < y.line);
-}
-
-bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-  return x.line == y.line && std::strcmp(x.path, y.path) == 0;
-}
-
-void AddDynamicDebugLog(const std::string& location_relative, int line,
-                        EntryState state) {
+template <typename Func>
+void ForEachLocation(const std::string& location_relative, int line,
+                     Func func) {
   utils::impl::AssertStaticRegistrationFinished();
 
   auto& all_locations = GetAllLocations();
@@ -58,18 +49,55 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
       ThrowUnknownDynamicLogLocation(location_relative, line);
     }
 
-    it_lower->state = state;
+    func(*it_lower);
     return;
   } else {
     for (; it_lower != all_locations.end(); ++it_lower) {
       if (std::strncmp(it_lower->path, location_relative.c_str(),
                        location_relative.size()) != 0)
         break;
-      it_lower->state = state;
+      func(*it_lower);
     }
   }
 }
 
+}  // namespace
+
+bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+  const auto cmp = std::strcmp(x.path, y.path);
+  return cmp < 0 || (cmp == 0 && x.line < y.line);
+}
+
+bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+  return x.line == y.line && std::strcmp(x.path, y.path) == 0;
+}
+
+void AddDynamicDebugLog(const std::string& location_relative, int line,
+                        EntryState state) {
+  ForEachLocation(location_relative, line,
+                  [state](LogEntryContent& location) {
+                    location.state = state;
+                  });
+}
+
+void SetDynamicDebugSampling(const std::string& location_relative, int line,
+                             double rate) {
+  if (!(rate >= 0 && rate <= 1)) {
+    throw std::runtime_error(fmt::format(
+        "dynamic-debug-log: sampling rate {} for '{}' is not in [0, 1]", rate,
+        location_relative));
+  }
+
+  // The messages are logged if utils::Rand() < 2^32 * rate
+  constexpr auto kMaxThreshold = static_cast<double>(kNoSampling);
+  const auto threshold = static_cast<std::uint32_t>(
+      std::min(rate * (kMaxThreshold + 1), kMaxThreshold));
+  ForEachLocation(location_relative, line,
+                  [threshold](LogEntryContent& location) {
+                    location.sampling_threshold = threshold;
+                  });
+}
+
 void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
   utils::impl::AssertStaticRegistrationFinished();
   auto& all_locations = GetAllLocations();
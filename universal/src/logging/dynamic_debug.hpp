@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <limits>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
@@ -22,6 +24,10 @@ enum class EntryState {
   kForceEnabled,
 };
 
+// The messages are logged if utils::Rand() is less than the threshold
+inline constexpr std::uint32_t kNoSampling =
+    std::numeric_limits<std::uint32_t>::max();
+
 using LogEntryContentHook =
     bi::set_base_hook<bi::optimize_size<true>, bi::link_mode<bi::normal_link>>;
 
@@ -33,6 +39,9 @@ struct LogEntryContent {
   const int line;
   const char* const path;
   LogEntryContentHook hook;
+  std::atomic<std::uint32_t> sampling_threshold{kNoSampling};
+  // The count of the messages dropped by sampling
+  mutable std::atomic<std::uint64_t> suppressed{0};
 };
 
 bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept;
@@ -53,6 +62,11 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
 
 void RemoveDynamicDebugLog(const std::string& location_relative, int line);
 
+/// Makes the logs below the warning level at the location to be written with
+/// the `rate` probability in [0, 1], 1 disables the sampling
+void SetDynamicDebugSampling(const std::string& location_relative, int line,
+                             double rate);
+
 const LogEntryContentSet& GetDynamicDebugLocations();
 
 void RegisterLogLocation(LogEntryContent& location);
@@ -0,0 +1,166 @@
+#include <userver/logging/impl/binary_format.hpp>
+
+#include <ctime>
+#include <stdexcept>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+namespace {
+
+// Never change the ids, they are stored in the logs. New keys may be appended.
+constexpr utils::TrivialBiMap kWellKnownKeys = [](auto selector) {
+  return selector()
+      .Case("text", std::uint64_t{1})
+      .Case("module", std::uint64_t{2})
+      .Case("task_id", std::uint64_t{3})
+      .Case("thread_id", std::uint64_t{4})
+      .Case("trace_id", std::uint64_t{5})
+      .Case("span_id", std::uint64_t{6})
+      .Case("parent_id", std::uint64_t{7})
+      .Case("link", std::uint64_t{8})
+      .Case("parent_link", std::uint64_t{9})
+      .Case("stopwatch_name", std::uint64_t{10})
+      .Case("total_time", std::uint64_t{11})
+      .Case("stopwatch_units", std::uint64_t{12})
+      .Case("start_timestamp", std::uint64_t{13})
+      .Case("span_ref_type", std::uint64_t{14})
+      .Case("meta_type", std::uint64_t{15})
+      .Case("_type", std::uint64_t{16});
+};
+
+// Same as in SPDLOG_LEVEL_NAMES
+constexpr std::string_view kLevelNames[] = {
+    "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "CRITICAL", "OFF",
+};
+static_assert(std::size(kLevelNames) == kLevelMax + 1);
+
+std::string_view GetLevelName(Level level) noexcept {
+  return kLevelNames[static_cast<std::size_t>(level)];
+}
+
+[[noreturn]] void ThrowMalformed(std::string_view reason) {
+  throw std::runtime_error(
+      fmt::format("Malformed binary log record: {}", reason));
+}
+
+std::uint64_t ReadVarint(std::string_view& input) {
+  std::uint64_t result = 0;
+  for (std::size_t i = 0; i < kMaxVarintSize; ++i) {
+    if (input.empty()) ThrowMalformed("truncated varint");
+    const auto byte = static_cast<unsigned char>(input.front());
+    input.remove_prefix(1);
+
+    result |= std::uint64_t{byte & 0x7Fu} << (7 * i);
+    if ((byte & 0x80) == 0) return result;
+  }
+  ThrowMalformed("too long varint");
+}
+
+std::string_view ReadString(std::string_view& input) {
+  const auto size = ReadVarint(input);
+  if (size > input.size()) ThrowMalformed("truncated string");
+  const auto result = input.substr(0, size);
+  input.remove_prefix(size);
+  return result;
+}
+
+std::string FormatTimestamp(std::chrono::system_clock::time_point timestamp) {
+  const auto time = std::chrono::system_clock::to_time_t(timestamp);
+  const auto microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          timestamp - std::chrono::system_clock::from_time_t(time))
+          .count();
+  return fmt::format("{:%Y-%m-%dT%H:%M:%S}.{:06}", fmt::localtime(time),
+                     microseconds);
+}
+
+}  // namespace
+
+std::uint64_t FindWellKnownKey(std::string_view key) noexcept {
+  return kWellKnownKeys.TryFindByFirst(key).value_or(0);
+}
+
+std::optional<std::string_view> FindWellKnownKey(std::uint64_t id) noexcept {
+  return kWellKnownKeys.TryFindBySecond(id);
+}
+
+std::optional<Record> ParseRecord(std::string_view& input) {
+  if (input.empty()) return std::nullopt;
+  if (input.front() != kRecordMagic) ThrowMalformed("no record magic");
+  input.remove_prefix(1);
+
+  auto body = ReadString(input);
+  if (!input.empty() && input.front() == '\n') input.remove_prefix(1);
+
+  Record record;
+  record.timestamp += std::chrono::duration_cast<
+      std::chrono::system_clock::duration>(
+      std::chrono::microseconds{ReadVarint(body)});
+
+  if (body.empty()) ThrowMalformed("no level");
+  const auto level = static_cast<unsigned char>(body.front());
+  if (level > kLevelMax) ThrowMalformed("invalid level");
+  record.level = static_cast<Level>(level);
+  body.remove_prefix(1);
+
+  while (!body.empty()) {
+    const auto key_id = ReadVarint(body);
+    std::string_view key;
+    if (key_id == 0) {
+      key = ReadString(body);
+    } else {
+      const auto well_known_key = FindWellKnownKey(key_id);
+      if (!well_known_key) ThrowMalformed("unknown key id");
+      key = *well_known_key;
+    }
+    record.fields.push_back({key, ReadString(body)});
+  }
+
+  return record;
+}
+
+std::string ToTskv(const Record& record) {
+  auto result = fmt::format("tskv\ttimestamp={}\tlevel={}",
+                            FormatTimestamp(record.timestamp),
+                            GetLevelName(record.level));
+
+  for (const auto& field : record.fields) {
+    result += utils::encoding::kTskvPairsSeparator;
+    utils::encoding::EncodeTskv(
+        result, field.key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+    result += utils::encoding::kTskvKeyValueSeparator;
+    utils::encoding::EncodeTskv(result, field.value,
+                                utils::encoding::EncodeTskvMode::kValue);
+  }
+  return result;
+}
+
+std::string ToJson(const Record& record) {
+  formats::json::StringBuilder builder;
+  {
+    const formats::json::StringBuilder::ObjectGuard guard{builder};
+    builder.Key("timestamp");
+    builder.WriteString(FormatTimestamp(record.timestamp));
+    builder.Key("level");
+    builder.WriteString(GetLevelName(record.level));
+
+    for (const auto& field : record.fields) {
+      builder.Key(field.key);
+      builder.WriteString(field.value);
+    }
+  }
+  return builder.GetString();
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
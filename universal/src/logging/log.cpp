@@ -7,6 +7,7 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/null_logger.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -156,8 +157,18 @@ bool StaticLogEntry::ShouldLog() const noexcept {
 bool StaticLogEntry::ShouldNotLog(Level level) const noexcept {
   if (level >= Level::kWarning) return false;
 
-  return reinterpret_cast<const LogEntryContent&>(content).state.load() ==
-         EntryState::kForceDisabled;
+  const auto& entry = reinterpret_cast<const LogEntryContent&>(content);
+  const auto state = entry.state.load();
+  if (state != EntryState::kDefault) {
+    return state == EntryState::kForceDisabled;
+  }
+
+  const auto threshold =
+      entry.sampling_threshold.load(std::memory_order_relaxed);
+  if (threshold == kNoSampling || utils::Rand() < threshold) return false;
+
+  entry.suppressed.fetch_add(1, std::memory_order_relaxed);
+  return true;
 }
 
 }  // namespace impl
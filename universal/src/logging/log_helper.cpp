@@ -169,13 +169,15 @@ void LogHelper::InternalLoggingError(std::string_view message) noexcept {
   UASSERT_MSG(false, message);
 }
 
-void LogHelper::OpenTextTag() {
-  Put(utils::encoding::kTskvPairsSeparator);
-  Put("text");
-  pimpl_->PutKeyValueSeparator();
+void LogHelper::OpenTextTag() { pimpl_->PutTagKey("text"); }
+
+void LogHelper::PutTagKey(std::string_view escaped_key) {
+  pimpl_->PutTagKey(escaped_key);
 }
 
-void LogHelper::PutKeyValueSeparator() { pimpl_->PutKeyValueSeparator(); }
+void LogHelper::PutRuntimeTagKey(std::string_view unescaped_key) {
+  pimpl_->PutRuntimeTagKey(unescaped_key);
+}
 
 impl::TagWriter LogHelper::GetTagWriter() { return impl::TagWriter{*this}; }
 
@@ -183,6 +185,32 @@ impl::TagWriter LogHelper::GetTagWriterAfterText(InternalTag) {
   return GetTagWriter();
 }
 
+void LogHelper::PutFormatted(FormatFunction format,
+                             const void* context) noexcept {
+  const EncodingGuard guard{*this, Encode::kValue};
+  try {
+    auto& message = pimpl_->Message();
+    const auto text_begin = message.size();
+    fmt::appender appender{message};
+    format(context, &appender);
+
+    if (pimpl_->GetEncoding() == Encode::kNone) return;
+
+    // The text is formatted right into the message, so escape it afterwards.
+    // Most of the texts have nothing to escape.
+    constexpr std::string_view kEscapedChars{"\t\r\n\0\\", 5};
+    const std::string_view text{message.data() + text_begin,
+                                message.size() - text_begin};
+    if (text.find_first_of(kEscapedChars) == std::string_view::npos) return;
+
+    const std::string unescaped{text};
+    message.resize(text_begin);
+    Put(unescaped);
+  } catch (...) {
+    InternalLoggingError("Failed to log a formatted text");
+  }
+}
+
 LogHelper& LogHelper::operator<<(char value) noexcept {
   const EncodingGuard guard{*this, Encode::kValue};
   try {
@@ -1,5 +1,9 @@
 #include "log_helper_impl.hpp"
 
+#include <chrono>
+#include <cstring>
+
+#include <userver/logging/impl/binary_format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
@@ -14,6 +18,8 @@ char GetSeparatorFromLogger(LoggerRef logger) {
   switch (logger.GetFormat()) {
     case Format::kTskv:
     case Format::kRaw:
+    // Not used, the binary tags have no separators
+    case Format::kBinary:
       return '=';
     case Format::kLtsv:
       return ':';
@@ -36,10 +42,14 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(level),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(*logger_)),
+      is_binary_(logger_->GetFormat() == Format::kBinary) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
                 "8KB memory in allocator.");
+
+  // Fits into the inline storage of msg_, so does not throw
+  if (is_binary_) BeginBinaryRecord();
 }
 
 std::streamsize LogHelper::Impl::xsputn(const char_type* s, std::streamsize n) {
@@ -90,6 +100,90 @@ void LogHelper::Impl::Put(char_type c) {
   }
 }
 
+void LogHelper::Impl::PutTagKey(std::string_view escaped_key) {
+  UASSERT(encode_mode_ == Encode::kNone);
+  if (is_binary_) {
+    PutBinaryKey(escaped_key);
+    return;
+  }
+
+  msg_.push_back(utils::encoding::kTskvPairsSeparator);
+  msg_.append(escaped_key.data(), escaped_key.data() + escaped_key.size());
+  msg_.push_back(key_value_separator_);
+}
+
+void LogHelper::Impl::PutRuntimeTagKey(std::string_view unescaped_key) {
+  UASSERT(encode_mode_ == Encode::kNone);
+  if (is_binary_) {
+    PutBinaryKey(unescaped_key);
+    return;
+  }
+
+  msg_.push_back(utils::encoding::kTskvPairsSeparator);
+  if (!utils::encoding::ShouldKeyBeEscaped(unescaped_key)) {
+    msg_.append(unescaped_key.data(),
+                unescaped_key.data() + unescaped_key.size());
+  } else {
+    utils::encoding::EncodeTskv(
+        msg_, unescaped_key,
+        utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+  }
+  msg_.push_back(key_value_separator_);
+}
+
+void LogHelper::Impl::AppendVarint(std::uint64_t value) {
+  char buffer[impl::binary::kMaxVarintSize];
+  const auto size = impl::binary::WriteVarint(buffer, value);
+  msg_.append(buffer, buffer + size);
+}
+
+void LogHelper::Impl::BeginBinaryRecord() {
+  msg_.push_back(impl::binary::kRecordMagic);
+  // The body size is written in LogTheMessage
+  msg_.resize(msg_.size() + impl::binary::kPaddedVarintSize);
+
+  const auto now = std::chrono::system_clock::now().time_since_epoch();
+  AppendVarint(
+      std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+  msg_.push_back(static_cast<char>(level_));
+}
+
+void LogHelper::Impl::PutBinaryKey(std::string_view key) {
+  FinishBinaryValue();
+
+  const auto key_id = impl::binary::FindWellKnownKey(key);
+  AppendVarint(key_id);
+  if (key_id == 0) {
+    AppendVarint(key.size());
+    msg_.append(key.data(), key.data() + key.size());
+  }
+
+  // The value size is unknown yet, reserve the room for it
+  binary_value_begin_ = msg_.size() + impl::binary::kPaddedVarintSize;
+  msg_.resize(binary_value_begin_);
+}
+
+void LogHelper::Impl::FinishBinaryValue() noexcept {
+  if (binary_value_begin_ == 0) return;
+
+  auto size = msg_.size() - binary_value_begin_;
+  if (size > impl::binary::kMaxPaddedValue) {
+    size = impl::binary::kMaxPaddedValue;
+  }
+
+  // Use the shortest varint and move the value closer to it, that's cheaper
+  // than escaping and keeps the short values compact
+  const auto size_begin = binary_value_begin_ - impl::binary::kPaddedVarintSize;
+  const auto varint_size =
+      impl::binary::WriteVarint(msg_.data() + size_begin, size);
+  if (varint_size != impl::binary::kPaddedVarintSize) {
+    std::memmove(msg_.data() + size_begin + varint_size,
+                 msg_.data() + binary_value_begin_, size);
+  }
+  msg_.resize(size_begin + varint_size + size);
+  binary_value_begin_ = 0;
+}
+
 LogHelper::Impl::LazyInitedStream& LogHelper::Impl::GetLazyInitedStream() {
   if (!IsStreamInitialized()) {
     lazy_stream_.emplace(*this);
@@ -98,11 +192,23 @@ LogHelper::Impl::LazyInitedStream& LogHelper::Impl::GetLazyInitedStream() {
   return *lazy_stream_;
 }
 
-void LogHelper::Impl::LogTheMessage() const {
+void LogHelper::Impl::LogTheMessage() {
   if (IsBroken()) {
     return;
   }
 
+  if (is_binary_) {
+    FinishBinaryValue();
+    const auto body_size =
+        msg_.size() - sizeof(impl::binary::kRecordMagic) -
+        impl::binary::kPaddedVarintSize;
+    // Values are truncated to the same limit, that's only possible with a
+    // lot of them
+    if (body_size > impl::binary::kMaxPaddedValue) return;
+    impl::binary::WritePaddedVarint(
+        msg_.data() + sizeof(impl::binary::kRecordMagic), body_size);
+  }
+
   UASSERT(logger_);
   const std::string_view message(msg_.data(), msg_.size());
   logger_->Log(level_, message);
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <ostream>
+#include <string_view>
 
 #include <fmt/format.h>
 
@@ -26,7 +28,10 @@ class LogHelper::Impl final {
 
   explicit Impl(LoggerRef logger, Level level) noexcept;
 
-  void SetEncoding(Encode encode_mode) noexcept { encode_mode_ = encode_mode; }
+  void SetEncoding(Encode encode_mode) noexcept {
+    // Binary values are length-prefixed, there is nothing to escape
+    if (!is_binary_) encode_mode_ = encode_mode;
+  }
   Encode GetEncoding() const noexcept { return encode_mode_; }
 
   auto& Message() noexcept { return msg_; }
@@ -42,9 +47,12 @@ class LogHelper::Impl final {
   int_type overflow(int_type c);
 
   void Put(char_type c);
-  void PutKeyValueSeparator() { Put(key_value_separator_); }
 
-  void LogTheMessage() const;
+  // Start a new tag, the value is written right after the call
+  void PutTagKey(std::string_view escaped_key);
+  void PutRuntimeTagKey(std::string_view unescaped_key);
+
+  void LogTheMessage();
 
   void MarkTextBegin();
   size_t TextSize() const { return msg_.size() - initial_length_; }
@@ -74,15 +82,23 @@ class LogHelper::Impl final {
 
   LazyInitedStream& GetLazyInitedStream();
 
+  void AppendVarint(std::uint64_t value);
+  void BeginBinaryRecord();
+  void PutBinaryKey(std::string_view key);
+  void FinishBinaryValue() noexcept;
+
   impl::LoggerBase* logger_;
   const Level level_;
   const char key_value_separator_;
+  const bool is_binary_;
   Encode encode_mode_{Encode::kNone};
   fmt::basic_memory_buffer<char, kInitialLogBufferSize> msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
   std::size_t initial_length_{0};
   bool is_text_finished_{false};
+  // The beginning of the last binary value, which size is not written yet
+  std::size_t binary_value_begin_{0};
 };
 
 }  // namespace logging
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/utils/blocked_bloom_filter.hpp>
+#include <userver/utils/filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Half of the probes are the inserted items
+std::vector<std::uint64_t> MakeProbes(std::size_t items) {
+  std::vector<std::uint64_t> probes;
+  probes.reserve(items * 2);
+  for (std::uint64_t i = 0; i < items * 2; ++i) {
+    probes.push_back(i * 0x9e3779b97f4a7c15ULL);
+  }
+  return probes;
+}
+
+}  // namespace
+
+void blocked_bloom_filter_has(benchmark::State& state) {
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto probes = MakeProbes(items);
+  utils::BlockedBloomFilter<std::uint64_t> filter(items);
+  for (std::size_t i = 0; i < probes.size(); i += 2) {
+    filter.Insert(probes[i]);
+  }
+
+  std::size_t probe_index = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(filter.Has(probes[probe_index]));
+    if (++probe_index == probes.size()) probe_index = 0;
+  }
+}
+BENCHMARK(blocked_bloom_filter_has)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20);
+
+void filter_bloom_has(benchmark::State& state) {
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto probes = MakeProbes(items);
+  utils::FilterBloom<std::uint64_t> filter(items * 16);
+  for (std::size_t i = 0; i < probes.size(); i += 2) {
+    filter.Increment(probes[i]);
+  }
+
+  std::size_t probe_index = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(filter.Has(probes[probe_index]));
+    if (++probe_index == probes.size()) probe_index = 0;
+  }
+}
+BENCHMARK(filter_bloom_has)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20);
+
+USERVER_NAMESPACE_END
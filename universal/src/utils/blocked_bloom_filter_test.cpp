@@ -0,0 +1,84 @@
+#include <userver/utils/blocked_bloom_filter.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(BlockedBloomFilter, Sample) {
+  /// [Sample blocked bloom]
+  utils::BlockedBloomFilter<std::string> filter(1000);
+  filter.Insert("foo");
+  filter.Insert("bar");
+
+  EXPECT_TRUE(filter.Has("foo"));
+  EXPECT_TRUE(filter.Has("bar"));
+  EXPECT_FALSE(filter.Has("baz"));  // may rarely be a false positive
+  /// [Sample blocked bloom]
+}
+
+TEST(BlockedBloomFilter, NoFalseNegatives) {
+  utils::BlockedBloomFilter<std::uint64_t> filter(10'000);
+  for (std::uint64_t i = 0; i < 10'000; ++i) {
+    filter.Insert(i * 7919);
+  }
+  for (std::uint64_t i = 0; i < 10'000; ++i) {
+    EXPECT_TRUE(filter.Has(i * 7919)) << i;
+  }
+}
+
+TEST(BlockedBloomFilter, FalsePositiveRate) {
+  constexpr std::uint64_t kItems = 10'000;
+  utils::BlockedBloomFilter<std::uint64_t> filter(kItems);
+  for (std::uint64_t i = 0; i < kItems; ++i) {
+    filter.Insert(i);
+  }
+
+  std::size_t false_positives = 0;
+  constexpr std::uint64_t kProbes = 100'000;
+  for (std::uint64_t i = kItems; i < kItems + kProbes; ++i) {
+    false_positives += filter.Has(i);
+  }
+  EXPECT_LT(false_positives, kProbes / 200);
+}
+
+TEST(BlockedBloomFilter, Clear) {
+  utils::BlockedBloomFilter<int> filter(16);
+  for (int i = 0; i < 16; ++i) {
+    filter.Insert(i);
+  }
+  filter.Clear();
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_FALSE(filter.Has(i));
+  }
+}
+
+TEST(BlockedBloomFilter, SmallFilter) {
+  utils::BlockedBloomFilter<int> filter(0);
+  EXPECT_EQ(filter.GetBlocks().size(), 1);
+  filter.Insert(42);
+  EXPECT_TRUE(filter.Has(42));
+}
+
+TEST(BlockedBloomFilter, FromBlocks) {
+  utils::BlockedBloomFilter<std::string> filter(100);
+  for (int i = 0; i < 100; ++i) {
+    filter.Insert(std::to_string(i));
+  }
+
+  const auto& blocks = filter.GetBlocks();
+  auto restored = utils::BlockedBloomFilter<std::string>::FromBlocks(
+      utils::GenerateFixedArray(blocks.size(),
+                                [&](std::size_t i) { return blocks[i]; }));
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(restored.Has(std::to_string(i)));
+  }
+  for (int i = 100; i < 200; ++i) {
+    EXPECT_EQ(restored.Has(std::to_string(i)),
+              filter.Has(std::to_string(i)));
+  }
+}
+
+USERVER_NAMESPACE_END
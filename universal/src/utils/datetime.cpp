@@ -1,8 +1,10 @@
 #include <userver/utils/datetime.hpp>
 
 #include <array>
+#include <cstdint>
 #include <ctime>
 #include <optional>
+#include <string_view>
 
 #include <sys/param.h>
 
@@ -44,6 +46,149 @@ const cctz::time_zone& GetLocalTimezone() {
   return kLocalTz;
 }
 
+// The k*Format formats that have a fast path for UTC
+enum class FastFormat { kDefault, kRfc3339, kIso, kTaximeter };
+
+std::optional<FastFormat> GetFastFormat(const std::string& format) {
+  if (format == kDefaultFormat) return FastFormat::kDefault;
+  if (format == kRfc3339Format) return FastFormat::kRfc3339;
+  if (format == kIsoFormat) return FastFormat::kIso;
+  if (format == kTaximeterFormat) return FastFormat::kTaximeter;
+  return {};
+}
+
+// Timestamps are usually formatted for the current time, so the
+// "YYYY-MM-DDTHH:MM:SS" part is memoized per thread for the last second
+const std::string& GetUtcSecondsPrefix(
+    std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds>
+        seconds) {
+  thread_local std::optional<std::chrono::seconds> cached_seconds;
+  thread_local std::string cached_prefix;
+
+  if (cached_seconds != seconds.time_since_epoch()) {
+    cached_prefix =
+        cctz::format("%Y-%m-%dT%H:%M:%S", seconds, cctz::utc_time_zone());
+    cached_seconds = seconds.time_since_epoch();
+  }
+  return cached_prefix;
+}
+
+void AppendFraction(std::string& result, std::uint32_t value, int digits) {
+  const auto begin = result.size();
+  result.resize(begin + 1 + digits);
+  result[begin] = '.';
+  for (int i = digits; i > 0; --i) {
+    result[begin + i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+}
+
+// Same as cctz::format for the UTC timezone and the FastFormat formats
+std::string UtcTimestring(std::chrono::system_clock::time_point tp,
+                          FastFormat format) {
+  const auto seconds = std::chrono::floor<std::chrono::seconds>(tp);
+  const auto nanoseconds =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(tp - seconds)
+          .count();
+
+  std::string result;
+  result.reserve(32);
+  result.append(GetUtcSecondsPrefix(seconds));
+
+  switch (format) {
+    case FastFormat::kDefault:
+    case FastFormat::kRfc3339:
+      // %E*S omits the trailing zeros of the fraction
+      if (nanoseconds != 0) {
+        AppendFraction(result, nanoseconds, 9);
+        while (result.back() == '0') result.pop_back();
+      }
+      result.append(format == FastFormat::kDefault ? "+0000" : "+00:00");
+      break;
+    case FastFormat::kIso:
+      result.push_back('Z');
+      break;
+    case FastFormat::kTaximeter:
+      AppendFraction(result, nanoseconds / 1000, 6);
+      result.push_back('Z');
+      break;
+  }
+  return result;
+}
+
+bool ParseDigits(std::string_view str, std::size_t pos, std::size_t count,
+                 int& value) {
+  if (pos + count > str.size()) return false;
+  value = 0;
+  for (std::size_t i = pos; i < pos + count; ++i) {
+    if (str[i] < '0' || str[i] > '9') return false;
+    value = value * 10 + (str[i] - '0');
+  }
+  return true;
+}
+
+// Parses the "YYYY-MM-DDTHH:MM:SS[.fraction](Z|+hhmm|+hh:mm)" subset of the
+// %Y-%m-%dT%H:%M:%E*S%z and %Ez formats, nullopt results must be rechecked
+// with cctz::parse, which accepts more variations
+std::optional<std::chrono::system_clock::time_point> FastStringtime(
+    std::string_view str, bool allow_offset_colon) {
+  int year = 0;
+  int month = 0;
+  int day = 0;
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  if (str.size() < 20 || !ParseDigits(str, 0, 4, year) || str[4] != '-' ||
+      !ParseDigits(str, 5, 2, month) || str[7] != '-' ||
+      !ParseDigits(str, 8, 2, day) || str[10] != 'T' ||
+      !ParseDigits(str, 11, 2, hour) || str[13] != ':' ||
+      !ParseDigits(str, 14, 2, minute) || str[16] != ':' ||
+      !ParseDigits(str, 17, 2, second)) {
+    return {};
+  }
+  if (hour > 23 || minute > 59 || second > 59) return {};
+
+  std::size_t pos = 19;
+  std::int64_t nanoseconds = 0;
+  if (str[pos] == '.') {
+    const auto begin = ++pos;
+    while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9') {
+      nanoseconds = nanoseconds * 10 + (str[pos] - '0');
+      ++pos;
+    }
+    const auto digits = pos - begin;
+    if (digits == 0 || digits > 9) return {};
+    for (auto i = digits; i < 9; ++i) nanoseconds *= 10;
+  }
+
+  int offset_minutes = 0;
+  if (pos + 1 == str.size() && (str[pos] == 'Z' || str[pos] == 'z')) {
+    // Zulu
+  } else if (str[pos] == '+' || str[pos] == '-') {
+    const bool is_negative = str[pos] == '-';
+    int offset_hours = 0;
+    if (!ParseDigits(str, pos + 1, 2, offset_hours)) return {};
+    pos += 3;
+    if (allow_offset_colon && pos < str.size() && str[pos] == ':') ++pos;
+    if (!ParseDigits(str, pos, 2, offset_minutes) || pos + 2 != str.size()) {
+      return {};
+    }
+    if (offset_hours > 23 || offset_minutes > 59) return {};
+    offset_minutes += offset_hours * 60;
+    if (is_negative) offset_minutes = -offset_minutes;
+  } else {
+    return {};
+  }
+
+  const cctz::civil_second civil{year, month, day, hour, minute, second};
+  if (civil.month() != month || civil.day() != day) return {};
+
+  return cctz::convert(civil, cctz::utc_time_zone()) -
+         std::chrono::minutes{offset_minutes} +
+         std::chrono::duration_cast<std::chrono::system_clock::duration>(
+             std::chrono::nanoseconds{nanoseconds});
+}
+
 std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
     const std::string& timestring, const cctz::time_zone& timezone,
     const std::string& format) {
@@ -56,6 +201,10 @@ std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
 
 std::chrono::system_clock::time_point DoGuessStringtime(
     const std::string& timestring, const cctz::time_zone& timezone) {
+  // same as the first of the formats, the offset in the string makes the
+  // result independent of the timezone
+  if (const auto tp = FastStringtime(timestring, true)) return *tp;
+
   static const std::array<std::string, 3> formats{{"%Y-%m-%dT%H:%M:%E*S%Ez",
                                                    "%Y-%m-%dT%H:%M:%E*S%z",
                                                    "%Y-%m-%dT%H:%M:%E*SZ"}};
@@ -104,6 +253,11 @@ bool IsTimeBetween(int hour, int min, int hour_from, int min_from, int hour_to,
 
 std::string Timestring(std::chrono::system_clock::time_point tp,
                        const std::string& timezone, const std::string& format) {
+  if (timezone == kDefaultTimezone) {
+    if (const auto fast_format = GetFastFormat(format)) {
+      return UtcTimestring(tp, *fast_format);
+    }
+  }
   return cctz::format(format, tp, GetTimezone(timezone));
 }
 
@@ -127,6 +281,15 @@ std::string LocalTimezoneTimestring(time_t timestamp,
 std::chrono::system_clock::time_point Stringtime(const std::string& timestring,
                                                  const std::string& timezone,
                                                  const std::string& format) {
+  // the offset in the string makes the result independent of the timezone,
+  // but an unknown timezone must still be reported
+  if (timezone == kDefaultTimezone &&
+      (format == kDefaultFormat || format == kRfc3339Format)) {
+    if (const auto tp = FastStringtime(timestring, format == kRfc3339Format)) {
+      return *tp;
+    }
+  }
+
   const auto optional_tp =
       OptionalStringtime(timestring, GetTimezone(timezone), format);
   if (!optional_tp) {
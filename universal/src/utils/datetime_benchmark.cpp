@@ -0,0 +1,43 @@
+#include <userver/utils/datetime.hpp>
+
+#include <chrono>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+void datetime_timestring(benchmark::State& state) {
+  const auto tp = std::chrono::system_clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::Timestring(tp));
+  }
+}
+BENCHMARK(datetime_timestring);
+
+void datetime_timestring_now(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::Timestring(
+        std::chrono::system_clock::now(), utils::datetime::kDefaultTimezone,
+        utils::datetime::kTaximeterFormat));
+  }
+}
+BENCHMARK(datetime_timestring_now);
+
+void datetime_stringtime(benchmark::State& state) {
+  const auto str =
+      utils::datetime::Timestring(std::chrono::system_clock::now());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::Stringtime(str));
+  }
+}
+BENCHMARK(datetime_stringtime);
+
+void datetime_guess_stringtime(benchmark::State& state) {
+  const std::string str = "2009-02-14T02:31:30.123+03:00";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::GuessStringtime(str, "UTC"));
+  }
+}
+BENCHMARK(datetime_guess_stringtime);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,119 @@
+#include <userver/utils/datetime.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <cctz/time_zone.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using std::chrono::system_clock;
+using namespace std::chrono_literals;
+
+const std::vector<system_clock::time_point> kTimePoints{
+    system_clock::time_point{},
+    system_clock::time_point{} - 1ns,
+    system_clock::time_point{} - 1s - 500ms,
+    system_clock::time_point{} + 1234567890s + 100us,
+    system_clock::time_point{} + 1234567890s + 123456789ns,
+    system_clock::time_point{} + 951782400s + 999999999ns,
+    system_clock::time_point{} + 4102444799s + 1ms,
+};
+
+const std::vector<std::string> kFastFormats{
+    utils::datetime::kDefaultFormat,
+    utils::datetime::kRfc3339Format,
+    utils::datetime::kIsoFormat,
+    utils::datetime::kTaximeterFormat,
+};
+
+}  // namespace
+
+TEST(Datetime, TimestringUtc) {
+  for (const auto& format : kFastFormats) {
+    for (const auto tp : kTimePoints) {
+      EXPECT_EQ(utils::datetime::Timestring(tp, "UTC", format),
+                cctz::format(format, tp, cctz::utc_time_zone()))
+          << format;
+    }
+  }
+
+  // the cached seconds are reused for the other fractions and formats
+  const auto tp = system_clock::time_point{} + 1234567890s;
+  EXPECT_EQ(utils::datetime::Timestring(tp), "2009-02-13T23:31:30+0000");
+  EXPECT_EQ(utils::datetime::Timestring(tp + 1ms),
+            "2009-02-13T23:31:30.001+0000");
+  EXPECT_EQ(utils::datetime::Timestring(tp + 1ms, "UTC",
+                                        utils::datetime::kTaximeterFormat),
+            "2009-02-13T23:31:30.001000Z");
+  EXPECT_EQ(utils::datetime::Timestring(tp + 1s, "UTC",
+                                        utils::datetime::kIsoFormat),
+            "2009-02-13T23:31:31Z");
+}
+
+TEST(Datetime, StringtimeUtc) {
+  const auto tp = system_clock::time_point{} + 1234567890s;
+  for (const auto& str : {"2009-02-13T23:31:30+0000", "2009-02-13T23:31:30Z",
+                          "2009-02-13T23:31:30.000z",
+                          "2009-02-14T02:31:30+0300",
+                          "2009-02-13T20:01:30-0330"}) {
+    EXPECT_EQ(utils::datetime::Stringtime(str), tp) << str;
+    EXPECT_EQ(utils::datetime::GuessStringtime(str, "UTC"), tp) << str;
+  }
+
+  EXPECT_EQ(utils::datetime::Stringtime("2009-02-13T23:31:30.123456789+0000"),
+            tp + 123456789ns);
+  EXPECT_EQ(utils::datetime::Stringtime("2009-02-13T23:31:30.5+0000"),
+            tp + 500ms);
+  EXPECT_EQ(utils::datetime::Stringtime("2009-02-14T02:31:30.1+03:00", "UTC",
+                                        utils::datetime::kRfc3339Format),
+            tp + 100ms);
+  EXPECT_EQ(
+      utils::datetime::GuessStringtime("2009-02-14T02:31:30+03:00", "UTC"), tp);
+  EXPECT_EQ(utils::datetime::Stringtime("1969-12-31T23:59:59.5+0000"),
+            system_clock::time_point{} - 500ms);
+
+  // handled by cctz
+  EXPECT_EQ(utils::datetime::Stringtime("2009-02-14T02:31:30+03"), tp);
+  EXPECT_EQ(utils::datetime::Stringtime("2009-02-13T23:31:30.1234567891Z"),
+            tp + 123456789ns);
+}
+
+TEST(Datetime, StringtimeUtcRoundtrip) {
+  for (const auto& format : kFastFormats) {
+    for (const auto tp : kTimePoints) {
+      const auto str = utils::datetime::Timestring(tp, "UTC", format);
+
+      system_clock::time_point expected;
+      ASSERT_TRUE(cctz::parse(format, str, cctz::utc_time_zone(), &expected))
+          << str;
+      EXPECT_EQ(utils::datetime::Stringtime(str, "UTC", format), expected)
+          << str;
+    }
+  }
+}
+
+TEST(Datetime, StringtimeUtcInvalid) {
+  for (const auto& str :
+       {"", "2009-02-13", "2009-02-13T23:31:30", "2009-02-13T23:31:30+",
+        "2009-02-13T23:31:30+000", "2009-02-13T23:31:30+00:00",
+        "2009-02-13T23:31:30+2400", "2009-02-13T23:31:30.+0000",
+        "2009-02-13T24:00:00+0000", "2009-02-29T00:00:00+0000",
+        "2009-13-01T00:00:00+0000", "2009-00-01T00:00:00+0000",
+        "2009-02-00T00:00:00+0000", "2009-02-13T23:31:30+0000 x",
+        "2009-02-13 23:31:30+0000"}) {
+    EXPECT_THROW(utils::datetime::Stringtime(str),
+                 utils::datetime::DateParseError)
+        << str;
+  }
+
+  EXPECT_THROW(utils::datetime::Stringtime("2009-02-13T23:31:30+0000",
+                                           "Unknown/Timezone"),
+               utils::datetime::TimezoneLookupError);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/encoding/hex.hpp>
 
+#include <array>
 #include <stdexcept>
 #include <string_view>
 
@@ -24,85 +25,24 @@ char ToHexChar(int num) {
   return detail::kXdigits[num];
 }
 
-/// Converts xDigit to its value. Undefined behaviour if
-/// xDigit is not one of "0123456789abcdef"
-unsigned char GetXDigitValue(unsigned char x_digit) noexcept {
-  switch (x_digit) {
-    case '0':
-      return 0;
-    case '1':
-      return 1;
-    case '2':
-      return 2;
-    case '3':
-      return 3;
-    case '4':
-      return 4;
-    case '5':
-      return 5;
-    case '6':
-      return 6;
-    case '7':
-      return 7;
-    case '8':
-      return 8;
-    case '9':
-      return 9;
-    case 'a':
-    case 'A':
-      return 10;
-    case 'b':
-    case 'B':
-      return 11;
-    case 'c':
-    case 'C':
-      return 12;
-    case 'd':
-    case 'D':
-      return 13;
-    case 'e':
-    case 'E':
-      return 14;
-    case 'f':
-    case 'F':
-      return 15;
-    default:
-      return 255;
-  }
+// Values of the hex digits, kNotXDigit for other chars
+constexpr unsigned char kNotXDigit = 0xff;
 
-  return 255;  // because undefined behaviour
+constexpr std::array<unsigned char, 256> MakeXDigitValues() noexcept {
+  std::array<unsigned char, 256> values{};
+  for (auto& value : values) value = kNotXDigit;
+  for (unsigned char i = 0; i < 10; ++i) values['0' + i] = i;
+  for (unsigned char i = 0; i < 6; ++i) {
+    values['a' + i] = 10 + i;
+    values['A' + i] = 10 + i;
+  }
+  return values;
 }
 
-bool IsXDigit(unsigned char x_digit) noexcept {
-  switch (x_digit) {
-    case '0':
-    case '1':
-    case '2':
-    case '3':
-    case '4':
-    case '5':
-    case '6':
-    case '7':
-    case '8':
-    case '9':
-    case 'a':
-    case 'A':
-    case 'b':
-    case 'B':
-    case 'c':
-    case 'C':
-    case 'd':
-    case 'D':
-    case 'e':
-    case 'E':
-    case 'f':
-    case 'F':
-      return true;
-    default:
-      return false;
-  }
+constexpr auto kXDigitValues = MakeXDigitValues();
 
-  return false;
+bool IsXDigit(unsigned char x_digit) noexcept {
+  return kXDigitValues[x_digit] != kNotXDigit;
 }
 
 #ifdef __SSSE3__
@@ -134,9 +74,13 @@ std::string_view GetHexPart(std::string_view encoded) noexcept {
 void ToHex(std::string_view input, std::string& out) noexcept {
   out.clear();
   out.resize(input.size() * 2);
+  ToHex(input, out.data());
+}
+
+void ToHex(std::string_view input, char* out) noexcept {
   const auto* first = input.data();
   const auto* last = input.data() + input.size();
-  auto* dst = out.data();
+  auto* dst = out;
 
 #ifdef __SSSE3__
   while (last - first >= 8) {
@@ -187,27 +131,23 @@ bool IsHexData(std::string_view encoded) noexcept {
 
 size_t FromHex(std::string_view encoded, std::string& out) noexcept {
   // we need to read in pairs
-  const char* first = encoded.data();
-  const char* pair_ptr = first;
-  const char* last = first + encoded.size();
-  for (; pair_ptr != last; pair_ptr += 2) {
-    if (!detail::IsXDigit(pair_ptr[0])) {
-      break;
-    }
-
-    if (pair_ptr + 1 == last) {
-      // no second element
-      break;
-    }
-    if (!detail::IsXDigit(pair_ptr[1])) {
-      break;
-    }
-
-    out.push_back((detail::GetXDigitValue(pair_ptr[0]) << 4) |
-                  (detail::GetXDigitValue(pair_ptr[1])));
+  const auto initial_size = out.size();
+  out.resize(initial_size + encoded.size() / 2);
+  auto* dst = out.data() + initial_size;
+
+  std::size_t pos = 0;
+  for (; pos + 1 < encoded.size(); pos += 2) {
+    const auto high =
+        detail::kXDigitValues[static_cast<unsigned char>(encoded[pos])];
+    const auto low =
+        detail::kXDigitValues[static_cast<unsigned char>(encoded[pos + 1])];
+    if (high == detail::kNotXDigit || low == detail::kNotXDigit) break;
+
+    *(dst++) = static_cast<char>((high << 4) | low);
   }
 
-  return static_cast<size_t>(std::distance(first, pair_ptr));
+  out.resize(dst - out.data());
+  return pos;
 }
 
 }  // namespace utils::encoding
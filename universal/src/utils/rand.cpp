@@ -1,6 +1,8 @@
 #include <userver/utils/rand.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -32,6 +34,40 @@ class RandomImpl final : public RandomBase {
   std::mt19937 gen_;
 };
 
+// xoshiro256** by David Blackman and Sebastiano Vigna, several times faster
+// than std::mt19937 and produces 64 bits at once
+class FastRandomImpl final {
+ public:
+  FastRandomImpl() {
+    std::random_device device;
+    while (state_[0] == 0 && state_[1] == 0 && state_[2] == 0 &&
+           state_[3] == 0) {
+      for (auto& word : state_) {
+        word = (std::uint64_t{device()} << 32) | device();
+      }
+    }
+  }
+
+  std::uint64_t operator()() noexcept {
+    const auto result = Rotl(state_[1] * 5, 7) * 9;
+    const auto t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = Rotl(state_[3], 45);
+    return result;
+  }
+
+ private:
+  static std::uint64_t Rotl(std::uint64_t x, int k) noexcept {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::array<std::uint64_t, 4> state_{};
+};
+
 }  // namespace
 
 RandomBase& DefaultRandom() {
@@ -48,6 +84,19 @@ uint32_t Rand() {
   return std::uniform_int_distribution<uint32_t>{0}(DefaultRandom());
 }
 
+void RandFill(void* buffer, std::size_t size) {
+  thread_local FastRandomImpl random;
+
+  auto* dst = static_cast<char*>(buffer);
+  while (size != 0) {
+    const auto value = random();
+    const auto chunk = std::min(size, sizeof(value));
+    std::memcpy(dst, &value, chunk);
+    dst += chunk;
+    size -= chunk;
+  }
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
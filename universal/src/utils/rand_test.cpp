@@ -1,5 +1,6 @@
 #include <userver/utils/rand.hpp>
 
+#include <array>
 #include <random>
 #include <type_traits>
 
@@ -36,4 +37,18 @@ TEST(Random, RandRange) {
   }
 }
 
+TEST(Random, RandFill) {
+  std::array<unsigned char, 19> first{};
+  std::array<unsigned char, 19> second{};
+  utils::RandFill(first.data(), first.size());
+  utils::RandFill(second.data(), second.size());
+  EXPECT_NE(first, second);
+
+  // must not write past the end
+  std::array<unsigned char, 8> buffer{};
+  utils::RandFill(buffer.data(), 3);
+  EXPECT_EQ(buffer[3], 0);
+  EXPECT_EQ(buffer[7], 0);
+}
+
 USERVER_NAMESPACE_END
@@ -95,4 +95,27 @@ BENCHMARK(SmallString_Small_Move)
     ->Range(2, 2 << 10)
     ->Unit(benchmark::kMicrosecond);
 
+// Builds strings of the typical ids and header values sizes piece by piece
+static void SmallString_Std_Append(benchmark::State& state) {
+  const auto s = GenerateString(8);
+  const auto pieces = state.range(0) / 8;
+  for ([[maybe_unused]] auto _ : state) {
+    std::string str;
+    for (int i = 0; i < pieces; ++i) str += s;
+    benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(SmallString_Std_Append)->DenseRange(16, 40, 8);
+
+static void SmallString_Small_Append(benchmark::State& state) {
+  const auto s = GenerateString(8);
+  const auto pieces = state.range(0) / 8;
+  for ([[maybe_unused]] auto _ : state) {
+    utils::SmallString<48> str;
+    for (int i = 0; i < pieces; ++i) str += s;
+    benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(SmallString_Small_Append)->DenseRange(16, 40, 8);
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/formats/json/value.hpp>
@@ -80,6 +82,72 @@ TEST(SmallString, Assign) {
   EXPECT_EQ(str, "123456789012345");
 }
 
+TEST(SmallString, Append) {
+  utils::SmallString<4> str("ab");
+  str.append("cd");
+  EXPECT_EQ(str, "abcd");
+  str += "ef";
+  str += 'g';
+  EXPECT_EQ(str, "abcdefg");
+  str.append(3, 'x').append("");
+  EXPECT_EQ(str, "abcdefgxxx");
+  EXPECT_EQ(str.str(), std::string{"abcdefgxxx"});
+
+  str.clear();
+  EXPECT_TRUE(str.empty());
+  EXPECT_EQ(str, "");
+}
+
+TEST(SmallString, InsertErase) {
+  utils::SmallString<4> str("abef");
+  str.insert(2, "cd");
+  EXPECT_EQ(str, "abcdef");
+  str.insert(0, "_").insert(str.size(), "_");
+  EXPECT_EQ(str, "_abcdef_");
+  EXPECT_THROW(str.insert(str.size() + 1, "x"), std::out_of_range);
+
+  str.erase(0, 1);
+  EXPECT_EQ(str, "abcdef_");
+  str.erase(3, 2);
+  EXPECT_EQ(str, "abcf_");
+  str.erase(3);
+  EXPECT_EQ(str, "abc");
+  str.erase(str.size());
+  EXPECT_EQ(str, "abc");
+  EXPECT_THROW(str.erase(str.size() + 1), std::out_of_range);
+  str.erase();
+  EXPECT_TRUE(str.empty());
+}
+
+TEST(SmallString, ResizeUninitialized) {
+  utils::SmallString<4> str("ab");
+  str.resize_uninitialized(6);
+  ASSERT_EQ(str.size(), 6);
+  std::copy_n("cdef", 4, str.data() + 2);
+  EXPECT_EQ(str, "abcdef");
+
+  str.resize_uninitialized(1);
+  EXPECT_EQ(str, "a");
+}
+
+TEST(SmallString, Compare) {
+  const utils::SmallString<4> a("abc");
+  const utils::SmallString<4> b("abd");
+
+  EXPECT_NE(a, b);
+  EXPECT_NE(a, "ab");
+  EXPECT_NE("ab", a);
+  EXPECT_LT(a, b);
+  EXPECT_LE(a, b);
+  EXPECT_LE(a, a);
+  EXPECT_GT(b, a);
+  EXPECT_GE(b, a);
+  EXPECT_FALSE(b < a);
+
+  const utils::SmallString<4> copy = a;
+  EXPECT_EQ(copy, a);
+}
+
 TEST(SmallString, Log) {
   utils::SmallString<10> str("abcd");
   LOG_INFO() << str;
@@ -204,6 +204,65 @@ std::optional<Enum1> Enum1From2Switch(Enum2 value) {
   }
 }
 
+// 200 enumerators, as in the large protocol enum-to-string mappings
+#define LARGE_ENUM_LIST(X) \
+  X(kValue0) X(kValue1) X(kValue2) X(kValue3) X(kValue4) X(kValue5) X(kValue6) \
+  X(kValue7) X(kValue8) X(kValue9) X(kValue10) X(kValue11) X(kValue12) \
+  X(kValue13) X(kValue14) X(kValue15) X(kValue16) X(kValue17) X(kValue18) \
+  X(kValue19) X(kValue20) X(kValue21) X(kValue22) X(kValue23) X(kValue24) \
+  X(kValue25) X(kValue26) X(kValue27) X(kValue28) X(kValue29) X(kValue30) \
+  X(kValue31) X(kValue32) X(kValue33) X(kValue34) X(kValue35) X(kValue36) \
+  X(kValue37) X(kValue38) X(kValue39) X(kValue40) X(kValue41) X(kValue42) \
+  X(kValue43) X(kValue44) X(kValue45) X(kValue46) X(kValue47) X(kValue48) \
+  X(kValue49) X(kValue50) X(kValue51) X(kValue52) X(kValue53) X(kValue54) \
+  X(kValue55) X(kValue56) X(kValue57) X(kValue58) X(kValue59) X(kValue60) \
+  X(kValue61) X(kValue62) X(kValue63) X(kValue64) X(kValue65) X(kValue66) \
+  X(kValue67) X(kValue68) X(kValue69) X(kValue70) X(kValue71) X(kValue72) \
+  X(kValue73) X(kValue74) X(kValue75) X(kValue76) X(kValue77) X(kValue78) \
+  X(kValue79) X(kValue80) X(kValue81) X(kValue82) X(kValue83) X(kValue84) \
+  X(kValue85) X(kValue86) X(kValue87) X(kValue88) X(kValue89) X(kValue90) \
+  X(kValue91) X(kValue92) X(kValue93) X(kValue94) X(kValue95) X(kValue96) \
+  X(kValue97) X(kValue98) X(kValue99) X(kValue100) X(kValue101) X(kValue102) \
+  X(kValue103) X(kValue104) X(kValue105) X(kValue106) X(kValue107) \
+  X(kValue108) X(kValue109) X(kValue110) X(kValue111) X(kValue112) \
+  X(kValue113) X(kValue114) X(kValue115) X(kValue116) X(kValue117) \
+  X(kValue118) X(kValue119) X(kValue120) X(kValue121) X(kValue122) \
+  X(kValue123) X(kValue124) X(kValue125) X(kValue126) X(kValue127) \
+  X(kValue128) X(kValue129) X(kValue130) X(kValue131) X(kValue132) \
+  X(kValue133) X(kValue134) X(kValue135) X(kValue136) X(kValue137) \
+  X(kValue138) X(kValue139) X(kValue140) X(kValue141) X(kValue142) \
+  X(kValue143) X(kValue144) X(kValue145) X(kValue146) X(kValue147) \
+  X(kValue148) X(kValue149) X(kValue150) X(kValue151) X(kValue152) \
+  X(kValue153) X(kValue154) X(kValue155) X(kValue156) X(kValue157) \
+  X(kValue158) X(kValue159) X(kValue160) X(kValue161) X(kValue162) \
+  X(kValue163) X(kValue164) X(kValue165) X(kValue166) X(kValue167) \
+  X(kValue168) X(kValue169) X(kValue170) X(kValue171) X(kValue172) \
+  X(kValue173) X(kValue174) X(kValue175) X(kValue176) X(kValue177) \
+  X(kValue178) X(kValue179) X(kValue180) X(kValue181) X(kValue182) \
+  X(kValue183) X(kValue184) X(kValue185) X(kValue186) X(kValue187) \
+  X(kValue188) X(kValue189) X(kValue190) X(kValue191) X(kValue192) \
+  X(kValue193) X(kValue194) X(kValue195) X(kValue196) X(kValue197) \
+  X(kValue198) X(kValue199)
+
+enum class LargeEnum {
+#define LARGE_ENUM_ENUMERATOR(name) name,
+  LARGE_ENUM_LIST(LARGE_ENUM_ENUMERATOR)
+#undef LARGE_ENUM_ENUMERATOR
+};
+
+constexpr utils::TrivialBiMap kLargeTrivialBiMap = [](auto selector) {
+#define LARGE_ENUM_CASE(name) .Case(LargeEnum::name, #name)
+  return selector() LARGE_ENUM_LIST(LARGE_ENUM_CASE);
+#undef LARGE_ENUM_CASE
+};
+
+const auto kLargeUnorderedMapping =
+    std::unordered_map<std::string_view, LargeEnum>{
+#define LARGE_ENUM_PAIR(name) {#name, LargeEnum::name},
+        LARGE_ENUM_LIST(LARGE_ENUM_PAIR)
+#undef LARGE_ENUM_PAIR
+    };
+
 }  // namespace
 
 void MappingSmallTrivialBiMap(benchmark::State& state) {
@@ -412,4 +471,47 @@ void MappingEnumsSwitch(benchmark::State& state) {
 }
 BENCHMARK(MappingEnumsSwitch);
 
+void MappingLargeTrivialBiMapToString(benchmark::State& state) {
+  const auto first = Launder(LargeEnum::kValue0);
+  const auto middle = Launder(LargeEnum::kValue100);
+  const auto last = Launder(LargeEnum::kValue199);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(first));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(middle));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(last));
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMapToString);
+
+void MappingLargeTrivialBiMapFromString(benchmark::State& state) {
+  auto first = MyLaunder("kValue0");
+  auto middle = MyLaunder("kValue100");
+  auto last = MyLaunder("kValue199");
+  auto missing = MyLaunder("kValue200");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(first));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(middle));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(last));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(missing));
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMapFromString);
+
+void MappingLargeUnorderedFromString(benchmark::State& state) {
+  auto first = MyLaunder("kValue0");
+  auto middle = MyLaunder("kValue100");
+  auto last = MyLaunder("kValue199");
+  auto missing = MyLaunder("kValue200");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(first));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(middle));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(last));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(missing));
+  }
+}
+BENCHMARK(MappingLargeUnorderedFromString);
+
 USERVER_NAMESPACE_END
@@ -341,4 +341,118 @@ TEST(TrivialBiMap, StringICase) {
       "\xf0\xe1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"));
 }
 
+#define LARGE_ENUM_LIST(X) \
+  X(kAlpha) X(kBravo) X(kCharlie) X(kDelta) X(kEcho) X(kFoxtrot) X(kGolf) \
+  X(kHotel) X(kIndia) X(kJuliett) X(kKilo) X(kLima) X(kMike) X(kNovember) \
+  X(kOscar) X(kPapa) X(kQuebec) X(kRomeo) X(kSierra) X(kTango) X(kUniform) \
+  X(kVictor) X(kWhiskey) X(kXray) X(kYankee) X(kZulu) X(kAlpha2) X(kBravo2) \
+  X(kCharlie2) X(kDelta2) X(kEcho2) X(kFoxtrot2) X(kGolf2) X(kHotel2) \
+  X(kIndia2) X(kJuliett2) X(kKilo2) X(kLima2)
+
+enum class LargeEnum {
+#define LARGE_ENUM_ENUMERATOR(name) name,
+  LARGE_ENUM_LIST(LARGE_ENUM_ENUMERATOR)
+#undef LARGE_ENUM_ENUMERATOR
+};
+
+// More Case statements than utils::impl::kMaxLinearSearchSize
+constexpr utils::TrivialBiMap kLargeEnumToString = [](auto selector) {
+#define LARGE_ENUM_CASE(name) .Case(LargeEnum::name, #name)
+  return selector() LARGE_ENUM_LIST(LARGE_ENUM_CASE);
+#undef LARGE_ENUM_CASE
+};
+
+constexpr utils::TrivialSet kLargeStringSet = [](auto selector) {
+#define LARGE_ENUM_CASE(name) .Case(#name)
+  return selector() LARGE_ENUM_LIST(LARGE_ENUM_CASE);
+#undef LARGE_ENUM_CASE
+};
+
+TEST(TrivialBiMap, Large) {
+  static_assert(kLargeEnumToString.size() > utils::impl::kMaxLinearSearchSize);
+
+  EXPECT_EQ(kLargeEnumToString.TryFind(LargeEnum::kAlpha), "kAlpha");
+  EXPECT_EQ(kLargeEnumToString.TryFind(LargeEnum::kLima2), "kLima2");
+  EXPECT_EQ(kLargeEnumToString.TryFind("kAlpha"), LargeEnum::kAlpha);
+  EXPECT_EQ(kLargeEnumToString.TryFind("kZulu"), LargeEnum::kZulu);
+  EXPECT_EQ(kLargeEnumToString.TryFind("kLima2"), LargeEnum::kLima2);
+
+  EXPECT_FALSE(kLargeEnumToString.TryFind(static_cast<LargeEnum>(-1)));
+  EXPECT_FALSE(kLargeEnumToString.TryFind(static_cast<LargeEnum>(1000)));
+  EXPECT_FALSE(kLargeEnumToString.TryFind(""));
+  EXPECT_FALSE(kLargeEnumToString.TryFind("kAlph"));
+  EXPECT_FALSE(kLargeEnumToString.TryFind("kZulu2"));
+
+#define LARGE_ENUM_CHECK(name)                                            \
+  EXPECT_EQ(kLargeEnumToString.TryFind(LargeEnum::name), #name);          \
+  EXPECT_EQ(kLargeEnumToString.TryFind(std::string_view{#name}),         \
+            LargeEnum::name);                                             \
+  EXPECT_TRUE(kLargeStringSet.Contains(#name));
+  LARGE_ENUM_LIST(LARGE_ENUM_CHECK)
+#undef LARGE_ENUM_CHECK
+
+  EXPECT_FALSE(kLargeStringSet.Contains("kZulu2"));
+}
+
+TEST(TrivialBiMap, LargeConstexpr) {
+  static_assert(kLargeEnumToString.TryFind(LargeEnum::kZulu) == "kZulu");
+  static_assert(kLargeEnumToString.TryFind("kLima2") == LargeEnum::kLima2);
+  static_assert(!kLargeEnumToString.TryFind("kLima3"));
+  static_assert(kLargeStringSet.Contains("kAlpha"));
+  static_assert(!kLargeStringSet.Contains("kAlpha3"));
+}
+
+TEST(TrivialBiMap, LargeSparseWithDuplicates) {
+  static constexpr utils::TrivialBiMap kSquares = [](auto selector) {
+    return selector()
+        .Case(-1, 1)
+        .Case(0, 0)
+        .Case(1, 1)
+        .Case(2, 4)
+        .Case(3, 9)
+        .Case(4, 16)
+        .Case(5, 25)
+        .Case(6, 36)
+        .Case(7, 49)
+        .Case(8, 64)
+        .Case(9, 81)
+        .Case(10, 100)
+        .Case(11, 121)
+        .Case(12, 144)
+        .Case(13, 169)
+        .Case(14, 196)
+        .Case(15, 225)
+        .Case(16, 256)
+        .Case(17, 289)
+        .Case(18, 324)
+        .Case(19, 361)
+        .Case(20, 400)
+        .Case(21, 441)
+        .Case(22, 484)
+        .Case(23, 529)
+        .Case(24, 576)
+        .Case(25, 625)
+        .Case(26, 676)
+        .Case(27, 729)
+        .Case(28, 784)
+        .Case(29, 841)
+        .Case(30, 900)
+        .Case(31, 961)
+        .Case(-2, 4)
+        .Case(2, 5);
+  };
+
+  // The first Case wins, like with the linear search
+  EXPECT_EQ(kSquares.TryFindByFirst(2), 4);
+  EXPECT_EQ(kSquares.TryFindBySecond(1), -1);
+  EXPECT_EQ(kSquares.TryFindBySecond(4), 2);
+  EXPECT_EQ(kSquares.TryFindByFirst(-2), 4);
+  EXPECT_EQ(kSquares.TryFindByFirst(31), 961);
+  EXPECT_EQ(kSquares.TryFindBySecond(961), 31);
+  EXPECT_EQ(kSquares.TryFindBySecond(5), 2);
+  EXPECT_FALSE(kSquares.TryFindByFirst(-3));
+  EXPECT_FALSE(kSquares.TryFindByFirst(32));
+  EXPECT_FALSE(kSquares.TryFindBySecond(2));
+}
+
 USERVER_NAMESPACE_END
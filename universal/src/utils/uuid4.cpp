@@ -8,8 +8,17 @@ USERVER_NAMESPACE_BEGIN
 namespace utils::generators {
 
 std::string GenerateUuid() {
+  std::string result(kUuidLength, '\0');
+  GenerateUuidInto(result.data());
+  return result;
+}
+
+void GenerateUuidInto(char* buffer) {
   const auto val = GenerateBoostUuid();
-  return encoding::ToHex(val.begin(), val.size());
+  static_assert(encoding::LengthInHexForm(val.static_size()) == kUuidLength);
+  encoding::ToHex(
+      std::string_view{reinterpret_cast<const char*>(val.begin()), val.size()},
+      buffer);
 }
 
 }  // namespace utils::generators
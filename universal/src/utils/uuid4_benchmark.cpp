@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+#include <userver/utils/boost_uuid4.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/uuid4.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void uuid_generate_string(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::generators::GenerateUuid());
+  }
+}
+
+void uuid_generate_into(benchmark::State& state) {
+  std::array<char, utils::generators::kUuidLength> buffer{};
+  for (auto _ : state) {
+    utils::generators::GenerateUuidInto(buffer.data());
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+void uuid_generate_boost(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::generators::GenerateBoostUuid());
+  }
+}
+
+void rand_fill(benchmark::State& state) {
+  std::array<char, 16> buffer{};
+  for (auto _ : state) {
+    utils::RandFill(buffer.data(), buffer.size());
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(uuid_generate_string);
+BENCHMARK(uuid_generate_into);
+BENCHMARK(uuid_generate_boost);
+BENCHMARK(rand_fill);
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,12 @@
 #include <userver/utils/uuid4.hpp>
 
+#include <array>
+#include <string_view>
+
 #include <gtest/gtest.h>
 
+#include <userver/utils/encoding/hex.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(UUID, String) {
@@ -14,4 +19,18 @@ TEST(UUID, String) {
             utils::generators::GenerateUuid());
 }
 
+TEST(UUID, Into) {
+  std::array<char, utils::generators::kUuidLength + 1> buffer{};
+  utils::generators::GenerateUuidInto(buffer.data());
+  EXPECT_EQ(buffer.back(), '\0');
+
+  const std::string_view uuid{buffer.data(), utils::generators::kUuidLength};
+  EXPECT_TRUE(utils::encoding::IsHexData(uuid));
+  EXPECT_EQ(uuid[12], '4');  // version 4
+  EXPECT_NE(std::string_view{"89ab"}.find(uuid[16]), std::string_view::npos);
+
+  EXPECT_EQ(utils::generators::GenerateUuid().size(),
+            utils::generators::kUuidLength);
+}
+
 USERVER_NAMESPACE_END